@@ -11,6 +11,9 @@ namespace BABYLON {
 
 class BABYLON_SHARED_EXPORT Animation {
 
+public:
+  friend class SceneSnapshot;
+
 public:
   /** Statics **/
   static constexpr unsigned int ANIMATIONTYPE_FLOAT        = 0;
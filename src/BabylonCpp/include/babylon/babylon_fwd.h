@@ -109,7 +109,9 @@ struct UpdatePayload;
 class Worker;
 struct WorkerReply;
 // --- Core ---
+class FrameArena;
 struct Image;
+class MemoryMappedFile;
 struct NodeCache;
 // - Logging
 class LogChannel;
@@ -121,6 +123,7 @@ class BoundingInfo;
 class BoundingSphere;
 struct ICullable;
 class Ray;
+class SpatialHashGrid;
 // - Octrees
 template <class T>
 struct IOctreeContainer;
@@ -147,6 +150,7 @@ class PointerInfoBase;
 class PointerInfoPre;
 struct RenderingGroupInfo;
 class Scene;
+class TransformHierarchy;
 // --- Interfaces ---
 class ICanvas;
 class ICanvasRenderingContext2D;
@@ -182,6 +186,7 @@ class DirectionalLight;
 class HemisphericLight;
 class IShadowLight;
 class Light;
+class LightGrid;
 class PointLight;
 class ShadowLight;
 class SpotLight;
@@ -194,6 +199,13 @@ struct ISceneLoaderPluginExtensions;
 class SceneLoader;
 // - Plugins / babylon
 struct BabylonFileLoader;
+// - Snapshot
+class SceneSnapshot;
+struct SnapshotFile;
+class SnapshotFileReader;
+class SnapshotFileWriter;
+class SnapshotRecordReader;
+class SnapshotRecordWriter;
 // --- Materials ---
 // - Common
 class ColorCurves;
@@ -276,11 +288,15 @@ class FacetParameters;
 class Geometry;
 class GroundMesh;
 struct IGetSetVerticesData;
+class IndexOptimizer;
+struct IndexOptimizationStats;
 class InstancedMesh;
 class LinesMesh;
 class Mesh;
 class MeshBuilder;
 class MeshLODLevel;
+struct StaticBatchRange;
+class StaticBatching;
 class SubMesh;
 class VertexBuffer;
 class VertexData;
@@ -310,10 +326,11 @@ class TubeOptions;
 // - CSG
 namespace CSG {
 class CSG;
-// class Node;
+class Node;
 class Plane;
 class Polygon;
 class Vertex;
+class VertexArena;
 } // end of namespace CSG
 // - Geometry Primitives
 namespace GeometryPrimitives {
@@ -403,6 +420,9 @@ class PostProcessRenderEffect;
 class PostProcessRenderPass;
 class PostProcessRenderPipeline;
 class PostProcessRenderPipelineManager;
+// - Render Graph
+class RenderGraph;
+struct RenderGraphTextureDescription;
 // --- Probes ---
 class ReflectionProbe;
 // --- Rendering ---
@@ -414,6 +434,7 @@ class EdgesRenderer;
 class OutlineRenderer;
 class RenderingGroup;
 class RenderingManager;
+class RenderTargetScheduler;
 // --- Sprites ---
 class Sprite;
 class SpriteManager;
@@ -369,9 +369,10 @@ public:
   int length;
 
 private:
-  static std::array<Vector3, 2> _tmpVecs;
-  static Quaternion _tmpQuat;
-  static std::array<Matrix, 5> _tmpMats;
+  // Scratch objects of the calling thread
+  static std::array<Vector3, 2>& _tmpVecs();
+  static Quaternion& _tmpQuat();
+  static std::array<Matrix, 5>& _tmpMats();
 
 private:
   Skeleton* _skeleton;
@@ -40,9 +40,10 @@ public:
   float slerpAmount;
 
 private:
-  static std::array<Vector3, 6> _tmpVecs;
-  static Quaternion _tmpQuat;
-  static std::array<Matrix, 2> _tmpMats;
+  // Scratch objects of the calling thread
+  static std::array<Vector3, 6>& _tmpVecs();
+  static Quaternion& _tmpQuat();
+  static std::array<Matrix, 2>& _tmpMats();
 
 private:
   Quaternion _bone1Quat;
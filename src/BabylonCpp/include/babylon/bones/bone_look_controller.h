@@ -155,9 +155,10 @@ public:
   float slerpAmount;
 
 private:
-  static std::array<Vector3, 10> _tmpVecs;
-  static Quaternion _tmpQuat;
-  static std::array<Matrix, 5> _tmpMats;
+  // Scratch objects of the calling thread
+  static std::array<Vector3, 10>& _tmpVecs();
+  static Quaternion& _tmpQuat();
+  static std::array<Matrix, 5>& _tmpMats();
 
 private:
   bool _minYawSet;
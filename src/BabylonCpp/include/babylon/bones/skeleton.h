@@ -62,6 +62,7 @@ public:
                              const std::function<void()>& onAnimationEnd
                              = nullptr);
 
+  bool isDirty() const;
   void _markAsDirty();
   void _registerMeshWithPoseMatrix(AbstractMesh* mesh);
   void _unregisterMeshWithPoseMatrix(AbstractMesh* mesh);
@@ -0,0 +1,168 @@
+#ifndef BABYLON_CORE_FRAME_ARENA_H
+#define BABYLON_CORE_FRAME_ARENA_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Bump allocator for the temporary containers of a frame. Each thread
+ * has its own arena, the memory is released all at once when the arena is
+ * reset by Engine::endFrame. The chunks used during a frame are merged into a
+ * single chunk on reset, so a frame allocating no more than the previous ones
+ * does not touch the heap. The capacity left by a spike is given back after
+ * TrimFrameCount frames using less than a quarter of it.
+ *
+ * Scene::render does not reset the arena: applications rendering without
+ * Engine::runRenderLoop must call Engine::endFrame after each frame, or the
+ * arena grows with every frame.
+ */
+class BABYLON_SHARED_EXPORT FrameArena {
+
+public:
+  /**
+   * Size in bytes of the first chunk.
+   */
+  static constexpr size_t ChunkSize = 65536;
+
+  /**
+   * Number of consecutive frames using less than a quarter of the capacity
+   * after which the arena shrinks to twice the peak of these frames.
+   */
+  static constexpr size_t TrimFrameCount = 120;
+
+public:
+  /**
+   * @brief Returns the arena of the calling thread.
+   */
+  static FrameArena& Current();
+
+  FrameArena();
+  ~FrameArena();
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  /**
+   * @brief Returns a block of byteLength bytes, valid until the next reset.
+   */
+  void* allocate(size_t byteLength, size_t alignment);
+
+  /**
+   * @brief Blocks are only released by reset, this is a no-op.
+   */
+  void deallocate(void* data, size_t byteLength);
+
+  /**
+   * @brief Releases all the blocks allocated since the last reset, and trims
+   * the capacity when the last frames stayed well below it.
+   */
+  void reset();
+
+  /**
+   * @brief Returns the number of blocks allocated since the last reset.
+   */
+  size_t allocationCount() const;
+
+  /**
+   * @brief Returns the number of bytes allocated since the last reset.
+   */
+  size_t bytesAllocated() const;
+
+  /**
+   * @brief Returns the number of chunks allocated on the heap since the
+   * creation of the arena.
+   */
+  size_t heapAllocationCount() const;
+
+  /**
+   * @brief Returns the total size in bytes of the chunks.
+   */
+  size_t capacity() const;
+
+private:
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> data;
+    size_t size;
+  }; // end of struct Chunk
+
+  void _addChunk(size_t size);
+
+private:
+  std::vector<Chunk> _chunks;
+  size_t _currentChunk;
+  size_t _offset;
+  size_t _allocationCount;
+  size_t _bytesAllocated;
+  size_t _heapAllocationCount;
+  // Frames using less than a quarter of the capacity, and their peak
+  size_t _quietFrameCount;
+  size_t _quietFramePeak;
+
+}; // end of class FrameArena
+
+/**
+ * @brief Standard allocator allocating from a frame arena, by default the
+ * arena of the thread creating the container. Containers using it must not
+ * outlive the frame.
+ */
+template <typename T>
+class FrameAllocator {
+
+public:
+  using value_type                             = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap            = std::true_type;
+
+  FrameAllocator() : _arena{&FrameArena::Current()}
+  {
+  }
+
+  explicit FrameAllocator(FrameArena& arena) : _arena{&arena}
+  {
+  }
+
+  template <typename U>
+  FrameAllocator(const FrameAllocator<U>& other) : _arena{other.arena()}
+  {
+  }
+
+  T* allocate(size_t count)
+  {
+    return static_cast<T*>(_arena->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* data, size_t count)
+  {
+    _arena->deallocate(data, count * sizeof(T));
+  }
+
+  FrameArena* arena() const
+  {
+    return _arena;
+  }
+
+private:
+  FrameArena* _arena;
+
+}; // end of class FrameAllocator
+
+template <typename T, typename U>
+bool operator==(const FrameAllocator<T>& a, const FrameAllocator<U>& b)
+{
+  return a.arena() == b.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const FrameAllocator<T>& a, const FrameAllocator<U>& b)
+{
+  return a.arena() != b.arena();
+}
+
+template <typename T>
+using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_FRAME_ARENA_H
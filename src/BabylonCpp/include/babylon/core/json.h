@@ -7,7 +7,7 @@
 namespace BABYLON {
 namespace Json {
 
-inline std::string Parse(Json::value parsedData, const char* data)
+inline std::string Parse(Json::value& parsedData, const char* data)
 {
   return picojson::parse(parsedData, data, data + strlen(data));
 }
@@ -0,0 +1,47 @@
+#ifndef BABYLON_CORE_MEMORY_MAPPED_FILE_H
+#define BABYLON_CORE_MEMORY_MAPPED_FILE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Read-only view of a whole file, memory-mapped where the platform
+ * supports it so that the pages are only loaded when they are accessed.
+ */
+class BABYLON_SHARED_EXPORT MemoryMappedFile {
+
+public:
+  /**
+   * @brief Maps the file, returns nullptr if it can not be opened.
+   */
+  static std::unique_ptr<MemoryMappedFile> Open(const std::string& filename);
+
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  const uint8_t* data() const;
+  size_t size() const;
+
+  /**
+   * @brief Returns whether the content is mapped or was read into memory.
+   */
+  bool isMapped() const;
+
+private:
+  MemoryMappedFile();
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+  bool _isMapped;
+  // Fallback when the file can not be mapped
+  std::vector<uint8_t> _buffer;
+
+}; // end of class MemoryMappedFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_MEMORY_MAPPED_FILE_H
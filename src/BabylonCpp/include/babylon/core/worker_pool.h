@@ -0,0 +1,59 @@
+#ifndef BABYLON_CORE_WORKER_POOL_H
+#define BABYLON_CORE_WORKER_POOL_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/shared_queue.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Persistent worker threads running the tasks of parallel loops, so
+ * that a loop run every frame does not create threads every frame.
+ *
+ * The calling thread takes part in the loop: the tasks are claimed one at a
+ * time by the calling thread and by the workers that are free, so a loop
+ * started from a task of another loop completes even when all the workers
+ * are busy.
+ */
+class BABYLON_SHARED_EXPORT WorkerPool {
+
+public:
+  /**
+   * @brief Returns the pool shared by the parallel loops, with one worker per
+   * hardware thread besides the calling one.
+   */
+  static WorkerPool& Shared();
+
+  explicit WorkerPool(size_t workerCount);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  size_t workerCount() const;
+
+  /**
+   * @brief Calls task(index) for each index of the range [0, taskCount) on at
+   * most maxThreads threads, the calling thread included, and returns once
+   * all the tasks are done. The first exception thrown by a task is rethrown
+   * on the calling thread.
+   */
+  void run(size_t taskCount, size_t maxThreads,
+           const std::function<void(size_t index)>& task);
+
+private:
+  void _work();
+
+private:
+  // Empty callbacks stop the workers
+  SharedQueue<std::function<void()>> _queue;
+  std::vector<std::thread> _workers;
+
+}; // end of class WorkerPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_WORKER_POOL_H
@@ -0,0 +1,95 @@
+#ifndef BABYLON_CULLING_SPATIAL_HASH_GRID_H
+#define BABYLON_CULLING_SPATIAL_HASH_GRID_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Sparse uniform grid indexing bounding spheres by id, supporting
+ * incremental moves and sphere overlap queries.
+ *
+ * Each sphere is registered in every cell it overlaps. Spheres overlapping
+ * more than maxCellsPerItem cells (huge or infinite radius) are kept in a
+ * separate list which is tested by every query.
+ */
+class BABYLON_SHARED_EXPORT SpatialHashGrid {
+
+public:
+  SpatialHashGrid(float cellSize = 10.f, size_t maxCellsPerItem = 64);
+  ~SpatialHashGrid();
+
+  /**
+   * @brief Inserts or moves the sphere with the given id.
+   * @returns Whether or not the cells of the sphere changed.
+   */
+  bool update(size_t id, const Vector3& center, float radius);
+
+  /**
+   * @brief Removes the sphere with the given id.
+   */
+  void remove(size_t id);
+
+  /**
+   * @brief Returns whether or not a sphere is registered with the given id.
+   */
+  bool contains(size_t id) const;
+
+  /**
+   * @brief Fills result with the ids of the spheres overlapping the given
+   * sphere, in increasing order.
+   */
+  void query(const Vector3& center, float radius,
+             std::vector<size_t>& result) const;
+
+  /**
+   * @brief Returns the number of registered spheres.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Returns the number of non empty cells.
+   */
+  size_t cellCount() const;
+
+  /**
+   * @brief Removes all the spheres.
+   */
+  void clear();
+
+  float cellSize() const;
+
+private:
+  struct Item {
+    Vector3 center;
+    float radius;
+    // Cell range (minimum and maximum cell along each axis)
+    std::array<int, 6> cells;
+    bool registered;
+    bool large;
+  };
+
+  bool _cellRange(const Vector3& center, float radius,
+                  std::array<int, 6>& cells) const;
+  void _unlink(size_t id);
+  void _link(size_t id);
+  static uint64_t _key(int x, int y, int z);
+  static bool _overlaps(const Item& item, const Vector3& center, float radius);
+
+private:
+  float _cellSize;
+  size_t _maxCellsPerItem;
+  size_t _size;
+  std::vector<Item> _items;
+  std::unordered_map<uint64_t, std::vector<size_t>> _cells;
+  std::vector<size_t> _largeItems;
+  // Query stamps, used to report each sphere once
+  mutable std::vector<uint32_t> _stamps;
+  mutable uint32_t _stamp;
+
+}; // end of class SpatialHashGrid
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_SPATIAL_HASH_GRID_H
@@ -154,6 +154,11 @@ public:
                    int requiredHeight = 0);
   Viewport& setDirectViewport(int x, int y, int width, int height);
   void beginFrame();
+  /**
+   * @brief Ends the frame and resets the frame arena of the calling thread.
+   * Called by runRenderLoop, it must be called after each frame by the
+   * applications calling Scene::render directly.
+   */
   void endFrame();
 
   /**
@@ -179,19 +184,43 @@ public:
                          bool disableGenerateMipMaps                 = false,
                          const std::function<void()>& onBeforeUnbind = nullptr);
   void generateMipMapsForCubemap(GL::IGLTexture* texture);
+  /**
+   * @brief Copies the color buffer, and optionally the depth buffer, of a
+   * render target to a render target of the same size and format. The
+   * current framebuffer stays bound.
+   * @returns false when framebuffer blits are not supported (WebGL 1).
+   */
+  bool copyFramebuffer(GL::IGLTexture* source, GL::IGLTexture* destination,
+                       bool copyDepth = true);
   void flushFramebuffer();
   void restoreDefaultFramebuffer();
 
   /** UBOs **/
   GLBufferPtr createUniformBuffer(const Float32Array& elements);
   GLBufferPtr createDynamicUniformBuffer(const Float32Array& elements);
+  /**
+   * @brief Updates an uniform buffer. The offset and the count are expressed
+   * in number of floats and elements[offset, offset + count[ is written at the
+   * same position. Without count, the elements are written up to the end.
+   */
   void updateUniformBuffer(GL::IGLBuffer* uniformBuffer,
                            const Float32Array& elements, int offset = -1,
                            int count = -1);
 
   /** VBOs **/
   GLBufferPtr createVertexBuffer(const Float32Array& vertices);
+  /**
+   * @brief Creates a static vertex buffer of compressed vertices, packed in
+   * 16-bit words.
+   */
+  GLBufferPtr createVertexBuffer(const Uint16Array& vertices);
   GLBufferPtr createDynamicVertexBuffer(const Float32Array& vertices);
+  /**
+   * @brief Updates a dynamic vertex buffer. Without count, the whole vertices
+   * array is written at the offset expressed in bytes. Otherwise the offset
+   * and the count are expressed in number of floats and
+   * vertices[offset, offset + count[ is written at the same position.
+   */
   void updateDynamicVertexBuffer(const GLBufferPtr& vertexBuffer,
                                  const Float32Array& vertices, int offset = -1,
                                  int count = -1);
@@ -202,9 +231,13 @@ public:
   void bindUniformBlock(GL::IGLProgram* shaderProgram,
                         const std::string blockName, unsigned int index);
   void updateArrayBuffer(const Float32Array& data);
-  GLVertexArrayObjectPtr recordVertexArrayObject(
-    const std::unordered_map<std::string, VertexBuffer*>& vertexBuffers,
-    GL::IGLBuffer* indexBuffer, Effect* effect);
+  /**
+   * @brief Records a vertex array object binding the given vertex buffers
+   * (indexed by vertex buffer kind) and index buffer for the given effect.
+   */
+  GLVertexArrayObjectPtr
+  recordVertexArrayObject(const std::vector<VertexBuffer*>& vertexBuffers,
+                          GL::IGLBuffer* indexBuffer, Effect* effect);
   void bindVertexArrayObject(GL::IGLVertexArrayObject* vertexArrayObject,
                              GL::IGLBuffer* indexBuffer);
   void bindBuffersDirectly(GL::IGLBuffer* vertexBuffer,
@@ -214,9 +247,21 @@ public:
   void bindBuffers(
     const std::unordered_map<std::string, VertexBuffer*>& vertexBuffers,
     GL::IGLBuffer* indexBuffer, Effect* effect);
+  /**
+   * @brief Binds the given vertex buffers (indexed by vertex buffer kind) and
+   * index buffer for the given effect.
+   */
+  void bindBuffers(const std::vector<VertexBuffer*>& vertexBuffers,
+                   GL::IGLBuffer* indexBuffer, Effect* effect);
   void unbindInstanceAttributes();
   void releaseVertexArrayObject(GL::IGLVertexArrayObject* vao);
   bool _releaseBuffer(GL::IGLBuffer* buffer);
+  /**
+   * @brief Releases an uniform buffer owned by the caller. A buffer still
+   * bound to an uniform block binding point is kept alive by the engine until
+   * it is unbound.
+   */
+  void _releaseUniformBuffer(GLBufferPtr&& buffer);
   GLBufferPtr createInstancesBuffer(unsigned int capacity);
   void deleteInstancesBuffer(GL::IGLBuffer* buffer);
   void updateAndBindInstancesBuffer(GL::IGLBuffer* instancesBuffer,
@@ -239,6 +284,28 @@ public:
                        EffectCreationOptions& options, Engine* engine);
   Effect* createEffect(std::unordered_map<std::string, std::string>& baseName,
                        EffectCreationOptions& options, Engine* engine);
+
+  /**
+   * @brief Returns the effect registered for the shader name, the defines and
+   * the lights count, nullptr if none. The hash (see
+   * MaterialHelper::EffectDefinesHash()) only selects the candidates, the
+   * full key is compared.
+   */
+  Effect* getEffectByDefinesHash(uint64_t definesHash,
+                                 const std::string& shaderName,
+                                 const MaterialDefines& defines,
+                                 unsigned int maxSimultaneousLights) const;
+
+  /**
+   * @brief Registers a created effect for its shader name, its defines and
+   * its lights count, so that it can be found without generating the defines
+   * string.
+   */
+  void registerEffectDefinesHash(uint64_t definesHash,
+                                 const std::string& shaderName,
+                                 const MaterialDefines& defines,
+                                 unsigned int maxSimultaneousLights,
+                                 Effect* effect);
   Effect* createEffectForParticles(
     const std::string& fragmentName,
     const std::vector<std::string>& uniformsNames,
@@ -436,6 +503,26 @@ public:
   float getFps() const;
   microseconds_t getDeltaTime() const;
 
+  /**
+   * @brief Returns the identifier of the current frame, incremented by
+   * beginFrame.
+   */
+  size_t getFrameId() const;
+
+  /** Frame arena **/
+
+  /**
+   * @brief Returns the number of blocks allocated in the frame arena during
+   * the last frame.
+   */
+  size_t getFrameArenaAllocationCount() const;
+
+  /**
+   * @brief Returns the number of heap allocations made by the frame arena
+   * during the last frame, zero once the arena is large enough for a frame.
+   */
+  size_t getFrameArenaHeapAllocationCount() const;
+
   /** Statics **/
 
   static Engine* LastCreatedEngine();
@@ -472,6 +559,14 @@ protected:
    */
   Engine(ICanvas* canvas, const EngineOptions& options = EngineOptions());
 
+private:
+  struct EffectDefinesEntry {
+    std::string shaderName;
+    std::unique_ptr<MaterialDefines> defines;
+    unsigned int maxSimultaneousLights;
+    Effect* effect;
+  }; // end of struct EffectDefinesEntry
+
 private:
   void _onVRFullScreenTriggered();
   void _getVRDisplays();
@@ -483,9 +578,9 @@ private:
                            unsigned int type, bool normalized, int stride,
                            int offset);
   void _bindIndexBufferWithCache(GL::IGLBuffer* indexBuffer);
-  void _bindVertexBuffersAttributes(
-    const std::unordered_map<std::string, VertexBuffer*>& vertexBuffers,
-    Effect* effect);
+  void
+  _bindVertexBuffersAttributes(const std::vector<VertexBuffer*>& vertexBuffers,
+                               Effect* effect);
   void _unBindVertexArrayObject();
   void setProgram(GL::IGLProgram* program);
   void activateTexture(unsigned int texture);
@@ -580,6 +675,12 @@ private:
   std::vector<high_res_time_point_t> previousFramesDuration;
   float fps;
   microseconds_t deltaTime;
+  size_t _frameId;
+
+  // Frame arena
+  size_t _frameArenaHeapAllocationStart;
+  size_t _frameArenaAllocationCount;
+  size_t _frameArenaHeapAllocationCount;
 
   // States
   std::unique_ptr<Internals::_DepthCullingState> _depthCullingState;
@@ -595,16 +696,23 @@ private:
   Effect* _currentEffect;
   GL::IGLProgram* _currentProgram;
   std::unordered_map<std::string, std::unique_ptr<Effect>> _compiledEffects;
+  std::unordered_multimap<uint64_t, EffectDefinesEntry> _effectsByDefinesHash;
+  // Hashes of the registered effects, for _releaseEffect()
+  std::unordered_map<Effect*, std::vector<uint64_t>> _effectDefinesHashes;
   std::vector<bool> _vertexAttribArraysEnabled;
   Viewport* _cachedViewport;
   GL::IGLVertexArrayObject* _cachedVertexArrayObject;
-  std::unordered_map<std::string, VertexBuffer*> _cachedVertexBuffersMap;
+  // Vertex buffers indexed by kind
+  std::vector<VertexBuffer*> _cachedVertexBufferSlots;
+  std::vector<VertexBuffer*> _vertexBufferSlotsTmp;
   GL::IGLBuffer* _cachedVertexBuffers;
   GL::IGLBuffer* _cachedIndexBuffer;
   Effect* _cachedEffectForVertexBuffers;
   GL::IGLTexture* _currentRenderTarget;
   bool _uintIndicesCurrentlySet;
   std::unordered_map<int, GL::IGLBuffer*> _currentBoundBuffer;
+  // Uniform buffers released by their owner while still bound
+  std::vector<GLBufferPtr> _releasedUniformBuffers;
   GL::IGLFramebuffer* _currentFramebuffer;
   std::unordered_map<unsigned int, BufferPointer> _currentBufferPointers;
   Int32Array _currentInstanceLocations;
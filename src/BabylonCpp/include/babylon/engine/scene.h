@@ -93,6 +93,12 @@ public:
   void setTexturesEnabled(bool value);
   bool skeletonsEnabled() const;
   void setSkeletonsEnabled(bool value);
+  /**
+   * Automatic instancing of the meshes sharing the same geometry and material
+   * (see RenderingManager::autoInstancing).
+   */
+  bool autoInstancing() const;
+  void setAutoInstancing(bool value);
   PostProcessRenderPipelineManager* postProcessRenderPipelineManager();
   Plane* clipPlane();
   void setClipPlane(const Plane& plane);
@@ -183,6 +189,12 @@ public:
   void _addPendingData(GL::IGLTexture* texure);
   void _removePendingData(GL::IGLTexture* texture);
   void getWaitingItemsCount();
+  /**
+   * @brief Registers a mesh whose indices are optimized on a background
+   * thread, the result is applied at the beginning of the next rendered frame
+   * after its completion.
+   */
+  void _addPendingIndexOptimization(Mesh* mesh);
 
   /**
    * @brief Registers a function to be executed when the scene is ready.
@@ -438,6 +450,10 @@ public:
 
   bool _isInIntermediateRendering() const;
   void updateTransformMatrix(bool force = false);
+  /**
+   * @brief Renders the scene. The temporaries of the frame are released by
+   * Engine::endFrame, not by this method (see FrameArena).
+   */
   void render();
 
   /** Audio **/
@@ -455,6 +471,73 @@ public:
   void disableGeometryBufferRenderer();
   void freezeMaterials();
   void unfreezeMaterials();
+
+  /** Transform hierarchy **/
+
+  /**
+   * @brief Enables the flat transform hierarchy: the world matrices of the
+   * scene meshes are then updated once per frame in a single (optionally
+   * parallel) pass instead of being recomputed on demand.
+   * @returns The transform hierarchy.
+   */
+  TransformHierarchy* enableTransformHierarchy();
+
+  /**
+   * @brief Disables the flat transform hierarchy.
+   */
+  void disableTransformHierarchy();
+
+  /**
+   * @brief Returns the transform hierarchy if enabled, nullptr otherwise.
+   */
+  TransformHierarchy* transformHierarchy();
+
+  /** Light assignment **/
+
+  /**
+   * @brief Enables the range aware light assignment: the lights of each mesh
+   * are then selected through a spatial index by bounding sphere overlap and
+   * relevance, and only recomputed for the meshes affected by a change.
+   * @param cellSize Size of the cells of the spatial index.
+   * @returns The light grid.
+   */
+  LightGrid* enableLightGrid(float cellSize = 10.f);
+
+  /**
+   * @brief Disables the range aware light assignment, every enabled light of
+   * the scene is then assigned to every mesh it can affect.
+   */
+  void disableLightGrid();
+
+  /**
+   * @brief Returns the light grid if enabled, nullptr otherwise.
+   */
+  LightGrid* lightGrid();
+
+  /** Render target scheduling **/
+
+  /**
+   * @brief Enables the frame budgeted scheduling of the render targets: the
+   * render targets due for a refresh are ranked by priority, screen
+   * contribution and staleness, and only rendered within the face budget of
+   * the frame.
+   * @param faceBudget Number of render target faces rendered per frame.
+   * @returns The render target scheduler.
+   */
+  RenderTargetScheduler* enableRenderTargetScheduler(unsigned int faceBudget
+                                                     = 6);
+
+  /**
+   * @brief Disables the render target scheduling, every render target due
+   * for a refresh is then rendered.
+   */
+  void disableRenderTargetScheduler();
+
+  /**
+   * @brief Returns the render target scheduler if enabled, nullptr otherwise.
+   */
+  RenderTargetScheduler* renderTargetScheduler();
+
   void dispose(bool doNotRecurse = false) override;
   bool isDisposed() const;
 
@@ -555,6 +638,22 @@ public:
   void disablePhysicsEngine();
   bool isPhysicsEnabled();
 
+  /** Snapshot **/
+
+  /**
+   * @brief Writes the lights, animations, materials, skeletons, meshes and
+   * cameras of the scene into a binary snapshot file.
+   * @see SceneSnapshot
+   */
+  bool saveSnapshot(const std::string& filename);
+
+  /**
+   * @brief Adds the content of a binary snapshot file to the scene, the
+   * geometry buffers being read from a memory mapping of the file.
+   * @see SceneSnapshot
+   */
+  bool loadSnapshot(const std::string& filename);
+
   /** Misc. **/
   void createDefaultCameraOrLight(bool createArcRotateCamera = false);
   Mesh* createDefaultSkybox(BaseTexture* environmentTexture = nullptr,
@@ -628,8 +727,12 @@ private:
   void _animate();
   void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh);
   void _evaluateActiveMeshes();
+  void _applyPendingIndexOptimizations();
   void _activeMesh(AbstractMesh* mesh);
   void _renderForCamera(Camera* camera);
+  std::vector<RenderTargetTexture*>
+  _scheduleRenderTargets(const std::vector<RenderTargetTexture*>& renderTargets,
+                         Camera* camera);
   void _processSubCameras(Camera* camera);
   void _checkIntersections();
   void _updateAudioParameters();
@@ -1008,6 +1111,10 @@ private:
   std::unique_ptr<DebugLayer> _debugLayer;
   std::unique_ptr<DepthRenderer> _depthRenderer;
   std::unique_ptr<GeometryBufferRenderer> _geometryBufferRenderer;
+  std::unique_ptr<TransformHierarchy> _transformHierarchy;
+  std::unique_ptr<LightGrid> _lightGrid;
+  std::unique_ptr<RenderTargetScheduler> _renderTargetScheduler;
+  std::vector<Mesh*> _pendingIndexOptimizations;
   unsigned int _uniqueIdCounter;
   AbstractMesh* _pickedDownMesh;
   AbstractMesh* _pickedUpMesh;
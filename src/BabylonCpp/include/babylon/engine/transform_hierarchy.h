@@ -0,0 +1,146 @@
+#ifndef BABYLON_ENGINE_TRANSFORM_HIERARCHY_H
+#define BABYLON_ENGINE_TRANSFORM_HIERARCHY_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Scene level transform system storing the local TRS of the registered
+ * meshes in flat arrays sorted in parent-before-child order.
+ *
+ * Meshes are flagged dirty by their transform setters (setPosition,
+ * setRotation, setScaling, setRotationQuaternion, setPivotMatrix, markAsDirty,
+ * ...), by the animations and by the physics impostors. The world matrices are
+ * then updated once per frame in a single pass, split by root subtree over
+ * several threads for large hierarchies, and the bounding info of each updated
+ * mesh is refreshed in the same pass.
+ *
+ * The reference accessors (position(), rotation(), scaling(),
+ * rotationQuaternion()) flag the mesh dirty as well, since the returned
+ * reference may be written to (e.g. mesh->position().x = 1.f). Clean nodes are
+ * never compared against their cached transform.
+ *
+ * Meshes relying on the active camera (billboards, infinite distance), meshes
+ * attached to a bone and meshes parented to a non mesh node keep using the
+ * AbstractMesh::computeWorldMatrix path but are still updated in hierarchy
+ * order.
+ */
+class BABYLON_SHARED_EXPORT TransformHierarchy {
+
+public:
+  /** Dirty flags **/
+  static constexpr std::uint8_t LOCAL_DIRTY   = 0x01;
+  static constexpr std::uint8_t WORLD_UPDATED = 0x02;
+  static constexpr std::uint8_t FALLBACK      = 0x04;
+
+  /**
+   * Minimum number of nodes in the hierarchy before the world matrix update is
+   * split over multiple threads.
+   */
+  static size_t ParallelThreshold;
+
+public:
+  TransformHierarchy(Scene* scene);
+  ~TransformHierarchy();
+
+  /**
+   * @brief Registers the mesh in the hierarchy.
+   */
+  void addNode(AbstractMesh* mesh);
+
+  /**
+   * @brief Unregisters the mesh from the hierarchy.
+   */
+  void removeNode(AbstractMesh* mesh);
+
+  /**
+   * @brief Flags the local transform of the node at the given index as dirty.
+   */
+  void markAsDirty(int index);
+
+  /**
+   * @brief Flags the hierarchy as requiring a reordering (reparenting, node
+   * added or removed).
+   */
+  void markStructureAsDirty();
+
+  /**
+   * @brief Returns whether or not some transforms were modified since the last
+   * update.
+   */
+  bool hasPendingChanges() const;
+
+  /**
+   * @brief Returns whether or not the hierarchy is currently being updated.
+   */
+  bool isUpdating() const;
+
+  /**
+   * @brief Returns the number of registered nodes.
+   */
+  size_t size() const;
+
+  /**
+   * @brief Updates the world matrices (and bounding infos) of all the dirty
+   * nodes and their descendants.
+   * @returns The number of world matrices updated.
+   */
+  size_t update();
+
+  /**
+   * @brief Updates the world matrix of the node at the given index, along with
+   * the subtree of its topmost dirty ancestor (or itself). The other dirty
+   * nodes are left for the next update.
+   * @returns The number of world matrices updated.
+   */
+  size_t updateNode(int index);
+
+private:
+  void _rebuild();
+  void _syncStructure();
+  bool _prepareNode(size_t index);
+  bool _finalizeNode(size_t index);
+  void _gatherLocalTransform(size_t index);
+  void _updateRange(size_t start, size_t end, int renderId);
+  static void _composeLocal(const Vector3& scaling, const Quaternion& rotation,
+                            const Vector3& translation, Matrix& result);
+  static void _multiplyToRef(const Matrix& a, const Matrix& b, Matrix& result);
+
+public:
+  /**
+   * Maximum number of threads used by the world matrix update.
+   */
+  unsigned int maxThreads;
+
+private:
+  Scene* _scene;
+  std::vector<AbstractMesh*> _registeredNodes;
+  bool _structureDirty;
+  bool _hasPendingChanges;
+  bool _isUpdating;
+  size_t _fallbackCount;
+  // Flat hierarchy (parent-before-child order)
+  std::vector<AbstractMesh*> _nodes;
+  std::vector<Node*> _parentNodes;
+  std::vector<int> _parents;
+  // End (exclusive) of the subtree of each node
+  std::vector<size_t> _subtreeEnds;
+  std::vector<std::uint8_t> _flags;
+  std::vector<Vector3> _positions;
+  std::vector<Vector3> _scalings;
+  std::vector<Quaternion> _rotations;
+  std::vector<Matrix> _localMatrices;
+  std::vector<Matrix> _worldMatrices;
+  // Root subtrees (contiguous ranges)
+  std::vector<std::pair<size_t, size_t>> _subtrees;
+  std::vector<bool> _subtreeHasFallback;
+
+}; // end of class TransformHierarchy
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINE_TRANSFORM_HIERARCHY_H
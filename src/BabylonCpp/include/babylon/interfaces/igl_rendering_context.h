@@ -179,6 +179,7 @@ enum GLEnums : GLenum {
   INT            = 0x1404,
   UNSIGNED_INT   = 0x1405,
   FLOAT          = 0x1406,
+  HALF_FLOAT     = 0x140B,
   /* PixelFormat */
   DEPTH_COMPONENT = 0x1902,
   ALPHA           = 0x1906,
@@ -718,6 +719,22 @@ public:
                              const Float32Array& data)
     = 0;
 
+  /**
+   * @brief Updates a subset of a buffer object's data store.
+   * @param target A GLenum specifying the binding point (target).
+   * @param offset A GLintptr specifying an offset in bytes where the data
+   * replacement will start.
+   * @param data A Float32Array typed array from which the data is copied into
+   * the data store.
+   * @param srcOffset A GLuint specifying the element index offset where to
+   * start reading the data.
+   * @param length A GLuint specifying the number of elements to copy.
+   */
+  virtual void bufferSubData(GLenum target, GLintptr offset,
+                             const Float32Array& data, GLuint srcOffset,
+                             GLuint length)
+    = 0;
+
   /**
    * @brief Updates a subset of a buffer object's data store.
    * @param target A GLenum specifying the binding point (target).
@@ -52,7 +52,7 @@ public:
    * @brief Sets the passed Effect object with the DirectionalLight transformed
    * position (or position if not parented) and the passed name.
    */
-  void transferToEffect(Effect* effect, const std::string& lightIndex) override;
+  void transferToEffect(Effect* effect, unsigned int lightIndex) override;
 
 protected:
   /**
@@ -39,7 +39,7 @@ public:
    * @brief Sets the passed Effect object with the HemisphericLight normalized
    * direction and color and the passed name (string).
    */
-  void transferToEffect(Effect* effect, const std::string& lightIndex) override;
+  void transferToEffect(Effect* effect, unsigned int lightIndex) override;
 
   /**
    * @brief Returns the light world matrix.
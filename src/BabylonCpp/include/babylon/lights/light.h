@@ -12,6 +12,18 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT Light : public Node {
 
 public:
+  /**
+   * Handles of the light uniforms (see Effect::GetUniformHandle).
+   */
+  struct UniformHandles {
+    unsigned int vLightData;
+    unsigned int vLightDiffuse;
+    unsigned int vLightSpecular;
+    unsigned int vLightDirection;
+    unsigned int vLightGround;
+    unsigned int shadowsInfo;
+  }; // end of struct UniformHandles
+
   // LightmapMode Consts
   /**
    * If every light affecting the material is in this lightmapMode,
@@ -158,7 +170,19 @@ public:
    */
   virtual Vector3 getAbsolutePosition();
 
-  virtual void transferToEffect(Effect* effect, const std::string& lightIndex);
+  /**
+   * @brief Returns the handles of the uniforms of the light uniform block.
+   */
+  static const UniformHandles& BlockUniformHandles();
+
+  /**
+   * @brief Returns the handles of the effect uniforms of the light bound at
+   * the given index (e.g. "vLightData0"), used without uniform buffer object.
+   * They are only resolved again when the light index changes.
+   */
+  const UniformHandles& effectUniformHandles(unsigned int lightIndex);
+
+  virtual void transferToEffect(Effect* effect, unsigned int lightIndex);
   virtual void transferToEffect(Effect* effect, const std::string& uniformName0,
                                 const std::string& uniformName1);
   virtual Matrix* _getWorldMatrix();
@@ -297,6 +321,9 @@ private:
   unsigned int _lightmapMode;
   std::unique_ptr<Matrix> _parentedWorldMatrix;
   std::unique_ptr<Matrix> _worldMatrix;
+  // Effect uniform handles of the last light index
+  UniformHandles _effectUniformHandles;
+  int _effectUniformHandlesIndex;
 
 }; // end of class Light
 
@@ -0,0 +1,110 @@
+#ifndef BABYLON_LIGHTS_LIGHT_GRID_H
+#define BABYLON_LIGHTS_LIGHT_GRID_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/culling/spatial_hash_grid.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Scene level light assignment: the lights and the meshes of the scene
+ * are indexed by bounding sphere in spatial hash grids, and each mesh only
+ * receives the lights whose range overlaps its bounding sphere, ordered by
+ * priority and relevance.
+ *
+ * The light sources of a mesh are only recomputed when the mesh moved, when
+ * a light overlapping it (before or after the change) moved, changed its
+ * range, intensity or enabled state, or when a mesh or light was explicitly
+ * flagged dirty (include / exclude lists, layer masks).
+ *
+ * Directional and hemispheric lights, as well as point and spot lights with
+ * an unlimited range, affect every mesh.
+ */
+class BABYLON_SHARED_EXPORT LightGrid {
+
+public:
+  LightGrid(Scene* scene, float cellSize = 10.f);
+  ~LightGrid();
+
+  void addLight(Light* light);
+  void removeLight(Light* light);
+  void addMesh(AbstractMesh* mesh);
+  void removeMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Flags the light for reassignment on the next update, for changes
+   * which are not detected automatically (include / exclude lists).
+   */
+  void markLightAsDirty(Light* light);
+
+  /**
+   * @brief Flags the light sources of the mesh for recomputation on the next
+   * update.
+   */
+  void markMeshAsDirty(AbstractMesh* mesh);
+
+  /**
+   * @brief Detects the moved lights and meshes and recomputes the light
+   * sources of the affected meshes.
+   * @returns The number of meshes whose light sources were recomputed.
+   */
+  size_t update();
+
+  /**
+   * @brief Returns the relevance of a light for a mesh: the light intensity
+   * attenuated by the distance between the light and the closest point of the
+   * mesh bounding sphere, 0 when the sphere is out of range.
+   */
+  static float Score(float intensity, const Vector3& lightPosition,
+                     float range, bool isDirectional,
+                     const Vector3& meshCenter, float meshRadius);
+
+private:
+  struct LightState {
+    Light* light;
+    Vector3 position;
+    float range;
+    bool enabled;
+    bool dirty;
+  };
+
+  struct MeshState {
+    AbstractMesh* mesh;
+    Vector3 center;
+    float radius;
+    bool dirty;
+  };
+
+  bool _isDirectional(Light* light) const;
+  bool _readLight(LightState& state) const;
+  bool _readMesh(MeshState& state) const;
+  void _markMeshesInRange(const LightState& state);
+  void _assignLights(MeshState& state);
+
+public:
+  /**
+   * Maximum number of light sources kept per mesh, 0 to keep all the lights
+   * in range.
+   */
+  size_t maxLightsPerMesh;
+
+private:
+  Scene* _scene;
+  SpatialHashGrid _lightIndex;
+  SpatialHashGrid _meshIndex;
+  std::vector<LightState> _lights;
+  std::vector<MeshState> _meshes;
+  std::unordered_map<Light*, size_t> _lightSlots;
+  std::unordered_map<AbstractMesh*, size_t> _meshSlots;
+  std::vector<size_t> _freeLightSlots;
+  std::vector<size_t> _freeMeshSlots;
+  // Scratch buffers
+  std::vector<size_t> _candidates;
+  std::vector<std::pair<float, Light*>> _scoredLights;
+  std::vector<Light*> _lightSources;
+
+}; // end of class LightGrid
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LIGHTS_LIGHT_GRID_H
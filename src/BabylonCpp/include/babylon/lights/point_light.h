@@ -75,7 +75,7 @@ public:
    * position (or position, if none) and passed name (string).
    * Returns the PointLight.
    */
-  void transferToEffect(Effect* effect, const std::string& lightIndex) override;
+  void transferToEffect(Effect* effect, unsigned int lightIndex) override;
 
 protected:
   /**
@@ -0,0 +1,84 @@
+#ifndef BABYLON_LIGHTS_SHADOWS_SHADOW_CASCADES_H
+#define BABYLON_LIGHTS_SHADOWS_SHADOW_CASCADES_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/plane.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Cascade of a cascaded shadow map: a slice of the view frustum of the
+ * camera and the orthographic light projection covering it.
+ */
+struct BABYLON_SHARED_EXPORT ShadowCascade {
+  // Camera depth range of the slice
+  float nearZ;
+  float farZ;
+  // Bounding sphere of the slice
+  Vector3 center;
+  float radius;
+  // Light projection
+  Matrix projectionMatrix;
+  Matrix transformMatrix;
+  std::array<Plane, 6> frustumPlanes;
+}; // end of struct ShadowCascade
+
+/**
+ * @brief Cascaded shadow map math for directional lights.
+ *
+ * The view frustum of the camera is split with the practical split scheme (a
+ * blend of the logarithmic and uniform schemes), and each slice is covered by
+ * an orthographic light projection fitted to its bounding sphere. The sphere
+ * does not depend on the camera orientation, and its center is snapped to the
+ * shadow map texels in light space, so that the shadow edges do not shimmer
+ * when the camera moves or rotates.
+ */
+struct BABYLON_SHARED_EXPORT ShadowCascades {
+
+  static constexpr unsigned int MaxCascades = 4;
+
+  /**
+   * @brief Returns the cascadeCount + 1 camera depths delimiting the slices.
+   * @param lambda Blend between the uniform (0) and logarithmic (1) splits.
+   */
+  static std::vector<float> ComputeSplits(unsigned int cascadeCount,
+                                          float nearZ, float farZ,
+                                          float lambda);
+
+  /**
+   * @brief Computes the smallest sphere enclosing the slice of the view
+   * frustum between the nearZ and farZ camera depths.
+   * @param fov Vertical field of view.
+   */
+  static void ComputeSliceSphere(const Matrix& inverseViewMatrix, float fov,
+                                 float aspectRatio, float nearZ, float farZ,
+                                 Vector3& center, float& radius);
+
+  /**
+   * @brief Returns the view matrix of the light, located at the origin.
+   */
+  static Matrix LightViewMatrix(const Vector3& lightDirection);
+
+  /**
+   * @brief Computes the texel snapped projection of the cascade from its
+   * bounding sphere.
+   * @param tileSize Size in texels of the cascade in the shadow map.
+   * @param casterMinZ Light space depth of the closest caster to the light,
+   * so that the casters out of the slice still cast shadows in it.
+   */
+  static void ComputeTransform(Matrix& lightViewMatrix, int tileSize,
+                               float casterMinZ, ShadowCascade& cascade);
+
+  /**
+   * @brief Returns the layout of the cascades in the shadow map atlas.
+   */
+  static void AtlasGrid(unsigned int cascadeCount, unsigned int& columns,
+                        unsigned int& rows);
+
+}; // end of struct ShadowCascades
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LIGHTS_SHADOWS_SHADOW_CASCADES_H
@@ -4,6 +4,7 @@
 #include <babylon/babylon_global.h>
 #include <babylon/core/nullable.h>
 #include <babylon/lights/shadows/ishadow_generator.h>
+#include <babylon/lights/shadows/shadow_cascades.h>
 #include <babylon/math/isize.h>
 #include <babylon/math/matrix.h>
 #include <babylon/math/vector3.h>
@@ -49,9 +50,40 @@ public:
   bool useBlurExponentialShadowMap() const;
   void setUseBlurExponentialShadowMap(bool value);
 
+  /**
+   * @brief Returns the number of cascades of the shadow map of a directional
+   * light (1 for a single shadow map fitted to the casters).
+   */
+  unsigned int cascadeCount() const;
+
+  /**
+   * @brief Splits the shadow map of a directional light in up to 4 cascades
+   * fitted to slices of the view frustum of the active camera. The cascades
+   * are tiles of a shadow map atlas of 2 x 1 or 2 x 2 times the map size.
+   */
+  void setCascadeCount(unsigned int count);
+
+  /**
+   * @brief Returns the cascades of the last render of the shadow map.
+   */
+  const std::vector<ShadowCascade>& cascades() const;
+
+  /**
+   * @brief Returns the number of caster draws of the last render of the
+   * shadow map, over all cascades.
+   */
+  size_t cascadeDrawCount() const;
+
   /** Custom render function **/
   void renderSubMesh(SubMesh* subMesh);
 
+  /**
+   * @brief Redraws the shadows of the static casters on the next render, for
+   * the changes which are not detected (materials, geometries,
+   * forceBackFacesOnly).
+   */
+  void invalidateStaticCasterCache();
+
   /** Methods **/
 
   /**
@@ -138,10 +170,33 @@ private:
   void _applyFilterValues();
   Vector2 _packHalf(float depth);
   void _disposeRTTandPostProcesses();
+  void _clearShadowMap(Engine* engine);
+  bool _canCacheStaticCasters() const;
+  void _renderWithStaticCasterCache(const std::vector<SubMesh*>& subMeshes);
+  void _releaseStaticCasterCache();
+  bool _isCascaded() const;
+  ISize _getShadowMapSize() const;
+  void _updateCascades();
 
 public:
   float blurScale;
   bool forceBackFacesOnly;
+  /**
+   * Caches the shadows of the static casters (frozen world matrix, no
+   * skeleton or morph targets): they are only redrawn when the light, the
+   * shadow parameters or the set of static casters change, the dynamic
+   * casters being drawn every render over a copy of the cache. Not available
+   * for the cube shadow maps and on WebGL 1.
+   */
+  bool cacheStaticCasters;
+  /**
+   * Blend between the uniform (0) and logarithmic (1) cascade splits.
+   */
+  float cascadeLambda;
+  /**
+   * Camera depth covered by the cascades, 0 for the far plane of the camera.
+   */
+  float cascadeMaxZ;
 
 private:
   unsigned int _filter;
@@ -173,6 +228,22 @@ private:
   bool _useFullFloat;
   unsigned int _textureType;
   bool _isCube;
+  // Static casters cache
+  GL::IGLTexture* _staticCasterCache;
+  bool _staticCasterCacheValid;
+  bool _staticCasterCacheRestored;
+  bool _subMeshesReady;
+  Matrix _staticCasterCacheTransform;
+  std::vector<SubMesh*> _staticCasterSubMeshes;
+  std::vector<SubMesh*> _staticSubMeshes;
+  std::vector<SubMesh*> _dynamicSubMeshes;
+  // Cascaded shadow map
+  unsigned int _cascadeCount;
+  std::vector<ShadowCascade> _cascades;
+  Float32Array _cascadeMatrices;
+  // Cascades (bit mask) in which each caster is visible
+  std::unordered_map<AbstractMesh*, unsigned int> _casterCascades;
+  size_t _cascadeDrawCount;
 
 }; // end of class ShadowGenerator
 
@@ -49,7 +49,7 @@ public:
    * @brief Sets the passed Effect object with the SpotLight transfomed position
    * (or position if not parented) and normalized direction.
    */
-  void transferToEffect(Effect* effect, const std::string& lightIndex) override;
+  void transferToEffect(Effect* effect, unsigned int lightIndex) override;
 
 protected:
   /**
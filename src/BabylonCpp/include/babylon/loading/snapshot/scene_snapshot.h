@@ -0,0 +1,51 @@
+#ifndef BABYLON_LOADING_SNAPSHOT_SCENE_SNAPSHOT_H
+#define BABYLON_LOADING_SNAPSHOT_SCENE_SNAPSHOT_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/loading/snapshot/snapshot_file.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Saves and restores the content of a scene as a binary snapshot file,
+ * to skip the parsing of the .babylon file at startup.
+ *
+ * The description of the scene (settings, lights, animations, standard and
+ * multi materials, skeletons, meshes and cameras) is stored in one blob of
+ * records. The vertex and index buffers of the geometries each have their own
+ * aligned blob, copied once from the mapping of the file into the geometry.
+ * As with the .babylon loader, textures, morph targets, particle systems and
+ * actions are not restored.
+ */
+class BABYLON_SHARED_EXPORT SceneSnapshot {
+
+public:
+  static constexpr uint32_t SceneTag = SnapshotFile::Tag('S', 'C', 'N', 'E');
+  static constexpr uint32_t VerticesTag
+    = SnapshotFile::Tag('V', 'R', 'T', 'X');
+  static constexpr uint32_t IndicesTag = SnapshotFile::Tag('I', 'N', 'D', 'X');
+
+  /**
+   * @brief Writes the content of the scene into the file, returns false on
+   * failure.
+   */
+  static bool Save(Scene* scene, const std::string& filename);
+
+  /**
+   * @brief Adds the content of the snapshot file to the scene, returns false
+   * if the file can not be opened or is corrupted. The objects read before a
+   * corrupted record are kept in the scene.
+   */
+  static bool Load(Scene* scene, const std::string& filename);
+
+private:
+  static void _writeAnimations(SnapshotRecordWriter& writer,
+                               const std::vector<Animation*>& animations);
+  static bool _readAnimations(SnapshotRecordReader& reader,
+                              std::vector<Animation*>& animations);
+
+}; // end of class SceneSnapshot
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_SNAPSHOT_SCENE_SNAPSHOT_H
@@ -0,0 +1,148 @@
+#ifndef BABYLON_LOADING_SNAPSHOT_SNAPSHOT_FILE_H
+#define BABYLON_LOADING_SNAPSHOT_SNAPSHOT_FILE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Versioned binary snapshot file: a header, 16 bytes aligned blobs and
+ * a table of contents at the end of the file.
+ *
+ * Layout (native byte order, checked on load):
+ * - header (32 bytes): magic "BABYSNAP", version, byte order mark, blob
+ *   count, reserved, offset of the table of contents;
+ * - blobs, each one starting on a 16 bytes boundary;
+ * - table of contents (24 bytes per blob): tag, reserved, offset, size.
+ */
+struct BABYLON_SHARED_EXPORT SnapshotFile {
+
+  static constexpr uint32_t Version       = 1;
+  static constexpr uint32_t ByteOrderMark = 0x01020304;
+  static constexpr size_t Alignment       = 16;
+  static constexpr size_t HeaderSize      = 32;
+  static constexpr size_t TocEntrySize    = 24;
+
+  /**
+   * @brief Returns the tag of a blob from 4 characters.
+   */
+  static constexpr uint32_t Tag(char a, char b, char c, char d)
+  {
+    return static_cast<uint32_t>(static_cast<uint8_t>(a))
+           | (static_cast<uint32_t>(static_cast<uint8_t>(b)) << 8)
+           | (static_cast<uint32_t>(static_cast<uint8_t>(c)) << 16)
+           | (static_cast<uint32_t>(static_cast<uint8_t>(d)) << 24);
+  }
+
+}; // end of struct SnapshotFile
+
+/**
+ * @brief Builds a snapshot file in memory.
+ */
+class BABYLON_SHARED_EXPORT SnapshotFileWriter {
+
+public:
+  SnapshotFileWriter();
+  ~SnapshotFileWriter();
+
+  /**
+   * @brief Adds a blob, returns its index.
+   */
+  size_t addBlob(uint32_t tag, const void* data, size_t byteLength);
+
+  template <typename T>
+  size_t addArray(uint32_t tag, const std::vector<T>& array)
+  {
+    return addBlob(tag, array.data(), array.size() * sizeof(T));
+  }
+
+  size_t blobCount() const;
+
+  /**
+   * @brief Returns the content of the file.
+   */
+  std::vector<uint8_t> serialize() const;
+
+  /**
+   * @brief Writes the file, returns false on failure.
+   */
+  bool save(const std::string& filename) const;
+
+private:
+  struct Blob {
+    uint32_t tag;
+    std::vector<uint8_t> data;
+  }; // end of struct Blob
+
+  std::vector<Blob> _blobs;
+
+}; // end of class SnapshotFileWriter
+
+/**
+ * @brief Read-only access to the blobs of a memory-mapped snapshot file. The
+ * header and the table of contents are validated once on opening, the blobs
+ * then point straight into the mapping.
+ */
+class BABYLON_SHARED_EXPORT SnapshotFileReader {
+
+public:
+  /**
+   * @brief Maps the file, returns nullptr if it can not be opened or is not a
+   * valid snapshot of the current version.
+   */
+  static std::unique_ptr<SnapshotFileReader> Open(const std::string& filename);
+
+  ~SnapshotFileReader();
+
+  SnapshotFileReader(const SnapshotFileReader&) = delete;
+  SnapshotFileReader& operator=(const SnapshotFileReader&) = delete;
+
+  size_t blobCount() const;
+  uint32_t blobTag(size_t index) const;
+  const uint8_t* blobData(size_t index) const;
+  size_t blobSize(size_t index) const;
+
+  /**
+   * @brief Returns the index of the first blob with the tag, blobCount() if
+   * there is none.
+   */
+  size_t findBlob(uint32_t tag) const;
+
+  /**
+   * @brief Copies the blob into the array, returns false when the index is
+   * out of range or the blob size is not a multiple of the element size.
+   */
+  template <typename T>
+  bool readArray(size_t index, std::vector<T>& array) const
+  {
+    if (index >= _entries.size() || _entries[index].size % sizeof(T) != 0) {
+      return false;
+    }
+    const auto data = reinterpret_cast<const T*>(blobData(index));
+    array.assign(data, data + _entries[index].size / sizeof(T));
+    return true;
+  }
+
+  /**
+   * @brief Returns whether the file is memory-mapped or was read into memory.
+   */
+  bool isMapped() const;
+
+private:
+  SnapshotFileReader();
+
+private:
+  struct Entry {
+    uint32_t tag;
+    size_t offset;
+    size_t size;
+  }; // end of struct Entry
+
+  std::unique_ptr<MemoryMappedFile> _file;
+  std::vector<Entry> _entries;
+
+}; // end of class SnapshotFileReader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_SNAPSHOT_SNAPSHOT_FILE_H
@@ -0,0 +1,139 @@
+#ifndef BABYLON_LOADING_SNAPSHOT_SNAPSHOT_RECORD_H
+#define BABYLON_LOADING_SNAPSHOT_SNAPSHOT_RECORD_H
+
+#include <cstring>
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Sequential writer of the records of a snapshot blob: trivially
+ * copyable values, strings and arrays prefixed with their element count.
+ */
+class BABYLON_SHARED_EXPORT SnapshotRecordWriter {
+
+public:
+  template <typename T>
+  void write(const T& value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Records only hold trivially copyable values");
+    const auto bytes = reinterpret_cast<const uint8_t*>(&value);
+    _data.insert(_data.end(), bytes, bytes + sizeof(T));
+  }
+
+  template <typename T>
+  void writeArray(const T* values, size_t count)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Records only hold trivially copyable values");
+    write<uint32_t>(static_cast<uint32_t>(count));
+    const auto bytes = reinterpret_cast<const uint8_t*>(values);
+    _data.insert(_data.end(), bytes, bytes + count * sizeof(T));
+  }
+
+  template <typename T>
+  void writeArray(const std::vector<T>& values)
+  {
+    writeArray(values.data(), values.size());
+  }
+
+  void writeString(const std::string& value)
+  {
+    writeArray(value.data(), value.size());
+  }
+
+  const std::vector<uint8_t>& data() const
+  {
+    return _data;
+  }
+
+private:
+  std::vector<uint8_t> _data;
+
+}; // end of class SnapshotRecordWriter
+
+/**
+ * @brief Bounds checked reader of the records of a snapshot blob. A read past
+ * the end of the blob fails the reader, and returns zero values from then on.
+ */
+class BABYLON_SHARED_EXPORT SnapshotRecordReader {
+
+public:
+  SnapshotRecordReader(const uint8_t* data, size_t size)
+      : _data{data}, _size{size}, _offset{0}, _failed{false}
+  {
+  }
+
+  template <typename T>
+  T read()
+  {
+    T value{};
+    if (_reserve(sizeof(T))) {
+      std::memcpy(&value, _data + _offset, sizeof(T));
+      _offset += sizeof(T);
+    }
+    return value;
+  }
+
+  template <typename T>
+  void read(T& value)
+  {
+    value = read<T>();
+  }
+
+  template <typename T>
+  std::vector<T> readArray()
+  {
+    std::vector<T> values;
+    const size_t count = read<uint32_t>();
+    if (count > 0 && count <= (_size - _offset) / sizeof(T)) {
+      const auto first = reinterpret_cast<const T*>(_data + _offset);
+      values.resize(count);
+      std::memcpy(values.data(), first, count * sizeof(T));
+      _offset += count * sizeof(T);
+    }
+    else if (count > 0) {
+      _failed = true;
+    }
+    return values;
+  }
+
+  std::string readString()
+  {
+    const auto chars = readArray<char>();
+    return std::string(chars.begin(), chars.end());
+  }
+
+  bool failed() const
+  {
+    return _failed;
+  }
+
+  bool atEnd() const
+  {
+    return _offset == _size;
+  }
+
+private:
+  bool _reserve(size_t byteLength)
+  {
+    if (_failed || byteLength > _size - _offset) {
+      _failed = true;
+      return false;
+    }
+    return true;
+  }
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+  size_t _offset;
+  bool _failed;
+
+}; // end of class SnapshotRecordReader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_SNAPSHOT_SNAPSHOT_RECORD_H
@@ -0,0 +1,177 @@
+#ifndef BABYLON_MATERIALS_DEFINES_BITSET_H
+#define BABYLON_MATERIALS_DEFINES_BITSET_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed-width set of boolean defines, with the vector<bool> interface
+ * used by the material defines and a 64-bit hash updated on each change.
+ */
+class BABYLON_SHARED_EXPORT DefinesBitset {
+
+public:
+  static constexpr size_t MaxSize   = 256;
+  static constexpr size_t WordCount = MaxSize / 64;
+
+  /**
+   * @brief Proxy to a bit, which keeps the hash of the set up to date.
+   */
+  class reference {
+
+  public:
+    reference(DefinesBitset& bitset, size_t index)
+        : _bitset{bitset}, _index{index}
+    {
+    }
+
+    operator bool() const
+    {
+      return _bitset.test(_index);
+    }
+
+    reference& operator=(bool value)
+    {
+      _bitset.set(_index, value);
+      return *this;
+    }
+
+    reference& operator=(const reference& other)
+    {
+      return operator=(static_cast<bool>(other));
+    }
+
+  private:
+    DefinesBitset& _bitset;
+    size_t _index;
+
+  }; // end of class reference
+
+public:
+  DefinesBitset() : _words{}, _size{0}, _hash{0}
+  {
+  }
+
+  bool operator[](size_t index) const
+  {
+    return test(index);
+  }
+
+  reference operator[](size_t index)
+  {
+    return reference(*this, index);
+  }
+
+  bool operator==(const DefinesBitset& other) const
+  {
+    return _size == other._size && _hash == other._hash
+           && _words == other._words;
+  }
+
+  bool operator!=(const DefinesBitset& other) const
+  {
+    return !operator==(other);
+  }
+
+  bool test(size_t index) const
+  {
+    return index < _size && (_words[index >> 6] >> (index & 63)) & 1;
+  }
+
+  void set(size_t index, bool value)
+  {
+    if (index >= _size || test(index) == value) {
+      return;
+    }
+    _words[index >> 6] ^= uint64_t(1) << (index & 63);
+    _hash ^= Mix(index + 1);
+  }
+
+  size_t size() const
+  {
+    return _size;
+  }
+
+  bool empty() const
+  {
+    return _size == 0;
+  }
+
+  /**
+   * @brief Resizes the set, up to MaxSize bits, the new bits are false.
+   */
+  void resize(size_t size)
+  {
+    size = (size < MaxSize) ? size : MaxSize;
+    for (size_t index = size; index < _size; ++index) {
+      set(index, false);
+    }
+    _size = size;
+  }
+
+  void emplace_back(bool value)
+  {
+    if (_size < MaxSize) {
+      ++_size;
+      set(_size - 1, value);
+    }
+  }
+
+  void clear()
+  {
+    _words = {};
+    _size  = 0;
+    _hash  = 0;
+  }
+
+  /**
+   * @brief Clears all the bits, keeping the size.
+   */
+  void reset()
+  {
+    _words = {};
+    _hash  = 0;
+  }
+
+  /**
+   * @brief Returns the hash of the set bits and of the size.
+   */
+  uint64_t hash() const
+  {
+    return _hash ^ Mix(~static_cast<uint64_t>(_size));
+  }
+
+  /**
+   * @brief Scrambles a 64-bit value (splitmix64 finalizer).
+   */
+  static uint64_t Mix(uint64_t value)
+  {
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ull;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebull;
+    value ^= value >> 31;
+    return value;
+  }
+
+  /**
+   * @brief Combines a value into a hash, the order of the values matters.
+   */
+  static uint64_t Combine(uint64_t hash, uint64_t value)
+  {
+    return Mix(hash ^ (value + 0x9e3779b97f4a7c15ull + (hash << 6)
+                       + (hash >> 2)));
+  }
+
+private:
+  std::array<uint64_t, WordCount> _words;
+  size_t _size;
+  // Xor of the scrambled indices of the set bits
+  uint64_t _hash;
+
+}; // end of class DefinesBitset
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_DEFINES_BITSET_H
@@ -16,6 +16,28 @@ public:
     std::vector<ChildShaderNode> children;
     std::size_t parent;
   }; // end of struct ShaderNode
+  struct UniformState {
+    std::array<float, 4> values{{0.f, 0.f, 0.f, 0.f}};
+    int updateFlag = 0;
+    bool isCached  = false;
+  }; // end of struct UniformState
+
+public:
+  /**
+   * @brief Returns the handle of the uniform with the given name.
+   *
+   * Handles are dense integers shared by all the effects, they can be resolved
+   * once (e.g. in a function level static variable) and used instead of the
+   * uniform name to avoid hashing strings when binding the uniforms. The name
+   * is registered on first use, this function can be called from any thread.
+   */
+  static unsigned int GetUniformHandle(const std::string& uniformName);
+
+  /**
+   * @brief Releases the uniform buffers bound to the uniform block binding
+   * points through the given engine and clears the binding cache.
+   */
+  static void ResetCache(Engine* engine);
 
 public:
   Effect(const std::string& baseName, EffectCreationOptions& options,
@@ -32,8 +54,19 @@ public:
   int getAttributeLocation(unsigned int index);
   int getAttributeLocationByName(const std::string& name);
   size_t getAttributesCount();
+  /**
+   * @brief Returns the vertex buffer kind of each attribute (0 when the
+   * attribute is not a vertex buffer kind).
+   */
+  const std::vector<unsigned int>& getAttributeKinds() const;
   int getUniformIndex(const std::string& uniformName);
   GL::IGLUniformLocation* getUniform(const std::string& uniformName);
+  GL::IGLUniformLocation* getUniform(unsigned int uniformHandle);
+  /**
+   * @brief Returns the slot of the uniform in this effect or -1 if the effect
+   * does not use the uniform.
+   */
+  int getUniformSlot(unsigned int uniformHandle) const;
   std::vector<std::string>& getSamplers();
   std::string getCompilationError();
   std::string getVertexShaderSource();
@@ -52,47 +85,75 @@ public:
                        const std::vector<BaseTexture*>& textures);
   void setTextureFromPostProcess(const std::string& channel,
                                  PostProcess* postProcess);
-  bool _cacheMatrix(const std::string& uniformName, const Matrix& matrix);
-  bool _cacheFloat2(const std::string& uniformName, float x, float y);
-  bool _cacheFloat3(const std::string& uniformName, float x, float y, float z);
-  bool _cacheFloat4(const std::string& uniformName, float x, float y, float z,
-                    float w);
+  bool _cacheMatrix(int slot, const Matrix& matrix);
+  bool _cacheFloat(int slot, float x);
+  bool _cacheFloat2(int slot, float x, float y);
+  bool _cacheFloat3(int slot, float x, float y, float z);
+  bool _cacheFloat4(int slot, float x, float y, float z, float w);
   void bindUniformBuffer(GL::IGLBuffer* _buffer, const std::string& name);
   void bindUniformBlock(const std::string& blockName, unsigned index);
   Effect& setIntArray(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray(unsigned int uniformHandle, const Int32Array& array);
   Effect& setIntArray2(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray2(unsigned int uniformHandle, const Int32Array& array);
   Effect& setIntArray3(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray3(unsigned int uniformHandle, const Int32Array& array);
   Effect& setIntArray4(const std::string& uniformName, const Int32Array& array);
+  Effect& setIntArray4(unsigned int uniformHandle, const Int32Array& array);
   Effect& setFloatArray(const std::string& uniformName,
                         const Float32Array& array);
+  Effect& setFloatArray(unsigned int uniformHandle, const Float32Array& array);
   Effect& setFloatArray2(const std::string& uniformName,
                          const Float32Array& array);
+  Effect& setFloatArray2(unsigned int uniformHandle, const Float32Array& array);
   Effect& setFloatArray3(const std::string& uniformName,
                          const Float32Array& array);
+  Effect& setFloatArray3(unsigned int uniformHandle, const Float32Array& array);
   Effect& setFloatArray4(const std::string& uniformName,
                          const Float32Array& array);
+  Effect& setFloatArray4(unsigned int uniformHandle, const Float32Array& array);
   Effect& setArray(const std::string& uniformName, std::vector<float> array);
+  Effect& setArray(unsigned int uniformHandle, std::vector<float> array);
   Effect& setArray2(const std::string& uniformName, std::vector<float> array);
+  Effect& setArray2(unsigned int uniformHandle, std::vector<float> array);
   Effect& setArray3(const std::string& uniformName, std::vector<float> array);
+  Effect& setArray3(unsigned int uniformHandle, std::vector<float> array);
   Effect& setArray4(const std::string& uniformName, std::vector<float> array);
+  Effect& setArray4(unsigned int uniformHandle, std::vector<float> array);
   Effect& setMatrices(const std::string& uniformName, Float32Array matrices);
+  Effect& setMatrices(unsigned int uniformHandle, Float32Array matrices);
   Effect& setMatrix(const std::string& uniformName, const Matrix& matrix);
+  Effect& setMatrix(unsigned int uniformHandle, const Matrix& matrix);
   Effect& setMatrix3x3(const std::string& uniformName,
                        const Float32Array& matrix);
+  Effect& setMatrix3x3(unsigned int uniformHandle, const Float32Array& matrix);
   Effect& setMatrix2x2(const std::string& uniformName,
                        const Float32Array& matrix);
+  Effect& setMatrix2x2(unsigned int uniformHandle, const Float32Array& matrix);
   Effect& setFloat(const std::string& uniformName, float value);
+  Effect& setFloat(unsigned int uniformHandle, float value);
   Effect& setBool(const std::string& uniformName, bool _bool);
+  Effect& setBool(unsigned int uniformHandle, bool _bool);
   Effect& setVector2(const std::string& uniformName, const Vector2& vector2);
+  Effect& setVector2(unsigned int uniformHandle, const Vector2& vector2);
   Effect& setFloat2(const std::string& uniformName, float x, float y);
+  Effect& setFloat2(unsigned int uniformHandle, float x, float y);
   Effect& setVector3(const std::string& uniformName, const Vector3& vector3);
+  Effect& setVector3(unsigned int uniformHandle, const Vector3& vector3);
   Effect& setFloat3(const std::string& uniformName, float x, float y, float z);
+  Effect& setFloat3(unsigned int uniformHandle, float x, float y, float z);
   Effect& setVector4(const std::string& uniformName, const Vector4& vector4);
+  Effect& setVector4(unsigned int uniformHandle, const Vector4& vector4);
   Effect& setFloat4(const std::string& uniformName, float x, float y, float z,
                     float w);
+  Effect& setFloat4(unsigned int uniformHandle, float x, float y, float z,
+                    float w);
   Effect& setColor3(const std::string& uniformName, const Color3& color3);
+  Effect& setColor3(unsigned int uniformHandle, const Color3& color3);
   Effect& setColor4(const std::string& uniformName, const Color3& color3,
                     float alpha);
+  Effect& setColor4(unsigned int uniformHandle, const Color3& color3,
+                    float alpha);
 
 private:
   void _dumpShadersSource(std::string vertexCode, std::string fragmentCode,
@@ -111,6 +172,10 @@ private:
   std::string _recombineShader(const std::vector<ShaderNode>& shaderNodes,
                                std::size_t rootNodeId = 0);
   std::string _evaluateDefinesOnString(const std::string& shaderString);
+  void _resolveUniformSlots();
+  void _resolveAttributeKinds();
+  void _bindUniformLocations();
+  int _getActiveUniformSlot(unsigned int uniformHandle) const;
 
 public:
   std::string name;
@@ -131,12 +196,17 @@ private:
   std::string _compilationError;
   std::vector<std::string> _attributesNames;
   Int32Array _attributes;
+  std::vector<unsigned int> _attributeKinds;
   std::unordered_map<std::string, std::unique_ptr<GL::IGLUniformLocation>>
     _uniforms;
   std::unordered_map<std::string, unsigned int> _indexParameters;
   std::unique_ptr<EffectFallbacks> _fallbacks;
   std::unique_ptr<GL::IGLProgram> _program;
-  std::unordered_map<std::string, Float32Array> _valueCache;
+  // Uniform handle to slot (index in _uniformsNames) table
+  std::vector<int> _uniformSlots;
+  // Per slot uniform locations and cached values
+  std::vector<GL::IGLUniformLocation*> _uniformLocations;
+  std::vector<UniformState> _uniformStates;
   static std::unordered_map<unsigned int, GL::IGLBuffer*> _baseCache;
 
 }; // end of class Effect
@@ -2,6 +2,7 @@
 #define BABYLON_MATERIALS_MATERIAL_DEFINES_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/materials/defines_bitset.h>
 #include <babylon/materials/imaterial_defines.h>
 
 namespace BABYLON {
@@ -33,29 +34,47 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   virtual void reset() override;
   virtual std::string toString() const override;
 
+  /**
+   * @brief Returns the 64-bit hash of the defines and of the values they
+   * depend on, which identifies the generated shader code.
+   */
+  uint64_t hash() const;
+
+  /**
+   * @brief Returns whether the defines generate the same shader code as the
+   * other ones, comparing the values written by toString() without building
+   * the strings.
+   */
+  bool isCodeEqual(const MaterialDefines& other) const;
+
   // Properties
-  std::vector<bool> defines;
+  DefinesBitset defines;
   std::vector<std::string> _keys;
 
   unsigned int NUM_BONE_INFLUENCERS;
   unsigned int BonesPerMesh;
   unsigned int NUM_MORPH_INFLUENCERS;
 
-  std::vector<bool> lights;
-  std::vector<bool> pointlights;
-  std::vector<bool> dirlights;
-  std::vector<bool> hemilights;
-  std::vector<bool> spotlights;
-  std::vector<bool> shadows;
-  std::vector<bool> shadowesms;
-  std::vector<bool> shadowpcfs;
-  std::vector<bool> shadowcubes;
+  DefinesBitset lights;
+  DefinesBitset pointlights;
+  DefinesBitset dirlights;
+  DefinesBitset hemilights;
+  DefinesBitset spotlights;
+  DefinesBitset shadows;
+  DefinesBitset shadowesms;
+  DefinesBitset shadowpcfs;
+  DefinesBitset shadowcubes;
+  // Cascaded shadow maps of the directional lights
+  DefinesBitset shadowcsms;
 
   bool TANGENT;
+  // Octahedral-encoded normals and tangents (see VertexCompression)
+  bool NORMAL_OCTAHEDRAL;
+  bool TANGENT_OCTAHEDRAL;
   bool SHADOWS;
   bool LIGHTMAPEXCLUDED;
-  std::vector<bool> lightmapexcluded;
-  std::vector<bool> lightmapnospecular;
+  DefinesBitset lightmapexcluded;
+  DefinesBitset lightmapnospecular;
 
   bool USERIGHTHANDEDSYSTEM;
 
@@ -31,6 +31,14 @@ public:
                                  MaterialDefines& defines,
                                  unsigned int maxSimultaneousLights = 4);
   static void PrepareUniformsAndSamplersList(EffectCreationOptions& options);
+
+  /**
+   * @brief Returns the hash identifying the effect of the shader compiled
+   * with the defines, for Engine::getEffectByDefinesHash().
+   */
+  static uint64_t EffectDefinesHash(const std::string& shaderName,
+                                    const MaterialDefines& defines,
+                                    unsigned int maxSimultaneousLights);
   static void HandleFallbacksForShadows(MaterialDefines& defines,
                                         EffectFallbacks& fallbacks,
                                         unsigned int maxSimultaneousLights);
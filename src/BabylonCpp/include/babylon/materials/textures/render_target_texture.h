@@ -48,6 +48,13 @@ public:
   void scale(float ratio);
   Matrix* getReflectionTextureMatrix();
   void resize(const ISize& size);
+
+  /**
+   * @brief Returns the number of faces rendered by the next render: 1 for a
+   * 2D render target, up to facesPerRender for a cube.
+   */
+  unsigned int facesToRender() const;
+
   void render(bool useCameraPostProcess = false, bool dumpForDebug = false);
   void renderToTarget(unsigned int faceIndex,
                       const std::vector<AbstractMesh*>& currentRenderList,
@@ -101,6 +108,26 @@ public:
    */
   std::vector<AbstractMesh*> renderList;
 
+  /**
+   * Number of faces of a cube render target rendered by each render, the
+   * faces being updated in turn (6 renders the whole cube at once).
+   */
+  unsigned int facesPerRender;
+
+  /**
+   * Priority of the render target when the scene limits the number of render
+   * target faces rendered per frame, 0 renders it on every refresh
+   * regardless of the budget.
+   */
+  float renderPriority;
+
+  /**
+   * Mesh displaying the render target (mirror, reflective object), its screen
+   * coverage weights the priority of the render target. nullptr is a full
+   * screen contribution.
+   */
+  AbstractMesh* screenContributionMesh;
+
   bool renderParticles;
   bool renderSprites;
   unsigned int coordinatesMode;
@@ -153,6 +180,9 @@ private:
   Observer<Engine>::Ptr _onClearObserver;
   // Properties
   int _faceIndex;
+  // Time slicing of the cube faces
+  unsigned int _nextFaceIndex;
+  unsigned int _lastFaceIndex;
 
 }; // end of class RenderTargetTexture
 
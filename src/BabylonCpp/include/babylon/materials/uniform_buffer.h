@@ -16,6 +16,11 @@ public:
    * If WebGL 2 is not available, this class falls back on traditionnal
    * setUniformXXX calls.
    *
+   * Static buffers (material and light blocks) only upload the range of data
+   * modified since the last update. Dynamic buffers (scene block) are updated
+   * every frame and rotate through a ring of GPU buffers so that the upload
+   * never writes into a buffer that may still be used by a pending draw.
+   *
    * For more information, please refer to :
    * https://www.khronos.org/opengl/wiki/Uniform_Buffer_Object
    */
@@ -156,6 +161,19 @@ public:
   void updateUniform(const std::string& uniformName, const Float32Array& data,
                      size_t size);
 
+  /**
+   * @brief Returns the std140 offset (in floats) of the uniform in the buffer
+   * or -1 if the uniform is not part of the layout.
+   */
+  int getUniformOffset(const std::string& uniformName) const;
+
+  /**
+   * @brief Returns the std140 offset (in floats) of the uniform with the given
+   * handle (see Effect::GetUniformHandle) or -1 if the uniform is not part of
+   * the layout. The offsets are resolved when the uniforms are added.
+   */
+  int getUniformOffset(unsigned int uniformHandle) const;
+
   /**
    * @brief Sets a sampler uniform on the effect.
    * @param {string} name Name of the sampler.
@@ -193,55 +211,27 @@ private:
    * for specs.
    */
   void _fillAlignment(size_t size);
+  void _setUniformOffset(const std::string& name, size_t offset);
 
-  // Update methods
-  void _updateMatrix3x3ForUniform(const std::string& name,
-                                  const Float32Array& matrix);
-  void _updateMatrix3x3ForEffect(const std::string& name,
-                                 const Float32Array& matrix);
-  void _updateMatrix2x2ForEffect(const std::string& name,
-                                 const Float32Array& matrix);
-  void _updateMatrix2x2ForUniform(const std::string& name,
-                                  const Float32Array& matrix);
-  void _updateFloatForEffect(const std::string& name, float x);
-  void _updateFloatForUniform(const std::string& name, float x);
-  void _updateFloat2ForEffect(const std::string& name, float x, float y);
-  void _updateFloat2ForUniform(const std::string& name, float x, float y);
-  void _updateFloat3ForEffect(const std::string& name, float x, float y,
-                              float z, const std::string& suffix = "");
-  void _updateFloat3ForUniform(const std::string& name, float x, float y,
-                               float z, const std::string& suffix = "");
-  void _updateFloat4ForEffect(const std::string& name, float x, float y,
-                              float z, float w, const std::string& suffix = "");
-  void _updateFloat4ForUniform(const std::string& name, float x, float y,
-                               float z, float w,
-                               const std::string& suffix = "");
-  void _updateMatrixForEffect(const std::string& name, const Matrix& mat);
-  void _updateMatrixForUniform(const std::string& name, const Matrix& mat);
-  void _updateVector3ForEffect(const std::string& name, const Vector3& vector);
-  void _updateVector3ForUniform(const std::string& name, const Vector3& vector);
-  void _updateVector4ForEffect(const std::string& name, const Vector4& vector);
-  void _updateVector4ForUniform(const std::string& name, const Vector4& vector);
-  void _updateColor3ForEffect(const std::string& name, const Color3& color,
-                              const std::string& suffix = "");
-  void _updateColor3ForUniform(const std::string& name, const Color3& color,
-                               const std::string& suffix = "");
-  void _updateColor4ForEffect(const std::string& name, const Color3& color,
-                              float alpha, const std::string& suffix = "");
-  void _updateColor4ForUniform(const std::string& name, const Color3& color,
-                               float alpha, const std::string& suffix = "");
+  /**
+   * @brief Writes the data at the given offset and extends the dirty range if
+   * the data changed.
+   */
+  void _updateUniformAt(size_t location, const float* data, size_t size);
+  void _updateUniform(const std::string& uniformName, const float* data,
+                      size_t size);
+  void _updateUniform(unsigned int uniformHandle, const float* data,
+                      size_t size);
+  void _markAsDirty(size_t start, size_t end);
 
 public:
   /**
    * @brief Wrapper for updateUniform.
-   * @method updateMatrix3x3
    * @param {string} name Name of the uniform, as used in the uniform block in
-   * the
-   * shader.
+   * the shader.
    * @param {Float32Array} matrix
    */
-  std::function<void(const std::string& name, const Float32Array& matrix)>
-    updateMatrix3x3;
+  void updateMatrix3x3(const std::string& name, const Float32Array& matrix);
 
   /**
    * @brief Wrapper for updateUniform.
@@ -249,8 +239,7 @@ public:
    * the shader.
    * @param {Float32Array} matrix
    */
-  std::function<void(const std::string& name, const Float32Array& matrix)>
-    updateMatrix2x2;
+  void updateMatrix2x2(const std::string& name, const Float32Array& matrix);
 
   /**
    * @brief Wrapper for updateUniform.
@@ -258,17 +247,16 @@ public:
    * the shader.
    * @param {number} x
    */
-  std::function<void(const std::string& name, float x)> updateFloat;
+  void updateFloat(const std::string& name, float x);
 
   /**
    * @brief Wrapper for updateUniform.
-   * @param {string} name Name of the uniform, as used in the uniform block
-   * in
+   * @param {string} name Name of the uniform, as used in the uniform block in
    * the shader.
    * @param {number} x
    * @param {number} y
    */
-  std::function<void(const std::string& name, float x, float y)> updateFloat2;
+  void updateFloat2(const std::string& name, float x, float y);
 
   /**
    * @brief Wrapper for updateUniform.
@@ -277,11 +265,11 @@ public:
    * @param {number} x
    * @param {number} y
    * @param {number} z
-   * @param {string} [suffix] Suffix to add to the uniform name.
+   * @param {string} [suffix] Suffix to add to the effect uniform name (only
+   * used without uniform buffer object).
    */
-  std::function<void(const std::string& name, float x, float y, float z,
-                     const std::string& suffix)>
-    updateFloat3;
+  void updateFloat3(const std::string& name, float x, float y, float z,
+                    const std::string& suffix = "");
 
   /**
    * @brief Wrapper for updateUniform.
@@ -291,11 +279,11 @@ public:
    * @param {number} y
    * @param {number} z
    * @param {number} w
-   * @param {string} [suffix] Suffix to add to the uniform name.
+   * @param {string} [suffix] Suffix to add to the effect uniform name (only
+   * used without uniform buffer object).
    */
-  std::function<void(const std::string& name, float x, float y, float z,
-                     float w, const std::string& suffix)>
-    updateFloat4;
+  void updateFloat4(const std::string& name, float x, float y, float z,
+                    float w, const std::string& suffix = "");
 
   /**
    * @brief Wrapper for updateUniform.
@@ -303,7 +291,7 @@ public:
    * the shader.
    * @param {Matrix} A 4x4 matrix.
    */
-  std::function<void(const std::string& name, const Matrix& mat)> updateMatrix;
+  void updateMatrix(const std::string& name, const Matrix& mat);
 
   /**
    * @brief Wrapper for updateUniform.
@@ -311,8 +299,7 @@ public:
    * the shader.
    * @param {Vector3} vector
    */
-  std::function<void(const std::string& name, const Vector3& vector)>
-    updateVector3;
+  void updateVector3(const std::string& name, const Vector3& vector);
 
   /**
    * @brief Wrapper for updateUniform.
@@ -320,19 +307,18 @@ public:
    * the shader.
    * @param {Vector4} vector
    */
-  std::function<void(const std::string& name, const Vector4& vector)>
-    updateVector4;
+  void updateVector4(const std::string& name, const Vector4& vector);
 
   /**
    * @brief Wrapper for updateUniform.
    * @param {string} name Name of the uniform, as used in the uniform block in
    * the shader.
    * @param {Color3} color
-   * @param {string} [suffix] Suffix to add to the uniform name.
+   * @param {string} [suffix] Suffix to add to the effect uniform name (only
+   * used without uniform buffer object).
    */
-  std::function<void(const std::string& name, const Color3& color,
-                     const std::string& suffix)>
-    updateColor3;
+  void updateColor3(const std::string& name, const Color3& color,
+                    const std::string& suffix = "");
 
   /**
    * @brief Wrapper for updateUniform.
@@ -340,31 +326,70 @@ public:
    * the shader.
    * @param {Color3} color
    * @param {number} alpha
-   * @param {string} [suffix] Suffix to add to the uniform name.
+   * @param {string} [suffix] Suffix to add to the effect uniform name (only
+   * used without uniform buffer object).
+   */
+  void updateColor4(const std::string& name, const Color3& color, float alpha,
+                    const std::string& suffix = "");
+
+  /**
+   * Setters of the uniforms by handle (see Effect::GetUniformHandle), without
+   * any string hashing. Without uniform buffer object, the value is set on the
+   * effect uniform with the effect uniform handle when given (e.g. the
+   * uniforms suffixed with the light index), or with the same handle.
+   */
+  void updateMatrix3x3(unsigned int uniformHandle, const Float32Array& matrix);
+  void updateMatrix2x2(unsigned int uniformHandle, const Float32Array& matrix);
+  void updateFloat(unsigned int uniformHandle, float x);
+  void updateFloat2(unsigned int uniformHandle, float x, float y);
+  void updateFloat3(unsigned int uniformHandle, float x, float y, float z);
+  void updateFloat3(unsigned int uniformHandle, float x, float y, float z,
+                    unsigned int effectUniformHandle);
+  void updateFloat4(unsigned int uniformHandle, float x, float y, float z,
+                    float w);
+  void updateFloat4(unsigned int uniformHandle, float x, float y, float z,
+                    float w, unsigned int effectUniformHandle);
+  void updateMatrix(unsigned int uniformHandle, const Matrix& mat);
+  void updateVector3(unsigned int uniformHandle, const Vector3& vector);
+  void updateVector4(unsigned int uniformHandle, const Vector4& vector);
+  void updateColor3(unsigned int uniformHandle, const Color3& color);
+  void updateColor3(unsigned int uniformHandle, const Color3& color,
+                    unsigned int effectUniformHandle);
+  void updateColor4(unsigned int uniformHandle, const Color3& color,
+                    float alpha);
+  void updateColor4(unsigned int uniformHandle, const Color3& color,
+                    float alpha, unsigned int effectUniformHandle);
+
+public:
+  /**
+   * Number of GPU buffers used by dynamic uniform buffers (frames in flight).
    */
-  std::function<void(const std::string& name, const Color3& color, float alpha,
-                     const std::string& suffix)>
-    updateColor4;
+  static size_t DynamicBufferCount;
 
 private:
   Engine* _engine;
-  std::unique_ptr<GL::IGLBuffer> _buffer;
+  // Current GPU buffer and ring of GPU buffers (single for static buffers)
+  GL::IGLBuffer* _buffer;
+  std::vector<std::unique_ptr<GL::IGLBuffer>> _buffers;
+  size_t _bufferIndex;
+  // Frame of the last dynamic upload, the ring advances once per frame
+  size_t _bufferFrameId;
   Float32Array _data;
   Float32Array _bufferData;
   bool _dynamic;
   std::string _uniformName;
   std::unordered_map<std::string, size_t> _uniformLocations;
   std::unordered_map<std::string, size_t> _uniformSizes;
+  // Uniform handle to offset (-1 if not part of the layout) table
+  std::vector<int> _uniformOffsets;
   size_t _uniformLocationPointer;
   bool _needSync;
-  Float32Array _cache;
+  // Range of _bufferData (in floats) modified since the last upload
+  size_t _dirtyStart;
+  size_t _dirtyEnd;
   bool _noUBO;
   Effect* _currentEffect;
 
-  // Pool for avoiding memory leaks
-  static constexpr unsigned int _MAX_UNIFORM_SIZE = 256;
-  static Float32Array _tempBuffer;
-
 }; // end of struct UniformBuffer
 
 } // end of namespace BABYLON
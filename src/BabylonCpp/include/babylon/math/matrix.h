@@ -629,11 +629,7 @@ public:
 #endif
 
 private:
-  static Quaternion _tempQuaternion;
-  static Vector3 _xAxis;
-  static Vector3 _yAxis;
-  static Vector3 _zAxis;
-  static int _updateFlagSeed;
+  static std::atomic<int> _updateFlagSeed;
 
 }; // end of class Matrix
 
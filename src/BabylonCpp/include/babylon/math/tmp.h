@@ -6,16 +6,17 @@
 namespace BABYLON {
 
 /**
- * @brief Temporary pre-allocated objects for engine internal use.
+ * @brief Temporary pre-allocated objects for engine internal use. Each thread
+ * has its own objects, so that scene objects can be updated concurrently.
  */
 struct BABYLON_SHARED_EXPORT Tmp {
 
-  static std::array<Color3, 3> Color3Array;
-  static std::array<Vector2, 3> Vector2Array;
-  static std::array<Vector3, 9> Vector3Array;
-  static std::array<Vector4, 3> Vector4Array;
-  static std::array<Quaternion, 2> QuaternionArray;
-  static std::array<Matrix, 6> MatrixArray;
+  static std::array<Color3, 3>& Color3Array();
+  static std::array<Vector2, 3>& Vector2Array();
+  static std::array<Vector3, 9>& Vector3Array();
+  static std::array<Vector4, 3>& Vector4Array();
+  static std::array<Quaternion, 2>& QuaternionArray();
+  static std::array<Matrix, 7>& MatrixArray();
 
 }; // end of class Tmp
 
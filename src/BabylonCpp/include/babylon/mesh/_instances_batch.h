@@ -12,8 +12,8 @@ class BABYLON_SHARED_EXPORT _InstancesBatch {
 
 public:
   bool mustReturn;
-  std::unordered_map<size_t, std::vector<InstancedMesh*>>
-    visibleInstances;
+  // Instanced meshes and automatically instanced meshes per submesh
+  std::unordered_map<size_t, std::vector<AbstractMesh*>> visibleInstances;
   std::unordered_map<size_t, bool> renderSelf;
 
 }; // end of class InstancesBatch
@@ -26,6 +26,7 @@ class BABYLON_SHARED_EXPORT AbstractMesh : public Node,
                                            public IPhysicsEnabledObject,
                                            public ICullable,
                                            public IGetSetVerticesData {
+  friend class TransformHierarchy;
 
 public:
   // The billboard Mode None, the object is normal by default
@@ -39,9 +40,6 @@ public:
   // The billboard Mode All
   static constexpr unsigned int BILLBOARDMODE_ALL = 7;
 
-  static Quaternion _rotationAxisCache;
-  static Vector3 _lookAtVectorCache;
-
   ~AbstractMesh();
 
   virtual IReflect::Type type() const override;
@@ -521,6 +519,12 @@ public:
   void _initCache() override;
   void markAsDirty(unsigned int flag) override;
 
+  /**
+   * @brief Flags the mesh local transform as dirty in the scene transform
+   * hierarchy (if the mesh is registered in it).
+   */
+  void _markAsTransformDirty();
+
   /**
    * @brief Updates the mesh BoundingInfo object and all its children
    * BoundingInfo objects also.
@@ -910,7 +914,7 @@ protected:
 
 private:
   void _markSubMeshesAsDirty(
-    const std::function<void(const MaterialDefines& defines)>& func);
+    const std::function<void(MaterialDefines& defines)>& func);
   void _onCollisionPositionChange(int collisionId, const Vector3& newPosition,
                                   AbstractMesh* collidedMesh = nullptr);
   // Facet data
@@ -958,6 +962,11 @@ public:
   bool useOctreeForPicking;
   bool useOctreeForCollisions;
   unsigned int layerMask;
+  /**
+   * Per instance values of the attributes registered on the source mesh with
+   * Mesh::registerInstancedBuffer (keyed by vertex buffer kind).
+   */
+  std::unordered_map<unsigned int, Float32Array> instancedBuffers;
   /**
    * True if the mesh must be rendered in any case.
    */
@@ -991,6 +1000,9 @@ public:
   bool _waitingFreezeWorldMatrix;
   // Skeleton
   Float32Array _bonesTransformMatrices;
+  // Transform hierarchy
+  int _transformHierarchyIndex;
+  bool _isTransformManaged;
 
 private:
   // FacetData private properties
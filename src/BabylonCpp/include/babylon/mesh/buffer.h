@@ -16,6 +16,13 @@ public:
          bool postponeInternalCreation = false, bool instanced = false);
   Buffer(Mesh* mesh, const Float32Array& data, bool updatable, int stride,
          bool postponeInternalCreation = false, bool instanced = false);
+  /**
+   * @brief Creates a static buffer of vertices compressed in the given format
+   * (see VertexCompression), the stride being the number of components of the
+   * decoded vertices.
+   */
+  Buffer(Engine* engine, const Uint16Array& packedData, unsigned int format,
+         int stride, const std::array<float, 4>& quantizationCube);
   virtual ~Buffer();
 
   std::unique_ptr<VertexBuffer> createVertexBuffer(unsigned int kind,
@@ -29,6 +36,11 @@ public:
   GL::IGLBuffer* getBuffer();
   int getStrideSize() const;
   bool getIsInstanced() const;
+  /**
+   * @brief Returns the VertexCompression format of the data.
+   */
+  unsigned int getFormat() const;
+  const std::array<float, 4>& getQuantizationCube() const;
 
   // Methods
   GL::IGLBuffer* create();
@@ -46,6 +58,10 @@ private:
   bool _updatable;
   int _strideSize;
   bool _instanced;
+  // Compressed data, decoded in _data on the first CPU access
+  Uint16Array _packedData;
+  unsigned int _format;
+  std::array<float, 4> _quantizationCube;
 
 }; // end of class Buffer
 
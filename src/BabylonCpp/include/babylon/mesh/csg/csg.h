@@ -3,43 +3,59 @@
 
 #include <babylon/babylon_global.h>
 
+#include <babylon/core/structs.h>
 #include <babylon/math/matrix.h>
+#include <babylon/math/quaternion.h>
 #include <babylon/math/vector3.h>
+#include <babylon/mesh/csg/polygon.h>
 
 namespace BABYLON {
 namespace CSG {
 
 /**
- * @brief
+ * @brief Constructive Solid Geometry.
+ *
+ * The vertices of the polygons of a solid are stored in a vertex arena owned
+ * by the solid. The operations are performed on BSP trees working in a
+ * temporary arena, the resulting polygons being compacted in the arena of the
+ * resulting solid. Solids whose bounds do not overlap are combined without
+ * building any BSP tree.
  */
 class BABYLON_SHARED_EXPORT CSG {
 
 public:
   CSG();
+  CSG(const CSG& otherCSG) = delete;
+  CSG& operator=(const CSG& otherCSG) = delete;
   ~CSG();
 
   // Convert BABYLON.Mesh to BABYLON.CSG
-  static CSG* FromMesh(Mesh* mesh);
+  static std::unique_ptr<CSG> FromMesh(Mesh* mesh);
 
-  CSG* clone();
-  CSG* _union(CSG* csg);
-  void unionInPlace(CSG* csg);
-  CSG* subtract(CSG* csg);
-  void subtractInPlace(CSG* csg);
-  CSG* intersect(CSG* csg);
-  void intersectInPlace(CSG* csg);
+  std::unique_ptr<CSG> clone() const;
+  std::unique_ptr<CSG> _union(const CSG& csg) const;
+  void unionInPlace(const CSG& csg);
+  std::unique_ptr<CSG> subtract(const CSG& csg) const;
+  void subtractInPlace(const CSG& csg);
+  std::unique_ptr<CSG> intersect(const CSG& csg) const;
+  void intersectInPlace(const CSG& csg);
 
   // Return a new BABYLON.CSG solid with solid and empty space switched. This
   // solid is
   // not modified.
-  CSG* inverse();
+  std::unique_ptr<CSG> inverse() const;
 
   void inverseInPlace();
 
   // This is used to keep meshes transformations so they can be restored
   // when we build back a Babylon Mesh
   // NB : All CSG operations are performed in world coordinates
-  CSG* copyTransformAttributes(CSG* csg);
+  CSG& copyTransformAttributes(const CSG& csg);
+
+  /**
+   * @brief Returns the world space bounds of the polygons of the solid.
+   */
+  MinMax getBounds() const;
 
   // Build Raw mesh from CSG
   // Coordinates here are in world space
@@ -51,21 +67,26 @@ public:
                bool keepSubMeshes = false);
 
 private:
-  // Construct a BABYLON.CSG solid from a list of `BABYLON.CSG.Polygon`
-  // instances.
-  static CSG* FromPolygons(const std::vector<Polygon*>& polygons);
-  std::vector<Polygon*>& toPolygons();
+  enum class Operation { Union, Subtract, Intersect };
+
+  // Computes `a` `operation` `b` and stores the resulting polygons in
+  // `result`, which can be one of the operands.
+  static void _Apply(const CSG& a, const CSG& b, Operation operation,
+                     CSG& result);
+  void _setPolygons(const std::vector<Polygon>& polygons);
+  std::vector<Polygon> _clonePolygons(VertexArena& arena) const;
 
 public:
   Matrix matrix;
   Vector3 position;
-  Vector3* rotation;
-  Quaternion* rotationQuaternion;
+  Vector3 rotation;
+  std::unique_ptr<Quaternion> rotationQuaternion;
   Vector3 scaling;
 
 private:
   static unsigned int currentCSGMeshId;
-  std::vector<Polygon*> _polygons;
+  std::unique_ptr<VertexArena> _arena;
+  std::vector<Polygon> _polygons;
 
 }; // end of class CSG
 
@@ -2,7 +2,8 @@
 #define BABYLON_MESH_CSG_NODE_H
 
 #include <babylon/babylon_global.h>
-#include <babylon/mesh/csg/csg.h>
+#include <babylon/core/structs.h>
+#include <babylon/mesh/csg/plane.h>
 #include <babylon/mesh/csg/polygon.h>
 
 namespace BABYLON {
@@ -16,41 +17,70 @@ namespace CSG {
  * coplanar polygons) are added directly to that node and the other polygons are
  * added to the front and/or back subtrees. This is not a leafy BSP tree since
  * there is no distinction between internal and leaf nodes.
+ *
+ * The vertices of the polygons created by the splits are allocated in the
+ * vertex arena of the tree. The tree is traversed iteratively, the front and
+ * back subtrees of large nodes being built and clipped in parallel, each task
+ * allocating from its own task arena.
  */
 class BABYLON_SHARED_EXPORT Node {
 
 public:
-  Node();
-  Node(const std::vector<BABYLON::CSG::Polygon*>& polygons);
-  ~Node();
+  /**
+   * Minimum number of polygons on both sides of a node for its front subtree
+   * to be built by a separate task.
+   */
+  static constexpr size_t ParallelThreshold = 256;
 
-  Node* clone();
+public:
+  Node(VertexArena* arena);
+  Node(VertexArena* arena, std::vector<Polygon>&& polygons);
+  Node(const Node& otherNode) = delete;
+  Node& operator=(const Node& otherNode) = delete;
+  ~Node();
 
   // Convert solid space to empty space and empty space to solid space.
   void invert();
 
-  // Recursively remove all polygons in `polygons` that are inside this BSP
-  // tree.
-  std::vector<Polygon*> clipPolygons(const std::vector<Polygon*>& polygons);
+  // Remove all polygons in `polygons` that are inside this BSP tree.
+  std::vector<Polygon> clipPolygons(std::vector<Polygon>&& polygons) const;
 
   // Remove all polygons in this BSP tree that are inside the other BSP tree
-  // `bsp`.
-  void clipTo(Node* bsp);
+  // `bsp`. The polygons outside the bounds of `bsp` are not traversed.
+  void clipTo(const Node& bsp);
 
   // Return a list of all polygons in this BSP tree.
-  std::vector<Polygon*> allPolygons();
+  std::vector<Polygon> allPolygons() const;
 
   // Build a BSP tree out of `polygons`. When called on an existing tree, the
   // new polygons are filtered down to the bottom of the tree and become new
   // nodes there. Each set of polygons is partitioned using the first polygon
   // (no heuristic is used to pick a good split).
-  void build(const std::vector<Polygon*>& polygons);
+  void build(std::vector<Polygon>&& polygons);
+
+  /**
+   * @brief Returns the bounds of the polygons added to this tree.
+   */
+  const MinMax& bounds() const;
+
+private:
+  static void _Build(Node* node, std::vector<Polygon>&& polygons,
+                     VertexArena& arena);
+  std::vector<Polygon> _clipPolygons(std::vector<Polygon>&& polygons,
+                                     VertexArena& arena) const;
+  std::vector<Node*> _collectNodes();
+  bool _isOutsideBounds(const Polygon& polygon) const;
 
 private:
-  Plane* _plane;
-  Node* _front;
-  Node* _back;
-  std::vector<Polygon*> _polygons;
+  static std::atomic<unsigned int> _ActiveTasks;
+  VertexArena* _arena;
+  bool _hasPlane;
+  bool _inverted;
+  Plane _plane;
+  MinMax _bounds;
+  std::unique_ptr<Node> _front;
+  std::unique_ptr<Node> _back;
+  std::vector<Polygon> _polygons;
 
 }; // end of class Node
 
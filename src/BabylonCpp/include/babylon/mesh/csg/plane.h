@@ -44,11 +44,19 @@ public:
    * fragments in the appropriate lists. Coplanar polygons go into either
    * `coplanarFront` or `coplanarBack` depending on their orientation with
    * `respect to this plane. Polygons in front or in back of this plane go into
-   * `either `front` or `back`.
+   * `either `front` or `back`. The vertices of the fragments of a spanning
+   * polygon are allocated in `arena`.
    */
-  void splitPolygon(Polygon* polygon, std::vector<Polygon*>& coplanarFront,
-                    std::vector<Polygon*>& coplanarBack,
-                    std::vector<Polygon*>& front, std::vector<Polygon*>& back);
+  void splitPolygon(const Polygon& polygon, std::vector<Polygon>& coplanarFront,
+                    std::vector<Polygon>& coplanarBack,
+                    std::vector<Polygon>& front, std::vector<Polygon>& back,
+                    VertexArena& arena) const;
+
+  /**
+   * @brief Returns the side of the plane the given point is on (COPLANAR, FRONT
+   * or BACK).
+   */
+  unsigned int classifyPoint(const Vector3& point) const;
 
   static Plane FromPoints(const Vector3& a, const Vector3& b, const Vector3& c,
                           bool& hasPlane);
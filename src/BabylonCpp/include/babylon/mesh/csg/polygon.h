@@ -20,26 +20,38 @@ struct BABYLON_SHARED_EXPORT PolygonOptions {
  * property, which is shared between all polygons that are clones of each other
  * or were split from the same polygon. This can be used to define per-polygon
  * properties (such as surface color).
+ *
+ * The polygon does not own its vertices, it references a contiguous range of
+ * vertices allocated in a VertexArena. Copies of a polygon reference the same
+ * range, use clone(arena) to copy the vertices as well.
  */
 class BABYLON_SHARED_EXPORT Polygon {
 
 public:
-  Polygon(const std::vector<Vertex*>& vertices, const PolygonOptions& shared);
+  Polygon();
+  Polygon(Vertex* vertices, size_t vertexCount, const PolygonOptions& shared);
   Polygon(const Polygon& otherPolygon);
   Polygon(Polygon&& otherPolygon);
   Polygon& operator=(const Polygon& otherPolygon);
   Polygon& operator=(Polygon&& otherPolygon);
   ~Polygon();
   Polygon clone() const;
-  Polygon* cloneToNewObject() const;
+
+  /**
+   * @brief Returns a copy of the polygon referencing a copy of its vertices
+   * allocated in the given arena.
+   */
+  Polygon clone(VertexArena& arena) const;
   friend std::ostream& operator<<(std::ostream& os, const Polygon& polygon);
   std::string toString() const;
 
+  // Reverses the vertices order, flips the vertices and the plane in place.
   void flip();
   bool hasPlane() const;
 
 public:
-  std::vector<Vertex*> vertices;
+  Vertex* vertices;
+  size_t vertexCount;
   PolygonOptions shared;
   Plane plane;
 
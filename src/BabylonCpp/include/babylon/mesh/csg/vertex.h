@@ -23,6 +23,7 @@ namespace CSG {
 class BABYLON_SHARED_EXPORT Vertex {
 
 public:
+  Vertex();
   Vertex(const Vector3& pos, const Vector3& normal, const Vector2& uv);
   Vertex(const Vertex& otherVertex);
   Vertex(Vertex&& otherVertex);
@@ -41,7 +42,7 @@ public:
   // Create a new vertex between this vertex and `other` by linearly
   // interpolating all properties using a parameter of `t`. Subclasses should
   // override this to interpolate additional properties.
-  Vertex interpolate(const Vertex& other, float t);
+  Vertex interpolate(const Vertex& other, float t) const;
 
 public:
   Vector3 pos;
@@ -0,0 +1,77 @@
+#ifndef BABYLON_MESH_CSG_VERTEX_ARENA_H
+#define BABYLON_MESH_CSG_VERTEX_ARENA_H
+
+#include <babylon/babylon_global.h>
+
+#include <babylon/mesh/csg/vertex.h>
+
+namespace BABYLON {
+namespace CSG {
+
+/**
+ * @brief Chunked storage of the vertices of the CSG polygons. Each polygon
+ * references a contiguous range of vertices allocated in the arena, the
+ * vertices are released all at once with the arena. Allocations never move
+ * the previously allocated vertices.
+ *
+ * An arena is used by one thread at a time and its allocations do not lock.
+ * The tasks working in parallel each allocate from a task arena, created by
+ * createTaskArena() and released with the arena that created it.
+ */
+class BABYLON_SHARED_EXPORT VertexArena {
+
+public:
+  /**
+   * Number of vertices per chunk.
+   */
+  static constexpr size_t ChunkSize = 16384;
+
+public:
+  VertexArena();
+  VertexArena(const VertexArena& other) = delete;
+  VertexArena& operator=(const VertexArena& other) = delete;
+  ~VertexArena();
+
+  /**
+   * @brief Allocates a contiguous range of default constructed vertices.
+   */
+  Vertex* allocate(size_t count);
+
+  /**
+   * @brief Copies the given vertices in a new contiguous range.
+   */
+  Vertex* copy(const Vertex* vertices, size_t count);
+
+  /**
+   * @brief Returns copies of the given polygons referencing copies of their
+   * vertices, all copied in a single contiguous range.
+   */
+  std::vector<Polygon> clone(const std::vector<Polygon>& polygons);
+
+  /**
+   * @brief Creates an arena for a task working in parallel with the thread
+   * using this arena. The task arena lives as long as this arena. Thread safe.
+   */
+  VertexArena& createTaskArena();
+
+  /**
+   * @brief Returns the number of vertices allocated in this arena, the task
+   * arenas excluded.
+   */
+  size_t size() const;
+
+private:
+  std::vector<Vertex>& _chunkFor(size_t count);
+
+private:
+  std::vector<std::vector<Vertex>> _chunks;
+  size_t _size;
+  std::mutex _taskArenasMutex;
+  std::vector<std::unique_ptr<VertexArena>> _taskArenas;
+
+}; // end of class VertexArena
+
+} // end of namespace CSG
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_CSG_VERTEX_ARENA_H
@@ -5,6 +5,8 @@
 #include <babylon/core/structs.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/mesh/iget_set_vertices_data.h>
+#include <babylon/mesh/index_optimizer.h>
+#include <babylon/mesh/vertex_compression.h>
 
 namespace BABYLON {
 
@@ -65,6 +67,11 @@ public:
                                bool forceCopy = false) override;
   VertexBuffer* getVertexBuffer(unsigned int kind) const;
   std::unordered_map<std::string, VertexBuffer*> getVertexBuffers();
+  /**
+   * @brief Returns the vertex buffers indexed by vertex buffer kind (null for
+   * the missing kinds).
+   */
+  const std::vector<VertexBuffer*>& getVertexBufferSlots() const;
   bool isVerticesDataPresent(unsigned int kind) override;
   Uint32Array getVerticesDataKinds();
   Mesh* setIndices(const IndicesArray& indices,
@@ -72,6 +79,13 @@ public:
   size_t getTotalIndices();
   IndicesArray getIndices(bool copyWhenShared = false) override;
   GL::IGLBuffer* getIndexBuffer();
+
+  /**
+   * @brief Returns the revision of the vertex and index data, incremented on
+   * every update.
+   */
+  size_t revision() const;
+
   void _releaseVertexArrayObject(Effect* effect);
   void releaseForMesh(Mesh* mesh, bool shouldDispose = true);
   void applyToMesh(Mesh* mesh);
@@ -83,6 +97,33 @@ public:
    */
   void toLeftHanded();
 
+  /**
+   * @brief Optimizes the indices and the vertices of the geometry for the
+   * vertex cache, overdraw and vertex fetch, keeping the sub meshes of the
+   * meshes using it.
+   * @returns The vertex cache statistics before and after the optimization.
+   */
+  IndexOptimizationStats
+  optimizeIndices(const IndexOptimizer& optimizer = IndexOptimizer());
+
+  /**
+   * @brief Replaces the static vertex buffers of the geometry by compressed
+   * ones: 16-bit positions dequantized by the world matrix of the meshes,
+   * octahedral normals and tangents, half float texture coordinates and 8-bit
+   * colors. The CPU keeps reading decoded floats.
+   * Positions of skinned and morphed geometries are not quantized, as these
+   * deformations are applied before the world matrix.
+   * @returns The number of bytes saved on the GPU.
+   */
+  size_t compressVertexData(const VertexCompressionOptions& options
+                            = VertexCompressionOptions());
+
+  /**
+   * @brief Replaces the vertex data of the geometry by its optimized version
+   * and restores the sub meshes of the meshes using it.
+   */
+  void _applyOptimizedVertexData(VertexData& vertexData);
+
   // Cache
   void _resetPointsArrayCache();
   bool _generatePointsArray();
@@ -112,6 +153,9 @@ private:
   void notifyUpdate(unsigned int kind = 1);
   void _queueLoad(Scene* scene, const std::function<void()>& onLoaded);
   void _disposeVertexArrayObjects();
+  void _updateVertexBufferSlots();
+  std::vector<IndexOptimizer::IndexRange> _subMeshIndexRanges() const;
+  bool _canRemapVertices() const;
 
 public:
   std::string id;
@@ -124,7 +168,8 @@ public:
     _delayLoadingFunction;
   int _softwareSkinningRenderId;
   std::vector<Vector3> _positions; // Cache
-  std::unordered_map<std::string, std::unique_ptr<GL::IGLVertexArrayObject>>
+  // Vertex array objects per effect (unique id)
+  std::unordered_map<std::size_t, std::unique_ptr<GL::IGLVertexArrayObject>>
     _vertexArrayObjects;
   std::vector<Vector3> centroids;
 
@@ -133,9 +178,14 @@ private:
   Engine* _engine;
   std::vector<Mesh*> _meshes;
   size_t _totalVertices;
+  size_t _revision;
   IndicesArray _indices;
   std::unordered_map<unsigned int, std::unique_ptr<VertexBuffer>>
     _vertexBuffers;
+  std::vector<VertexBuffer*> _vertexBufferSlots;
+  // Last bound vertex array object
+  GL::IGLVertexArrayObject* _currentVertexArrayObject;
+  std::size_t _currentVertexArrayObjectEffectId;
   bool _isDisposed;
   bool _extendSet;
   MinMax _extend;
@@ -0,0 +1,122 @@
+#ifndef BABYLON_MESH_INDEX_OPTIMIZER_H
+#define BABYLON_MESH_INDEX_OPTIMIZER_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Vertex cache statistics of an index optimization.
+ *
+ * ACMR is the average number of vertex shader invocations per triangle and
+ * ATVR the average number of invocations per vertex (1 is optimal), both
+ * measured with a FIFO post-transform cache.
+ */
+struct BABYLON_SHARED_EXPORT IndexOptimizationStats {
+  size_t triangleCount     = 0;
+  size_t vertexCountBefore = 0;
+  size_t vertexCountAfter  = 0;
+  float acmrBefore         = 0.f;
+  float acmrAfter          = 0.f;
+  float atvrBefore         = 0.f;
+  float atvrAfter          = 0.f;
+  // Whether or not the indices fit in 16 bits after the optimization
+  bool uses16BitIndices = false;
+}; // end of struct IndexOptimizationStats
+
+/**
+ * @brief Optimizes the indices and the vertices of a triangle list for the
+ * GPU:
+ *  - welds the vertices having identical attributes,
+ *  - reorders the triangles for the post-transform vertex cache (Tipsify),
+ *  - reorders clusters of triangles to reduce overdraw, within the given
+ *    cache efficiency threshold,
+ *  - reorders the vertices in order of first use for fetch locality, and
+ *    drops the unused ones.
+ *
+ * Triangles are only reordered inside each index range (sub meshes), and the
+ * optimizer only works on the passed data, so it can run on any thread.
+ */
+class BABYLON_SHARED_EXPORT IndexOptimizer {
+
+public:
+  using IndexRange = std::pair<size_t, size_t>;
+
+public:
+  IndexOptimizer();
+  ~IndexOptimizer();
+
+  /**
+   * @brief Runs the optimization pipeline on the vertex data.
+   * @param ranges Index ranges (start, count) which are reordered
+   * independently, the whole index buffer when empty.
+   */
+  IndexOptimizationStats optimize(VertexData& vertexData,
+                                  std::vector<IndexRange> ranges = {}) const;
+
+  /**
+   * @brief Merges the vertices having identical attributes and drops the
+   * unused ones, keeping the vertex order.
+   * @returns The new vertex count.
+   */
+  static size_t WeldVertices(VertexData& vertexData);
+
+  /**
+   * @brief Reorders the triangles of the range for a FIFO post-transform
+   * vertex cache of cacheSize entries (Tipsify, Sander et al. 2007).
+   */
+  static void OptimizeVertexCache(IndicesArray& indices, IndexRange range,
+                                  size_t vertexCount, unsigned int cacheSize);
+
+  /**
+   * @brief Splits the triangles of the range in clusters, without increasing
+   * the ACMR of the range by more than threshold, and sorts the clusters
+   * front to back from the outside of the mesh to reduce overdraw.
+   */
+  static void OptimizeOverdraw(IndicesArray& indices, IndexRange range,
+                               const Float32Array& positions,
+                               unsigned int cacheSize, float threshold);
+
+  /**
+   * @brief Reorders the vertices in order of first use in the index buffer
+   * and drops the unused ones.
+   * @returns The new vertex count.
+   */
+  static size_t OptimizeVertexFetch(VertexData& vertexData);
+
+  /**
+   * @brief Simulates a FIFO post-transform cache of cacheSize entries.
+   * @param acmr Average cache miss ratio (misses per triangle)
+   * @param atvr Average transformed vertex ratio (misses per vertex)
+   */
+  static void AnalyzeVertexCache(const IndicesArray& indices,
+                                 size_t vertexCount, unsigned int cacheSize,
+                                 float& acmr, float& atvr);
+
+  /**
+   * @brief Returns the number of vertices of the vertex data, 0 if the sizes
+   * of its attributes are inconsistent.
+   */
+  static size_t VertexCount(const VertexData& vertexData);
+
+public:
+  /**
+   * Size of the simulated post-transform cache.
+   */
+  unsigned int cacheSize;
+
+  /**
+   * Maximum ACMR increase ratio allowed by the overdraw optimization (1.05
+   * allows 5% more vertex shader invocations).
+   */
+  float overdrawThreshold;
+
+  bool weldVertices;
+  bool optimizeOverdraw;
+  bool optimizeVertexFetch;
+
+}; // end of class IndexOptimizer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_INDEX_OPTIMIZER_H
@@ -5,7 +5,9 @@
 #include <babylon/math/isize.h>
 #include <babylon/math/path3d.h>
 #include <babylon/mesh/abstract_mesh.h>
+#include <babylon/mesh/index_optimizer.h>
 #include <babylon/mesh/iget_set_vertices_data.h>
+#include <babylon/mesh/static_batch_range.h>
 
 namespace BABYLON {
 
@@ -317,6 +319,28 @@ public:
    */
   void setOverridenInstanceCount(size_t count);
 
+  /**
+   * @brief Registers a per instance attribute stored in the instances buffer
+   * after the world matrix. The value of each instance is read from its
+   * instancedBuffers map (missing values are set to 0).
+   * @param kind The vertex buffer kind of the attribute (e.g.
+   * VertexBuffer::InstanceColorKind).
+   * @param size The number of floats of the attribute.
+   */
+  void registerInstancedBuffer(unsigned int kind, unsigned int size);
+
+  /**
+   * @brief Sets the index ranges of the source meshes merged in this mesh (see
+   * StaticBatching). Each range is frustum culled individually when the mesh
+   * is rendered and the contiguous visible ranges are drawn together.
+   */
+  void setStaticBatchRanges(std::vector<StaticBatchRange>&& ranges);
+
+  /**
+   * @brief Returns the index ranges of the source meshes merged in this mesh.
+   */
+  const std::vector<StaticBatchRange>& staticBatchRanges() const;
+
   /** Methods **/
   void _preActivate() override;
   void _preActivateForIntermediateRendering(int renderId) override;
@@ -485,6 +509,17 @@ public:
   Mesh& _renderWithInstances(SubMesh* subMesh, int fillMode,
                              _InstancesBatch* batch, Effect* effect,
                              Engine* engine);
+  size_t _getInstanceStride() const;
+  /**
+   * @brief Returns the world matrix sent to the shaders for the given world
+   * matrix: with the dequantization of the 16-bit positions folded in when the
+   * positions are compressed.
+   */
+  Matrix* _getWorldMatrixForRendering(Matrix* world);
+  /**
+   * @brief Forces the repacking of the world matrices of the instances.
+   */
+  void _invalidateInstancesData();
   Mesh& _processRendering(SubMesh* subMesh, Effect* effect, int fillMode,
                           _InstancesBatch* batch,
                           bool hardwareInstancedRendering,
@@ -712,15 +747,31 @@ public:
                                            = SimplificationType::QUADRATIC);*/
 
   /**
-   * @brief Optimization of the mesh's indices, in case a mesh has duplicated
-   * vertices. The function will only reorder the indices and will not remove
-   * unused vertices to avoid problems with submeshes.
-   * This should be used together with the simplification to avoid disappearing
-   * triangles.
+   * @brief Optimization of the mesh's indices and vertices: welds the
+   * duplicated vertices, reorders the triangles of each submesh for the vertex
+   * cache and overdraw, and the vertices for fetch locality.
+   * The optimization runs on a background thread on a copy of the vertex
+   * data, the result is applied to the geometry (and the other meshes sharing
+   * it) at the beginning of the next frame after its completion, unless the
+   * geometry was replaced or its indices changed in the meantime.
    * @param successCallback an optional success callback to be called after the
    * optimization finished.
+   * @param optimizer the optimization settings.
+   */
+  void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback,
+                       const IndexOptimizer& optimizer = IndexOptimizer());
+
+  /**
+   * @brief Returns the vertex cache statistics of the last completed index
+   * optimization.
+   */
+  const IndexOptimizationStats& indexOptimizationStats() const;
+
+  /**
+   * @brief Applies the result of the index optimization if it is completed.
+   * @returns Whether or not no optimization is pending anymore.
    */
-  void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback);
+  bool _applyIndexOptimization();
 
   void _syncGeometryWithMorphTargetManager();
 
@@ -1452,6 +1503,7 @@ private:
   Mesh& _onBeforeDraw(bool isInstance, Matrix& world,
                       Material* effectiveMaterial);
   Mesh& _queueLoad(Mesh* mesh, Scene* scene);
+  void _prepareStaticBatchDrawRanges(SubMesh* subMesh);
 
 public:
   int delayLoadState;
@@ -1473,12 +1525,42 @@ private:
   std::vector<Vector3> _emptyPositions;
   // Morph
   MorphTargetManager* _morphTargetManager;
+  // Positions blended with the morph targets, for picking and collisions
+  std::vector<Vector3> _morphedPositions;
+  std::size_t _morphedPositionsRevision;
   std::vector<VertexBuffer*> _delayInfo;
   Int32Array _renderIdForInstances;
   std::unique_ptr<_InstancesBatch> _batchCache;
   unsigned int _instancesBufferSize;
   std::unique_ptr<Buffer> _instancesBuffer;
   Float32Array _instancesData;
+  // World matrix and user defined vertex buffers of the instances buffer,
+  // bound over the vertex buffers of the geometry (indexed by kind)
+  std::vector<std::unique_ptr<VertexBuffer>> _instancesVertexBuffers;
+  std::vector<VertexBuffer*> _instancesVertexBufferSlots;
+  // Instance (and world matrix update flag) stored in each slot of the
+  // instances buffer
+  std::vector<AbstractMesh*> _instancesSlots;
+  Int32Array _instancesSlotFlags;
+  // User defined per instance attributes (kind, size)
+  std::vector<std::pair<unsigned int, unsigned int>> _userInstancedBuffers;
+  // Dequantization of the compressed positions and world matrix sent to the
+  // shaders
+  Matrix _positionDequantization;
+  Matrix _worldMatrixForRendering;
+  // Static batch ranges and visible index ranges (start, count) drawn for the
+  // current frustum
+  std::vector<StaticBatchRange> _staticBatchRanges;
+  std::vector<std::pair<unsigned int, size_t>> _staticBatchDrawRanges;
+  bool _useStaticBatchDrawRanges;
+  // Asynchronous index optimization (the task is declared after the data it
+  // works on, so that it is waited for before the data is released)
+  std::unique_ptr<VertexData> _indexOptimizationData;
+  Geometry* _indexOptimizationGeometry;
+  size_t _indexOptimizationRevision;
+  std::vector<std::function<void(Mesh* mesh)>> _indexOptimizationCallbacks;
+  std::future<IndexOptimizationStats> _indexOptimizationTask;
+  IndexOptimizationStats _indexOptimizationStats;
   size_t _overridenInstanceCount;
   int _preActivateId;
   unsigned int _sideOrientation;
@@ -0,0 +1,29 @@
+#ifndef BABYLON_MESH_STATIC_BATCH_RANGE_H
+#define BABYLON_MESH_STATIC_BATCH_RANGE_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Index range of a source mesh merged in a static batch. The range is
+ * frustum culled individually when the batch is rendered.
+ */
+struct BABYLON_SHARED_EXPORT StaticBatchRange {
+  StaticBatchRange(const std::string& sourceName, unsigned int indexStart,
+                   size_t indexCount, const Vector3& minimum,
+                   const Vector3& maximum);
+  StaticBatchRange(StaticBatchRange&& other);
+  StaticBatchRange& operator=(StaticBatchRange&& other);
+  ~StaticBatchRange();
+
+  std::string sourceName;
+  unsigned int indexStart;
+  size_t indexCount;
+  // World space bounding info of the source mesh
+  std::unique_ptr<BoundingInfo> boundingInfo;
+}; // end of struct StaticBatchRange
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_STATIC_BATCH_RANGE_H
@@ -0,0 +1,87 @@
+#ifndef BABYLON_MESH_STATIC_BATCHING_H
+#define BABYLON_MESH_STATIC_BATCHING_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Merges static meshes into large shared vertex / index buffers to
+ * reduce the number of draw calls.
+ *
+ * The meshes are bucketed by material, rendering state and spatial cell. The
+ * size of each merged mesh is computed upfront so that the vertex data of all
+ * the sources are written in a single pass into preallocated arrays, the
+ * buckets being filled in parallel. The world matrices are baked into the
+ * merged vertices and the merged meshes are frozen. The index range of each
+ * source mesh is kept on the merged mesh (see Mesh::staticBatchRanges) so
+ * that frustum culling is still performed per source mesh when the batch is
+ * rendered.
+ *
+ * Typical usage is to batch the scene once loaded:
+ * StaticBatching staticBatching;
+ * staticBatching.apply(scene);
+ */
+class BABYLON_SHARED_EXPORT StaticBatching {
+
+public:
+  StaticBatching();
+  ~StaticBatching();
+
+  /**
+   * @brief Returns whether or not the given mesh is static and can be merged
+   * with other meshes.
+   */
+  static bool CanBeBatched(AbstractMesh* mesh);
+
+  /**
+   * @brief Batches all the static meshes of the scene.
+   * @returns The created merged meshes.
+   */
+  std::vector<Mesh*> apply(Scene* scene);
+
+  /**
+   * @brief Batches the given meshes. Meshes that cannot be batched are
+   * ignored.
+   * @returns The created merged meshes.
+   */
+  std::vector<Mesh*> apply(const std::vector<Mesh*>& meshes);
+
+private:
+  struct Bucket;
+
+  static std::vector<unsigned int> _GetBatchedKinds(Mesh* mesh);
+  static void _PrepareBucket(Bucket& bucket);
+  static void _FillBucket(Bucket& bucket);
+  void _fillBuckets(std::vector<Bucket>& buckets);
+  static void _ApplyBucket(Bucket& bucket, Mesh* target);
+  static void _SetBatchRanges(const Bucket& bucket, Mesh* target);
+
+public:
+  /**
+   * Size of the spatial cells used to bucket the meshes (0 disables the
+   * spatial bucketing).
+   */
+  float cellSize;
+
+  /**
+   * Maximum number of vertices of a merged mesh (0 means only limited by the
+   * supported index format).
+   */
+  size_t maxVerticesPerBatch;
+
+  /**
+   * Maximum number of threads used to fill the buckets.
+   */
+  unsigned int maxThreads;
+
+  /**
+   * Whether or not the source meshes are disposed once merged.
+   */
+  bool disposeSource;
+
+}; // end of class StaticBatching
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_STATIC_BATCHING_H
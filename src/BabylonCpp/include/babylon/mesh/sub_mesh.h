@@ -2,6 +2,7 @@
 #define BABYLON_MESH_SUB_MESH_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/culling/icullable.h>
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/math/matrix.h>
@@ -167,6 +168,9 @@ public:
   size_t _id;
   std::unique_ptr<MaterialDefines> _materialDefines;
   Effect* _materialEffect;
+  // Meshes rendered as instances of this submesh by the rendering manager,
+  // only set while it renders
+  FrameVector<AbstractMesh*>* _autoInstances;
 
 private:
   AbstractMesh* _mesh;
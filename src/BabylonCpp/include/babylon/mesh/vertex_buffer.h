@@ -32,6 +32,14 @@ public:
   static constexpr unsigned int World3Kind               = 18;
   static constexpr unsigned int CellInfoKind             = 19;
   static constexpr unsigned int OptionsKind              = 20;
+  static constexpr unsigned int InstanceColorKind        = 21;
+  // Morph targets, one kind per active target ("position" + index, ...)
+  static constexpr unsigned int MaxMorphTargetInfluencers = 8;
+  static constexpr unsigned int MorphTargetPositionKind   = 22;
+  static constexpr unsigned int MorphTargetNormalKind
+    = MorphTargetPositionKind + MaxMorphTargetInfluencers;
+  static constexpr unsigned int MorphTargetTangentKind
+    = MorphTargetNormalKind + MaxMorphTargetInfluencers;
 
   static constexpr const char* PositionKindChars        = "position";
   static constexpr const char* NormalKindChars          = "normal";
@@ -55,6 +63,7 @@ public:
   static constexpr const char* World3KindChars   = "world3";
   static constexpr const char* CellInfoKindChars = "cellInfo";
   static constexpr const char* OptionsKindChars  = "options";
+  static constexpr const char* InstanceColorKindChars = "instanceColor";
 
 public:
   VertexBuffer(Engine* engine, const Float32Array& data, unsigned int kind,
@@ -65,10 +74,23 @@ public:
                bool updatable, bool postponeInternalCreation = false,
                int stride = -1, bool instanced = false, int offset = -1,
                int size = -1);
+  /**
+   * @brief Creates a static vertex buffer of vertices compressed in the given
+   * VertexCompression format.
+   * @param stride The number of components of the decoded vertices.
+   */
+  VertexBuffer(Engine* engine, const Uint16Array& packedData,
+               unsigned int kind, unsigned int format, int stride,
+               const std::array<float, 4>& quantizationCube);
   virtual ~VertexBuffer();
 
   /** Statics **/
   static std::string KindAsString(unsigned int kind);
+  /**
+   * @brief Returns the kind matching the given attribute name or 0 if the name
+   * is not a vertex buffer kind.
+   */
+  static unsigned int KindFromString(const std::string& kind);
   static int KindToStride(unsigned int kind);
 
   /** Properties **/
@@ -113,6 +135,28 @@ public:
    */
   bool getIsInstanced() const;
 
+  /**
+   * @brief Returns the VertexCompression format of the data on the GPU
+   * (VertexCompression::None for floats).
+   */
+  unsigned int getFormat() const;
+
+  /**
+   * @brief Returns the quantization cube (offset, size) of the Unorm16
+   * positions.
+   */
+  const std::array<float, 4>& getQuantizationCube() const;
+
+  /**
+   * @brief Returns the GL data type, normalization, number of components,
+   * stride and offset in bytes of the vertex attribute on the GPU.
+   */
+  unsigned int getAttributeType() const;
+  bool getAttributeNormalized() const;
+  int getAttributeSize() const;
+  int getByteStride() const;
+  int getByteOffset() const;
+
   /** Methods **/
 
   /**
@@ -0,0 +1,107 @@
+#ifndef BABYLON_MESH_VERTEX_COMPRESSION_H
+#define BABYLON_MESH_VERTEX_COMPRESSION_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Attributes compressed by Geometry::compressVertexData.
+ */
+struct BABYLON_SHARED_EXPORT VertexCompressionOptions {
+  // 16-bit normalized positions, dequantized by the world matrix
+  bool quantizePositions = true;
+  // Octahedral-encoded normals and tangents (2 x 16-bit)
+  bool octahedralNormals = true;
+  // Half float texture coordinates
+  bool halfFloatUVs = true;
+  // 8-bit normalized colors
+  bool unorm8Colors = true;
+}; // end of struct VertexCompressionOptions
+
+/**
+ * @brief Encoders and decoders of the compressed vertex attribute formats.
+ *
+ * The compressed data is packed in 16-bit words, each vertex starting on a 4
+ * bytes boundary. The decoders reproduce the conversions done by the GPU, so
+ * that the CPU (picking, collisions, bounding info) works on the exact values
+ * which are rendered.
+ */
+class BABYLON_SHARED_EXPORT VertexCompression {
+
+public:
+  enum Format : unsigned int {
+    // 32-bit floats, not compressed
+    None = 0,
+    // Unsigned normalized 16-bit integers in the quantization cube
+    Unorm16 = 1,
+    // Unit vectors as 2 signed normalized 16-bit integers, the handedness of
+    // the tangents is stored in a third component
+    Octahedral16 = 2,
+    // Half floats
+    Half16 = 3,
+    // Unsigned normalized 8-bit integers
+    Unorm8 = 4,
+  };
+
+  /**
+   * Quantization cube of the Unorm16 format: offset (x, y, z) and size.
+   */
+  using QuantizationCube = std::array<float, 4>;
+
+public:
+  /**
+   * @brief Packs the data (vertices of components floats) in the format.
+   */
+  static Uint16Array Encode(Format format, const Float32Array& data,
+                            size_t components,
+                            const QuantizationCube& cube = {{0.f, 0.f, 0.f,
+                                                             1.f}});
+
+  /**
+   * @brief Unpacks the data to vertices of components floats.
+   */
+  static Float32Array Decode(Format format, const Uint16Array& packed,
+                             size_t components,
+                             const QuantizationCube& cube = {{0.f, 0.f, 0.f,
+                                                              1.f}});
+
+  /**
+   * @brief Returns the smallest cube containing the positions, as offset and
+   * size (a uniform scale keeps the normals transformed by the world matrix
+   * valid).
+   */
+  static QuantizationCube ComputeQuantizationCube(const Float32Array& positions,
+                                                  size_t components = 3);
+
+  /**
+   * @brief Returns the number of 16-bit words of a packed vertex.
+   */
+  static size_t PackedWords(Format format, size_t components);
+
+  /**
+   * @brief Returns the GL data type of the vertex attribute.
+   */
+  static unsigned int AttributeType(Format format);
+
+  /**
+   * @brief Returns whether or not the integer values of the attribute are
+   * normalized by the GPU.
+   */
+  static bool IsNormalized(Format format);
+
+  /**
+   * @brief Returns the number of components of the vertex attribute.
+   */
+  static int AttributeSize(Format format, size_t components);
+
+  static uint16_t FloatToHalf(float value);
+  static float HalfToFloat(uint16_t value);
+  static void OctahedralEncode(const float* vector, int16_t* encoded);
+  static void OctahedralDecode(const int16_t* encoded, float* vector);
+
+}; // end of class VertexCompression
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESH_VERTEX_COMPRESSION_H
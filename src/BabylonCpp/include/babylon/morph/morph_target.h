@@ -26,6 +26,63 @@ public:
   Float32Array& getTangents();
   const Float32Array& getTangents() const;
 
+  /**
+   * @brief Returns the number of vertices of the target, dense or sparse.
+   */
+  std::size_t vertexCount() const;
+
+  /**
+   * @brief Returns whether the target only stores the deltas of the vertices
+   * it moves.
+   */
+  bool isSparse() const;
+
+  /**
+   * @brief Sets the target as sparse deltas relative to the base mesh: the
+   * vertex indices[i] is moved by the i-th delta. The normal and tangent
+   * deltas are optional, the dense data of the target is released.
+   */
+  void setSparseDeltas(std::size_t vertexCount, const Uint32Array& indices,
+                       const Float32Array& positionDeltas,
+                       const Float32Array& normalDeltas  = Float32Array(),
+                       const Float32Array& tangentDeltas = Float32Array());
+
+  /**
+   * @brief Converts the dense target to sparse deltas relative to the base
+   * mesh, only keeping the vertices with a component moved by more than
+   * epsilon.
+   * @return Whether the target was converted
+   */
+  bool makeSparse(const Float32Array& basePositions,
+                  const Float32Array& baseNormals  = Float32Array(),
+                  const Float32Array& baseTangents = Float32Array(),
+                  float epsilon                    = 1e-6f);
+
+  const Uint32Array& sparseIndices() const;
+  const Float32Array& positionDeltas() const;
+  const Float32Array& normalDeltas() const;
+  const Float32Array& tangentDeltas() const;
+
+  /**
+   * @brief Returns the dense positions, normals or tangents of the target,
+   * expanded from the base data when the target is sparse.
+   */
+  Float32Array densePositions(const Float32Array& basePositions) const;
+  Float32Array denseNormals(const Float32Array& baseNormals) const;
+  Float32Array denseTangents(const Float32Array& baseTangents) const;
+
+  /**
+   * @brief Adds influence * (target - base) to the blended data, for the
+   * positions, normals or tangents. The blended data is expected to have the
+   * size of the base data.
+   */
+  void accumulatePositions(const Float32Array& basePositions,
+                           Float32Array& result) const;
+  void accumulateNormals(const Float32Array& baseNormals,
+                         Float32Array& result) const;
+  void accumulateTangents(const Float32Array& baseTangents,
+                          Float32Array& result) const;
+
   /**
    * @brief Serializes the current target into a Serialization object.
    * Returns the serialized object.
@@ -38,15 +95,44 @@ public:
   static std::unique_ptr<MorphTarget>
   FromMesh(AbstractMesh* mesh, const std::string& name, float influence = 0.f);
 
+  /**
+   * @brief Adds weight * (target - base) to the result, 4 floats at a time
+   * when SSE2 is available.
+   */
+  static void AccumulateDense(const Float32Array& target,
+                              const Float32Array& base, float weight,
+                              Float32Array& result);
+
+  /**
+   * @brief Adds weight * delta to the vec3 of the result of each sparse
+   * index.
+   */
+  static void AccumulateSparse(const Uint32Array& indices,
+                               const Float32Array& deltas, float weight,
+                               Float32Array& result);
+
 public:
   Observable<bool> onInfluenceChanged;
 
+private:
+  Float32Array _dense(const Float32Array& data, const Float32Array& deltas,
+                      const Float32Array& base) const;
+  void _accumulate(const Float32Array& data, const Float32Array& deltas,
+                   const Float32Array& base, Float32Array& result) const;
+
 private:
   std::string _name;
   std::vector<Animation*> animations;
   Float32Array _positions;
   Float32Array _normals;
   Float32Array _tangents;
+  // Sparse storage
+  bool _isSparse;
+  std::size_t _vertexCount;
+  Uint32Array _sparseIndices;
+  Float32Array _positionDeltas;
+  Float32Array _normalDeltas;
+  Float32Array _tangentDeltas;
   float _influence;
 
 }; // end of class MorphTarget
@@ -33,6 +33,34 @@ public:
   void addTarget(std::unique_ptr<MorphTarget>&& target);
   void removeTarget(MorphTarget* target);
 
+  /**
+   * @brief Maximum number of influences sent to the GPU, 0 (default) for the
+   * VertexBuffer::MaxMorphTargetInfluencers limit. When more targets are
+   * influent, only the strongest ones are rendered and blended on the CPU.
+   */
+  std::size_t maxGPUInfluencers() const;
+  void setMaxGPUInfluencers(std::size_t count);
+
+  /**
+   * @brief Returns the revision of the blended data, incremented whenever an
+   * influence or a target changes.
+   */
+  std::size_t blendRevision() const;
+
+  /**
+   * @brief Invalidates the blended data, when the base data was updated in
+   * place.
+   */
+  void markBlendDirty();
+
+  /**
+   * @brief Blends on the CPU the positions or normals of the base mesh with
+   * the active targets (dense or sparse), the ones rendered by the GPU. The
+   * result is cached until an influence, a target or the base data changes.
+   */
+  const Float32Array& blendPositions(const Float32Array& basePositions);
+  const Float32Array& blendNormals(const Float32Array& baseNormals);
+
   /**
    * Serializes the current manager into a Serialization object.
    * Returns the serialized object.
@@ -47,13 +75,28 @@ protected:
   MorphTargetManager(Scene* scene);
 
 private:
+  struct BlendCache {
+    Float32Array data;
+    const float* base    = nullptr;
+    std::size_t size     = 0;
+    std::size_t revision = 0;
+  }; // end of struct BlendCache
+
   void _onInfluenceChanged(bool needUpdate);
   void _syncActiveTargets(bool needUpdate);
+  const Float32Array&
+  _blend(const Float32Array& base, BlendCache& cache,
+         void (MorphTarget::*accumulate)(const Float32Array&, Float32Array&)
+           const);
 
 private:
   std::vector<std::unique_ptr<MorphTarget>> _targets;
   std::vector<Observer<bool>::Ptr> _targetObservable;
   std::vector<MorphTarget*> _activeTargets;
+  std::size_t _maxGPUInfluencers;
+  std::size_t _blendRevision;
+  BlendCache _positionsBlend;
+  BlendCache _normalsBlend;
   Scene* _scene;
   Float32Array _influences;
   bool _supportsNormals;
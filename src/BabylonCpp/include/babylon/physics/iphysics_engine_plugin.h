@@ -25,7 +25,8 @@ struct BABYLON_SHARED_EXPORT IPhysicsEnginePlugin {
   virtual void generateJoint(PhysicsImpostorJoint* joint)     = 0;
   virtual void removeJoint(PhysicsImpostorJoint* joint)       = 0;
   virtual bool isSupported()                                  = 0;
-  virtual void setTransformationFromPhysicsBody(PhysicsImpostor* impostor);
+  virtual void setTransformationFromPhysicsBody(PhysicsImpostor* impostor)
+    = 0;
   virtual void setPhysicsBodyTransformation(PhysicsImpostor* impostor,
                                             const Vector3& newPosition,
                                             const Quaternion& newRotation)
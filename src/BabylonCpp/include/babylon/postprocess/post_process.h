@@ -55,6 +55,13 @@ public:
   Camera* getCamera();
   Engine* getEngine();
   PostProcess& shareOutputWith(PostProcess* postProcess);
+  /**
+   * Declares that the effect samples the texture of another post process
+   * (Effect::setTextureFromPostProcess), so that the render graph keeps the
+   * texture alive until this post process is applied.
+   */
+  PostProcess& addTextureInput(PostProcess* postProcess);
+  const std::vector<PostProcess*>& textureInputs() const;
   void updateEffect(
     const std::string& defines               = "",
     const std::vector<std::string>& uniforms = {},
@@ -69,6 +76,15 @@ public:
   bool isSupported() const;
   Effect* apply();
   void _disposeTextures();
+  // Render graph
+  RenderGraphTextureDescription
+  _getTextureDescription(Camera* camera, GL::IGLTexture* sourceTexture);
+  PostProcess* _getSharedOutputPostProcess() const;
+  const std::vector<PostProcess*>& _getTextureReaders() const;
+  bool _isRenderGraphManaged() const;
+  void _setRenderGraphTexture(GL::IGLTexture* texture, int textureWidth,
+                              int textureHeight);
+  void _releaseRenderGraphTexture();
   virtual void dispose(Camera* camera = nullptr);
 
 public:
@@ -84,6 +100,10 @@ public:
   // Can only be used on a single postprocess or on the last one of a chain.
   bool enablePixelPerfectMode;
   unsigned int samples;
+  // Whether or not the effect samples the input texture of the post process,
+  // false when textureSampler is bound to the texture of another one (the
+  // render graph can then cull the pass writing the input texture).
+  bool sampleInputTexture;
   std::vector<GL::IGLTexture*> _textures;
   unsigned int _currentRenderTextureInd;
   // Events
@@ -126,6 +146,11 @@ private:
   std::vector<std::string> _parameters;
   Vector2 _scaleRatio;
   PostProcess* _shareOutputWithPostProcess;
+  std::vector<PostProcess*> _textureInputs;
+  std::vector<PostProcess*> _textureReaders;
+  bool _renderGraphManaged;
+  int _requiredWidth;
+  int _requiredHeight;
   // Events
   Observer<Camera>::Ptr _onActivateObserver;
   Observer<PostProcess>::Ptr _onSizeChangedObserver;
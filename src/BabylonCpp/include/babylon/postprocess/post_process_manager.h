@@ -7,7 +7,15 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Renders the post processes of the active camera.
+ *
+ * When useRenderGraph is enabled, the post process chains are declared to a
+ * render graph every frame: the texture of each post process is written by
+ * the previous pass and read by the post process itself and by the post
+ * processes declaring it as texture input. The passes whose outputs are not
+ * read are culled and the transient textures of compatible description are
+ * aliased. Reusable post processes, shared outputs and textures read outside
+ * of the chain keep their own textures.
  */
 class BABYLON_SHARED_EXPORT PostProcessManager : public IDisposable {
 
@@ -26,8 +34,27 @@ public:
                       = std::vector<PostProcess*>());
   void dispose(bool doNotRecurse = false) override;
 
+  /**
+   * @brief Returns the render graph of the camera post processes, nullptr
+   * before the first frame.
+   */
+  RenderGraph* renderGraph();
+
 private:
   void _prepareBuffers();
+  std::unique_ptr<RenderGraph> _createRenderGraph();
+  void _buildRenderGraph(RenderGraph& graph,
+                         const std::vector<PostProcess*>& postProcesses,
+                         GL::IGLTexture* sourceTexture, size_t firstManaged);
+  void _releaseRenderGraphTextures(
+    const std::vector<PostProcess*>& postProcesses);
+
+public:
+  /**
+   * Whether or not the textures of the post processes are allocated by the
+   * render graph.
+   */
+  bool useRenderGraph;
 
 private:
   Scene* _scene;
@@ -35,6 +62,10 @@ private:
   Float32Array _vertexDeclaration;
   std::unordered_map<std::string, std::unique_ptr<VertexBuffer>> _vertexBuffers;
   std::unordered_map<std::string, VertexBuffer*> _vertexBufferPtrs;
+  // Render graphs of the camera post processes and of the direct renders
+  std::unique_ptr<RenderGraph> _renderGraph;
+  std::unique_ptr<RenderGraph> _directRenderGraph;
+  std::vector<PostProcess*> _renderGraphPostProcesses;
 
 }; // end of class PostProcessManager
 
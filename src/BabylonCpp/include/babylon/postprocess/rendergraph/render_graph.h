@@ -0,0 +1,190 @@
+#ifndef BABYLON_POSTPROCESS_RENDERGRAPH_RENDER_GRAPH_H
+#define BABYLON_POSTPROCESS_RENDERGRAPH_RENDER_GRAPH_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/engine/engine_constants.h>
+#include <babylon/materials/textures/texture_constants.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Description of a render target texture of the render graph. Two
+ * transient textures can only share the same GPU texture when their
+ * descriptions are equal.
+ */
+struct BABYLON_SHARED_EXPORT RenderGraphTextureDescription {
+  int width                  = 0;
+  int height                 = 0;
+  unsigned int type          = EngineConstants::TEXTURETYPE_UNSIGNED_INT;
+  unsigned int samplingMode  = TextureConstants::TRILINEAR_SAMPLINGMODE;
+  bool generateDepthBuffer   = false;
+  bool generateStencilBuffer = false;
+  unsigned int samples       = 1;
+
+  bool operator==(const RenderGraphTextureDescription& other) const;
+  bool operator!=(const RenderGraphTextureDescription& other) const;
+
+  /**
+   * @brief Returns the estimated GPU memory of the texture, in bytes.
+   */
+  size_t byteSize() const;
+}; // end of struct RenderGraphTextureDescription
+
+/**
+ * @brief Frame graph of render passes.
+ *
+ * The passes are declared in execution order with the textures they read and
+ * write. Compiling the graph:
+ *  - culls the passes whose outputs are never read (passes with side effects
+ *    and passes writing imported textures are always kept),
+ *  - computes the lifetime (first and last pass) of each transient texture,
+ *  - assigns the transient textures to GPU textures of a pool, aliasing the
+ *    textures of equal description whose lifetimes do not overlap.
+ *
+ * The pool is kept between compilations so that a graph rebuilt every frame
+ * does not allocate once it is stable. Pool textures not used by a number of
+ * compilations are released.
+ */
+class BABYLON_SHARED_EXPORT RenderGraph {
+
+public:
+  using CreateTextureFunc
+    = std::function<GL::IGLTexture*(const RenderGraphTextureDescription&)>;
+  using ReleaseTextureFunc = std::function<void(GL::IGLTexture*)>;
+
+public:
+  RenderGraph(const CreateTextureFunc& createTexture,
+              const ReleaseTextureFunc& releaseTexture);
+  ~RenderGraph();
+
+  /**
+   * @brief Removes the passes and textures, keeps the texture pool.
+   */
+  void reset();
+
+  /**
+   * @brief Declares a transient texture, allocated by the graph.
+   * @returns The handle of the texture.
+   */
+  size_t createTexture(const std::string& name,
+                       const RenderGraphTextureDescription& description);
+
+  /**
+   * @brief Declares a texture owned outside of the graph (possibly nullptr),
+   * never aliased.
+   * @returns The handle of the texture.
+   */
+  size_t importTexture(const std::string& name, GL::IGLTexture* texture);
+
+  /**
+   * @brief Declares a pass, executed after the previously declared ones.
+   * @returns The handle of the pass.
+   */
+  size_t addPass(const std::string& name,
+                 const std::function<void()>& execute = nullptr);
+  void read(size_t pass, size_t texture);
+  void write(size_t pass, size_t texture);
+
+  /**
+   * @brief Marks the pass as having effects outside of the graph, it is
+   * never culled.
+   */
+  void setSideEffect(size_t pass, bool sideEffect = true);
+
+  /**
+   * @brief Culls the passes, computes the lifetimes and assigns the GPU
+   * textures.
+   */
+  void compile();
+
+  /**
+   * @brief Executes the passes which are not culled, in order.
+   */
+  void execute();
+
+  bool isCompiled() const;
+  bool isCulled(size_t pass) const;
+
+  /**
+   * @brief Returns the GPU texture assigned to the texture, nullptr when it
+   * is not used by any remaining pass.
+   */
+  GL::IGLTexture* getTexture(size_t texture) const;
+
+  /**
+   * @brief Returns the lifetime (first pass, last pass) of the texture.
+   */
+  std::pair<size_t, size_t> getLifetime(size_t texture) const;
+
+  /**
+   * @brief Releases all the textures of the pool.
+   */
+  void releaseTextures();
+
+  // Statistics
+  size_t passCount() const;
+  size_t culledPassCount() const;
+  size_t transientTextureCount() const;
+  size_t physicalTextureCount() const;
+  // Number of textures created since the creation of the graph
+  size_t allocationCount() const;
+  // Memory of the transient textures without aliasing
+  size_t requestedBytes() const;
+  // Memory of the textures of the pool
+  size_t allocatedBytes() const;
+
+public:
+  /**
+   * Number of compilations after which an unused pool texture is released.
+   */
+  unsigned int poolLifetime;
+
+private:
+  struct Texture {
+    std::string name;
+    RenderGraphTextureDescription description;
+    GL::IGLTexture* texture;
+    bool imported;
+    std::vector<size_t> readers;
+    std::vector<size_t> writers;
+    size_t firstPass;
+    size_t lastPass;
+  }; // end of struct Texture
+
+  struct Pass {
+    std::string name;
+    std::function<void()> execute;
+    std::vector<size_t> reads;
+    std::vector<size_t> writes;
+    bool sideEffect;
+    bool culled;
+  }; // end of struct Pass
+
+  struct PooledTexture {
+    RenderGraphTextureDescription description;
+    GL::IGLTexture* texture;
+    // Last pass using the texture in the current compilation
+    size_t lastPass;
+    bool used;
+    unsigned int unusedCompilations;
+  }; // end of struct PooledTexture
+
+private:
+  void _cullPasses();
+  void _computeLifetimes();
+  void _assignTextures();
+
+private:
+  CreateTextureFunc _createTexture;
+  ReleaseTextureFunc _releaseTexture;
+  std::vector<Texture> _textures;
+  std::vector<Pass> _passes;
+  std::vector<PooledTexture> _pool;
+  bool _compiled;
+  size_t _allocationCount;
+
+}; // end of class RenderGraph
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_POSTPROCESS_RENDERGRAPH_RENDER_GRAPH_H
@@ -29,6 +29,12 @@ public:
   void setSamples(unsigned int value);
   int refreshRate() const;
   void setRefreshRate(int value);
+  /**
+   * @brief Number of cube faces updated per render, the probe being fully
+   * updated every 6 / facesPerRender renders.
+   */
+  unsigned int facesPerRender() const;
+  void setFacesPerRender(unsigned int value);
   Scene* getScene() const;
   RenderTargetTexture* cubeTexture();
   std::vector<AbstractMesh*>& renderList();
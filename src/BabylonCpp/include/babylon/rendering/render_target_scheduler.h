@@ -0,0 +1,101 @@
+#ifndef BABYLON_RENDERING_RENDER_TARGET_SCHEDULER_H
+#define BABYLON_RENDERING_RENDER_TARGET_SCHEDULER_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Frame budgeted scheduling of the render targets of a scene (shadow
+ * maps, mirrors, reflection probes, custom render targets).
+ *
+ * The cost of a render target is the number of faces it renders: 1 for a 2D
+ * render target, RenderTargetTexture::facesPerRender for a time sliced cube.
+ * Each frame, the render targets due for a refresh are ranked by their
+ * priority, weighted by the screen coverage of the mesh displaying them and
+ * by the number of frames since their last update, and rendered in that
+ * order until the face budget of the frame is spent. The deferred render
+ * targets stay due for the next frames, so that every render target is
+ * eventually updated.
+ *
+ * The render targets of priority 0 are rendered on every refresh and count
+ * against the budget. A render target which does not fit in the remaining
+ * budget is still rendered when it ranks first (a cube rendered at once may
+ * cost more than the whole budget), the cost of a frame thus exceeds the
+ * budget by at most one render target.
+ */
+class BABYLON_SHARED_EXPORT RenderTargetScheduler {
+
+public:
+  struct Request {
+    // Priority weighted by the screen contribution
+    float weight;
+    // Number of faces rendered
+    unsigned int cost;
+    // Number of frames since the last render
+    unsigned int staleness;
+    // Rendered regardless of the budget
+    bool required;
+  }; // end of struct Request
+
+public:
+  RenderTargetScheduler(unsigned int faceBudget = 6);
+  ~RenderTargetScheduler();
+
+  /**
+   * @brief Starts a new frame, restoring the face budget.
+   */
+  void beginFrame();
+
+  /**
+   * @brief Returns the render targets to render now for the camera, in their
+   * original order. The render targets due for a refresh which do not fit in
+   * the remaining budget of the frame are deferred.
+   */
+  std::vector<RenderTargetTexture*>
+  schedule(const std::vector<RenderTargetTexture*>& renderTargets,
+           Camera* camera);
+
+  /**
+   * @brief Removes the render target from the update history.
+   */
+  void removeRenderTarget(RenderTargetTexture* renderTarget);
+
+  /**
+   * @brief Returns the indices of the requests selected within the budget,
+   * in increasing order.
+   * @param budget Number of faces available, decreased by the cost of the
+   * selected requests (0 when exceeded).
+   */
+  static std::vector<size_t> Select(const std::vector<Request>& requests,
+                                    unsigned int& budget);
+
+  /**
+   * @brief Returns the fraction of the screen covered by the bounding sphere
+   * of the mesh, 0 when the mesh is disabled or out of the camera frustum.
+   */
+  static float ScreenContribution(AbstractMesh* mesh, Camera* camera);
+
+  // Statistics of the current frame
+  unsigned int renderedFaceCount() const;
+  size_t deferredCount() const;
+
+public:
+  /**
+   * Number of render target faces rendered per frame, 0 for no limit.
+   */
+  unsigned int faceBudget;
+
+private:
+  unsigned int _frameId;
+  unsigned int _remainingBudget;
+  unsigned int _renderedFaceCount;
+  size_t _deferredCount;
+  // Frame of the last render of the render targets
+  std::unordered_map<RenderTargetTexture*, unsigned int> _lastRenderFrames;
+
+}; // end of class RenderTargetScheduler
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_RENDERING_RENDER_TARGET_SCHEDULER_H
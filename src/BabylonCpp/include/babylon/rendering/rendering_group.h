@@ -60,7 +60,7 @@ public:
                             const std::vector<SubMesh*>& alphaTestSubMeshes)>&
            customRenderFunction,
          bool renderSprites, bool renderParticles,
-         const std::vector<AbstractMesh*> activeMeshes);
+         const std::vector<AbstractMesh*>& activeMeshes);
 
   /**
    * Build in function which can be applied to ensure meshes of a special queue
@@ -2,6 +2,7 @@
 #define BABYLON_RENDERING_RENDERING_MANAGER_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/math/color4.h>
 
 namespace BABYLON {
@@ -38,6 +39,16 @@ public:
   RenderingManager(Scene* scene);
   ~RenderingManager();
 
+  /**
+   * When enabled, opaque submeshes of regular meshes sharing the same geometry,
+   * material and submesh range are grouped at dispatch time and rendered with
+   * a single instanced draw call. Skinned, morphed and outlined meshes, meshes
+   * with render observers and meshes with their own instances are never
+   * grouped. The lights and per mesh uniforms of the first mesh of a group are
+   * used for all the instances.
+   */
+  bool autoInstancing;
+
   void
   render(std::function<void(const std::vector<SubMesh*>& opaqueSubMeshes,
                             const std::vector<SubMesh*>& transparentSubMeshes,
@@ -94,6 +105,24 @@ public:
 private:
   void _clearDepthStencilBuffer(bool depth = true, bool stencil = true);
   void _prepareRenderingGroup(unsigned int renderingGroupId);
+  /**
+   * @brief Adds the submesh to the automatic instancing group it belongs to.
+   * @returns True if the submesh is rendered as an instance of another submesh
+   * and must not be dispatched.
+   */
+  bool _dispatchAutoInstance(SubMesh* subMesh);
+  /**
+   * @brief Exposes the instances of each group to the submesh rendering the
+   * group, or hides them when expose is false.
+   */
+  void _exposeAutoInstances(bool expose);
+
+private:
+  // geometry, material, verticesStart, verticesCount, indexStart, indexCount,
+  // renderingGroupId, mesh flags, layerMask, light sources hash
+  using AutoInstancingKey
+    = std::tuple<Geometry*, Material*, unsigned int, size_t, unsigned int,
+                 size_t, unsigned int, unsigned int, unsigned int, size_t>;
 
 private:
   Scene* _scene;
@@ -110,6 +139,18 @@ private:
   std::vector<std::function<int(SubMesh* a, SubMesh* b)>>
     _customTransparentSortCompareFn;
   std::unique_ptr<RenderingGroupInfo> _renderinGroupInfo;
+  // Submesh rendering each automatic instancing group and its instances
+  using AutoInstancingGroup = std::pair<SubMesh*, FrameVector<AbstractMesh*>>;
+  using AutoInstancingGroups
+    = std::map<AutoInstancingKey, AutoInstancingGroup,
+               std::less<AutoInstancingKey>,
+               FrameAllocator<std::pair<const AutoInstancingKey,
+                                        AutoInstancingGroup>>>;
+
+private:
+  // Created in the frame arena by the first dispatch following a reset. The
+  // groups only hold arena memory, they are dropped without being destroyed.
+  AutoInstancingGroups* _autoInstancingGroups;
 
 }; // end of class RenderingManager
 
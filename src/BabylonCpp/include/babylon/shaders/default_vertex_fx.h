@@ -11,8 +11,12 @@ const char* defaultVertexShader
     "// Attributes\n"
     "attribute vec3 position;\n"
     "#ifdef NORMAL\n"
+    "#ifdef NORMAL_OCTAHEDRAL\n"
+    "attribute vec2 normal;\n"
+    "#else\n"
     "attribute vec3 normal;\n"
     "#endif\n"
+    "#endif\n"
     "#ifdef TANGENT\n"
     "attribute vec4 tangent;\n"
     "#endif\n"
@@ -88,15 +92,24 @@ const char* defaultVertexShader
     "#endif\n"
     "\n"
     "#include<logDepthDeclaration>\n"
+    "#include<vertexCompressionDeclaration>\n"
     "\n"
     "void main(void) {\n"
     "  vec3 positionUpdated = position;\n"
     "#ifdef NORMAL  \n"
+    "#ifdef NORMAL_OCTAHEDRAL\n"
+    "  vec3 normalUpdated = octahedralDecode(normal);\n"
+    "#else\n"
     "  vec3 normalUpdated = normal;\n"
     "#endif\n"
+    "#endif\n"
     "#ifdef TANGENT\n"
+    "#ifdef TANGENT_OCTAHEDRAL\n"
+    "  vec4 tangentUpdated = vec4(octahedralDecode(tangent.xy), tangent.z);\n"
+    "#else\n"
     "  vec4 tangentUpdated = tangent;\n"
     "#endif\n"
+    "#endif\n"
     "\n"
     "#include<morphTargetsVertex>[0..maxSimultaneousMorphTargets]\n"
     "\n"
@@ -8,7 +8,13 @@ extern const char* outlineVertexShader;
 const char* outlineVertexShader
   = "// Attribute\n"
     "attribute vec3 position;\n"
+    "#ifdef NORMAL_OCTAHEDRAL\n"
+    "attribute vec2 normal;\n"
+    "#else\n"
     "attribute vec3 normal;\n"
+    "#endif\n"
+    "\n"
+    "#include<vertexCompressionDeclaration>\n"
     "\n"
     "#include<bonesDeclaration>\n"
     "\n"
@@ -32,7 +38,11 @@ const char* outlineVertexShader
     "\n"
     "void main(void)\n"
     "{\n"
+    "#ifdef NORMAL_OCTAHEDRAL\n"
+    "  vec3 offsetPosition = position + octahedralDecode(normal) * offset;\n"
+    "#else\n"
     "  vec3 offsetPosition = position + normal * offset;\n"
+    "#endif\n"
     "\n"
     "#include<instancesVertex>\n"
     "#include<bonesVertex>\n"
@@ -22,6 +22,10 @@ const char* lightFragmentDeclaration
     "  uniform samplerCube shadowSampler{X};\n"
     "  #endif\n"
     "  uniform vec3 shadowsInfo{X};\n"
+    "  #ifdef SHADOWCSM{X}\n"
+    "  uniform mat4 cascadeMatrices{X}[4];\n"
+    "  uniform vec3 cascadeInfo{X};\n"
+    "  #endif\n"
     "  #endif\n"
     "  #ifdef SPOTLIGHT{X}\n"
     "  uniform vec4 vLightDirection{X};\n"
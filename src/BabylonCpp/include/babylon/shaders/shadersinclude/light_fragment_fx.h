@@ -21,24 +21,29 @@ const char* lightFragment
     "  #endif\n"
     "  #endif\n"
     "  #ifdef SHADOW{X}\n"
+    "  #if defined(SHADOWCSM{X})\n"
+    "  vec4 shadowPosition{X} = computeCascadePosition(vPositionW, cascadeMatrices{X}, cascadeInfo{X});\n"
+    "  #elif defined(SPOTLIGHT{X}) || defined(DIRLIGHT{X})\n"
+    "  vec4 shadowPosition{X} = vPositionFromLight{X};\n"
+    "  #endif\n"
     "  #ifdef SHADOWESM{X}\n"
     "  #if defined(POINTLIGHT{X})\n"
     "  shadow = computeShadowWithESMCube(light{X}.vLightData.xyz, shadowSampler{X}, light{X}.shadowsInfo.x, light{X}.shadowsInfo.z);\n"
     "  #else\n"
-    "  shadow = computeShadowWithESM(vPositionFromLight{X}, shadowSampler{X}, light{X}.shadowsInfo.x, light{X}.shadowsInfo.z);\n"
+    "  shadow = computeShadowWithESM(shadowPosition{X}, shadowSampler{X}, light{X}.shadowsInfo.x, light{X}.shadowsInfo.z);\n"
     "  #endif\n"
     "  #else  \n"
     "  #ifdef SHADOWPCF{X}\n"
     "  #if defined(POINTLIGHT{X})\n"
     "  shadow = computeShadowWithPCFCube(light{X}.vLightData.xyz, shadowSampler{X}, light{X}.shadowsInfo.y, light{X}.shadowsInfo.x);\n"
     "  #else\n"
-    "  shadow = computeShadowWithPCF(vPositionFromLight{X}, shadowSampler{X}, light{X}.shadowsInfo.y, light{X}.shadowsInfo.x);\n"
+    "  shadow = computeShadowWithPCF(shadowPosition{X}, shadowSampler{X}, light{X}.shadowsInfo.y, light{X}.shadowsInfo.x);\n"
     "  #endif\n"
     "  #else\n"
     "  #if defined(POINTLIGHT{X})\n"
     "  shadow = computeShadowCube(light{X}.vLightData.xyz, shadowSampler{X}, light{X}.shadowsInfo.x);\n"
     "  #else\n"
-    "  shadow = computeShadow(vPositionFromLight{X}, shadowSampler{X}, light{X}.shadowsInfo.x);\n"
+    "  shadow = computeShadow(shadowPosition{X}, shadowSampler{X}, light{X}.shadowsInfo.x);\n"
     "  #endif\n"
     "  #endif\n"
     "  #endif\n"
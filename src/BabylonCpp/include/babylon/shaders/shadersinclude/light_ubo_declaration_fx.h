@@ -28,6 +28,10 @@ const char* lightUboDeclaration
     "  #else\n"
     "  uniform samplerCube shadowSampler{X};\n"
     "  #endif\n"
+    "  #ifdef SHADOWCSM{X}\n"
+    "  uniform mat4 cascadeMatrices{X}[4];\n"
+    "  uniform vec3 cascadeInfo{X};\n"
+    "  #endif\n"
     "#endif\n"
     "\n"
     "#endif\n";
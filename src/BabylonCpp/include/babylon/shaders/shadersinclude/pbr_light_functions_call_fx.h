@@ -22,24 +22,29 @@ const char* pbrLightFunctionsCall
     "  #endif\n"
     "  \n"
     "  #ifdef SHADOW{X}\n"
+    "  #if defined(SHADOWCSM{X})\n"
+    "  vec4 shadowPosition{X} = computeCascadePosition(vPositionW, cascadeMatrices{X}, cascadeInfo{X});\n"
+    "  #elif defined(SPOTLIGHT{X}) || defined(DIRLIGHT{X})\n"
+    "  vec4 shadowPosition{X} = vPositionFromLight{X};\n"
+    "  #endif\n"
     "  #ifdef SHADOWESM{X}\n"
     "  #if defined(POINTLIGHT{X})\n"
     "  notShadowLevel = computeShadowWithESMCube(light{X}.vLightData.xyz, shadowSampler{X}, light{X}.shadowsInfo.x, light{X}.shadowsInfo.z);\n"
     "  #else\n"
-    "  notShadowLevel = computeShadowWithESM(light{X}.vPositionFromLight, shadowSampler{X}, light{X}.shadowsInfo.x, light{X}.shadowsInfo.z);\n"
+    "  notShadowLevel = computeShadowWithESM(shadowPosition{X}, shadowSampler{X}, light{X}.shadowsInfo.x, light{X}.shadowsInfo.z);\n"
     "  #endif\n"
     "  #else\n"
     "  #ifdef SHADOWPCF{X}\n"
     "  #if defined(POINTLIGHT{X})\n"
     "  notShadowLevel = computeShadowWithPCFCube(light{X}.vLightData.xyz, shadowSampler{X}, light{X}.shadowsInfo.y, light{X}.shadowsInfo.x);\n"
     "  #else\n"
-    "  notShadowLevel = computeShadowWithPCF(vPositionFromLight{X}, shadowSampler{X}, light{X}.shadowsInfo.y, light{X}.shadowsInfo.x);\n"
+    "  notShadowLevel = computeShadowWithPCF(shadowPosition{X}, shadowSampler{X}, light{X}.shadowsInfo.y, light{X}.shadowsInfo.x);\n"
     "  #endif\n"
     "  #else\n"
     "  #if defined(POINTLIGHT{X})\n"
     "  notShadowLevel = computeShadowCube(light{X}.vLightData.xyz, shadowSampler{X}, light{X}.shadowsInfo.x);\n"
     "  #else\n"
-    "  notShadowLevel = computeShadow(vPositionFromLight{X}, shadowSampler{X}, light{X}.shadowsInfo.x);\n"
+    "  notShadowLevel = computeShadow(shadowPosition{X}, shadowSampler{X}, light{X}.shadowsInfo.x);\n"
     "  #endif\n"
     "  #endif\n"
     "  #endif\n"
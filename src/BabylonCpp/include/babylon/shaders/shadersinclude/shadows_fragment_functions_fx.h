@@ -108,6 +108,31 @@ const char* shadowsFragmentFunctions
     "  #endif\n"
     "  }\n"
     "\n"
+    "  // Position in the cascaded shadow map atlas of the finest cascade\n"
+    "  // containing the fragment (cascadeInfo: cascade count, atlas grid size)\n"
+    "  vec4 computeCascadePosition(vec3 positionW, mat4 cascadeMatrices[4], vec3 cascadeInfo)\n"
+    "  {\n"
+    "  for (int i = 0; i < 4; i++)\n"
+    "  {\n"
+    "  if (float(i) >= cascadeInfo.x)\n"
+    "  {\n"
+    "  break;\n"
+    "  }\n"
+    "\n"
+    "  vec4 positionFromLight = cascadeMatrices[i] * vec4(positionW, 1.0);\n"
+    "  vec3 clipSpace = positionFromLight.xyz / positionFromLight.w;\n"
+    "  if (abs(clipSpace.x) < 0.99 && abs(clipSpace.y) < 0.99 && abs(clipSpace.z) < 1.0)\n"
+    "  {\n"
+    "  vec2 tile = vec2(mod(float(i), cascadeInfo.y), floor(float(i) / cascadeInfo.y));\n"
+    "  vec2 uv = (0.5 * clipSpace.xy + vec2(0.5) + tile) / cascadeInfo.yz;\n"
+    "  return vec4(2.0 * uv - vec2(1.0), clipSpace.z, 1.0);\n"
+    "  }\n"
+    "  }\n"
+    "\n"
+    "  // Out of the shadow map\n"
+    "  return vec4(2.0, 2.0, 0.0, 1.0);\n"
+    "  }\n"
+    "\n"
     "  float computeShadow(vec4 vPositionFromLight, sampler2D shadowSampler, float darkness)\n"
     "  {\n"
     "  vec3 depth = vPositionFromLight.xyz / vPositionFromLight.w;\n"
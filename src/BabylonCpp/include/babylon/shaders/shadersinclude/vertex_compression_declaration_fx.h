@@ -0,0 +1,23 @@
+﻿#ifndef BABYLON_SHADERS_SHADERS_INCLUDE_VERTEX_COMPRESSION_DECLARATION_FX_H
+#define BABYLON_SHADERS_SHADERS_INCLUDE_VERTEX_COMPRESSION_DECLARATION_FX_H
+
+namespace BABYLON {
+
+extern const char* vertexCompressionDeclaration;
+
+const char* vertexCompressionDeclaration
+  = "#if defined(NORMAL_OCTAHEDRAL) || defined(TANGENT_OCTAHEDRAL)\n"
+    "vec3 octahedralDecode(vec2 e)\n"
+    "{\n"
+    "  vec3 n = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));\n"
+    "  if (n.z < 0.0) {\n"
+    "    vec2 s = vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);\n"
+    "    n.xy = (1.0 - abs(n.yx)) * s;\n"
+    "  }\n"
+    "  return normalize(n);\n"
+    "}\n"
+    "#endif\n";
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SHADERS_SHADERS_INCLUDE_VERTEX_COMPRESSION_DECLARATION_FX_H
@@ -27,6 +27,20 @@ public:
 
   int size() const;
   void setSize(int value);
+
+  /**
+   * @brief Returns whether the sprite is static: its vertices are uploaded
+   * once, in a spatially sorted chunk culled as a whole.
+   */
+  bool isStatic() const;
+
+  /**
+   * @brief Sets whether the sprite is static. A static sprite which is
+   * modified has to be followed by a call to SpriteManager::markAsDirty().
+   * Playing an animation makes the sprite dynamic again.
+   */
+  void setStatic(bool value);
+
   void playAnimation(int from, int to, bool loop, millisecond_t delay,
                      const std::function<void()>& onAnimationEnd);
   void stopAnimation();
@@ -52,6 +66,7 @@ public:
   ActionManager* actionManager;
 
 private:
+  bool _isStatic;
   bool _animationStarted;
   bool _loopAnimation;
   int _fromIndex;
@@ -0,0 +1,58 @@
+#ifndef BABYLON_SPRITES_SPRITE_CHUNK_H
+#define BABYLON_SPRITES_SPRITE_CHUNK_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/math/plane.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Range of spatially close static sprites, stored contiguously in the
+ * vertex buffer of the sprite manager, with its bounding box for the frustum
+ * culling.
+ */
+struct BABYLON_SHARED_EXPORT SpriteChunk {
+
+  // First sprite and number of sprites of the chunk
+  size_t start;
+  size_t count;
+  // Bounding box of the sprites, including their size
+  Vector3 minimum;
+  Vector3 maximum;
+
+  /**
+   * @brief Returns whether the bounding box of the chunk intersects the
+   * frustum.
+   */
+  bool isInFrustum(const std::array<Plane, 6>& frustumPlanes) const;
+
+  /**
+   * @brief Sorts the sprites along a Z-order curve and splits them in chunks
+   * of chunkSize sprites.
+   * @param positions Position of each sprite
+   * @param radii Radius of the bounding sphere of each sprite
+   * @param order Filled with the sprite indices, in chunk order
+   * @return The chunks, referencing ranges of order
+   */
+  static std::vector<SpriteChunk> Build(const std::vector<Vector3>& positions,
+                                        const Float32Array& radii,
+                                        size_t chunkSize,
+                                        std::vector<size_t>& order);
+
+  /**
+   * @brief Tests the bounding spheres of sprites, stored as separate arrays
+   * of x, y, z and radius, against the frustum, 4 sprites at a time when SSE
+   * is available.
+   * @param visible Filled with the indices of the visible sprites
+   */
+  static void CullSpheres(const Float32Array& x, const Float32Array& y,
+                          const Float32Array& z, const Float32Array& radii,
+                          const std::array<Plane, 6>& frustumPlanes,
+                          std::vector<size_t>& visible);
+
+}; // end of struct SpriteChunk
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SPRITES_SPRITE_CHUNK_H
@@ -5,6 +5,7 @@
 #include <babylon/interfaces/idisposable.h>
 #include <babylon/materials/textures/texture_constants.h>
 #include <babylon/sprites/sprite.h>
+#include <babylon/sprites/sprite_chunk.h>
 #include <babylon/tools/observable.h>
 #include <babylon/tools/observer.h>
 
@@ -35,6 +36,29 @@ public:
   void render();
   void dispose(bool doNotRecurse = false) override;
 
+  /**
+   * @brief Flags the sprites to be sorted again in chunks and the static
+   * sprites to be uploaded again, after sprites were added, removed or
+   * modified while static.
+   */
+  void markAsDirty();
+
+  /**
+   * @brief Returns the chunks of static sprites.
+   */
+  const std::vector<SpriteChunk>& chunks() const;
+
+  /**
+   * @brief Returns the number of sprites drawn by the last render.
+   */
+  size_t visibleSpriteCount() const;
+
+  /**
+   * @brief Removes the sprite from the manager, deferred to the end of the
+   * rendering when called while the sprites are animated.
+   */
+  void _removeSprite(Sprite* sprite);
+
 protected:
   SpriteManager(const std::string& name, const std::string& imgUrl,
                 unsigned int capacity, const ISize& cellSize, Scene* scene,
@@ -43,8 +67,10 @@ protected:
                 = TextureConstants::TRILINEAR_SAMPLINGMODE);
 
 private:
-  void _appendSpriteVertex(size_t index, Sprite* sprite, int offsetX,
-                           int offsetY, int rowSize);
+  void _appendSpriteVertices(size_t index, const Sprite& sprite, int rowSize);
+  void _rebuildChunks(int rowSize);
+  void _updateDynamicSprites(int rowSize, const Matrix& viewMatrix,
+                             const std::array<Plane, 6>& frustumPlanes);
 
 public:
   std::string name;
@@ -56,6 +82,11 @@ public:
   float _epsilon;
   int cellWidth;
   int cellHeight;
+  // Number of static sprites per chunk, used when the chunks are rebuilt
+  size_t chunkSize;
+  // Draws the visible chunks and dynamic sprites from back to front, for the
+  // alpha blending
+  bool sortByDepth;
   /**
    * An event triggered when the manager is disposed.
    */
@@ -67,6 +98,22 @@ private:
   Texture* _spriteTexture;
   Scene* _scene;
   Float32Array _vertexData;
+  // Static sprites, in chunk order, then dynamic sprites
+  bool _isDirty;
+  bool _isAnimating;
+  int _rowSize;
+  std::vector<Sprite*> _staticSprites;
+  std::vector<Sprite*> _dynamicSprites;
+  std::vector<Sprite*> _disposedSprites;
+  std::vector<SpriteChunk> _chunks;
+  size_t _visibleSpriteCount;
+  // Bounding spheres of the dynamic sprites
+  Float32Array _dynamicX;
+  Float32Array _dynamicY;
+  Float32Array _dynamicZ;
+  Float32Array _dynamicRadii;
+  std::vector<size_t> _visibleDynamicSprites;
+  std::vector<std::pair<size_t, size_t>> _drawRanges;
   std::unique_ptr<Buffer> _buffer;
   std::unordered_map<std::string, std::unique_ptr<VertexBuffer>> _vertexBuffers;
   std::unordered_map<std::string, VertexBuffer*> _vertexBufferPtrs;
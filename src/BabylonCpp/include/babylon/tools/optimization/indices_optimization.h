@@ -0,0 +1,30 @@
+#ifndef BABYLON_TOOLS_OPTIMIZATION_INDICES_OPTIMIZATION_H
+#define BABYLON_TOOLS_OPTIMIZATION_INDICES_OPTIMIZATION_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/mesh/index_optimizer.h>
+#include <babylon/tools/optimization/scene_optimization.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Optimizes the indices and vertices of the geometries of the scene
+ * for the vertex cache, overdraw and vertex fetch. Lossless, the
+ * optimizations run on background threads.
+ */
+class BABYLON_SHARED_EXPORT IndicesOptimization : public SceneOptimization {
+
+public:
+  IndicesOptimization(int priority = 0);
+  ~IndicesOptimization();
+
+  bool apply(Scene* scene) override;
+
+public:
+  IndexOptimizer optimizer;
+
+}; // end of class IndicesOptimization
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TOOLS_OPTIMIZATION_INDICES_OPTIMIZATION_H
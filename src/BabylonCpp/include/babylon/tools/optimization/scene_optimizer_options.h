@@ -26,7 +26,7 @@ public:
                                                       = 60);
 
 public:
-  std::vector<SceneOptimization> optimizations;
+  std::vector<std::shared_ptr<SceneOptimization>> optimizations;
   float targetFrameRate;
   int trackerDuration;
 
@@ -7,11 +7,26 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 2> Bone::_tmpVecs{{Vector3::Zero(), Vector3::Zero()}};
-Quaternion Bone::_tmpQuat{Quaternion::Identity()};
-std::array<Matrix, 5> Bone::_tmpMats{{Matrix::Identity(), Matrix::Identity(),
-                                      Matrix::Identity(), Matrix::Identity(),
-                                      Matrix::Identity()}};
+std::array<Vector3, 2>& Bone::_tmpVecs()
+{
+  static thread_local std::array<Vector3, 2> tmpVecs{
+    {Vector3::Zero(), Vector3::Zero()}};
+  return tmpVecs;
+}
+
+Quaternion& Bone::_tmpQuat()
+{
+  static thread_local Quaternion tmpQuat{Quaternion::Identity()};
+  return tmpQuat;
+}
+
+std::array<Matrix, 5>& Bone::_tmpMats()
+{
+  static thread_local std::array<Matrix, 5> tmpMats{
+    {Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
+     Matrix::Identity(), Matrix::Identity()}};
+  return tmpMats;
+}
 
 Bone::Bone(const std::string& _name, Skeleton* skeleton, Bone* parentBone,
            const Matrix& matrix)
@@ -300,8 +315,8 @@ void Bone::translate(const Vector3& vec, Space space, AbstractMesh* mesh)
     }
 
     _skeleton->computeAbsoluteTransforms();
-    auto& tmat = Bone::_tmpMats[0];
-    auto& tvec = Bone::_tmpVecs[0];
+    auto& tmat = Bone::_tmpMats()[0];
+    auto& tvec = Bone::_tmpVecs()[0];
 
     if (mesh) {
       tmat.copyFrom(_parent->getAbsoluteTransform());
@@ -349,8 +364,8 @@ void Bone::setPosition(const Vector3& position, Space space, AbstractMesh* mesh)
 
     _skeleton->computeAbsoluteTransforms();
 
-    auto& tmat = Bone::_tmpMats[0];
-    auto& vec  = Bone::_tmpVecs[0];
+    auto& tmat = Bone::_tmpMats()[0];
+    auto& vec  = Bone::_tmpVecs()[0];
 
     if (mesh) {
       tmat.copyFrom(_parent->getAbsoluteTransform());
@@ -396,14 +411,14 @@ void Bone::setScale(float x, float y, float z, bool scaleChildren)
 void Bone::scale(float x, float y, float z, bool scaleChildren)
 {
   auto& locMat     = getLocalMatrix();
-  auto& origLocMat = Bone::_tmpMats[0];
+  auto& origLocMat = Bone::_tmpMats()[0];
   origLocMat.copyFrom(locMat);
 
-  auto& origLocMatInv = Bone::_tmpMats[1];
+  auto& origLocMatInv = Bone::_tmpMats()[1];
   origLocMatInv.copyFrom(origLocMat);
   origLocMatInv.invert();
 
-  auto& scaleMat = Bone::_tmpMats[2];
+  auto& scaleMat = Bone::_tmpMats()[2];
   Matrix::FromValuesToRef(x, 0, 0, 0, // M11-M14
                           0, y, 0, 0, // M21-M24
                           0, 0, z, 0, // M31-M34
@@ -453,10 +468,10 @@ void Bone::scale(float x, float y, float z, bool scaleChildren)
 void Bone::setYawPitchRoll(float yaw, float pitch, float roll, Space space,
                            AbstractMesh* mesh)
 {
-  auto& rotMat = Bone::_tmpMats[0];
+  auto& rotMat = Bone::_tmpMats()[0];
   Matrix::RotationYawPitchRollToRef(yaw, pitch, roll, rotMat);
 
-  auto& rotMatInv = Bone::_tmpMats[1];
+  auto& rotMatInv = Bone::_tmpMats()[1];
 
   _getNegativeRotationToRef(rotMatInv, space, mesh);
 
@@ -467,7 +482,7 @@ void Bone::setYawPitchRoll(float yaw, float pitch, float roll, Space space,
 
 void Bone::rotate(Vector3& axis, float amount, Space space, AbstractMesh* mesh)
 {
-  auto& rmat = Bone::_tmpMats[0];
+  auto& rmat = Bone::_tmpMats()[0];
   rmat.m[12] = 0.f;
   rmat.m[13] = 0.f;
   rmat.m[14] = 0.f;
@@ -480,9 +495,9 @@ void Bone::rotate(Vector3& axis, float amount, Space space, AbstractMesh* mesh)
 void Bone::setAxisAngle(Vector3& axis, float angle, Space space,
                         AbstractMesh* mesh)
 {
-  auto& rotMat = Bone::_tmpMats[0];
+  auto& rotMat = Bone::_tmpMats()[0];
   Matrix::RotationAxisToRef(axis, angle, rotMat);
-  auto& rotMatInv = Bone::_tmpMats[1];
+  auto& rotMatInv = Bone::_tmpMats()[1];
 
   _getNegativeRotationToRef(rotMatInv, space, mesh);
 
@@ -498,11 +513,11 @@ void Bone::setRotation(const Vector3& rotation, Space space, AbstractMesh* mesh)
 void Bone::setRotationQuaternion(const Quaternion& quat, Space space,
                                  AbstractMesh* mesh)
 {
-  auto& rotMatInv = Bone::_tmpMats[0];
+  auto& rotMatInv = Bone::_tmpMats()[0];
 
   _getNegativeRotationToRef(rotMatInv, space, mesh);
 
-  auto& rotMat = Bone::_tmpMats[1];
+  auto& rotMat = Bone::_tmpMats()[1];
   Matrix::FromQuaternionToRef(quat, rotMat);
 
   rotMatInv.multiplyToRef(rotMat, rotMat);
@@ -513,11 +528,11 @@ void Bone::setRotationQuaternion(const Quaternion& quat, Space space,
 void Bone::setRotationMatrix(const Matrix& rotMat, Space space,
                              AbstractMesh* mesh)
 {
-  auto& rotMatInv = Bone::_tmpMats[0];
+  auto& rotMatInv = Bone::_tmpMats()[0];
 
   _getNegativeRotationToRef(rotMatInv, space, mesh);
 
-  auto& rotMat2 = Bone::_tmpMats[1];
+  auto& rotMat2 = Bone::_tmpMats()[1];
   rotMat2.copyFrom(rotMat);
 
   rotMatInv.multiplyToRef(rotMat, rotMat2);
@@ -533,8 +548,8 @@ void Bone::_rotateWithMatrix(const Matrix& rmat, Space space,
   float ly             = lmat.m[13];
   float lz             = lmat.m[14];
   auto parent          = getParent();
-  auto& parentScale    = Bone::_tmpMats[3];
-  auto& parentScaleInv = Bone::_tmpMats[4];
+  auto& parentScale    = Bone::_tmpMats()[3];
+  auto& parentScaleInv = Bone::_tmpMats()[4];
 
   if (parent) {
     if (space == Space::WORLD) {
@@ -582,13 +597,13 @@ void Bone::_getNegativeRotationToRef(Matrix& rotMatInv, Space space,
                                      AbstractMesh* mesh)
 {
   if (space == Space::WORLD) {
-    auto& scaleMatrix = Bone::_tmpMats[2];
+    auto& scaleMatrix = Bone::_tmpMats()[2];
     scaleMatrix.copyFrom(_scaleMatrix);
     rotMatInv.copyFrom(getAbsoluteTransform());
 
     if (mesh) {
       rotMatInv.multiplyToRef(*mesh->getWorldMatrix(), rotMatInv);
-      auto& meshScale = Bone::_tmpMats[3];
+      auto& meshScale = Bone::_tmpMats()[3];
       Matrix::ScalingToRef(mesh->scaling().x, mesh->scaling().y,
                            mesh->scaling().z, meshScale);
       scaleMatrix.multiplyToRef(meshScale, scaleMatrix);
@@ -601,11 +616,11 @@ void Bone::_getNegativeRotationToRef(Matrix& rotMatInv, Space space,
   else {
     rotMatInv.copyFrom(getLocalMatrix());
     rotMatInv.invert();
-    auto& scaleMatrix = Bone::_tmpMats[2];
+    auto& scaleMatrix = Bone::_tmpMats()[2];
     scaleMatrix.copyFrom(_scaleMatrix);
 
     if (_parent) {
-      auto& pscaleMatrix = Bone::_tmpMats[3];
+      auto& pscaleMatrix = Bone::_tmpMats()[3];
       pscaleMatrix.copyFrom(_parent->_scaleMatrix);
       pscaleMatrix.invert();
       pscaleMatrix.multiplyToRef(rotMatInv, rotMatInv);
@@ -659,7 +674,7 @@ void Bone::getPositionToRef(Vector3& result, Space space,
 
     _skeleton->computeAbsoluteTransforms();
 
-    auto& tmat = Bone::_tmpMats[0];
+    auto& tmat = Bone::_tmpMats()[0];
 
     if (mesh) {
       tmat.copyFrom(getAbsoluteTransform());
@@ -762,7 +777,7 @@ void Bone::getDirectionToRef(const Vector3& localAxis, Vector3& result,
 
   _skeleton->computeAbsoluteTransforms();
 
-  auto& mat = Bone::_tmpMats[0];
+  auto& mat = Bone::_tmpMats()[0];
 
   mat.copyFrom(getAbsoluteTransform());
 
@@ -787,7 +802,7 @@ Vector3 Bone::getRotation(Space space, AbstractMesh* mesh) const
 void Bone::getRotationToRef(Vector3& result, Space space,
                             AbstractMesh* mesh) const
 {
-  auto& quat = Bone::_tmpQuat;
+  auto& quat = Bone::_tmpQuat();
 
   getRotationQuaternionToRef(quat, space, mesh);
 
@@ -807,10 +822,11 @@ void Bone::getRotationQuaternionToRef(Quaternion& result, Space space,
                                       AbstractMesh* mesh) const
 {
   if (space == Space::LOCAL) {
-    getLocalMatrix().decompose(Bone::_tmpVecs[0], result, Bone::_tmpVecs[1]);
+    auto& tmpVecs = Bone::_tmpVecs();
+    getLocalMatrix().decompose(tmpVecs[0], result, tmpVecs[1]);
   }
   else {
-    auto& mat = Bone::_tmpMats[0];
+    auto& mat = Bone::_tmpMats()[0];
     auto amat = getAbsoluteTransform();
 
     if (mesh) {
@@ -824,7 +840,7 @@ void Bone::getRotationQuaternionToRef(Quaternion& result, Space space,
     mat.m[1] *= _scalingDeterminant;
     mat.m[2] *= _scalingDeterminant;
 
-    mat.decompose(Bone::_tmpVecs[0], result, Bone::_tmpVecs[1]);
+    mat.decompose(Bone::_tmpVecs()[0], result, Bone::_tmpVecs()[1]);
   }
 }
 
@@ -844,7 +860,7 @@ void Bone::getRotationMatrixToRef(Matrix& result, Space space,
     getLocalMatrix().getRotationMatrixToRef(result);
   }
   else {
-    auto& mat = Bone::_tmpMats[0];
+    auto& mat = Bone::_tmpMats()[0];
     auto amat = getAbsoluteTransform();
 
     if (mesh) {
@@ -885,7 +901,7 @@ void Bone::getAbsolutePositionFromLocalToRef(const Vector3& position,
 
   _skeleton->computeAbsoluteTransforms();
 
-  auto& tmat = Bone::_tmpMats[0];
+  auto& tmat = Bone::_tmpMats()[0];
 
   if (mesh) {
     tmat.copyFrom(getAbsoluteTransform());
@@ -923,7 +939,7 @@ void Bone::getLocalPositionFromAbsoluteToRef(const Vector3& position,
 
   _skeleton->computeAbsoluteTransforms();
 
-  auto tmat = Bone::_tmpMats[0];
+  auto tmat = Bone::_tmpMats()[0];
 
   tmat.copyFrom(getAbsoluteTransform());
 
@@ -6,12 +6,26 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 6> BoneIKController::_tmpVecs{
-  {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero(), Vector3::Zero()}};
-Quaternion BoneIKController::_tmpQuat{Quaternion::Identity()};
-std::array<Matrix, 2> BoneIKController::_tmpMats{
-  {Matrix::Identity(), Matrix::Identity()}};
+std::array<Vector3, 6>& BoneIKController::_tmpVecs()
+{
+  static thread_local std::array<Vector3, 6> tmpVecs{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero()}};
+  return tmpVecs;
+}
+
+Quaternion& BoneIKController::_tmpQuat()
+{
+  static thread_local Quaternion tmpQuat{Quaternion::Identity()};
+  return tmpQuat;
+}
+
+std::array<Matrix, 2>& BoneIKController::_tmpMats()
+{
+  static thread_local std::array<Matrix, 2> tmpMats{
+    {Matrix::Identity(), Matrix::Identity()}};
+  return tmpMats;
+}
 
 BoneIKController::BoneIKController(AbstractMesh* iMesh, Bone* bone,
                                    AbstractMesh* iTargetMesh,
@@ -134,8 +148,8 @@ void BoneIKController::update()
   Vector3& target     = targetPosition;
   Vector3& poleTarget = poleTargetPosition;
 
-  auto& mat1 = BoneIKController::_tmpMats[0];
-  auto& mat2 = BoneIKController::_tmpMats[1];
+  auto& mat1 = BoneIKController::_tmpMats()[0];
+  auto& mat2 = BoneIKController::_tmpMats()[1];
 
   if (targetMesh) {
     target.copyFrom(*targetMesh->getAbsolutePosition());
@@ -150,13 +164,13 @@ void BoneIKController::update()
       poleTargetLocalOffset, *poleTargetMesh->getWorldMatrix(), poleTarget);
   }
 
-  auto& bonePos = BoneIKController::_tmpVecs[0];
-  auto& zaxis   = BoneIKController::_tmpVecs[1];
-  auto& xaxis   = BoneIKController::_tmpVecs[2];
-  auto& yaxis   = BoneIKController::_tmpVecs[3];
-  auto& upAxis  = BoneIKController::_tmpVecs[4];
+  auto& bonePos = BoneIKController::_tmpVecs()[0];
+  auto& zaxis   = BoneIKController::_tmpVecs()[1];
+  auto& xaxis   = BoneIKController::_tmpVecs()[2];
+  auto& yaxis   = BoneIKController::_tmpVecs()[3];
+  auto& upAxis  = BoneIKController::_tmpVecs()[4];
 
-  auto& _tmpQuat = BoneIKController::_tmpQuat;
+  auto& _tmpQuat = BoneIKController::_tmpQuat();
 
   bone1->getAbsolutePositionToRef(mesh, bonePos);
 
@@ -223,7 +237,7 @@ void BoneIKController::update()
     mat1.multiplyToRef(mat2, mat1);
   }
   else {
-    auto& _tmpVec = BoneIKController::_tmpVecs[5];
+    auto& _tmpVec = BoneIKController::_tmpVecs()[5];
 
     _tmpVec.copyFrom(_bendAxis);
     _tmpVec.x *= -1.f;
@@ -6,14 +6,28 @@
 
 namespace BABYLON {
 
-std::array<Vector3, 10> BoneLookController::_tmpVecs{
-  {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero(), Vector3::Zero()}};
-Quaternion BoneLookController::_tmpQuat{Quaternion::Identity()};
-std::array<Matrix, 5> BoneLookController::_tmpMats{
-  {Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
-   Matrix::Identity(), Matrix::Identity()}};
+std::array<Vector3, 10>& BoneLookController::_tmpVecs()
+{
+  static thread_local std::array<Vector3, 10> tmpVecs{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero()}};
+  return tmpVecs;
+}
+
+Quaternion& BoneLookController::_tmpQuat()
+{
+  static thread_local Quaternion tmpQuat{Quaternion::Identity()};
+  return tmpQuat;
+}
+
+std::array<Matrix, 5>& BoneLookController::_tmpMats()
+{
+  static thread_local std::array<Matrix, 5> tmpMats{
+    {Matrix::Identity(), Matrix::Identity(), Matrix::Identity(),
+     Matrix::Identity(), Matrix::Identity()}};
+  return tmpMats;
+}
 
 BoneLookController::BoneLookController(
   AbstractMesh* iMesh, Bone* iBone, const Vector3& iTarget,
@@ -188,15 +202,15 @@ void BoneLookController::update()
     return;
   }
 
-  auto& bonePos = BoneLookController::_tmpVecs[0];
+  auto& bonePos = BoneLookController::_tmpVecs()[0];
   bone->getAbsolutePositionToRef(mesh, bonePos);
 
-  auto& _tmpMat1 = BoneLookController::_tmpMats[0];
-  auto& _tmpMat2 = BoneLookController::_tmpMats[1];
+  auto& _tmpMat1 = BoneLookController::_tmpMats()[0];
+  auto& _tmpMat2 = BoneLookController::_tmpMats()[1];
 
   auto parentBone = bone->getParent();
 
-  auto& upAxis = BoneLookController::_tmpVecs[1];
+  auto& upAxis = BoneLookController::_tmpVecs()[1];
   upAxis.copyFrom(upAxis);
 
   if (upAxisSpace == Space::BONE) {
@@ -227,8 +241,8 @@ void BoneLookController::update()
 
   if (checkYaw || checkPitch) {
 
-    auto& spaceMat    = BoneLookController::_tmpMats[2];
-    auto& spaceMatInv = BoneLookController::_tmpMats[3];
+    auto& spaceMat    = BoneLookController::_tmpMats()[2];
+    auto& spaceMatInv = BoneLookController::_tmpMats()[3];
 
     if (upAxisSpace == Space::BONE && upAxis.y == 1.f) {
       parentBone->getRotationMatrixToRef(spaceMat, Space::WORLD, mesh);
@@ -238,7 +252,7 @@ void BoneLookController::update()
     }
     else {
 
-      auto& forwardAxis = BoneLookController::_tmpVecs[2];
+      auto& forwardAxis = BoneLookController::_tmpVecs()[2];
       forwardAxis.copyFrom(_fowardAxis);
 
       if (_transformYawPitch) {
@@ -266,7 +280,7 @@ void BoneLookController::update()
     float xzlen   = 0.f;
 
     if (checkPitch) {
-      auto& localTarget = BoneLookController::_tmpVecs[3];
+      auto& localTarget = BoneLookController::_tmpVecs()[3];
       target.subtractToRef(bonePos, localTarget);
       Vector3::TransformCoordinatesToRef(localTarget, spaceMatInv, localTarget);
 
@@ -292,7 +306,7 @@ void BoneLookController::update()
     }
 
     if (checkYaw) {
-      auto& localTarget = BoneLookController::_tmpVecs[4];
+      auto& localTarget = BoneLookController::_tmpVecs()[4];
       target.subtractToRef(bonePos, localTarget);
       Vector3::TransformCoordinatesToRef(localTarget, spaceMatInv, localTarget);
 
@@ -335,14 +349,14 @@ void BoneLookController::update()
 
       if (_slerping && _yawRange > Math::PI) {
         // are we going to be crossing into the min/max region?
-        auto& boneFwd = BoneLookController::_tmpVecs[8];
+        auto& boneFwd = BoneLookController::_tmpVecs()[8];
         boneFwd.copyFrom(Axis::Z);
         if (_transformYawPitch) {
           Vector3::TransformCoordinatesToRef(boneFwd, _transformYawPitchInv,
                                              boneFwd);
         }
 
-        auto& boneRotMat = BoneLookController::_tmpMats[4];
+        auto& boneRotMat = BoneLookController::_tmpMats()[4];
         _boneQuat.toRotationMatrix(boneRotMat);
         mesh->getWorldMatrix()->multiplyToRef(boneRotMat, boneRotMat);
         Vector3::TransformCoordinatesToRef(boneFwd, boneRotMat, boneFwd);
@@ -384,10 +398,10 @@ void BoneLookController::update()
     }
   }
 
-  auto& zaxis   = BoneLookController::_tmpVecs[5];
-  auto xaxis    = BoneLookController::_tmpVecs[6];
-  auto yaxis    = BoneLookController::_tmpVecs[7];
-  auto _tmpQuat = BoneLookController::_tmpQuat;
+  auto& zaxis   = BoneLookController::_tmpVecs()[5];
+  auto xaxis    = BoneLookController::_tmpVecs()[6];
+  auto yaxis    = BoneLookController::_tmpVecs()[7];
+  auto _tmpQuat = BoneLookController::_tmpQuat();
 
   target.subtractToRef(bonePos, zaxis);
   zaxis.normalize();
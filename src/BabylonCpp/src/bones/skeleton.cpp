@@ -228,6 +228,11 @@ Skeleton::beginAnimation(const std::string& _name, bool /*loop*/,
 }
 
 // Methods
+bool Skeleton::isDirty() const
+{
+  return _isDirty;
+}
+
 void Skeleton::_markAsDirty()
 {
   _isDirty = true;
@@ -301,7 +306,7 @@ void Skeleton::prepare()
         // Prepare bones
         for (auto& bone : bones) {
           if (!bone->getParent()) {
-            auto& tmpMatrix = Tmp::MatrixArray[0];
+            auto& tmpMatrix = Tmp::MatrixArray()[0];
             auto& matrix    = bone->getBaseMatrix();
             matrix.multiplyToRef(poseMatrix, tmpMatrix);
             bone->_updateDifferenceMatrix(tmpMatrix);
@@ -321,8 +326,6 @@ void Skeleton::prepare()
   }
 
   _isDirty = false;
-
-  _scene->_activeBones.addCount(bones.size(), false);
 }
 
 std::vector<IAnimatable*> Skeleton::getAnimatables()
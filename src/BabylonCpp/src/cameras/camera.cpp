@@ -40,6 +40,7 @@ Camera::Camera(const std::string& iName, const Vector3& iPosition, Scene* scene)
     , layerMask{0x0FFFFFFF}
     , fovMode{Camera::FOVMODE_VERTICAL_FIXED}
     , cameraRigMode{Camera::RIG_MODE_NONE}
+    , _cameraRigParams{}
     , _projectionMatrix{Matrix()}
     , _computedViewMatrix{Matrix::Identity()}
     , _doNotComputeProjectionMatrix{false}
@@ -0,0 +1,127 @@
+#include <babylon/core/frame_arena.h>
+
+namespace BABYLON {
+
+constexpr size_t FrameArena::ChunkSize;
+constexpr size_t FrameArena::TrimFrameCount;
+
+FrameArena& FrameArena::Current()
+{
+  static thread_local FrameArena arena;
+  return arena;
+}
+
+FrameArena::FrameArena()
+    : _currentChunk{0}
+    , _offset{0}
+    , _allocationCount{0}
+    , _bytesAllocated{0}
+    , _heapAllocationCount{0}
+    , _quietFrameCount{0}
+    , _quietFramePeak{0}
+{
+}
+
+FrameArena::~FrameArena()
+{
+}
+
+void* FrameArena::allocate(size_t byteLength, size_t alignment)
+{
+  while (true) {
+    if (_currentChunk < _chunks.size()) {
+      auto& chunk          = _chunks[_currentChunk];
+      const auto address   = reinterpret_cast<uintptr_t>(chunk.data.get());
+      const size_t padding = (alignment - (address + _offset) % alignment)
+                             % alignment;
+      if (_offset + padding + byteLength <= chunk.size) {
+        auto data = chunk.data.get() + _offset + padding;
+        _offset += padding + byteLength;
+        ++_allocationCount;
+        _bytesAllocated += byteLength;
+        return data;
+      }
+      // Chunks left by a frame larger than the previous ones
+      if (_currentChunk + 1 < _chunks.size()) {
+        ++_currentChunk;
+        _offset = 0;
+        continue;
+      }
+    }
+
+    // Grow geometrically so that a frame only needs a few chunks
+    const size_t minSize = byteLength + alignment;
+    _addChunk(std::max(_chunks.empty() ? size_t(ChunkSize) : capacity(),
+                       minSize));
+    _currentChunk = _chunks.size() - 1;
+    _offset       = 0;
+  }
+}
+
+void FrameArena::deallocate(void* /*data*/, size_t /*byteLength*/)
+{
+}
+
+void FrameArena::reset()
+{
+  const auto currentCapacity = capacity();
+  auto size                  = currentCapacity;
+
+  // Give back the capacity left by a spike once the frames stay well below it
+  if (size > ChunkSize && _bytesAllocated <= size / 4) {
+    _quietFramePeak = std::max(_quietFramePeak, _bytesAllocated);
+    if (++_quietFrameCount >= TrimFrameCount) {
+      size = std::max(size_t(ChunkSize), 2 * _quietFramePeak);
+      _quietFrameCount = 0;
+      _quietFramePeak  = 0;
+    }
+  }
+  else {
+    _quietFrameCount = 0;
+    _quietFramePeak  = 0;
+  }
+
+  // Merge the chunks so that the next frame fits in a single one
+  if (_chunks.size() > 1 || size != currentCapacity) {
+    _chunks.clear();
+    _addChunk(size);
+  }
+
+  _currentChunk    = 0;
+  _offset          = 0;
+  _allocationCount = 0;
+  _bytesAllocated  = 0;
+}
+
+size_t FrameArena::allocationCount() const
+{
+  return _allocationCount;
+}
+
+size_t FrameArena::bytesAllocated() const
+{
+  return _bytesAllocated;
+}
+
+size_t FrameArena::heapAllocationCount() const
+{
+  return _heapAllocationCount;
+}
+
+size_t FrameArena::capacity() const
+{
+  size_t size = 0;
+  for (const auto& chunk : _chunks) {
+    size += chunk.size;
+  }
+  return size;
+}
+
+void FrameArena::_addChunk(size_t size)
+{
+  _chunks.emplace_back(Chunk{std::unique_ptr<uint8_t[]>(new uint8_t[size]),
+                             size});
+  ++_heapAllocationCount;
+}
+
+} // end of namespace BABYLON
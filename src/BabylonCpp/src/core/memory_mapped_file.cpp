@@ -0,0 +1,87 @@
+#include <babylon/core/memory_mapped_file.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace BABYLON {
+
+MemoryMappedFile::MemoryMappedFile()
+    : _data{nullptr}, _size{0}, _isMapped{false}
+{
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+#ifndef _WIN32
+  if (_isMapped) {
+    ::munmap(const_cast<uint8_t*>(_data), _size);
+  }
+#endif
+}
+
+std::unique_ptr<MemoryMappedFile>
+MemoryMappedFile::Open(const std::string& filename)
+{
+  std::unique_ptr<MemoryMappedFile> file(new MemoryMappedFile());
+
+#ifndef _WIN32
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat fileStat;
+  if (::fstat(fd, &fileStat) != 0) {
+    ::close(fd);
+    return nullptr;
+  }
+  file->_size = static_cast<size_t>(fileStat.st_size);
+  if (file->_size > 0) {
+    void* data
+      = ::mmap(nullptr, file->_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data != MAP_FAILED) {
+      file->_data     = static_cast<const uint8_t*>(data);
+      file->_isMapped = true;
+    }
+  }
+  // The mapping stays valid once the descriptor is closed
+  ::close(fd);
+  if (file->_isMapped || file->_size == 0) {
+    return file;
+  }
+#endif
+
+  std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+  if (!stream) {
+    return nullptr;
+  }
+  file->_buffer.resize(static_cast<size_t>(stream.tellg()));
+  stream.seekg(0, std::ios::beg);
+  if (!stream.read(reinterpret_cast<char*>(file->_buffer.data()),
+                   static_cast<std::streamsize>(file->_buffer.size()))) {
+    return nullptr;
+  }
+  file->_data = file->_buffer.data();
+  file->_size = file->_buffer.size();
+  return file;
+}
+
+const uint8_t* MemoryMappedFile::data() const
+{
+  return _data;
+}
+
+size_t MemoryMappedFile::size() const
+{
+  return _size;
+}
+
+bool MemoryMappedFile::isMapped() const
+{
+  return _isMapped;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,118 @@
+#include <babylon/core/worker_pool.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Progress of a run, shared with the workers helping it
+struct RunState {
+  RunState(size_t iTaskCount, const std::function<void(size_t index)>& iTask)
+      : taskCount{iTaskCount}, task{iTask}, nextIndex{0}, doneCount{0}
+  {
+  }
+
+  const size_t taskCount;
+  // Only called while tasks are left, i.e. before the run returns
+  const std::function<void(size_t index)>& task;
+  std::atomic<size_t> nextIndex;
+  std::atomic<size_t> doneCount;
+  std::mutex mutex;
+  std::condition_variable done;
+  std::exception_ptr exception;
+}; // end of struct RunState
+
+void runTasks(RunState& state)
+{
+  for (size_t index = state.nextIndex++; index < state.taskCount;
+       index        = state.nextIndex++) {
+    try {
+      state.task(index);
+    }
+    catch (...) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (!state.exception) {
+        state.exception = std::current_exception();
+      }
+    }
+    if (++state.doneCount == state.taskCount) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      state.done.notify_all();
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+WorkerPool& WorkerPool::Shared()
+{
+  static WorkerPool pool(std::max(1u, std::thread::hardware_concurrency())
+                         - 1);
+  return pool;
+}
+
+WorkerPool::WorkerPool(size_t workerCount)
+{
+  _workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    _workers.emplace_back(&WorkerPool::_work, this);
+  }
+}
+
+WorkerPool::~WorkerPool()
+{
+  for (size_t i = 0; i < _workers.size(); ++i) {
+    _queue.push(nullptr);
+  }
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t WorkerPool::workerCount() const
+{
+  return _workers.size();
+}
+
+void WorkerPool::run(size_t taskCount, size_t maxThreads,
+                     const std::function<void(size_t index)>& task)
+{
+  if (taskCount == 0) {
+    return;
+  }
+
+  auto state = std::make_shared<RunState>(taskCount, task);
+
+  // Workers still busy with other runs join this one once free, if tasks are
+  // left by then
+  const size_t helperCount
+    = std::min({(maxThreads > 0) ? maxThreads - 1 : 0, taskCount - 1,
+                _workers.size()});
+  for (size_t i = 0; i < helperCount; ++i) {
+    _queue.push([state]() { runTasks(*state); });
+  }
+  runTasks(*state);
+
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->done.wait(
+      lock, [&state]() { return state->doneCount == state->taskCount; });
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+void WorkerPool::_work()
+{
+  while (true) {
+    std::function<void()> callback;
+    _queue.waitAndPop(callback);
+    if (!callback) {
+      return;
+    }
+    callback();
+  }
+}
+
+} // end of namespace BABYLON
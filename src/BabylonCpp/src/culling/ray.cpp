@@ -280,7 +280,7 @@ std::unique_ptr<float> Ray::intersectsPlane(const Plane& plane)
 
 PickingInfo Ray::intersectsMesh(AbstractMesh* mesh, bool fastCheck)
 {
-  auto& tm = Tmp::MatrixArray[0];
+  auto& tm = Tmp::MatrixArray()[0];
 
   mesh->getWorldMatrix()->invertToRef(tm);
 
@@ -0,0 +1,244 @@
+#include <babylon/culling/spatial_hash_grid.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Cell coordinates are stored on 21 bits per axis
+constexpr int CellLimit = 1 << 20;
+
+int cellCoordinate(float value, float cellSize)
+{
+  const float cell = std::floor(value / cellSize);
+  return cell < -CellLimit ?
+           -CellLimit :
+           cell >= CellLimit ? CellLimit - 1 : static_cast<int>(cell);
+}
+
+} // end of anonymous namespace
+
+SpatialHashGrid::SpatialHashGrid(float cellSize, size_t maxCellsPerItem)
+    : _cellSize{cellSize > 0.f ? cellSize : 1.f}
+    , _maxCellsPerItem{std::max(maxCellsPerItem, static_cast<size_t>(1))}
+    , _size{0}
+    , _stamp{0}
+{
+}
+
+SpatialHashGrid::~SpatialHashGrid()
+{
+}
+
+bool SpatialHashGrid::update(size_t id, const Vector3& center, float radius)
+{
+  if (id >= _items.size()) {
+    _items.resize(id + 1);
+    _stamps.resize(id + 1, 0);
+  }
+
+  auto& item = _items[id];
+  std::array<int, 6> cells;
+  const bool large = !_cellRange(center, radius, cells);
+  const bool moved = !item.registered || item.large != large
+                     || (!large && item.cells != cells);
+
+  if (moved) {
+    if (item.registered) {
+      _unlink(id);
+    }
+    else {
+      ++_size;
+    }
+    item.large      = large;
+    item.cells      = cells;
+    item.registered = true;
+    _link(id);
+  }
+  item.center = center;
+  item.radius = radius;
+
+  return moved;
+}
+
+void SpatialHashGrid::remove(size_t id)
+{
+  if (!contains(id)) {
+    return;
+  }
+
+  _unlink(id);
+  _items[id].registered = false;
+  --_size;
+}
+
+bool SpatialHashGrid::contains(size_t id) const
+{
+  return id < _items.size() && _items[id].registered;
+}
+
+void SpatialHashGrid::query(const Vector3& center, float radius,
+                            std::vector<size_t>& result) const
+{
+  result.clear();
+  if (_size == 0) {
+    return;
+  }
+
+  std::array<int, 6> cells;
+  if (!_cellRange(center, radius, cells)) {
+    // Query larger than the grid resolution: brute force
+    for (size_t id = 0; id < _items.size(); ++id) {
+      if (_items[id].registered && _overlaps(_items[id], center, radius)) {
+        result.emplace_back(id);
+      }
+    }
+    return;
+  }
+
+  if (++_stamp == 0) {
+    std::fill(_stamps.begin(), _stamps.end(), 0);
+    _stamp = 1;
+  }
+
+  for (auto id : _largeItems) {
+    if (_overlaps(_items[id], center, radius)) {
+      result.emplace_back(id);
+    }
+  }
+
+  for (int x = cells[0]; x <= cells[3]; ++x) {
+    for (int y = cells[1]; y <= cells[4]; ++y) {
+      for (int z = cells[2]; z <= cells[5]; ++z) {
+        const auto it = _cells.find(_key(x, y, z));
+        if (it == _cells.end()) {
+          continue;
+        }
+        for (auto id : it->second) {
+          if (_stamps[id] == _stamp) {
+            continue;
+          }
+          _stamps[id] = _stamp;
+          if (_overlaps(_items[id], center, radius)) {
+            result.emplace_back(id);
+          }
+        }
+      }
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+}
+
+size_t SpatialHashGrid::size() const
+{
+  return _size;
+}
+
+size_t SpatialHashGrid::cellCount() const
+{
+  return _cells.size();
+}
+
+void SpatialHashGrid::clear()
+{
+  _items.clear();
+  _cells.clear();
+  _largeItems.clear();
+  _stamps.clear();
+  _size = 0;
+}
+
+float SpatialHashGrid::cellSize() const
+{
+  return _cellSize;
+}
+
+bool SpatialHashGrid::_cellRange(const Vector3& center, float radius,
+                                 std::array<int, 6>& cells) const
+{
+  if (!std::isfinite(center.x) || !std::isfinite(center.y)
+      || !std::isfinite(center.z) || !std::isfinite(radius)) {
+    return false;
+  }
+
+  radius = std::max(radius, 0.f);
+  cells  = {{cellCoordinate(center.x - radius, _cellSize),
+            cellCoordinate(center.y - radius, _cellSize),
+            cellCoordinate(center.z - radius, _cellSize),
+            cellCoordinate(center.x + radius, _cellSize),
+            cellCoordinate(center.y + radius, _cellSize),
+            cellCoordinate(center.z + radius, _cellSize)}};
+
+  const auto extent = [&cells](size_t axis) {
+    return static_cast<size_t>(cells[axis + 3] - cells[axis]) + 1;
+  };
+  return extent(0) * extent(1) * extent(2) <= _maxCellsPerItem;
+}
+
+void SpatialHashGrid::_unlink(size_t id)
+{
+  const auto& item = _items[id];
+  if (item.large) {
+    _largeItems.erase(std::find(_largeItems.begin(), _largeItems.end(), id));
+    return;
+  }
+
+  const auto& c = item.cells;
+  for (int x = c[0]; x <= c[3]; ++x) {
+    for (int y = c[1]; y <= c[4]; ++y) {
+      for (int z = c[2]; z <= c[5]; ++z) {
+        auto it = _cells.find(_key(x, y, z));
+        if (it == _cells.end()) {
+          continue;
+        }
+        auto& ids = it->second;
+        ids.erase(std::find(ids.begin(), ids.end(), id));
+        if (ids.empty()) {
+          _cells.erase(it);
+        }
+      }
+    }
+  }
+}
+
+void SpatialHashGrid::_link(size_t id)
+{
+  const auto& item = _items[id];
+  if (item.large) {
+    _largeItems.emplace_back(id);
+    return;
+  }
+
+  const auto& c = item.cells;
+  for (int x = c[0]; x <= c[3]; ++x) {
+    for (int y = c[1]; y <= c[4]; ++y) {
+      for (int z = c[2]; z <= c[5]; ++z) {
+        _cells[_key(x, y, z)].emplace_back(id);
+      }
+    }
+  }
+}
+
+uint64_t SpatialHashGrid::_key(int x, int y, int z)
+{
+  const auto bits = [](int value) {
+    return static_cast<uint64_t>(value + CellLimit) & 0x1fffff;
+  };
+  return (bits(x) << 42) | (bits(y) << 21) | bits(z);
+}
+
+bool SpatialHashGrid::_overlaps(const Item& item, const Vector3& center,
+                                float radius)
+{
+  if (!std::isfinite(item.radius) || !std::isfinite(radius)) {
+    return true;
+  }
+
+  const float dx       = item.center.x - center.x;
+  const float dy       = item.center.y - center.y;
+  const float dz       = item.center.z - center.z;
+  const float distance = item.radius + radius;
+  return dx * dx + dy * dy + dz * dz <= distance * distance;
+}
+
+} // end of namespace BABYLON
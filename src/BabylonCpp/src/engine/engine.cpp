@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/babylon_version.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/core/logging.h>
 #include <babylon/core/string.h>
 #include <babylon/core/time.h>
@@ -13,6 +14,7 @@
 #include <babylon/materials/effect.h>
 #include <babylon/materials/effect_creation_options.h>
 #include <babylon/materials/effect_fallbacks.h>
+#include <babylon/materials/material_defines.h>
 #include <babylon/materials/textures/imulti_render_target_options.h>
 #include <babylon/materials/textures/irender_target_options.h>
 #include <babylon/materials/textures/texture.h>
@@ -50,17 +52,23 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     , _webGLVersion{1.f}
     , _badOS{false}
     , _alphaTest{false}
+    , _loadingScreen{nullptr}
     , _videoTextureSupported{false}
     , _renderingQueueLaunched{false}
     , fpsRange{60}
     , fps{60.f}
     , deltaTime{std::chrono::microseconds(0)}
+    , _frameId{0}
+    , _frameArenaHeapAllocationStart{0}
+    , _frameArenaAllocationCount{0}
+    , _frameArenaHeapAllocationCount{0}
     , _depthCullingState{std::make_unique<Internals::_DepthCullingState>()}
     , _stencilState{std::make_unique<Internals::_StencilState>()}
     , _alphaState{std::make_unique<Internals::_AlphaState>()}
     , _alphaMode{EngineConstants::ALPHA_DISABLE}
     , _maxTextureChannels{16}
     , _currentProgram{nullptr}
+    , _cachedVertexArrayObject{nullptr}
     , _cachedVertexBuffers{nullptr}
     , _cachedIndexBuffer{nullptr}
     , _cachedEffectForVertexBuffers{nullptr}
@@ -666,7 +674,10 @@ Viewport& Engine::setDirectViewport(int x, int y, int width, int height)
 
 void Engine::beginFrame()
 {
+  ++_frameId;
   _measureFps();
+  _frameArenaHeapAllocationStart
+    = FrameArena::Current().heapAllocationCount();
 }
 
 void Engine::endFrame()
@@ -680,6 +691,13 @@ void Engine::endFrame()
   // if (_vrDisplayEnabled && _vrDisplayEnabled.isPresenting) {
   //  _vrDisplayEnabled.submitFrame()
   //}
+
+  // Release the temporaries of the frame
+  auto& frameArena           = FrameArena::Current();
+  _frameArenaAllocationCount = frameArena.allocationCount();
+  frameArena.reset();
+  _frameArenaHeapAllocationCount
+    = frameArena.heapAllocationCount() - _frameArenaHeapAllocationStart;
 }
 
 void Engine::resize()
@@ -793,6 +811,27 @@ void Engine::unBindFramebuffer(GL::IGLTexture* texture,
   bindUnboundFramebuffer(nullptr);
 }
 
+bool Engine::copyFramebuffer(GL::IGLTexture* source,
+                             GL::IGLTexture* destination, bool copyDepth)
+{
+  if (webGLVersion() < 2.f || !source || !destination || !source->_framebuffer
+      || !destination->_framebuffer) {
+    return false;
+  }
+
+  const unsigned int mask
+    = copyDepth ? GL::COLOR_BUFFER_BIT | GL::DEPTH_BUFFER_BIT :
+                  GL::COLOR_BUFFER_BIT;
+  _gl->bindFramebuffer(GL::READ_FRAMEBUFFER, source->_framebuffer.get());
+  _gl->bindFramebuffer(GL::DRAW_FRAMEBUFFER, destination->_framebuffer.get());
+  _gl->blitFramebuffer(0, 0, source->_width, source->_height, 0, 0,
+                       destination->_width, destination->_height, mask,
+                       GL::NEAREST);
+  _gl->bindFramebuffer(GL::FRAMEBUFFER, _currentFramebuffer);
+
+  return true;
+}
+
 void Engine::generateMipMapsForCubemap(GL::IGLTexture* texture)
 {
   if (texture->generateMipMaps) {
@@ -857,15 +896,15 @@ void Engine::updateUniformBuffer(GL::IGLBuffer* uniformBuffer,
   }
 
   if (count == -1) {
-    _gl->bufferSubData(GL::UNIFORM_BUFFER, offset, elements);
-  }
-  else {
-    Float32Array subvector;
-    std::copy(elements.begin() + offset, elements.begin() + offset + count,
-              std::back_inserter(subvector));
-    _gl->bufferSubData(GL::UNIFORM_BUFFER, 0, subvector);
+    count = static_cast<int>(elements.size()) - offset;
   }
 
+  // Offset and count are expressed in number of floats
+  _gl->bufferSubData(GL::UNIFORM_BUFFER,
+                     static_cast<GL::GLintptr>(offset * sizeof(float)),
+                     elements, static_cast<GL::GLuint>(offset),
+                     static_cast<GL::GLuint>(count));
+
   bindUniformBuffer(nullptr);
 }
 
@@ -886,6 +925,16 @@ Engine::GLBufferPtr Engine::createVertexBuffer(const Float32Array& vertices)
   return vbo;
 }
 
+Engine::GLBufferPtr Engine::createVertexBuffer(const Uint16Array& vertices)
+{
+  auto vbo = _gl->createBuffer();
+  bindArrayBuffer(vbo.get());
+  _gl->bufferData(GL::ARRAY_BUFFER, vertices, GL::STATIC_DRAW);
+  _resetVertexBufferBinding();
+  vbo->references = 1;
+  return vbo;
+}
+
 Engine::GLBufferPtr
 Engine::createDynamicVertexBuffer(const Float32Array& vertices)
 {
@@ -908,13 +957,15 @@ void Engine::updateDynamicVertexBuffer(const Engine::GLBufferPtr& vertexBuffer,
   }
 
   if (count == -1) {
+    // Offset is expressed in bytes
     _gl->bufferSubData(GL::ARRAY_BUFFER, offset, vertices);
   }
   else {
-    Float32Array subvector;
-    std::copy(vertices.begin() + offset, vertices.begin() + offset + count,
-              std::back_inserter(subvector));
-    _gl->bufferSubData(GL::ARRAY_BUFFER, 0, subvector);
+    // Offset and count are expressed in number of floats
+    _gl->bufferSubData(GL::ARRAY_BUFFER,
+                       static_cast<GL::GLintptr>(offset * sizeof(float)),
+                       vertices, static_cast<GL::GLuint>(offset),
+                       static_cast<GL::GLuint>(count));
   }
 
   _resetVertexBufferBinding();
@@ -1064,10 +1115,9 @@ void Engine::_bindIndexBufferWithCache(GL::IGLBuffer* indexBuffer)
 }
 
 void Engine::_bindVertexBuffersAttributes(
-  const std::unordered_map<std::string, VertexBuffer*>& vertexBuffers,
-  Effect* effect)
+  const std::vector<VertexBuffer*>& vertexBuffers, Effect* effect)
 {
-  auto attributes = effect->getAttributesNames();
+  const auto& attributeKinds = effect->getAttributeKinds();
 
   if (!_vaoRecordInProgress) {
     _unBindVertexArrayObject();
@@ -1076,12 +1126,14 @@ void Engine::_bindVertexBuffersAttributes(
   unbindAllAttributes();
 
   unsigned int _order = 0;
-  for (unsigned int index = 0; index < attributes.size(); ++index) {
+  for (unsigned int index = 0; index < attributeKinds.size(); ++index) {
     auto order = effect->getAttributeLocation(index);
 
     if (order >= 0) {
-      _order             = static_cast<unsigned int>(order);
-      auto& vertexBuffer = vertexBuffers.at(attributes[index]);
+      _order          = static_cast<unsigned int>(order);
+      const auto kind = attributeKinds[index];
+      auto vertexBuffer
+        = (kind < vertexBuffers.size()) ? vertexBuffers[kind] : nullptr;
 
       if (!vertexBuffer) {
         continue;
@@ -1096,9 +1148,11 @@ void Engine::_bindVertexBuffersAttributes(
       }
 
       auto buffer = vertexBuffer->getBuffer();
-      vertexAttribPointer(buffer, _order, vertexBuffer->getSize(), GL::FLOAT,
-                          false, vertexBuffer->getStrideSize() * 4,
-                          static_cast<int>(vertexBuffer->getOffset() * 4));
+      vertexAttribPointer(buffer, _order, vertexBuffer->getAttributeSize(),
+                          vertexBuffer->getAttributeType(),
+                          vertexBuffer->getAttributeNormalized(),
+                          vertexBuffer->getByteStride(),
+                          vertexBuffer->getByteOffset());
 
       if (vertexBuffer->getIsInstanced()) {
         _gl->vertexAttribDivisor(_order, 1);
@@ -1112,8 +1166,8 @@ void Engine::_bindVertexBuffersAttributes(
 }
 
 std::unique_ptr<GL::IGLVertexArrayObject> Engine::recordVertexArrayObject(
-  const std::unordered_map<std::string, VertexBuffer*>& vertexBuffers,
-  GL::IGLBuffer* indexBuffer, Effect* effect)
+  const std::vector<VertexBuffer*>& vertexBuffers, GL::IGLBuffer* indexBuffer,
+  Effect* effect)
 {
   auto vao = _gl->createVertexArray();
 
@@ -1129,6 +1183,12 @@ std::unique_ptr<GL::IGLVertexArrayObject> Engine::recordVertexArrayObject(
   _vaoRecordInProgress = false;
   _gl->bindVertexArray(nullptr);
 
+  // The recording changed the bound vertex array and index buffer
+  _cachedVertexArrayObject      = nullptr;
+  _cachedIndexBuffer            = nullptr;
+  _cachedEffectForVertexBuffers = nullptr;
+  _cachedVertexBufferSlots.clear();
+
   return vao;
 }
 
@@ -1139,8 +1199,10 @@ void Engine::bindVertexArrayObject(GL::IGLVertexArrayObject* vertexArrayObject,
     _cachedVertexArrayObject = vertexArrayObject;
 
     _gl->bindVertexArray(vertexArrayObject);
-    _cachedVertexBuffers = nullptr;
-    _cachedIndexBuffer   = nullptr;
+    _cachedVertexBuffers          = nullptr;
+    _cachedIndexBuffer            = nullptr;
+    _cachedEffectForVertexBuffers = nullptr;
+    _cachedVertexBufferSlots.clear();
 
     _uintIndicesCurrentlySet  = indexBuffer != nullptr && indexBuffer->is32Bits;
     _mustWipeVertexAttributes = true;
@@ -1201,9 +1263,27 @@ void Engine::bindBuffers(
   const std::unordered_map<std::string, VertexBuffer*>& vertexBuffers,
   GL::IGLBuffer* indexBuffer, Effect* effect)
 {
-  if (_cachedVertexBuffersMap != vertexBuffers
-      || _cachedEffectForVertexBuffers != effect) {
-    _cachedVertexBuffersMap       = vertexBuffers;
+  _vertexBufferSlotsTmp.clear();
+  for (const auto& item : vertexBuffers) {
+    const auto kind = VertexBuffer::KindFromString(item.first);
+    if (kind == 0) {
+      continue;
+    }
+    if (kind >= _vertexBufferSlotsTmp.size()) {
+      _vertexBufferSlotsTmp.resize(kind + 1, nullptr);
+    }
+    _vertexBufferSlotsTmp[kind] = item.second;
+  }
+
+  bindBuffers(_vertexBufferSlotsTmp, indexBuffer, effect);
+}
+
+void Engine::bindBuffers(const std::vector<VertexBuffer*>& vertexBuffers,
+                         GL::IGLBuffer* indexBuffer, Effect* effect)
+{
+  if (_cachedEffectForVertexBuffers != effect
+      || _cachedVertexBufferSlots != vertexBuffers) {
+    _cachedVertexBufferSlots      = vertexBuffers;
     _cachedEffectForVertexBuffers = effect;
 
     _bindVertexBuffersAttributes(vertexBuffers, effect);
@@ -1225,6 +1305,11 @@ void Engine::unbindInstanceAttributes()
       = static_cast<unsigned int>(_currentInstanceLocations[i]);
     _gl->vertexAttribDivisor(offsetLocation, 0);
   }
+  if (!_currentInstanceLocations.empty()) {
+    // The cached vertex buffers no longer match the attribute divisors
+    _cachedEffectForVertexBuffers = nullptr;
+    _cachedVertexBufferSlots.clear();
+  }
   _currentInstanceBuffers.clear();
   _currentInstanceLocations.clear();
 }
@@ -1240,12 +1325,29 @@ bool Engine::_releaseBuffer(GL::IGLBuffer* buffer)
 
   if (buffer->references == 0) {
     _gl->deleteBuffer(buffer);
+    if (!_releasedUniformBuffers.empty()) {
+      _releasedUniformBuffers.erase(
+        std::remove_if(_releasedUniformBuffers.begin(),
+                       _releasedUniformBuffers.end(),
+                       [buffer](const GLBufferPtr& releasedBuffer) {
+                         return releasedBuffer.get() == buffer;
+                       }),
+        _releasedUniformBuffers.end());
+    }
     return true;
   }
 
   return false;
 }
 
+void Engine::_releaseUniformBuffer(GLBufferPtr&& buffer)
+{
+  auto releasedBuffer = std::move(buffer);
+  if (!_releaseBuffer(releasedBuffer.get())) {
+    _releasedUniformBuffers.emplace_back(std::move(releasedBuffer));
+  }
+}
+
 Engine::GLBufferPtr Engine::createInstancesBuffer(unsigned int capacity)
 {
   auto buffer = _gl->createBuffer();
@@ -1390,6 +1492,23 @@ void Engine::_releaseEffect(Effect* effect)
     }
     _compiledEffects.erase(effect->_key);
   }
+
+  auto hashes = _effectDefinesHashes.find(effect);
+  if (hashes == _effectDefinesHashes.end()) {
+    return;
+  }
+  for (auto definesHash : hashes->second) {
+    auto range = _effectsByDefinesHash.equal_range(definesHash);
+    for (auto it = range.first; it != range.second;) {
+      if (it->second.effect == effect) {
+        it = _effectsByDefinesHash.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+  }
+  _effectDefinesHashes.erase(hashes);
 }
 
 Effect* Engine::createEffect(const std::string& baseName,
@@ -1433,6 +1552,44 @@ Engine::createEffect(std::unordered_map<std::string, std::string>& baseName,
   return _compiledEffects[name].get();
 }
 
+Effect* Engine::getEffectByDefinesHash(uint64_t definesHash,
+                                       const std::string& shaderName,
+                                       const MaterialDefines& defines,
+                                       unsigned int maxSimultaneousLights) const
+{
+  // Colliding hashes share the bucket, the full key tells them apart
+  auto range = _effectsByDefinesHash.equal_range(definesHash);
+  for (auto it = range.first; it != range.second; ++it) {
+    const auto& entry = it->second;
+    if (entry.maxSimultaneousLights == maxSimultaneousLights
+        && entry.shaderName == shaderName
+        && entry.defines->isCodeEqual(defines)) {
+      return entry.effect;
+    }
+  }
+  return nullptr;
+}
+
+void Engine::registerEffectDefinesHash(uint64_t definesHash,
+                                       const std::string& shaderName,
+                                       const MaterialDefines& defines,
+                                       unsigned int maxSimultaneousLights,
+                                       Effect* effect)
+{
+  if (getEffectByDefinesHash(definesHash, shaderName, defines,
+                             maxSimultaneousLights)) {
+    return;
+  }
+
+  EffectDefinesEntry entry;
+  entry.shaderName            = shaderName;
+  entry.defines               = std::make_unique<MaterialDefines>(defines);
+  entry.maxSimultaneousLights = maxSimultaneousLights;
+  entry.effect                = effect;
+  _effectsByDefinesHash.emplace(definesHash, std::move(entry));
+  _effectDefinesHashes[effect].emplace_back(definesHash);
+}
+
 Effect* Engine::createEffectForParticles(
   const std::string& fragmentName,
   const std::vector<std::string>& uniformsNames,
@@ -1914,6 +2071,7 @@ void Engine::wipeCaches(bool bruteForce)
   _cachedVertexBuffers          = nullptr;
   _cachedIndexBuffer            = nullptr;
   _cachedEffectForVertexBuffers = nullptr;
+  _cachedVertexBufferSlots.clear();
   _unBindVertexArrayObject();
   bindIndexBuffer(nullptr);
   bindArrayBuffer(nullptr);
@@ -2942,8 +3100,7 @@ void Engine::_bindTexture(int channel, GL::IGLTexture* texture)
 
 void Engine::setTextureFromPostProcess(int channel, PostProcess* postProcess)
 {
-  size_t _ind = static_cast<size_t>(postProcess->_currentRenderTextureInd);
-  _bindTexture(channel, postProcess->_textures[_ind]);
+  _bindTexture(channel, postProcess->outputTexture());
 }
 
 void Engine::unbindAllTextures()
@@ -3147,11 +3304,11 @@ void Engine::unbindAllAttributes()
   if (_mustWipeVertexAttributes) {
     _mustWipeVertexAttributes = false;
 
-    for (unsigned int i = 0, ul = static_cast<unsigned>(_caps.maxVertexAttribs);
-         i < ul; ++i) {
+    const auto maxVertexAttribs = static_cast<unsigned>(_caps.maxVertexAttribs);
+    for (unsigned int i = 0; i < maxVertexAttribs; ++i) {
       _gl->disableVertexAttribArray(i);
-      _vertexAttribArraysEnabled[i] = false;
     }
+    _vertexAttribArraysEnabled.assign(maxVertexAttribs, false);
     _currentBufferPointers.clear();
     return;
   }
@@ -3174,6 +3331,8 @@ void Engine::releaseEffects()
   }
 
   _compiledEffects.clear();
+  _effectsByDefinesHash.clear();
+  _effectDefinesHashes.clear();
 }
 
 // Dispose
@@ -3209,6 +3368,8 @@ void Engine::dispose(bool /*doNotRecurse*/)
 
   // Unbind
   unbindAllAttributes();
+  Effect::ResetCache(this);
+  _releasedUniformBuffers.clear();
 
   _gl = nullptr;
 
@@ -3291,6 +3452,22 @@ microseconds_t Engine::getDeltaTime() const
   return deltaTime;
 }
 
+size_t Engine::getFrameId() const
+{
+  return _frameId;
+}
+
+// Frame arena
+size_t Engine::getFrameArenaAllocationCount() const
+{
+  return _frameArenaAllocationCount;
+}
+
+size_t Engine::getFrameArenaHeapAllocationCount() const
+{
+  return _frameArenaHeapAllocationCount;
+}
+
 void Engine::_measureFps()
 {
   previousFramesDuration.emplace_back(Time::highresTimepointNow());
@@ -14,6 +14,7 @@
 #include <babylon/collisions/collision_coordinator_legacy.h>
 #include <babylon/collisions/collision_coordinator_worker.h>
 #include <babylon/collisions/icollision_coordinator.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/core/logging.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
@@ -21,13 +22,16 @@
 #include <babylon/debug/debug_layer.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/pointer_event_types.h>
+#include <babylon/engine/transform_hierarchy.h>
 #include <babylon/interfaces/icanvas.h>
 #include <babylon/layer/highlight_layer.h>
 #include <babylon/layer/layer.h>
 #include <babylon/lensflare/lens_flare_system.h>
 #include <babylon/lights/hemispheric_light.h>
 #include <babylon/lights/light.h>
+#include <babylon/lights/light_grid.h>
 #include <babylon/lights/shadows/shadow_generator.h>
+#include <babylon/loading/snapshot/scene_snapshot.h>
 #include <babylon/materials/material.h>
 #include <babylon/materials/multi_material.h>
 #include <babylon/materials/pbr_material.h>
@@ -53,6 +57,7 @@
 #include <babylon/rendering/edges_renderer.h>
 #include <babylon/rendering/geometry_buffer_renderer.h>
 #include <babylon/rendering/outline_renderer.h>
+#include <babylon/rendering/render_target_scheduler.h>
 #include <babylon/rendering/rendering_manager.h>
 #include <babylon/sprites/sprite_manager.h>
 #include <babylon/tools/tools.h>
@@ -169,6 +174,9 @@ Scene::Scene(Engine* engine)
     , _debugLayer{nullptr}
     , _depthRenderer{nullptr}
     , _geometryBufferRenderer{nullptr}
+    , _transformHierarchy{nullptr}
+    , _lightGrid{nullptr}
+    , _renderTargetScheduler{nullptr}
     , _uniqueIdCounter{0}
     , _pickedDownMesh{nullptr}
     , _pickedUpMesh{nullptr}
@@ -338,6 +346,16 @@ void Scene::setShadowsEnabled(bool value)
   markAllMaterialsAsDirty(Material::LightDirtyFlag);
 }
 
+bool Scene::autoInstancing() const
+{
+  return _renderingManager->autoInstancing;
+}
+
+void Scene::setAutoInstancing(bool value)
+{
+  _renderingManager->autoInstancing = value;
+}
+
 bool Scene::lightsEnabled() const
 {
   return _lightsEnabled;
@@ -745,10 +763,9 @@ void Scene::_onPointerMoveEvent(PointerEvent&& evt)
     auto type = evt.type == EventType::MOUSE_WHEEL ?
                   PointerEventTypes::POINTERWHEEL :
                   PointerEventTypes::POINTERMOVE;
-    auto pi = std::make_unique<PointerInfoPre>(type, evt, _unTranslatedPointerX,
-                                               _unTranslatedPointerY);
-    onPrePointerObservable.notifyObservers(pi.get(), static_cast<int>(type));
-    if (pi->skipOnPointerObservable) {
+    PointerInfoPre pi(type, evt, _unTranslatedPointerX, _unTranslatedPointerY);
+    onPrePointerObservable.notifyObservers(&pi, static_cast<int>(type));
+    if (pi.skipOnPointerObservable) {
       return;
     }
   }
@@ -816,8 +833,8 @@ void Scene::_onPointerMoveEvent(PointerEvent&& evt)
     auto type = evt.type == EventType::MOUSE_WHEEL ?
                   PointerEventTypes::POINTERWHEEL :
                   PointerEventTypes::POINTERMOVE;
-    auto pi = std::make_unique<PointerInfo>(type, evt, *pickResult);
-    onPointerObservable.notifyObservers(pi.get(), static_cast<int>(type));
+    PointerInfo pi(type, evt, *pickResult);
+    onPointerObservable.notifyObservers(&pi, static_cast<int>(type));
   }
 }
 
@@ -828,10 +845,9 @@ void Scene::_onPointerDownEvent(PointerEvent&& evt)
   // PreObservable support
   if (onPrePointerObservable.hasObservers()) {
     auto type = PointerEventTypes::POINTERDOWN;
-    auto pi = std::make_unique<PointerInfoPre>(type, evt, _unTranslatedPointerX,
-                                               _unTranslatedPointerY);
-    onPrePointerObservable.notifyObservers(pi.get(), static_cast<int>(type));
-    if (pi->skipOnPointerObservable) {
+    PointerInfoPre pi(type, evt, _unTranslatedPointerX, _unTranslatedPointerY);
+    onPrePointerObservable.notifyObservers(&pi, static_cast<int>(type));
+    if (pi.skipOnPointerObservable) {
       return;
     }
   }
@@ -921,8 +937,8 @@ void Scene::_onPointerDownEvent(PointerEvent&& evt)
 
   if (onPointerObservable.hasObservers()) {
     auto type = PointerEventTypes::POINTERDOWN;
-    auto pi   = std::make_unique<PointerInfo>(type, evt, *pickResult);
-    onPointerObservable.notifyObservers(pi.get(), static_cast<int>(type));
+    PointerInfo pi(type, evt, *pickResult);
+    onPointerObservable.notifyObservers(&pi, static_cast<int>(type));
   }
 
   // Sprites
@@ -973,10 +989,9 @@ void Scene::_onPointerUpEvent(PointerEvent&& evt)
   // PreObservable support
   if (onPrePointerObservable.hasObservers()) {
     auto type = PointerEventTypes::POINTERUP;
-    auto pi = std::make_unique<PointerInfoPre>(type, evt, _unTranslatedPointerX,
-                                               _unTranslatedPointerY);
-    onPrePointerObservable.notifyObservers(pi.get(), static_cast<int>(type));
-    if (pi->skipOnPointerObservable) {
+    PointerInfoPre pi(type, evt, _unTranslatedPointerX, _unTranslatedPointerY);
+    onPrePointerObservable.notifyObservers(&pi, static_cast<int>(type));
+    if (pi.skipOnPointerObservable) {
       return;
     }
   }
@@ -1001,8 +1016,8 @@ void Scene::_onPointerUpEvent(PointerEvent&& evt)
         && pickResult->pickedMesh == _pickedDownMesh) {
       if (onPointerObservable.hasObservers()) {
         auto type = PointerEventTypes::POINTERPICK;
-        auto pi   = std::make_unique<PointerInfo>(type, evt, *pickResult);
-        onPointerObservable.notifyObservers(pi.get(), static_cast<int>(type));
+        PointerInfo pi(type, evt, *pickResult);
+        onPointerObservable.notifyObservers(&pi, static_cast<int>(type));
       }
     }
     if (pickResult->pickedMesh->actionManager) {
@@ -1030,8 +1045,8 @@ void Scene::_onPointerUpEvent(PointerEvent&& evt)
 
   if (onPointerObservable.hasObservers()) {
     auto type = PointerEventTypes::POINTERUP;
-    auto pi   = std::make_unique<PointerInfo>(type, evt, *pickResult);
-    onPointerObservable.notifyObservers(pi.get(), static_cast<int>(type));
+    PointerInfo pi(type, evt, *pickResult);
+    onPointerObservable.notifyObservers(&pi, static_cast<int>(type));
   }
 
   _startingPointerTime = high_res_time_point_t();
@@ -1162,6 +1177,25 @@ void Scene::_removePendingData(GL::IGLTexture* /*texture*/)
 {
 }
 
+void Scene::_addPendingIndexOptimization(Mesh* mesh)
+{
+  if (!stl_util::contains(_pendingIndexOptimizations, mesh)) {
+    _pendingIndexOptimizations.emplace_back(mesh);
+  }
+}
+
+void Scene::_applyPendingIndexOptimizations()
+{
+  // Callbacks may start new optimizations
+  auto pending = std::move(_pendingIndexOptimizations);
+  _pendingIndexOptimizations.clear();
+  for (auto& mesh : pending) {
+    if (!mesh->_applyIndexOptimization()) {
+      _addPendingIndexOptimization(mesh);
+    }
+  }
+}
+
 void Scene::getWaitingItemsCount()
 {
 }
@@ -1358,6 +1392,14 @@ void Scene::addMesh(std::unique_ptr<AbstractMesh>&& newMesh)
   auto _newMesh     = newMesh.get();
   meshes.emplace_back(std::move(newMesh));
 
+  if (_transformHierarchy) {
+    _transformHierarchy->addNode(_newMesh);
+  }
+
+  if (_lightGrid) {
+    _lightGrid->addMesh(_newMesh);
+  }
+
   // notify the collision coordinator
   if (collisionCoordinator) {
     collisionCoordinator->onMeshAdded(_newMesh);
@@ -1374,6 +1416,13 @@ int Scene::removeMesh(AbstractMesh* toRemove)
                      return mesh.get() == toRemove;
                    });
   int index = static_cast<int>(it - meshes.begin());
+  if (_transformHierarchy) {
+    _transformHierarchy->removeNode(toRemove);
+  }
+  if (_lightGrid) {
+    _lightGrid->removeMesh(toRemove);
+  }
+  stl_util::erase(_pendingIndexOptimizations, toRemove);
   if (it != meshes.end()) {
     meshes.erase(it);
   }
@@ -1431,6 +1480,9 @@ int Scene::removeLight(Light* toRemove)
     lights.erase(it);
     sortLightsByPriority();
   }
+  if (_lightGrid) {
+    _lightGrid->removeLight(toRemove);
+  }
 
   onLightRemovedObservable.notifyObservers(toRemove);
 
@@ -1475,6 +1527,9 @@ void Scene::addLight(std::unique_ptr<Light>&& newLight)
   auto _newLight     = newLight.get();
   lights.emplace_back(std::move(newLight));
   sortLightsByPriority();
+  if (_lightGrid) {
+    _lightGrid->addLight(_newLight);
+  }
   onNewLightAddedObservable.notifyObservers(_newLight);
 }
 
@@ -1713,6 +1768,8 @@ bool Scene::removeGeometry(Geometry* geometry)
                      return _geometry.get() == geometry;
                    });
   if (it != _geometries.end()) {
+    // Kept alive until the observers are notified
+    auto removedGeometry = std::move(*it);
     _geometries.erase(it);
 
     // notify the collision coordinator
@@ -2003,16 +2060,20 @@ void Scene::_evaluateActiveMeshes()
   }
 
   // Meshes
-  std::vector<AbstractMesh*> _meshes;
+  FrameVector<AbstractMesh*> _meshes;
 
   if (_selectionOctree) { // Octree
-    _meshes = _selectionOctree->select(_frustumPlanes);
+    const auto& selection = _selectionOctree->select(_frustumPlanes);
+    _meshes.assign(selection.begin(), selection.end());
   }
   else { // Full scene traversal
-    _meshes = getMeshes();
+    _meshes.reserve(meshes.size());
+    for (auto& mesh : meshes) {
+      _meshes.emplace_back(mesh.get());
+    }
   }
 
-  for (auto& mesh : meshes) {
+  for (auto& mesh : _meshes) {
     if (mesh->isBlocked()) {
       continue;
     }
@@ -2031,9 +2092,9 @@ void Scene::_evaluateActiveMeshes()
              {ActionManager::OnIntersectionEnterTrigger,
               ActionManager::OnIntersectionExitTrigger})) {
       if (std::find(_meshesForIntersections.begin(),
-                    _meshesForIntersections.end(), mesh.get())
+                    _meshesForIntersections.end(), mesh)
           == _meshesForIntersections.end()) {
-        _meshesForIntersections.emplace_back(mesh.get());
+        _meshesForIntersections.emplace_back(mesh);
       }
     }
 
@@ -2050,7 +2111,7 @@ void Scene::_evaluateActiveMeshes()
         || ((mesh->isVisible && mesh->visibility > 0)
             && ((mesh->layerMask & activeCamera->layerMask) != 0)
             && mesh->isInFrustum(_frustumPlanes))) {
-      _activeMeshes.emplace_back(dynamic_cast<Mesh*>(mesh.get()));
+      _activeMeshes.emplace_back(dynamic_cast<Mesh*>(mesh));
       activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
       mesh->_activate(_renderId);
 
@@ -2084,8 +2145,13 @@ void Scene::_activeMesh(AbstractMesh* mesh)
     if (std::find(_activeSkeletons.begin(), _activeSkeletons.end(),
                   mesh->skeleton())
         == _activeSkeletons.end()) {
-      _activeSkeletons.emplace_back(mesh->skeleton());
-      mesh->skeleton()->prepare();
+      auto skeleton = mesh->skeleton();
+      _activeSkeletons.emplace_back(skeleton);
+      // Counted here, so that skeletons can be prepared on several threads
+      if (skeleton->isDirty()) {
+        _activeBones.addCount(skeleton->bones.size(), false);
+      }
+      skeleton->prepare();
     }
 
     if (!mesh->computeBonesUsingShaders()) {
@@ -2107,10 +2173,11 @@ void Scene::_activeMesh(AbstractMesh* mesh)
 
   if (mesh && !mesh->subMeshes.empty()) {
     // Submeshes Octrees
-    std::vector<SubMesh*> subMeshes;
+    FrameVector<SubMesh*> subMeshes;
 
     if (mesh->_submeshesOctree && mesh->useOctreeForRenderingSelection) {
-      subMeshes = mesh->_submeshesOctree->select(_frustumPlanes);
+      const auto& selection = mesh->_submeshesOctree->select(_frustumPlanes);
+      subMeshes.assign(selection.begin(), selection.end());
     }
     else {
       subMeshes.reserve(mesh->subMeshes.size());
@@ -2119,8 +2186,8 @@ void Scene::_activeMesh(AbstractMesh* mesh)
       }
     }
 
-    for (auto& subMesh : mesh->subMeshes) {
-      _evaluateSubMesh(subMesh.get(), mesh);
+    for (auto& subMesh : subMeshes) {
+      _evaluateSubMesh(subMesh, mesh);
     }
   }
 }
@@ -2173,15 +2240,12 @@ void Scene::_renderForCamera(Camera* camera)
   if (renderTargetsEnabled && !_renderTargets.empty()) {
     _intermediateRendering = true;
     Tools::StartPerformanceCounter("Render targets", !_renderTargets.empty());
-    for (auto& renderTarget : _renderTargets) {
-      if (renderTarget->_shouldRender()) {
-        ++_renderId;
-        bool hasSpecialRenderTargetCamera
-          = renderTarget->activeCamera
-            && renderTarget->activeCamera != activeCamera;
-        renderTarget->render(hasSpecialRenderTargetCamera,
-                             dumpNextRenderTargets);
-      }
+    for (auto& renderTarget : _scheduleRenderTargets(_renderTargets, camera)) {
+      ++_renderId;
+      bool hasSpecialRenderTargetCamera
+        = renderTarget->activeCamera
+          && renderTarget->activeCamera != activeCamera;
+      renderTarget->render(hasSpecialRenderTargetCamera, dumpNextRenderTargets);
     }
     Tools::EndPerformanceCounter("Render targets", !_renderTargets.empty());
 
@@ -2399,6 +2463,30 @@ void Scene::render()
   // Before render
   onBeforeRenderObservable.notifyObservers(this);
 
+  // Index optimizations completed on background threads
+  if (!_pendingIndexOptimizations.empty()) {
+    _applyPendingIndexOptimizations();
+  }
+
+  // World matrices
+  if (_transformHierarchy) {
+    Tools::StartPerformanceCounter("Transform hierarchy");
+    _transformHierarchy->update();
+    Tools::EndPerformanceCounter("Transform hierarchy");
+  }
+
+  // Light assignment
+  if (_lightGrid) {
+    Tools::StartPerformanceCounter("Light assignment");
+    _lightGrid->update();
+    Tools::EndPerformanceCounter("Light assignment");
+  }
+
+  // Render target budget of the frame
+  if (_renderTargetScheduler) {
+    _renderTargetScheduler->beginFrame();
+  }
+
   // Customs render targets
   _renderTargetsDuration.beginMonitoring();
   auto engine              = getEngine();
@@ -2406,27 +2494,26 @@ void Scene::render()
   if (renderTargetsEnabled) {
     Tools::StartPerformanceCounter("Custom render targets",
                                    !customRenderTargets.empty());
-    for (auto& renderTarget : customRenderTargets) {
-      if (renderTarget->_shouldRender()) {
-        ++_renderId;
+    for (auto& renderTarget :
+         _scheduleRenderTargets(customRenderTargets, activeCamera)) {
+      ++_renderId;
 
-        activeCamera = renderTarget->activeCamera ? renderTarget->activeCamera :
-                                                    activeCamera;
+      activeCamera = renderTarget->activeCamera ? renderTarget->activeCamera :
+                                                  activeCamera;
 
-        if (!activeCamera) {
-          BABYLON_LOG_ERROR("Scene", "Active camera not set");
-          return;
-        }
+      if (!activeCamera) {
+        BABYLON_LOG_ERROR("Scene", "Active camera not set");
+        return;
+      }
 
-        // Viewport
-        engine->setViewport(activeCamera->viewport);
+      // Viewport
+      engine->setViewport(activeCamera->viewport);
 
-        // Camera
-        updateTransformMatrix();
+      // Camera
+      updateTransformMatrix();
 
-        renderTarget->render(currentActiveCamera != activeCamera,
-                             dumpNextRenderTargets);
-      }
+      renderTarget->render(currentActiveCamera != activeCamera,
+                           dumpNextRenderTargets);
     }
     Tools::EndPerformanceCounter("Custom render targets",
                                  !customRenderTargets.empty());
@@ -2686,6 +2773,99 @@ void Scene::unfreezeMaterials()
   }
 }
 
+TransformHierarchy* Scene::enableTransformHierarchy()
+{
+  if (_transformHierarchy) {
+    return _transformHierarchy.get();
+  }
+
+  _transformHierarchy = std::make_unique<TransformHierarchy>(this);
+  for (auto& mesh : meshes) {
+    _transformHierarchy->addNode(mesh.get());
+  }
+
+  return _transformHierarchy.get();
+}
+
+void Scene::disableTransformHierarchy()
+{
+  _transformHierarchy.reset(nullptr);
+}
+
+TransformHierarchy* Scene::transformHierarchy()
+{
+  return _transformHierarchy.get();
+}
+
+LightGrid* Scene::enableLightGrid(float cellSize)
+{
+  if (_lightGrid) {
+    return _lightGrid.get();
+  }
+
+  _lightGrid = std::make_unique<LightGrid>(this, cellSize);
+  for (auto& light : lights) {
+    _lightGrid->addLight(light.get());
+  }
+  for (auto& mesh : meshes) {
+    _lightGrid->addMesh(mesh.get());
+  }
+
+  return _lightGrid.get();
+}
+
+void Scene::disableLightGrid()
+{
+  _lightGrid.reset(nullptr);
+  for (auto& mesh : meshes) {
+    mesh->_resyncLightSources();
+  }
+}
+
+LightGrid* Scene::lightGrid()
+{
+  return _lightGrid.get();
+}
+
+RenderTargetScheduler*
+Scene::enableRenderTargetScheduler(unsigned int faceBudget)
+{
+  if (!_renderTargetScheduler) {
+    _renderTargetScheduler
+      = std::make_unique<RenderTargetScheduler>(faceBudget);
+  }
+  _renderTargetScheduler->faceBudget = faceBudget;
+
+  return _renderTargetScheduler.get();
+}
+
+void Scene::disableRenderTargetScheduler()
+{
+  _renderTargetScheduler.reset(nullptr);
+}
+
+RenderTargetScheduler* Scene::renderTargetScheduler()
+{
+  return _renderTargetScheduler.get();
+}
+
+std::vector<RenderTargetTexture*> Scene::_scheduleRenderTargets(
+  const std::vector<RenderTargetTexture*>& renderTargets, Camera* camera)
+{
+  if (_renderTargetScheduler) {
+    return _renderTargetScheduler->schedule(renderTargets, camera);
+  }
+
+  std::vector<RenderTargetTexture*> scheduledRenderTargets;
+  for (auto& renderTarget : renderTargets) {
+    if (renderTarget->_shouldRender()) {
+      scheduledRenderTargets.emplace_back(renderTarget);
+    }
+  }
+
+  return scheduledRenderTargets;
+}
+
 void Scene::dispose(bool /*doNotRecurse*/)
 {
   beforeRender = nullptr;
@@ -2742,23 +2922,32 @@ void Scene::dispose(bool /*doNotRecurse*/)
     camera->detachControl(canvas);
   }
 
-  // Release lights
-  for (auto& light : lights) {
+  // Release lights, kept alive while they remove themselves from the scene
+  auto disposedLights = std::move(lights);
+  lights.clear();
+  for (auto& light : disposedLights) {
     light->dispose();
   }
 
-  // Release meshes
-  for (auto& mesh : meshes) {
+  // Release meshes, kept alive while they remove themselves from the scene
+  disableTransformHierarchy();
+  auto disposedMeshes = std::move(meshes);
+  meshes.clear();
+  for (auto& mesh : disposedMeshes) {
     mesh->dispose(true);
   }
 
-  // Release cameras
-  for (auto& camera : cameras) {
+  // Release cameras, kept alive while they remove themselves from the scene
+  auto disposedCameras = std::move(cameras);
+  cameras.clear();
+  for (auto& camera : disposedCameras) {
     camera->dispose();
   }
 
-  // Release materials
-  for (auto& material : materials) {
+  // Release materials, kept alive while they remove themselves from the scene
+  auto disposedMaterials = std::move(materials);
+  materials.clear();
+  for (auto& material : disposedMaterials) {
     material->dispose();
   }
 
@@ -3060,6 +3249,17 @@ bool Scene::isPhysicsEnabled()
   return _physicsEngine != nullptr;
 }
 
+/** Snapshot **/
+bool Scene::saveSnapshot(const std::string& filename)
+{
+  return SceneSnapshot::Save(this, filename);
+}
+
+bool Scene::loadSnapshot(const std::string& filename)
+{
+  return SceneSnapshot::Load(this, filename);
+}
+
 void Scene::createDefaultCameraOrLight(bool createArcRotateCamera)
 {
   // Light
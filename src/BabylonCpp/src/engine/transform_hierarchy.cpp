@@ -0,0 +1,583 @@
+#include <babylon/engine/transform_hierarchy.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/abstract_mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+
+// SIMD
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+#include <babylon/math/simd/float32x4.h>
+#endif
+
+namespace BABYLON {
+
+constexpr std::uint8_t TransformHierarchy::LOCAL_DIRTY;
+constexpr std::uint8_t TransformHierarchy::WORLD_UPDATED;
+constexpr std::uint8_t TransformHierarchy::FALLBACK;
+
+size_t TransformHierarchy::ParallelThreshold = 1024;
+
+TransformHierarchy::TransformHierarchy(Scene* scene)
+    : maxThreads{std::max(1u, std::thread::hardware_concurrency())}
+    , _scene{scene}
+    , _structureDirty{false}
+    , _hasPendingChanges{false}
+    , _isUpdating{false}
+    , _fallbackCount{0}
+{
+}
+
+TransformHierarchy::~TransformHierarchy()
+{
+  for (auto& mesh : _registeredNodes) {
+    mesh->_transformHierarchyIndex = -1;
+    mesh->_isTransformManaged      = false;
+  }
+}
+
+void TransformHierarchy::addNode(AbstractMesh* mesh)
+{
+  if (std::find(_registeredNodes.begin(), _registeredNodes.end(), mesh)
+      != _registeredNodes.end()) {
+    return;
+  }
+
+  _registeredNodes.emplace_back(mesh);
+  markStructureAsDirty();
+}
+
+void TransformHierarchy::removeNode(AbstractMesh* mesh)
+{
+  auto it = std::find(_registeredNodes.begin(), _registeredNodes.end(), mesh);
+  if (it == _registeredNodes.end()) {
+    return;
+  }
+
+  _registeredNodes.erase(it);
+  mesh->_transformHierarchyIndex = -1;
+  mesh->_isTransformManaged      = false;
+
+  // Drop the stale pointers straight away, the arrays are rebuilt on the next
+  // update
+  std::replace(_nodes.begin(), _nodes.end(), mesh,
+               static_cast<AbstractMesh*>(nullptr));
+  markStructureAsDirty();
+}
+
+void TransformHierarchy::markAsDirty(int index)
+{
+  if (index < 0 || static_cast<size_t>(index) >= _flags.size()) {
+    return;
+  }
+
+  _flags[static_cast<size_t>(index)] |= TransformHierarchy::LOCAL_DIRTY;
+  _hasPendingChanges = true;
+}
+
+void TransformHierarchy::markStructureAsDirty()
+{
+  _structureDirty    = true;
+  _hasPendingChanges = true;
+}
+
+bool TransformHierarchy::hasPendingChanges() const
+{
+  return _hasPendingChanges;
+}
+
+bool TransformHierarchy::isUpdating() const
+{
+  return _isUpdating;
+}
+
+size_t TransformHierarchy::size() const
+{
+  return _registeredNodes.size();
+}
+
+void TransformHierarchy::_syncStructure()
+{
+  if (_structureDirty) {
+    return;
+  }
+
+  // Reparenting is done through Node::setParent, detect it with a pointer
+  // compare per node
+  for (size_t i = 0; i < _nodes.size(); ++i) {
+    if (_nodes[i]->parent() != _parentNodes[i]) {
+      _structureDirty = true;
+      return;
+    }
+  }
+}
+
+void TransformHierarchy::_rebuild()
+{
+  const size_t count = _registeredNodes.size();
+
+  std::unordered_map<Node*, std::vector<AbstractMesh*>> children;
+  std::unordered_set<Node*> registered(_registeredNodes.begin(),
+                                       _registeredNodes.end());
+  std::vector<AbstractMesh*> roots;
+  children.reserve(count);
+  for (auto& mesh : _registeredNodes) {
+    auto parent = mesh->parent();
+    if (parent && registered.find(parent) != registered.end()) {
+      children[parent].emplace_back(mesh);
+    }
+    else {
+      roots.emplace_back(mesh);
+    }
+  }
+
+  _nodes.clear();
+  _parentNodes.clear();
+  _parents.clear();
+  _subtrees.clear();
+  _nodes.reserve(count);
+  _parentNodes.reserve(count);
+  _parents.reserve(count);
+
+  // Depth first traversal so that every root subtree is a contiguous range
+  std::vector<std::pair<AbstractMesh*, int>> stack;
+  for (auto& root : roots) {
+    const size_t start = _nodes.size();
+    stack.emplace_back(root, -1);
+    while (!stack.empty()) {
+      auto entry = stack.back();
+      stack.pop_back();
+
+      auto mesh                      = entry.first;
+      const int index                = static_cast<int>(_nodes.size());
+      mesh->_transformHierarchyIndex = index;
+      _nodes.emplace_back(mesh);
+      _parentNodes.emplace_back(mesh->parent());
+      _parents.emplace_back(entry.second);
+
+      auto it = children.find(mesh);
+      if (it != children.end()) {
+        for (auto child = it->second.rbegin(); child != it->second.rend();
+             ++child) {
+          stack.emplace_back(*child, index);
+        }
+      }
+    }
+    _subtrees.emplace_back(start, _nodes.size());
+  }
+
+  // Descendants follow their parent, so a subtree ends after the subtree of
+  // its last child
+  _subtreeEnds.assign(count, 0);
+  for (size_t i = count; i-- > 0;) {
+    _subtreeEnds[i]  = std::max(_subtreeEnds[i], i + 1);
+    const int parent = _parents[i];
+    if (parent >= 0) {
+      auto& parentEnd = _subtreeEnds[static_cast<size_t>(parent)];
+      parentEnd       = std::max(parentEnd, _subtreeEnds[i]);
+    }
+  }
+
+  // Every node is recomputed after a structural change
+  _flags.assign(count, TransformHierarchy::LOCAL_DIRTY);
+  _positions.resize(count);
+  _scalings.resize(count);
+  _rotations.resize(count);
+  _localMatrices.resize(count);
+  _worldMatrices.resize(count);
+  _subtreeHasFallback.assign(_subtrees.size(), false);
+
+  _structureDirty = false;
+}
+
+bool TransformHierarchy::_prepareNode(size_t index)
+{
+  auto mesh  = _nodes[index];
+  auto& flag = _flags[index];
+  flag &= ~(TransformHierarchy::WORLD_UPDATED | TransformHierarchy::FALLBACK);
+
+  const bool fallback
+    = mesh->billboardMode != AbstractMesh::BILLBOARDMODE_NONE
+      || mesh->infiniteDistance || mesh->_meshToBoneReferal
+      || mesh->_isWorldMatrixFrozen
+      || (_parents[index] < 0 && mesh->parent() != nullptr);
+  mesh->_isTransformManaged = !fallback;
+
+  if (fallback) {
+    flag |= TransformHierarchy::FALLBACK;
+    return true;
+  }
+
+  if (flag & TransformHierarchy::LOCAL_DIRTY) {
+    _gatherLocalTransform(index);
+  }
+
+  return false;
+}
+
+bool TransformHierarchy::_finalizeNode(size_t index)
+{
+  auto& flag = _flags[index];
+  flag &= ~TransformHierarchy::LOCAL_DIRTY;
+  if (!(flag & TransformHierarchy::WORLD_UPDATED)) {
+    return false;
+  }
+
+  if (flag & TransformHierarchy::FALLBACK) {
+    return true;
+  }
+
+  auto mesh = _nodes[index];
+  mesh->_worldMatrix->_markAsUpdated();
+  if (!mesh->_poseMatrix) {
+    mesh->_poseMatrix
+      = std::make_unique<Matrix>(Matrix::Invert(*mesh->_worldMatrix));
+  }
+  if (mesh->onAfterWorldMatrixUpdateObservable.hasObservers()) {
+    mesh->onAfterWorldMatrixUpdateObservable.notifyObservers(mesh);
+  }
+
+  return true;
+}
+
+void TransformHierarchy::_gatherLocalTransform(size_t index)
+{
+  auto mesh = _nodes[index];
+
+  // Rotate, if quaternion is set and rotation was used
+  if (mesh->_rotationQuaternionSet && mesh->_rotation.length() > 0.f) {
+    mesh->_rotationQuaternion.multiplyInPlace(Quaternion::RotationYawPitchRoll(
+      mesh->_rotation.y, mesh->_rotation.x, mesh->_rotation.z));
+    mesh->_rotation.copyFromFloats(0.f, 0.f, 0.f);
+  }
+
+  _positions[index].copyFrom(mesh->_position);
+  mesh->_scaling.scaleToRef(mesh->scalingDeterminant, _scalings[index]);
+  if (mesh->_rotationQuaternionSet) {
+    _rotations[index].copyFrom(mesh->_rotationQuaternion);
+  }
+  else {
+    Quaternion::RotationYawPitchRollToRef(mesh->_rotation.y, mesh->_rotation.x,
+                                          mesh->_rotation.z, _rotations[index]);
+  }
+}
+
+void TransformHierarchy::_composeLocal(const Vector3& scaling,
+                                       const Quaternion& rotation,
+                                       const Vector3& translation,
+                                       Matrix& result)
+{
+  // Scaling * Rotation * Translation, written directly into the result
+  const float xx = rotation.x * rotation.x;
+  const float yy = rotation.y * rotation.y;
+  const float zz = rotation.z * rotation.z;
+  const float xy = rotation.x * rotation.y;
+  const float zw = rotation.z * rotation.w;
+  const float zx = rotation.z * rotation.x;
+  const float yw = rotation.y * rotation.w;
+  const float yz = rotation.y * rotation.z;
+  const float xw = rotation.x * rotation.w;
+
+  auto& m = result.m;
+  m[0]    = (1.f - (2.f * (yy + zz))) * scaling.x;
+  m[1]    = (2.f * (xy + zw)) * scaling.x;
+  m[2]    = (2.f * (zx - yw)) * scaling.x;
+  m[3]    = 0.f;
+  m[4]    = (2.f * (xy - zw)) * scaling.y;
+  m[5]    = (1.f - (2.f * (zz + xx))) * scaling.y;
+  m[6]    = (2.f * (yz + xw)) * scaling.y;
+  m[7]    = 0.f;
+  m[8]    = (2.f * (zx + yw)) * scaling.z;
+  m[9]    = (2.f * (yz - xw)) * scaling.z;
+  m[10]   = (1.f - (2.f * (yy + xx))) * scaling.z;
+  m[11]   = 0.f;
+  m[12]   = translation.x;
+  m[13]   = translation.y;
+  m[14]   = translation.z;
+  m[15]   = 1.f;
+}
+
+void TransformHierarchy::_multiplyToRef(const Matrix& a, const Matrix& b,
+                                        Matrix& result)
+{
+  // Does not touch the matrix update flag as this is called from the worker
+  // threads
+#if BABYLONCPP_OPTION_ENABLE_SIMD == true
+  const auto b0 = SIMD::Float32x4::load(b.m, 0);
+  const auto b1 = SIMD::Float32x4::load(b.m, 4);
+  const auto b2 = SIMD::Float32x4::load(b.m, 8);
+  const auto b3 = SIMD::Float32x4::load(b.m, 12);
+
+  for (unsigned int i = 0; i < 16; i += 4) {
+    SIMD::Float32x4::store(
+      result.m, i,
+      SIMD::Float32x4::add(
+        SIMD::Float32x4::add(
+          SIMD::Float32x4::mul(SIMD::Float32x4::splat(a.m[i]), b0),
+          SIMD::Float32x4::mul(SIMD::Float32x4::splat(a.m[i + 1]), b1)),
+        SIMD::Float32x4::add(
+          SIMD::Float32x4::mul(SIMD::Float32x4::splat(a.m[i + 2]), b2),
+          SIMD::Float32x4::mul(SIMD::Float32x4::splat(a.m[i + 3]), b3))));
+  }
+#else
+  std::array<float, 16> m;
+  for (unsigned int i = 0; i < 16; i += 4) {
+    const float a0 = a.m[i];
+    const float a1 = a.m[i + 1];
+    const float a2 = a.m[i + 2];
+    const float a3 = a.m[i + 3];
+    for (unsigned int j = 0; j < 4; ++j) {
+      m[i + j]
+        = a0 * b.m[j] + a1 * b.m[4 + j] + a2 * b.m[8 + j] + a3 * b.m[12 + j];
+    }
+  }
+  result.m = m;
+#endif
+}
+
+void TransformHierarchy::_updateRange(size_t start, size_t end, int renderId)
+{
+  for (size_t i = start; i < end; ++i) {
+    const int parent          = _parents[i];
+    const bool parentUpdated  = (parent >= 0)
+                               && (_flags[static_cast<size_t>(parent)]
+                                   & TransformHierarchy::WORLD_UPDATED);
+    auto& flags               = _flags[i];
+    const bool localDirty     = (flags & TransformHierarchy::LOCAL_DIRTY) != 0;
+    auto mesh                 = _nodes[i];
+
+    if (flags & TransformHierarchy::FALLBACK) {
+      // Only reached from the main thread (see update())
+      mesh->computeWorldMatrix(localDirty || parentUpdated);
+      if (!_worldMatrices[i].equals(*mesh->_worldMatrix)) {
+        _worldMatrices[i].m = mesh->_worldMatrix->m;
+        flags |= TransformHierarchy::WORLD_UPDATED;
+      }
+      continue;
+    }
+
+    if (!localDirty && !parentUpdated) {
+      continue;
+    }
+
+    auto& local = _localMatrices[i];
+    auto& world = _worldMatrices[i];
+
+    // Local matrix
+    if (localDirty) {
+      _composeLocal(_scalings[i], _rotations[i], _positions[i], local);
+      if (!mesh->_pivotMatrix.isIdentity()) {
+        _multiplyToRef(mesh->_pivotMatrix, local, local);
+      }
+    }
+
+    // World matrix
+    if (parent >= 0) {
+      _multiplyToRef(local, _worldMatrices[static_cast<size_t>(parent)],
+                     world);
+    }
+    else {
+      world.m = local.m;
+    }
+    flags |= TransformHierarchy::WORLD_UPDATED;
+
+    // Mesh state
+    mesh->_localWorld.m   = local.m;
+    mesh->_worldMatrix->m = world.m;
+    mesh->_absolutePosition->copyFromFloats(world.m[12], world.m[13],
+                                            world.m[14]);
+    mesh->_cache.parent = mesh->parent();
+    mesh->_cache.position.copyFrom(mesh->_position);
+    mesh->_cache.scaling.copyFrom(mesh->_scaling);
+    if (mesh->_rotationQuaternionSet) {
+      mesh->_cache.rotationQuaternion.copyFrom(mesh->_rotationQuaternion);
+    }
+    else {
+      mesh->_cache.rotation.copyFrom(mesh->_rotation);
+    }
+    mesh->_cache.pivotMatrixUpdated = false;
+    mesh->_cache.billboardMode      = mesh->billboardMode;
+    mesh->_currentRenderId          = renderId;
+    mesh->_isDirty                  = false;
+    if (mesh->parent()) {
+      mesh->_markSyncedWithParent();
+    }
+
+    // Bounding info (fused)
+    mesh->_updateBoundingInfo();
+  }
+}
+
+size_t TransformHierarchy::update()
+{
+  if (_isUpdating) {
+    return 0;
+  }
+
+  _syncStructure();
+  if (_structureDirty) {
+    _rebuild();
+  }
+
+  _isUpdating = true;
+
+  // Gather the dirty local transforms (main thread)
+  const size_t count = _nodes.size();
+  _fallbackCount     = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (_prepareNode(i)) {
+      ++_fallbackCount;
+    }
+  }
+
+  // Fallback nodes (billboards, ...) have to be revisited every frame
+  if (!_hasPendingChanges && _fallbackCount == 0) {
+    _isUpdating = false;
+    return 0;
+  }
+
+  for (size_t s = 0; s < _subtrees.size(); ++s) {
+    const auto& subtree    = _subtrees[s];
+    _subtreeHasFallback[s] = false;
+    for (size_t i = subtree.first; i < subtree.second; ++i) {
+      if (_flags[i] & TransformHierarchy::FALLBACK) {
+        _subtreeHasFallback[s] = true;
+        break;
+      }
+    }
+  }
+
+  const int renderId = _scene->getRenderId();
+
+  // Subtrees without fallback nodes can be processed in parallel
+  std::vector<size_t> parallelSubtrees;
+  parallelSubtrees.reserve(_subtrees.size());
+  for (size_t s = 0; s < _subtrees.size(); ++s) {
+    if (!_subtreeHasFallback[s]) {
+      parallelSubtrees.emplace_back(s);
+    }
+  }
+
+  const size_t threadCount
+    = (count >= TransformHierarchy::ParallelThreshold) ?
+        std::min(static_cast<size_t>(std::max(1u, maxThreads)),
+                 parallelSubtrees.size()) :
+        1;
+  if (threadCount > 1) {
+    // Split the subtrees in chunks with roughly the same number of nodes
+    std::vector<std::vector<size_t>> chunks(threadCount);
+    const size_t nodesPerChunk = (count + threadCount - 1) / threadCount;
+    size_t chunk = 0, chunkSize = 0;
+    for (auto& s : parallelSubtrees) {
+      chunks[chunk].emplace_back(s);
+      chunkSize += _subtrees[s].second - _subtrees[s].first;
+      if (chunkSize >= nodesPerChunk && chunk + 1 < threadCount) {
+        ++chunk;
+        chunkSize = 0;
+      }
+    }
+
+    auto processChunk = [this, renderId](const std::vector<size_t>& subtrees) {
+      for (auto& s : subtrees) {
+        _updateRange(_subtrees[s].first, _subtrees[s].second, renderId);
+      }
+    };
+
+    std::vector<std::future<void>> workers;
+    workers.reserve(threadCount - 1);
+    for (size_t c = 1; c < threadCount; ++c) {
+      workers.emplace_back(
+        std::async(std::launch::async, processChunk, std::cref(chunks[c])));
+    }
+    processChunk(chunks[0]);
+    for (auto& worker : workers) {
+      worker.get();
+    }
+  }
+  else {
+    for (auto& s : parallelSubtrees) {
+      _updateRange(_subtrees[s].first, _subtrees[s].second, renderId);
+    }
+  }
+
+  // Subtrees containing fallback nodes are processed serially as they access
+  // the active camera and shared temporaries
+  for (size_t s = 0; s < _subtrees.size(); ++s) {
+    if (_subtreeHasFallback[s]) {
+      _updateRange(_subtrees[s].first, _subtrees[s].second, renderId);
+    }
+  }
+
+  // Finalize on the main thread: update flags, pose matrix and callbacks
+  size_t updatedCount = 0;
+  for (size_t i = 0; i < count; ++i) {
+    if (_finalizeNode(i)) {
+      ++updatedCount;
+    }
+  }
+
+  _hasPendingChanges = false;
+  _isUpdating        = false;
+
+  return updatedCount;
+}
+
+size_t TransformHierarchy::updateNode(int index)
+{
+  if (_isUpdating) {
+    return 0;
+  }
+
+  if (_structureDirty || index < 0
+      || static_cast<size_t>(index) >= _nodes.size()) {
+    return update();
+  }
+
+  // Topmost dirty node among the node and its ancestors, the world matrices
+  // above it are up to date
+  int top = -1;
+  for (int i = index; i >= 0; i = _parents[static_cast<size_t>(i)]) {
+    if (_nodes[static_cast<size_t>(i)]->parent()
+        != _parentNodes[static_cast<size_t>(i)]) {
+      _structureDirty = true;
+      return update();
+    }
+    if (_flags[static_cast<size_t>(i)] & TransformHierarchy::LOCAL_DIRTY) {
+      top = i;
+    }
+  }
+  if (top < 0) {
+    return 0;
+  }
+
+  const auto start = static_cast<size_t>(top);
+  const auto end   = _subtreeEnds[start];
+  _isUpdating      = true;
+
+  // Fallback nodes are handled by the full update
+  for (size_t i = start; i < end; ++i) {
+    if (_nodes[i]->parent() != _parentNodes[i]) {
+      _structureDirty = true;
+    }
+    if (_structureDirty || _prepareNode(i)) {
+      _isUpdating = false;
+      return update();
+    }
+  }
+
+  // The other dirty nodes keep the pending changes flag set
+  _updateRange(start, end, _scene->getRenderId());
+
+  size_t updatedCount = 0;
+  for (size_t i = start; i < end; ++i) {
+    if (_finalizeNode(i)) {
+      ++updatedCount;
+    }
+  }
+
+  _isUpdating = false;
+
+  return updatedCount;
+}
+
+} // end of namespace BABYLON
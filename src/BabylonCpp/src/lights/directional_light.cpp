@@ -159,18 +159,22 @@ void DirectionalLight::_buildUniformLayout()
 }
 
 void DirectionalLight::transferToEffect(Effect* /*effect*/,
-                                        const std::string& lightIndex)
+                                        unsigned int lightIndex)
 {
+  const auto& handles       = BlockUniformHandles();
+  const auto& effectHandles = effectUniformHandles(lightIndex);
+
   if (computeTransformedInformation()) {
-    _uniformBuffer->updateFloat4("vLightData", transformedDirection->x,
+    _uniformBuffer->updateFloat4(handles.vLightData, transformedDirection->x,
                                  transformedDirection->y,
-                                 transformedDirection->z, 1, lightIndex);
+                                 transformedDirection->z, 1,
+                                 effectHandles.vLightData);
     return;
   }
 
   const auto& _direction = direction();
-  _uniformBuffer->updateFloat4("vLightData", _direction.x, _direction.y,
-                               _direction.z, 1, lightIndex);
+  _uniformBuffer->updateFloat4(handles.vLightData, _direction.x, _direction.y,
+                               _direction.z, 1, effectHandles.vLightData);
 }
 
 } // end of namespace BABYLON
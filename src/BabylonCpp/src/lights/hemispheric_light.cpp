@@ -57,19 +57,23 @@ ShadowGenerator* HemisphericLight::getShadowGenerator()
 }
 
 void HemisphericLight::transferToEffect(Effect* /*effect*/,
-                                        const std::string& lightIndex)
+                                        unsigned int lightIndex)
 {
+  const auto& handles       = BlockUniformHandles();
+  const auto& effectHandles = effectUniformHandles(lightIndex);
+
   auto normalizeDirection = Vector3::Normalize(direction);
 
-  _uniformBuffer->updateFloat4("vLightData",         //
+  _uniformBuffer->updateFloat4(handles.vLightData,   //
                                normalizeDirection.x, //
                                normalizeDirection.y, //
                                normalizeDirection.z, //
                                0.f,                  //
-                               lightIndex);
+                               effectHandles.vLightData);
 
-  _uniformBuffer->updateColor3("vLightGround", groundColor.scale(intensity),
-                               lightIndex);
+  _uniformBuffer->updateColor3(handles.vLightGround,
+                               groundColor.scale(intensity),
+                               effectHandles.vLightGround);
 }
 
 Matrix* HemisphericLight::_getWorldMatrix()
@@ -5,9 +5,11 @@
 #include <babylon/engine/scene.h>
 #include <babylon/lights/directional_light.h>
 #include <babylon/lights/hemispheric_light.h>
+#include <babylon/lights/light_grid.h>
 #include <babylon/lights/point_light.h>
 #include <babylon/lights/shadows/shadow_generator.h>
 #include <babylon/lights/spot_light.h>
+#include <babylon/materials/effect.h>
 #include <babylon/materials/uniform_buffer.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/tools/serialization_helper.h>
@@ -34,6 +36,7 @@ Light::Light(const std::string& iName, Scene* scene)
     , _lightmapMode{0}
     , _parentedWorldMatrix{nullptr}
     , _worldMatrix{std::make_unique<Matrix>(Matrix::Identity())}
+    , _effectUniformHandlesIndex{-1}
 {
   _buildUniformLayout();
   _resyncMeshes();
@@ -182,8 +185,36 @@ Vector3 Light::getAbsolutePosition()
   return Vector3::Zero();
 }
 
-void Light::transferToEffect(Effect* /*effect*/,
-                             const std::string& /*lightIndex*/)
+const Light::UniformHandles& Light::BlockUniformHandles()
+{
+  static const UniformHandles handles{
+    Effect::GetUniformHandle("vLightData"),
+    Effect::GetUniformHandle("vLightDiffuse"),
+    Effect::GetUniformHandle("vLightSpecular"),
+    Effect::GetUniformHandle("vLightDirection"),
+    Effect::GetUniformHandle("vLightGround"),
+    Effect::GetUniformHandle("shadowsInfo")};
+  return handles;
+}
+
+const Light::UniformHandles&
+Light::effectUniformHandles(unsigned int lightIndex)
+{
+  if (_effectUniformHandlesIndex != static_cast<int>(lightIndex)) {
+    const auto suffix     = std::to_string(lightIndex);
+    _effectUniformHandles = {
+      Effect::GetUniformHandle("vLightData" + suffix),
+      Effect::GetUniformHandle("vLightDiffuse" + suffix),
+      Effect::GetUniformHandle("vLightSpecular" + suffix),
+      Effect::GetUniformHandle("vLightDirection" + suffix),
+      Effect::GetUniformHandle("vLightGround" + suffix),
+      Effect::GetUniformHandle("shadowsInfo" + suffix)};
+    _effectUniformHandlesIndex = static_cast<int>(lightIndex);
+  }
+  return _effectUniformHandles;
+}
+
+void Light::transferToEffect(Effect* /*effect*/, unsigned int /*lightIndex*/)
 {
 }
 
@@ -377,6 +408,12 @@ void Light::_hookArrayForIncludedOnly(
 
 void Light::_resyncMeshes()
 {
+  auto lightGrid = getScene()->lightGrid();
+  if (lightGrid) {
+    lightGrid->markLightAsDirty(this);
+    return;
+  }
+
   for (auto& mesh : getScene()->meshes) {
     mesh->_resyncLighSource(this);
   }
@@ -0,0 +1,272 @@
+#include <babylon/lights/light_grid.h>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/light.h>
+#include <babylon/mesh/abstract_mesh.h>
+
+namespace BABYLON {
+
+LightGrid::LightGrid(Scene* scene, float cellSize)
+    : maxLightsPerMesh{0}
+    , _scene{scene}
+    , _lightIndex{cellSize}
+    , _meshIndex{cellSize}
+{
+}
+
+LightGrid::~LightGrid()
+{
+}
+
+void LightGrid::addLight(Light* light)
+{
+  if (!light || stl_util::contains(_lightSlots, light)) {
+    return;
+  }
+
+  size_t slot = _lights.size();
+  if (!_freeLightSlots.empty()) {
+    slot = _freeLightSlots.back();
+    _freeLightSlots.pop_back();
+  }
+  else {
+    _lights.emplace_back(LightState());
+  }
+
+  _lights[slot]      = {light, Vector3::Zero(), 0.f, false, true};
+  _lightSlots[light] = slot;
+}
+
+void LightGrid::removeLight(Light* light)
+{
+  auto it = _lightSlots.find(light);
+  if (it == _lightSlots.end()) {
+    return;
+  }
+
+  const size_t slot = it->second;
+  if (_lightIndex.contains(slot)) {
+    _markMeshesInRange(_lights[slot]);
+    _lightIndex.remove(slot);
+  }
+  _lights[slot].light = nullptr;
+  _freeLightSlots.emplace_back(slot);
+  _lightSlots.erase(it);
+}
+
+void LightGrid::addMesh(AbstractMesh* mesh)
+{
+  if (!mesh || stl_util::contains(_meshSlots, mesh)) {
+    return;
+  }
+
+  size_t slot = _meshes.size();
+  if (!_freeMeshSlots.empty()) {
+    slot = _freeMeshSlots.back();
+    _freeMeshSlots.pop_back();
+  }
+  else {
+    _meshes.emplace_back(MeshState());
+  }
+
+  _meshes[slot]    = {mesh, Vector3::Zero(), -1.f, true};
+  _meshSlots[mesh] = slot;
+}
+
+void LightGrid::removeMesh(AbstractMesh* mesh)
+{
+  auto it = _meshSlots.find(mesh);
+  if (it == _meshSlots.end()) {
+    return;
+  }
+
+  _meshIndex.remove(it->second);
+  _meshes[it->second].mesh = nullptr;
+  _freeMeshSlots.emplace_back(it->second);
+  _meshSlots.erase(it);
+}
+
+void LightGrid::markLightAsDirty(Light* light)
+{
+  auto it = _lightSlots.find(light);
+  if (it != _lightSlots.end()) {
+    _lights[it->second].dirty = true;
+  }
+}
+
+void LightGrid::markMeshAsDirty(AbstractMesh* mesh)
+{
+  auto it = _meshSlots.find(mesh);
+  if (it != _meshSlots.end()) {
+    _meshes[it->second].dirty = true;
+  }
+}
+
+size_t LightGrid::update()
+{
+  // Moved meshes
+  for (size_t slot = 0; slot < _meshes.size(); ++slot) {
+    auto& state = _meshes[slot];
+    if (state.mesh && _readMesh(state)) {
+      _meshIndex.update(slot, state.center, state.radius);
+      state.dirty = true;
+    }
+  }
+
+  // Moved lights: the meshes in range before and after the change are
+  // reassigned
+  for (size_t slot = 0; slot < _lights.size(); ++slot) {
+    auto& state = _lights[slot];
+    if (!state.light) {
+      continue;
+    }
+    const auto previous = state;
+    if (!_readLight(state) && !state.dirty) {
+      continue;
+    }
+    if (_lightIndex.contains(slot)) {
+      _markMeshesInRange(previous);
+    }
+    if (state.enabled) {
+      _lightIndex.update(slot, state.position, state.range);
+      _markMeshesInRange(state);
+    }
+    else {
+      _lightIndex.remove(slot);
+    }
+    state.dirty = false;
+  }
+
+  size_t updatedMeshes = 0;
+  for (auto& state : _meshes) {
+    if (state.mesh && state.dirty) {
+      _assignLights(state);
+      state.dirty = false;
+      ++updatedMeshes;
+    }
+  }
+
+  return updatedMeshes;
+}
+
+float LightGrid::Score(float intensity, const Vector3& lightPosition,
+                       float range, bool isDirectional,
+                       const Vector3& meshCenter, float meshRadius)
+{
+  if (isDirectional) {
+    return intensity;
+  }
+
+  const float distance = std::max(
+    Vector3::Distance(lightPosition, meshCenter) - meshRadius, 0.f);
+  if (range >= std::numeric_limits<float>::max()) {
+    return intensity / (1.f + distance * distance);
+  }
+  if (distance >= range) {
+    return 0.f;
+  }
+
+  const float falloff = 1.f - distance / range;
+  return intensity * falloff * falloff;
+}
+
+bool LightGrid::_isDirectional(Light* light) const
+{
+  const auto type = light->getTypeID();
+  return type == Light::LIGHTTYPEID_DIRECTIONALLIGHT
+         || type == Light::LIGHTTYPEID_HEMISPHERICLIGHT;
+}
+
+bool LightGrid::_readLight(LightState& state) const
+{
+  auto light         = state.light;
+  const bool enabled = light->isEnabled();
+  Vector3 position   = Vector3::Zero();
+  float range        = std::numeric_limits<float>::infinity();
+  if (!_isDirectional(light)) {
+    position = light->getAbsolutePosition();
+    range    = light->range;
+  }
+
+  const bool changed = enabled != state.enabled || range != state.range
+                       || !position.equals(state.position);
+  state.enabled  = enabled;
+  state.position = position;
+  state.range    = range;
+
+  return changed;
+}
+
+bool LightGrid::_readMesh(MeshState& state) const
+{
+  auto boundingInfo = state.mesh->getBoundingInfo();
+  if (!boundingInfo) {
+    return false;
+  }
+
+  const auto& sphere = boundingInfo->boundingSphere;
+  if (sphere.radiusWorld == state.radius
+      && sphere.centerWorld.equals(state.center)) {
+    return false;
+  }
+
+  state.center = sphere.centerWorld;
+  state.radius = sphere.radiusWorld;
+  return true;
+}
+
+void LightGrid::_markMeshesInRange(const LightState& state)
+{
+  _meshIndex.query(state.position, state.range, _candidates);
+  for (auto slot : _candidates) {
+    _meshes[slot].dirty = true;
+  }
+}
+
+void LightGrid::_assignLights(MeshState& state)
+{
+  auto mesh = state.mesh;
+
+  _scoredLights.clear();
+  _lightIndex.query(state.center, std::max(state.radius, 0.f), _candidates);
+  for (auto slot : _candidates) {
+    const auto& lightState = _lights[slot];
+    auto light             = lightState.light;
+    if (!light->canAffectMesh(mesh)) {
+      continue;
+    }
+    _scoredLights.emplace_back(
+      Score(light->intensity, lightState.position, lightState.range,
+            _isDirectional(light), state.center, state.radius),
+      light);
+  }
+
+  // Same priority rules as Scene::sortLightsByPriority, then relevance
+  std::stable_sort(
+    _scoredLights.begin(), _scoredLights.end(),
+    [](const std::pair<float, Light*>& a, const std::pair<float, Light*>& b) {
+      if (a.second->shadowEnabled != b.second->shadowEnabled) {
+        return a.second->shadowEnabled;
+      }
+      if (a.second->renderPriority() != b.second->renderPriority()) {
+        return a.second->renderPriority() > b.second->renderPriority();
+      }
+      return a.first > b.first;
+    });
+  if (maxLightsPerMesh > 0 && _scoredLights.size() > maxLightsPerMesh) {
+    _scoredLights.resize(maxLightsPerMesh);
+  }
+
+  _lightSources.clear();
+  for (const auto& scoredLight : _scoredLights) {
+    _lightSources.emplace_back(scoredLight.second);
+  }
+  if (_lightSources != mesh->_lightSources) {
+    mesh->_lightSources = _lightSources;
+    mesh->_markSubMeshesAsLightDirty();
+  }
+}
+
+} // end of namespace BABYLON
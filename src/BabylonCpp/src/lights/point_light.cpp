@@ -110,21 +110,23 @@ void PointLight::_buildUniformLayout()
   _uniformBuffer->create();
 }
 
-void PointLight::transferToEffect(Effect* /*effect*/,
-                                  const std::string& lightIndex)
+void PointLight::transferToEffect(Effect* /*effect*/, unsigned int lightIndex)
 {
+  const auto& handles       = BlockUniformHandles();
+  const auto& effectHandles = effectUniformHandles(lightIndex);
+
   if (computeTransformedInformation()) {
-    _uniformBuffer->updateFloat4("vLightData",             //
+    _uniformBuffer->updateFloat4(handles.vLightData,       //
                                  (*transformedPosition).x, //
                                  (*transformedPosition).y, //
                                  (*transformedPosition).z, //
                                  0.f,                      //
-                                 lightIndex);
+                                 effectHandles.vLightData);
     return;
   }
 
-  _uniformBuffer->updateFloat4("vLightData", position.x, position.y, position.z,
-                               0, lightIndex);
+  _uniformBuffer->updateFloat4(handles.vLightData, position.x, position.y,
+                               position.z, 0, effectHandles.vLightData);
 }
 
 } // end of namespace BABYLON
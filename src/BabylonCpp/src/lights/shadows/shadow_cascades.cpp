@@ -0,0 +1,97 @@
+#include <babylon/lights/shadows/shadow_cascades.h>
+
+#include <babylon/math/frustum.h>
+
+namespace BABYLON {
+
+constexpr unsigned int ShadowCascades::MaxCascades;
+
+std::vector<float> ShadowCascades::ComputeSplits(unsigned int cascadeCount,
+                                                 float nearZ, float farZ,
+                                                 float lambda)
+{
+  const unsigned int count = (cascadeCount > 0) ? cascadeCount : 1;
+  std::vector<float> splits(count + 1);
+  for (unsigned int i = 0; i <= count; ++i) {
+    const float ratio   = static_cast<float>(i) / static_cast<float>(count);
+    const float uniform = nearZ + (farZ - nearZ) * ratio;
+    const float logarithmic
+      = (nearZ > 0.f) ? nearZ * std::pow(farZ / nearZ, ratio) : uniform;
+    splits[i] = lambda * logarithmic + (1.f - lambda) * uniform;
+  }
+  // Exact bounds
+  splits.front() = nearZ;
+  splits.back()  = farZ;
+
+  return splits;
+}
+
+void ShadowCascades::ComputeSliceSphere(const Matrix& inverseViewMatrix,
+                                        float fov, float aspectRatio,
+                                        float nearZ, float farZ,
+                                        Vector3& center, float& radius)
+{
+  // Squared tangent of the angle between the view axis and the frustum corners
+  const float tanY = std::tan(fov * 0.5f);
+  const float tanX = tanY * aspectRatio;
+  const float tan2 = tanX * tanX + tanY * tanY;
+
+  // Center on the view axis, equidistant to the near and far corners
+  float z = (farZ + nearZ) * (1.f + tan2) * 0.5f;
+  if (z > farZ) {
+    z = farZ;
+  }
+  const float nearDistance2
+    = (z - nearZ) * (z - nearZ) + nearZ * nearZ * tan2;
+  const float farDistance2 = (farZ - z) * (farZ - z) + farZ * farZ * tan2;
+  radius = std::sqrt(std::max(nearDistance2, farDistance2));
+
+  // Rounded up, against floating point jitter of the texel size
+  radius = std::ceil(radius * 16.f) / 16.f;
+  center = Vector3::TransformCoordinates(Vector3(0.f, 0.f, z),
+                                         inverseViewMatrix);
+}
+
+Matrix ShadowCascades::LightViewMatrix(const Vector3& lightDirection)
+{
+  Vector3 direction;
+  Vector3::NormalizeToRef(lightDirection, direction);
+  // Avoids an up vector parallel to the light direction
+  const bool vertical
+    = std::abs(Vector3::Dot(direction, Vector3::Up())) > 0.99f;
+  const Vector3 up = vertical ? Vector3::Forward() : Vector3::Up();
+
+  Matrix viewMatrix;
+  Matrix::LookAtLHToRef(Vector3::Zero(), direction, up, viewMatrix);
+  return viewMatrix;
+}
+
+void ShadowCascades::ComputeTransform(Matrix& lightViewMatrix, int tileSize,
+                                      float casterMinZ, ShadowCascade& cascade)
+{
+  const auto center
+    = Vector3::TransformCoordinates(cascade.center, lightViewMatrix);
+  const float radius = cascade.radius;
+
+  // Moves the projection by whole texels only
+  const float texelSize = 2.f * radius / static_cast<float>(tileSize);
+  const float x         = std::floor(center.x / texelSize) * texelSize;
+  const float y         = std::floor(center.y / texelSize) * texelSize;
+
+  Matrix::OrthoOffCenterLHToRef(x - radius, x + radius, y - radius,
+                                y + radius,
+                                std::min(center.z - radius, casterMinZ),
+                                center.z + radius, cascade.projectionMatrix);
+  lightViewMatrix.multiplyToRef(cascade.projectionMatrix,
+                                cascade.transformMatrix);
+  Frustum::GetPlanesToRef(cascade.transformMatrix, cascade.frustumPlanes);
+}
+
+void ShadowCascades::AtlasGrid(unsigned int cascadeCount,
+                               unsigned int& columns, unsigned int& rows)
+{
+  columns = (cascadeCount > 1) ? 2 : 1;
+  rows    = (cascadeCount > 2) ? 2 : 1;
+}
+
+} // end of namespace BABYLON
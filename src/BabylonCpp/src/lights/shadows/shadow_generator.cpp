@@ -5,6 +5,9 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/core/json.h>
 #include <babylon/core/string.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bounding_sphere.h>
+#include <babylon/culling/octrees/octree.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
 #include <babylon/lights/ishadow_light.h>
@@ -19,6 +22,8 @@
 #include <babylon/materials/uniform_buffer.h>
 #include <babylon/math/vector2.h>
 #include <babylon/mesh/_instances_batch.h>
+#include <babylon/mesh/instanced_mesh.h>
+#include <babylon/mesh/mesh.h>
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/postprocess/pass_post_process.h>
@@ -28,6 +33,34 @@
 
 namespace BABYLON {
 
+namespace {
+
+// The casters which never move nor deform
+bool isStaticCaster(Mesh* mesh)
+{
+  if (!mesh->isWorldMatrixFrozen() || mesh->skeleton()
+      || mesh->morphTargetManager()) {
+    return false;
+  }
+
+  for (auto& instance : mesh->instances) {
+    if (!instance->isWorldMatrixFrozen()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// The instances are drawn with their source mesh
+AbstractMesh* renderingMesh(AbstractMesh* mesh)
+{
+  auto instance = dynamic_cast<InstancedMesh*>(mesh);
+  return instance ? instance->sourceMesh() : mesh;
+}
+
+} // end of anonymous namespace
+
 ShadowGenerator::ShadowGenerator(int mapSize, IShadowLight* light)
     : ShadowGenerator(ISize{mapSize, mapSize}, light)
 {
@@ -36,6 +69,9 @@ ShadowGenerator::ShadowGenerator(int mapSize, IShadowLight* light)
 ShadowGenerator::ShadowGenerator(const ISize& mapSize, IShadowLight* light)
     : blurScale{2.f}
     , forceBackFacesOnly{false}
+    , cacheStaticCasters{false}
+    , cascadeLambda{0.5f}
+    , cascadeMaxZ{0.f}
     , _filter{ShadowGenerator::FILTER_NONE}
     , _blurBoxOffset{0}
     , _bias{0.00005f}
@@ -60,6 +96,14 @@ ShadowGenerator::ShadowGenerator(const ISize& mapSize, IShadowLight* light)
     , _useFullFloat{true}
     , _textureType{0}
     , _isCube{false}
+    , _staticCasterCache{nullptr}
+    , _staticCasterCacheValid{false}
+    , _staticCasterCacheRestored{false}
+    , _subMeshesReady{true}
+    , _staticCasterCacheTransform{Matrix::Zero()}
+    , _cascadeCount{1}
+    , _cascadeMatrices(16 * ShadowCascades::MaxCascades, 0.f)
+    , _cascadeDrawCount{0}
 {
   light->_shadowGenerator = this;
 
@@ -84,16 +128,20 @@ void ShadowGenerator::_initializeGenerator(int boxBlurOffset)
 
   // Render target
   _shadowMap = std::make_unique<RenderTargetTexture>(
-    _light->name + "_shadowMap", _mapSize, _scene, false, true, _textureType,
-    _light->needCube());
+    _light->name + "_shadowMap", _getShadowMapSize(), _scene, false, true,
+    _textureType, _light->needCube());
   _shadowMap->wrapU                     = TextureConstants::CLAMP_ADDRESSMODE;
   _shadowMap->wrapV                     = TextureConstants::CLAMP_ADDRESSMODE;
   _shadowMap->anisotropicFilteringLevel = 1;
   _shadowMap->updateSamplingMode(TextureConstants::BILINEAR_SAMPLINGMODE);
   _shadowMap->renderParticles = false;
 
-  _shadowMap->onBeforeRenderObservable.add(
-    [this](unsigned int faceIndex) { _currentFaceIndex = faceIndex; });
+  _shadowMap->onBeforeRenderObservable.add([this](unsigned int faceIndex) {
+    _currentFaceIndex = faceIndex;
+    if (_isCascaded()) {
+      _updateCascades();
+    }
+  });
 
   _shadowMap->onAfterUnbindObservable.add([this, &boxBlurOffset]() {
     if (!useBlurExponentialShadowMap()) {
@@ -102,7 +150,7 @@ void ShadowGenerator::_initializeGenerator(int boxBlurOffset)
 
     if (!_shadowMap2) {
       _shadowMap2 = std::make_unique<RenderTargetTexture>(
-        _light->name + "_shadowMap", _mapSize, _scene, false);
+        _light->name + "_shadowMap", _getShadowMapSize(), _scene, false);
       _shadowMap2->wrapU = TextureConstants::CLAMP_ADDRESSMODE;
       _shadowMap2->wrapV = TextureConstants::CLAMP_ADDRESSMODE;
       _shadowMap2->updateSamplingMode(TextureConstants::BILINEAR_SAMPLINGMODE);
@@ -128,6 +176,18 @@ void ShadowGenerator::_initializeGenerator(int boxBlurOffset)
              const std::vector<SubMesh*>& transparentSubMeshes,
              const std::vector<SubMesh*>& alphaTestSubMeshes) {
 
+        _cascadeDrawCount = 0;
+
+        if (_canCacheStaticCasters()) {
+          std::vector<SubMesh*> subMeshes(opaqueSubMeshes);
+          stl_util::concat(subMeshes, alphaTestSubMeshes);
+          if (_transparencyShadow) {
+            stl_util::concat(subMeshes, transparentSubMeshes);
+          }
+          _renderWithStaticCasterCache(subMeshes);
+          return;
+        }
+
         for (const auto& opaqueSubMesh : opaqueSubMeshes) {
           renderSubMesh(opaqueSubMesh);
         }
@@ -141,16 +201,191 @@ void ShadowGenerator::_initializeGenerator(int boxBlurOffset)
             renderSubMesh(transparentSubMesh);
           }
         }
+
+        if (_isCascaded()) {
+          // Whole atlas for the blur post processes
+          const auto size = _getShadowMapSize();
+          _scene->getEngine()->setDirectViewport(0, 0, size.width,
+                                                 size.height);
+        }
       };
 
   _shadowMap->onClearObservable.add([this](Engine* engine) {
-    if (useExponentialShadowMap() || useBlurExponentialShadowMap()) {
-      engine->clear(Color4(0.f, 0.f, 0.f, 0.f), true, true, true);
+    // Starts from the shadows of the static casters when still valid
+    _staticCasterCacheRestored
+      = _canCacheStaticCasters() && _staticCasterCacheValid
+        && _staticCasterCacheTransform.equals(getTransformMatrix())
+        && engine->copyFramebuffer(_staticCasterCache,
+                                   _shadowMap->getInternalTexture());
+    if (!_staticCasterCacheRestored) {
+      _clearShadowMap(engine);
+    }
+  });
+}
+
+void ShadowGenerator::_clearShadowMap(Engine* engine)
+{
+  if (useExponentialShadowMap() || useBlurExponentialShadowMap()) {
+    engine->clear(Color4(0.f, 0.f, 0.f, 0.f), true, true, true);
+  }
+  else {
+    engine->clear(Color4(1.f, 1.f, 1.f, 1.f), true, true, true);
+  }
+}
+
+bool ShadowGenerator::_canCacheStaticCasters() const
+{
+  return cacheStaticCasters && !_light->needCube() && !_isCascaded()
+         && _scene->getEngine()->webGLVersion() >= 2.f;
+}
+
+void ShadowGenerator::_renderWithStaticCasterCache(
+  const std::vector<SubMesh*>& subMeshes)
+{
+  _staticSubMeshes.clear();
+  _dynamicSubMeshes.clear();
+  for (const auto& subMesh : subMeshes) {
+    if (isStaticCaster(subMesh->getRenderingMesh())) {
+      _staticSubMeshes.emplace_back(subMesh);
     }
     else {
-      engine->clear(Color4(1.f, 1.f, 1.f, 1.f), true, true, true);
+      _dynamicSubMeshes.emplace_back(subMesh);
     }
-  });
+  }
+
+  // Redraws the static casters and saves them when the restored cache is
+  // missing or outdated
+  if (!_staticCasterCacheRestored
+      || _staticSubMeshes != _staticCasterSubMeshes) {
+    auto engine = _scene->getEngine();
+    if (_staticCasterCacheRestored) {
+      _clearShadowMap(engine);
+    }
+
+    _subMeshesReady = true;
+    for (const auto& subMesh : _staticSubMeshes) {
+      renderSubMesh(subMesh);
+    }
+
+    if (!_staticCasterCache) {
+      _staticCasterCache = engine->createRenderTargetTexture(
+        _getShadowMapSize(), _shadowMap->renderTargetOptions());
+    }
+    _staticCasterCacheValid
+      = _subMeshesReady
+        && engine->copyFramebuffer(_shadowMap->getInternalTexture(),
+                                   _staticCasterCache);
+    _staticCasterCacheTransform = getTransformMatrix();
+    _staticCasterSubMeshes      = _staticSubMeshes;
+  }
+
+  for (const auto& subMesh : _dynamicSubMeshes) {
+    renderSubMesh(subMesh);
+  }
+}
+
+void ShadowGenerator::invalidateStaticCasterCache()
+{
+  _staticCasterCacheValid = false;
+}
+
+void ShadowGenerator::_releaseStaticCasterCache()
+{
+  if (_staticCasterCache) {
+    _scene->getEngine()->releaseInternalTexture(_staticCasterCache);
+    _staticCasterCache = nullptr;
+  }
+  _staticCasterCacheValid = false;
+  _staticCasterSubMeshes.clear();
+}
+
+bool ShadowGenerator::_isCascaded() const
+{
+  return _cascadeCount > 1 && !_light->needCube()
+         && _light->getTypeID() == Light::LIGHTTYPEID_DIRECTIONALLIGHT;
+}
+
+ISize ShadowGenerator::_getShadowMapSize() const
+{
+  if (!_isCascaded()) {
+    return _mapSize;
+  }
+
+  unsigned int columns = 1, rows = 1;
+  ShadowCascades::AtlasGrid(_cascadeCount, columns, rows);
+  return ISize{_mapSize.width * static_cast<int>(columns),
+               _mapSize.height * static_cast<int>(rows)};
+}
+
+void ShadowGenerator::_updateCascades()
+{
+  auto camera = _scene->activeCamera;
+  if (!camera) {
+    return;
+  }
+
+  auto engine       = _scene->getEngine();
+  const float nearZ = camera->minZ;
+  const float farZ  = (cascadeMaxZ > nearZ && cascadeMaxZ < camera->maxZ) ?
+                       cascadeMaxZ :
+                       camera->maxZ;
+  const auto splits = ShadowCascades::ComputeSplits(_cascadeCount, nearZ,
+                                                    farZ, cascadeLambda);
+
+  const float aspectRatio = engine->getAspectRatio(camera);
+  float fov               = camera->fov;
+  if (camera->fovMode == Camera::FOVMODE_HORIZONTAL_FIXED) {
+    fov = 2.f * std::atan(std::tan(fov * 0.5f) / aspectRatio);
+  }
+  Matrix inverseViewMatrix;
+  camera->getViewMatrix().invertToRef(inverseViewMatrix);
+  auto lightViewMatrix
+    = ShadowCascades::LightViewMatrix(_light->getShadowDirection(0));
+
+  // Closest caster to the light
+  auto& renderList = _shadowMap->renderList;
+  float casterMinZ = std::numeric_limits<float>::max();
+  _casterCascades.clear();
+  for (auto& mesh : renderList) {
+    if (!mesh) {
+      continue;
+    }
+    const auto& boundingSphere = mesh->getBoundingInfo()->boundingSphere;
+    const auto center          = Vector3::TransformCoordinates(
+      boundingSphere.centerWorld, lightViewMatrix);
+    casterMinZ = std::min(casterMinZ, center.z - boundingSphere.radiusWorld);
+    _casterCascades[renderingMesh(mesh)] = 0;
+  }
+
+  const int tileSize = std::min(_mapSize.width, _mapSize.height);
+  auto octree        = _scene->selectionOctree();
+  _cascades.resize(_cascadeCount);
+  for (unsigned int i = 0; i < _cascadeCount; ++i) {
+    auto& cascade = _cascades[i];
+    cascade.nearZ = splits[i];
+    cascade.farZ  = splits[i + 1];
+    ShadowCascades::ComputeSliceSphere(inverseViewMatrix, fov, aspectRatio,
+                                       cascade.nearZ, cascade.farZ,
+                                       cascade.center, cascade.radius);
+    ShadowCascades::ComputeTransform(lightViewMatrix, tileSize, casterMinZ,
+                                     cascade);
+    cascade.transformMatrix.copyToArray(_cascadeMatrices, 16 * i);
+
+    // Casters culling, the selection octree of the scene providing the
+    // candidates when available
+    const auto& candidates
+      = octree ? octree->select(cascade.frustumPlanes, false) : renderList;
+    for (auto& mesh : candidates) {
+      if (!mesh) {
+        continue;
+      }
+      auto it = _casterCascades.find(renderingMesh(mesh));
+      if (it != _casterCascades.end()
+          && mesh->isInFrustum(cascade.frustumPlanes)) {
+        it->second |= 1u << i;
+      }
+    }
+  }
 }
 
 ShadowGenerator::~ShadowGenerator()
@@ -165,6 +400,7 @@ float ShadowGenerator::bias() const
 void ShadowGenerator::setBias(float iBias)
 {
   _bias = iBias;
+  invalidateStaticCasterCache();
 }
 
 int ShadowGenerator::blurBoxOffset() const
@@ -191,9 +427,10 @@ void ShadowGenerator::setBlurBoxOffset(int value)
     _textureType));
   _boxBlurPostprocess = std::move(_boxBlurPostprocessPtr);
   _boxBlurPostprocess->onApplyObservable.add([&](Effect* effect) {
+    const auto size = _getShadowMapSize();
     effect->setFloat2("screenSize",
-                      static_cast<float>(_mapSize.width) / blurScale,
-                      static_cast<float>(_mapSize.height) / blurScale);
+                      static_cast<float>(size.width) / blurScale,
+                      static_cast<float>(size.height) / blurScale);
   });
 }
 
@@ -205,6 +442,7 @@ float ShadowGenerator::depthScale() const
 void ShadowGenerator::setDepthScale(float value)
 {
   _depthScale = value;
+  invalidateStaticCasterCache();
 }
 
 unsigned int ShadowGenerator::filter() const
@@ -220,6 +458,7 @@ void ShadowGenerator::setFilter(unsigned int value)
 
   _filter = value;
   _applyFilterValues();
+  invalidateStaticCasterCache();
 
   _light->_markMeshesAsLightDirty();
 }
@@ -264,6 +503,41 @@ void ShadowGenerator::setUseBlurExponentialShadowMap(bool value)
   }
 }
 
+unsigned int ShadowGenerator::cascadeCount() const
+{
+  return _cascadeCount;
+}
+
+void ShadowGenerator::setCascadeCount(unsigned int count)
+{
+  if (count < 1) {
+    count = 1;
+  }
+  else if (count > ShadowCascades::MaxCascades) {
+    count = ShadowCascades::MaxCascades;
+  }
+
+  if (_cascadeCount == count) {
+    return;
+  }
+
+  _cascadeCount = count;
+  _cascades.clear();
+  _casterCascades.clear();
+  std::fill(_cascadeMatrices.begin(), _cascadeMatrices.end(), 0.f);
+  recreateShadowMap();
+}
+
+const std::vector<ShadowCascade>& ShadowGenerator::cascades() const
+{
+  return _cascades;
+}
+
+size_t ShadowGenerator::cascadeDrawCount() const
+{
+  return _cascadeDrawCount;
+}
+
 void ShadowGenerator::renderSubMesh(SubMesh* subMesh)
 {
   auto mesh   = subMesh->getRenderingMesh();
@@ -293,7 +567,6 @@ void ShadowGenerator::renderSubMesh(SubMesh* subMesh)
 
     _effect->setFloat2("biasAndScale", bias(), depthScale());
 
-    _effect->setMatrix("viewProjection", getTransformMatrix());
     _effect->setVector3("lightPosition", getLight()->position);
 
     if (getLight()->needCube()) {
@@ -319,12 +592,38 @@ void ShadowGenerator::renderSubMesh(SubMesh* subMesh)
     }
 
     // Draw
-    mesh->_processRendering(subMesh, _effect, Material::TriangleFillMode, batch,
-                            hardwareInstancedRendering,
-                            [this](bool /*isInstance*/, Matrix world,
-                                   Material* /*effectiveMaterial*/) {
-                              _effect->setMatrix("world", world);
-                            });
+    const auto draw = [&]() {
+      mesh->_processRendering(subMesh, _effect, Material::TriangleFillMode,
+                              batch, hardwareInstancedRendering,
+                              [this](bool /*isInstance*/, Matrix world,
+                                     Material* /*effectiveMaterial*/) {
+                                _effect->setMatrix("world", world);
+                              });
+      ++_cascadeDrawCount;
+    };
+
+    if (_isCascaded() && !_cascades.empty()) {
+      // Bound once, drawn in each cascade in which the caster is visible
+      const auto it = _casterCascades.find(mesh);
+      const unsigned int visibleCascades
+        = (it != _casterCascades.end()) ? it->second : ~0u;
+      unsigned int columns = 1, rows = 1;
+      ShadowCascades::AtlasGrid(_cascadeCount, columns, rows);
+      for (unsigned int i = 0; i < _cascades.size(); ++i) {
+        if (visibleCascades & (1u << i)) {
+          engine->setDirectViewport(
+            static_cast<int>(i % columns) * _mapSize.width,
+            static_cast<int>(i / columns) * _mapSize.height, _mapSize.width,
+            _mapSize.height);
+          _effect->setMatrix("viewProjection", _cascades[i].transformMatrix);
+          draw();
+        }
+      }
+    }
+    else {
+      _effect->setMatrix("viewProjection", getTransformMatrix());
+      draw();
+    }
 
     if (forceBackFacesOnly) {
       engine->setState(true, 0, false, false);
@@ -333,6 +632,7 @@ void ShadowGenerator::renderSubMesh(SubMesh* subMesh)
   else {
     // Need to reset refresh rate of the shadowMap
     _shadowMap->resetRefreshCounter();
+    _subMeshesReady = false;
   }
 }
 
@@ -352,7 +652,7 @@ void ShadowGenerator::_applyFilterValues()
 void ShadowGenerator::recreateShadowMap()
 {
   // Track render list.
-  auto& renderList = _shadowMap->renderList;
+  auto renderList = _shadowMap->renderList;
   // Clean up existing data.
   _disposeRTTandPostProcesses();
   // Reinitializes.
@@ -537,6 +837,7 @@ ShadowGenerator& ShadowGenerator::setDarkness(float darkness)
 ShadowGenerator& ShadowGenerator::setTransparencyShadow(bool hasShadow)
 {
   _transparencyShadow = hasShadow;
+  invalidateStaticCasterCache();
   return *this;
 }
 
@@ -550,6 +851,8 @@ Vector2 ShadowGenerator::_packHalf(float depth)
 
 void ShadowGenerator::_disposeRTTandPostProcesses()
 {
+  _releaseStaticCasterCache();
+
   if (_shadowMap) {
     _shadowMap->dispose();
     _shadowMap = nullptr;
@@ -686,6 +989,10 @@ void ShadowGenerator::prepareDefines(MaterialDefines& defines,
   if (light->needCube()) {
     defines.shadowcubes[lightIndex] = true;
   }
+
+  if (_isCascaded()) {
+    defines.shadowcsms[lightIndex] = true;
+  }
 }
 
 bool ShadowGenerator::bindShadowLight(const std::string& lightIndex,
@@ -701,6 +1008,15 @@ bool ShadowGenerator::bindShadowLight(const std::string& lightIndex,
 
   if (!light->needCube()) {
     effect->setMatrix("lightMatrix" + lightIndex, getTransformMatrix());
+    if (_isCascaded()) {
+      unsigned int columns = 1, rows = 1;
+      ShadowCascades::AtlasGrid(_cascadeCount, columns, rows);
+      effect->setMatrices("cascadeMatrices" + lightIndex, _cascadeMatrices);
+      effect->setFloat3("cascadeInfo" + lightIndex,
+                        static_cast<float>(_cascadeCount),
+                        static_cast<float>(columns),
+                        static_cast<float>(rows));
+    }
   }
   else {
     if (!depthValuesAlreadySet) {
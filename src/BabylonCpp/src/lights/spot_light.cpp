@@ -82,38 +82,40 @@ void SpotLight::_buildUniformLayout()
   _uniformBuffer->create();
 }
 
-void SpotLight::transferToEffect(Effect* /*effect*/,
-                                 const std::string& lightIndex)
+void SpotLight::transferToEffect(Effect* /*effect*/, unsigned int lightIndex)
 {
+  const auto& handles       = BlockUniformHandles();
+  const auto& effectHandles = effectUniformHandles(lightIndex);
+
   auto normalizeDirection = Vector3::Zero();
 
   if (computeTransformedInformation()) {
-    _uniformBuffer->updateFloat4("vLightData",             // Name
-                                 (*transformedPosition).x, // X
-                                 (*transformedPosition).y, // Y
-                                 (*transformedPosition).z, // Z
-                                 exponent,                 // Value
-                                 lightIndex);              // Index
+    _uniformBuffer->updateFloat4(handles.vLightData,        // Handle
+                                 (*transformedPosition).x,  // X
+                                 (*transformedPosition).y,  // Y
+                                 (*transformedPosition).z,  // Z
+                                 exponent,                  // Value
+                                 effectHandles.vLightData); // Effect handle
 
     normalizeDirection = Vector3::Normalize(*transformedDirection);
   }
   else {
-    _uniformBuffer->updateFloat4("vLightData", // Name
-                                 position.x,   // X
-                                 position.y,   // Y
-                                 position.z,   // Z
-                                 exponent,     // Value
-                                 lightIndex);  // Index
+    _uniformBuffer->updateFloat4(handles.vLightData,        // Handle
+                                 position.x,                // X
+                                 position.y,                // Y
+                                 position.z,                // Z
+                                 exponent,                  // Value
+                                 effectHandles.vLightData); // Effect handle
 
     normalizeDirection = Vector3::Normalize(direction());
   }
 
-  _uniformBuffer->updateFloat4("vLightDirection",        // Name
-                               normalizeDirection.x,     // X
-                               normalizeDirection.y,     // Y
-                               normalizeDirection.z,     // Z
-                               std::cos(angle() * 0.5f), // Value
-                               lightIndex);              // Index
+  _uniformBuffer->updateFloat4(handles.vLightDirection,        // Handle
+                               normalizeDirection.x,           // X
+                               normalizeDirection.y,           // Y
+                               normalizeDirection.z,           // Z
+                               std::cos(angle() * 0.5f),       // Value
+                               effectHandles.vLightDirection); // Effect handle
 }
 
 } // end of namespace BABYLON
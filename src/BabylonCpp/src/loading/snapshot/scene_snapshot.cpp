@@ -0,0 +1,1031 @@
+#include <babylon/loading/snapshot/scene_snapshot.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_key.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/arc_rotate_camera.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/core/logging.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/lights/spot_light.h>
+#include <babylon/loading/snapshot/snapshot_record.h>
+#include <babylon/materials/multi_material.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/geometry.h>
+#include <babylon/mesh/instanced_mesh.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/sub_mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+namespace BABYLON {
+
+constexpr uint32_t SceneSnapshot::SceneTag;
+constexpr uint32_t SceneSnapshot::VerticesTag;
+constexpr uint32_t SceneSnapshot::IndicesTag;
+
+namespace {
+
+constexpr int32_t NoIndex             = -1;
+constexpr uint32_t NoBlob            = std::numeric_limits<uint32_t>::max();
+constexpr char ArcRotateCameraType[] = "ArcRotateCamera";
+constexpr char FreeCameraType[]      = "FreeCamera";
+
+void writeBool(SnapshotRecordWriter& writer, bool value)
+{
+  writer.write<uint8_t>(value ? 1 : 0);
+}
+
+bool readBool(SnapshotRecordReader& reader)
+{
+  return reader.read<uint8_t>() != 0;
+}
+
+void writeFloats(SnapshotRecordWriter& writer, const Float32Array& values)
+{
+  for (float value : values) {
+    writer.write(value);
+  }
+}
+
+Float32Array readFloats(SnapshotRecordReader& reader, size_t count)
+{
+  Float32Array values(count);
+  for (auto& value : values) {
+    reader.read(value);
+  }
+  return values;
+}
+
+template <typename T>
+int32_t indexOf(const std::vector<T*>& array, const T* element)
+{
+  const auto it = std::find(array.begin(), array.end(), element);
+  return (element && it != array.end()) ?
+           static_cast<int32_t>(it - array.begin()) :
+           NoIndex;
+}
+
+template <typename T>
+T* elementAt(const std::vector<T*>& array, int32_t index)
+{
+  return (index >= 0 && static_cast<size_t>(index) < array.size()) ?
+           array[static_cast<size_t>(index)] :
+           nullptr;
+}
+
+void writeNode(SnapshotRecordWriter& writer, Node* node)
+{
+  writer.writeString(node->name);
+  writer.writeString(node->id);
+  writer.writeString(node->parent() ? node->parent()->id : "");
+}
+
+void readNode(SnapshotRecordReader& reader, Node* node)
+{
+  node->id               = reader.readString();
+  node->_waitingParentId = reader.readString();
+}
+
+void writeRanges(SnapshotRecordWriter& writer,
+                 const std::vector<AnimationRange>& ranges)
+{
+  writer.write<uint32_t>(static_cast<uint32_t>(ranges.size()));
+  for (const auto& range : ranges) {
+    writer.writeString(range.name);
+    writer.write(range.from);
+    writer.write(range.to);
+  }
+}
+
+template <typename T>
+void readRanges(SnapshotRecordReader& reader, T* target)
+{
+  const auto count = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < count && !reader.failed(); ++i) {
+    const auto name = reader.readString();
+    const auto from = reader.read<float>();
+    const auto to   = reader.read<float>();
+    target->createAnimationRange(name, static_cast<int>(from),
+                                 static_cast<int>(to));
+  }
+}
+
+void writeTransform(SnapshotRecordWriter& writer, AbstractMesh* mesh)
+{
+  writeFloats(writer, mesh->position().asArray());
+  writeFloats(writer, mesh->rotation().asArray());
+  writeBool(writer, mesh->rotationQuaternionSet());
+  writeFloats(writer, mesh->rotationQuaternion().asArray());
+  writeFloats(writer, mesh->scaling().asArray());
+}
+
+void readTransform(SnapshotRecordReader& reader, AbstractMesh* mesh)
+{
+  mesh->setPosition(Vector3::FromArray(readFloats(reader, 3)));
+  mesh->setRotation(Vector3::FromArray(readFloats(reader, 3)));
+  const bool rotationQuaternionSet = readBool(reader);
+  const auto rotationQuaternion = Quaternion::FromArray(readFloats(reader, 4));
+  if (rotationQuaternionSet) {
+    mesh->setRotationQuaternion(rotationQuaternion);
+  }
+  mesh->setScaling(Vector3::FromArray(readFloats(reader, 3)));
+}
+
+// Number of floats of a key value, 0 for the types without snapshot support
+size_t componentCount(int dataType)
+{
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return 1;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return 3;
+    case Animation::ANIMATIONTYPE_QUATERNION:
+    case Animation::ANIMATIONTYPE_COLOR4:
+      return 4;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      return 16;
+    case Animation::ANIMATIONTYPE_VECTOR2:
+    case Animation::ANIMATIONTYPE_SIZE:
+      return 2;
+    default:
+      return 0;
+  }
+}
+
+void writeAnimationValue(Float32Array& values, int dataType,
+                         const AnimationValue& value)
+{
+  Float32Array components;
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      components = {value.floatData};
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      components = value.vector3Data.asArray();
+      break;
+    case Animation::ANIMATIONTYPE_COLOR3:
+      components = value.color3Data.asArray();
+      break;
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      components = value.quaternionData.asArray();
+      break;
+    case Animation::ANIMATIONTYPE_COLOR4:
+      components = value.color4Data.asArray();
+      break;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      components = value.matrixData.asArray();
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      components = value.vector2Data.asArray();
+      break;
+    case Animation::ANIMATIONTYPE_SIZE:
+      components = {static_cast<float>(value.sizeData.width),
+                    static_cast<float>(value.sizeData.height)};
+      break;
+    default:
+      break;
+  }
+  values.insert(values.end(), components.begin(), components.end());
+}
+
+AnimationValue readAnimationValue(const Float32Array& values, size_t offset,
+                                  int dataType)
+{
+  const float* v = values.data() + offset;
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      return AnimationValue(Vector3(v[0], v[1], v[2]));
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return AnimationValue(Color3(v[0], v[1], v[2]));
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      return AnimationValue(Quaternion(v[0], v[1], v[2], v[3]));
+    case Animation::ANIMATIONTYPE_COLOR4:
+      return AnimationValue(Color4(v[0], v[1], v[2], v[3]));
+    case Animation::ANIMATIONTYPE_MATRIX:
+      return AnimationValue(
+        Matrix::FromArray(values, static_cast<unsigned int>(offset)));
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      return AnimationValue(Vector2(v[0], v[1]));
+    case Animation::ANIMATIONTYPE_SIZE:
+      return AnimationValue(
+        Size(static_cast<int>(v[0]), static_cast<int>(v[1])));
+    default:
+      return AnimationValue(v[0]);
+  }
+}
+
+} // end of anonymous namespace
+
+void SceneSnapshot::_writeAnimations(SnapshotRecordWriter& writer,
+                                     const std::vector<Animation*>& animations)
+{
+  std::vector<Animation*> supported;
+  for (auto animation : animations) {
+    if (animation && componentCount(animation->dataType) > 0) {
+      supported.emplace_back(animation);
+    }
+    else if (animation) {
+      BABYLON_LOGF_WARN("SceneSnapshot",
+                        "Animation %s of unsupported type %d skipped",
+                        animation->name.c_str(), animation->dataType);
+    }
+  }
+
+  writer.write<uint32_t>(static_cast<uint32_t>(supported.size()));
+  for (auto animation : supported) {
+    writer.writeString(animation->name);
+    writer.writeString(animation->targetProperty);
+    writer.write<uint64_t>(animation->framePerSecond);
+    writer.write<int32_t>(animation->dataType);
+    writer.write<uint32_t>(animation->loopMode);
+    writeBool(writer, animation->enableBlending);
+    writer.write(animation->blendingSpeed);
+
+    // Keys, the values of all the keys in one array
+    const auto& keys = animation->getKeys();
+    Int32Array frames;
+    Float32Array values;
+    frames.reserve(keys.size());
+    values.reserve(keys.size() * componentCount(animation->dataType));
+    for (const auto& key : keys) {
+      frames.emplace_back(key.frame);
+      writeAnimationValue(values, animation->dataType, key.value);
+    }
+    writer.writeArray(frames);
+    writer.writeArray(values);
+
+    // Ranges
+    writer.write<uint32_t>(static_cast<uint32_t>(animation->_ranges.size()));
+    for (const auto& item : animation->_ranges) {
+      writer.writeString(item.first);
+      writer.writeString(item.second.name);
+      writer.write(item.second.from);
+      writer.write(item.second.to);
+    }
+  }
+}
+
+bool SceneSnapshot::_readAnimations(SnapshotRecordReader& reader,
+                                    std::vector<Animation*>& animations)
+{
+  const auto count = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < count && !reader.failed(); ++i) {
+    const auto name           = reader.readString();
+    const auto targetProperty = reader.readString();
+    const auto framePerSecond = reader.read<uint64_t>();
+    const auto dataType       = reader.read<int32_t>();
+    const auto loopMode       = reader.read<uint32_t>();
+    const bool enableBlending = readBool(reader);
+    const auto blendingSpeed  = reader.read<float>();
+    const auto frames         = reader.readArray<int32_t>();
+    const auto values         = reader.readArray<float>();
+    const auto components     = componentCount(dataType);
+    if (reader.failed() || components == 0
+        || values.size() != frames.size() * components) {
+      return false;
+    }
+
+    auto animation = new Animation(name, targetProperty,
+                                   static_cast<size_t>(framePerSecond),
+                                   dataType, loopMode);
+    animation->enableBlending = enableBlending;
+    animation->blendingSpeed  = blendingSpeed;
+
+    std::vector<AnimationKey> keys;
+    keys.reserve(frames.size());
+    for (size_t k = 0; k < frames.size(); ++k) {
+      keys.emplace_back(
+        AnimationKey(frames[k], readAnimationValue(values, k * components,
+                                                   dataType)));
+    }
+    animation->setKeys(keys);
+
+    const auto rangeCount = reader.read<uint32_t>();
+    for (uint32_t r = 0; r < rangeCount && !reader.failed(); ++r) {
+      const auto key       = reader.readString();
+      const auto rangeName = reader.readString();
+      const auto from      = reader.read<float>();
+      const auto to        = reader.read<float>();
+      animation->_ranges[key] = AnimationRange(rangeName, from, to);
+    }
+
+    animations.emplace_back(animation);
+  }
+
+  return !reader.failed();
+}
+
+bool SceneSnapshot::Save(Scene* scene, const std::string& filename)
+{
+  SnapshotFileWriter file;
+  SnapshotRecordWriter writer;
+
+  // Scene
+  writeBool(writer, scene->autoClear);
+  writeFloats(writer, scene->clearColor.asArray());
+  writeFloats(writer, scene->ambientColor.asArray());
+  writeFloats(writer, scene->gravity.asArray());
+  writeBool(writer, scene->collisionsEnabled);
+
+  // Fog
+  writeBool(writer, scene->fogEnabled());
+  writeBool(writer, scene->fogMode());
+  writeFloats(writer, scene->fogColor.asArray());
+  writer.write(scene->fogStart);
+  writer.write(scene->fogEnd);
+  writer.write(scene->fogDensity);
+
+  // Lights
+  std::vector<Light*> lights;
+  for (auto& light : scene->lights) {
+    if (light->getTypeID() <= Light::LIGHTTYPEID_HEMISPHERICLIGHT) {
+      lights.emplace_back(light.get());
+    }
+  }
+  writer.write<uint32_t>(static_cast<uint32_t>(lights.size()));
+  for (auto light : lights) {
+    writer.write<uint32_t>(light->getTypeID());
+    writeNode(writer, light);
+    writeBool(writer, light->isEnabled());
+    writeFloats(writer, light->diffuse.asArray());
+    writeFloats(writer, light->specular.asArray());
+    writer.write(light->intensity);
+    writer.write(light->range);
+    writeBool(writer, light->shadowEnabled);
+
+    // Position and direction, a point light without direction casts cube
+    // shadows
+    auto shadowLight      = dynamic_cast<ShadowLight*>(light);
+    auto spotLight        = dynamic_cast<SpotLight*>(light);
+    auto hemisphericLight = dynamic_cast<HemisphericLight*>(light);
+    const bool hasDirection
+      = hemisphericLight || (shadowLight && !shadowLight->needCube());
+    writeFloats(writer, shadowLight ? shadowLight->position.asArray() :
+                                      Vector3::Zero().asArray());
+    writeBool(writer, hasDirection);
+    writeFloats(writer, hemisphericLight ?
+                          hemisphericLight->direction.asArray() :
+                          hasDirection ? shadowLight->direction().asArray() :
+                                         Vector3::Zero().asArray());
+    writer.write(spotLight ? spotLight->angle() : 0.f);
+    writer.write(spotLight ? spotLight->exponent : 0.f);
+    writeFloats(writer, hemisphericLight ?
+                          hemisphericLight->groundColor.asArray() :
+                          Color3::Black().asArray());
+
+    // Inclusion / exclusions
+    for (auto meshes : {light->excludedMeshes(), light->includedOnlyMeshes()}) {
+      writer.write<uint32_t>(static_cast<uint32_t>(meshes.size()));
+      for (auto mesh : meshes) {
+        writer.writeString(mesh->id);
+      }
+    }
+
+    _writeAnimations(writer, light->animations);
+    writeRanges(writer, light->serializeAnimationRanges());
+  }
+
+  // Animations
+  _writeAnimations(writer, scene->animations);
+
+  // Materials
+  std::vector<Material*> materials;
+  for (auto& material : scene->materials) {
+    if (dynamic_cast<StandardMaterial*>(material.get())) {
+      materials.emplace_back(material.get());
+    }
+    else {
+      BABYLON_LOGF_WARN("SceneSnapshot", "Material %s of class %s skipped",
+                        material->name.c_str(), material->getClassName());
+    }
+  }
+  writer.write<uint32_t>(static_cast<uint32_t>(materials.size()));
+  for (auto material : materials) {
+    auto standardMaterial = static_cast<StandardMaterial*>(material);
+    writer.writeString(material->name);
+    writer.writeString(material->id);
+    writer.write(material->alpha);
+    writer.write<int32_t>(material->sideOrientation);
+    writer.write<int32_t>(material->alphaMode);
+    writer.write(material->zOffset);
+    writeBool(writer, material->backFaceCulling());
+    writeBool(writer, material->wireframe());
+    writeBool(writer, material->fogEnabled());
+    writeFloats(writer, standardMaterial->ambientColor.asArray());
+    writeFloats(writer, standardMaterial->diffuseColor.asArray());
+    writeFloats(writer, standardMaterial->specularColor.asArray());
+    writeFloats(writer, standardMaterial->emissiveColor.asArray());
+    writer.write(standardMaterial->specularPower);
+    writer.write(standardMaterial->parallaxScaleBias);
+    writer.write(standardMaterial->indexOfRefraction);
+    writer.write(standardMaterial->roughness());
+    writer.write<uint32_t>(standardMaterial->maxSimultaneousLights());
+    for (bool flag : {standardMaterial->useAlphaFromDiffuseTexture(),
+                      standardMaterial->useEmissiveAsIllumination(),
+                      standardMaterial->linkEmissiveWithDiffuse(),
+                      standardMaterial->useReflectionFresnelFromSpecular(),
+                      standardMaterial->useSpecularOverAlpha(),
+                      standardMaterial->useReflectionOverAlpha(),
+                      standardMaterial->disableLighting(),
+                      standardMaterial->useParallax(),
+                      standardMaterial->useParallaxOcclusion(),
+                      standardMaterial->useLightmapAsShadowmap(),
+                      standardMaterial->useGlossinessFromSpecularMapAlpha(),
+                      standardMaterial->invertNormalMapX(),
+                      standardMaterial->invertNormalMapY(),
+                      standardMaterial->invertRefractionY}) {
+      writeBool(writer, flag);
+    }
+  }
+
+  // Multi materials, their sub materials as indices of the materials
+  std::vector<Material*> multiMaterials;
+  writer.write<uint32_t>(static_cast<uint32_t>(scene->multiMaterials.size()));
+  for (auto& multiMaterial : scene->multiMaterials) {
+    multiMaterials.emplace_back(multiMaterial.get());
+    writer.writeString(multiMaterial->name);
+    writer.writeString(multiMaterial->id);
+    writer.write<uint32_t>(
+      static_cast<uint32_t>(multiMaterial->subMaterials.size()));
+    for (auto subMaterial : multiMaterial->subMaterials) {
+      writer.write<int32_t>(indexOf(materials, subMaterial));
+    }
+  }
+
+  // Skeletons
+  std::vector<Skeleton*> skeletons;
+  writer.write<uint32_t>(static_cast<uint32_t>(scene->skeletons.size()));
+  for (auto& skeleton : scene->skeletons) {
+    skeletons.emplace_back(skeleton.get());
+    writer.writeString(skeleton->name);
+    writer.writeString(skeleton->id);
+    writeBool(writer, skeleton->needInitialSkinMatrix);
+    writeBool(writer, skeleton->dimensionsAtRest != nullptr);
+    writeFloats(writer, skeleton->dimensionsAtRest ?
+                          skeleton->dimensionsAtRest->asArray() :
+                          Vector3::Zero().asArray());
+
+    // Bones, a parent bone is always before its children
+    std::vector<Bone*> bones;
+    writer.write<uint32_t>(static_cast<uint32_t>(skeleton->bones.size()));
+    for (auto& bone : skeleton->bones) {
+      bones.emplace_back(bone.get());
+      writer.writeString(bone->name);
+      writer.write<int32_t>(indexOf(bones, bone->getParent()));
+      writeFloats(writer, bone->getLocalMatrix().asArray());
+      writeFloats(writer, bone->getRestPose().asArray());
+      writer.write<int32_t>(bone->length);
+      _writeAnimations(writer, bone->animations);
+    }
+    writeRanges(writer, skeleton->getAnimationRanges());
+  }
+
+  // Geometries, each vertex and index buffer in its own blob
+  std::vector<Geometry*> geometries;
+  writer.write<uint32_t>(static_cast<uint32_t>(scene->getGeometries().size()));
+  for (auto& geometry : scene->getGeometries()) {
+    geometries.emplace_back(geometry.get());
+    writer.writeString(geometry->id);
+    const auto kinds = geometry->getVerticesDataKinds();
+    writer.write<uint32_t>(static_cast<uint32_t>(kinds.size()));
+    for (auto kind : kinds) {
+      auto vertexBuffer = geometry->getVertexBuffer(kind);
+      writer.write<uint32_t>(kind);
+      writer.write<int32_t>(vertexBuffer->getStrideSize());
+      writeBool(writer, vertexBuffer->isUpdatable());
+      writer.write<uint32_t>(static_cast<uint32_t>(
+        file.addArray(VerticesTag, geometry->getVerticesData(kind))));
+    }
+    const auto indices = geometry->getIndices();
+    writer.write<uint64_t>(geometry->getTotalVertices());
+    writer.write<uint32_t>(
+      indices.empty() ?
+        NoBlob :
+        static_cast<uint32_t>(file.addArray(IndicesTag, indices)));
+  }
+
+  // Meshes, the instances are stored with their source mesh
+  std::vector<Mesh*> meshes;
+  for (auto& mesh : scene->meshes) {
+    if (auto sourceMesh = dynamic_cast<Mesh*>(mesh.get())) {
+      meshes.emplace_back(sourceMesh);
+    }
+  }
+  writer.write<uint32_t>(static_cast<uint32_t>(meshes.size()));
+  for (auto mesh : meshes) {
+    writeNode(writer, mesh);
+    writeTransform(writer, mesh);
+    writeBool(writer, mesh->isEnabled());
+    writeBool(writer, mesh->isVisible);
+    writeBool(writer, mesh->isPickable);
+    writeBool(writer, mesh->receiveShadows());
+    writeBool(writer, mesh->checkCollisions());
+    writeBool(writer, mesh->infiniteDistance);
+    writeBool(writer, mesh->isWorldMatrixFrozen());
+    writer.write<uint32_t>(mesh->billboardMode);
+    writer.write(mesh->visibility);
+    writer.write<int32_t>(mesh->alphaIndex);
+    writer.write<uint32_t>(mesh->layerMask);
+
+    // Material, as index of the materials followed by the multi materials
+    const auto multiMaterialIndex = indexOf(multiMaterials, mesh->material());
+    writer.write<int32_t>(
+      (multiMaterialIndex != NoIndex) ?
+        static_cast<int32_t>(materials.size()) + multiMaterialIndex :
+        indexOf(materials, mesh->material()));
+    writer.write<int32_t>(indexOf(skeletons, mesh->skeleton()));
+    writer.write<uint32_t>(mesh->numBoneInfluencers());
+    writer.write<int32_t>(indexOf(geometries, mesh->geometry()));
+
+    writer.write<uint32_t>(static_cast<uint32_t>(mesh->subMeshes.size()));
+    for (auto& subMesh : mesh->subMeshes) {
+      writer.write<uint32_t>(subMesh->materialIndex);
+      writer.write<uint32_t>(subMesh->verticesStart);
+      writer.write<uint64_t>(subMesh->verticesCount);
+      writer.write<uint32_t>(subMesh->indexStart);
+      writer.write<uint64_t>(subMesh->indexCount);
+    }
+
+    _writeAnimations(writer, mesh->animations);
+    writeRanges(writer, mesh->serializeAnimationRanges());
+
+    writer.write<uint32_t>(static_cast<uint32_t>(mesh->instances.size()));
+    for (auto instance : mesh->instances) {
+      writeNode(writer, instance);
+      writeTransform(writer, instance);
+      writeBool(writer, instance->isEnabled());
+      writeBool(writer, instance->checkCollisions());
+      _writeAnimations(writer, instance->animations);
+    }
+  }
+
+  // Cameras
+  std::vector<Camera*> cameras;
+  for (auto& camera : scene->cameras) {
+    if (dynamic_cast<ArcRotateCamera*>(camera.get())
+        || dynamic_cast<FreeCamera*>(camera.get())) {
+      cameras.emplace_back(camera.get());
+    }
+    else {
+      BABYLON_LOGF_WARN("SceneSnapshot", "Camera %s of class %s skipped",
+                        camera->name.c_str(), camera->getClassName());
+    }
+  }
+  writer.write<uint32_t>(static_cast<uint32_t>(cameras.size()));
+  for (auto camera : cameras) {
+    auto arcRotateCamera = dynamic_cast<ArcRotateCamera*>(camera);
+    auto targetCamera    = static_cast<TargetCamera*>(camera);
+    writer.writeString(arcRotateCamera ? ArcRotateCameraType :
+                                         FreeCameraType);
+    writeNode(writer, camera);
+    writeFloats(writer, camera->position.asArray());
+    writeFloats(writer, camera->upVector.asArray());
+    for (float value :
+         {camera->orthoLeft, camera->orthoRight, camera->orthoBottom,
+          camera->orthoTop, camera->fov, camera->minZ, camera->maxZ,
+          camera->inertia, targetCamera->speed}) {
+      writer.write(value);
+    }
+    writer.write<uint32_t>(camera->mode);
+    writer.write<uint32_t>(camera->layerMask);
+    writer.write<uint32_t>(camera->fovMode);
+    writeFloats(writer, targetCamera->rotation ?
+                          targetCamera->rotation->asArray() :
+                          Vector3::Zero().asArray());
+    writeBool(writer, targetCamera->rotationQuaternion != nullptr);
+    writeFloats(writer, targetCamera->rotationQuaternion ?
+                          targetCamera->rotationQuaternion->asArray() :
+                          Quaternion().asArray());
+
+    if (arcRotateCamera) {
+      writer.write(arcRotateCamera->alpha);
+      writer.write(arcRotateCamera->beta);
+      writer.write(arcRotateCamera->radius);
+      writeFloats(writer, arcRotateCamera->target().asArray());
+    }
+    else {
+      auto freeCamera = static_cast<FreeCamera*>(camera);
+      writeFloats(writer, freeCamera->ellipsoid.asArray());
+      writeBool(writer, freeCamera->checkCollisions);
+      writeBool(writer, freeCamera->applyGravity);
+    }
+
+    _writeAnimations(writer, camera->animations);
+    writeRanges(writer, camera->serializeAnimationRanges());
+  }
+  writer.write<int32_t>(indexOf(cameras, scene->activeCamera));
+
+  file.addArray(SceneTag, writer.data());
+
+  return file.save(filename);
+}
+
+bool SceneSnapshot::Load(Scene* scene, const std::string& filename)
+{
+  const auto file = SnapshotFileReader::Open(filename);
+  if (!file) {
+    BABYLON_LOGF_ERROR("SceneSnapshot", "Invalid snapshot file %s",
+                       filename.c_str());
+    return false;
+  }
+
+  const auto sceneBlob = file->findBlob(SceneTag);
+  SnapshotRecordReader reader(file->blobData(sceneBlob),
+                              file->blobSize(sceneBlob));
+  const auto corrupted = [&filename]() {
+    BABYLON_LOGF_ERROR("SceneSnapshot", "Corrupted snapshot file %s",
+                       filename.c_str());
+    return false;
+  };
+  if (sceneBlob == file->blobCount()) {
+    return corrupted();
+  }
+
+  // Scene
+  scene->autoClear         = readBool(reader);
+  scene->clearColor        = Color4::FromArray(readFloats(reader, 4));
+  scene->ambientColor      = Color3::FromArray(readFloats(reader, 3));
+  scene->gravity           = Vector3::FromArray(readFloats(reader, 3));
+  scene->collisionsEnabled = readBool(reader);
+
+  // Fog
+  scene->setFogEnabled(readBool(reader));
+  scene->setFogMode(readBool(reader));
+  scene->fogColor   = Color3::FromArray(readFloats(reader, 3));
+  scene->fogStart   = reader.read<float>();
+  scene->fogEnd     = reader.read<float>();
+  scene->fogDensity = reader.read<float>();
+
+  // Lights
+  std::vector<Light*> lights;
+  const auto lightCount = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < lightCount && !reader.failed(); ++i) {
+    const auto type = reader.read<uint32_t>();
+    auto light
+      = Light::GetConstructorFromName(type, reader.readString(), scene);
+    if (!light) {
+      return corrupted();
+    }
+    readNode(reader, light);
+    light->setEnabled(readBool(reader));
+    light->diffuse       = Color3::FromArray(readFloats(reader, 3));
+    light->specular      = Color3::FromArray(readFloats(reader, 3));
+    light->intensity     = reader.read<float>();
+    light->range         = reader.read<float>();
+    light->shadowEnabled = readBool(reader);
+
+    const auto position     = Vector3::FromArray(readFloats(reader, 3));
+    const bool hasDirection = readBool(reader);
+    const auto direction    = Vector3::FromArray(readFloats(reader, 3));
+    const auto angle        = reader.read<float>();
+    const auto exponent     = reader.read<float>();
+    const auto groundColor  = Color3::FromArray(readFloats(reader, 3));
+    if (auto hemisphericLight = dynamic_cast<HemisphericLight*>(light)) {
+      hemisphericLight->direction   = direction;
+      hemisphericLight->groundColor = groundColor;
+    }
+    else if (auto shadowLight = dynamic_cast<ShadowLight*>(light)) {
+      shadowLight->position = position;
+      if (hasDirection) {
+        shadowLight->setDirection(direction);
+      }
+    }
+    if (auto spotLight = dynamic_cast<SpotLight*>(light)) {
+      spotLight->setAngle(angle);
+      spotLight->exponent = exponent;
+    }
+
+    // Inclusion / exclusions, connected once the meshes are created
+    for (auto meshIds :
+         {&light->_excludedMeshesIds, &light->_includedOnlyMeshesIds}) {
+      const auto idCount = reader.read<uint32_t>();
+      for (uint32_t m = 0; m < idCount && !reader.failed(); ++m) {
+        meshIds->emplace_back(reader.readString());
+      }
+    }
+    lights.emplace_back(light);
+
+    if (!_readAnimations(reader, light->animations)) {
+      return corrupted();
+    }
+    readRanges(reader, light);
+  }
+
+  // Animations
+  if (!_readAnimations(reader, scene->animations)) {
+    return corrupted();
+  }
+
+  // Materials
+  std::vector<Material*> materials;
+  const auto materialCount = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < materialCount && !reader.failed(); ++i) {
+    auto material = StandardMaterial::New(reader.readString(), scene);
+    material->id              = reader.readString();
+    material->alpha           = reader.read<float>();
+    material->sideOrientation = reader.read<int32_t>();
+    material->alphaMode       = reader.read<int32_t>();
+    material->zOffset         = reader.read<float>();
+    material->setBackFaceCulling(readBool(reader));
+    material->setWireframe(readBool(reader));
+    material->setFogEnabled(readBool(reader));
+    material->ambientColor      = Color3::FromArray(readFloats(reader, 3));
+    material->diffuseColor      = Color3::FromArray(readFloats(reader, 3));
+    material->specularColor     = Color3::FromArray(readFloats(reader, 3));
+    material->emissiveColor     = Color3::FromArray(readFloats(reader, 3));
+    material->specularPower     = reader.read<float>();
+    material->parallaxScaleBias = reader.read<float>();
+    material->indexOfRefraction = reader.read<float>();
+    material->setRoughness(reader.read<float>());
+    material->setMaxSimultaneousLights(reader.read<uint32_t>());
+    material->setUseAlphaFromDiffuseTexture(readBool(reader));
+    material->setUseEmissiveAsIllumination(readBool(reader));
+    material->setLinkEmissiveWithDiffuse(readBool(reader));
+    material->setUseReflectionFresnelFromSpecular(readBool(reader));
+    material->setUseSpecularOverAlpha(readBool(reader));
+    material->setUseReflectionOverAlpha(readBool(reader));
+    material->setDisableLighting(readBool(reader));
+    material->setUseParallax(readBool(reader));
+    material->setUseParallaxOcclusion(readBool(reader));
+    material->setUseLightmapAsShadowmap(readBool(reader));
+    material->setUseGlossinessFromSpecularMapAlpha(readBool(reader));
+    material->setInvertNormalMapX(readBool(reader));
+    material->setInvertNormalMapY(readBool(reader));
+    material->invertRefractionY = readBool(reader);
+    materials.emplace_back(material);
+  }
+
+  // Multi materials
+  std::vector<Material*> multiMaterials;
+  const auto multiMaterialCount = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < multiMaterialCount && !reader.failed(); ++i) {
+    auto multiMaterial = MultiMaterial::New(reader.readString(), scene);
+    multiMaterial->id  = reader.readString();
+    const auto subMaterialCount = reader.read<uint32_t>();
+    for (uint32_t s = 0; s < subMaterialCount && !reader.failed(); ++s) {
+      multiMaterial->subMaterials.emplace_back(
+        elementAt(materials, reader.read<int32_t>()));
+    }
+    multiMaterials.emplace_back(multiMaterial);
+  }
+
+  // Skeletons
+  std::vector<Skeleton*> skeletons;
+  const auto skeletonCount = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < skeletonCount && !reader.failed(); ++i) {
+    const auto name = reader.readString();
+    const auto id   = reader.readString();
+    auto skeleton   = new Skeleton(name, id, scene);
+    skeleton->needInitialSkinMatrix = readBool(reader);
+    const bool hasDimensionsAtRest  = readBool(reader);
+    const auto dimensionsAtRest = Vector3::FromArray(readFloats(reader, 3));
+    if (hasDimensionsAtRest) {
+      skeleton->dimensionsAtRest = std::make_unique<Vector3>(dimensionsAtRest);
+    }
+
+    std::vector<Bone*> bones;
+    const auto boneCount = reader.read<uint32_t>();
+    for (uint32_t b = 0; b < boneCount && !reader.failed(); ++b) {
+      const auto boneName    = reader.readString();
+      const auto parentIndex = reader.read<int32_t>();
+      const auto matrix      = Matrix::FromArray(readFloats(reader, 16));
+      const auto restPose    = Matrix::FromArray(readFloats(reader, 16));
+      auto bone = Bone::New(boneName, skeleton, elementAt(bones, parentIndex),
+                            matrix, restPose);
+      bone->length = reader.read<int32_t>();
+      if (!_readAnimations(reader, bone->animations)) {
+        return corrupted();
+      }
+      bones.emplace_back(bone);
+    }
+    readRanges(reader, skeleton);
+    skeletons.emplace_back(skeleton);
+  }
+
+  // Geometries, the buffers are read from the mapping of the file
+  std::vector<Geometry*> geometries;
+  const auto geometryCount = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < geometryCount && !reader.failed(); ++i) {
+    auto geometry = Geometry::New(reader.readString(), scene);
+    const auto kindCount = reader.read<uint32_t>();
+    for (uint32_t k = 0; k < kindCount && !reader.failed(); ++k) {
+      const auto kind      = reader.read<uint32_t>();
+      const auto stride    = reader.read<int32_t>();
+      const bool updatable = readBool(reader);
+      const auto blob      = reader.read<uint32_t>();
+      Float32Array data;
+      if (file->blobTag(blob) != VerticesTag || !file->readArray(blob, data)) {
+        return corrupted();
+      }
+      geometry->setVerticesData(kind, data, updatable, stride);
+    }
+    const auto totalVertices = reader.read<uint64_t>();
+    const auto indicesBlob   = reader.read<uint32_t>();
+    if (indicesBlob != NoBlob) {
+      IndicesArray indices;
+      if (file->blobTag(indicesBlob) != IndicesTag
+          || !file->readArray(indicesBlob, indices)) {
+        return corrupted();
+      }
+      geometry->setIndices(indices, static_cast<size_t>(totalVertices));
+    }
+    geometries.emplace_back(geometry);
+  }
+
+  // Meshes
+  const auto meshCount = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < meshCount && !reader.failed(); ++i) {
+    auto mesh = Mesh::New(reader.readString(), scene);
+    readNode(reader, mesh);
+    readTransform(reader, mesh);
+    mesh->setEnabled(readBool(reader));
+    mesh->isVisible  = readBool(reader);
+    mesh->isPickable = readBool(reader);
+    mesh->setReceiveShadows(readBool(reader));
+    mesh->setCheckCollisions(readBool(reader));
+    mesh->infiniteDistance          = readBool(reader);
+    mesh->_waitingFreezeWorldMatrix = readBool(reader);
+    mesh->billboardMode             = reader.read<uint32_t>();
+    mesh->visibility                = reader.read<float>();
+    mesh->alphaIndex                = reader.read<int32_t>();
+    mesh->layerMask                 = reader.read<uint32_t>();
+
+    const auto materialIndex = reader.read<int32_t>();
+    const auto multiMaterialIndex
+      = materialIndex - static_cast<int32_t>(materials.size());
+    mesh->setMaterial(elementAt(materials, materialIndex) ?
+                        elementAt(materials, materialIndex) :
+                        elementAt(multiMaterials, multiMaterialIndex));
+    auto skeleton = elementAt(skeletons, reader.read<int32_t>());
+    const auto numBoneInfluencers = reader.read<uint32_t>();
+    if (skeleton) {
+      mesh->setSkeleton(skeleton);
+      mesh->setNumBoneInfluencers(numBoneInfluencers);
+    }
+    auto geometry = elementAt(geometries, reader.read<int32_t>());
+    if (geometry) {
+      geometry->applyToMesh(mesh);
+    }
+
+    // SubMeshes, replacing the one created with the geometry
+    const auto subMeshCount = reader.read<uint32_t>();
+    if (geometry && subMeshCount > 0) {
+      mesh->subMeshes.clear();
+    }
+    for (uint32_t s = 0; s < subMeshCount && !reader.failed(); ++s) {
+      const auto subMaterialIndex = reader.read<uint32_t>();
+      const auto verticesStart    = reader.read<uint32_t>();
+      const auto verticesCount    = reader.read<uint64_t>();
+      const auto indexStart       = reader.read<uint32_t>();
+      const auto indexCount       = reader.read<uint64_t>();
+      if (geometry) {
+        SubMesh::New(subMaterialIndex, verticesStart,
+                     static_cast<size_t>(verticesCount), indexStart,
+                     static_cast<size_t>(indexCount), mesh);
+      }
+    }
+
+    if (!_readAnimations(reader, mesh->animations)) {
+      return corrupted();
+    }
+    readRanges(reader, mesh);
+
+    const auto instanceCount = reader.read<uint32_t>();
+    for (uint32_t n = 0; n < instanceCount && !reader.failed(); ++n) {
+      auto instance = mesh->createInstance(reader.readString());
+      readNode(reader, instance);
+      readTransform(reader, instance);
+      instance->setEnabled(readBool(reader));
+      instance->setCheckCollisions(readBool(reader));
+      if (!_readAnimations(reader, instance->animations)) {
+        return corrupted();
+      }
+    }
+  }
+
+  // Cameras
+  std::vector<Camera*> cameras;
+  const auto cameraCount = reader.read<uint32_t>();
+  for (uint32_t i = 0; i < cameraCount && !reader.failed(); ++i) {
+    const auto type = reader.readString();
+    auto camera
+      = Camera::GetConstructorFromName(type, reader.readString(), scene);
+    if (!camera
+        || (type != ArcRotateCameraType && type != FreeCameraType)) {
+      return corrupted();
+    }
+    auto targetCamera = static_cast<TargetCamera*>(camera);
+    readNode(reader, camera);
+    camera->position    = Vector3::FromArray(readFloats(reader, 3));
+    camera->upVector    = Vector3::FromArray(readFloats(reader, 3));
+    camera->orthoLeft   = reader.read<float>();
+    camera->orthoRight  = reader.read<float>();
+    camera->orthoBottom = reader.read<float>();
+    camera->orthoTop    = reader.read<float>();
+    camera->fov         = reader.read<float>();
+    camera->minZ        = reader.read<float>();
+    camera->maxZ        = reader.read<float>();
+    camera->inertia     = reader.read<float>();
+    targetCamera->speed = reader.read<float>();
+    camera->mode        = reader.read<uint32_t>();
+    camera->layerMask   = reader.read<uint32_t>();
+    camera->fovMode     = reader.read<uint32_t>();
+    targetCamera->rotation
+      = std::make_unique<Vector3>(Vector3::FromArray(readFloats(reader, 3)));
+    const bool hasRotationQuaternion = readBool(reader);
+    const auto rotationQuaternion    = readFloats(reader, 4);
+    if (hasRotationQuaternion) {
+      targetCamera->rotationQuaternion = std::make_unique<Quaternion>(
+        Quaternion::FromArray(rotationQuaternion));
+    }
+
+    if (type == ArcRotateCameraType) {
+      auto arcRotateCamera = static_cast<ArcRotateCamera*>(camera);
+      const auto alpha     = reader.read<float>();
+      const auto beta      = reader.read<float>();
+      const auto radius    = reader.read<float>();
+      arcRotateCamera->setTarget(Vector3::FromArray(readFloats(reader, 3)),
+                                 false, true);
+      arcRotateCamera->alpha  = alpha;
+      arcRotateCamera->beta   = beta;
+      arcRotateCamera->radius = radius;
+    }
+    else {
+      auto freeCamera = static_cast<FreeCamera*>(camera);
+      freeCamera->ellipsoid       = Vector3::FromArray(readFloats(reader, 3));
+      freeCamera->checkCollisions = readBool(reader);
+      freeCamera->applyGravity    = readBool(reader);
+    }
+
+    if (!_readAnimations(reader, camera->animations)) {
+      return corrupted();
+    }
+    readRanges(reader, camera);
+    cameras.emplace_back(camera);
+  }
+  if (auto activeCamera = elementAt(cameras, reader.read<int32_t>())) {
+    scene->activeCamera = activeCamera;
+  }
+
+  if (reader.failed() || !reader.atEnd()) {
+    return corrupted();
+  }
+
+  // Connecting parents, on the whole scene as with the .babylon loader
+  for (auto& camera : scene->cameras) {
+    if (!camera->_waitingParentId.empty()) {
+      camera->setParent(scene->getLastEntryByID(camera->_waitingParentId));
+      camera->_waitingParentId.clear();
+    }
+  }
+
+  for (auto& light : scene->lights) {
+    if (!light->_waitingParentId.empty()) {
+      light->setParent(scene->getLastEntryByID(light->_waitingParentId));
+      light->_waitingParentId.clear();
+    }
+  }
+
+  for (auto& mesh : scene->meshes) {
+    if (!mesh->_waitingParentId.empty()) {
+      static_cast<Node*>(mesh.get())
+        ->setParent(scene->getLastEntryByID(mesh->_waitingParentId));
+      mesh->_waitingParentId.clear();
+    }
+  }
+
+  // Inclusion / exclusions
+  for (auto light : lights) {
+    for (const auto& id : light->_excludedMeshesIds) {
+      if (auto mesh = scene->getMeshByID(id)) {
+        light->excludedMeshes().emplace_back(mesh);
+      }
+    }
+    for (const auto& id : light->_includedOnlyMeshesIds) {
+      if (auto mesh = scene->getMeshByID(id)) {
+        light->includedOnlyMeshes().emplace_back(mesh);
+      }
+    }
+    light->_excludedMeshesIds.clear();
+    light->_includedOnlyMeshesIds.clear();
+  }
+
+  // Freeze world matrix application
+  for (auto& currentMesh : scene->meshes) {
+    if (currentMesh->_waitingFreezeWorldMatrix) {
+      currentMesh->freezeWorldMatrix();
+      currentMesh->_waitingFreezeWorldMatrix = false;
+    }
+    else {
+      currentMesh->computeWorldMatrix(true);
+    }
+  }
+
+  return true;
+}
+
+} // end of namespace BABYLON
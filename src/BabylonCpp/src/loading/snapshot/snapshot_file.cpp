@@ -0,0 +1,200 @@
+#include <babylon/loading/snapshot/snapshot_file.h>
+
+#include <cstring>
+
+#include <babylon/core/memory_mapped_file.h>
+
+namespace BABYLON {
+
+constexpr uint32_t SnapshotFile::Version;
+constexpr uint32_t SnapshotFile::ByteOrderMark;
+constexpr size_t SnapshotFile::Alignment;
+constexpr size_t SnapshotFile::HeaderSize;
+constexpr size_t SnapshotFile::TocEntrySize;
+
+namespace {
+
+constexpr char Magic[8] = {'B', 'A', 'B', 'Y', 'S', 'N', 'A', 'P'};
+
+size_t align(size_t offset)
+{
+  return (offset + SnapshotFile::Alignment - 1)
+         & ~(SnapshotFile::Alignment - 1);
+}
+
+template <typename T>
+void write(std::vector<uint8_t>& buffer, size_t offset, T value)
+{
+  std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+T read(const uint8_t* data, size_t offset)
+{
+  T value;
+  std::memcpy(&value, data + offset, sizeof(T));
+  return value;
+}
+
+} // end of anonymous namespace
+
+SnapshotFileWriter::SnapshotFileWriter()
+{
+}
+
+SnapshotFileWriter::~SnapshotFileWriter()
+{
+}
+
+size_t SnapshotFileWriter::addBlob(uint32_t tag, const void* data,
+                                   size_t byteLength)
+{
+  const auto bytes = static_cast<const uint8_t*>(data);
+  _blobs.emplace_back(
+    Blob{tag, std::vector<uint8_t>(bytes, bytes + byteLength)});
+  return _blobs.size() - 1;
+}
+
+size_t SnapshotFileWriter::blobCount() const
+{
+  return _blobs.size();
+}
+
+std::vector<uint8_t> SnapshotFileWriter::serialize() const
+{
+  // Blob offsets
+  std::vector<size_t> offsets;
+  size_t offset = SnapshotFile::HeaderSize;
+  for (const auto& blob : _blobs) {
+    offset = align(offset);
+    offsets.emplace_back(offset);
+    offset += blob.data.size();
+  }
+  const size_t tocOffset = align(offset);
+
+  std::vector<uint8_t> buffer(
+    tocOffset + _blobs.size() * SnapshotFile::TocEntrySize, 0);
+
+  // Header
+  std::memcpy(buffer.data(), Magic, sizeof(Magic));
+  write<uint32_t>(buffer, 8, SnapshotFile::Version);
+  write<uint32_t>(buffer, 12, SnapshotFile::ByteOrderMark);
+  write<uint32_t>(buffer, 16, static_cast<uint32_t>(_blobs.size()));
+  write<uint64_t>(buffer, 24, tocOffset);
+
+  // Blobs and table of contents
+  for (size_t i = 0; i < _blobs.size(); ++i) {
+    const auto& blob = _blobs[i];
+    if (!blob.data.empty()) {
+      std::memcpy(buffer.data() + offsets[i], blob.data.data(),
+                  blob.data.size());
+    }
+    const size_t entry = tocOffset + i * SnapshotFile::TocEntrySize;
+    write<uint32_t>(buffer, entry, blob.tag);
+    write<uint64_t>(buffer, entry + 8, offsets[i]);
+    write<uint64_t>(buffer, entry + 16, blob.data.size());
+  }
+
+  return buffer;
+}
+
+bool SnapshotFileWriter::save(const std::string& filename) const
+{
+  const auto buffer = serialize();
+  std::ofstream stream(filename, std::ios::binary | std::ios::trunc);
+  if (!stream) {
+    return false;
+  }
+  stream.write(reinterpret_cast<const char*>(buffer.data()),
+               static_cast<std::streamsize>(buffer.size()));
+  return static_cast<bool>(stream);
+}
+
+SnapshotFileReader::SnapshotFileReader()
+{
+}
+
+SnapshotFileReader::~SnapshotFileReader()
+{
+}
+
+std::unique_ptr<SnapshotFileReader>
+SnapshotFileReader::Open(const std::string& filename)
+{
+  auto file = MemoryMappedFile::Open(filename);
+  if (!file || file->size() < SnapshotFile::HeaderSize) {
+    return nullptr;
+  }
+
+  const auto data = file->data();
+  const auto size = file->size();
+  if (std::memcmp(data, Magic, sizeof(Magic)) != 0
+      || read<uint32_t>(data, 8) != SnapshotFile::Version
+      || read<uint32_t>(data, 12) != SnapshotFile::ByteOrderMark) {
+    return nullptr;
+  }
+
+  const uint64_t blobCount = read<uint32_t>(data, 16);
+  const uint64_t tocOffset = read<uint64_t>(data, 24);
+  if (tocOffset < SnapshotFile::HeaderSize || tocOffset > size
+      || blobCount > (size - tocOffset) / SnapshotFile::TocEntrySize) {
+    return nullptr;
+  }
+
+  std::unique_ptr<SnapshotFileReader> reader(new SnapshotFileReader());
+  reader->_entries.reserve(static_cast<size_t>(blobCount));
+  for (uint64_t i = 0; i < blobCount; ++i) {
+    const size_t entry
+      = static_cast<size_t>(tocOffset + i * SnapshotFile::TocEntrySize);
+    const auto offset = read<uint64_t>(data, entry + 8);
+    const auto length = read<uint64_t>(data, entry + 16);
+    if (offset % SnapshotFile::Alignment != 0 || offset > tocOffset
+        || length > tocOffset - offset) {
+      return nullptr;
+    }
+    reader->_entries.emplace_back(Entry{read<uint32_t>(data, entry),
+                                        static_cast<size_t>(offset),
+                                        static_cast<size_t>(length)});
+  }
+  reader->_file = std::move(file);
+
+  return reader;
+}
+
+size_t SnapshotFileReader::blobCount() const
+{
+  return _entries.size();
+}
+
+uint32_t SnapshotFileReader::blobTag(size_t index) const
+{
+  return (index < _entries.size()) ? _entries[index].tag : 0;
+}
+
+const uint8_t* SnapshotFileReader::blobData(size_t index) const
+{
+  return (index < _entries.size()) ? _file->data() + _entries[index].offset :
+                                     nullptr;
+}
+
+size_t SnapshotFileReader::blobSize(size_t index) const
+{
+  return (index < _entries.size()) ? _entries[index].size : 0;
+}
+
+size_t SnapshotFileReader::findBlob(uint32_t tag) const
+{
+  for (size_t i = 0; i < _entries.size(); ++i) {
+    if (_entries[i].tag == tag) {
+      return i;
+    }
+  }
+  return _entries.size();
+}
+
+bool SnapshotFileReader::isMapped() const
+{
+  return _file->isMapped();
+}
+
+} // end of namespace BABYLON
@@ -11,11 +11,44 @@
 #include <babylon/math/color3.h>
 #include <babylon/math/vector2.h>
 #include <babylon/math/vector4.h>
+#include <babylon/mesh/vertex_buffer.h>
 #include <babylon/tools/tools.h>
 #include <babylon/utils/base64.h>
 
+#include <limits>
+#include <mutex>
+
 namespace BABYLON {
 
+namespace {
+
+// Registry of the uniform handles, shared by all the effects
+struct UniformHandleRegistry {
+  std::mutex mutex;
+  std::unordered_map<std::string, unsigned int> handles;
+}; // end of struct UniformHandleRegistry
+
+UniformHandleRegistry& uniformHandleRegistry()
+{
+  static UniformHandleRegistry registry;
+  return registry;
+}
+
+// Handle of a registered uniform, or a handle without slot in any effect. The
+// uniforms of all the effects are registered when they are created, so that
+// unknown names do not grow the registry
+unsigned int findUniformHandle(const std::string& uniformName)
+{
+  auto& registry = uniformHandleRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.handles.find(uniformName);
+  return (it != registry.handles.end()) ?
+           it->second :
+           std::numeric_limits<unsigned int>::max();
+}
+
+} // end of anonymous namespace
+
 std::size_t Effect::_uniqueIdSeed = 0;
 std::unordered_map<unsigned int, GL::IGLBuffer*> Effect::_baseCache{};
 
@@ -36,6 +69,8 @@ Effect::Effect(const std::string& baseName, EffectCreationOptions& options,
     , _fallbacks{std::move(options.fallbacks)}
 {
   stl_util::concat(_uniformsNames, options.samplers);
+  _resolveUniformSlots();
+  _resolveAttributeKinds();
 
   if (!options.uniformBuffersNames.empty()) {
     for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -90,6 +125,8 @@ Effect::Effect(const std::unordered_map<std::string, std::string>& baseName,
     , _fallbacks{std::move(options.fallbacks)}
 {
   stl_util::concat(_uniformsNames, options.samplers);
+  _resolveUniformSlots();
+  _resolveAttributeKinds();
 
   if (!options.uniformBuffersNames.empty()) {
     for (unsigned int i = 0; i < options.uniformBuffersNames.size(); ++i) {
@@ -193,6 +230,11 @@ size_t Effect::getAttributesCount()
   return _attributes.size();
 }
 
+const std::vector<unsigned int>& Effect::getAttributeKinds() const
+{
+  return _attributeKinds;
+}
+
 int Effect::getUniformIndex(const std::string& uniformName)
 {
   return stl_util::index_of(_uniformsNames, uniformName);
@@ -207,6 +249,19 @@ GL::IGLUniformLocation* Effect::getUniform(const std::string& uniformName)
   return nullptr;
 }
 
+int Effect::getUniformSlot(unsigned int uniformHandle) const
+{
+  return (uniformHandle < _uniformSlots.size()) ?
+           _uniformSlots[uniformHandle] :
+           -1;
+}
+
+GL::IGLUniformLocation* Effect::getUniform(unsigned int uniformHandle)
+{
+  const auto slot = getUniformSlot(uniformHandle);
+  return (slot >= 0) ? _uniformLocations[static_cast<size_t>(slot)] : nullptr;
+}
+
 std::vector<std::string>& Effect::getSamplers()
 {
   return _samplers;
@@ -541,6 +596,7 @@ void Effect::_prepareEffect(const std::string& vertexSourceCode,
 
     _uniforms   = engine->getUniforms(_program.get(), _uniformsNames);
     _attributes = engine->getAttributes(_program.get(), attributesNames);
+    _bindUniformLocations();
 
     for (unsigned int index = 0; index < _samplers.size(); ++index) {
       auto sampler = getUniform(_samplers[index]);
@@ -624,111 +680,174 @@ void Effect::setTextureFromPostProcess(const std::string& channel,
                                      postProcess);
 }
 
-bool Effect::_cacheMatrix(const std::string& uniformName, const Matrix& matrix)
+unsigned int Effect::GetUniformHandle(const std::string& uniformName)
 {
-  auto flag = matrix.updateFlag;
-  if (stl_util::contains(_valueCache, uniformName)
-      && !_valueCache[uniformName].empty()
-      && static_cast<int>(_valueCache[uniformName][0]) == flag) {
-    return false;
+  auto& registry = uniformHandleRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.handles.find(uniformName);
+  if (it != registry.handles.end()) {
+    return it->second;
   }
 
-  _valueCache[uniformName].emplace_back(static_cast<float>(flag));
+  const auto handle = static_cast<unsigned int>(registry.handles.size());
+  registry.handles[uniformName] = handle;
 
-  return true;
+  return handle;
 }
 
-bool Effect::_cacheFloat2(const std::string& uniformName, float x, float y)
+void Effect::_resolveUniformSlots()
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y};
-    return true;
+  _uniformSlots.clear();
+  for (size_t slot = 0; slot < _uniformsNames.size(); ++slot) {
+    const auto handle = Effect::GetUniformHandle(_uniformsNames[slot]);
+    if (handle >= _uniformSlots.size()) {
+      _uniformSlots.resize(handle + 1, -1);
+    }
+    if (_uniformSlots[handle] < 0) {
+      _uniformSlots[handle] = static_cast<int>(slot);
+    }
   }
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
+  _uniformLocations.assign(_uniformsNames.size(), nullptr);
+  _uniformStates.assign(_uniformsNames.size(), UniformState());
+}
+
+void Effect::_resolveAttributeKinds()
+{
+  _attributeKinds.clear();
+  _attributeKinds.reserve(_attributesNames.size());
+  for (const auto& attributeName : _attributesNames) {
+    _attributeKinds.emplace_back(VertexBuffer::KindFromString(attributeName));
   }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+}
+
+void Effect::_bindUniformLocations()
+{
+  for (size_t slot = 0; slot < _uniformsNames.size(); ++slot) {
+    auto it                 = _uniforms.find(_uniformsNames[slot]);
+    _uniformLocations[slot] = (it != _uniforms.end()) ? it->second.get() :
+                                                        nullptr;
+    _uniformStates[slot].isCached = false;
   }
+}
 
-  return changed;
+int Effect::_getActiveUniformSlot(unsigned int uniformHandle) const
+{
+  const auto slot = getUniformSlot(uniformHandle);
+  return (slot >= 0 && _uniformLocations[static_cast<size_t>(slot)]) ? slot :
+                                                                        -1;
 }
 
-bool Effect::_cacheFloat3(const std::string& uniformName, float x, float y,
-                          float z)
+bool Effect::_cacheMatrix(int slot, const Matrix& matrix)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z};
-    return true;
+  auto& state = _uniformStates[static_cast<size_t>(slot)];
+  if (state.isCached && state.updateFlag == matrix.updateFlag) {
+    return false;
   }
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
-  }
+  state.updateFlag = matrix.updateFlag;
+  state.isCached   = true;
 
-  return changed;
+  return true;
 }
 
-bool Effect::_cacheFloat4(const std::string& uniformName, float x, float y,
-                          float z, float w)
+bool Effect::_cacheFloat(int slot, float x)
 {
-  if (!stl_util::contains(_valueCache, uniformName)) {
-    _valueCache[uniformName] = {x, y, z, w};
-    return true;
+  auto& state = _uniformStates[static_cast<size_t>(slot)];
+  if (state.isCached && stl_util::almost_equal(state.values[0], x)) {
+    return false;
   }
 
-  bool changed = false;
-  auto& cache  = _valueCache[uniformName];
-  if (!stl_util::almost_equal(cache[0], x)) {
-    cache[0] = x;
-    changed  = true;
-  }
-  if (!stl_util::almost_equal(cache[1], y)) {
-    cache[1] = y;
-    changed  = true;
+  state.values[0] = x;
+  state.isCached  = true;
+
+  return true;
+}
+
+bool Effect::_cacheFloat2(int slot, float x, float y)
+{
+  auto& state = _uniformStates[static_cast<size_t>(slot)];
+  if (state.isCached && stl_util::almost_equal(state.values[0], x)
+      && stl_util::almost_equal(state.values[1], y)) {
+    return false;
   }
-  if (!stl_util::almost_equal(cache[2], z)) {
-    cache[2] = z;
-    changed  = true;
+
+  state.values[0] = x;
+  state.values[1] = y;
+  state.isCached  = true;
+
+  return true;
+}
+
+bool Effect::_cacheFloat3(int slot, float x, float y, float z)
+{
+  auto& state = _uniformStates[static_cast<size_t>(slot)];
+  if (state.isCached && stl_util::almost_equal(state.values[0], x)
+      && stl_util::almost_equal(state.values[1], y)
+      && stl_util::almost_equal(state.values[2], z)) {
+    return false;
   }
-  if (!stl_util::almost_equal(cache[3], w)) {
-    cache[3] = w;
-    changed  = true;
+
+  state.values[0] = x;
+  state.values[1] = y;
+  state.values[2] = z;
+  state.isCached  = true;
+
+  return true;
+}
+
+bool Effect::_cacheFloat4(int slot, float x, float y, float z, float w)
+{
+  auto& state = _uniformStates[static_cast<size_t>(slot)];
+  if (state.isCached && stl_util::almost_equal(state.values[0], x)
+      && stl_util::almost_equal(state.values[1], y)
+      && stl_util::almost_equal(state.values[2], z)
+      && stl_util::almost_equal(state.values[3], w)) {
+    return false;
   }
 
-  return changed;
+  state.values[0] = x;
+  state.values[1] = y;
+  state.values[2] = z;
+  state.values[3] = w;
+  state.isCached  = true;
+
+  return true;
 }
 
-void Effect::bindUniformBuffer(GL::IGLBuffer* _buffer, const std::string& name)
+void Effect::ResetCache(Engine* engine)
 {
-  if (stl_util::contains(_uniformBuffersNames, name)) {
-    if (stl_util::contains(Effect::_baseCache, _uniformBuffersNames[name])
-        && Effect::_baseCache[_uniformBuffersNames[name]] == _buffer) {
-      return;
+  for (auto& item : Effect::_baseCache) {
+    if (item.second) {
+      engine->_releaseBuffer(item.second);
     }
   }
-  else {
+  Effect::_baseCache.clear();
+}
+
+void Effect::bindUniformBuffer(GL::IGLBuffer* _buffer, const std::string& name)
+{
+  if (!stl_util::contains(_uniformBuffersNames, name)) {
     _uniformBuffersNames[name] = 0;
   }
 
-  Effect::_baseCache[_uniformBuffersNames[name]] = _buffer;
-  _engine->bindUniformBufferBase(_buffer, _uniformBuffersNames[name]);
+  const auto location = _uniformBuffersNames[name];
+  auto& cachedBuffer  = Effect::_baseCache[location];
+  if (cachedBuffer == _buffer) {
+    return;
+  }
+
+  // The binding point keeps a reference on the bound buffer, so that a buffer
+  // released by its owner is only deleted once it is no longer bound
+  if (_buffer) {
+    ++_buffer->references;
+  }
+  if (cachedBuffer) {
+    _engine->_releaseBuffer(cachedBuffer);
+  }
+
+  cachedBuffer = _buffer;
+  _engine->bindUniformBufferBase(_buffer, location);
 }
 
 void Effect::bindUniformBlock(const std::string& blockName, unsigned index)
@@ -739,8 +858,16 @@ void Effect::bindUniformBlock(const std::string& blockName, unsigned index)
 Effect& Effect::setIntArray(const std::string& uniformName,
                             const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray(getUniform(uniformName), array);
+  return setIntArray(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setIntArray(unsigned int uniformHandle, const Int32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setIntArray(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -748,8 +875,17 @@ Effect& Effect::setIntArray(const std::string& uniformName,
 Effect& Effect::setIntArray2(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray2(getUniform(uniformName), array);
+  return setIntArray2(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setIntArray2(unsigned int uniformHandle,
+                             const Int32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setIntArray2(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -757,8 +893,17 @@ Effect& Effect::setIntArray2(const std::string& uniformName,
 Effect& Effect::setIntArray3(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray3(getUniform(uniformName), array);
+  return setIntArray3(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setIntArray3(unsigned int uniformHandle,
+                             const Int32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setIntArray3(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -766,8 +911,17 @@ Effect& Effect::setIntArray3(const std::string& uniformName,
 Effect& Effect::setIntArray4(const std::string& uniformName,
                              const Int32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setIntArray4(getUniform(uniformName), array);
+  return setIntArray4(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setIntArray4(unsigned int uniformHandle,
+                             const Int32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setIntArray4(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -775,8 +929,17 @@ Effect& Effect::setIntArray4(const std::string& uniformName,
 Effect& Effect::setFloatArray(const std::string& uniformName,
                               const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray(getUniform(uniformName), array);
+  return setFloatArray(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setFloatArray(unsigned int uniformHandle,
+                              const Float32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setFloatArray(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -784,8 +947,18 @@ Effect& Effect::setFloatArray(const std::string& uniformName,
 Effect& Effect::setFloatArray2(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray2(getUniform(uniformName), array);
+  return setFloatArray2(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setFloatArray2(unsigned int uniformHandle,
+                               const Float32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setFloatArray2(_uniformLocations[static_cast<size_t>(slot)],
+                            array);
+  }
 
   return *this;
 }
@@ -793,8 +966,18 @@ Effect& Effect::setFloatArray2(const std::string& uniformName,
 Effect& Effect::setFloatArray3(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray3(getUniform(uniformName), array);
+  return setFloatArray3(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setFloatArray3(unsigned int uniformHandle,
+                               const Float32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setFloatArray3(_uniformLocations[static_cast<size_t>(slot)],
+                            array);
+  }
 
   return *this;
 }
@@ -802,8 +985,18 @@ Effect& Effect::setFloatArray3(const std::string& uniformName,
 Effect& Effect::setFloatArray4(const std::string& uniformName,
                                const Float32Array& array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setFloatArray4(getUniform(uniformName), array);
+  return setFloatArray4(findUniformHandle(uniformName), array);
+}
+
+Effect& Effect::setFloatArray4(unsigned int uniformHandle,
+                               const Float32Array& array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setFloatArray4(_uniformLocations[static_cast<size_t>(slot)],
+                            array);
+  }
 
   return *this;
 }
@@ -811,8 +1004,16 @@ Effect& Effect::setFloatArray4(const std::string& uniformName,
 Effect& Effect::setArray(const std::string& uniformName,
                          std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray(getUniform(uniformName), array);
+  return setArray(findUniformHandle(uniformName), std::move(array));
+}
+
+Effect& Effect::setArray(unsigned int uniformHandle, std::vector<float> array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setArray(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -820,8 +1021,16 @@ Effect& Effect::setArray(const std::string& uniformName,
 Effect& Effect::setArray2(const std::string& uniformName,
                           std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray2(getUniform(uniformName), array);
+  return setArray2(findUniformHandle(uniformName), std::move(array));
+}
+
+Effect& Effect::setArray2(unsigned int uniformHandle, std::vector<float> array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setArray2(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -829,8 +1038,16 @@ Effect& Effect::setArray2(const std::string& uniformName,
 Effect& Effect::setArray3(const std::string& uniformName,
                           std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray3(getUniform(uniformName), array);
+  return setArray3(findUniformHandle(uniformName), std::move(array));
+}
+
+Effect& Effect::setArray3(unsigned int uniformHandle, std::vector<float> array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setArray3(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
@@ -838,29 +1055,52 @@ Effect& Effect::setArray3(const std::string& uniformName,
 Effect& Effect::setArray4(const std::string& uniformName,
                           std::vector<float> array)
 {
-  _valueCache.erase(uniformName);
-  _engine->setArray4(getUniform(uniformName), array);
+  return setArray4(findUniformHandle(uniformName), std::move(array));
+}
+
+Effect& Effect::setArray4(unsigned int uniformHandle, std::vector<float> array)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setArray4(_uniformLocations[static_cast<size_t>(slot)], array);
+  }
 
   return *this;
 }
 
 Effect& Effect::setMatrices(const std::string& uniformName,
                             Float32Array matrices)
+{
+  return setMatrices(findUniformHandle(uniformName), std::move(matrices));
+}
+
+Effect& Effect::setMatrices(unsigned int uniformHandle, Float32Array matrices)
 {
   if (matrices.empty()) {
     return *this;
   }
 
-  _valueCache.erase(uniformName);
-  _engine->setMatrices(getUniform(uniformName), matrices);
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setMatrices(_uniformLocations[static_cast<size_t>(slot)],
+                         matrices);
+  }
 
   return *this;
 }
 
 Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 {
-  if (_cacheMatrix(uniformName, matrix)) {
-    _engine->setMatrix(getUniform(uniformName), matrix);
+  return setMatrix(findUniformHandle(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix(unsigned int uniformHandle, const Matrix& matrix)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheMatrix(slot, matrix)) {
+    _engine->setMatrix(_uniformLocations[static_cast<size_t>(slot)], matrix);
   }
 
   return *this;
@@ -869,8 +1109,18 @@ Effect& Effect::setMatrix(const std::string& uniformName, const Matrix& matrix)
 Effect& Effect::setMatrix3x3(const std::string& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  _engine->setMatrix3x3(getUniform(uniformName), matrix);
+  return setMatrix3x3(findUniformHandle(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix3x3(unsigned int uniformHandle,
+                             const Float32Array& matrix)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setMatrix3x3(_uniformLocations[static_cast<size_t>(slot)],
+                          matrix);
+  }
 
   return *this;
 }
@@ -878,37 +1128,49 @@ Effect& Effect::setMatrix3x3(const std::string& uniformName,
 Effect& Effect::setMatrix2x2(const std::string& uniformName,
                              const Float32Array& matrix)
 {
-  _valueCache.erase(uniformName);
-  _engine->setMatrix2x2(getUniform(uniformName), matrix);
+  return setMatrix2x2(findUniformHandle(uniformName), matrix);
+}
+
+Effect& Effect::setMatrix2x2(unsigned int uniformHandle,
+                             const Float32Array& matrix)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0) {
+    _uniformStates[static_cast<size_t>(slot)].isCached = false;
+    _engine->setMatrix2x2(_uniformLocations[static_cast<size_t>(slot)],
+                          matrix);
+  }
 
   return *this;
 }
 
 Effect& Effect::setFloat(const std::string& uniformName, float value)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0], value)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = {value};
+  return setFloat(findUniformHandle(uniformName), value);
+}
 
-  _engine->setFloat(getUniform(uniformName), value);
+Effect& Effect::setFloat(unsigned int uniformHandle, float value)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat(slot, value)) {
+    _engine->setFloat(_uniformLocations[static_cast<size_t>(slot)], value);
+  }
 
   return *this;
 }
 
 Effect& Effect::setBool(const std::string& uniformName, bool _bool)
 {
-  if (stl_util::contains(_valueCache, uniformName)
-      && stl_util::almost_equal(_valueCache[uniformName][0],
-                                _bool ? 1.f : 0.f)) {
-    return *this;
-  }
-
-  _valueCache[uniformName] = {_bool ? 1.f : 0.f};
+  return setBool(findUniformHandle(uniformName), _bool);
+}
 
-  _engine->setBool(getUniform(uniformName), _bool ? 1 : 0);
+Effect& Effect::setBool(unsigned int uniformHandle, bool _bool)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat(slot, _bool ? 1.f : 0.f)) {
+    _engine->setBool(_uniformLocations[static_cast<size_t>(slot)],
+                     _bool ? 1 : 0);
+  }
 
   return *this;
 }
@@ -916,17 +1178,24 @@ Effect& Effect::setBool(const std::string& uniformName, bool _bool)
 Effect& Effect::setVector2(const std::string& uniformName,
                            const Vector2& vector2)
 {
-  if (_cacheFloat2(uniformName, vector2.x, vector2.y)) {
-    _engine->setFloat2(getUniform(uniformName), vector2.x, vector2.y);
-  }
+  return setFloat2(findUniformHandle(uniformName), vector2.x, vector2.y);
+}
 
-  return *this;
+Effect& Effect::setVector2(unsigned int uniformHandle, const Vector2& vector2)
+{
+  return setFloat2(uniformHandle, vector2.x, vector2.y);
 }
 
 Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
 {
-  if (_cacheFloat2(uniformName, x, y)) {
-    _engine->setFloat2(getUniform(uniformName), x, y);
+  return setFloat2(findUniformHandle(uniformName), x, y);
+}
+
+Effect& Effect::setFloat2(unsigned int uniformHandle, float x, float y)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat2(slot, x, y)) {
+    _engine->setFloat2(_uniformLocations[static_cast<size_t>(slot)], x, y);
   }
 
   return *this;
@@ -935,19 +1204,26 @@ Effect& Effect::setFloat2(const std::string& uniformName, float x, float y)
 Effect& Effect::setVector3(const std::string& uniformName,
                            const Vector3& vector3)
 {
-  if (_cacheFloat3(uniformName, vector3.x, vector3.y, vector3.z)) {
-    _engine->setFloat3(getUniform(uniformName), vector3.x, vector3.y,
-                       vector3.z);
-  }
+  return setFloat3(findUniformHandle(uniformName), vector3.x, vector3.y,
+                   vector3.z);
+}
 
-  return *this;
+Effect& Effect::setVector3(unsigned int uniformHandle, const Vector3& vector3)
+{
+  return setFloat3(uniformHandle, vector3.x, vector3.y, vector3.z);
 }
 
 Effect& Effect::setFloat3(const std::string& uniformName, float x, float y,
                           float z)
 {
-  if (_cacheFloat3(uniformName, x, y, z)) {
-    _engine->setFloat3(getUniform(uniformName), x, y, z);
+  return setFloat3(findUniformHandle(uniformName), x, y, z);
+}
+
+Effect& Effect::setFloat3(unsigned int uniformHandle, float x, float y, float z)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat3(slot, x, y, z)) {
+    _engine->setFloat3(_uniformLocations[static_cast<size_t>(slot)], x, y, z);
   }
 
   return *this;
@@ -956,19 +1232,28 @@ Effect& Effect::setFloat3(const std::string& uniformName, float x, float y,
 Effect& Effect::setVector4(const std::string& uniformName,
                            const Vector4& vector4)
 {
-  if (_cacheFloat4(uniformName, vector4.x, vector4.y, vector4.z, vector4.w)) {
-    _engine->setFloat4(getUniform(uniformName), vector4.x, vector4.y, vector4.z,
-                       vector4.w);
-  }
+  return setFloat4(findUniformHandle(uniformName), vector4.x, vector4.y,
+                   vector4.z, vector4.w);
+}
 
-  return *this;
+Effect& Effect::setVector4(unsigned int uniformHandle, const Vector4& vector4)
+{
+  return setFloat4(uniformHandle, vector4.x, vector4.y, vector4.z, vector4.w);
 }
 
 Effect& Effect::setFloat4(const std::string& uniformName, float x, float y,
                           float z, float w)
 {
-  if (_cacheFloat4(uniformName, x, y, z, w)) {
-    _engine->setFloat4(getUniform(uniformName), x, y, z, w);
+  return setFloat4(findUniformHandle(uniformName), x, y, z, w);
+}
+
+Effect& Effect::setFloat4(unsigned int uniformHandle, float x, float y,
+                          float z, float w)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat4(slot, x, y, z, w)) {
+    _engine->setFloat4(_uniformLocations[static_cast<size_t>(slot)], x, y, z,
+                       w);
   }
 
   return *this;
@@ -976,8 +1261,14 @@ Effect& Effect::setFloat4(const std::string& uniformName, float x, float y,
 
 Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
 {
-  if (_cacheFloat3(uniformName, color3.r, color3.g, color3.b)) {
-    _engine->setColor3(getUniform(uniformName), color3);
+  return setColor3(findUniformHandle(uniformName), color3);
+}
+
+Effect& Effect::setColor3(unsigned int uniformHandle, const Color3& color3)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat3(slot, color3.r, color3.g, color3.b)) {
+    _engine->setColor3(_uniformLocations[static_cast<size_t>(slot)], color3);
   }
 
   return *this;
@@ -986,8 +1277,16 @@ Effect& Effect::setColor3(const std::string& uniformName, const Color3& color3)
 Effect& Effect::setColor4(const std::string& uniformName, const Color3& color3,
                           float alpha)
 {
-  if (_cacheFloat4(uniformName, color3.r, color3.g, color3.b, alpha)) {
-    _engine->setColor4(getUniform(uniformName), color3, alpha);
+  return setColor4(findUniformHandle(uniformName), color3, alpha);
+}
+
+Effect& Effect::setColor4(unsigned int uniformHandle, const Color3& color3,
+                          float alpha)
+{
+  const auto slot = _getActiveUniformSlot(uniformHandle);
+  if (slot >= 0 && _cacheFloat4(slot, color3.r, color3.g, color3.b, alpha)) {
+    _engine->setColor4(_uniformLocations[static_cast<size_t>(slot)], color3,
+                       alpha);
   }
 
   return *this;
@@ -48,6 +48,7 @@
 #include <babylon/shaders/shadersinclude/shadows_fragment_functions_fx.h>
 #include <babylon/shaders/shadersinclude/shadows_vertex_fx.h>
 #include <babylon/shaders/shadersinclude/shadows_vertex_declaration_fx.h>
+#include <babylon/shaders/shadersinclude/vertex_compression_declaration_fx.h>
 
 namespace BABYLON {
 
@@ -99,7 +100,8 @@ std::unordered_map<std::string, const char*> EffectIncludesShadersStore::Shaders
    {"reflectionFunction", reflectionFunction},
    {"shadowsFragmentFunctions", shadowsFragmentFunctions},
    {"shadowsVertex", shadowsVertex},
-   {"shadowsVertexDeclaration", shadowsVertexDeclaration}
+   {"shadowsVertexDeclaration", shadowsVertexDeclaration},
+   {"vertexCompressionDeclaration", vertexCompressionDeclaration}
 };
 
 } // end of namespace BABYLON
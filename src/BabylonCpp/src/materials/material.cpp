@@ -282,7 +282,8 @@ void Material::bindSceneUniformBuffer(Effect* effect, UniformBuffer* sceneUbo)
 void Material::bindView(Effect* effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("view", getScene()->getViewMatrix());
+    static const auto viewHandle = Effect::GetUniformHandle("view");
+    effect->setMatrix(viewHandle, getScene()->getViewMatrix());
   }
   else {
     bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
@@ -292,7 +293,9 @@ void Material::bindView(Effect* effect)
 void Material::bindViewProjection(Effect* effect)
 {
   if (!_useUBO) {
-    effect->setMatrix("viewProjection", getScene()->getTransformMatrix());
+    static const auto viewProjectionHandle
+      = Effect::GetUniformHandle("viewProjection");
+    effect->setMatrix(viewProjectionHandle, getScene()->getTransformMatrix());
   }
   else {
     bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
@@ -7,6 +7,8 @@ MaterialDefines::MaterialDefines()
     , BonesPerMesh{0}
     , NUM_MORPH_INFLUENCERS{0}
     , TANGENT{false}
+    , NORMAL_OCTAHEDRAL{false}
+    , TANGENT_OCTAHEDRAL{false}
     , SHADOWS{false}
     , LIGHTMAPEXCLUDED{false}
     , USERIGHTHANDEDSYSTEM{false}
@@ -56,6 +58,7 @@ void MaterialDefines::resizeLights(unsigned int lightIndex)
       shadowesms.emplace_back(false);
       shadowpcfs.emplace_back(false);
       shadowcubes.emplace_back(false);
+      shadowcsms.emplace_back(false);
       lightmapexcluded.emplace_back(false);
       lightmapnospecular.emplace_back(false);
     }
@@ -79,6 +82,12 @@ std::ostream& operator<<(std::ostream& os,
   if (materialDefines.TANGENT) {
     os << "#define TANGENT " << materialDefines.TANGENT << "\n";
   }
+  if (materialDefines.NORMAL_OCTAHEDRAL) {
+    os << "#define NORMAL_OCTAHEDRAL\n";
+  }
+  if (materialDefines.TANGENT_OCTAHEDRAL) {
+    os << "#define TANGENT_OCTAHEDRAL\n";
+  }
   if (materialDefines.SHADOWS) {
     os << "#define SHADOWS " << materialDefines.SHADOWS << "\n";
   }
@@ -141,6 +150,12 @@ std::ostream& operator<<(std::ostream& os,
     }
   }
 
+  for (size_t i = 0; i < materialDefines.shadowcsms.size(); ++i) {
+    if (materialDefines.shadowcsms[i]) {
+      os << "#define SHADOWCSM" << i << "\n";
+    }
+  }
+
   return os;
 }
 
@@ -207,14 +222,14 @@ void MaterialDefines::markAsMiscDirty()
 void MaterialDefines::rebuild()
 {
   defines.resize(_keys.size());
-  for (size_t i = 0; i < _keys.size(); ++i) {
-    defines[i] = false;
-  }
+  defines.reset();
 
   NUM_BONE_INFLUENCERS  = 0;
   BonesPerMesh          = 0;
   NUM_MORPH_INFLUENCERS = 0;
   TANGENT               = false;
+  NORMAL_OCTAHEDRAL     = false;
+  TANGENT_OCTAHEDRAL    = false;
   SHADOWS               = false;
   LIGHTMAPEXCLUDED      = false;
   USERIGHTHANDEDSYSTEM  = false;
@@ -222,24 +237,14 @@ void MaterialDefines::rebuild()
 
 bool MaterialDefines::isEqual(const MaterialDefines& other) const
 {
-  if ((defines.size() != other.defines.size())
-      || (_keys.size() != other._keys.size())
-      || (lights.size() != other.lights.size())
-      || (pointlights.size() != other.pointlights.size())
-      || (dirlights.size() != other.dirlights.size())
-      || (hemilights.size() != other.hemilights.size())
-      || (spotlights.size() != other.spotlights.size())
-      || (shadows.size() != other.shadows.size())
-      || (shadowesms.size() != other.shadowesms.size())
-      || (shadowpcfs.size() != other.shadowpcfs.size())
-      || (shadowcubes.size() != other.shadowcubes.size())) {
-    return false;
-  }
-
-  if ((NUM_BONE_INFLUENCERS != other.NUM_BONE_INFLUENCERS)
+  if ((_keys.size() != other._keys.size())
+      || (NUM_BONE_INFLUENCERS != other.NUM_BONE_INFLUENCERS)
       || (BonesPerMesh != other.BonesPerMesh)
       || (NUM_MORPH_INFLUENCERS != other.NUM_MORPH_INFLUENCERS)
-      || (TANGENT != other.TANGENT) || (SHADOWS != other.SHADOWS)
+      || (TANGENT != other.TANGENT)
+      || (NORMAL_OCTAHEDRAL != other.NORMAL_OCTAHEDRAL)
+      || (TANGENT_OCTAHEDRAL != other.TANGENT_OCTAHEDRAL)
+      || (SHADOWS != other.SHADOWS)
       || (LIGHTMAPEXCLUDED != other.LIGHTMAPEXCLUDED)
       || (USERIGHTHANDEDSYSTEM != other.USERIGHTHANDEDSYSTEM)
       || (_isDirty != other._isDirty) || (_renderId != other._renderId)
@@ -253,10 +258,15 @@ bool MaterialDefines::isEqual(const MaterialDefines& other) const
     return false;
   }
 
-  for (size_t i = 0; i < defines.size(); ++i) {
-    if (defines[i] != other.defines[i]) {
-      return false;
-    }
+  // The bit sets are compared a word at a time
+  if ((defines != other.defines) || (lights != other.lights)
+      || (pointlights != other.pointlights) || (dirlights != other.dirlights)
+      || (hemilights != other.hemilights) || (spotlights != other.spotlights)
+      || (shadows != other.shadows) || (shadowesms != other.shadowesms)
+      || (shadowpcfs != other.shadowpcfs)
+      || (shadowcubes != other.shadowcubes)
+      || (shadowcsms != other.shadowcsms)) {
+    return false;
   }
 
   for (size_t i = 0; i < _keys.size(); ++i) {
@@ -265,60 +275,6 @@ bool MaterialDefines::isEqual(const MaterialDefines& other) const
     }
   }
 
-  for (size_t i = 0; i < lights.size(); ++i) {
-    if (lights[i] != other.lights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < pointlights.size(); ++i) {
-    if (pointlights[i] != other.pointlights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < dirlights.size(); ++i) {
-    if (dirlights[i] != other.dirlights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < hemilights.size(); ++i) {
-    if (hemilights[i] != other.hemilights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < spotlights.size(); ++i) {
-    if (spotlights[i] != other.spotlights[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < shadows.size(); ++i) {
-    if (shadows[i] != other.shadows[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < shadowesms.size(); ++i) {
-    if (shadowesms[i] != other.shadowesms[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < shadowpcfs.size(); ++i) {
-    if (shadowpcfs[i] != other.shadowpcfs[i]) {
-      return false;
-    }
-  }
-
-  for (size_t i = 0; i < shadowcubes.size(); ++i) {
-    if (shadowcubes[i] != other.shadowcubes[i]) {
-      return false;
-    }
-  }
-
   return true;
 }
 
@@ -331,6 +287,8 @@ void MaterialDefines::cloneTo(MaterialDefines& other)
   other.BonesPerMesh          = BonesPerMesh;
   other.NUM_MORPH_INFLUENCERS = NUM_MORPH_INFLUENCERS;
   other.TANGENT               = TANGENT;
+  other.NORMAL_OCTAHEDRAL     = NORMAL_OCTAHEDRAL;
+  other.TANGENT_OCTAHEDRAL    = TANGENT_OCTAHEDRAL;
   other.SHADOWS               = SHADOWS;
   other.LIGHTMAPEXCLUDED      = LIGHTMAPEXCLUDED;
   other.USERIGHTHANDEDSYSTEM  = USERIGHTHANDEDSYSTEM;
@@ -355,18 +313,19 @@ void MaterialDefines::cloneTo(MaterialDefines& other)
   other.shadowesms  = shadowesms;
   other.shadowpcfs  = shadowpcfs;
   other.shadowcubes = shadowcubes;
+  other.shadowcsms  = shadowcsms;
 }
 
 void MaterialDefines::reset()
 {
-  for (size_t i = 0; i < defines.size(); ++i) {
-    defines[i] = false;
-  }
+  defines.reset();
 
   NUM_BONE_INFLUENCERS  = 0;
   BonesPerMesh          = 0;
   NUM_MORPH_INFLUENCERS = 0;
   TANGENT               = false;
+  NORMAL_OCTAHEDRAL     = false;
+  TANGENT_OCTAHEDRAL    = false;
   SHADOWS               = false;
   LIGHTMAPEXCLUDED      = false;
   USERIGHTHANDEDSYSTEM  = false;
@@ -391,6 +350,7 @@ void MaterialDefines::reset()
   shadowesms.clear();
   shadowpcfs.clear();
   shadowcubes.clear();
+  shadowcsms.clear();
 }
 
 std::string MaterialDefines::toString() const
@@ -401,4 +361,45 @@ std::string MaterialDefines::toString() const
   return oss.str();
 }
 
+uint64_t MaterialDefines::hash() const
+{
+  // Same values as the ones written by toString()
+  uint64_t result = defines.hash();
+  for (const auto* bitset :
+       {&lights, &pointlights, &dirlights, &hemilights, &spotlights, &shadows,
+        &shadowesms, &shadowpcfs, &shadowcubes, &shadowcsms}) {
+    result = DefinesBitset::Combine(result, bitset->hash());
+  }
+  result = DefinesBitset::Combine(result, NUM_BONE_INFLUENCERS);
+  result = DefinesBitset::Combine(result, BonesPerMesh);
+  result = DefinesBitset::Combine(result, NUM_MORPH_INFLUENCERS);
+  return DefinesBitset::Combine(result, (TANGENT ? 1u : 0u)
+                                          | (SHADOWS ? 2u : 0u)
+                                          | (LIGHTMAPEXCLUDED ? 4u : 0u)
+                                          | (NORMAL_OCTAHEDRAL ? 8u : 0u)
+                                          | (TANGENT_OCTAHEDRAL ? 16u : 0u));
+}
+
+bool MaterialDefines::isCodeEqual(const MaterialDefines& other) const
+{
+  // Same values as the ones written by toString()
+  return (defines == other.defines) && (lights == other.lights)
+         && (pointlights == other.pointlights)
+         && (dirlights == other.dirlights) && (hemilights == other.hemilights)
+         && (spotlights == other.spotlights) && (shadows == other.shadows)
+         && (shadowesms == other.shadowesms)
+         && (shadowpcfs == other.shadowpcfs)
+         && (shadowcubes == other.shadowcubes)
+         && (shadowcsms == other.shadowcsms)
+         && (NUM_BONE_INFLUENCERS == other.NUM_BONE_INFLUENCERS)
+         && (BonesPerMesh == other.BonesPerMesh)
+         && (NUM_MORPH_INFLUENCERS == other.NUM_MORPH_INFLUENCERS)
+         && (TANGENT == other.TANGENT)
+         && (NORMAL_OCTAHEDRAL == other.NORMAL_OCTAHEDRAL)
+         && (TANGENT_OCTAHEDRAL == other.TANGENT_OCTAHEDRAL)
+         && (SHADOWS == other.SHADOWS)
+         && (LIGHTMAPEXCLUDED == other.LIGHTMAPEXCLUDED)
+         && (_keys == other._keys);
+}
+
 } // end of namespace BABYLON
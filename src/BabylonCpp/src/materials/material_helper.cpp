@@ -20,6 +20,7 @@
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_compression.h>
 #include <babylon/morph/morph_target_manager.h>
 
 namespace BABYLON {
@@ -88,6 +89,18 @@ void MaterialHelper::PrepareDefinesForAttributes(
     defines.TANGENT = true;
   }
 
+  // Compressed normals and tangents are decoded by the vertex shader
+  const auto isOctahedral = [mesh](unsigned int kind) {
+    auto _mesh        = dynamic_cast<Mesh*>(mesh);
+    auto vertexBuffer = _mesh ? _mesh->getVertexBuffer(kind) : nullptr;
+    return vertexBuffer
+           && vertexBuffer->getFormat() == VertexCompression::Octahedral16;
+  };
+  defines.NORMAL_OCTAHEDRAL
+    = defines[NORMAL] && isOctahedral(VertexBuffer::NormalKind);
+  defines.TANGENT_OCTAHEDRAL
+    = defines.TANGENT && isOctahedral(VertexBuffer::TangentKind);
+
   if (defines._needUVs) {
     defines.defines[UV1] = mesh->isVerticesDataPresent(VertexBuffer::UVKind);
     defines.defines[UV2] = mesh->isVerticesDataPresent(VertexBuffer::UV2Kind);
@@ -185,6 +198,7 @@ bool MaterialHelper::PrepareDefinesForLights(
       defines.shadowpcfs[lightIndex]  = false;
       defines.shadowesms[lightIndex]  = false;
       defines.shadowcubes[lightIndex] = false;
+      defines.shadowcsms[lightIndex]  = false;
 
       if (mesh && mesh->receiveShadows() && scene->shadowsEnabled()
           && light->shadowEnabled) {
@@ -255,7 +269,9 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
                                      "vLightDirection" + lightIndexStr, //
                                      "vLightGround" + lightIndexStr,    //
                                      "lightMatrix" + lightIndexStr,     //
-                                     "shadowsInfo" + lightIndexStr      //
+                                     "shadowsInfo" + lightIndexStr,     //
+                                     "cascadeMatrices" + lightIndexStr, //
+                                     "cascadeInfo" + lightIndexStr      //
                                    });
 
     samplersList.emplace_back("shadowSampler" + lightIndexStr);
@@ -286,7 +302,9 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
                        "vLightDirection" + lightIndexStr, //
                        "vLightGround" + lightIndexStr,    //
                        "lightMatrix" + lightIndexStr,     //
-                       "shadowsInfo" + lightIndexStr      //
+                       "shadowsInfo" + lightIndexStr,     //
+                       "cascadeMatrices" + lightIndexStr, //
+                       "cascadeInfo" + lightIndexStr      //
                      });
 
     options.uniformBuffersNames.emplace_back("Light" + lightIndexStr);
@@ -298,6 +316,15 @@ void MaterialHelper::PrepareUniformsAndSamplersList(
   }
 }
 
+uint64_t MaterialHelper::EffectDefinesHash(const std::string& shaderName,
+                                           const MaterialDefines& defines,
+                                           unsigned int maxSimultaneousLights)
+{
+  uint64_t hash = DefinesBitset::Mix(std::hash<std::string>()(shaderName));
+  hash          = DefinesBitset::Combine(hash, defines.hash());
+  return DefinesBitset::Combine(hash, maxSimultaneousLights);
+}
+
 void MaterialHelper::HandleFallbacksForShadows(
   MaterialDefines& defines, EffectFallbacks& fallbacks,
   unsigned int maxSimultaneousLights)
@@ -413,7 +440,7 @@ bool MaterialHelper::BindLightShadow(Light* light, Scene* /*scene*/,
 void MaterialHelper::BindLightProperties(Light* light, Effect* effect,
                                          unsigned int lightIndex)
 {
-  light->transferToEffect(effect, std::to_string(lightIndex));
+  light->transferToEffect(effect, lightIndex);
 }
 
 void MaterialHelper::BindLights(Scene* scene, AbstractMesh* mesh,
@@ -424,19 +451,24 @@ void MaterialHelper::BindLights(Scene* scene, AbstractMesh* mesh,
   unsigned int lightIndex    = 0;
   bool depthValuesAlreadySet = false;
 
+  const auto& handles = Light::BlockUniformHandles();
+
   for (auto& light : mesh->_lightSources) {
-    const std::string lightIndexStr = std::to_string(lightIndex);
-    light->_uniformBuffer->bindToEffect(effect, "Light" + lightIndexStr);
+    light->_uniformBuffer->bindToEffect(effect,
+                                       "Light" + std::to_string(lightIndex));
 
     MaterialHelper::BindLightProperties(light, effect, lightIndex);
 
-    light->diffuse.scaleToRef(light->intensity, Tmp::Color3Array[0]);
-    light->_uniformBuffer->updateColor4("vLightDiffuse", Tmp::Color3Array[0],
-                                        light->range, lightIndexStr);
+    const auto& effectHandles = light->effectUniformHandles(lightIndex);
+    auto& tmpColors           = Tmp::Color3Array();
+    light->diffuse.scaleToRef(light->intensity, tmpColors[0]);
+    light->_uniformBuffer->updateColor4(handles.vLightDiffuse, tmpColors[0],
+                                        light->range,
+                                        effectHandles.vLightDiffuse);
     if (defines[SPECULARTERM]) {
-      light->specular.scaleToRef(light->intensity, Tmp::Color3Array[1]);
-      light->_uniformBuffer->updateColor3("vLightSpecular", Tmp::Color3Array[1],
-                                          lightIndexStr);
+      light->specular.scaleToRef(light->intensity, tmpColors[1]);
+      light->_uniformBuffer->updateColor3(handles.vLightSpecular, tmpColors[1],
+                                          effectHandles.vLightSpecular);
     }
 
     // Shadows
@@ -458,9 +490,11 @@ void MaterialHelper::BindFogParameters(Scene* scene, AbstractMesh* mesh,
 {
   if (scene->fogEnabled() && mesh->applyFog()
       && scene->fogMode() != Scene::FOGMODE_NONE) {
-    effect->setFloat4("vFogInfos", static_cast<float>(scene->fogMode()),
+    static const auto vFogInfosHandle = Effect::GetUniformHandle("vFogInfos");
+    static const auto vFogColorHandle = Effect::GetUniformHandle("vFogColor");
+    effect->setFloat4(vFogInfosHandle, static_cast<float>(scene->fogMode()),
                       scene->fogStart, scene->fogEnd, scene->fogDensity);
-    effect->setColor3("vFogColor", scene->fogColor);
+    effect->setColor3(vFogColorHandle, scene->fogColor);
   }
 }
 
@@ -469,7 +503,8 @@ void MaterialHelper::BindBonesParameters(AbstractMesh* mesh, Effect* effect)
   if (mesh && mesh->useBones() && mesh->computeBonesUsingShaders()) {
     const auto& matrices = mesh->skeleton()->getTransformMatrices(mesh);
     if (!matrices.empty()) {
-      effect->setMatrices("mBones", matrices);
+      static const auto mBonesHandle = Effect::GetUniformHandle("mBones");
+      effect->setMatrices(mBonesHandle, matrices);
     }
   }
 }
@@ -483,7 +518,9 @@ void MaterialHelper::BindMorphTargetParameters(AbstractMesh* abstractMesh,
       return;
     }
 
-    effect->setFloatArray("morphTargetInfluences",
+    static const auto morphTargetInfluencesHandle
+      = Effect::GetUniformHandle("morphTargetInfluences");
+    effect->setFloatArray(morphTargetInfluencesHandle,
                           mesh->morphTargetManager()->influences());
   }
 }
@@ -492,8 +529,10 @@ void MaterialHelper::BindLogDepth(MaterialDefines& defines, Effect* effect,
                                   Scene* scene, unsigned int LOGARITHMICDEPTH)
 {
   if (defines[LOGARITHMICDEPTH]) {
+    static const auto logarithmicDepthConstantHandle
+      = Effect::GetUniformHandle("logarithmicDepthConstant");
     effect->setFloat(
-      "logarithmicDepthConstant",
+      logarithmicDepthConstantHandle,
       2.f / (std::log(scene->activeCamera->maxZ + 1.f) / Math::LN2));
   }
 }
@@ -502,8 +541,9 @@ void MaterialHelper::BindClipPlane(Effect* effect, Scene* scene)
 {
   if (scene->clipPlane()) {
     auto clipPlane = scene->clipPlane();
-    effect->setFloat4("vClipPlane", clipPlane->normal.x, clipPlane->normal.y,
-                      clipPlane->normal.z, clipPlane->d);
+    static const auto vClipPlaneHandle = Effect::GetUniformHandle("vClipPlane");
+    effect->setFloat4(vClipPlaneHandle, clipPlane->normal.x,
+                      clipPlane->normal.y, clipPlane->normal.z, clipPlane->d);
   }
 }
 
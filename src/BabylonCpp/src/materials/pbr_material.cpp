@@ -28,6 +28,83 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Handles of the uniforms of the material uniform block, resolved once.
+ */
+struct PBRMaterialUniformHandles {
+  unsigned int vAlbedoInfos;
+  unsigned int vAmbientInfos;
+  unsigned int vOpacityInfos;
+  unsigned int vEmissiveInfos;
+  unsigned int vLightmapInfos;
+  unsigned int vReflectivityInfos;
+  unsigned int vMicroSurfaceSamplerInfos;
+  unsigned int vRefractionInfos;
+  unsigned int vReflectionInfos;
+  unsigned int vBumpInfos;
+  unsigned int albedoMatrix;
+  unsigned int ambientMatrix;
+  unsigned int opacityMatrix;
+  unsigned int emissiveMatrix;
+  unsigned int lightmapMatrix;
+  unsigned int reflectivityMatrix;
+  unsigned int microSurfaceSamplerMatrix;
+  unsigned int bumpMatrix;
+  unsigned int refractionMatrix;
+  unsigned int reflectionMatrix;
+  unsigned int vReflectionColor;
+  unsigned int vAlbedoColor;
+  unsigned int vLightingIntensity;
+  unsigned int vMicrosurfaceTextureLods;
+  unsigned int vReflectivityColor;
+  unsigned int vEmissiveColor;
+  unsigned int opacityParts;
+  unsigned int emissiveLeftColor;
+  unsigned int emissiveRightColor;
+  unsigned int pointSize;
+}; // end of struct PBRMaterialUniformHandles
+
+const PBRMaterialUniformHandles& MaterialUniformHandles()
+{
+  // Same order as the uniform layout
+  static const PBRMaterialUniformHandles handles{
+    Effect::GetUniformHandle("vAlbedoInfos"),
+    Effect::GetUniformHandle("vAmbientInfos"),
+    Effect::GetUniformHandle("vOpacityInfos"),
+    Effect::GetUniformHandle("vEmissiveInfos"),
+    Effect::GetUniformHandle("vLightmapInfos"),
+    Effect::GetUniformHandle("vReflectivityInfos"),
+    Effect::GetUniformHandle("vMicroSurfaceSamplerInfos"),
+    Effect::GetUniformHandle("vRefractionInfos"),
+    Effect::GetUniformHandle("vReflectionInfos"),
+    Effect::GetUniformHandle("vBumpInfos"),
+    Effect::GetUniformHandle("albedoMatrix"),
+    Effect::GetUniformHandle("ambientMatrix"),
+    Effect::GetUniformHandle("opacityMatrix"),
+    Effect::GetUniformHandle("emissiveMatrix"),
+    Effect::GetUniformHandle("lightmapMatrix"),
+    Effect::GetUniformHandle("reflectivityMatrix"),
+    Effect::GetUniformHandle("microSurfaceSamplerMatrix"),
+    Effect::GetUniformHandle("bumpMatrix"),
+    Effect::GetUniformHandle("refractionMatrix"),
+    Effect::GetUniformHandle("reflectionMatrix"),
+    Effect::GetUniformHandle("vReflectionColor"),
+    Effect::GetUniformHandle("vAlbedoColor"),
+    Effect::GetUniformHandle("vLightingIntensity"),
+    Effect::GetUniformHandle("vMicrosurfaceTextureLods"),
+    Effect::GetUniformHandle("vReflectivityColor"),
+    Effect::GetUniformHandle("vEmissiveColor"),
+    Effect::GetUniformHandle("opacityParts"),
+    Effect::GetUniformHandle("emissiveLeftColor"),
+    Effect::GetUniformHandle("emissiveRightColor"),
+    Effect::GetUniformHandle("pointSize")};
+  return handles;
+}
+
+} // end of namespace
+
 Color3 PBRMaterial::_scaledAlbedo       = Color3();
 Color3 PBRMaterial::_scaledReflectivity = Color3();
 Color3 PBRMaterial::_scaledEmissive     = Color3();
@@ -219,13 +296,12 @@ void PBRMaterial::BindLights(Scene* scene, AbstractMesh* mesh, Effect* effect,
 {
   unsigned int lightIndex    = 0;
   bool depthValuesAlreadySet = false;
+  const auto& handles        = Light::BlockUniformHandles();
   for (auto light : mesh->_lightSources) {
-    bool useUbo = light->_uniformBuffer->useUbo();
-
-    const std::string lightIndexStr = std::to_string(lightIndex);
-
-    light->_uniformBuffer->bindToEffect(effect, "Light" + lightIndexStr);
+    light->_uniformBuffer->bindToEffect(effect,
+                                        "Light" + std::to_string(lightIndex));
     MaterialHelper::BindLightProperties(light, effect, lightIndex);
+    const auto& effectHandles = light->effectUniformHandles(lightIndex);
 
     // GAMMA CORRECTION.
     ConvertColorToLinearSpaceToRef(light->diffuse, PBRMaterial::_scaledAlbedo,
@@ -234,9 +310,9 @@ void PBRMaterial::BindLights(Scene* scene, AbstractMesh* mesh, Effect* effect,
     PBRMaterial::_scaledAlbedo.scaleToRef(light->intensity,
                                           PBRMaterial::_scaledAlbedo);
     light->_uniformBuffer->updateColor4(
-      useUbo ? "vLightDiffuse" : "vLightDiffuse" + lightIndexStr,
-      PBRMaterial::_scaledAlbedo,
-      usePhysicalLightFalloff ? light->radius() : light->range, "");
+      handles.vLightDiffuse, PBRMaterial::_scaledAlbedo,
+      usePhysicalLightFalloff ? light->radius() : light->range,
+      effectHandles.vLightDiffuse);
 
     if (defines[PMD::SPECULARTERM]) {
       ConvertColorToLinearSpaceToRef(light->specular,
@@ -245,9 +321,9 @@ void PBRMaterial::BindLights(Scene* scene, AbstractMesh* mesh, Effect* effect,
 
       PBRMaterial::_scaledReflectivity.scaleToRef(
         light->intensity, PBRMaterial::_scaledReflectivity);
-      light->_uniformBuffer->updateColor3(
-        useUbo ? "vLightSpecular" : "vLightSpecular" + lightIndexStr,
-        PBRMaterial::_scaledReflectivity, "");
+      light->_uniformBuffer->updateColor3(handles.vLightSpecular,
+                                          PBRMaterial::_scaledReflectivity,
+                                          effectHandles.vLightSpecular);
     }
 
     // Shadows
@@ -673,199 +749,217 @@ bool PBRMaterial::isReady(AbstractMesh* mesh, bool useInstances)
 
     scene->resetCachedMaterial();
 
-    // Fallbacks
-    auto fallbacks = std::make_unique<EffectFallbacks>();
-    if (_defines[PMD::REFLECTION]) {
-      fallbacks->addFallback(0, "REFLECTION");
-    }
-
-    if (_defines[PMD::REFRACTION]) {
-      fallbacks->addFallback(0, "REFRACTION");
-    }
-
-    if (_defines[PMD::REFLECTIVITY]) {
-      fallbacks->addFallback(0, "REFLECTIVITY");
-    }
-
-    if (_defines[PMD::BUMP]) {
-      fallbacks->addFallback(0, "BUMP");
-    }
-
-    if (_defines[PMD::PARALLAX]) {
-      fallbacks->addFallback(1, "PARALLAX");
-    }
+    // Effect already compiled with the same defines, found without building
+    // the defines string
+    const auto definesHash = MaterialHelper::EffectDefinesHash(
+      "pbr", _defines, maxSimultaneousLights);
+    _effect = engine->getEffectByDefinesHash(definesHash, "pbr", _defines,
+                                             maxSimultaneousLights);
+
+    if (!_effect) {
+      // Fallbacks
+      auto fallbacks = std::make_unique<EffectFallbacks>();
+      if (_defines[PMD::REFLECTION]) {
+        fallbacks->addFallback(0, "REFLECTION");
+      }
 
-    if (_defines[PMD::PARALLAXOCCLUSION]) {
-      fallbacks->addFallback(0, "PARALLAXOCCLUSION");
-    }
+      if (_defines[PMD::REFRACTION]) {
+        fallbacks->addFallback(0, "REFRACTION");
+      }
 
-    if (_defines[PMD::SPECULAROVERALPHA]) {
-      fallbacks->addFallback(0, "SPECULAROVERALPHA");
-    }
+      if (_defines[PMD::REFLECTIVITY]) {
+        fallbacks->addFallback(0, "REFLECTIVITY");
+      }
 
-    if (_defines[PMD::FOG]) {
-      fallbacks->addFallback(1, "FOG");
-    }
+      if (_defines[PMD::BUMP]) {
+        fallbacks->addFallback(0, "BUMP");
+      }
 
-    if (_defines[PMD::POINTSIZE]) {
-      fallbacks->addFallback(0, "POINTSIZE");
-    }
+      if (_defines[PMD::PARALLAX]) {
+        fallbacks->addFallback(1, "PARALLAX");
+      }
 
-    if (_defines[PMD::LOGARITHMICDEPTH]) {
-      fallbacks->addFallback(0, "LOGARITHMICDEPTH");
-    }
+      if (_defines[PMD::PARALLAXOCCLUSION]) {
+        fallbacks->addFallback(0, "PARALLAXOCCLUSION");
+      }
 
-    MaterialHelper::HandleFallbacksForShadows(_defines, *fallbacks.get(),
-                                              maxSimultaneousLights);
+      if (_defines[PMD::SPECULAROVERALPHA]) {
+        fallbacks->addFallback(0, "SPECULAROVERALPHA");
+      }
 
-    if (_defines[PMD::SPECULARTERM]) {
-      fallbacks->addFallback(0, "SPECULARTERM");
-    }
+      if (_defines[PMD::FOG]) {
+        fallbacks->addFallback(1, "FOG");
+      }
 
-    if (_defines[PMD::OPACITYFRESNEL]) {
-      fallbacks->addFallback(1, "OPACITYFRESNEL");
-    }
+      if (_defines[PMD::POINTSIZE]) {
+        fallbacks->addFallback(0, "POINTSIZE");
+      }
 
-    if (_defines[PMD::EMISSIVEFRESNEL]) {
-      fallbacks->addFallback(2, "EMISSIVEFRESNEL");
-    }
+      if (_defines[PMD::LOGARITHMICDEPTH]) {
+        fallbacks->addFallback(0, "LOGARITHMICDEPTH");
+      }
 
-    if (_defines[PMD::FRESNEL]) {
-      fallbacks->addFallback(3, "FRESNEL");
-    }
+      MaterialHelper::HandleFallbacksForShadows(_defines, *fallbacks.get(),
+                                                maxSimultaneousLights);
 
-    if (_defines.NUM_BONE_INFLUENCERS > 0) {
-      fallbacks->addCPUSkinningFallback(0, mesh);
-    }
+      if (_defines[PMD::SPECULARTERM]) {
+        fallbacks->addFallback(0, "SPECULARTERM");
+      }
 
-    // Attributes
-    std::vector<std::string> attribs{
-      std::string(VertexBuffer::PositionKindChars)};
+      if (_defines[PMD::OPACITYFRESNEL]) {
+        fallbacks->addFallback(1, "OPACITYFRESNEL");
+      }
 
-    if (_defines[PMD::NORMAL]) {
-      attribs.emplace_back(std::string(VertexBuffer::NormalKindChars));
-    }
+      if (_defines[PMD::EMISSIVEFRESNEL]) {
+        fallbacks->addFallback(2, "EMISSIVEFRESNEL");
+      }
 
-    if (_defines[PMD::TANGENT]) {
-      attribs.emplace_back(VertexBuffer::TangentKindChars);
-    }
+      if (_defines[PMD::FRESNEL]) {
+        fallbacks->addFallback(3, "FRESNEL");
+      }
 
-    if (_defines[PMD::UV1]) {
-      attribs.emplace_back(std::string(VertexBuffer::UVKindChars));
-    }
+      if (_defines.NUM_BONE_INFLUENCERS > 0) {
+        fallbacks->addCPUSkinningFallback(0, mesh);
+      }
 
-    if (_defines[PMD::UV2]) {
-      attribs.emplace_back(std::string(VertexBuffer::UV2KindChars));
-    }
+      // Attributes
+      std::vector<std::string> attribs{
+        std::string(VertexBuffer::PositionKindChars)};
 
-    if (_defines[PMD::VERTEXCOLOR]) {
-      attribs.emplace_back(std::string(VertexBuffer::ColorKindChars));
-    }
+      if (_defines[PMD::NORMAL]) {
+        attribs.emplace_back(std::string(VertexBuffer::NormalKindChars));
+      }
 
-    MaterialHelper::PrepareAttributesForBones(attribs, mesh, _defines,
-                                              *fallbacks);
-    MaterialHelper::PrepareAttributesForInstances(attribs, _defines,
-                                                  PMD::INSTANCES);
-    MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, _defines,
-                                                     PMD::NORMAL);
-
-    std::string join = _defines.toString();
-
-    std::vector<std::string> uniforms{"world",
-                                      "view",
-                                      "viewProjection",
-                                      "vEyePosition",
-                                      "vLightsType",
-                                      "vAmbientColor",
-                                      "vAlbedoColor",
-                                      "vReflectivityColor",
-                                      "vEmissiveColor",
-                                      "vReflectionColor",
-                                      "vFogInfos",
-                                      "vFogColor",
-                                      "pointSize",
-                                      "vAlbedoInfos",
-                                      "vAmbientInfos",
-                                      "vOpacityInfos",
-                                      "vReflectionInfos",
-                                      "vEmissiveInfos",
-                                      "vReflectivityInfos",
-                                      "vMicroSurfaceSamplerInfos",
-                                      "vBumpInfos",
-                                      "vLightmapInfos",
-                                      "vRefractionInfos",
-                                      "mBones",
-                                      "vClipPlane",
-                                      "albedoMatrix",
-                                      "ambientMatrix",
-                                      "opacityMatrix",
-                                      "reflectionMatrix",
-                                      "emissiveMatrix",
-                                      "reflectivityMatrix",
-                                      "microSurfaceSamplerMatrix",
-                                      "bumpMatrix",
-                                      "lightmapMatrix",
-                                      "refractionMatrix",
-                                      "depthValues",
-                                      "opacityParts",
-                                      "emissiveLeftColor",
-                                      "emissiveRightColor",
-                                      "vLightingIntensity",
-                                      "logarithmicDepthConstant",
-                                      "vSphericalX",
-                                      "vSphericalY",
-                                      "vSphericalZ",
-                                      "vSphericalXX",
-                                      "vSphericalYY",
-                                      "vSphericalZZ",
-                                      "vSphericalXY",
-                                      "vSphericalYZ",
-                                      "vSphericalZX",
-                                      "vMicrosurfaceTextureLods",
-                                      "vCameraInfos"};
-
-    std::vector<std::string> samplers{
-      "albedoSampler",         "ambientSampler",        "opacitySampler",
-      "reflectionCubeSampler", "reflection2DSampler",   "emissiveSampler",
-      "reflectivitySampler",   "microSurfaceSampler",   "bumpSampler",
-      "lightmapSampler",       "refractionCubeSampler", "refraction2DSampler"};
-    std::vector<std::string> uniformBuffers{"Material", "Scene"};
-
-    if (_defines[PMD::CAMERACOLORCURVES]) {
-      ColorCurves::PrepareUniforms(uniforms);
-    }
-    if (_defines[PMD::CAMERACOLORGRADING]) {
-      ColorGradingTexture::PrepareUniformsAndSamplers(uniforms, samplers);
-    }
+      if (_defines[PMD::TANGENT]) {
+        attribs.emplace_back(VertexBuffer::TangentKindChars);
+      }
 
-    const auto _onCompiled = [this](Effect* effect) {
-      if (onCompiled) {
-        onCompiled(effect);
+      if (_defines[PMD::UV1]) {
+        attribs.emplace_back(std::string(VertexBuffer::UVKindChars));
       }
-      bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
-    };
 
-    std::unordered_map<std::string, unsigned int> indexParameters{
-      {"maxSimultaneousLights", maxSimultaneousLights},
-      {"maxSimultaneousMorphTargets", _defines.NUM_MORPH_INFLUENCERS},
-    };
+      if (_defines[PMD::UV2]) {
+        attribs.emplace_back(std::string(VertexBuffer::UV2KindChars));
+      }
 
-    EffectCreationOptions options;
-    options.attributes            = std::move(attribs);
-    options.uniformsNames         = std::move(uniforms);
-    options.uniformBuffersNames   = std::move(uniformBuffers);
-    options.samplers              = std::move(samplers);
-    options.materialDefines       = &_defines;
-    options.defines               = std::move(join);
-    options.fallbacks             = std::move(fallbacks);
-    options.onCompiled            = std::move(_onCompiled);
-    options.onError               = onError;
-    options.indexParameters       = std::move(indexParameters);
-    options.maxSimultaneousLights = maxSimultaneousLights;
+      if (_defines[PMD::VERTEXCOLOR]) {
+        attribs.emplace_back(std::string(VertexBuffer::ColorKindChars));
+      }
 
-    MaterialHelper::PrepareUniformsAndSamplersList(options);
+      MaterialHelper::PrepareAttributesForBones(attribs, mesh, _defines,
+                                                *fallbacks);
+      MaterialHelper::PrepareAttributesForInstances(attribs, _defines,
+                                                    PMD::INSTANCES);
+      MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, _defines,
+                                                       PMD::NORMAL);
+
+      std::string join = _defines.toString();
+
+      std::vector<std::string> uniforms{"world",
+                                        "view",
+                                        "viewProjection",
+                                        "vEyePosition",
+                                        "vLightsType",
+                                        "vAmbientColor",
+                                        "vAlbedoColor",
+                                        "vReflectivityColor",
+                                        "vEmissiveColor",
+                                        "vReflectionColor",
+                                        "vFogInfos",
+                                        "vFogColor",
+                                        "pointSize",
+                                        "vAlbedoInfos",
+                                        "vAmbientInfos",
+                                        "vOpacityInfos",
+                                        "vReflectionInfos",
+                                        "vEmissiveInfos",
+                                        "vReflectivityInfos",
+                                        "vMicroSurfaceSamplerInfos",
+                                        "vBumpInfos",
+                                        "vLightmapInfos",
+                                        "vRefractionInfos",
+                                        "mBones",
+                                        "vClipPlane",
+                                        "albedoMatrix",
+                                        "ambientMatrix",
+                                        "opacityMatrix",
+                                        "reflectionMatrix",
+                                        "emissiveMatrix",
+                                        "reflectivityMatrix",
+                                        "microSurfaceSamplerMatrix",
+                                        "bumpMatrix",
+                                        "lightmapMatrix",
+                                        "refractionMatrix",
+                                        "depthValues",
+                                        "opacityParts",
+                                        "emissiveLeftColor",
+                                        "emissiveRightColor",
+                                        "vLightingIntensity",
+                                        "logarithmicDepthConstant",
+                                        "vSphericalX",
+                                        "vSphericalY",
+                                        "vSphericalZ",
+                                        "vSphericalXX",
+                                        "vSphericalYY",
+                                        "vSphericalZZ",
+                                        "vSphericalXY",
+                                        "vSphericalYZ",
+                                        "vSphericalZX",
+                                        "vMicrosurfaceTextureLods",
+                                        "vCameraInfos"};
+
+      std::vector<std::string> samplers{"albedoSampler",
+                                        "ambientSampler",
+                                        "opacitySampler",
+                                        "reflectionCubeSampler",
+                                        "reflection2DSampler",
+                                        "emissiveSampler",
+                                        "reflectivitySampler",
+                                        "microSurfaceSampler",
+                                        "bumpSampler",
+                                        "lightmapSampler",
+                                        "refractionCubeSampler",
+                                        "refraction2DSampler"};
+      std::vector<std::string> uniformBuffers{"Material", "Scene"};
+
+      if (_defines[PMD::CAMERACOLORCURVES]) {
+        ColorCurves::PrepareUniforms(uniforms);
+      }
+      if (_defines[PMD::CAMERACOLORGRADING]) {
+        ColorGradingTexture::PrepareUniformsAndSamplers(uniforms, samplers);
+      }
 
-    _effect = scene->getEngine()->createEffect("pbr", options, engine);
+      const auto _onCompiled = [this](Effect* effect) {
+        if (onCompiled) {
+          onCompiled(effect);
+        }
+        bindSceneUniformBuffer(effect, getScene()->getSceneUniformBuffer());
+      };
+
+      std::unordered_map<std::string, unsigned int> indexParameters{
+        {"maxSimultaneousLights", maxSimultaneousLights},
+        {"maxSimultaneousMorphTargets", _defines.NUM_MORPH_INFLUENCERS},
+      };
+
+      EffectCreationOptions options;
+      options.attributes            = std::move(attribs);
+      options.uniformsNames         = std::move(uniforms);
+      options.uniformBuffersNames   = std::move(uniformBuffers);
+      options.samplers              = std::move(samplers);
+      options.materialDefines       = &_defines;
+      options.defines               = std::move(join);
+      options.fallbacks             = std::move(fallbacks);
+      options.onCompiled            = std::move(_onCompiled);
+      options.onError               = onError;
+      options.indexParameters       = std::move(indexParameters);
+      options.maxSimultaneousLights = maxSimultaneousLights;
+
+      MaterialHelper::PrepareUniformsAndSamplersList(options);
+
+      _effect = engine->createEffect("pbr", options, engine);
+      engine->registerEffectDefinesHash(definesHash, "pbr", _defines,
+                                        maxSimultaneousLights, _effect);
+    }
 
     buildUniformLayout();
   }
@@ -933,7 +1027,8 @@ void PBRMaterial::unbind()
 
 void PBRMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
-  _effect->setMatrix("world", world);
+  static const auto worldHandle = Effect::GetUniformHandle("world");
+  _effect->setMatrix(worldHandle, world);
 }
 
 void PBRMaterial::bind(Matrix* world, Mesh* mesh)
@@ -953,52 +1048,53 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
     bindViewProjection(effect);
 
     if (!_uniformBuffer->useUbo() || !isFrozen() || !_uniformBuffer->isSync()) {
+      const auto& handles = MaterialUniformHandles();
 
       // Fresnel
       if (StandardMaterial::FresnelEnabled()) {
         if (opacityFresnelParameters && opacityFresnelParameters->isEnabled()) {
           _uniformBuffer->updateColor4(
-            "opacityParts",
+            handles.opacityParts,
             Color3(opacityFresnelParameters->leftColor.toLuminance(),
                    opacityFresnelParameters->rightColor.toLuminance(),
                    opacityFresnelParameters->bias),
-            opacityFresnelParameters->power, "");
+            opacityFresnelParameters->power);
         }
 
         if (emissiveFresnelParameters
             && emissiveFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("emissiveLeftColor",
+          _uniformBuffer->updateColor4(handles.emissiveLeftColor,
                                        emissiveFresnelParameters->leftColor,
-                                       emissiveFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("emissiveRightColor",
+                                       emissiveFresnelParameters->power);
+          _uniformBuffer->updateColor4(handles.emissiveRightColor,
                                        emissiveFresnelParameters->rightColor,
-                                       emissiveFresnelParameters->bias, "");
+                                       emissiveFresnelParameters->bias);
         }
       }
 
       // Texture uniforms
       if (_myScene->texturesEnabled()) {
         if (albedoTexture && StandardMaterial::DiffuseTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vAlbedoInfos",
+          _uniformBuffer->updateFloat2(handles.vAlbedoInfos,
                                        albedoTexture->coordinatesIndex,
                                        albedoTexture->level);
-          _uniformBuffer->updateMatrix("albedoMatrix",
+          _uniformBuffer->updateMatrix(handles.albedoMatrix,
                                        *albedoTexture->getTextureMatrix());
         }
 
         if (ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
           _uniformBuffer->updateFloat3(
-            "vAmbientInfos", ambientTexture->coordinatesIndex,
-            ambientTexture->level, ambientTextureStrength, "");
-          _uniformBuffer->updateMatrix("ambientMatrix",
+            handles.vAmbientInfos, ambientTexture->coordinatesIndex,
+            ambientTexture->level, ambientTextureStrength);
+          _uniformBuffer->updateMatrix(handles.ambientMatrix,
                                        *ambientTexture->getTextureMatrix());
         }
 
         if (opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vOpacityInfos",
+          _uniformBuffer->updateFloat2(handles.vOpacityInfos,
                                        opacityTexture->coordinatesIndex,
                                        opacityTexture->level);
-          _uniformBuffer->updateMatrix("opacityMatrix",
+          _uniformBuffer->updateMatrix(handles.opacityMatrix,
                                        *opacityTexture->getTextureMatrix());
         }
 
@@ -1007,91 +1103,85 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
             static_cast<float>(std::log(reflectionTexture->getSize().width))
             * Math::LOG2E);
           _uniformBuffer->updateMatrix(
-            "reflectionMatrix",
+            handles.reflectionMatrix,
             *reflectionTexture->getReflectionTextureMatrix());
-          _uniformBuffer->updateFloat2("vReflectionInfos",
+          _uniformBuffer->updateFloat2(handles.vReflectionInfos,
                                        reflectionTexture->level, 0.f);
 
           if (_defines[PMD::USESPHERICALFROMREFLECTIONMAP]) {
             auto hdrCubeTexture
               = dynamic_cast<HDRCubeTexture*>(reflectionTexture);
-            _effect->setFloat3("vSphericalX",
-                               hdrCubeTexture->sphericalPolynomial->x.x,
-                               hdrCubeTexture->sphericalPolynomial->x.y,
-                               hdrCubeTexture->sphericalPolynomial->x.z);
-            _effect->setFloat3("vSphericalY",
-                               hdrCubeTexture->sphericalPolynomial->y.x,
-                               hdrCubeTexture->sphericalPolynomial->y.y,
-                               hdrCubeTexture->sphericalPolynomial->y.z);
-            _effect->setFloat3("vSphericalZ",
-                               hdrCubeTexture->sphericalPolynomial->z.x,
-                               hdrCubeTexture->sphericalPolynomial->z.y,
-                               hdrCubeTexture->sphericalPolynomial->z.z);
-            _effect->setFloat3("vSphericalXX",
-                               hdrCubeTexture->sphericalPolynomial->xx.x,
-                               hdrCubeTexture->sphericalPolynomial->xx.y,
-                               hdrCubeTexture->sphericalPolynomial->xx.z);
-            _effect->setFloat3("vSphericalYY",
-                               hdrCubeTexture->sphericalPolynomial->yy.x,
-                               hdrCubeTexture->sphericalPolynomial->yy.y,
-                               hdrCubeTexture->sphericalPolynomial->yy.z);
-            _effect->setFloat3("vSphericalZZ",
-                               hdrCubeTexture->sphericalPolynomial->zz.x,
-                               hdrCubeTexture->sphericalPolynomial->zz.y,
-                               hdrCubeTexture->sphericalPolynomial->zz.z);
-            _effect->setFloat3("vSphericalXY",
-                               hdrCubeTexture->sphericalPolynomial->xy.x,
-                               hdrCubeTexture->sphericalPolynomial->xy.y,
-                               hdrCubeTexture->sphericalPolynomial->xy.z);
-            _effect->setFloat3("vSphericalYZ",
-                               hdrCubeTexture->sphericalPolynomial->yz.x,
-                               hdrCubeTexture->sphericalPolynomial->yz.y,
-                               hdrCubeTexture->sphericalPolynomial->yz.z);
-            _effect->setFloat3("vSphericalZX",
-                               hdrCubeTexture->sphericalPolynomial->zx.x,
-                               hdrCubeTexture->sphericalPolynomial->zx.y,
-                               hdrCubeTexture->sphericalPolynomial->zx.z);
+            static const std::array<unsigned int, 9> vSphericalHandles{{
+              Effect::GetUniformHandle("vSphericalX"),
+              Effect::GetUniformHandle("vSphericalY"),
+              Effect::GetUniformHandle("vSphericalZ"),
+              Effect::GetUniformHandle("vSphericalXX"),
+              Effect::GetUniformHandle("vSphericalYY"),
+              Effect::GetUniformHandle("vSphericalZZ"),
+              Effect::GetUniformHandle("vSphericalXY"),
+              Effect::GetUniformHandle("vSphericalYZ"),
+              Effect::GetUniformHandle("vSphericalZX")}};
+            const auto& polynomial = *hdrCubeTexture->sphericalPolynomial;
+            _effect->setFloat3(vSphericalHandles[0], polynomial.x.x,
+                               polynomial.x.y, polynomial.x.z);
+            _effect->setFloat3(vSphericalHandles[1], polynomial.y.x,
+                               polynomial.y.y, polynomial.y.z);
+            _effect->setFloat3(vSphericalHandles[2], polynomial.z.x,
+                               polynomial.z.y, polynomial.z.z);
+            _effect->setFloat3(vSphericalHandles[3], polynomial.xx.x,
+                               polynomial.xx.y, polynomial.xx.z);
+            _effect->setFloat3(vSphericalHandles[4], polynomial.yy.x,
+                               polynomial.yy.y, polynomial.yy.z);
+            _effect->setFloat3(vSphericalHandles[5], polynomial.zz.x,
+                               polynomial.zz.y, polynomial.zz.z);
+            _effect->setFloat3(vSphericalHandles[6], polynomial.xy.x,
+                               polynomial.xy.y, polynomial.xy.z);
+            _effect->setFloat3(vSphericalHandles[7], polynomial.yz.x,
+                               polynomial.yz.y, polynomial.yz.z);
+            _effect->setFloat3(vSphericalHandles[8], polynomial.zx.x,
+                               polynomial.zx.y, polynomial.zx.z);
           }
         }
 
         if (emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vEmissiveInfos",
+          _uniformBuffer->updateFloat2(handles.vEmissiveInfos,
                                        emissiveTexture->coordinatesIndex,
                                        emissiveTexture->level);
-          _uniformBuffer->updateMatrix("emissiveMatrix",
+          _uniformBuffer->updateMatrix(handles.emissiveMatrix,
                                        *emissiveTexture->getTextureMatrix());
         }
 
         if (lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vLightmapInfos",
+          _uniformBuffer->updateFloat2(handles.vLightmapInfos,
                                        lightmapTexture->coordinatesIndex,
                                        lightmapTexture->level);
-          _uniformBuffer->updateMatrix("lightmapMatrix",
+          _uniformBuffer->updateMatrix(handles.lightmapMatrix,
                                        *lightmapTexture->getTextureMatrix());
         }
 
         if (StandardMaterial::SpecularTextureEnabled()) {
           if (metallicTexture) {
             _uniformBuffer->updateFloat3(
-              "vReflectivityInfos", metallicTexture->coordinatesIndex,
-              metallicTexture->level, ambientTextureStrength, "");
-            _uniformBuffer->updateMatrix("reflectivityMatrix",
+              handles.vReflectivityInfos, metallicTexture->coordinatesIndex,
+              metallicTexture->level, ambientTextureStrength);
+            _uniformBuffer->updateMatrix(handles.reflectivityMatrix,
                                          *metallicTexture->getTextureMatrix());
           }
           else if (reflectivityTexture) {
-            _uniformBuffer->updateFloat3("vReflectivityInfos",
+            _uniformBuffer->updateFloat3(handles.vReflectivityInfos,
                                          reflectivityTexture->coordinatesIndex,
-                                         reflectivityTexture->level, 1.f, "");
+                                         reflectivityTexture->level, 1.f);
             _uniformBuffer->updateMatrix(
-              "reflectivityMatrix", *reflectivityTexture->getTextureMatrix());
+              handles.reflectivityMatrix,
+              *reflectivityTexture->getTextureMatrix());
           }
 
           if (microSurfaceTexture) {
-            _uniformBuffer->updateFloat2("vMicroSurfaceSamplerInfos",
+            _uniformBuffer->updateFloat2(handles.vMicroSurfaceSamplerInfos,
                                          microSurfaceTexture->coordinatesIndex,
                                          microSurfaceTexture->level);
             _uniformBuffer->updateMatrix(
-              "microSurfaceSamplerMatrix",
+              handles.microSurfaceSamplerMatrix,
               *microSurfaceTexture->getTextureMatrix());
           }
         }
@@ -1099,9 +1189,9 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
         if (bumpTexture && _myScene->getEngine()->getCaps().standardDerivatives
             && StandardMaterial::BumpTextureEnabled() && !disableBumpMap) {
           _uniformBuffer->updateFloat3(
-            "vBumpInfos", bumpTexture->coordinatesIndex,
-            1.f / bumpTexture->level, parallaxScaleBias, "");
-          _uniformBuffer->updateMatrix("bumpMatrix",
+            handles.vBumpInfos, bumpTexture->coordinatesIndex,
+            1.f / bumpTexture->level, parallaxScaleBias);
+          _uniformBuffer->updateMatrix(handles.bumpMatrix,
                                        *bumpTexture->getTextureMatrix());
         }
 
@@ -1113,7 +1203,7 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
           float depth = 1.f;
           if (!refractionTexture->isCube) {
             _uniformBuffer->updateMatrix(
-              "refractionMatrix",
+              handles.refractionMatrix,
               *refractionTexture->getReflectionTextureMatrix());
 
             auto _refractionTexture
@@ -1123,12 +1213,12 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
             }
           }
           _uniformBuffer->updateFloat4(
-            "vRefractionInfos", refractionTexture->level, indexOfRefraction,
-            depth, invertRefractionY ? -1.f : 1.f, "");
+            handles.vRefractionInfos, refractionTexture->level,
+            indexOfRefraction, depth, invertRefractionY ? -1.f : 1.f);
         }
 
         if ((reflectionTexture || refractionTexture)) {
-          _uniformBuffer->updateFloat2("vMicrosurfaceTextureLods",
+          _uniformBuffer->updateFloat2(handles.vMicrosurfaceTextureLods,
                                        _microsurfaceTextureLods.x,
                                        _microsurfaceTextureLods.y);
         }
@@ -1136,41 +1226,42 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
 
       // Point size
       if (pointsCloud()) {
-        _uniformBuffer->updateFloat("pointSize", pointSize);
+        _uniformBuffer->updateFloat(handles.pointSize, pointSize);
       }
 
       // Colors
       if (_defines[PMD::METALLICWORKFLOW]) {
         PBRMaterial::_scaledReflectivity.r = metallic;
         PBRMaterial::_scaledReflectivity.g = roughness;
-        _uniformBuffer->updateColor4("vReflectivityColor",
-                                     PBRMaterial::_scaledReflectivity, 0, "");
+        _uniformBuffer->updateColor4(handles.vReflectivityColor,
+                                     PBRMaterial::_scaledReflectivity, 0);
       }
       else {
         // GAMMA CORRECTION.
         convertColorToLinearSpaceToRef(reflectivityColor,
                                        PBRMaterial::_scaledReflectivity);
-        _uniformBuffer->updateColor4("vReflectivityColor",
+        _uniformBuffer->updateColor4(handles.vReflectivityColor,
                                      PBRMaterial::_scaledReflectivity,
-                                     microSurface, "");
+                                     microSurface);
       }
 
       // GAMMA CORRECTION.
       convertColorToLinearSpaceToRef(emissiveColor,
                                      PBRMaterial::_scaledEmissive);
-      _uniformBuffer->updateColor3("vEmissiveColor",
-                                   PBRMaterial::_scaledEmissive, "");
+      _uniformBuffer->updateColor3(handles.vEmissiveColor,
+                                   PBRMaterial::_scaledEmissive);
 
       // GAMMA CORRECTION.
       convertColorToLinearSpaceToRef(reflectionColor,
                                      PBRMaterial::_scaledReflection);
-      _uniformBuffer->updateColor3("vReflectionColor",
-                                   PBRMaterial::_scaledReflection, "");
+      _uniformBuffer->updateColor3(handles.vReflectionColor,
+                                   PBRMaterial::_scaledReflection);
 
       // GAMMA CORRECTION.
       convertColorToLinearSpaceToRef(albedoColor, PBRMaterial::_scaledAlbedo);
-      _uniformBuffer->updateColor4("vAlbedoColor", PBRMaterial::_scaledAlbedo,
-                                   alpha * mesh->visibility, "");
+      _uniformBuffer->updateColor4(handles.vAlbedoColor,
+                                   PBRMaterial::_scaledAlbedo,
+                                   alpha * mesh->visibility);
 
       // Misc
       _lightingInfos.x = directIntensity;
@@ -1178,7 +1269,7 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
       _lightingInfos.z = environmentIntensity;
       _lightingInfos.w = specularIntensity;
 
-      _uniformBuffer->updateVector4("vLightingIntensity", _lightingInfos);
+      _uniformBuffer->updateVector4(handles.vLightingIntensity, _lightingInfos);
     }
 
     // Textures
@@ -1255,10 +1346,15 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
     // Colors
     _myScene->ambientColor.multiplyToRef(ambientColor, _globalAmbientColor);
 
-    effect->setVector3("vEyePosition", _myScene->_mirroredCameraPosition ?
-                                         *_myScene->_mirroredCameraPosition :
-                                         _myScene->activeCamera->position);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    static const auto vEyePositionHandle
+      = Effect::GetUniformHandle("vEyePosition");
+    static const auto vAmbientColorHandle
+      = Effect::GetUniformHandle("vAmbientColor");
+    effect->setVector3(vEyePositionHandle,
+                       _myScene->_mirroredCameraPosition ?
+                         *_myScene->_mirroredCameraPosition :
+                         _myScene->activeCamera->position);
+    effect->setColor3(vAmbientColorHandle, _globalAmbientColor);
   }
 
   if (_myScene->getCachedMaterial() != this || !isFrozen()) {
@@ -1287,7 +1383,9 @@ void PBRMaterial::bind(Matrix* world, Mesh* mesh)
 
     _cameraInfos.x = cameraExposure;
     _cameraInfos.y = cameraContrast;
-    effect->setVector4("vCameraInfos", _cameraInfos);
+    static const auto vCameraInfosHandle
+      = Effect::GetUniformHandle("vCameraInfos");
+    effect->setVector4(vCameraInfosHandle, _cameraInfos);
 
     if (cameraColorCurves) {
       ColorCurves::Bind(*cameraColorCurves, _effect);
@@ -47,7 +47,8 @@ bool PushMaterial::isReady(AbstractMesh* mesh, bool useInstances)
 
 void PushMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
-  _activeEffect->setMatrix("world", world);
+  static const auto worldHandle = Effect::GetUniformHandle("world");
+  _activeEffect->setMatrix(worldHandle, world);
 }
 
 void PushMaterial::bind(Matrix* world, Mesh* mesh)
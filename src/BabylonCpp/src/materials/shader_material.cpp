@@ -301,39 +301,51 @@ bool ShaderMaterial::isReady(AbstractMesh* mesh, bool useInstances)
 
 void ShaderMaterial::bindOnlyWorldMatrix(Matrix& world)
 {
+  static const auto worldHandle     = Effect::GetUniformHandle("world");
+  static const auto worldViewHandle = Effect::GetUniformHandle("worldView");
+  static const auto worldViewProjectionHandle
+    = Effect::GetUniformHandle("worldViewProjection");
+
   auto scene = getScene();
 
   if (!stl_util::contains(_options.uniforms, "world")) {
-    _effect->setMatrix("world", world);
+    _effect->setMatrix(worldHandle, world);
   }
 
   if (!stl_util::contains(_options.uniforms, "worldView")) {
     world.multiplyToRef(scene->getViewMatrix(), _cachedWorldViewMatrix);
-    _effect->setMatrix("worldView", _cachedWorldViewMatrix);
+    _effect->setMatrix(worldViewHandle, _cachedWorldViewMatrix);
   }
 
   if (!stl_util::contains(_options.uniforms, "worldViewProjection")) {
     auto transformMatrix = scene->getTransformMatrix();
-    _effect->setMatrix("worldViewProjection", world.multiply(transformMatrix));
+    _effect->setMatrix(worldViewProjectionHandle,
+                       world.multiply(transformMatrix));
   }
 }
 
 void ShaderMaterial::bind(Matrix* world, Mesh* mesh)
 {
+  static const auto viewHandle       = Effect::GetUniformHandle("view");
+  static const auto projectionHandle = Effect::GetUniformHandle("projection");
+  static const auto viewProjectionHandle
+    = Effect::GetUniformHandle("viewProjection");
+
   // Std values
   bindOnlyWorldMatrix(*world);
 
   if (getScene()->getCachedMaterial() != this) {
     if (!stl_util::contains(_options.uniforms, "view")) {
-      _effect->setMatrix("view", getScene()->getViewMatrix());
+      _effect->setMatrix(viewHandle, getScene()->getViewMatrix());
     }
 
     if (!stl_util::contains(_options.uniforms, "projection")) {
-      _effect->setMatrix("projection", getScene()->getProjectionMatrix());
+      _effect->setMatrix(projectionHandle, getScene()->getProjectionMatrix());
     }
 
     if (!stl_util::contains(_options.uniforms, "viewProjection")) {
-      _effect->setMatrix("viewProjection", getScene()->getTransformMatrix());
+      _effect->setMatrix(viewProjectionHandle,
+                         getScene()->getTransformMatrix());
     }
 
     // Bones
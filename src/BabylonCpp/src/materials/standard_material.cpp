@@ -32,6 +32,85 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Handles of the uniforms of the material uniform block, resolved once.
+ */
+struct StandardMaterialUniformHandles {
+  unsigned int diffuseLeftColor;
+  unsigned int diffuseRightColor;
+  unsigned int opacityParts;
+  unsigned int reflectionLeftColor;
+  unsigned int reflectionRightColor;
+  unsigned int refractionLeftColor;
+  unsigned int refractionRightColor;
+  unsigned int emissiveLeftColor;
+  unsigned int emissiveRightColor;
+  unsigned int vDiffuseInfos;
+  unsigned int vAmbientInfos;
+  unsigned int vOpacityInfos;
+  unsigned int vReflectionInfos;
+  unsigned int vEmissiveInfos;
+  unsigned int vLightmapInfos;
+  unsigned int vSpecularInfos;
+  unsigned int vBumpInfos;
+  unsigned int diffuseMatrix;
+  unsigned int ambientMatrix;
+  unsigned int opacityMatrix;
+  unsigned int reflectionMatrix;
+  unsigned int emissiveMatrix;
+  unsigned int lightmapMatrix;
+  unsigned int specularMatrix;
+  unsigned int bumpMatrix;
+  unsigned int refractionMatrix;
+  unsigned int vRefractionInfos;
+  unsigned int vSpecularColor;
+  unsigned int vEmissiveColor;
+  unsigned int vDiffuseColor;
+  unsigned int pointSize;
+}; // end of struct StandardMaterialUniformHandles
+
+const StandardMaterialUniformHandles& MaterialUniformHandles()
+{
+  // Same order as the uniform layout
+  static const StandardMaterialUniformHandles handles{
+    Effect::GetUniformHandle("diffuseLeftColor"),
+    Effect::GetUniformHandle("diffuseRightColor"),
+    Effect::GetUniformHandle("opacityParts"),
+    Effect::GetUniformHandle("reflectionLeftColor"),
+    Effect::GetUniformHandle("reflectionRightColor"),
+    Effect::GetUniformHandle("refractionLeftColor"),
+    Effect::GetUniformHandle("refractionRightColor"),
+    Effect::GetUniformHandle("emissiveLeftColor"),
+    Effect::GetUniformHandle("emissiveRightColor"),
+    Effect::GetUniformHandle("vDiffuseInfos"),
+    Effect::GetUniformHandle("vAmbientInfos"),
+    Effect::GetUniformHandle("vOpacityInfos"),
+    Effect::GetUniformHandle("vReflectionInfos"),
+    Effect::GetUniformHandle("vEmissiveInfos"),
+    Effect::GetUniformHandle("vLightmapInfos"),
+    Effect::GetUniformHandle("vSpecularInfos"),
+    Effect::GetUniformHandle("vBumpInfos"),
+    Effect::GetUniformHandle("diffuseMatrix"),
+    Effect::GetUniformHandle("ambientMatrix"),
+    Effect::GetUniformHandle("opacityMatrix"),
+    Effect::GetUniformHandle("reflectionMatrix"),
+    Effect::GetUniformHandle("emissiveMatrix"),
+    Effect::GetUniformHandle("lightmapMatrix"),
+    Effect::GetUniformHandle("specularMatrix"),
+    Effect::GetUniformHandle("bumpMatrix"),
+    Effect::GetUniformHandle("refractionMatrix"),
+    Effect::GetUniformHandle("vRefractionInfos"),
+    Effect::GetUniformHandle("vSpecularColor"),
+    Effect::GetUniformHandle("vEmissiveColor"),
+    Effect::GetUniformHandle("vDiffuseColor"),
+    Effect::GetUniformHandle("pointSize")};
+  return handles;
+}
+
+} // end of namespace
+
 bool StandardMaterial::_DiffuseTextureEnabled      = true;
 bool StandardMaterial::_AmbientTextureEnabled      = true;
 bool StandardMaterial::_OpacityTextureEnabled      = true;
@@ -94,12 +173,12 @@ StandardMaterial::StandardMaterial(const std::string& iName, Scene* scene)
   getRenderTargetTextures = [this]() {
     _renderTargets.clear();
 
-    if (StandardMaterial::ReflectionTextureEnabled()
+    if (StandardMaterial::ReflectionTextureEnabled() && _reflectionTexture
         && _reflectionTexture->isRenderTarget) {
       _renderTargets.emplace_back(_reflectionTexture);
     }
 
-    if (StandardMaterial::RefractionTextureEnabled()
+    if (StandardMaterial::RefractionTextureEnabled() && _refractionTexture
         && _refractionTexture->isRenderTarget) {
       _renderTargets.emplace_back(_refractionTexture);
     }
@@ -259,7 +338,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
   }
 
   auto scene = getScene();
-  auto defines
+  auto& defines
     = *(static_cast<StandardMaterialDefines*>(subMesh->_materialDefines.get()));
   if (!checkReadyOnEveryCall && subMesh->effect()) {
     if (defines._renderId == scene->getRenderId()) {
@@ -563,183 +642,200 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     defines.markAsProcessed();
     scene->resetCachedMaterial();
 
-    // Fallbacks
-    auto fallbacks = std::make_unique<EffectFallbacks>();
-    if (defines[SMD::REFLECTION]) {
-      fallbacks->addFallback(0, "REFLECTION");
+    // Effect already compiled with the same defines, found without building
+    // the defines string
+    Effect* effect         = nullptr;
+    const auto definesHash = MaterialHelper::EffectDefinesHash(
+      "default", defines, _maxSimultaneousLights);
+    if (!customShaderNameResolve) {
+      effect = engine->getEffectByDefinesHash(definesHash, "default", defines,
+                                              _maxSimultaneousLights);
     }
 
-    if (defines[SMD::SPECULAR]) {
-      fallbacks->addFallback(0, "SPECULAR");
-    }
+    if (!effect) {
+      // Fallbacks
+      auto fallbacks = std::make_unique<EffectFallbacks>();
+      if (defines[SMD::REFLECTION]) {
+        fallbacks->addFallback(0, "REFLECTION");
+      }
 
-    if (defines[SMD::BUMP]) {
-      fallbacks->addFallback(0, "BUMP");
-    }
+      if (defines[SMD::SPECULAR]) {
+        fallbacks->addFallback(0, "SPECULAR");
+      }
 
-    if (defines[SMD::PARALLAX]) {
-      fallbacks->addFallback(1, "PARALLAX");
-    }
+      if (defines[SMD::BUMP]) {
+        fallbacks->addFallback(0, "BUMP");
+      }
 
-    if (defines[SMD::PARALLAXOCCLUSION]) {
-      fallbacks->addFallback(0, "PARALLAXOCCLUSION");
-    }
+      if (defines[SMD::PARALLAX]) {
+        fallbacks->addFallback(1, "PARALLAX");
+      }
 
-    if (defines[SMD::SPECULAROVERALPHA]) {
-      fallbacks->addFallback(0, "SPECULAROVERALPHA");
-    }
+      if (defines[SMD::PARALLAXOCCLUSION]) {
+        fallbacks->addFallback(0, "PARALLAXOCCLUSION");
+      }
 
-    if (defines[SMD::FOG]) {
-      fallbacks->addFallback(1, "FOG");
-    }
+      if (defines[SMD::SPECULAROVERALPHA]) {
+        fallbacks->addFallback(0, "SPECULAROVERALPHA");
+      }
 
-    if (defines[SMD::POINTSIZE]) {
-      fallbacks->addFallback(0, "POINTSIZE");
-    }
+      if (defines[SMD::FOG]) {
+        fallbacks->addFallback(1, "FOG");
+      }
 
-    if (defines[SMD::LOGARITHMICDEPTH]) {
-      fallbacks->addFallback(0, "LOGARITHMICDEPTH");
-    }
+      if (defines[SMD::POINTSIZE]) {
+        fallbacks->addFallback(0, "POINTSIZE");
+      }
 
-    MaterialHelper::HandleFallbacksForShadows(defines, *fallbacks,
-                                              _maxSimultaneousLights);
+      if (defines[SMD::LOGARITHMICDEPTH]) {
+        fallbacks->addFallback(0, "LOGARITHMICDEPTH");
+      }
 
-    if (defines[SMD::SPECULARTERM]) {
-      fallbacks->addFallback(0, "SPECULARTERM");
-    }
+      MaterialHelper::HandleFallbacksForShadows(defines, *fallbacks,
+                                                _maxSimultaneousLights);
 
-    if (defines[SMD::DIFFUSEFRESNEL]) {
-      fallbacks->addFallback(1, "DIFFUSEFRESNEL");
-    }
+      if (defines[SMD::SPECULARTERM]) {
+        fallbacks->addFallback(0, "SPECULARTERM");
+      }
 
-    if (defines[SMD::OPACITYFRESNEL]) {
-      fallbacks->addFallback(2, "OPACITYFRESNEL");
-    }
+      if (defines[SMD::DIFFUSEFRESNEL]) {
+        fallbacks->addFallback(1, "DIFFUSEFRESNEL");
+      }
 
-    if (defines[SMD::REFLECTIONFRESNEL]) {
-      fallbacks->addFallback(3, "REFLECTIONFRESNEL");
-    }
+      if (defines[SMD::OPACITYFRESNEL]) {
+        fallbacks->addFallback(2, "OPACITYFRESNEL");
+      }
 
-    if (defines[SMD::EMISSIVEFRESNEL]) {
-      fallbacks->addFallback(4, "EMISSIVEFRESNEL");
-    }
+      if (defines[SMD::REFLECTIONFRESNEL]) {
+        fallbacks->addFallback(3, "REFLECTIONFRESNEL");
+      }
 
-    if (defines[SMD::FRESNEL]) {
-      fallbacks->addFallback(4, "FRESNEL");
-    }
+      if (defines[SMD::EMISSIVEFRESNEL]) {
+        fallbacks->addFallback(4, "EMISSIVEFRESNEL");
+      }
 
-    // Attributes
-    std::vector<std::string> attribs{VertexBuffer::PositionKindChars};
+      if (defines[SMD::FRESNEL]) {
+        fallbacks->addFallback(4, "FRESNEL");
+      }
 
-    if (defines[SMD::NORMAL]) {
-      attribs.emplace_back(VertexBuffer::NormalKindChars);
-    }
+      // Attributes
+      std::vector<std::string> attribs{VertexBuffer::PositionKindChars};
 
-    if (defines[SMD::UV1]) {
-      attribs.emplace_back(VertexBuffer::UVKindChars);
-    }
+      if (defines[SMD::NORMAL]) {
+        attribs.emplace_back(VertexBuffer::NormalKindChars);
+      }
 
-    if (defines[SMD::UV2]) {
-      attribs.emplace_back(VertexBuffer::UV2KindChars);
-    }
+      if (defines[SMD::UV1]) {
+        attribs.emplace_back(VertexBuffer::UVKindChars);
+      }
 
-    if (defines[SMD::VERTEXCOLOR]) {
-      attribs.emplace_back(VertexBuffer::ColorKindChars);
-    }
+      if (defines[SMD::UV2]) {
+        attribs.emplace_back(VertexBuffer::UV2KindChars);
+      }
 
-    MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines,
-                                              *fallbacks);
-    MaterialHelper::PrepareAttributesForInstances(attribs, defines,
-                                                  SMD::INSTANCES);
-    MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines,
-                                                     SMD::NORMAL);
-
-    std::string shaderName{"default"};
-    const auto join = defines.toString();
-    std::vector<std::string> uniforms{"world",
-                                      "view",
-                                      "viewProjection",
-                                      "vEyePosition",
-                                      "vLightsType",
-                                      "vAmbientColor",
-                                      "vDiffuseColor",
-                                      "vSpecularColor",
-                                      "vEmissiveColor",
-                                      "vFogInfos",
-                                      "vFogColor",
-                                      "pointSize",
-                                      "vDiffuseInfos",
-                                      "vAmbientInfos",
-                                      "vOpacityInfos",
-                                      "vReflectionInfos",
-                                      "vEmissiveInfos",
-                                      "vSpecularInfos",
-                                      "vBumpInfos",
-                                      "vLightmapInfos",
-                                      "vRefractionInfos",
-                                      "mBones",
-                                      "vClipPlane",
-                                      "diffuseMatrix",
-                                      "ambientMatrix",
-                                      "opacityMatrix",
-                                      "reflectionMatrix",
-                                      "emissiveMatrix",
-                                      "specularMatrix",
-                                      "bumpMatrix",
-                                      "lightmapMatrix",
-                                      "refractionMatrix",
-                                      "depthValues",
-                                      "diffuseLeftColor",
-                                      "diffuseRightColor",
-                                      "opacityParts",
-                                      "reflectionLeftColor",
-                                      "reflectionRightColor",
-                                      "emissiveLeftColor",
-                                      "emissiveRightColor",
-                                      "refractionLeftColor",
-                                      "refractionRightColor",
-                                      "logarithmicDepthConstant"};
-
-    std::vector<std::string> samplers{
-      "diffuseSampler",        "ambientSampler",      "opacitySampler",
-      "reflectionCubeSampler", "reflection2DSampler", "emissiveSampler",
-      "specularSampler",       "bumpSampler",         "lightmapSampler",
-      "refractionCubeSampler", "refraction2DSampler"};
-    std::vector<std::string> uniformBuffers{"Material", "Scene"};
-
-    if (defines[SMD::CAMERACOLORCURVES]) {
-      ColorCurves::PrepareUniforms(uniforms);
-    }
-    if (defines[SMD::CAMERACOLORGRADING]) {
-      ColorGradingTexture::PrepareUniformsAndSamplers(uniforms, samplers);
-    }
+      if (defines[SMD::VERTEXCOLOR]) {
+        attribs.emplace_back(VertexBuffer::ColorKindChars);
+      }
 
-    std::unordered_map<std::string, unsigned int> indexParameters{
-      {"maxSimultaneousLights", _maxSimultaneousLights},
-      {"maxSimultaneousMorphTargets", defines.NUM_MORPH_INFLUENCERS}};
-
-    EffectCreationOptions options;
-    options.attributes            = std::move(attribs);
-    options.uniformsNames         = std::move(uniforms);
-    options.uniformBuffersNames   = std::move(uniformBuffers);
-    options.samplers              = std::move(samplers);
-    options.materialDefines       = &defines;
-    options.defines               = std::move(join);
-    options.fallbacks             = std::move(fallbacks);
-    options.onCompiled            = onCompiled;
-    options.onError               = onError;
-    options.indexParameters       = std::move(indexParameters);
-    options.maxSimultaneousLights = _maxSimultaneousLights;
-
-    MaterialHelper::PrepareUniformsAndSamplersList(options);
-
-    if (customShaderNameResolve) {
-      shaderName = customShaderNameResolve(shaderName, uniforms, uniformBuffers,
-                                           samplers, defines);
+      MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines,
+                                                *fallbacks);
+      MaterialHelper::PrepareAttributesForInstances(attribs, defines,
+                                                    SMD::INSTANCES);
+      MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines,
+                                                       SMD::NORMAL);
+
+      std::string shaderName{"default"};
+      const auto join = defines.toString();
+      std::vector<std::string> uniforms{"world",
+                                        "view",
+                                        "viewProjection",
+                                        "vEyePosition",
+                                        "vLightsType",
+                                        "vAmbientColor",
+                                        "vDiffuseColor",
+                                        "vSpecularColor",
+                                        "vEmissiveColor",
+                                        "vFogInfos",
+                                        "vFogColor",
+                                        "pointSize",
+                                        "vDiffuseInfos",
+                                        "vAmbientInfos",
+                                        "vOpacityInfos",
+                                        "vReflectionInfos",
+                                        "vEmissiveInfos",
+                                        "vSpecularInfos",
+                                        "vBumpInfos",
+                                        "vLightmapInfos",
+                                        "vRefractionInfos",
+                                        "mBones",
+                                        "vClipPlane",
+                                        "diffuseMatrix",
+                                        "ambientMatrix",
+                                        "opacityMatrix",
+                                        "reflectionMatrix",
+                                        "emissiveMatrix",
+                                        "specularMatrix",
+                                        "bumpMatrix",
+                                        "lightmapMatrix",
+                                        "refractionMatrix",
+                                        "depthValues",
+                                        "diffuseLeftColor",
+                                        "diffuseRightColor",
+                                        "opacityParts",
+                                        "reflectionLeftColor",
+                                        "reflectionRightColor",
+                                        "emissiveLeftColor",
+                                        "emissiveRightColor",
+                                        "refractionLeftColor",
+                                        "refractionRightColor",
+                                        "logarithmicDepthConstant"};
+
+      std::vector<std::string> samplers{
+        "diffuseSampler",        "ambientSampler",      "opacitySampler",
+        "reflectionCubeSampler", "reflection2DSampler", "emissiveSampler",
+        "specularSampler",       "bumpSampler",         "lightmapSampler",
+        "refractionCubeSampler", "refraction2DSampler"};
+      std::vector<std::string> uniformBuffers{"Material", "Scene"};
+
+      if (defines[SMD::CAMERACOLORCURVES]) {
+        ColorCurves::PrepareUniforms(uniforms);
+      }
+      if (defines[SMD::CAMERACOLORGRADING]) {
+        ColorGradingTexture::PrepareUniformsAndSamplers(uniforms, samplers);
+      }
+
+      std::unordered_map<std::string, unsigned int> indexParameters{
+        {"maxSimultaneousLights", _maxSimultaneousLights},
+        {"maxSimultaneousMorphTargets", defines.NUM_MORPH_INFLUENCERS}};
+
+      EffectCreationOptions options;
+      options.attributes            = std::move(attribs);
+      options.uniformsNames         = std::move(uniforms);
+      options.uniformBuffersNames   = std::move(uniformBuffers);
+      options.samplers              = std::move(samplers);
+      options.materialDefines       = &defines;
+      options.defines               = std::move(join);
+      options.fallbacks             = std::move(fallbacks);
+      options.onCompiled            = onCompiled;
+      options.onError               = onError;
+      options.indexParameters       = std::move(indexParameters);
+      options.maxSimultaneousLights = _maxSimultaneousLights;
+
+      MaterialHelper::PrepareUniformsAndSamplersList(options);
+
+      if (customShaderNameResolve) {
+        shaderName = customShaderNameResolve(shaderName, uniforms,
+                                             uniformBuffers, samplers, defines);
+      }
+
+      effect = engine->createEffect(shaderName, options, engine);
+      if (!customShaderNameResolve) {
+        engine->registerEffectDefinesHash(definesHash, "default", defines,
+                                          _maxSimultaneousLights, effect);
+      }
     }
 
-    subMesh->setEffect(
-      scene->getEngine()->createEffect(shaderName, options, engine), defines);
+    subMesh->setEffect(effect, defines);
 
     buildUniformLayout();
   }
@@ -819,7 +915,7 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
   if (!definesTmp) {
     return;
   }
-  auto defines = *definesTmp;
+  auto& defines = *definesTmp;
 
   auto effect   = subMesh->effect();
   _activeEffect = effect;
@@ -834,125 +930,127 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
 
     bindViewProjection(effect);
     if (!_uniformBuffer->useUbo() || !isFrozen() || !_uniformBuffer->isSync()) {
+      const auto& handles = MaterialUniformHandles();
 
       if (StandardMaterial::FresnelEnabled() && defines[SMD::FRESNEL]) {
         // Fresnel
         if (_diffuseFresnelParameters
             && _diffuseFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("diffuseLeftColor",
+          _uniformBuffer->updateColor4(handles.diffuseLeftColor,
                                        _diffuseFresnelParameters->leftColor,
-                                       _diffuseFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("diffuseRightColor",
+                                       _diffuseFresnelParameters->power);
+          _uniformBuffer->updateColor4(handles.diffuseRightColor,
                                        _diffuseFresnelParameters->rightColor,
-                                       _diffuseFresnelParameters->bias, "");
+                                       _diffuseFresnelParameters->bias);
         }
 
         if (_opacityFresnelParameters
             && _opacityFresnelParameters->isEnabled()) {
           _uniformBuffer->updateColor4(
-            "opacityParts",
+            handles.opacityParts,
             Color3(_opacityFresnelParameters->leftColor.toLuminance(),
                    _opacityFresnelParameters->rightColor.toLuminance(),
                    _opacityFresnelParameters->bias),
-            _opacityFresnelParameters->power, "");
+            _opacityFresnelParameters->power);
         }
 
         if (_reflectionFresnelParameters
             && _reflectionFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("reflectionLeftColor",
+          _uniformBuffer->updateColor4(handles.reflectionLeftColor,
                                        _reflectionFresnelParameters->leftColor,
-                                       _reflectionFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("reflectionRightColor",
+                                       _reflectionFresnelParameters->power);
+          _uniformBuffer->updateColor4(handles.reflectionRightColor,
                                        _reflectionFresnelParameters->rightColor,
-                                       _reflectionFresnelParameters->bias, "");
+                                       _reflectionFresnelParameters->bias);
         }
 
         if (_refractionFresnelParameters
             && _refractionFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("refractionLeftColor",
+          _uniformBuffer->updateColor4(handles.refractionLeftColor,
                                        _refractionFresnelParameters->leftColor,
-                                       _refractionFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("refractionRightColor",
+                                       _refractionFresnelParameters->power);
+          _uniformBuffer->updateColor4(handles.refractionRightColor,
                                        _refractionFresnelParameters->rightColor,
-                                       _refractionFresnelParameters->bias, "");
+                                       _refractionFresnelParameters->bias);
         }
 
         if (_emissiveFresnelParameters
             && _emissiveFresnelParameters->isEnabled()) {
-          _uniformBuffer->updateColor4("emissiveLeftColor",
+          _uniformBuffer->updateColor4(handles.emissiveLeftColor,
                                        _emissiveFresnelParameters->leftColor,
-                                       _emissiveFresnelParameters->power, "");
-          _uniformBuffer->updateColor4("emissiveRightColor",
+                                       _emissiveFresnelParameters->power);
+          _uniformBuffer->updateColor4(handles.emissiveRightColor,
                                        _emissiveFresnelParameters->rightColor,
-                                       _emissiveFresnelParameters->bias, "");
+                                       _emissiveFresnelParameters->bias);
         }
       }
 
       // Textures
       if (scene->texturesEnabled()) {
         if (_diffuseTexture && StandardMaterial::DiffuseTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vDiffuseInfos",
+          _uniformBuffer->updateFloat2(handles.vDiffuseInfos,
                                        _diffuseTexture->coordinatesIndex,
                                        _diffuseTexture->level);
-          _uniformBuffer->updateMatrix("diffuseMatrix",
+          _uniformBuffer->updateMatrix(handles.diffuseMatrix,
                                        *_diffuseTexture->getTextureMatrix());
         }
 
         if (_ambientTexture && StandardMaterial::AmbientTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vAmbientInfos",
+          _uniformBuffer->updateFloat2(handles.vAmbientInfos,
                                        _ambientTexture->coordinatesIndex,
                                        _ambientTexture->level);
-          _uniformBuffer->updateMatrix("ambientMatrix",
+          _uniformBuffer->updateMatrix(handles.ambientMatrix,
                                        *_ambientTexture->getTextureMatrix());
         }
 
         if (_opacityTexture && StandardMaterial::OpacityTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vOpacityInfos",
+          _uniformBuffer->updateFloat2(handles.vOpacityInfos,
                                        _opacityTexture->coordinatesIndex,
                                        _opacityTexture->level);
-          _uniformBuffer->updateMatrix("opacityMatrix",
+          _uniformBuffer->updateMatrix(handles.opacityMatrix,
                                        *_opacityTexture->getTextureMatrix());
         }
 
         if (_reflectionTexture
             && StandardMaterial::ReflectionTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vReflectionInfos",
+          _uniformBuffer->updateFloat2(handles.vReflectionInfos,
                                        _reflectionTexture->level, _roughness);
           _uniformBuffer->updateMatrix(
-            "reflectionMatrix",
+            handles.reflectionMatrix,
             *_reflectionTexture->getReflectionTextureMatrix());
         }
 
         if (_emissiveTexture && StandardMaterial::EmissiveTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vEmissiveInfos",
+          _uniformBuffer->updateFloat2(handles.vEmissiveInfos,
                                        _emissiveTexture->coordinatesIndex,
                                        _emissiveTexture->level);
-          _uniformBuffer->updateMatrix("emissiveMatrix",
+          _uniformBuffer->updateMatrix(handles.emissiveMatrix,
                                        *_emissiveTexture->getTextureMatrix());
         }
 
         if (_lightmapTexture && StandardMaterial::LightmapTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vLightmapInfos",
+          _uniformBuffer->updateFloat2(handles.vLightmapInfos,
                                        _lightmapTexture->coordinatesIndex,
                                        _lightmapTexture->level);
-          _uniformBuffer->updateMatrix("lightmapMatrix",
+          _uniformBuffer->updateMatrix(handles.lightmapMatrix,
                                        *_lightmapTexture->getTextureMatrix());
         }
 
         if (_specularTexture && StandardMaterial::SpecularTextureEnabled()) {
-          _uniformBuffer->updateFloat2("vSpecularInfos",
+          _uniformBuffer->updateFloat2(handles.vSpecularInfos,
                                        _specularTexture->coordinatesIndex,
                                        _specularTexture->level);
-          _uniformBuffer->updateMatrix("specularMatrix",
+          _uniformBuffer->updateMatrix(handles.specularMatrix,
                                        *_specularTexture->getTextureMatrix());
         }
 
         if (_bumpTexture && scene->getEngine()->getCaps().standardDerivatives
             && StandardMaterial::BumpTextureEnabled()) {
           _uniformBuffer->updateFloat3(
-            "vBumpInfos", static_cast<float>(_bumpTexture->coordinatesIndex),
-            1.f / _bumpTexture->level, parallaxScaleBias, "");
-          _uniformBuffer->updateMatrix("bumpMatrix",
+            handles.vBumpInfos,
+            static_cast<float>(_bumpTexture->coordinatesIndex),
+            1.f / _bumpTexture->level, parallaxScaleBias);
+          _uniformBuffer->updateMatrix(handles.bumpMatrix,
                                        *_bumpTexture->getTextureMatrix());
         }
 
@@ -961,7 +1059,7 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
           float depth = 1.f;
           if (!_refractionTexture->isCube) {
             _uniformBuffer->updateMatrix(
-              "refractionMatrix",
+              handles.refractionMatrix,
               *_refractionTexture->getReflectionTextureMatrix());
             auto refractionTextureTmp
               = static_cast<RefractionTexture*>(_refractionTexture);
@@ -970,24 +1068,24 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
             }
           }
           _uniformBuffer->updateFloat4(
-            "vRefractionInfos", _refractionTexture->level, indexOfRefraction,
-            depth, invertRefractionY ? -1.f : 1.f, "");
+            handles.vRefractionInfos, _refractionTexture->level,
+            indexOfRefraction, depth, invertRefractionY ? -1.f : 1.f);
         }
       }
 
       // Point size
       if (pointsCloud()) {
-        _uniformBuffer->updateFloat("pointSize", pointSize);
+        _uniformBuffer->updateFloat(handles.pointSize, pointSize);
       }
 
       if (defines.SPECULARTERM) {
-        _uniformBuffer->updateColor4("vSpecularColor", specularColor,
-                                     specularPower, "");
+        _uniformBuffer->updateColor4(handles.vSpecularColor, specularColor,
+                                     specularPower);
       }
-      _uniformBuffer->updateColor3("vEmissiveColor", emissiveColor, "");
+      _uniformBuffer->updateColor3(handles.vEmissiveColor, emissiveColor);
       // Diffuse
-      _uniformBuffer->updateColor4("vDiffuseColor", diffuseColor,
-                                   alpha * mesh->visibility, "");
+      _uniformBuffer->updateColor4(handles.vDiffuseColor, diffuseColor,
+                                   alpha * mesh->visibility);
     }
 
     // Textures
@@ -1051,10 +1149,14 @@ void StandardMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
     // Colors
     scene->ambientColor.multiplyToRef(ambientColor, _globalAmbientColor);
 
-    effect->setVector3("vEyePosition", scene->_mirroredCameraPosition ?
-                                         *scene->_mirroredCameraPosition :
-                                         scene->activeCamera->position);
-    effect->setColor3("vAmbientColor", _globalAmbientColor);
+    static const auto vEyePositionHandle
+      = Effect::GetUniformHandle("vEyePosition");
+    static const auto vAmbientColorHandle
+      = Effect::GetUniformHandle("vAmbientColor");
+    effect->setVector3(vEyePositionHandle, scene->_mirroredCameraPosition ?
+                                             *scene->_mirroredCameraPosition :
+                                             scene->activeCamera->position);
+    effect->setColor3(vAmbientColorHandle, _globalAmbientColor);
   }
 
   if (_mustRebind(scene, effect) || !isFrozen()) {
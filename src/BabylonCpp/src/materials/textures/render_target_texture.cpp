@@ -10,6 +10,7 @@
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/particles/particle_system.h>
 #include <babylon/postprocess/post_process_manager.h>
+#include <babylon/rendering/render_target_scheduler.h>
 #include <babylon/rendering/rendering_manager.h>
 #include <babylon/tools/tools.h>
 
@@ -22,6 +23,9 @@ RenderTargetTexture::RenderTargetTexture(
   bool generateStencilBuffer, bool isMulti)
 
     : Texture{"", scene, !generateMipMaps}
+    , facesPerRender{6}
+    , renderPriority{1.f}
+    , screenContributionMesh{nullptr}
     , renderParticles{true}
     , renderSprites{false}
     , coordinatesMode{TextureConstants::PROJECTION_MODE}
@@ -31,6 +35,9 @@ RenderTargetTexture::RenderTargetTexture(
     , _currentRefreshId{-1}
     , _refreshRate{1}
     , _samples{1}
+    , _faceIndex{0}
+    , _nextFaceIndex{0}
+    , _lastFaceIndex{5}
 {
   name           = iName;
   isRenderTarget = true;
@@ -149,6 +156,11 @@ void RenderTargetTexture::setRefreshRate(int value)
 
 bool RenderTargetTexture::_shouldRender()
 {
+  // Completes the time sliced update of the cube in progress
+  if (isCube && _nextFaceIndex != 0) {
+    return true;
+  }
+
   if (_currentRefreshId == -1) { // At least render once
     _currentRefreshId = 1;
     return true;
@@ -211,6 +223,17 @@ void RenderTargetTexture::resize(const ISize& size)
   }
 }
 
+unsigned int RenderTargetTexture::facesToRender() const
+{
+  if (!isCube) {
+    return 1;
+  }
+
+  // A slice never wraps around, the mip maps are generated with the last face
+  const unsigned int faceCount = std::max(1u, std::min(facesPerRender, 6u));
+  return std::min(faceCount, 6 - _nextFaceIndex);
+}
+
 void RenderTargetTexture::render(bool useCameraPostProcess, bool dumpForDebug)
 {
   auto scene  = getScene();
@@ -295,12 +318,16 @@ void RenderTargetTexture::render(bool useCameraPostProcess, bool dumpForDebug)
   }
 
   if (isCube) {
-    for (unsigned int face = 0; face < 6; ++face) {
+    const unsigned int firstFace = _nextFaceIndex;
+    _lastFaceIndex               = firstFace + facesToRender() - 1;
+    for (unsigned int face = firstFace; face <= _lastFaceIndex; ++face) {
       renderToTarget(face, currentRenderList, currentRenderListLength,
                      useCameraPostProcess, dumpForDebug);
       scene->incrementRenderId();
       scene->resetCachedMaterial();
     }
+    _nextFaceIndex = (_lastFaceIndex + 1) % 6;
+    _lastFaceIndex = 5;
   }
   else {
     renderToTarget(0, currentRenderList, currentRenderListLength,
@@ -373,7 +400,7 @@ void RenderTargetTexture::renderToTarget(
   }
 
   // Unbind
-  if (!isCube || faceIndex == 5) {
+  if (!isCube || faceIndex == 5 || faceIndex == _lastFaceIndex) {
     if (isCube) {
       if (faceIndex == 5) {
         engine->generateMipMapsForCubemap(_texture);
@@ -423,6 +450,8 @@ std::unique_ptr<RenderTargetTexture> RenderTargetTexture::clone() const
   // RenderTarget Texture
   newTexture->coordinatesMode = coordinatesMode;
   newTexture->renderList      = renderList;
+  newTexture->facesPerRender  = facesPerRender;
+  newTexture->renderPriority  = renderPriority;
 
   return newTexture;
 }
@@ -434,6 +463,10 @@ Json::object RenderTargetTexture::serialize() const
 
 void RenderTargetTexture::dispose(bool doNotRecurse)
 {
+  if (auto scheduler = getScene()->renderTargetScheduler()) {
+    scheduler->removeRenderTarget(this);
+  }
+
   Texture::dispose(doNotRecurse);
 }
 
@@ -9,99 +9,23 @@
 
 namespace BABYLON {
 
-Float32Array UniformBuffer::_tempBuffer{};
+size_t UniformBuffer::DynamicBufferCount = 3;
 
 UniformBuffer::UniformBuffer(Engine* engine, const Float32Array& data,
                              bool dynamic)
     : _engine{engine}
+    , _buffer{nullptr}
+    , _bufferIndex{0}
+    , _bufferFrameId{0}
     , _data{data}
     , _dynamic{dynamic}
     , _uniformLocationPointer{0}
     , _needSync{false}
+    , _dirtyStart{0}
+    , _dirtyEnd{0}
     , _noUBO{engine->webGLVersion() == 1.f}
+    , _currentEffect{nullptr}
 {
-  if (_noUBO) {
-    updateMatrix3x3
-      = [this](const std::string& name, const Float32Array& matrix) {
-          _updateMatrix3x3ForEffect(name, matrix);
-        };
-    updateMatrix2x2
-      = [this](const std::string& name, const Float32Array& matrix) {
-          _updateMatrix2x2ForEffect(name, matrix);
-        };
-    updateFloat = [this](const std::string& name, float x) {
-      _updateFloatForEffect(name, x);
-    };
-    updateFloat2 = [this](const std::string& name, float x, float y) {
-      _updateFloat2ForEffect(name, x, y);
-    };
-    updateFloat3 = [this](const std::string& name, float x, float y, float z,
-                          const std::string& suffix = "") {
-      _updateFloat3ForEffect(name, x, y, z, suffix);
-    };
-    updateFloat4 = [this](const std::string& name, float x, float y, float z,
-                          float w, const std::string& suffix = "") {
-      _updateFloat4ForEffect(name, x, y, z, w, suffix);
-    };
-    updateMatrix = [this](const std::string& name, const Matrix& mat) {
-      _updateMatrixForEffect(name, mat);
-    };
-    updateVector3 = [this](const std::string& name, const Vector3& vector) {
-      _updateVector3ForEffect(name, vector);
-    };
-    updateVector4 = [this](const std::string& name, const Vector4& vector) {
-      _updateVector4ForEffect(name, vector);
-    };
-    updateColor3 = [this](const std::string& name, const Color3& color,
-                          const std::string& suffix = "") {
-      _updateColor3ForEffect(name, color, suffix);
-    };
-    updateColor4 = [this](const std::string& name, const Color3& color,
-                          float alpha, const std::string& suffix = "") {
-      _updateColor4ForEffect(name, color, alpha, suffix);
-    };
-  }
-  else {
-    updateMatrix3x3
-      = [this](const std::string& name, const Float32Array& matrix) {
-          _updateMatrix3x3ForUniform(name, matrix);
-        };
-    updateMatrix2x2
-      = [this](const std::string& name, const Float32Array& matrix) {
-          _updateMatrix2x2ForUniform(name, matrix);
-        };
-    updateFloat = [this](const std::string& name, float x) {
-      _updateFloatForUniform(name, x);
-    };
-    updateFloat2 = [this](const std::string& name, float x, float y) {
-      _updateFloat2ForUniform(name, x, y);
-    };
-    updateFloat3 = [this](const std::string& name, float x, float y, float z,
-                          const std::string& suffix = "") {
-      _updateFloat3ForUniform(name, x, y, z, suffix);
-    };
-    updateFloat4 = [this](const std::string& name, float x, float y, float z,
-                          float w, const std::string& suffix = "") {
-      _updateFloat4ForUniform(name, x, y, z, w, suffix);
-    };
-    updateMatrix = [this](const std::string& name, const Matrix& mat) {
-      _updateMatrixForUniform(name, mat);
-    };
-    updateVector3 = [this](const std::string& name, const Vector3& vector) {
-      _updateVector3ForUniform(name, vector);
-    };
-    updateVector4 = [this](const std::string& name, const Vector4& vector) {
-      _updateVector4ForUniform(name, vector);
-    };
-    updateColor3 = [this](const std::string& name, const Color3& color,
-                          const std::string& suffix = "") {
-      _updateColor3ForUniform(name, color, suffix);
-    };
-    updateColor4 = [this](const std::string& name, const Color3& color,
-                          float alpha, const std::string& suffix = "") {
-      _updateColor4ForUniform(name, color, alpha, suffix);
-    };
-  }
 }
 
 UniformBuffer::~UniformBuffer()
@@ -130,7 +54,7 @@ Float32Array& UniformBuffer::getData()
 
 GL::IGLBuffer* UniformBuffer::getBuffer()
 {
-  return _buffer.get();
+  return _buffer;
 }
 
 void UniformBuffer::_fillAlignment(size_t size)
@@ -176,6 +100,7 @@ void UniformBuffer::addUniform(const std::string& name, size_t size)
   _fillAlignment(size);
   _uniformSizes[name]     = size;
   _uniformLocations[name] = _uniformLocationPointer;
+  _setUniformOffset(name, _uniformLocationPointer);
   _uniformLocationPointer += size;
 
   for (size_t i = 0; i < size; ++i) {
@@ -205,6 +130,7 @@ void UniformBuffer::addUniform(const std::string& name,
   _fillAlignment(_size);
   _uniformSizes[name]     = _size;
   _uniformLocations[name] = _uniformLocationPointer;
+  _setUniformOffset(name, _uniformLocationPointer);
   _uniformLocationPointer += _size;
 
   for (size_t i = 0; i < _size; ++i) {
@@ -214,6 +140,15 @@ void UniformBuffer::addUniform(const std::string& name,
   _needSync = true;
 }
 
+void UniformBuffer::_setUniformOffset(const std::string& name, size_t offset)
+{
+  const auto uniformHandle = Effect::GetUniformHandle(name);
+  if (uniformHandle >= _uniformOffsets.size()) {
+    _uniformOffsets.resize(uniformHandle + 1, -1);
+  }
+  _uniformOffsets[uniformHandle] = static_cast<int>(offset);
+}
+
 void UniformBuffer::addMatrix(const std::string& name, const Matrix& mat)
 {
   addUniform(name, mat.toArray());
@@ -277,13 +212,21 @@ void UniformBuffer::create()
   _bufferData = Float32Array(_data);
 
   if (_dynamic) {
-    _buffer = _engine->createDynamicUniformBuffer(_bufferData);
+    const auto bufferCount = std::max(DynamicBufferCount, size_t(1));
+    for (size_t i = 0; i < bufferCount; ++i) {
+      _buffers.emplace_back(_engine->createDynamicUniformBuffer(_bufferData));
+    }
   }
   else {
-    _buffer = _engine->createUniformBuffer(_bufferData);
+    _buffers.emplace_back(_engine->createUniformBuffer(_bufferData));
   }
 
-  _needSync = true;
+  _bufferIndex   = 0;
+  _bufferFrameId = _engine->getFrameId();
+  _buffer        = _buffers[_bufferIndex].get();
+  _dirtyStart    = 0;
+  _dirtyEnd      = 0;
+  _needSync      = true;
 }
 
 void UniformBuffer::update()
@@ -293,20 +236,59 @@ void UniformBuffer::update()
     return;
   }
 
-  if (!_dynamic && !_needSync) {
-    return;
+  if (_dynamic) {
+    // Upload into the next buffer of the ring once per frame, the buffers of
+    // the previous frames may still be in use by the GPU
+    const auto frameId = _engine->getFrameId();
+    if (frameId != _bufferFrameId) {
+      _bufferFrameId = frameId;
+      _bufferIndex   = (_bufferIndex + 1) % _buffers.size();
+      _buffer        = _buffers[_bufferIndex].get();
+    }
+    _engine->updateUniformBuffer(_buffer, _bufferData);
   }
+  else {
+    if (!_needSync) {
+      return;
+    }
 
-  _engine->updateUniformBuffer(_buffer.get(), _bufferData);
+    if (_dirtyEnd > _dirtyStart) {
+      _engine->updateUniformBuffer(_buffer, _bufferData,
+                                   static_cast<int>(_dirtyStart),
+                                   static_cast<int>(_dirtyEnd - _dirtyStart));
+    }
+  }
 
-  _needSync = false;
+  _dirtyStart = 0;
+  _dirtyEnd   = 0;
+  _needSync   = false;
 }
 
 void UniformBuffer::updateUniform(const std::string& uniformName,
                                   const Float32Array& data, size_t size)
 {
-  size_t location = _uniformLocations[uniformName];
-  if (!stl_util::contains(_uniformLocations, uniformName)) {
+  _updateUniform(uniformName, data.data(), size);
+}
+
+int UniformBuffer::getUniformOffset(const std::string& uniformName) const
+{
+  auto it = _uniformLocations.find(uniformName);
+  return (it != _uniformLocations.end()) ? static_cast<int>(it->second) : -1;
+}
+
+int UniformBuffer::getUniformOffset(unsigned int uniformHandle) const
+{
+  return (uniformHandle < _uniformOffsets.size()) ?
+           _uniformOffsets[uniformHandle] :
+           -1;
+}
+
+void UniformBuffer::_updateUniform(const std::string& uniformName,
+                                   const float* data, size_t size)
+{
+  size_t location = 0;
+  auto it         = _uniformLocations.find(uniformName);
+  if (it == _uniformLocations.end()) {
     if (_buffer) {
       // Cannot add an uniform if the buffer is already created
       BABYLON_LOG_ERROR("UniformBuffer",
@@ -316,198 +298,428 @@ void UniformBuffer::updateUniform(const std::string& uniformName,
     addUniform(uniformName, size);
     location = _uniformLocations[uniformName];
   }
+  else {
+    location = it->second;
+  }
 
   if (!_buffer) {
     create();
   }
 
-  if (!_dynamic) {
-    // Cache for static uniform buffers
-    bool changed = false;
-    for (size_t i = 0; i < size; ++i) {
-      if (!stl_util::almost_equal(_bufferData[location + i], data[i])) {
-        changed                   = true;
-        _bufferData[location + i] = data[i];
-      }
-    }
+  _updateUniformAt(location, data, size);
+}
 
-    _needSync = _needSync || changed;
+void UniformBuffer::_updateUniform(unsigned int uniformHandle,
+                                   const float* data, size_t size)
+{
+  const auto location = getUniformOffset(uniformHandle);
+  if (location < 0) {
+    // Uniforms updated by handle must be part of the layout
+    BABYLON_LOG_ERROR("UniformBuffer",
+                      "Cannot update an uniform not declared in the layout.");
+    return;
   }
-  else {
-    // No cache for dynamic
-    for (size_t i = 0; i < size; ++i) {
+
+  if (!_buffer) {
+    create();
+  }
+
+  _updateUniformAt(static_cast<size_t>(location), data, size);
+}
+
+void UniformBuffer::_updateUniformAt(size_t location, const float* data,
+                                     size_t size)
+{
+  if (_dynamic) {
+    // No cache for dynamic, the whole buffer is uploaded on update
+    std::copy(data, data + size, _bufferData.begin() + location);
+    return;
+  }
+
+  // Cache for static uniform buffers
+  size_t start = size, end = 0;
+  for (size_t i = 0; i < size; ++i) {
+    if (!stl_util::almost_equal(_bufferData[location + i], data[i])) {
       _bufferData[location + i] = data[i];
+      start                     = std::min(start, i);
+      end                       = i + 1;
     }
   }
+
+  if (end > start) {
+    _markAsDirty(location + start, location + end);
+  }
 }
 
-void UniformBuffer::_updateMatrix3x3ForUniform(const std::string& name,
-                                               const Float32Array& matrix)
+void UniformBuffer::_markAsDirty(size_t start, size_t end)
 {
+  if (_dirtyEnd > _dirtyStart) {
+    _dirtyStart = std::min(_dirtyStart, start);
+    _dirtyEnd   = std::max(_dirtyEnd, end);
+  }
+  else {
+    _dirtyStart = start;
+    _dirtyEnd   = end;
+  }
+
+  _needSync = true;
+}
+
+void UniformBuffer::updateMatrix3x3(const std::string& name,
+                                    const Float32Array& matrix)
+{
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setMatrix3x3(name, matrix);
+    }
+    return;
+  }
+
   // To match std140, matrix must be realigned
+  std::array<float, 12> temp;
   for (unsigned int i = 0; i < 3; ++i) {
-    UniformBuffer::_tempBuffer[i * 4]     = matrix[i * 3];
-    UniformBuffer::_tempBuffer[i * 4 + 1] = matrix[i * 3 + 1];
-    UniformBuffer::_tempBuffer[i * 4 + 2] = matrix[i * 3 + 2];
-    UniformBuffer::_tempBuffer[i * 4 + 3] = 0.f;
+    temp[i * 4]     = matrix[i * 3];
+    temp[i * 4 + 1] = matrix[i * 3 + 1];
+    temp[i * 4 + 2] = matrix[i * 3 + 2];
+    temp[i * 4 + 3] = 0.f;
   }
 
-  updateUniform(name, UniformBuffer::_tempBuffer, 12);
+  _updateUniform(name, temp.data(), 12);
 }
 
-void UniformBuffer::_updateMatrix3x3ForEffect(const std::string& name,
-                                              const Float32Array& matrix)
+void UniformBuffer::updateMatrix2x2(const std::string& name,
+                                    const Float32Array& matrix)
 {
-  _currentEffect->setMatrix3x3(name, matrix);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setMatrix2x2(name, matrix);
+    }
+    return;
+  }
+
+  // To match std140, matrix must be realigned
+  std::array<float, 8> temp;
+  for (unsigned int i = 0; i < 2; i++) {
+    temp[i * 4]     = matrix[i * 2];
+    temp[i * 4 + 1] = matrix[i * 2 + 1];
+    temp[i * 4 + 2] = 0.f;
+    temp[i * 4 + 3] = 0.f;
+  }
+
+  _updateUniform(name, temp.data(), 8);
 }
 
-void UniformBuffer::_updateMatrix2x2ForEffect(const std::string& name,
-                                              const Float32Array& matrix)
+void UniformBuffer::updateFloat(const std::string& name, float x)
 {
-  _currentEffect->setMatrix2x2(name, matrix);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat(name, x);
+    }
+    return;
+  }
+
+  _updateUniform(name, &x, 1);
 }
 
-void UniformBuffer::_updateMatrix2x2ForUniform(const std::string& name,
-                                               const Float32Array& matrix)
+void UniformBuffer::updateFloat2(const std::string& name, float x, float y)
 {
-  // To match std140, matrix must be realigned
-  for (unsigned int i = 0; i < 2; i++) {
-    UniformBuffer::_tempBuffer[i * 4]     = matrix[i * 2];
-    UniformBuffer::_tempBuffer[i * 4 + 1] = matrix[i * 2 + 1];
-    UniformBuffer::_tempBuffer[i * 4 + 2] = 0.f;
-    UniformBuffer::_tempBuffer[i * 4 + 3] = 0.f;
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat2(name, x, y);
+    }
+    return;
   }
 
-  updateUniform(name, UniformBuffer::_tempBuffer, 8);
+  const std::array<float, 2> temp{{x, y}};
+  _updateUniform(name, temp.data(), 2);
 }
 
-void UniformBuffer::_updateFloatForEffect(const std::string& name, float x)
+void UniformBuffer::updateFloat3(const std::string& name, float x, float y,
+                                 float z, const std::string& suffix)
 {
-  _currentEffect->setFloat(name, x);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat3(name + suffix, x, y, z);
+    }
+    return;
+  }
+
+  const std::array<float, 3> temp{{x, y, z}};
+  _updateUniform(name, temp.data(), 3);
 }
 
-void UniformBuffer::_updateFloatForUniform(const std::string& name, float x)
+void UniformBuffer::updateFloat4(const std::string& name, float x, float y,
+                                 float z, float w, const std::string& suffix)
 {
-  UniformBuffer::_tempBuffer[0] = x;
-  updateUniform(name, UniformBuffer::_tempBuffer, 1);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat4(name + suffix, x, y, z, w);
+    }
+    return;
+  }
+
+  const std::array<float, 4> temp{{x, y, z, w}};
+  _updateUniform(name, temp.data(), 4);
 }
 
-void UniformBuffer::_updateFloat2ForEffect(const std::string& name, float x,
-                                           float y)
+void UniformBuffer::updateMatrix(const std::string& name, const Matrix& mat)
 {
-  _currentEffect->setFloat2(name, x, y);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setMatrix(name, mat);
+    }
+    return;
+  }
+
+  _updateUniform(name, mat.m.data(), 16);
 }
 
-void UniformBuffer::_updateFloat2ForUniform(const std::string& name, float x,
-                                            float y)
+void UniformBuffer::updateVector3(const std::string& name,
+                                  const Vector3& vector)
 {
-  UniformBuffer::_tempBuffer[0] = x;
-  UniformBuffer::_tempBuffer[1] = y;
-  updateUniform(name, UniformBuffer::_tempBuffer, 2);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setVector3(name, vector);
+    }
+    return;
+  }
+
+  const std::array<float, 3> temp{{vector.x, vector.y, vector.z}};
+  _updateUniform(name, temp.data(), 3);
+}
+
+void UniformBuffer::updateVector4(const std::string& name,
+                                  const Vector4& vector)
+{
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setVector4(name, vector);
+    }
+    return;
+  }
+
+  const std::array<float, 4> temp{{vector.x, vector.y, vector.z, vector.w}};
+  _updateUniform(name, temp.data(), 4);
+}
+
+void UniformBuffer::updateColor3(const std::string& name, const Color3& color,
+                                 const std::string& suffix)
+{
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setColor3(name + suffix, color);
+    }
+    return;
+  }
+
+  const std::array<float, 3> temp{{color.r, color.g, color.b}};
+  _updateUniform(name, temp.data(), 3);
+}
+
+void UniformBuffer::updateColor4(const std::string& name, const Color3& color,
+                                 float alpha, const std::string& suffix)
+{
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setColor4(name + suffix, color, alpha);
+    }
+    return;
+  }
+
+  const std::array<float, 4> temp{{color.r, color.g, color.b, alpha}};
+  _updateUniform(name, temp.data(), 4);
+}
+
+void UniformBuffer::updateMatrix3x3(unsigned int uniformHandle,
+                                    const Float32Array& matrix)
+{
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setMatrix3x3(uniformHandle, matrix);
+    }
+    return;
+  }
+
+  // To match std140, matrix must be realigned
+  std::array<float, 12> temp;
+  for (unsigned int i = 0; i < 3; ++i) {
+    temp[i * 4]     = matrix[i * 3];
+    temp[i * 4 + 1] = matrix[i * 3 + 1];
+    temp[i * 4 + 2] = matrix[i * 3 + 2];
+    temp[i * 4 + 3] = 0.f;
+  }
+
+  _updateUniform(uniformHandle, temp.data(), 12);
 }
 
-void UniformBuffer::_updateFloat3ForEffect(const std::string& name, float x,
-                                           float y, float z,
-                                           const std::string& suffix)
+void UniformBuffer::updateMatrix2x2(unsigned int uniformHandle,
+                                    const Float32Array& matrix)
 {
-  _currentEffect->setFloat3(name + suffix, x, y, z);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setMatrix2x2(uniformHandle, matrix);
+    }
+    return;
+  }
+
+  // To match std140, matrix must be realigned
+  std::array<float, 8> temp;
+  for (unsigned int i = 0; i < 2; i++) {
+    temp[i * 4]     = matrix[i * 2];
+    temp[i * 4 + 1] = matrix[i * 2 + 1];
+    temp[i * 4 + 2] = 0.f;
+    temp[i * 4 + 3] = 0.f;
+  }
+
+  _updateUniform(uniformHandle, temp.data(), 8);
 }
 
-void UniformBuffer::_updateFloat3ForUniform(const std::string& name, float x,
-                                            float y, float z,
-                                            const std::string& suffix)
+void UniformBuffer::updateFloat(unsigned int uniformHandle, float x)
 {
-  UniformBuffer::_tempBuffer[0] = x;
-  UniformBuffer::_tempBuffer[1] = y;
-  UniformBuffer::_tempBuffer[2] = z;
-  updateUniform(name + suffix, UniformBuffer::_tempBuffer, 3);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat(uniformHandle, x);
+    }
+    return;
+  }
+
+  _updateUniform(uniformHandle, &x, 1);
 }
 
-void UniformBuffer::_updateFloat4ForEffect(const std::string& name, float x,
-                                           float y, float z, float w,
-                                           const std::string& suffix)
+void UniformBuffer::updateFloat2(unsigned int uniformHandle, float x, float y)
 {
-  _currentEffect->setFloat4(name + suffix, x, y, z, w);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat2(uniformHandle, x, y);
+    }
+    return;
+  }
+
+  const std::array<float, 2> temp{{x, y}};
+  _updateUniform(uniformHandle, temp.data(), 2);
 }
 
-void UniformBuffer::_updateFloat4ForUniform(const std::string& name, float x,
-                                            float y, float z, float w,
-                                            const std::string& suffix)
+void UniformBuffer::updateFloat3(unsigned int uniformHandle, float x, float y,
+                                 float z)
 {
-  UniformBuffer::_tempBuffer[0] = x;
-  UniformBuffer::_tempBuffer[1] = y;
-  UniformBuffer::_tempBuffer[2] = z;
-  UniformBuffer::_tempBuffer[3] = w;
-  updateUniform(name + suffix, UniformBuffer::_tempBuffer, 4);
+  updateFloat3(uniformHandle, x, y, z, uniformHandle);
 }
 
-void UniformBuffer::_updateMatrixForEffect(const std::string& name,
-                                           const Matrix& mat)
+void UniformBuffer::updateFloat3(unsigned int uniformHandle, float x, float y,
+                                 float z, unsigned int effectUniformHandle)
 {
-  _currentEffect->setMatrix(name, mat);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat3(effectUniformHandle, x, y, z);
+    }
+    return;
+  }
+
+  const std::array<float, 3> temp{{x, y, z}};
+  _updateUniform(uniformHandle, temp.data(), 3);
 }
 
-void UniformBuffer::_updateMatrixForUniform(const std::string& name,
-                                            const Matrix& mat)
+void UniformBuffer::updateFloat4(unsigned int uniformHandle, float x, float y,
+                                 float z, float w)
 {
-  updateUniform(name, mat.toArray(), 16);
+  updateFloat4(uniformHandle, x, y, z, w, uniformHandle);
 }
 
-void UniformBuffer::_updateVector3ForEffect(const std::string& name,
-                                            const Vector3& vector)
+void UniformBuffer::updateFloat4(unsigned int uniformHandle, float x, float y,
+                                 float z, float w,
+                                 unsigned int effectUniformHandle)
 {
-  _currentEffect->setVector3(name, vector);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setFloat4(effectUniformHandle, x, y, z, w);
+    }
+    return;
+  }
+
+  const std::array<float, 4> temp{{x, y, z, w}};
+  _updateUniform(uniformHandle, temp.data(), 4);
 }
 
-void UniformBuffer::_updateVector3ForUniform(const std::string& name,
-                                             const Vector3& vector)
+void UniformBuffer::updateMatrix(unsigned int uniformHandle, const Matrix& mat)
 {
-  vector.toArray(UniformBuffer::_tempBuffer);
-  updateUniform(name, UniformBuffer::_tempBuffer, 3);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setMatrix(uniformHandle, mat);
+    }
+    return;
+  }
+
+  _updateUniform(uniformHandle, mat.m.data(), 16);
 }
 
-void UniformBuffer::_updateVector4ForEffect(const std::string& name,
-                                            const Vector4& vector)
+void UniformBuffer::updateVector3(unsigned int uniformHandle,
+                                  const Vector3& vector)
 {
-  _currentEffect->setVector4(name, vector);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setVector3(uniformHandle, vector);
+    }
+    return;
+  }
+
+  const std::array<float, 3> temp{{vector.x, vector.y, vector.z}};
+  _updateUniform(uniformHandle, temp.data(), 3);
 }
 
-void UniformBuffer::_updateVector4ForUniform(const std::string& name,
-                                             const Vector4& vector)
+void UniformBuffer::updateVector4(unsigned int uniformHandle,
+                                  const Vector4& vector)
 {
-  vector.toArray(UniformBuffer::_tempBuffer);
-  updateUniform(name, UniformBuffer::_tempBuffer, 4);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setVector4(uniformHandle, vector);
+    }
+    return;
+  }
+
+  const std::array<float, 4> temp{{vector.x, vector.y, vector.z, vector.w}};
+  _updateUniform(uniformHandle, temp.data(), 4);
 }
 
-void UniformBuffer::_updateColor3ForEffect(const std::string& name,
-                                           const Color3& color,
-                                           const std::string& suffix)
+void UniformBuffer::updateColor3(unsigned int uniformHandle,
+                                 const Color3& color)
 {
-  _currentEffect->setColor3(name + suffix, color);
+  updateColor3(uniformHandle, color, uniformHandle);
 }
 
-void UniformBuffer::_updateColor3ForUniform(const std::string& name,
-                                            const Color3& color,
-                                            const std::string& suffix)
+void UniformBuffer::updateColor3(unsigned int uniformHandle,
+                                 const Color3& color,
+                                 unsigned int effectUniformHandle)
 {
-  color.toArray(UniformBuffer::_tempBuffer);
-  updateUniform(name + suffix, UniformBuffer::_tempBuffer, 3);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setColor3(effectUniformHandle, color);
+    }
+    return;
+  }
+
+  const std::array<float, 3> temp{{color.r, color.g, color.b}};
+  _updateUniform(uniformHandle, temp.data(), 3);
 }
 
-void UniformBuffer::_updateColor4ForEffect(const std::string& name,
-                                           const Color3& color, float alpha,
-                                           const std::string& suffix)
+void UniformBuffer::updateColor4(unsigned int uniformHandle,
+                                 const Color3& color, float alpha)
 {
-  _currentEffect->setColor4(name + suffix, color, alpha);
+  updateColor4(uniformHandle, color, alpha, uniformHandle);
 }
 
-void UniformBuffer::_updateColor4ForUniform(const std::string& name,
-                                            const Color3& color, float alpha,
-                                            const std::string& suffix)
+void UniformBuffer::updateColor4(unsigned int uniformHandle,
+                                 const Color3& color, float alpha,
+                                 unsigned int effectUniformHandle)
 {
-  color.toArray(UniformBuffer::_tempBuffer);
-  UniformBuffer::_tempBuffer[3] = alpha;
-  updateUniform(name + suffix, UniformBuffer::_tempBuffer, 4);
+  if (_noUBO) {
+    if (_currentEffect) {
+      _currentEffect->setColor4(effectUniformHandle, color, alpha);
+    }
+    return;
+  }
+
+  const std::array<float, 4> temp{{color.r, color.g, color.b, alpha}};
+  _updateUniform(uniformHandle, temp.data(), 4);
 }
 
 void UniformBuffer::setTexture(const std::string& name, BaseTexture* texture)
@@ -530,17 +742,21 @@ void UniformBuffer::bindToEffect(Effect* effect, const std::string& name)
     return;
   }
 
-  effect->bindUniformBuffer(_buffer.get(), name);
+  effect->bindUniformBuffer(_buffer, name);
 }
 
 void UniformBuffer::dispose()
 {
-  if (!_buffer) {
+  if (_buffers.empty()) {
     return;
   }
-  if (_engine->_releaseBuffer(_buffer.get())) {
-    _buffer = nullptr;
+
+  for (auto& buffer : _buffers) {
+    _engine->_releaseUniformBuffer(std::move(buffer));
   }
+  _buffers.clear();
+  _buffer      = nullptr;
+  _bufferIndex = 0;
 }
 
 } // end of namespace BABYLON
@@ -13,11 +13,7 @@
 
 namespace BABYLON {
 
-Quaternion Matrix::_tempQuaternion = Quaternion::Zero();
-Vector3 Matrix::_xAxis             = Vector3::Zero();
-Vector3 Matrix::_yAxis             = Vector3::Zero();
-Vector3 Matrix::_zAxis             = Vector3::Zero();
-int Matrix::_updateFlagSeed        = 0;
+std::atomic<int> Matrix::_updateFlagSeed{0};
 
 Matrix::Matrix()
 {
@@ -81,9 +77,10 @@ int Matrix::getHashCode() const
 
 void Matrix::_markAsUpdated()
 {
-  updateFlag = (Matrix::_updateFlagSeed < std::numeric_limits<int>::max()) ?
-                 Matrix::_updateFlagSeed++ :
-                 0;
+  // Matrices may be updated concurrently, the seed wraps to negative values
+  // past the max int value
+  const int seed = Matrix::_updateFlagSeed.fetch_add(1);
+  updateFlag     = (seed >= 0) ? seed : 0;
 }
 
 /** Properties **/
@@ -450,9 +447,9 @@ const Matrix& Matrix::multiplyToArray(const Matrix& other, Float32Array& result,
   }
 
   std::array<float, 16> array;
-  multiplyToArray(other, array, offset);
+  multiplyToArray(other, array, 0);
   for (unsigned int i = 0; i != 16; ++i) {
-    result[i] = array[i];
+    result[offset + i] = array[i];
   }
 
   return *this;
@@ -508,9 +505,9 @@ bool Matrix::decompose(Vector3& scale, Quaternion& rotation,
     m[0] / scale.x, m[1] / scale.x, m[2] / scale.x, 0.f,  //
     m[4] / scale.y, m[5] / scale.y, m[6] / scale.y, 0.f,  //
     m[8] / scale.z, m[9] / scale.z, m[10] / scale.z, 0.f, //
-    0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray[0]);
+    0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray()[0]);
 
-  Quaternion::FromRotationMatrixToRef(Tmp::MatrixArray[0], rotation);
+  Quaternion::FromRotationMatrixToRef(Tmp::MatrixArray()[0], rotation);
 
   return true;
 }
@@ -739,11 +736,11 @@ void Matrix::ComposeToRef(const Vector3& scale, Quaternion& rotation,
   Matrix::FromValuesToRef(scale.x, 0.f, 0.f, 0.f, //
                           0.f, scale.y, 0.f, 0.f, //
                           0.f, 0.f, scale.z, 0.f, //
-                          0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray[1]);
+                          0.f, 0.f, 0.f, 1.f, Tmp::MatrixArray()[1]);
 
-  rotation.toRotationMatrix(Tmp::MatrixArray[0]);
+  rotation.toRotationMatrix(Tmp::MatrixArray()[0]);
 
-  Tmp::MatrixArray[1].multiplyToRef(Tmp::MatrixArray[0], result);
+  Tmp::MatrixArray()[1].multiplyToRef(Tmp::MatrixArray()[0], result);
 
   result.setTranslation(translation);
 }
@@ -499,7 +499,7 @@ void Quaternion::RotationQuaternionFromAxisToRef(Vector3& axis1, Vector3& axis2,
                                                  Vector3& axis3,
                                                  Quaternion& ref)
 {
-  auto& rotMat = Tmp::MatrixArray[0];
+  auto& rotMat = Tmp::MatrixArray()[0];
   Matrix::FromXYZAxesToRef(axis1.normalize(), axis2.normalize(),
                            axis3.normalize(), rotMat);
   Quaternion::FromRotationMatrixToRef(rotMat, ref);
@@ -9,20 +9,49 @@
 
 namespace BABYLON {
 
-std::array<Color3, 3> Tmp::Color3Array{
-  {Color3::Black(), Color3::Black(), Color3::Black()}};
-std::array<Vector2, 3> Tmp::Vector2Array{
-  {Vector2::Zero(), Vector2::Zero(), Vector2::Zero()}};
-std::array<Vector3, 9> Tmp::Vector3Array{
-  {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
-   Vector3::Zero()}};
-std::array<Vector4, 3> Tmp::Vector4Array{
-  {Vector4::Zero(), Vector4::Zero(), Vector4::Zero()}};
-std::array<Quaternion, 2> Tmp::QuaternionArray{
-  {Quaternion::Zero(), Quaternion::Zero()}};
-std::array<Matrix, 6> Tmp::MatrixArray{{Matrix::Zero(), Matrix::Zero(),
-                                        Matrix::Zero(), Matrix::Zero(),
-                                        Matrix::Zero(), Matrix::Zero()}};
+std::array<Color3, 3>& Tmp::Color3Array()
+{
+  static thread_local std::array<Color3, 3> color3Array{
+    {Color3::Black(), Color3::Black(), Color3::Black()}};
+  return color3Array;
+}
+
+std::array<Vector2, 3>& Tmp::Vector2Array()
+{
+  static thread_local std::array<Vector2, 3> vector2Array{
+    {Vector2::Zero(), Vector2::Zero(), Vector2::Zero()}};
+  return vector2Array;
+}
+
+std::array<Vector3, 9>& Tmp::Vector3Array()
+{
+  static thread_local std::array<Vector3, 9> vector3Array{
+    {Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero(), Vector3::Zero(), Vector3::Zero(), Vector3::Zero(),
+     Vector3::Zero()}};
+  return vector3Array;
+}
+
+std::array<Vector4, 3>& Tmp::Vector4Array()
+{
+  static thread_local std::array<Vector4, 3> vector4Array{
+    {Vector4::Zero(), Vector4::Zero(), Vector4::Zero()}};
+  return vector4Array;
+}
+
+std::array<Quaternion, 2>& Tmp::QuaternionArray()
+{
+  static thread_local std::array<Quaternion, 2> quaternionArray{
+    {Quaternion::Zero(), Quaternion::Zero()}};
+  return quaternionArray;
+}
+
+std::array<Matrix, 7>& Tmp::MatrixArray()
+{
+  static thread_local std::array<Matrix, 7> matrixArray{
+    {Matrix::Zero(), Matrix::Zero(), Matrix::Zero(), Matrix::Zero(),
+     Matrix::Zero(), Matrix::Zero(), Matrix::Zero()}};
+  return matrixArray;
+}
 
 } // end of namespace BABYLON
@@ -10,7 +10,10 @@
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/engine/transform_hierarchy.h>
 #include <babylon/lights/light.h>
+#include <babylon/lights/light_grid.h>
 #include <babylon/lights/shadows/shadow_generator.h>
 #include <babylon/materials/material.h>
 #include <babylon/materials/material_defines.h>
@@ -29,9 +32,6 @@
 
 namespace BABYLON {
 
-Quaternion AbstractMesh::_rotationAxisCache;
-Vector3 AbstractMesh::_lookAtVectorCache = Vector3(0.f, 0.f, 0.f);
-
 AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
     : Node(iName, scene)
     , definedFacingForward{true} // orientation for POV movement & rotation
@@ -72,6 +72,8 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
     , _renderId{0}
     , _submeshesOctree{nullptr}
     , _unIndexed{false}
+    , _transformHierarchyIndex{-1}
+    , _isTransformManaged{false}
     , _facetNb{0}
     , _partitioningSubdivisions{10}
     , _partitioningBBoxRatio{1.01f}
@@ -337,6 +339,12 @@ std::string AbstractMesh::toString(bool fullDetails) const
 
 void AbstractMesh::_resyncLightSources()
 {
+  auto lightGrid = getScene()->lightGrid();
+  if (lightGrid) {
+    lightGrid->markMeshAsDirty(this);
+    return;
+  }
+
   _lightSources.clear();
 
   for (auto& light : getScene()->lights) {
@@ -358,7 +366,7 @@ void AbstractMesh::_resyncLighSource(Light* light)
 
   auto index = std::find(_lightSources.begin(), _lightSources.end(), light);
 
-  if (index != _lightSources.end()) {
+  if (index == _lightSources.end()) {
     if (!isIn) {
       return;
     }
@@ -386,7 +394,7 @@ void AbstractMesh::_removeLightSource(Light* light)
 }
 
 void AbstractMesh::_markSubMeshesAsDirty(
-  const std::function<void(const MaterialDefines& defines)>& func)
+  const std::function<void(MaterialDefines& defines)>& func)
 {
   if (subMeshes.empty()) {
     return;
@@ -401,10 +409,14 @@ void AbstractMesh::_markSubMeshesAsDirty(
 
 void AbstractMesh::_markSubMeshesAsLightDirty()
 {
+  _markSubMeshesAsDirty(
+    [](MaterialDefines& defines) { defines.markAsLightDirty(); });
 }
 
 void AbstractMesh::_markSubMeshesAsAttributesDirty()
 {
+  _markSubMeshesAsDirty(
+    [](MaterialDefines& defines) { defines.markAsAttributesDirty(); });
 }
 
 void AbstractMesh::_markSubMeshesAsMiscDirty()
@@ -457,32 +469,41 @@ std::vector<Vector3>& AbstractMesh::_positions()
 
 Vector3& AbstractMesh::position()
 {
+  // The returned reference may be written to
+  _markAsTransformDirty();
   return _position;
 }
 
 void AbstractMesh::setPosition(const Vector3& newPosition)
 {
   _position = newPosition;
+  _markAsTransformDirty();
 }
 
 Vector3& AbstractMesh::rotation()
 {
+  // The returned reference may be written to
+  _markAsTransformDirty();
   return _rotation;
 }
 
 void AbstractMesh::setRotation(const Vector3& newRotation)
 {
   _rotation = newRotation;
+  _markAsTransformDirty();
 }
 
 Vector3& AbstractMesh::scaling()
 {
+  // The returned reference may be written to
+  _markAsTransformDirty();
   return _scaling;
 }
 
 void AbstractMesh::setScaling(const Vector3& newScaling)
 {
   _scaling = newScaling;
+  _markAsTransformDirty();
   if (physicsImpostor) {
     physicsImpostor->forceUpdate();
   }
@@ -490,6 +511,8 @@ void AbstractMesh::setScaling(const Vector3& newScaling)
 
 Quaternion& AbstractMesh::rotationQuaternion()
 {
+  // The returned reference may be written to
+  _markAsTransformDirty();
   return _rotationQuaternion;
 }
 
@@ -501,6 +524,7 @@ bool AbstractMesh::rotationQuaternionSet() const
 void AbstractMesh::nullifyRotationQuaternion()
 {
   _rotationQuaternionSet = false;
+  _markAsTransformDirty();
 }
 
 void AbstractMesh::setRotationQuaternion(const Quaternion& quaternion)
@@ -511,6 +535,7 @@ void AbstractMesh::setRotationQuaternion(const Quaternion& quaternion)
   if (rotation().length() > 0) {
     rotation().copyFromFloats(0.f, 0.f, 0.f);
   }
+  _markAsTransformDirty();
 }
 
 void AbstractMesh::resetRotationQuaternion()
@@ -520,7 +545,7 @@ void AbstractMesh::resetRotationQuaternion()
 
 AbstractMesh* AbstractMesh::getParent()
 {
-  if (parent()->type() == IReflect::Type::ABSTRACTMESH) {
+  if (parent() && (parent()->type() == IReflect::Type::ABSTRACTMESH)) {
     return dynamic_cast<AbstractMesh*>(parent());
   }
 
@@ -718,8 +743,7 @@ AbstractMesh& AbstractMesh::rotate(Vector3& axis, float amount,
   }
   Quaternion rotationQuaternionTmp;
   if (space == Space::LOCAL) {
-    rotationQuaternionTmp = Quaternion::RotationAxisToRef(
-      axis, amount, AbstractMesh::_rotationAxisCache);
+    Quaternion::RotationAxisToRef(axis, amount, rotationQuaternionTmp);
     _rotationQuaternion.multiplyToRef(rotationQuaternionTmp,
                                       rotationQuaternion());
   }
@@ -730,11 +754,11 @@ AbstractMesh& AbstractMesh::rotate(Vector3& axis, float amount,
 
       axis = Vector3::TransformNormal(axis, *invertParentWorldMatrix);
     }
-    rotationQuaternionTmp = Quaternion::RotationAxisToRef(
-      axis, amount, AbstractMesh::_rotationAxisCache);
+    Quaternion::RotationAxisToRef(axis, amount, rotationQuaternionTmp);
     rotationQuaternionTmp.multiplyToRef(rotationQuaternion(),
                                         rotationQuaternion());
   }
+  _markAsTransformDirty();
   return *this;
 }
 
@@ -760,16 +784,17 @@ AbstractMesh& AbstractMesh::addRotation(float x, float y, float z)
     rotationQuaternionTmp = rotationQuaternion();
   }
   else {
-    rotationQuaternionTmp = Tmp::QuaternionArray[1];
+    rotationQuaternionTmp = Tmp::QuaternionArray()[1];
     Quaternion::RotationYawPitchRollToRef(rotation().y, rotation().x,
                                           rotation().z, rotationQuaternionTmp);
   }
-  auto accumulation = Tmp::QuaternionArray[0];
+  auto accumulation = Tmp::QuaternionArray()[0];
   Quaternion::RotationYawPitchRollToRef(y, x, z, accumulation);
   rotationQuaternionTmp.multiplyInPlace(accumulation);
   if (!rotationQuaternionSet()) {
     rotationQuaternionTmp.toEulerAnglesToRef(rotation());
   }
+  _markAsTransformDirty();
   return *this;
 }
 
@@ -801,6 +826,7 @@ AbstractMesh::setAbsolutePosition(const Vector3& absolutePosition_)
     _position.y = absolutePositionY;
     _position.z = absolutePositionZ;
   }
+  _markAsTransformDirty();
 
   return *this;
 }
@@ -809,6 +835,7 @@ AbstractMesh& AbstractMesh::movePOV(float amountRight, float amountUp,
                                     float amountForward)
 {
   _position.addInPlace(calcMovePOV(amountRight, amountUp, amountForward));
+  _markAsTransformDirty();
   return *this;
 }
 
@@ -849,6 +876,7 @@ AbstractMesh& AbstractMesh::setPivotMatrix(const Matrix& matrix)
 {
   _pivotMatrix              = matrix;
   _cache.pivotMatrixUpdated = true;
+  _markAsTransformDirty();
   return *this;
 }
 
@@ -886,12 +914,12 @@ bool AbstractMesh::_isSynchronized()
     }
   }
   else {
-    if (!_cache.rotation.equals(rotation())) {
+    if (!_cache.rotation.equals(_rotation)) {
       return false;
     }
   }
 
-  if (!_cache.scaling.equals(scaling())) {
+  if (!_cache.scaling.equals(_scaling)) {
     return false;
   }
 
@@ -917,6 +945,14 @@ void AbstractMesh::markAsDirty(unsigned int property)
   }
   _currentRenderId = std::numeric_limits<int>::max();
   _isDirty         = true;
+  _markAsTransformDirty();
+}
+
+void AbstractMesh::_markAsTransformDirty()
+{
+  if (_transformHierarchyIndex >= 0) {
+    getScene()->transformHierarchy()->markAsDirty(_transformHierarchyIndex);
+  }
 }
 
 AbstractMesh& AbstractMesh::_updateBoundingInfo()
@@ -954,22 +990,40 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
     return *_worldMatrix;
   }
 
+  // World matrix updated by the scene transform hierarchy
+  if (_isTransformManaged) {
+    auto transformHierarchy = getScene()->transformHierarchy();
+    if (!force) {
+      // Only the subtree of the topmost dirty ancestor is updated
+      if (transformHierarchy->hasPendingChanges()) {
+        transformHierarchy->updateNode(_transformHierarchyIndex);
+      }
+      _currentRenderId = getScene()->getRenderId();
+      return *_worldMatrix;
+    }
+    transformHierarchy->markAsDirty(_transformHierarchyIndex);
+  }
+
   if (!force && isSynchronized(true)) {
     _currentRenderId = getScene()->getRenderId();
     return *_worldMatrix;
   }
 
   _cache.position.copyFrom(_position);
-  _cache.scaling.copyFrom(scaling());
+  _cache.scaling.copyFrom(_scaling);
   _cache.pivotMatrixUpdated = false;
   _cache.billboardMode      = billboardMode;
   _currentRenderId          = getScene()->getRenderId();
   _isDirty                  = false;
 
+  // Scratch objects of the calling thread
+  auto& tmpMatrices = Tmp::MatrixArray();
+  auto& tmpVectors  = Tmp::Vector3Array();
+
   // Scaling
   Matrix::ScalingToRef(_scaling.x * scalingDeterminant,
                        _scaling.y * scalingDeterminant,
-                       _scaling.z * scalingDeterminant, Tmp::MatrixArray[1]);
+                       _scaling.z * scalingDeterminant, tmpMatrices[1]);
 
   // Rotation
 
@@ -978,19 +1032,19 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
     float len = _rotation.length();
     if (len > 0.f) {
       _rotationQuaternion.multiplyInPlace(Quaternion::RotationYawPitchRoll(
-        rotation().y, rotation().x, rotation().z));
-      rotation().copyFromFloats(0.f, 0.f, 0.f);
+        _rotation.y, _rotation.x, _rotation.z));
+      _rotation.copyFromFloats(0.f, 0.f, 0.f);
     }
   }
 
   if (_rotationQuaternionSet) {
-    _rotationQuaternion.toRotationMatrix(Tmp::MatrixArray[0]);
+    _rotationQuaternion.toRotationMatrix(tmpMatrices[0]);
     _cache.rotationQuaternion.copyFrom(_rotationQuaternion);
   }
   else {
-    Matrix::RotationYawPitchRollToRef(rotation().y, rotation().x, rotation().z,
-                                      Tmp::MatrixArray[0]);
-    _cache.rotation.copyFrom(rotation());
+    Matrix::RotationYawPitchRollToRef(_rotation.y, _rotation.x, _rotation.z,
+                                      tmpMatrices[0]);
+    _cache.rotation.copyFrom(_rotation);
   }
 
   // Translation
@@ -1006,17 +1060,17 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
       Matrix::TranslationToRef(_position.x + cameraGlobalPosition.x,
                                _position.y + cameraGlobalPosition.y,
                                _position.z + cameraGlobalPosition.z,
-                               Tmp::MatrixArray[2]);
+                               tmpMatrices[2]);
     }
   }
   else {
     Matrix::TranslationToRef(_position.x, _position.y, _position.z,
-                             Tmp::MatrixArray[2]);
+                             tmpMatrices[2]);
   }
 
   // Composing transformations
-  _pivotMatrix.multiplyToRef(Tmp::MatrixArray[1], Tmp::MatrixArray[4]);
-  Tmp::MatrixArray[4].multiplyToRef(Tmp::MatrixArray[0], Tmp::MatrixArray[5]);
+  _pivotMatrix.multiplyToRef(tmpMatrices[1], tmpMatrices[4]);
+  tmpMatrices[4].multiplyToRef(tmpMatrices[0], tmpMatrices[5]);
 
   // Billboarding (testing PG:http://www.babylonjs-playground.com/#UJEIL#13)
   if (billboardMode != AbstractMesh::BILLBOARDMODE_NONE
@@ -1024,28 +1078,28 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
     if ((billboardMode & AbstractMesh::BILLBOARDMODE_ALL)
         != AbstractMesh::BILLBOARDMODE_ALL) {
       // Need to decompose each rotation here
-      auto currentPosition = Tmp::Vector3Array[3];
+      auto currentPosition = tmpVectors[3];
 
       if (parent() && parent()->getWorldMatrix()) {
         if (_meshToBoneReferal) {
           parent()->getWorldMatrix()->multiplyToRef(
-            *_meshToBoneReferal->getWorldMatrix(), Tmp::MatrixArray[6]);
-          Vector3::TransformCoordinatesToRef(position(), Tmp::MatrixArray[6],
+            *_meshToBoneReferal->getWorldMatrix(), tmpMatrices[6]);
+          Vector3::TransformCoordinatesToRef(_position, tmpMatrices[6],
                                              currentPosition);
         }
         else {
           Vector3::TransformCoordinatesToRef(
-            position(), *parent()->getWorldMatrix(), currentPosition);
+            _position, *parent()->getWorldMatrix(), currentPosition);
         }
       }
       else {
-        currentPosition.copyFrom(position());
+        currentPosition.copyFrom(_position);
       }
 
       currentPosition.subtractInPlace(
         getScene()->activeCamera->globalPosition());
 
-      auto finalEuler = Tmp::Vector3Array[4].copyFromFloats(0.f, 0.f, 0.f);
+      auto finalEuler = tmpVectors[4].copyFromFloats(0.f, 0.f, 0.f);
       if ((billboardMode & AbstractMesh::BILLBOARDMODE_X)
           == AbstractMesh::BILLBOARDMODE_X) {
         finalEuler.x = std::atan2(-currentPosition.y, currentPosition.z);
@@ -1062,21 +1116,21 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
       }
 
       Matrix::RotationYawPitchRollToRef(finalEuler.y, finalEuler.x,
-                                        finalEuler.z, Tmp::MatrixArray[0]);
+                                        finalEuler.z, tmpMatrices[0]);
     }
     else {
-      Tmp::MatrixArray[1].copyFrom(getScene()->activeCamera->getViewMatrix());
+      tmpMatrices[1].copyFrom(getScene()->activeCamera->getViewMatrix());
 
-      Tmp::MatrixArray[1].setTranslationFromFloats(0, 0, 0);
-      Tmp::MatrixArray[1].invertToRef(Tmp::MatrixArray[0]);
+      tmpMatrices[1].setTranslationFromFloats(0, 0, 0);
+      tmpMatrices[1].invertToRef(tmpMatrices[0]);
     }
 
-    Tmp::MatrixArray[1].copyFrom(Tmp::MatrixArray[5]);
-    Tmp::MatrixArray[1].multiplyToRef(Tmp::MatrixArray[0], Tmp::MatrixArray[5]);
+    tmpMatrices[1].copyFrom(tmpMatrices[5]);
+    tmpMatrices[1].multiplyToRef(tmpMatrices[0], tmpMatrices[5]);
   }
 
   // Local world
-  Tmp::MatrixArray[5].multiplyToRef(Tmp::MatrixArray[2], _localWorld);
+  tmpMatrices[5].multiplyToRef(tmpMatrices[2], _localWorld);
 
   // Parent
   if (parent() && parent()->getWorldMatrix()) {
@@ -1085,25 +1139,24 @@ Matrix AbstractMesh::computeWorldMatrix(bool force)
     if (billboardMode != AbstractMesh::BILLBOARDMODE_NONE) {
       if (_meshToBoneReferal) {
         parent()->getWorldMatrix()->multiplyToRef(
-          *_meshToBoneReferal->getWorldMatrix(), Tmp::MatrixArray[6]);
-        Tmp::MatrixArray[5].copyFrom(Tmp::MatrixArray[6]);
+          *_meshToBoneReferal->getWorldMatrix(), tmpMatrices[6]);
+        tmpMatrices[5].copyFrom(tmpMatrices[6]);
       }
       else {
-        Tmp::MatrixArray[5].copyFrom(*parent()->getWorldMatrix());
+        tmpMatrices[5].copyFrom(*parent()->getWorldMatrix());
       }
 
-      _localWorld.getTranslationToRef(Tmp::Vector3Array[5]);
-      Vector3::TransformCoordinatesToRef(
-        Tmp::Vector3Array[5], Tmp::MatrixArray[5], Tmp::Vector3Array[5]);
+      _localWorld.getTranslationToRef(tmpVectors[5]);
+      Vector3::TransformCoordinatesToRef(tmpVectors[5], tmpMatrices[5],
+                                         tmpVectors[5]);
       _worldMatrix->copyFrom(_localWorld);
-      _worldMatrix->setTranslation(Tmp::Vector3Array[5]);
+      _worldMatrix->setTranslation(tmpVectors[5]);
     }
     else {
       if (_meshToBoneReferal) {
-        _localWorld.multiplyToRef(*parent()->getWorldMatrix(),
-                                  Tmp::MatrixArray[6]);
-        Tmp::MatrixArray[6].multiplyToRef(*_meshToBoneReferal->getWorldMatrix(),
-                                          *_worldMatrix);
+        _localWorld.multiplyToRef(*parent()->getWorldMatrix(), tmpMatrices[6]);
+        tmpMatrices[6].multiplyToRef(*_meshToBoneReferal->getWorldMatrix(),
+                                     *_worldMatrix);
       }
       else {
         _localWorld.multiplyToRef(*parent()->getWorldMatrix(), *_worldMatrix);
@@ -1150,6 +1203,7 @@ AbstractMesh& AbstractMesh::setPositionWithLocalVector(const Vector3& vector3)
   computeWorldMatrix();
 
   _position = Vector3(Vector3::TransformNormal(vector3, _localWorld));
+  _markAsTransformDirty();
 
   return *this;
 }
@@ -1168,6 +1222,7 @@ AbstractMesh& AbstractMesh::locallyTranslate(const Vector3& vector3)
   computeWorldMatrix(true);
 
   _position = Vector3(Vector3::TransformCoordinates(vector3, _localWorld));
+  _markAsTransformDirty();
 
   return *this;
 }
@@ -1175,7 +1230,7 @@ AbstractMesh& AbstractMesh::locallyTranslate(const Vector3& vector3)
 AbstractMesh& AbstractMesh::lookAt(const Vector3& targetPoint, float yawCor,
                                    float pitchCor, float rollCor, Space space)
 {
-  Vector3& dv = AbstractMesh::_lookAtVectorCache;
+  Vector3 dv;
   Vector3 pos = (space == Space::LOCAL) ? _position : *getAbsolutePosition();
   targetPoint.subtractToRef(pos, dv);
   float yaw   = -std::atan2(dv.z, dv.x) - Math::PI_2;
@@ -1555,13 +1610,12 @@ AbstractMesh* AbstractMesh::clone(const std::string& /*name*/,
 
 AbstractMesh& AbstractMesh::releaseSubMeshes()
 {
-  if (!subMeshes.empty()) {
-    for (auto& subMesh : subMeshes) {
-      subMesh->dispose();
-    }
-  }
-
+  // Kept alive while they remove themselves from the mesh
+  auto releasedSubMeshes = std::move(subMeshes);
   subMeshes.clear();
+  for (auto& subMesh : releasedSubMeshes) {
+    subMesh->dispose();
+  }
 
   return *this;
 }
@@ -1703,7 +1757,7 @@ AbstractMesh& AbstractMesh::setPivotPoint(const Vector3& point,
   auto wm = getWorldMatrix();
 
   if (space == Space::WORLD) {
-    auto& tmat = Tmp::MatrixArray[0];
+    auto& tmat = Tmp::MatrixArray()[0];
     wm->invertToRef(tmat);
     _point = Vector3::TransformCoordinates(_point, tmat);
   }
@@ -1752,9 +1806,9 @@ AbstractMesh& AbstractMesh::setParent(AbstractMesh* mesh)
   auto parent = mesh;
 
   if (mesh == nullptr) {
-    auto& rotation = Tmp::QuaternionArray[0];
-    auto& position = Tmp::Vector3Array[0];
-    auto& scale    = Tmp::Vector3Array[1];
+    auto& rotation = Tmp::QuaternionArray()[0];
+    auto& position = Tmp::Vector3Array()[0];
+    auto& scale    = Tmp::Vector3Array()[1];
 
     child->getWorldMatrix()->decompose(scale, rotation, position);
 
@@ -1770,11 +1824,11 @@ AbstractMesh& AbstractMesh::setParent(AbstractMesh* mesh)
     child->position().z = position.z;
   }
   else {
-    auto& rotation = Tmp::QuaternionArray[0];
-    auto& position = Tmp::Vector3Array[0];
-    auto& scale    = Tmp::Vector3Array[1];
-    auto& m1       = Tmp::MatrixArray[0];
-    auto& m2       = Tmp::MatrixArray[1];
+    auto& rotation = Tmp::QuaternionArray()[0];
+    auto& position = Tmp::Vector3Array()[0];
+    auto& scale    = Tmp::Vector3Array()[1];
+    auto& m1       = Tmp::MatrixArray()[0];
+    auto& m2       = Tmp::MatrixArray()[1];
 
     parent->getWorldMatrix()->decompose(scale, rotation, position);
 
@@ -1805,6 +1859,7 @@ AbstractMesh& AbstractMesh::setParent(AbstractMesh* mesh)
     child->position().z = position.z;
   }
   static_cast<Node*>(child)->setParent(parent);
+  _markAsTransformDirty();
   return *this;
 }
 
@@ -1979,9 +2034,9 @@ int AbstractMesh::getClosestFacetAtCoordinates(float x, float y, float z,
                                                bool checkFace, bool facing)
 {
   auto world   = getWorldMatrix();
-  auto& invMat = Tmp::MatrixArray[5];
+  auto& invMat = Tmp::MatrixArray()[5];
   world->invertToRef(invMat);
-  auto& invVect = Tmp::Vector3Array[8];
+  auto& invVect = Tmp::Vector3Array()[8];
   int closest   = -1;
   // transform (x,y,z) to coordinates in the mesh local space
   Vector3::TransformCoordinatesFromFloatsToRef(x, y, z, invMat, invVect);
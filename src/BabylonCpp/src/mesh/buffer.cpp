@@ -5,6 +5,7 @@
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_compression.h>
 
 namespace BABYLON {
 
@@ -16,6 +17,8 @@ Buffer::Buffer(Engine* engine, const Float32Array& data, bool updatable,
     , _updatable{updatable}
     , _strideSize{stride}
     , _instanced{instanced}
+    , _format{VertexCompression::None}
+    , _quantizationCube{{0.f, 0.f, 0.f, 1.f}}
 {
   if (!postponeInternalCreation) { // by default
     create();
@@ -29,6 +32,8 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, int stride,
     , _updatable{updatable}
     , _strideSize{stride}
     , _instanced{instanced}
+    , _format{VertexCompression::None}
+    , _quantizationCube{{0.f, 0.f, 0.f, 1.f}}
 {
   // old versions of BABYLON.VertexBuffer accepted 'mesh' instead of 'engine'
   _engine = mesh->getScene()->getEngine();
@@ -37,6 +42,21 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, int stride,
   }
 }
 
+Buffer::Buffer(Engine* engine, const Uint16Array& packedData,
+               unsigned int format, int stride,
+               const std::array<float, 4>& quantizationCube)
+    : _engine{engine}
+    , _buffer{nullptr}
+    , _updatable{false}
+    , _strideSize{stride}
+    , _instanced{false}
+    , _packedData{packedData}
+    , _format{format}
+    , _quantizationCube(quantizationCube)
+{
+  create();
+}
+
 Buffer::~Buffer()
 {
 }
@@ -65,6 +85,11 @@ bool Buffer::isUpdatable() const
 
 Float32Array& Buffer::getData()
 {
+  if (_format != VertexCompression::None && _data.empty()) {
+    _data = VertexCompression::Decode(
+      static_cast<VertexCompression::Format>(_format), _packedData,
+      static_cast<size_t>(_strideSize), _quantizationCube);
+  }
   return _data;
 }
 
@@ -83,6 +108,16 @@ bool Buffer::getIsInstanced() const
   return _instanced;
 }
 
+unsigned int Buffer::getFormat() const
+{
+  return _format;
+}
+
+const std::array<float, 4>& Buffer::getQuantizationCube() const
+{
+  return _quantizationCube;
+}
+
 // Methods
 GL::IGLBuffer* Buffer::create()
 {
@@ -91,7 +126,10 @@ GL::IGLBuffer* Buffer::create()
   }
 
   if (!_buffer) { // create buffer
-    if (_updatable) {
+    if (_format != VertexCompression::None) {
+      _buffer = _engine->createVertexBuffer(_packedData);
+    }
+    else if (_updatable) {
       _buffer = _engine->createDynamicVertexBuffer(_data);
     }
     else {
@@ -107,6 +145,11 @@ GL::IGLBuffer* Buffer::create()
 
 GL::IGLBuffer* Buffer::create(const Float32Array& data)
 {
+  // Compressed buffers are static
+  if (_format != VertexCompression::None) {
+    return create();
+  }
+
   if (data.empty() && _buffer) {
     return nullptr; // nothing to do
   }
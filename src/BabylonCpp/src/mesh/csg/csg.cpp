@@ -1,20 +1,27 @@
 #include <babylon/mesh/csg/csg.h>
 
 #include <babylon/babylon_stl_util.h>
-#include <babylon/core/string.h>
 #include <babylon/math/quaternion.h>
 #include <babylon/mesh/csg/node.h>
 #include <babylon/mesh/csg/polygon.h>
 #include <babylon/mesh/csg/vertex.h>
+#include <babylon/mesh/csg/vertex_arena.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data.h>
 
 namespace BABYLON {
 
 unsigned int CSG::CSG::currentCSGMeshId = 0;
 
 CSG::CSG::CSG()
+    : matrix{Matrix::Identity()}
+    , position{Vector3::Zero()}
+    , rotation{Vector3::Zero()}
+    , rotationQuaternion{nullptr}
+    , scaling{Vector3(1.f, 1.f, 1.f)}
+    , _arena{std::make_unique<VertexArena>()}
 {
 }
 
@@ -22,51 +29,46 @@ CSG::CSG::~CSG()
 {
 }
 
-CSG::CSG* CSG::CSG::FromMesh(Mesh* mesh)
+std::unique_ptr<CSG::CSG> CSG::CSG::FromMesh(Mesh* mesh)
 {
-  Vector3 normal;
   Vector2 uv;
-  Vector3 position;
-  std::vector<Polygon*> polygons;
-
-  Matrix matrix;
-  Vector3 meshPosition;
-  Vector3 meshRotation;
-  Quaternion meshRotationQuaternion;
-  Vector3 meshScaling;
+  std::vector<Polygon> polygons;
 
   mesh->computeWorldMatrix(true);
-  /*matrix       = mesh->getWorldMatrix()->clone();
-  meshPosition = mesh->position()->clone();
-  meshRotation = mesh->rotation()->clone();
-  if (mesh->rotationQuaternion()) {
-    meshRotationQuaternion = mesh->rotationQuaternion()->clone();
-  }
-  meshScaling = mesh->rotation()->clone();*/
+  const Matrix matrix = *mesh->getWorldMatrix();
 
   Uint32Array indices    = mesh->getIndices();
   Float32Array positions = mesh->getVerticesData(VertexBuffer::PositionKind);
   Float32Array normals   = mesh->getVerticesData(VertexBuffer::NormalKind);
   Float32Array uvs       = mesh->getVerticesData(VertexBuffer::UVKind);
 
+  auto csg = std::make_unique<CSG>();
+
+  // All the vertices of the mesh are allocated upfront in a single range
+  size_t indexCount = 0;
+  for (auto& subMesh : mesh->subMeshes) {
+    indexCount += subMesh->indexCount;
+  }
+  Vertex* vertices = csg->_arena->allocate(indexCount);
+  polygons.reserve(indexCount / 3);
+
   unsigned int sm = 0;
   for (auto& subMesh : mesh->subMeshes) {
     for (size_t i  = subMesh->indexStart,
                 il = subMesh->indexCount + subMesh->indexStart;
-         i < il; i += 3) {
-      std::vector<Vertex*> vertices;
+         i + 2 < il; i += 3) {
       for (unsigned int j = 0; j < 3; ++j) {
-        Vector3 sourceNormal(normals[indices[i + j] * 3],
-                             normals[indices[i + j] * 3 + 1],
-                             normals[indices[i + j] * 3 + 2]);
-        Vector2 _uv(uvs[indices[i + j] * 2], uvs[indices[i + j] * 2 + 1]);
-        Vector3 sourcePosition(positions[indices[i + j] * 3],
-                               positions[indices[i + j] * 3 + 1],
-                               positions[indices[i + j] * 3 + 2]);
-        position = Vector3::TransformCoordinates(sourcePosition, matrix);
-        normal   = Vector3::TransformNormal(sourceNormal, matrix);
-
-        vertices.emplace_back(new Vertex(position, normal, _uv));
+        const size_t index = indices[i + j];
+        Vector3 sourceNormal(normals[index * 3], normals[index * 3 + 1],
+                             normals[index * 3 + 2]);
+        if (!uvs.empty()) {
+          uv.copyFromFloats(uvs[index * 2], uvs[index * 2 + 1]);
+        }
+        Vector3 sourcePosition(positions[index * 3], positions[index * 3 + 1],
+                               positions[index * 3 + 2]);
+        vertices[j]
+          = Vertex(Vector3::TransformCoordinates(sourcePosition, matrix),
+                   Vector3::TransformNormal(sourceNormal, matrix), uv);
       }
 
       PolygonOptions shared;
@@ -74,173 +76,242 @@ CSG::CSG* CSG::CSG::FromMesh(Mesh* mesh)
       shared.meshId        = currentCSGMeshId;
       shared.materialIndex = subMesh->materialIndex;
 
-      Polygon* polygon = new Polygon(vertices, shared);
+      Polygon polygon(vertices, 3, shared);
+      vertices += 3;
 
       // To handle the case of degenerated triangle
       // polygon.plane == null <=> the polygon does not represent 1 single plane
       // <=> the triangle is degenerated
-      if (polygon->hasPlane()) {
-        polygons.emplace_back(polygon);
+      if (polygon.hasPlane()) {
+        polygons.emplace_back(std::move(polygon));
       }
     }
     ++sm;
   }
 
-  CSG* csg = CSG::FromPolygons(polygons);
-  /*csg->matrix             = matrix;
-  csg->position           = meshPosition;
-  csg->rotation           = meshRotation.cloneToNewObject();
-  csg->scaling            = meshScaling;
-  csg->rotationQuaternion = meshRotationQuaternion.cloneToNewObject();*/
+  csg->_polygons = std::move(polygons);
+  csg->matrix    = matrix;
+  csg->position  = mesh->position();
+  csg->rotation  = mesh->rotation();
+  csg->scaling   = mesh->scaling();
+  if (mesh->rotationQuaternionSet()) {
+    csg->rotationQuaternion
+      = std::make_unique<Quaternion>(mesh->rotationQuaternion());
+  }
   ++currentCSGMeshId;
 
   return csg;
 }
 
-BABYLON::CSG::CSG*
-CSG::CSG::FromPolygons(const std::vector<BABYLON::CSG::Polygon*>& _polygons)
+void CSG::CSG::_setPolygons(const std::vector<Polygon>& polygons)
+{
+  // Compact the polygons in a new arena, the previous one might hold the
+  // polygons themselves
+  auto arena = std::make_unique<VertexArena>();
+  _polygons  = arena->clone(polygons);
+  _arena     = std::move(arena);
+}
+
+std::vector<CSG::Polygon> CSG::CSG::_clonePolygons(VertexArena& arena) const
+{
+  // The BSP trees flip the polygons in place, they work on copies
+  return arena.clone(_polygons);
+}
+
+std::unique_ptr<CSG::CSG> CSG::CSG::clone() const
 {
-  BABYLON::CSG::CSG* csg = new BABYLON::CSG::CSG();
-  csg->_polygons         = _polygons;
+  auto csg = std::make_unique<CSG>();
+  csg->_setPolygons(_polygons);
+  csg->copyTransformAttributes(*this);
   return csg;
 }
 
-CSG::CSG* CSG::CSG::clone()
+MinMax CSG::CSG::getBounds() const
 {
-  CSG* csg = new CSG();
-  for (auto& p : _polygons) {
-    csg->_polygons.emplace_back(p->cloneToNewObject());
+  MinMax bounds{Vector3(std::numeric_limits<float>::max(),
+                        std::numeric_limits<float>::max(),
+                        std::numeric_limits<float>::max()),
+                Vector3(std::numeric_limits<float>::lowest(),
+                        std::numeric_limits<float>::lowest(),
+                        std::numeric_limits<float>::lowest())};
+  for (auto& polygon : _polygons) {
+    for (size_t i = 0; i < polygon.vertexCount; ++i) {
+      bounds.min.minimizeInPlace(polygon.vertices[i].pos);
+      bounds.max.maximizeInPlace(polygon.vertices[i].pos);
+    }
   }
-  csg->copyTransformAttributes(this);
-  return csg;
+  return bounds;
 }
 
-std::vector<CSG::Polygon*>& CSG::CSG::toPolygons()
+void CSG::CSG::_Apply(const BABYLON::CSG::CSG& a, const BABYLON::CSG::CSG& b,
+                      Operation operation, BABYLON::CSG::CSG& result)
 {
-  return _polygons;
+  const auto boundsA = a.getBounds();
+  const auto boundsB = b.getBounds();
+  const bool overlap
+    = !(boundsA.max.x < boundsB.min.x - Plane::EPSILON
+        || boundsA.max.y < boundsB.min.y - Plane::EPSILON
+        || boundsA.max.z < boundsB.min.z - Plane::EPSILON
+        || boundsA.min.x > boundsB.max.x + Plane::EPSILON
+        || boundsA.min.y > boundsB.max.y + Plane::EPSILON
+        || boundsA.min.z > boundsB.max.z + Plane::EPSILON);
+
+  // Disjoint solids do not clip each other
+  if (!overlap || a._polygons.empty() || b._polygons.empty()) {
+    std::vector<Polygon> polygons;
+    switch (operation) {
+      case Operation::Union:
+        polygons = a._polygons;
+        stl_util::concat(polygons, b._polygons);
+        break;
+      case Operation::Subtract:
+        polygons = a._polygons;
+        break;
+      case Operation::Intersect:
+        break;
+    }
+    result._setPolygons(polygons);
+    return;
+  }
+
+  VertexArena arena;
+  Node nodeA(&arena, a._clonePolygons(arena));
+  Node nodeB(&arena, b._clonePolygons(arena));
+  switch (operation) {
+    case Operation::Union:
+      nodeA.clipTo(nodeB);
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeA.build(nodeB.allPolygons());
+      break;
+    case Operation::Subtract:
+      nodeA.invert();
+      nodeA.clipTo(nodeB);
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeA.build(nodeB.allPolygons());
+      nodeA.invert();
+      break;
+    case Operation::Intersect:
+      nodeA.invert();
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeA.clipTo(nodeB);
+      nodeB.clipTo(nodeA);
+      nodeA.build(nodeB.allPolygons());
+      nodeA.invert();
+      break;
+  }
+  result._setPolygons(nodeA.allPolygons());
 }
 
-CSG::CSG* CSG::CSG::_union(BABYLON::CSG::CSG* csg)
+std::unique_ptr<CSG::CSG> CSG::CSG::_union(const BABYLON::CSG::CSG& csg) const
 {
-  Node* a = new Node(clone()->_polygons);
-  Node* b = new Node(csg->clone()->_polygons);
-  a->clipTo(b);
-  b->clipTo(a);
-  b->invert();
-  b->clipTo(a);
-  b->invert();
-  std::vector<BABYLON::CSG::Polygon*> allPolygonsB = b->allPolygons();
-  a->build(allPolygonsB);
-  return CSG::FromPolygons(a->allPolygons())->copyTransformAttributes(this);
+  auto result = std::make_unique<CSG>();
+  _Apply(*this, csg, Operation::Union, *result);
+  result->copyTransformAttributes(*this);
+  return result;
 }
 
-void CSG::CSG::unionInPlace(BABYLON::CSG::CSG* csg)
+void CSG::CSG::unionInPlace(const BABYLON::CSG::CSG& csg)
 {
-  Node* a = new Node(_polygons);
-  Node* b = new Node(csg->_polygons);
-
-  a->clipTo(b);
-  b->clipTo(a);
-  b->invert();
-  b->clipTo(a);
-  b->invert();
-  std::vector<BABYLON::CSG::Polygon*> allPolygonsB = b->allPolygons();
-  a->build(allPolygonsB);
-
-  _polygons = a->allPolygons();
+  _Apply(*this, csg, Operation::Union, *this);
 }
 
-CSG::CSG* CSG::CSG::subtract(BABYLON::CSG::CSG* csg)
+std::unique_ptr<CSG::CSG>
+CSG::CSG::subtract(const BABYLON::CSG::CSG& csg) const
 {
-  Node* a = new Node(clone()->_polygons);
-  Node* b = new Node(csg->clone()->_polygons);
-  a->invert();
-  a->clipTo(b);
-  b->clipTo(a);
-  b->invert();
-  b->clipTo(a);
-  b->invert();
-  std::vector<BABYLON::CSG::Polygon*> allPolygonsB = b->allPolygons();
-  a->build(allPolygonsB);
-  a->invert();
-  return CSG::FromPolygons(a->allPolygons())->copyTransformAttributes(this);
+  auto result = std::make_unique<CSG>();
+  _Apply(*this, csg, Operation::Subtract, *result);
+  result->copyTransformAttributes(*this);
+  return result;
 }
 
-void CSG::CSG::subtractInPlace(BABYLON::CSG::CSG* csg)
+void CSG::CSG::subtractInPlace(const BABYLON::CSG::CSG& csg)
 {
-  Node* a = new Node(_polygons);
-  Node* b = new Node(csg->_polygons);
-
-  a->invert();
-  a->clipTo(b);
-  b->clipTo(a);
-  b->invert();
-  b->clipTo(a);
-  b->invert();
-  std::vector<BABYLON::CSG::Polygon*> allPolygonsB = b->allPolygons();
-  a->build(allPolygonsB);
-  a->invert();
-
-  _polygons = a->allPolygons();
+  _Apply(*this, csg, Operation::Subtract, *this);
 }
 
-CSG::CSG* CSG::CSG::intersect(BABYLON::CSG::CSG* csg)
+std::unique_ptr<CSG::CSG>
+CSG::CSG::intersect(const BABYLON::CSG::CSG& csg) const
 {
-  Node* a = new Node(clone()->_polygons);
-  Node* b = new Node(csg->clone()->_polygons);
-  a->invert();
-  b->clipTo(a);
-  b->invert();
-  a->clipTo(b);
-  b->clipTo(a);
-  std::vector<BABYLON::CSG::Polygon*> allPolygonsB = b->allPolygons();
-  a->build(allPolygonsB);
-  a->invert();
-  return CSG::FromPolygons(a->allPolygons())->copyTransformAttributes(this);
+  auto result = std::make_unique<CSG>();
+  _Apply(*this, csg, Operation::Intersect, *result);
+  result->copyTransformAttributes(*this);
+  return result;
 }
 
-void CSG::CSG::intersectInPlace(BABYLON::CSG::CSG* csg)
+void CSG::CSG::intersectInPlace(const BABYLON::CSG::CSG& csg)
 {
-  Node* a = new Node(_polygons);
-  Node* b = new Node(csg->_polygons);
-
-  a->invert();
-  b->clipTo(a);
-  b->invert();
-  a->clipTo(b);
-  b->clipTo(a);
-  std::vector<BABYLON::CSG::Polygon*> allPolygonsB = b->allPolygons();
-  a->build(allPolygonsB);
-  a->invert();
-
-  _polygons = a->allPolygons();
+  _Apply(*this, csg, Operation::Intersect, *this);
 }
 
-CSG::CSG* CSG::CSG::inverse()
+std::unique_ptr<CSG::CSG> CSG::CSG::inverse() const
 {
-  BABYLON::CSG::CSG* csg = clone();
+  auto csg = clone();
   csg->inverseInPlace();
   return csg;
 }
 
 void CSG::CSG::inverseInPlace()
 {
+  // The polygons of the solid reference disjoint ranges of the arena
   for (auto& p : _polygons) {
-    p->flip();
+    p.flip();
   }
 }
 
-CSG::CSG* CSG::CSG::copyTransformAttributes(BABYLON::CSG::CSG* csg)
+CSG::CSG& CSG::CSG::copyTransformAttributes(const BABYLON::CSG::CSG& csg)
 {
-  matrix             = csg->matrix;
-  position           = csg->position;
-  rotation           = csg->rotation;
-  scaling            = csg->scaling;
-  rotationQuaternion = csg->rotationQuaternion;
+  matrix   = csg.matrix;
+  position = csg.position;
+  rotation = csg.rotation;
+  scaling  = csg.scaling;
+  rotationQuaternion
+    = csg.rotationQuaternion ?
+        std::make_unique<Quaternion>(*csg.rotationQuaternion) :
+        nullptr;
+
+  return *this;
+}
+
+namespace {
 
-  return this;
+// Key of the vertex deduplication: bit pattern of the local position
+struct VertexKey {
+  std::array<uint32_t, 3> bits;
+  bool operator==(const VertexKey& other) const
+  {
+    return bits == other.bits;
+  }
+}; // end of struct VertexKey
+
+struct VertexKeyHash {
+  size_t operator()(const VertexKey& key) const
+  {
+    size_t hash = key.bits[0];
+    hash        = hash * 31 + key.bits[1];
+    hash        = hash * 31 + key.bits[2];
+    return hash;
+  }
+}; // end of struct VertexKeyHash
+
+VertexKey MakeVertexKey(const Vector3& position)
+{
+  // +0.0 and -0.0 must share the same key
+  VertexKey key;
+  const std::array<float, 3> values{
+    {position.x + 0.f, position.y + 0.f, position.z + 0.f}};
+  std::memcpy(key.bits.data(), values.data(), sizeof(key.bits));
+  return key;
 }
 
+} // end of anonymous namespace
+
 Mesh* CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene,
                                   bool keepSubMeshes)
 {
@@ -250,80 +321,69 @@ Mesh* CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene,
   using SubMeshObj = std::array<unsigned int, 3>;
 
   auto mesh = Mesh::New(name, scene);
-  Float32Array vertices;
-  Uint32Array indices;
-  Float32Array normals;
-  Float32Array uvs;
-  Vector3 vertex                 = Vector3::Zero();
-  Vector3 normal                 = Vector3::Zero();
-  Vector2 uv                     = Vector2::Zero();
-  std::vector<Polygon*> polygons = _polygons;
-  std::array<unsigned int, 3> polygonIndices{{0, 0, 0}};
-  std::unordered_map<std::string, size_t> vertice_dict;
-  bool vertexIdxDefined     = false;
-  size_t vertex_idx         = 0;
+  Vector3 localVertex;
+  Vector3 localNormal;
+  std::vector<Polygon> polygons = _polygons;
+  std::unordered_map<VertexKey, size_t, VertexKeyHash> vertice_dict;
   unsigned int currentIndex = 0;
-  std::unordered_map<unsigned int, std::unordered_map<unsigned int, SubMeshObj>>
-    subMesh_dict;
-  SubMeshObj subMesh_obj;
+  std::map<unsigned int, std::map<unsigned int, SubMeshObj>> subMesh_dict;
 
   if (keepSubMeshes) {
     // Sort Polygons, since subMeshes are indices range
     std::sort(polygons.begin(), polygons.end(),
-              [](const Polygon* a, const Polygon* b) {
-                if (a->shared.meshId == b->shared.meshId) {
-                  return a->shared.subMeshId - b->shared.subMeshId;
+              [](const Polygon& a, const Polygon& b) {
+                if (a.shared.meshId == b.shared.meshId) {
+                  return a.shared.subMeshId < b.shared.subMeshId;
                 }
                 else {
-                  return a->shared.meshId - b->shared.meshId;
+                  return a.shared.meshId < b.shared.meshId;
                 }
               });
   }
 
+  // The vertex data is written directly in preallocated arrays
+  size_t indexCount = 0;
+  for (auto& polygon : polygons) {
+    indexCount += (polygon.vertexCount - 2) * 3;
+  }
+  VertexData vertexData;
+  auto& vertices = vertexData.positions;
+  auto& normals  = vertexData.normals;
+  auto& uvs      = vertexData.uvs;
+  auto& indices  = vertexData.indices;
+  vertices.reserve(indexCount * 3);
+  normals.reserve(indexCount * 3);
+  uvs.reserve(indexCount * 2);
+  indices.reserve(indexCount);
+  vertice_dict.reserve(indexCount);
+
   for (auto& polygon : polygons) {
     // Building SubMeshes
-    if (subMesh_dict.find(polygon->shared.meshId) == subMesh_dict.end()) {
-      subMesh_dict[polygon->shared.meshId]
-        = std::unordered_map<unsigned int, SubMeshObj>();
+    auto& subMeshes = subMesh_dict[polygon.shared.meshId];
+    if (subMeshes.find(polygon.shared.subMeshId) == subMeshes.end()) {
+      // IndexStart, IndexEnd, materialIndex
+      subMeshes[polygon.shared.subMeshId]
+        = {{std::numeric_limits<unsigned int>::max(),
+            std::numeric_limits<unsigned int>::min(),
+            polygon.shared.materialIndex}};
     }
-    if (subMesh_dict[polygon->shared.meshId].find(polygon->shared.subMeshId)
-        == subMesh_dict[polygon->shared.meshId].end()) {
-      // IndexStart
-      subMesh_dict[polygon->shared.meshId][polygon->shared.subMeshId][0]
-        = std::numeric_limits<unsigned int>::max();
-      // IndexEnd
-      subMesh_dict[polygon->shared.meshId][polygon->shared.subMeshId][1]
-        = std::numeric_limits<unsigned int>::min();
-      // materialIndex
-      subMesh_dict[polygon->shared.meshId][polygon->shared.subMeshId][2]
-        = polygon->shared.materialIndex;
-    }
-    subMesh_obj
-      = subMesh_dict[polygon->shared.meshId][polygon->shared.subMeshId];
-
-    for (unsigned int j = 2; j < polygon->vertices.size(); ++j) {
+    auto& subMesh_obj = subMeshes[polygon.shared.subMeshId];
 
-      polygonIndices[0] = 0;
-      polygonIndices[1] = j - 1;
-      polygonIndices[2] = j;
+    for (size_t j = 2; j < polygon.vertexCount; ++j) {
+      const std::array<size_t, 3> polygonIndices{{0, j - 1, j}};
 
       for (unsigned int k = 0; k < 3; ++k) {
-        vertex.copyFrom(polygon->vertices[polygonIndices[k]]->pos);
-        normal.copyFrom(polygon->vertices[polygonIndices[k]]->normal);
-        uv.copyFrom(polygon->vertices[polygonIndices[k]]->uv);
-        Vector3 localVertex = Vector3::TransformCoordinates(vertex, matrix);
-        Vector3 localNormal = Vector3::TransformNormal(normal, matrix);
-
-        std::string vertexId = String::concat(localVertex.x, ",", localVertex.y,
-                                              ",", localVertex.z);
-
-        if (stl_util::contains(vertice_dict, vertexId)) {
-          vertex_idx       = vertice_dict[vertexId];
-          vertexIdxDefined = true;
-        }
+        const Vertex& vertex = polygon.vertices[polygonIndices[k]];
+        const Vector2& uv    = vertex.uv;
+        Vector3::TransformCoordinatesToRef(vertex.pos, _matrix, localVertex);
+        Vector3::TransformNormalToRef(vertex.normal, _matrix, localNormal);
+
+        const auto vertexId = MakeVertexKey(localVertex);
+        auto it             = vertice_dict.find(vertexId);
+        size_t vertex_idx   = (it != vertice_dict.end()) ? it->second : 0;
 
         // Check if 2 points can be merged
-        if (!(vertexIdxDefined
+        if (!(it != vertice_dict.end()
               && stl_util::almost_equal(normals[vertex_idx * 3], localNormal.x)
               && stl_util::almost_equal(normals[vertex_idx * 3 + 1],
                                         localNormal.y)
@@ -334,28 +394,23 @@ Mesh* CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene,
           stl_util::concat(vertices,
                            {localVertex.x, localVertex.y, localVertex.z});
           stl_util::concat(uvs, {uv.x, uv.y});
-          stl_util::concat(normals, {normal.x, normal.y, normal.z});
+          stl_util::concat(normals,
+                           {localNormal.x, localNormal.y, localNormal.z});
           vertex_idx             = (vertices.size() / 3) - 1;
           vertice_dict[vertexId] = vertex_idx;
-          vertexIdxDefined       = true;
         }
 
-        indices.emplace_back(vertex_idx);
+        indices.emplace_back(static_cast<uint32_t>(vertex_idx));
 
         // indexStart
         subMesh_obj[0] = std::min(currentIndex, subMesh_obj[0]);
         subMesh_obj[1] = std::max(currentIndex, subMesh_obj[1]);
-        subMesh_dict[polygon->shared.meshId][polygon->shared.subMeshId]
-          = subMesh_obj;
         ++currentIndex;
       }
     }
   }
 
-  mesh->setVerticesData(VertexBuffer::PositionKind, vertices);
-  mesh->setVerticesData(VertexBuffer::NormalKind, normals);
-  mesh->setVerticesData(VertexBuffer::UVKind, uvs);
-  mesh->setIndices(indices);
+  vertexData.applyToMesh(mesh);
 
   if (keepSubMeshes) {
     // We offset the materialIndex by the previous number of materials in the
@@ -368,7 +423,7 @@ Mesh* CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene,
     for (auto& m : subMesh_dict) {
       materialMaxIndex = -1;
       for (auto& sm : m.second) {
-        subMesh_obj = sm.second;
+        const auto& subMesh_obj = sm.second;
         SubMesh::CreateFromIndices(subMesh_obj[2] + materialIndexOffset,
                                    subMesh_obj[0],
                                    subMesh_obj[1] - subMesh_obj[0] + 1, mesh);
@@ -389,10 +444,10 @@ Mesh* CSG::CSG::toMesh(const std::string& name, Material* material,
 
   mesh->setMaterial(material);
 
-  // mesh->position->copyFrom(position);
-  mesh->rotation().copyFrom(*rotation);
+  mesh->position().copyFrom(position);
+  mesh->rotation().copyFrom(rotation);
   if (rotationQuaternion) {
-    // mesh->setRotationQuaternion(rotationQuaternion->cloneToNewObject());
+    mesh->setRotationQuaternion(*rotationQuaternion);
   }
   mesh->scaling().copyFrom(scaling);
   mesh->computeWorldMatrix(true);
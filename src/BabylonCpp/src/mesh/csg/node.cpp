@@ -1,123 +1,286 @@
 #include <babylon/mesh/csg/node.h>
 
 #include <babylon/babylon_stl_util.h>
-#include <babylon/mesh/csg/polygon.h>
+#include <babylon/mesh/csg/vertex.h>
+#include <babylon/mesh/csg/vertex_arena.h>
 
 namespace BABYLON {
 
-CSG::Node::Node() : _plane{nullptr}, _front{nullptr}, _back{nullptr}
+constexpr size_t CSG::Node::ParallelThreshold;
+
+std::atomic<unsigned int> CSG::Node::_ActiveTasks{0};
+
+CSG::Node::Node(VertexArena* arena)
+    : _arena{arena}
+    , _hasPlane{false}
+    , _inverted{false}
+    , _bounds{Vector3(std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::max()),
+              Vector3(std::numeric_limits<float>::lowest(),
+                      std::numeric_limits<float>::lowest(),
+                      std::numeric_limits<float>::lowest())}
+    , _front{nullptr}
+    , _back{nullptr}
 {
 }
 
-CSG::Node::Node(const std::vector<BABYLON::CSG::Polygon*>& polygons)
-    : _plane{nullptr}, _front{nullptr}, _back{nullptr}
+CSG::Node::Node(VertexArena* arena,
+                std::vector<BABYLON::CSG::Polygon>&& polygons)
+    : Node(arena)
 {
   if (!polygons.empty()) {
-    build(polygons);
+    build(std::move(polygons));
   }
 }
 
 CSG::Node::~Node()
 {
+  // The BSP trees of convex solids are degenerated lists, release the
+  // subtrees iteratively to not overflow the stack
+  std::vector<std::unique_ptr<Node>> stack;
+  stack.emplace_back(std::move(_front));
+  stack.emplace_back(std::move(_back));
+  while (!stack.empty()) {
+    auto node = std::move(stack.back());
+    stack.pop_back();
+    if (node) {
+      stack.emplace_back(std::move(node->_front));
+      stack.emplace_back(std::move(node->_back));
+    }
+  }
 }
 
-CSG::Node* CSG::Node::clone()
+const MinMax& CSG::Node::bounds() const
 {
-  Node* node      = new Node();
-  node->_plane    = _plane ? _plane->cloneToNewObject() : nullptr;
-  node->_front    = _front ? _front->clone() : nullptr;
-  node->_back     = _back ? _back->clone() : nullptr;
-  node->_polygons = _polygons;
-  return node;
+  return _bounds;
 }
 
-void CSG::Node::invert()
+std::vector<CSG::Node*> CSG::Node::_collectNodes()
 {
-  for (auto& polygon : _polygons) {
-    polygon->flip();
-  }
-  if (_plane) {
-    _plane->flip();
-  }
-  if (_front) {
-    _front->invert();
-  }
-  if (_back) {
-    _back->invert();
+  std::vector<Node*> nodes{this};
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    if (nodes[i]->_front) {
+      nodes.emplace_back(nodes[i]->_front.get());
+    }
+    if (nodes[i]->_back) {
+      nodes.emplace_back(nodes[i]->_back.get());
+    }
   }
-  std::swap(_front, _back);
+  return nodes;
 }
 
-std::vector<CSG::Polygon*>
-CSG::Node::clipPolygons(const std::vector<BABYLON::CSG::Polygon*>& polygons)
+void CSG::Node::invert()
 {
-  if (!_plane) {
-    return polygons;
-  }
-  std::vector<Polygon *> front, back;
-  for (auto& polygon : polygons) {
-    _plane->splitPolygon(polygon, front, back, front, back);
+  for (auto& node : _collectNodes()) {
+    for (auto& polygon : node->_polygons) {
+      polygon.flip();
+    }
+    if (node->_hasPlane) {
+      node->_plane.flip();
+    }
+    std::swap(node->_front, node->_back);
+    node->_inverted = !node->_inverted;
   }
-  if (_front) {
-    front = _front->clipPolygons(front);
+}
+
+std::vector<CSG::Polygon>
+CSG::Node::clipPolygons(std::vector<BABYLON::CSG::Polygon>&& polygons) const
+{
+  return _clipPolygons(std::move(polygons), *_arena);
+}
+
+std::vector<CSG::Polygon>
+CSG::Node::_clipPolygons(std::vector<BABYLON::CSG::Polygon>&& polygons,
+                         VertexArena& arena) const
+{
+  if (!_hasPlane) {
+    return std::move(polygons);
   }
-  if (_back) {
-    back = _back->clipPolygons(back);
+
+  std::vector<Polygon> result;
+  std::vector<std::pair<const Node*, std::vector<Polygon>>> stack;
+  stack.emplace_back(this, std::move(polygons));
+  while (!stack.empty()) {
+    auto item = std::move(stack.back());
+    stack.pop_back();
+    const Node* node = item.first;
+    std::vector<Polygon> front, back;
+    for (auto& polygon : item.second) {
+      node->_plane.splitPolygon(polygon, front, back, front, back, arena);
+    }
+    if (node->_front) {
+      if (!front.empty()) {
+        stack.emplace_back(node->_front.get(), std::move(front));
+      }
+    }
+    else {
+      stl_util::concat(result, front);
+    }
+    // Polygons in back of a node without back subtree are inside the solid
+    if (node->_back && !back.empty()) {
+      stack.emplace_back(node->_back.get(), std::move(back));
+    }
   }
-  else {
-    back.clear();
+  return result;
+}
+
+bool CSG::Node::_isOutsideBounds(const Polygon& polygon) const
+{
+  Vector3 min = polygon.vertices[0].pos;
+  Vector3 max = polygon.vertices[0].pos;
+  for (size_t i = 1; i < polygon.vertexCount; ++i) {
+    min.minimizeInPlace(polygon.vertices[i].pos);
+    max.maximizeInPlace(polygon.vertices[i].pos);
   }
-  stl_util::concat(front, back);
-  return front;
+  return (max.x < _bounds.min.x - Plane::EPSILON)
+         || (max.y < _bounds.min.y - Plane::EPSILON)
+         || (max.z < _bounds.min.z - Plane::EPSILON)
+         || (min.x > _bounds.max.x + Plane::EPSILON)
+         || (min.y > _bounds.max.y + Plane::EPSILON)
+         || (min.z > _bounds.max.z + Plane::EPSILON);
 }
 
-void BABYLON::CSG::Node::clipTo(BABYLON::CSG::Node* bsp)
+void BABYLON::CSG::Node::clipTo(const BABYLON::CSG::Node& bsp)
 {
-  _polygons = bsp->clipPolygons(_polygons);
-  if (_front) {
-    _front->clipTo(bsp);
+  const auto nodes = _collectNodes();
+
+  const auto clipNode = [&bsp](Node* node, VertexArena& arena) {
+    if (!bsp._hasPlane) {
+      return;
+    }
+    // The polygons outside the bounds of the solid are kept as is, unless the
+    // solid is inverted, in which case they are inside of it
+    std::vector<Polygon> kept, candidates;
+    for (auto& polygon : node->_polygons) {
+      if (!bsp._isOutsideBounds(polygon)) {
+        candidates.emplace_back(std::move(polygon));
+      }
+      else if (!bsp._inverted) {
+        kept.emplace_back(std::move(polygon));
+      }
+    }
+    node->_polygons = bsp._clipPolygons(std::move(candidates), arena);
+    stl_util::concat(node->_polygons, kept);
+  };
+
+  // Split the nodes in chunks processed in parallel
+  const unsigned int maxThreads
+    = std::max(1u, std::thread::hardware_concurrency());
+  const size_t chunkCount = std::min(
+    static_cast<size_t>(maxThreads), nodes.size() / ParallelThreshold + 1);
+  const size_t chunkSize = (nodes.size() + chunkCount - 1) / chunkCount;
+
+  const auto processChunk = [&](size_t chunk, VertexArena* arena) {
+    const size_t end = std::min(nodes.size(), (chunk + 1) * chunkSize);
+    for (size_t i = chunk * chunkSize; i < end; ++i) {
+      clipNode(nodes[i], *arena);
+    }
+  };
+
+  // The first chunk is clipped by this thread in the arena of the tree, the
+  // other chunks in task arenas
+  std::vector<std::future<void>> workers;
+  for (size_t c = 1; c < chunkCount; ++c) {
+    workers.emplace_back(std::async(std::launch::async, processChunk, c,
+                                    &_arena->createTaskArena()));
   }
-  if (_back) {
-    _back->clipTo(bsp);
+  processChunk(0, _arena);
+  for (auto& worker : workers) {
+    worker.get();
   }
 }
 
-std::vector<BABYLON::CSG::Polygon*> BABYLON::CSG::Node::allPolygons()
+std::vector<BABYLON::CSG::Polygon> BABYLON::CSG::Node::allPolygons() const
 {
-  std::vector<Polygon*> polygons = _polygons;
-  if (_front) {
-    polygons = stl_util::concat(polygons, _front->allPolygons());
-  }
-  if (_back) {
-    polygons = stl_util::concat(polygons, _back->allPolygons());
+  std::vector<Polygon> polygons;
+  std::vector<const Node*> stack{this};
+  while (!stack.empty()) {
+    const Node* node = stack.back();
+    stack.pop_back();
+    stl_util::concat(polygons, node->_polygons);
+    if (node->_back) {
+      stack.emplace_back(node->_back.get());
+    }
+    if (node->_front) {
+      stack.emplace_back(node->_front.get());
+    }
   }
   return polygons;
 }
 
-void BABYLON::CSG::Node::build(
-  const std::vector<BABYLON::CSG::Polygon*>& polygons)
+void BABYLON::CSG::Node::build(std::vector<BABYLON::CSG::Polygon>&& polygons)
 {
   if (polygons.empty()) {
     return;
   }
-  if (!_plane) {
-    _plane = polygons[0]->plane.cloneToNewObject();
-  }
-  std::vector<Polygon *> front, back;
   for (auto& polygon : polygons) {
-    _plane->splitPolygon(polygon, _polygons, _polygons, front, back);
-  }
-  if (!front.empty()) {
-    if (!_front) {
-      _front = new Node();
+    for (size_t i = 0; i < polygon.vertexCount; ++i) {
+      _bounds.min.minimizeInPlace(polygon.vertices[i].pos);
+      _bounds.max.maximizeInPlace(polygon.vertices[i].pos);
     }
-    _front->build(front);
   }
-  if (!back.empty()) {
-    if (!_back) {
-      _back = new Node();
+  _Build(this, std::move(polygons), *_arena);
+}
+
+void BABYLON::CSG::Node::_Build(BABYLON::CSG::Node* root,
+                                std::vector<BABYLON::CSG::Polygon>&& polygons,
+                                BABYLON::CSG::VertexArena& arena)
+{
+  const unsigned int maxTasks
+    = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+  std::vector<std::future<void>> tasks;
+  std::vector<std::pair<Node*, std::vector<Polygon>>> stack;
+  stack.emplace_back(root, std::move(polygons));
+  while (!stack.empty()) {
+    auto item = std::move(stack.back());
+    stack.pop_back();
+    Node* node = item.first;
+    if (!node->_hasPlane) {
+      node->_plane    = item.second[0].plane;
+      node->_hasPlane = true;
+    }
+    std::vector<Polygon> front, back;
+    for (auto& polygon : item.second) {
+      node->_plane.splitPolygon(polygon, node->_polygons, node->_polygons,
+                                front, back, arena);
+    }
+    if (!front.empty() && !node->_front) {
+      node->_front = std::make_unique<Node>(node->_arena);
     }
-    _back->build(back);
+    if (!back.empty() && !node->_back) {
+      node->_back = std::make_unique<Node>(node->_arena);
+    }
+    // Subtrees are disjoint, the front subtree of a large node is built by
+    // another task while the back subtree is built by this one
+    bool spawnTask = false;
+    if (front.size() >= ParallelThreshold && back.size() >= ParallelThreshold) {
+      spawnTask = (_ActiveTasks.fetch_add(1) < maxTasks);
+      if (!spawnTask) {
+        --_ActiveTasks;
+      }
+    }
+    if (spawnTask) {
+      Node* frontNode        = node->_front.get();
+      VertexArena* taskArena = &node->_arena->createTaskArena();
+      tasks.emplace_back(std::async(
+        std::launch::async,
+        [frontNode, taskArena](std::vector<Polygon>&& frontPolygons) {
+          _Build(frontNode, std::move(frontPolygons), *taskArena);
+          --_ActiveTasks;
+        },
+        std::move(front)));
+    }
+    else if (!front.empty()) {
+      stack.emplace_back(node->_front.get(), std::move(front));
+    }
+    if (!back.empty()) {
+      stack.emplace_back(node->_back.get(), std::move(back));
+    }
+  }
+  for (auto& task : tasks) {
+    task.get();
   }
 }
 
@@ -3,12 +3,13 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/mesh/csg/polygon.h>
 #include <babylon/mesh/csg/vertex.h>
+#include <babylon/mesh/csg/vertex_arena.h>
 
 namespace BABYLON {
 
 const float CSG::Plane::EPSILON = 1e-5f;
 
-CSG::Plane::Plane()
+CSG::Plane::Plane() : w{0.f}
 {
 }
 
@@ -83,31 +84,37 @@ void CSG::Plane::flip()
   w = -w;
 }
 
+unsigned int CSG::Plane::classifyPoint(const Vector3& point) const
+{
+  const float t = Vector3::Dot(normal, point) - w;
+  return (t < -Plane::EPSILON) ? BACK : (t > Plane::EPSILON) ? FRONT : COPLANAR;
+}
+
 void BABYLON::CSG::Plane::splitPolygon(
-  BABYLON::CSG::Polygon* polygon,
-  std::vector<BABYLON::CSG::Polygon*>& coplanarFront,
-  std::vector<BABYLON::CSG::Polygon*>& coplanarBack,
-  std::vector<BABYLON::CSG::Polygon*>& front,
-  std::vector<BABYLON::CSG::Polygon*>& back)
+  const BABYLON::CSG::Polygon& polygon,
+  std::vector<BABYLON::CSG::Polygon>& coplanarFront,
+  std::vector<BABYLON::CSG::Polygon>& coplanarBack,
+  std::vector<BABYLON::CSG::Polygon>& front,
+  std::vector<BABYLON::CSG::Polygon>& back,
+  BABYLON::CSG::VertexArena& arena) const
 {
   // Classify each point as well as the entire polygon into one of the above
-  // four classes.
-  int polygonType = 0;
-  Int32Array types;
-  for (unsigned int i = 0; i < polygon->vertices.size(); ++i) {
-    const float t = Vector3::Dot(normal, polygon->vertices[i]->pos) - w;
-    int type
-      = (t < -Plane::EPSILON) ? BACK : (t > Plane::EPSILON) ? FRONT : COPLANAR;
-    polygonType |= type;
-    types.emplace_back(type);
+  // four classes. The types buffer is reused by the calls of the same thread.
+  static thread_local std::vector<unsigned int> types;
+  const size_t vertexCount = polygon.vertexCount;
+  unsigned int polygonType = 0;
+  types.resize(vertexCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    types[i] = classifyPoint(polygon.vertices[i].pos);
+    polygonType |= types[i];
   }
 
   // Put the polygon in the correct list, splitting it when necessary.
   switch (polygonType) {
     case COPLANAR:
     default:
-      (Vector3::Dot(normal, polygon->plane.normal) > 0 ? coplanarFront :
-                                                         coplanarBack)
+      (Vector3::Dot(normal, polygon.plane.normal) > 0 ? coplanarFront :
+                                                        coplanarBack)
         .emplace_back(polygon);
       break;
     case FRONT:
@@ -116,43 +123,58 @@ void BABYLON::CSG::Plane::splitPolygon(
     case BACK:
       back.emplace_back(polygon);
       break;
-    case SPANNING:
-      std::vector<BABYLON::CSG::Vertex *> f, b;
-      for (size_t i = 0; i < polygon->vertices.size(); ++i) {
-        size_t j = (i + 1) % polygon->vertices.size();
-        int ti = types[i], tj = types[j];
-        Vertex *vi = polygon->vertices[i], *vj = polygon->vertices[j];
+    case SPANNING: {
+      // Count the vertices of both fragments first so that both fragments are
+      // allocated with a single contiguous range of the arena
+      size_t frontCount = 0, backCount = 0;
+      for (size_t i = 0; i < vertexCount; ++i) {
+        const unsigned int ti = types[i], tj = types[(i + 1) % vertexCount];
+        frontCount += (ti != BACK) ? 1 : 0;
+        backCount += (ti != FRONT) ? 1 : 0;
+        if ((ti | tj) == SPANNING) {
+          ++frontCount;
+          ++backCount;
+        }
+      }
+      Vertex* f = arena.allocate(frontCount + backCount);
+      Vertex* b = f + frontCount;
+      size_t fi = 0, bi = 0;
+      for (size_t i = 0; i < vertexCount; ++i) {
+        size_t j = (i + 1) % vertexCount;
+        const unsigned int ti = types[i], tj = types[j];
+        const Vertex &vi = polygon.vertices[i], &vj = polygon.vertices[j];
         if (ti != BACK) {
-          f.emplace_back(vi);
+          f[fi++] = vi;
         }
         if (ti != FRONT) {
-          b.emplace_back(ti != BACK ? new Vertex(*vi) : vi);
+          b[bi++] = vi;
         }
-        if ((ti == SPANNING) || (tj == SPANNING)) {
-          float t = (w - Vector3::Dot(normal, vi->pos))
-                    / Vector3::Dot(normal, vj->pos.subtract(vi->pos));
-          BABYLON::CSG::Vertex v = vi->interpolate(*vj, t);
-          f.emplace_back(new BABYLON::CSG::Vertex(v));
-          b.emplace_back(new BABYLON::CSG::Vertex(v));
+        if ((ti | tj) == SPANNING) {
+          float t = (w - Vector3::Dot(normal, vi.pos))
+                    / Vector3::Dot(normal, vj.pos.subtract(vi.pos));
+          const Vertex v = vi.interpolate(vj, t);
+          f[fi++]        = v;
+          b[bi++]        = v;
         }
       }
-      if (f.size() >= 3) {
-        Polygon* poly = new Polygon(f, polygon->shared);
+      if (frontCount >= 3) {
+        Polygon poly(f, frontCount, polygon.shared);
 
-        if (poly->hasPlane()) {
-          front.emplace_back(poly);
+        if (poly.hasPlane()) {
+          front.emplace_back(std::move(poly));
         }
       }
 
-      if (b.size() >= 3) {
-        Polygon* poly = new Polygon(b, polygon->shared);
+      if (backCount >= 3) {
+        Polygon poly(b, backCount, polygon.shared);
 
-        if (poly->hasPlane()) {
-          back.emplace_back(poly);
+        if (poly.hasPlane()) {
+          back.emplace_back(std::move(poly));
         }
       }
 
       break;
+    }
   }
 }
 
@@ -168,7 +190,14 @@ CSG::Plane CSG::Plane::FromPoints(const Vector3& a, const Vector3& b,
     return Plane();
   }
 
-  const Vector3 n = Vector3::Normalize(Vector3::Cross(v0, v1));
+  // Collinear points
+  const Vector3 cross = Vector3::Cross(v0, v1);
+  if (stl_util::almost_equal(cross.lengthSquared(), 0.f)) {
+    hasPlane = false;
+    return Plane();
+  }
+
+  const Vector3 n = Vector3::Normalize(cross);
   return Plane(n, Vector3::Dot(n, a));
 }
 
@@ -1,35 +1,52 @@
 #include <babylon/mesh/csg/polygon.h>
 
 #include <babylon/mesh/csg/vertex.h>
+#include <babylon/mesh/csg/vertex_arena.h>
 
 namespace BABYLON {
 
-CSG::Polygon::Polygon(const std::vector<Vertex*>& _vertices,
+CSG::Polygon::Polygon()
+    : vertices{nullptr}, vertexCount{0}, shared{0, 0, 0}, _hasPlane{false}
+{
+}
+
+CSG::Polygon::Polygon(Vertex* _vertices, size_t _vertexCount,
                       const PolygonOptions& _shared)
-    : vertices{_vertices}, shared{_shared}, _hasPlane{true}
+    : vertices{_vertices}
+    , vertexCount{_vertexCount}
+    , shared{_shared}
+    , _hasPlane{true}
 {
-  plane = Plane::FromPoints(vertices[0]->pos, vertices[1]->pos,
-                            vertices[2]->pos, _hasPlane);
+  plane = Plane::FromPoints(vertices[0].pos, vertices[1].pos, vertices[2].pos,
+                            _hasPlane);
 }
 
 CSG::Polygon::Polygon(const BABYLON::CSG::Polygon& otherPolygon)
     : vertices{otherPolygon.vertices}
+    , vertexCount{otherPolygon.vertexCount}
     , shared{otherPolygon.shared}
     , plane{otherPolygon.plane}
+    , _hasPlane{otherPolygon._hasPlane}
 {
 }
 
 CSG::Polygon::Polygon(BABYLON::CSG::Polygon&& otherPolygon)
+    : vertices{otherPolygon.vertices}
+    , vertexCount{otherPolygon.vertexCount}
+    , shared{std::move(otherPolygon.shared)}
+    , plane{std::move(otherPolygon.plane)}
+    , _hasPlane{otherPolygon._hasPlane}
 {
-  *this = std::move(otherPolygon);
 }
 
 CSG::Polygon& CSG::Polygon::operator=(const BABYLON::CSG::Polygon& otherPolygon)
 {
   if (&otherPolygon != this) {
-    vertices = otherPolygon.vertices;
-    shared   = otherPolygon.shared;
-    plane    = otherPolygon.plane;
+    vertices    = otherPolygon.vertices;
+    vertexCount = otherPolygon.vertexCount;
+    shared      = otherPolygon.shared;
+    plane       = otherPolygon.plane;
+    _hasPlane   = otherPolygon._hasPlane;
   }
 
   return *this;
@@ -38,9 +55,11 @@ CSG::Polygon& CSG::Polygon::operator=(const BABYLON::CSG::Polygon& otherPolygon)
 CSG::Polygon& CSG::Polygon::operator=(BABYLON::CSG::Polygon&& otherPolygon)
 {
   if (&otherPolygon != this) {
-    vertices = std::move(otherPolygon.vertices);
-    shared   = std::move(otherPolygon.shared);
-    plane    = std::move(otherPolygon.plane);
+    vertices    = otherPolygon.vertices;
+    vertexCount = otherPolygon.vertexCount;
+    shared      = std::move(otherPolygon.shared);
+    plane       = std::move(otherPolygon.plane);
+    _hasPlane   = otherPolygon._hasPlane;
   }
 
   return *this;
@@ -55,20 +74,22 @@ CSG::Polygon CSG::Polygon::clone() const
   return Polygon(*this);
 }
 
-CSG::Polygon* CSG::Polygon::cloneToNewObject() const
+CSG::Polygon CSG::Polygon::clone(VertexArena& arena) const
 {
-  return new Polygon(*this);
+  Polygon polygon(*this);
+  polygon.vertices = arena.copy(vertices, vertexCount);
+  return polygon;
 }
 
 namespace CSG {
 std::ostream& operator<<(std::ostream& os, const Polygon& polygon)
 {
   os << "{\"Vertices\":[";
-  if (polygon.vertices.size() > 0) {
-    for (unsigned int i = 0; i < polygon.vertices.size() - 1; ++i) {
+  if (polygon.vertexCount > 0) {
+    for (size_t i = 0; i < polygon.vertexCount - 1; ++i) {
       os << polygon.vertices[i] << ",";
     }
-    os << polygon.vertices.back();
+    os << polygon.vertices[polygon.vertexCount - 1];
   }
   // os << "],\"Shared\":" << polygon.shared << ",\"Plane\":" << polygon.plane
   //   << "}";
@@ -85,9 +106,9 @@ std::string CSG::Polygon::toString() const
 
 void CSG::Polygon::flip()
 {
-  std::reverse(vertices.begin(), vertices.end());
-  for (auto& vertex : vertices) {
-    vertex->flip();
+  std::reverse(vertices, vertices + vertexCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    vertices[i].flip();
   }
   plane.flip();
 }
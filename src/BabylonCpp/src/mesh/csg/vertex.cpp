@@ -2,6 +2,10 @@
 
 namespace BABYLON {
 
+CSG::Vertex::Vertex()
+{
+}
+
 CSG::Vertex::Vertex(const Vector3& _pos, const Vector3& _normal,
                     const Vector2& _uv)
     : pos{_pos}, normal{_normal}, uv{_uv}
@@ -75,7 +79,8 @@ void CSG::Vertex::flip()
   normal = normal.scale(-1.f);
 }
 
-CSG::Vertex CSG::Vertex::interpolate(const BABYLON::CSG::Vertex& other, float t)
+CSG::Vertex CSG::Vertex::interpolate(const BABYLON::CSG::Vertex& other,
+                                      float t) const
 {
   return Vertex(Vector3::Lerp(pos, other.pos, t),
                 Vector3::Lerp(normal, other.normal, t),
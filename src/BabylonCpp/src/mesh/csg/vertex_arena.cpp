@@ -0,0 +1,86 @@
+#include <babylon/mesh/csg/vertex_arena.h>
+
+#include <babylon/mesh/csg/polygon.h>
+
+namespace BABYLON {
+
+constexpr size_t CSG::VertexArena::ChunkSize;
+
+CSG::VertexArena::VertexArena() : _size{0}
+{
+}
+
+CSG::VertexArena::~VertexArena()
+{
+}
+
+std::vector<CSG::Vertex>& CSG::VertexArena::_chunkFor(size_t count)
+{
+  if (_chunks.empty()
+      || _chunks.back().size() + count > _chunks.back().capacity()) {
+    _chunks.emplace_back(std::vector<Vertex>());
+    _chunks.back().reserve(std::max(VertexArena::ChunkSize, count));
+  }
+
+  // The chunk never grows past its capacity so the vertices never move
+  _size += count;
+  return _chunks.back();
+}
+
+CSG::Vertex* CSG::VertexArena::allocate(size_t count)
+{
+  auto& chunk       = _chunkFor(count);
+  const auto offset = chunk.size();
+  chunk.resize(offset + count);
+  return chunk.data() + offset;
+}
+
+CSG::Vertex* CSG::VertexArena::copy(const Vertex* vertices, size_t count)
+{
+  // Copy constructed in place, not default constructed then assigned
+  auto& chunk       = _chunkFor(count);
+  const auto offset = chunk.size();
+  chunk.insert(chunk.end(), vertices, vertices + count);
+  return chunk.data() + offset;
+}
+
+std::vector<CSG::Polygon>
+CSG::VertexArena::clone(const std::vector<Polygon>& polygons)
+{
+  size_t count = 0;
+  for (auto& polygon : polygons) {
+    count += polygon.vertexCount;
+  }
+
+  auto& chunk       = _chunkFor(count);
+  const auto offset = chunk.size();
+  for (auto& polygon : polygons) {
+    chunk.insert(chunk.end(), polygon.vertices,
+                 polygon.vertices + polygon.vertexCount);
+  }
+
+  // The copies reference consecutive ranges of the copied vertices
+  std::vector<Polygon> result;
+  result.reserve(polygons.size());
+  Vertex* vertices = chunk.data() + offset;
+  for (auto& polygon : polygons) {
+    result.emplace_back(polygon);
+    result.back().vertices = vertices;
+    vertices += polygon.vertexCount;
+  }
+  return result;
+}
+
+CSG::VertexArena& CSG::VertexArena::createTaskArena()
+{
+  std::lock_guard<std::mutex> lock(_taskArenasMutex);
+  _taskArenas.emplace_back(std::make_unique<VertexArena>());
+  return *_taskArenas.back();
+}
+
+size_t CSG::VertexArena::size() const
+{
+  return _size;
+}
+
+} // end of namespace BABYLON
@@ -7,6 +7,7 @@
 #include <babylon/engine/scene.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/materials/effect.h>
+#include <babylon/morph/morph_target_manager.h>
 #include <babylon/mesh/lines_mesh.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/sub_mesh.h>
@@ -23,6 +24,9 @@ Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
     , _scene{scene}
     , _engine{scene->getEngine()}
     , _totalVertices{0}
+    , _revision{0}
+    , _currentVertexArrayObject{nullptr}
+    , _currentVertexArrayObjectEffectId{0}
     , _isDisposed{false}
     , _extendSet{false}
     , _hasBoundingBias{false}
@@ -42,10 +46,6 @@ Geometry::Geometry(const std::string& iId, Scene* scene, VertexData* vertexData,
     _indices.clear();
   }
 
-  if (_engine->getCaps().vertexArrayObject) {
-    _vertexArrayObjects.clear();
-  }
-
   // applyToMesh
   if (mesh) {
     if (mesh->type() == IReflect::Type::LINESMESH) {
@@ -137,8 +137,11 @@ Mesh* Geometry::setVerticesData(unsigned int kind, const Float32Array& data,
 void Geometry::removeVerticesData(unsigned int kind)
 {
   if (stl_util::contains(_vertexBuffers, kind)) {
+    _disposeVertexArrayObjects();
     _vertexBuffers[kind]->dispose();
-    _vertexBuffers[kind].reset(nullptr);
+    _vertexBuffers.erase(kind);
+    _updateVertexBufferSlots();
+    ++_revision;
   }
 }
 
@@ -151,6 +154,7 @@ void Geometry::setVerticesBuffer(std::unique_ptr<VertexBuffer>&& buffer)
 
   _vertexBuffers[kind] = std::move(buffer);
   auto _buffer         = _vertexBuffers[kind].get();
+  _updateVertexBufferSlots();
 
   if (kind == VertexBuffer::PositionKind) {
     auto& data  = _buffer->getData();
@@ -240,19 +244,25 @@ void Geometry::_bind(Effect* effect, GL::IGLBuffer* indexToBind)
     indexToBind = _indexBuffer.get();
   }
 
-  if (indexToBind != _indexBuffer.get() || _vertexArrayObjects.empty()) {
-    _engine->bindBuffers(getVertexBuffers(), indexToBind, effect);
+  if (indexToBind != _indexBuffer.get()
+      || !_engine->getCaps().vertexArrayObject) {
+    _engine->bindBuffers(getVertexBufferSlots(), indexToBind, effect);
     return;
   }
 
-  // Using VAO
-  if (!stl_util::contains(_vertexArrayObjects, effect->key())) {
-    _vertexArrayObjects[effect->key()] = _engine->recordVertexArrayObject(
-      getVertexBuffers(), indexToBind, effect);
+  // Using VAO, recorded on first use for each effect
+  if (!_currentVertexArrayObject
+      || _currentVertexArrayObjectEffectId != effect->uniqueId) {
+    auto& vertexArrayObject = _vertexArrayObjects[effect->uniqueId];
+    if (!vertexArrayObject) {
+      vertexArrayObject = _engine->recordVertexArrayObject(
+        getVertexBufferSlots(), indexToBind, effect);
+    }
+    _currentVertexArrayObject         = vertexArrayObject.get();
+    _currentVertexArrayObjectEffectId = effect->uniqueId;
   }
 
-  _engine->bindVertexArrayObject(_vertexArrayObjects[effect->key()].get(),
-                                 indexToBind);
+  _engine->bindVertexArrayObject(_currentVertexArrayObject, indexToBind);
 }
 
 size_t Geometry::getTotalVertices() const
@@ -312,6 +322,30 @@ std::unordered_map<std::string, VertexBuffer*> Geometry::getVertexBuffers()
   return vertexBuffers;
 }
 
+const std::vector<VertexBuffer*>& Geometry::getVertexBufferSlots() const
+{
+  static const std::vector<VertexBuffer*> emptySlots;
+  if (!isReady()) {
+    return emptySlots;
+  }
+
+  return _vertexBufferSlots;
+}
+
+void Geometry::_updateVertexBufferSlots()
+{
+  _vertexBufferSlots.clear();
+  for (const auto& item : _vertexBuffers) {
+    if (!item.second) {
+      continue;
+    }
+    if (item.first >= _vertexBufferSlots.size()) {
+      _vertexBufferSlots.resize(item.first + 1, nullptr);
+    }
+    _vertexBufferSlots[item.first] = item.second.get();
+  }
+}
+
 bool Geometry::isVerticesDataPresent(unsigned int kind)
 {
   if (_vertexBuffers.empty()) {
@@ -391,6 +425,11 @@ IndicesArray Geometry::getIndices(bool copyWhenShared)
   }
 }
 
+size_t Geometry::revision() const
+{
+  return _revision;
+}
+
 GL::IGLBuffer* Geometry::getIndexBuffer()
 {
   if (!isReady()) {
@@ -405,9 +444,13 @@ void Geometry::_releaseVertexArrayObject(Effect* effect)
     return;
   }
 
-  if (stl_util::contains(_vertexArrayObjects, effect->key())) {
-    _engine->releaseVertexArrayObject(_vertexArrayObjects[effect->key()].get());
-    _vertexArrayObjects[effect->key()].reset(nullptr);
+  auto it = _vertexArrayObjects.find(effect->uniqueId);
+  if (it != _vertexArrayObjects.end()) {
+    if (_currentVertexArrayObject == it->second.get()) {
+      _currentVertexArrayObject = nullptr;
+    }
+    _engine->releaseVertexArrayObject(it->second.get());
+    _vertexArrayObjects.erase(it);
   }
 }
 
@@ -515,6 +558,8 @@ void Geometry::_applyToMesh(Mesh* mesh)
 
 void Geometry::notifyUpdate(unsigned int kind)
 {
+  ++_revision;
+
   if (onGeometryUpdated) {
     onGeometryUpdated(this, kind);
   }
@@ -603,6 +648,185 @@ bool Geometry::_generatePointsArray()
   return true;
 }
 
+IndexOptimizationStats
+Geometry::optimizeIndices(const IndexOptimizer& optimizer)
+{
+  if (!isReady() || _indices.empty()) {
+    return IndexOptimizationStats();
+  }
+
+  IndexOptimizer indexOptimizer = optimizer;
+  if (!_canRemapVertices()) {
+    indexOptimizer.weldVertices        = false;
+    indexOptimizer.optimizeVertexFetch = false;
+  }
+
+  auto vertexData = VertexData::ExtractFromGeometry(this, false, true);
+  const auto stats
+    = indexOptimizer.optimize(*vertexData, _subMeshIndexRanges());
+  _applyOptimizedVertexData(*vertexData);
+
+  return stats;
+}
+
+size_t Geometry::compressVertexData(const VertexCompressionOptions& options)
+{
+  if (!isReady()) {
+    return 0;
+  }
+
+  size_t savedBytes = 0;
+  const auto compress = [&](unsigned int kind,
+                            VertexCompression::Format format) {
+    auto vertexBuffer = getVertexBuffer(kind);
+    // Only the static, not interleaved and not yet compressed buffers
+    if (!vertexBuffer || vertexBuffer->isUpdatable()
+        || vertexBuffer->getFormat() != VertexCompression::None
+        || vertexBuffer->getIsInstanced() || vertexBuffer->getOffset() != 0
+        || vertexBuffer->getSize() != vertexBuffer->getStrideSize()) {
+      return;
+    }
+    const auto stride = static_cast<size_t>(vertexBuffer->getStrideSize());
+    if ((format == VertexCompression::Unorm16 && stride != 3)
+        || (format == VertexCompression::Octahedral16 && stride != 3
+            && stride != 4)
+        || (format == VertexCompression::Unorm8 && stride > 4)) {
+      return;
+    }
+
+    const auto& data = vertexBuffer->getData();
+    const auto cube
+      = (format == VertexCompression::Unorm16) ?
+          VertexCompression::ComputeQuantizationCube(data, stride) :
+          VertexCompression::QuantizationCube{{0.f, 0.f, 0.f, 1.f}};
+    const auto packed = VertexCompression::Encode(format, data, stride, cube);
+    savedBytes
+      += data.size() * sizeof(float) - packed.size() * sizeof(uint16_t);
+    setVerticesBuffer(std::make_unique<VertexBuffer>(
+      _engine, packed, kind, format, static_cast<int>(stride), cube));
+  };
+
+  if (options.quantizePositions) {
+    // Skinning and morph targets deform the positions in the local space
+    bool canQuantizePositions
+      = !isVerticesDataPresent(VertexBuffer::MatricesIndicesKind);
+    for (auto& mesh : _meshes) {
+      if (mesh->morphTargetManager()
+          && mesh->morphTargetManager()->numTargets() > 0) {
+        canQuantizePositions = false;
+      }
+    }
+    if (canQuantizePositions) {
+      compress(VertexBuffer::PositionKind, VertexCompression::Unorm16);
+      for (auto& mesh : _meshes) {
+        mesh->_invalidateInstancesData();
+      }
+    }
+  }
+
+  if (options.octahedralNormals) {
+    compress(VertexBuffer::NormalKind, VertexCompression::Octahedral16);
+    compress(VertexBuffer::TangentKind, VertexCompression::Octahedral16);
+  }
+
+  if (options.halfFloatUVs) {
+    for (auto kind : {VertexBuffer::UVKind, VertexBuffer::UV2Kind,
+                      VertexBuffer::UV3Kind, VertexBuffer::UV4Kind,
+                      VertexBuffer::UV5Kind, VertexBuffer::UV6Kind}) {
+      compress(kind, VertexCompression::Half16);
+    }
+  }
+
+  if (options.unorm8Colors) {
+    compress(VertexBuffer::ColorKind, VertexCompression::Unorm8);
+  }
+
+  // The shaders decoding the attributes are selected by the defines
+  for (auto& mesh : _meshes) {
+    mesh->_markSubMeshesAsAttributesDirty();
+  }
+
+  return savedBytes;
+}
+
+void Geometry::_applyOptimizedVertexData(VertexData& vertexData)
+{
+  struct SubMeshLayout {
+    unsigned int materialIndex;
+    unsigned int indexStart;
+    size_t indexCount;
+  }; // end of struct SubMeshLayout
+
+  // Index ranges are kept by the optimizer, only the vertex ranges change
+  std::vector<std::vector<SubMeshLayout>> layouts;
+  for (auto& mesh : _meshes) {
+    std::vector<SubMeshLayout> layout;
+    for (auto& subMesh : mesh->subMeshes) {
+      layout.emplace_back(SubMeshLayout{subMesh->materialIndex,
+                                        subMesh->indexStart,
+                                        subMesh->indexCount});
+    }
+    layouts.emplace_back(std::move(layout));
+  }
+
+  auto positionBuffer = getVertexBuffer(VertexBuffer::PositionKind);
+  const bool updatable
+    = positionBuffer ? positionBuffer->isUpdatable() : false;
+  vertexData.applyToGeometry(this, updatable);
+
+  for (size_t m = 0; m < _meshes.size(); ++m) {
+    auto mesh = _meshes[m];
+    if (layouts[m].size() <= 1) {
+      continue;
+    }
+    mesh->releaseSubMeshes();
+    for (const auto& subMesh : layouts[m]) {
+      SubMesh::CreateFromIndices(subMesh.materialIndex, subMesh.indexStart,
+                                 subMesh.indexCount, mesh);
+    }
+  }
+}
+
+std::vector<IndexOptimizer::IndexRange> Geometry::_subMeshIndexRanges() const
+{
+  const size_t totalIndices = _indices.size();
+  std::vector<size_t> boundaries{0, totalIndices};
+  for (auto& mesh : _meshes) {
+    for (auto& subMesh : mesh->subMeshes) {
+      const size_t start = subMesh->indexStart;
+      const size_t end   = start + subMesh->indexCount;
+      boundaries.emplace_back(start < totalIndices ? start : totalIndices);
+      boundaries.emplace_back(end < totalIndices ? end : totalIndices);
+    }
+  }
+  std::sort(boundaries.begin(), boundaries.end());
+  boundaries.erase(std::unique(boundaries.begin(), boundaries.end()),
+                   boundaries.end());
+
+  std::vector<IndexOptimizer::IndexRange> ranges;
+  for (size_t i = 1; i < boundaries.size(); ++i) {
+    ranges.emplace_back(boundaries[i - 1], boundaries[i] - boundaries[i - 1]);
+  }
+  return ranges;
+}
+
+bool Geometry::_canRemapVertices() const
+{
+  // Morph targets and attributes unknown to VertexData are indexed by vertex
+  for (auto& mesh : _meshes) {
+    if (mesh->morphTargetManager()
+        && mesh->morphTargetManager()->numTargets() > 0) {
+      return false;
+    }
+  }
+  for (auto& item : _vertexBuffers) {
+    if (item.second && item.first > VertexBuffer::MatricesWeightsExtraKind) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool Geometry::isDisposed() const
 {
   return _isDisposed;
@@ -616,12 +840,15 @@ void Geometry::_disposeVertexArrayObjects()
     }
     _vertexArrayObjects.clear();
   }
+  _currentVertexArrayObject = nullptr;
 }
 
 void Geometry::dispose(bool /*doNotRecurse*/)
 {
-  for (const auto& mesh : _meshes) {
-    releaseForMesh(mesh);
+  // Copied, the meshes are removed from the list while released
+  const auto meshes = _meshes;
+  for (const auto& mesh : meshes) {
+    releaseForMesh(mesh, false);
   }
   _meshes.clear();
 
@@ -632,6 +859,7 @@ void Geometry::dispose(bool /*doNotRecurse*/)
     _vertexBuffers[item.first].reset(nullptr);
   }
   _vertexBuffers.clear();
+  _vertexBufferSlots.clear();
   _totalVertices = 0;
 
   if (_indexBuffer) {
@@ -647,8 +875,10 @@ void Geometry::dispose(bool /*doNotRecurse*/)
 
   _boundingInfo = nullptr;
 
-  _scene->removeGeometry(this);
   _isDisposed = true;
+
+  // Last, the geometry is deleted once removed from the scene
+  _scene->removeGeometry(this);
 }
 
 Geometry* Geometry::copy(const std::string& iId)
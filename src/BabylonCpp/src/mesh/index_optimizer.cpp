@@ -0,0 +1,490 @@
+#include <babylon/mesh/index_optimizer.h>
+
+#include <cstring>
+
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+std::vector<Float32Array*> attributes(VertexData& vertexData)
+{
+  std::vector<Float32Array*> result;
+  for (auto attribute :
+       {&vertexData.positions, &vertexData.normals, &vertexData.tangents,
+        &vertexData.uvs, &vertexData.uvs2, &vertexData.uvs3, &vertexData.uvs4,
+        &vertexData.uvs5, &vertexData.uvs6, &vertexData.colors,
+        &vertexData.matricesIndices, &vertexData.matricesWeights,
+        &vertexData.matricesIndicesExtra, &vertexData.matricesWeightsExtra}) {
+    if (!attribute->empty()) {
+      result.emplace_back(attribute);
+    }
+  }
+  return result;
+}
+
+// Moves the vertex at remap[v] to v for each attribute
+void remapVertices(VertexData& vertexData, const std::vector<uint32_t>& remap,
+                   size_t vertexCount, size_t newVertexCount)
+{
+  for (auto attribute : attributes(vertexData)) {
+    const size_t stride = attribute->size() / vertexCount;
+    Float32Array result(newVertexCount * stride);
+    for (size_t v = 0; v < vertexCount; ++v) {
+      if (remap[v] != InvalidIndex) {
+        std::copy_n(attribute->begin() + v * stride, stride,
+                    result.begin() + remap[v] * stride);
+      }
+    }
+    attribute->swap(result);
+  }
+}
+
+// FIFO cache simulation, returns the number of misses of the triangle
+unsigned int cacheMisses(const uint32_t* triangle,
+                         std::vector<uint32_t>& timestamps, uint32_t& time,
+                         unsigned int cacheSize)
+{
+  unsigned int misses = 0;
+  for (size_t c = 0; c < 3; ++c) {
+    const auto v = triangle[c];
+    if (time - timestamps[v] > cacheSize) {
+      timestamps[v] = time++;
+      ++misses;
+    }
+  }
+  return misses;
+}
+
+} // end of anonymous namespace
+
+IndexOptimizer::IndexOptimizer()
+    : cacheSize{16}
+    , overdrawThreshold{1.05f}
+    , weldVertices{true}
+    , optimizeOverdraw{true}
+    , optimizeVertexFetch{true}
+{
+}
+
+IndexOptimizer::~IndexOptimizer()
+{
+}
+
+IndexOptimizationStats
+IndexOptimizer::optimize(VertexData& vertexData,
+                         std::vector<IndexRange> ranges) const
+{
+  IndexOptimizationStats stats;
+  auto& indices           = vertexData.indices;
+  size_t vertexCount      = VertexCount(vertexData);
+  stats.triangleCount     = indices.size() / 3;
+  stats.vertexCountBefore = vertexCount;
+  stats.vertexCountAfter  = vertexCount;
+  if (vertexCount == 0 || indices.empty() || indices.size() % 3 != 0
+      || *std::max_element(indices.begin(), indices.end()) >= vertexCount) {
+    return stats;
+  }
+
+  if (ranges.empty()) {
+    ranges.emplace_back(0, indices.size());
+  }
+  for (auto& range : ranges) {
+    range.first  = std::min(range.first - range.first % 3, indices.size());
+    range.second = std::min(range.second - range.second % 3,
+                            indices.size() - range.first);
+  }
+
+  AnalyzeVertexCache(indices, vertexCount, cacheSize, stats.acmrBefore,
+                     stats.atvrBefore);
+
+  if (weldVertices) {
+    vertexCount = WeldVertices(vertexData);
+  }
+
+  for (const auto& range : ranges) {
+    OptimizeVertexCache(indices, range, vertexCount, cacheSize);
+    if (optimizeOverdraw && !vertexData.positions.empty()) {
+      OptimizeOverdraw(indices, range, vertexData.positions, cacheSize,
+                       overdrawThreshold);
+    }
+  }
+
+  if (optimizeVertexFetch) {
+    vertexCount = OptimizeVertexFetch(vertexData);
+  }
+
+  stats.vertexCountAfter = vertexCount;
+  stats.uses16BitIndices = vertexCount <= 65536;
+  AnalyzeVertexCache(indices, vertexCount, cacheSize, stats.acmrAfter,
+                     stats.atvrAfter);
+
+  return stats;
+}
+
+size_t IndexOptimizer::WeldVertices(VertexData& vertexData)
+{
+  const size_t vertexCount = VertexCount(vertexData);
+  if (vertexCount == 0) {
+    return 0;
+  }
+
+  // Attributes of each vertex, as raw bits
+  auto vertexAttributes = attributes(vertexData);
+  size_t vertexSize     = 0;
+  for (auto attribute : vertexAttributes) {
+    vertexSize += attribute->size() / vertexCount;
+  }
+  std::vector<uint32_t> bits(vertexCount * vertexSize);
+  size_t offset = 0;
+  for (auto attribute : vertexAttributes) {
+    const size_t stride = attribute->size() / vertexCount;
+    for (size_t v = 0; v < vertexCount; ++v) {
+      std::memcpy(&bits[v * vertexSize + offset], &(*attribute)[v * stride],
+                  stride * sizeof(float));
+    }
+    offset += stride;
+  }
+
+  const auto hashVertex = [&](size_t v) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < vertexSize; ++i) {
+      hash = (hash ^ bits[v * vertexSize + i]) * 1099511628211ull;
+    }
+    return hash;
+  };
+  const auto sameVertex = [&](size_t a, size_t b) {
+    return std::equal(bits.begin() + a * vertexSize,
+                      bits.begin() + (a + 1) * vertexSize,
+                      bits.begin() + b * vertexSize);
+  };
+
+  // Canonical vertex of each vertex (first identical one)
+  std::vector<uint32_t> canonical(vertexCount);
+  std::unordered_multimap<uint64_t, uint32_t> vertices;
+  vertices.reserve(vertexCount);
+  for (size_t v = 0; v < vertexCount; ++v) {
+    const auto hash  = hashVertex(v);
+    canonical[v]     = static_cast<uint32_t>(v);
+    const auto range = vertices.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (sameVertex(it->second, v)) {
+        canonical[v] = it->second;
+        break;
+      }
+    }
+    if (canonical[v] == v) {
+      vertices.emplace(hash, static_cast<uint32_t>(v));
+    }
+  }
+
+  // Compaction of the used canonical vertices, in vertex order
+  std::vector<uint32_t> remap(vertexCount, InvalidIndex);
+  for (auto& index : vertexData.indices) {
+    index        = canonical[index];
+    remap[index] = 0;
+  }
+  uint32_t newVertexCount = 0;
+  for (size_t v = 0; v < vertexCount; ++v) {
+    if (remap[v] != InvalidIndex) {
+      remap[v] = newVertexCount++;
+    }
+  }
+  for (auto& index : vertexData.indices) {
+    index = remap[index];
+  }
+  remapVertices(vertexData, remap, vertexCount, newVertexCount);
+
+  return newVertexCount;
+}
+
+void IndexOptimizer::OptimizeVertexCache(IndicesArray& indices,
+                                         IndexRange range, size_t vertexCount,
+                                         unsigned int cacheSize)
+{
+  const size_t triangleCount = range.second / 3;
+  if (triangleCount < 2) {
+    return;
+  }
+  const uint32_t* input = indices.data() + range.first;
+
+  // Triangles adjacent to each vertex
+  std::vector<uint32_t> live(vertexCount, 0);
+  for (size_t i = 0; i < triangleCount * 3; ++i) {
+    ++live[input[i]];
+  }
+  std::vector<uint32_t> offsets(vertexCount + 1, 0);
+  for (size_t v = 0; v < vertexCount; ++v) {
+    offsets[v + 1] = offsets[v] + live[v];
+  }
+  std::vector<uint32_t> adjacency(triangleCount * 3);
+  {
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+      adjacency[fill[input[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+  }
+
+  IndicesArray output(triangleCount * 3);
+  size_t outputSize = 0;
+  std::vector<uint32_t> cacheTime(vertexCount, 0);
+  std::vector<bool> emitted(triangleCount, false);
+  std::vector<uint32_t> deadEnd, candidates;
+  uint32_t time   = cacheSize + 1;
+  size_t cursor   = 0;
+  int64_t fanning = input[0];
+
+  while (fanning >= 0) {
+    // Emits the remaining triangles around the fanning vertex
+    const auto f = static_cast<size_t>(fanning);
+    candidates.clear();
+    for (uint32_t a = offsets[f]; a < offsets[f + 1]; ++a) {
+      const auto triangle = adjacency[a];
+      if (emitted[triangle]) {
+        continue;
+      }
+      for (size_t c = 0; c < 3; ++c) {
+        const auto v         = input[triangle * 3 + c];
+        output[outputSize++] = v;
+        deadEnd.emplace_back(v);
+        candidates.emplace_back(v);
+        --live[v];
+        if (time - cacheTime[v] > cacheSize) {
+          cacheTime[v] = time++;
+        }
+      }
+      emitted[triangle] = true;
+    }
+
+    // Next fanning vertex: the oldest candidate which will still be in the
+    // cache once its triangles are emitted
+    fanning              = -1;
+    int64_t bestPriority = -1;
+    for (auto v : candidates) {
+      if (live[v] == 0) {
+        continue;
+      }
+      int64_t priority = 0;
+      if (time - cacheTime[v] + 2 * live[v] <= cacheSize) {
+        priority = time - cacheTime[v];
+      }
+      if (priority > bestPriority) {
+        bestPriority = priority;
+        fanning      = v;
+      }
+    }
+
+    // Dead end: most recently referenced vertex with live triangles, or next
+    // vertex in input order
+    while (fanning < 0 && !deadEnd.empty()) {
+      const auto v = deadEnd.back();
+      deadEnd.pop_back();
+      if (live[v] > 0) {
+        fanning = v;
+      }
+    }
+    while (fanning < 0 && cursor < vertexCount) {
+      if (live[cursor] > 0) {
+        fanning = static_cast<int64_t>(cursor);
+      }
+      ++cursor;
+    }
+  }
+
+  std::copy(output.begin(), output.end(), indices.begin() + range.first);
+}
+
+void IndexOptimizer::OptimizeOverdraw(IndicesArray& indices, IndexRange range,
+                                      const Float32Array& positions,
+                                      unsigned int cacheSize, float threshold)
+{
+  const size_t triangleCount = range.second / 3;
+  const size_t vertexCount   = positions.size() / 3;
+  if (triangleCount < 2) {
+    return;
+  }
+  uint32_t* triangles = indices.data() + range.first;
+
+  std::vector<uint32_t> timestamps(vertexCount, 0);
+  uint32_t time         = cacheSize + 1;
+  const auto resetCache = [&]() { time += cacheSize + 1; };
+  const auto misses     = [&](size_t triangle) {
+    return cacheMisses(triangles + triangle * 3, timestamps, time, cacheSize);
+  };
+
+  // Hard boundaries: triangles missing the cache entirely
+  std::vector<size_t> hardClusters;
+  for (size_t t = 0; t < triangleCount; ++t) {
+    if (misses(t) == 3) {
+      hardClusters.emplace_back(t);
+    }
+  }
+  hardClusters.emplace_back(triangleCount);
+  if (hardClusters.front() != 0) {
+    hardClusters.insert(hardClusters.begin(), 0);
+  }
+
+  // Soft boundaries: cut each hard cluster as soon as the ACMR of the current
+  // cluster is below the threshold
+  std::vector<size_t> clusters;
+  for (size_t h = 0; h + 1 < hardClusters.size(); ++h) {
+    const size_t start = hardClusters[h];
+    const size_t end   = hardClusters[h + 1];
+    resetCache();
+    size_t clusterMisses = 0;
+    for (size_t t = start; t < end; ++t) {
+      clusterMisses += misses(t);
+    }
+    const float clusterThreshold
+      = threshold * static_cast<float>(clusterMisses)
+        / static_cast<float>(end - start);
+
+    resetCache();
+    clusters.emplace_back(start);
+    size_t runningMisses = 0, runningTriangles = 0;
+    for (size_t t = start; t + 1 < end; ++t) {
+      runningMisses += misses(t);
+      ++runningTriangles;
+      if (static_cast<float>(runningMisses)
+            / static_cast<float>(runningTriangles)
+          <= clusterThreshold) {
+        clusters.emplace_back(t + 1);
+        resetCache();
+        runningMisses    = 0;
+        runningTriangles = 0;
+      }
+    }
+  }
+  clusters.emplace_back(triangleCount);
+
+  // Sort key of each cluster: how much its area weighted normal faces away
+  // from the center of the mesh
+  Vector3 meshCenter;
+  {
+    std::vector<bool> used(vertexCount, false);
+    size_t usedCount = 0;
+    for (size_t i = 0; i < triangleCount * 3; ++i) {
+      const auto v = triangles[i];
+      if (!used[v]) {
+        used[v] = true;
+        meshCenter.addInPlace(Vector3(positions[v * 3], positions[v * 3 + 1],
+                                      positions[v * 3 + 2]));
+        ++usedCount;
+      }
+    }
+    meshCenter.scaleInPlace(1.f / static_cast<float>(usedCount));
+  }
+
+  const size_t clusterCount = clusters.size() - 1;
+  std::vector<float> keys(clusterCount);
+  for (size_t c = 0; c < clusterCount; ++c) {
+    Vector3 centroid, normal;
+    float area = 0.f;
+    for (size_t t = clusters[c]; t < clusters[c + 1]; ++t) {
+      const auto position = [&](size_t corner) {
+        const auto v = triangles[t * 3 + corner];
+        return Vector3(positions[v * 3], positions[v * 3 + 1],
+                       positions[v * 3 + 2]);
+      };
+      const auto p0         = position(0);
+      const auto p1         = position(1);
+      const auto p2         = position(2);
+      const auto faceNormal = Vector3::Cross(p1.subtract(p0), p2.subtract(p0));
+      const float faceArea  = faceNormal.length();
+      const auto faceCenter = p0.add(p1).addInPlace(p2).scaleInPlace(1.f / 3.f);
+      centroid.addInPlace(faceCenter.scale(faceArea));
+      normal.addInPlace(faceNormal);
+      area += faceArea;
+    }
+    if (area > 0.f) {
+      centroid.scaleInPlace(1.f / area);
+    }
+    const float length = normal.length();
+    keys[c]            = (length > 0.f) ?
+                Vector3::Dot(centroid.subtract(meshCenter), normal) / length :
+                0.f;
+  }
+
+  std::vector<size_t> order(clusterCount);
+  for (size_t c = 0; c < clusterCount; ++c) {
+    order[c] = c;
+  }
+  std::stable_sort(order.begin(), order.end(),
+                   [&keys](size_t a, size_t b) { return keys[a] > keys[b]; });
+
+  IndicesArray output;
+  output.reserve(triangleCount * 3);
+  for (auto c : order) {
+    output.insert(output.end(), triangles + clusters[c] * 3,
+                  triangles + clusters[c + 1] * 3);
+  }
+  std::copy(output.begin(), output.end(), triangles);
+}
+
+size_t IndexOptimizer::OptimizeVertexFetch(VertexData& vertexData)
+{
+  const size_t vertexCount = VertexCount(vertexData);
+  if (vertexCount == 0) {
+    return 0;
+  }
+
+  std::vector<uint32_t> remap(vertexCount, InvalidIndex);
+  uint32_t newVertexCount = 0;
+  for (auto& index : vertexData.indices) {
+    if (remap[index] == InvalidIndex) {
+      remap[index] = newVertexCount++;
+    }
+    index = remap[index];
+  }
+  remapVertices(vertexData, remap, vertexCount, newVertexCount);
+
+  return newVertexCount;
+}
+
+void IndexOptimizer::AnalyzeVertexCache(const IndicesArray& indices,
+                                        size_t vertexCount,
+                                        unsigned int cacheSize, float& acmr,
+                                        float& atvr)
+{
+  acmr = atvr = 0.f;
+  if (indices.size() < 3 || vertexCount == 0) {
+    return;
+  }
+
+  std::vector<uint32_t> timestamps(vertexCount, 0);
+  uint32_t time              = cacheSize + 1;
+  size_t misses              = 0;
+  const size_t triangleCount = indices.size() / 3;
+  for (size_t t = 0; t < triangleCount; ++t) {
+    misses += cacheMisses(indices.data() + t * 3, timestamps, time, cacheSize);
+  }
+
+  size_t usedVertices = 0;
+  for (auto timestamp : timestamps) {
+    usedVertices += (timestamp != 0) ? 1 : 0;
+  }
+  acmr = static_cast<float>(misses) / static_cast<float>(triangleCount);
+  atvr = static_cast<float>(misses) / static_cast<float>(usedVertices);
+}
+
+size_t IndexOptimizer::VertexCount(const VertexData& vertexData)
+{
+  const size_t vertexCount = vertexData.positions.size() / 3;
+  if (vertexCount == 0 || vertexData.positions.size() % 3 != 0) {
+    return 0;
+  }
+
+  for (auto attribute : attributes(const_cast<VertexData&>(vertexData))) {
+    if (attribute->size() % vertexCount != 0) {
+      return 0;
+    }
+  }
+
+  return vertexCount;
+}
+
+} // end of namespace BABYLON
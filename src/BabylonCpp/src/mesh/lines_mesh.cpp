@@ -104,7 +104,7 @@ void LinesMesh::_bind(SubMesh* /*subMesh*/, Effect* /*effect*/,
 void LinesMesh::_draw(SubMesh* subMesh, int /*fillMode*/,
                       size_t /*instancesCount*/)
 {
-  if (!_geometry || _geometry->getVertexBuffers().empty()
+  if (!_geometry || _geometry->getVertexBufferSlots().empty()
       || !_geometry->getIndexBuffer()) {
     return;
   }
@@ -28,6 +28,7 @@
 #include <babylon/mesh/mesh_builder.h>
 #include <babylon/mesh/mesh_lod_level.h>
 #include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_compression.h>
 #include <babylon/mesh/vertex_data.h>
 #include <babylon/mesh/vertex_data_options.h>
 #include <babylon/morph/morph_target.h>
@@ -50,8 +51,12 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , _shouldGenerateFlatShading{false}
     , _onBeforeDrawObserver{nullptr}
     , _morphTargetManager{nullptr}
+    , _morphedPositionsRevision{0}
     , _batchCache{std::make_unique<_InstancesBatch>()}
     , _instancesBufferSize{32 * 16 * 4} // maximum of 32 instances
+    , _useStaticBatchDrawRanges{false}
+    , _indexOptimizationGeometry{nullptr}
+    , _indexOptimizationRevision{0}
     , _overridenInstanceCount{0}
     , _preActivateId{-1}
     , _sideOrientation{Mesh::DEFAULTSIDE}
@@ -137,6 +142,7 @@ void Mesh::setMorphTargetManager(MorphTargetManager* value)
     return;
   }
   _morphTargetManager = value;
+  _morphedPositions.clear();
   _syncGeometryWithMorphTargetManager();
 }
 
@@ -685,7 +691,7 @@ void Mesh::_bind(SubMesh* subMesh, Effect* effect, unsigned int fillMode)
 
 void Mesh::_draw(SubMesh* subMesh, int fillMode, size_t instancesCount)
 {
-  if (!_geometry || !_geometry->getVertexBuffers().size()
+  if (!_geometry || _geometry->getVertexBufferSlots().empty()
       || !_geometry->getIndexBuffer()) {
     return;
   }
@@ -719,6 +725,12 @@ void Mesh::_draw(SubMesh* subMesh, int fillMode, size_t instancesCount)
         engine->drawUnIndexed(true, subMeshVerticesStart, subMeshVerticesCount,
                               instancesCount);
       }
+      else if (_useStaticBatchDrawRanges) {
+        for (const auto& range : _staticBatchDrawRanges) {
+          engine->draw(true, range.first, static_cast<int>(range.second),
+                       static_cast<int>(instancesCount));
+        }
+      }
       else {
         engine->draw(true, static_cast<unsigned>(subMesh->indexStart),
                      subMesh->indexCount, instancesCount);
@@ -759,22 +771,24 @@ _InstancesBatch* Mesh::_getInstancesRenderList(size_t subMeshId)
   auto scene                               = getScene();
   _batchCache->mustReturn                  = false;
   _batchCache->renderSelf[subMeshId]       = isEnabled() && isVisible;
-  _batchCache->visibleInstances[subMeshId] = std::vector<InstancedMesh*>();
+  _batchCache->visibleInstances[subMeshId].clear();
 
   if (_visibleInstances) {
     auto currentRenderId_ = scene->getRenderId();
     auto defaultRenderId  = scene->_isInIntermediateRendering() ?
                              _visibleInstances->intermediateDefaultRenderId :
                              _visibleInstances->defaultRenderId;
-    _batchCache->visibleInstances[subMeshId]
-      = _visibleInstances->meshes[currentRenderId_];
+    const auto& currentInstances = _visibleInstances->meshes[currentRenderId_];
+    _batchCache->visibleInstances[subMeshId].assign(currentInstances.begin(),
+                                                    currentInstances.end());
     int selfRenderId = _renderId;
 
     if ((_batchCache->visibleInstances.find(subMeshId)
          == _batchCache->visibleInstances.end())
         && defaultRenderId) {
-      _batchCache->visibleInstances[subMeshId]
-        = _visibleInstances->meshes[defaultRenderId];
+      const auto& defaultInstances = _visibleInstances->meshes[defaultRenderId];
+      _batchCache->visibleInstances[subMeshId].assign(defaultInstances.begin(),
+                                                      defaultInstances.end());
       currentRenderId_ = std::max(defaultRenderId, currentRenderId_);
       selfRenderId
         = std::max(_visibleInstances->selfDefaultRenderId, currentRenderId_);
@@ -802,15 +816,15 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, int fillMode,
                                  _InstancesBatch* batch, Effect* effect,
                                  Engine* engine)
 {
-  if (batch->visibleInstances.find(subMesh->_id)
-      == batch->visibleInstances.end()) {
+  auto it = batch->visibleInstances.find(subMesh->_id);
+  if (it == batch->visibleInstances.end()) {
     return *this;
   }
 
-  std::vector<InstancedMesh*> visibleInstances
-    = batch->visibleInstances[subMesh->_id];
-  size_t matricesCount = visibleInstances.size() + 1;
-  size_t bufferSize    = matricesCount * 16 * 4;
+  const auto& visibleInstances = it->second;
+  const size_t instanceStride  = _getInstanceStride();
+  size_t matricesCount         = visibleInstances.size() + 1;
+  size_t bufferSize            = matricesCount * instanceStride * 4;
 
   auto currentInstancesBufferSize = _instancesBufferSize;
 
@@ -818,53 +832,115 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, int fillMode,
     _instancesBufferSize *= 2;
   }
 
-  if (_instancesData.empty()
-      || currentInstancesBufferSize != _instancesBufferSize) {
+  const bool mustRecreateBuffer
+    = !_instancesBuffer || _instancesData.empty()
+      || currentInstancesBufferSize != _instancesBufferSize;
+
+  if (mustRecreateBuffer) {
     _instancesData = Float32Array(_instancesBufferSize / 4);
-  }
+    _instancesSlots.clear();
+    _instancesSlotFlags.clear();
+  }
+
+  // Only repack the instances whose slot owner or world matrix changed
+  size_t instancesCount = 0;
+  size_t dirtyStart = std::numeric_limits<size_t>::max(), dirtyEnd = 0;
+  const auto packInstance = [&](AbstractMesh* instance) {
+    const auto slot = instancesCount++;
+    if (slot >= _instancesSlots.size()) {
+      _instancesSlots.resize(slot + 1, nullptr);
+      _instancesSlotFlags.resize(slot + 1, -1);
+    }
 
-  unsigned int offset         = 0;
-  unsigned int instancesCount = 0;
+    auto world  = instance->getWorldMatrix();
+    auto offset = static_cast<unsigned int>(slot * instanceStride);
+    bool changed = false;
+    if (_instancesSlots[slot] != instance
+        || _instancesSlotFlags[slot] != world->updateFlag) {
+      _getWorldMatrixForRendering(world)->copyToArray(_instancesData, offset);
+      _instancesSlots[slot]     = instance;
+      _instancesSlotFlags[slot] = world->updateFlag;
+      changed                   = true;
+    }
+    offset += 16;
+
+    // User defined per instance attributes
+    for (const auto& instancedBuffer : _userInstancedBuffers) {
+      auto value = instance->instancedBuffers.find(instancedBuffer.first);
+      for (unsigned int i = 0; i < instancedBuffer.second; ++i, ++offset) {
+        const float v
+          = (value != instance->instancedBuffers.end()
+             && i < value->second.size()) ?
+              value->second[i] :
+              0.f;
+        if (!stl_util::almost_equal(_instancesData[offset], v)) {
+          _instancesData[offset] = v;
+          changed                = true;
+        }
+      }
+    }
+
+    if (changed) {
+      dirtyStart = std::min(dirtyStart, slot);
+      dirtyEnd   = slot + 1;
+    }
+  };
 
-  auto world = getWorldMatrix();
   if (batch->renderSelf[subMesh->_id]) {
-    world->copyToArray(_instancesData, offset);
-    offset += 16;
-    instancesCount++;
+    packInstance(this);
   }
 
-  if (!visibleInstances.empty()) {
-    for (size_t instanceIndex = 0; instanceIndex < visibleInstances.size();
-         ++instanceIndex) {
-      InstancedMesh* instance = visibleInstances[instanceIndex];
-      instance->getWorldMatrix()->copyToArray(_instancesData, offset);
-      offset += 16;
-      ++instancesCount;
-    }
+  for (auto& instance : visibleInstances) {
+    packInstance(instance);
   }
 
-  if (!_instancesBuffer || currentInstancesBufferSize != _instancesBufferSize) {
+  if (mustRecreateBuffer) {
     if (_instancesBuffer) {
       _instancesBuffer->dispose();
     }
 
     _instancesBuffer
-      = std::make_unique<Buffer>(engine, _instancesData, true, 16, false, true);
+      = std::make_unique<Buffer>(engine, _instancesData, true,
+                                 static_cast<int>(instanceStride), false, true);
 
-    setVerticesBuffer(
+    // Owned by this mesh and not stored in the geometry, which may be shared
+    // with other meshes rendering their own instances
+    _instancesVertexBuffers.clear();
+    _instancesVertexBuffers.emplace_back(
       _instancesBuffer->createVertexBuffer(VertexBuffer::World0Kind, 0, 4));
-    setVerticesBuffer(
+    _instancesVertexBuffers.emplace_back(
       _instancesBuffer->createVertexBuffer(VertexBuffer::World1Kind, 4, 4));
-    setVerticesBuffer(
+    _instancesVertexBuffers.emplace_back(
       _instancesBuffer->createVertexBuffer(VertexBuffer::World2Kind, 8, 4));
-    setVerticesBuffer(
+    _instancesVertexBuffers.emplace_back(
       _instancesBuffer->createVertexBuffer(VertexBuffer::World3Kind, 12, 4));
+
+    int offset = 16;
+    for (const auto& instancedBuffer : _userInstancedBuffers) {
+      const auto size = static_cast<int>(instancedBuffer.second);
+      _instancesVertexBuffers.emplace_back(_instancesBuffer->createVertexBuffer(
+        instancedBuffer.first, offset, size));
+      offset += size;
+    }
   }
-  else {
-    _instancesBuffer->updateDirectly(_instancesData, 0, instancesCount);
+  else if (dirtyEnd > dirtyStart) {
+    _instancesBuffer->updateDirectly(
+      _instancesData, static_cast<int>(dirtyStart * instanceStride),
+      dirtyEnd - dirtyStart);
   }
 
-  geometry()->_bind(effect);
+  // Vertex buffers of the geometry and instance buffers of this mesh, bound
+  // for every draw without vertex array object
+  _instancesVertexBufferSlots = geometry()->getVertexBufferSlots();
+  for (const auto& vertexBuffer : _instancesVertexBuffers) {
+    const auto kind = vertexBuffer->getKind();
+    if (kind >= _instancesVertexBufferSlots.size()) {
+      _instancesVertexBufferSlots.resize(kind + 1, nullptr);
+    }
+    _instancesVertexBufferSlots[kind] = vertexBuffer.get();
+  }
+  engine->bindBuffers(_instancesVertexBufferSlots,
+                      geometry()->getIndexBuffer(), effect);
 
   _draw(subMesh, fillMode, instancesCount);
 
@@ -873,6 +949,89 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, int fillMode,
   return *this;
 }
 
+size_t Mesh::_getInstanceStride() const
+{
+  size_t stride = 16;
+  for (const auto& instancedBuffer : _userInstancedBuffers) {
+    stride += instancedBuffer.second;
+  }
+
+  return stride;
+}
+
+void Mesh::registerInstancedBuffer(unsigned int kind, unsigned int size)
+{
+  for (const auto& instancedBuffer : _userInstancedBuffers) {
+    if (instancedBuffer.first == kind) {
+      return;
+    }
+  }
+
+  _userInstancedBuffers.emplace_back(kind, size);
+
+  // Force the instances buffer to be recreated with the new layout
+  _instancesData.clear();
+}
+
+void Mesh::setStaticBatchRanges(std::vector<StaticBatchRange>&& ranges)
+{
+  _staticBatchRanges = std::move(ranges);
+  _staticBatchDrawRanges.clear();
+}
+
+const std::vector<StaticBatchRange>& Mesh::staticBatchRanges() const
+{
+  return _staticBatchRanges;
+}
+
+void Mesh::_prepareStaticBatchDrawRanges(SubMesh* subMesh)
+{
+  _staticBatchDrawRanges.clear();
+
+  const auto& frustumPlanes  = getScene()->frustumPlanes();
+  const auto subMeshIndexEnd = subMesh->indexStart + subMesh->indexCount;
+  for (auto& range : _staticBatchRanges) {
+    if (range.indexStart < subMesh->indexStart
+        || range.indexStart + range.indexCount > subMeshIndexEnd
+        || !range.boundingInfo->isInFrustum(frustumPlanes)) {
+      continue;
+    }
+    // Merge with the previous range when contiguous
+    if (!_staticBatchDrawRanges.empty()) {
+      auto& last = _staticBatchDrawRanges.back();
+      if (last.first + last.second == range.indexStart) {
+        last.second += range.indexCount;
+        continue;
+      }
+    }
+    _staticBatchDrawRanges.emplace_back(range.indexStart, range.indexCount);
+  }
+}
+
+Matrix* Mesh::_getWorldMatrixForRendering(Matrix* world)
+{
+  auto positions
+    = _geometry ? _geometry->getVertexBuffer(VertexBuffer::PositionKind) :
+                  nullptr;
+  if (!positions || positions->getFormat() != VertexCompression::Unorm16) {
+    return world;
+  }
+
+  // Position = offset + quantized position * size
+  const auto& cube = positions->getQuantizationCube();
+  Matrix::ScalingToRef(cube[3], cube[3], cube[3], _positionDequantization);
+  _positionDequantization.setTranslationFromFloats(cube[0], cube[1], cube[2]);
+  _positionDequantization.multiplyToRef(*world, _worldMatrixForRendering);
+
+  return &_worldMatrixForRendering;
+}
+
+void Mesh::_invalidateInstancesData()
+{
+  _instancesSlots.clear();
+  _instancesSlotFlags.clear();
+}
+
 Mesh& Mesh::_processRendering(SubMesh* subMesh, Effect* effect, int fillMode,
                               _InstancesBatch* batch,
                               bool hardwareInstancedRendering,
@@ -891,7 +1050,8 @@ Mesh& Mesh::_processRendering(SubMesh* subMesh, Effect* effect, int fillMode,
     if (batch->renderSelf[subMesh->_id]) {
       // Draw
       if (onBeforeDraw) {
-        onBeforeDraw(false, *getWorldMatrix(), effectiveMaterial);
+        onBeforeDraw(false, *_getWorldMatrixForRendering(getWorldMatrix()),
+                     effectiveMaterial);
       }
 
       _draw(subMesh, fillMode, _overridenInstanceCount);
@@ -900,7 +1060,8 @@ Mesh& Mesh::_processRendering(SubMesh* subMesh, Effect* effect, int fillMode,
     if (!batch->visibleInstances[subMesh->_id].empty()) {
       for (auto& instance : batch->visibleInstances[subMesh->_id]) {
         // World
-        Matrix* world = instance->getWorldMatrix();
+        Matrix* world
+          = _getWorldMatrixForRendering(instance->getWorldMatrix());
         if (onBeforeDraw) {
           onBeforeDraw(true, *world, effectiveMaterial);
         }
@@ -925,8 +1086,17 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
     return *this;
   }
 
+  // Meshes automatically instanced with this submesh (see
+  // RenderingManager::autoInstancing)
+  if (subMesh->_autoInstances && !subMesh->_autoInstances->empty()) {
+    auto& visibleInstances = batch->visibleInstances[subMesh->_id];
+    visibleInstances.insert(visibleInstances.end(),
+                            subMesh->_autoInstances->begin(),
+                            subMesh->_autoInstances->end());
+  }
+
   // Checking geometry state
-  if (!_geometry || _geometry->getVertexBuffers().empty()
+  if (!_geometry || _geometry->getVertexBufferSlots().empty()
       || !_geometry->getIndexBuffer()) {
     return *this;
   }
@@ -982,7 +1152,7 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
                                              effectiveMaterial->fillMode());
   _bind(subMesh, effect, fillMode);
 
-  auto _world = getWorldMatrix();
+  auto _world = _getWorldMatrixForRendering(getWorldMatrix());
 
   if (effectiveMaterial->storeEffectOnSubMeshes) {
     effectiveMaterial->bindForSubMesh(_world, this, subMesh);
@@ -996,6 +1166,15 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
     engine->setAlphaMode(effectiveMaterial->alphaMode);
   }
 
+  // Frozen static batch: only the visible source meshes are drawn, the world
+  // space ranges being stale once the batch moves
+  _useStaticBatchDrawRanges = !_staticBatchRanges.empty()
+                              && isWorldMatrixFrozen()
+                              && !hardwareInstancedRendering;
+  if (_useStaticBatchDrawRanges) {
+    _prepareStaticBatchDrawRanges(subMesh);
+  }
+
   // Draw
   _processRendering(
     subMesh, effect, static_cast<int>(fillMode), batch,
@@ -1004,6 +1183,8 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode)
       _onBeforeDraw(isInstance, world, _effectiveMaterial);
     });
 
+  _useStaticBatchDrawRanges = false;
+
   // Unbind
   effectiveMaterial->unbind();
 
@@ -1220,6 +1401,9 @@ Mesh& Mesh::bakeCurrentTransformIntoVertices()
 std::vector<Vector3>& Mesh::_positions()
 {
   if (_geometry) {
+    if (!_morphedPositions.empty()) {
+      return _morphedPositions;
+    }
     return _geometry->_positions;
   }
   return _emptyPositions;
@@ -1230,16 +1414,41 @@ Mesh& Mesh::_resetPointsArrayCache()
   if (_geometry) {
     _geometry->_resetPointsArrayCache();
   }
+  _morphedPositions.clear();
+  if (_morphTargetManager) {
+    _morphTargetManager->markBlendDirty();
+  }
   return *this;
 }
 
 bool Mesh::_generatePointsArray()
 {
-  if (_geometry) {
-    return _geometry->_generatePointsArray();
+  if (!_geometry || !_geometry->_generatePointsArray()) {
+    return false;
+  }
+
+  // The morphed shape is blended on the CPU for the targets rendered by the
+  // GPU, from the unmorphed positions
+  if (!_morphTargetManager || _morphTargetManager->numInfluencers() == 0
+      || !_geometry->isVerticesDataPresent(VertexBuffer::PositionKind)) {
+    _morphedPositions.clear();
+    return true;
   }
 
-  return false;
+  if (_morphedPositions.empty()
+      || _morphedPositionsRevision != _morphTargetManager->blendRevision()) {
+    const auto& positions = _morphTargetManager->blendPositions(
+      _geometry->getVertexBuffer(VertexBuffer::PositionKind)->getData());
+    _morphedPositions.resize(positions.size() / 3);
+    for (size_t index = 0; index < _morphedPositions.size(); ++index) {
+      _morphedPositions[index].copyFromFloats(
+        positions[index * 3], positions[index * 3 + 1],
+        positions[index * 3 + 2]);
+    }
+    _morphedPositionsRevision = _morphTargetManager->blendRevision();
+  }
+
+  return true;
 }
 
 Mesh* Mesh::clone(const std::string& iName, Node* newParent,
@@ -1269,6 +1478,8 @@ void Mesh::dispose(bool /*doNotRecurse*/)
   _source = nullptr;
 
   // Instances
+  _instancesVertexBuffers.clear();
+  _instancesVertexBufferSlots.clear();
   if (_instancesBuffer) {
     _instancesBuffer->dispose();
     _instancesBuffer.reset(nullptr);
@@ -1575,9 +1786,81 @@ Mesh& Mesh::synchronizeInstances()
 }*/
 
 void Mesh::optimizeIndices(
-  const std::function<void(Mesh* mesh)>& successCallback)
+  const std::function<void(Mesh* mesh)>& successCallback,
+  const IndexOptimizer& optimizer)
+{
+  if (successCallback) {
+    _indexOptimizationCallbacks.emplace_back(successCallback);
+  }
+
+  // Already running, the callback is called when it completes
+  if (_indexOptimizationTask.valid()) {
+    return;
+  }
+
+  if (!_geometry || !_geometry->isReady() || !_geometry->getTotalIndices()) {
+    auto callbacks = std::move(_indexOptimizationCallbacks);
+    _indexOptimizationCallbacks.clear();
+    for (auto& callback : callbacks) {
+      callback(this);
+    }
+    return;
+  }
+
+  IndexOptimizer indexOptimizer = optimizer;
+  if (!_geometry->_canRemapVertices()) {
+    indexOptimizer.weldVertices        = false;
+    indexOptimizer.optimizeVertexFetch = false;
+  }
+
+  // The background thread only works on its own copy of the vertex data
+  _indexOptimizationData
+    = VertexData::ExtractFromGeometry(_geometry, false, true);
+  _indexOptimizationGeometry = _geometry;
+  _indexOptimizationRevision = _geometry->revision();
+  auto vertexData            = _indexOptimizationData.get();
+  auto ranges                = _geometry->_subMeshIndexRanges();
+  _indexOptimizationTask
+    = std::async(std::launch::async, [indexOptimizer, vertexData, ranges]() {
+        return indexOptimizer.optimize(*vertexData, ranges);
+      });
+
+  getScene()->_addPendingIndexOptimization(this);
+}
+
+const IndexOptimizationStats& Mesh::indexOptimizationStats() const
+{
+  return _indexOptimizationStats;
+}
+
+bool Mesh::_applyIndexOptimization()
 {
-  successCallback(nullptr);
+  if (!_indexOptimizationTask.valid()) {
+    return true;
+  }
+
+  if (_indexOptimizationTask.wait_for(std::chrono::seconds(0))
+      != std::future_status::ready) {
+    return false;
+  }
+
+  // Dropped if the vertices or the indices were updated in the meantime
+  _indexOptimizationStats = _indexOptimizationTask.get();
+  if (_geometry && _geometry == _indexOptimizationGeometry
+      && !_geometry->isDisposed()
+      && _geometry->revision() == _indexOptimizationRevision) {
+    _geometry->_applyOptimizedVertexData(*_indexOptimizationData);
+  }
+  _indexOptimizationData.reset(nullptr);
+  _indexOptimizationGeometry = nullptr;
+
+  auto callbacks = std::move(_indexOptimizationCallbacks);
+  _indexOptimizationCallbacks.clear();
+  for (auto& callback : callbacks) {
+    callback(this);
+  }
+
+  return true;
 }
 
 void Mesh::_syncGeometryWithMorphTargetManager()
@@ -1589,6 +1872,13 @@ void Mesh::_syncGeometryWithMorphTargetManager()
 
   _markSubMeshesAsAttributesDirty();
 
+  const auto removeVerticesData = [&_geometry](unsigned int kind) {
+    if (_geometry->isVerticesDataPresent(kind)) {
+      _geometry->removeVerticesData(kind);
+    }
+  };
+
+  unsigned int numInfluencers = 0;
   if (_morphTargetManager && _morphTargetManager->vertexCount()) {
     if (_morphTargetManager->vertexCount() != getTotalVertices()) {
       BABYLON_LOG_ERROR("Mesh",
@@ -1598,38 +1888,61 @@ void Mesh::_syncGeometryWithMorphTargetManager()
       return;
     }
 
-    for (unsigned int index = 0; index < morphTargetManager()->numInfluencers();
-         ++index) {
-      auto morphTarget = morphTargetManager()->getActiveTarget(index);
-      _geometry->setVerticesData(VertexBuffer::PositionKind + index,
-                                 morphTarget->getPositions(), false, 3);
-
+    // The targets have their own vertex buffer kinds, the sparse ones are
+    // expanded from the base data of the mesh
+    const Float32Array emptyData;
+    const auto baseData
+      = [&_geometry, &emptyData](unsigned int kind) -> const Float32Array& {
+          auto vertexBuffer = _geometry->getVertexBuffer(kind);
+          return vertexBuffer ? vertexBuffer->getData() : emptyData;
+        };
+
+    numInfluencers
+      = static_cast<unsigned int>(_morphTargetManager->numInfluencers());
+    for (unsigned int index = 0; index < numInfluencers; ++index) {
+      auto morphTarget        = _morphTargetManager->getActiveTarget(index);
+      const auto positionKind = VertexBuffer::MorphTargetPositionKind + index;
+      const auto normalKind   = VertexBuffer::MorphTargetNormalKind + index;
+      const auto tangentKind  = VertexBuffer::MorphTargetTangentKind + index;
+      const auto sparse       = morphTarget->isSparse();
+
+      _geometry->setVerticesData(
+        positionKind,
+        sparse ?
+          morphTarget->densePositions(baseData(VertexBuffer::PositionKind)) :
+          morphTarget->getPositions(),
+        false, 3);
       if (morphTarget->hasNormals()) {
-        _geometry->setVerticesData(VertexBuffer::NormalKind + index,
-                                   morphTarget->getNormals(), false, 3);
+        _geometry->setVerticesData(
+          normalKind,
+          sparse ?
+            morphTarget->denseNormals(baseData(VertexBuffer::NormalKind)) :
+            morphTarget->getNormals(),
+          false, 3);
+      }
+      else {
+        removeVerticesData(normalKind);
       }
       if (morphTarget->hasTangents()) {
-        _geometry->setVerticesData(VertexBuffer::TangentKind + index,
-                                   morphTarget->getTangents(), false, 3);
+        _geometry->setVerticesData(
+          tangentKind,
+          sparse ?
+            morphTarget->denseTangents(baseData(VertexBuffer::TangentKind)) :
+            morphTarget->getTangents(),
+          false, 3);
+      }
+      else {
+        removeVerticesData(tangentKind);
       }
     }
   }
-  else {
-    unsigned int index = 0;
-
-    // Positions
-    while (
-      _geometry->isVerticesDataPresent(VertexBuffer::PositionKind + index)) {
-      _geometry->removeVerticesData(VertexBuffer::PositionKind + index);
 
-      if (_geometry->isVerticesDataPresent(VertexBuffer::NormalKind + index)) {
-        _geometry->removeVerticesData(VertexBuffer::NormalKind + index);
-      }
-      if (_geometry->isVerticesDataPresent(VertexBuffer::TangentKind + index)) {
-        _geometry->removeVerticesData(VertexBuffer::TangentKind + index);
-      }
-      ++index;
-    }
+  // Targets which are no longer active
+  for (unsigned int index = numInfluencers;
+       index < VertexBuffer::MaxMorphTargetInfluencers; ++index) {
+    removeVerticesData(VertexBuffer::MorphTargetPositionKind + index);
+    removeVerticesData(VertexBuffer::MorphTargetNormalKind + index);
+    removeVerticesData(VertexBuffer::MorphTargetTangentKind + index);
   }
 }
 
@@ -2430,14 +2743,13 @@ Mesh* Mesh::MergeMeshes(std::vector<Mesh*>& meshes, bool disposeSource,
                         bool allow32BitsIndices, Mesh* meshSubclass,
                         bool subdivideWithSubMeshes)
 {
-  unsigned int index;
   if (!allow32BitsIndices) {
     size_t totalVertices = 0;
 
     // Counting vertices
-    for (index = 0; index < meshes.size(); ++index) {
-      if (meshes[index]) {
-        totalVertices += meshes[index]->getTotalVertices();
+    for (auto& mesh : meshes) {
+      if (mesh) {
+        totalVertices += mesh->getTotalVertices();
 
         if (totalVertices > 65536) {
           BABYLON_LOG_WARN("Mesh",
@@ -2466,22 +2778,23 @@ Mesh* Mesh::MergeMeshes(std::vector<Mesh*>& meshes, bool disposeSource,
       }
       else {
         vertexData = std::move(otherVertexData);
-        source     = meshes[index];
+        source     = mesh;
       }
 
       if (subdivideWithSubMeshes) {
-        indiceArray.emplace_back(meshes[index]->getTotalIndices());
+        indiceArray.emplace_back(mesh->getTotalIndices());
       }
     }
   }
 
+  if (!source) {
+    return meshSubclass;
+  }
+
   if (!meshSubclass) {
     meshSubclass = Mesh::New(source->name + "_merged", source->getScene());
   }
 
-  if ((!vertexData) || (!source))
-    return meshSubclass;
-
   vertexData->applyToMesh(meshSubclass);
 
   // Setting properties
@@ -2501,13 +2814,11 @@ Mesh* Mesh::MergeMeshes(std::vector<Mesh*>& meshes, bool disposeSource,
   if (subdivideWithSubMeshes) {
     //-- Suppresions du submesh global
     meshSubclass->releaseSubMeshes();
-    index               = 0;
     unsigned int offset = 0;
     //-- aplique la subdivision en fonction du tableau d'indices
-    while (index < indiceArray.size()) {
-      SubMesh::CreateFromIndices(0, offset, indiceArray[index], meshSubclass);
-      offset += indiceArray[index];
-      ++index;
+    for (auto indexCount : indiceArray) {
+      SubMesh::CreateFromIndices(0, offset, indexCount, meshSubclass);
+      offset += indexCount;
     }
   }
 
@@ -0,0 +1,30 @@
+#include <babylon/mesh/static_batch_range.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/math/matrix.h>
+
+namespace BABYLON {
+
+StaticBatchRange::StaticBatchRange(const std::string& iSourceName,
+                                   unsigned int iIndexStart,
+                                   size_t iIndexCount, const Vector3& minimum,
+                                   const Vector3& maximum)
+    : sourceName{iSourceName}
+    , indexStart{iIndexStart}
+    , indexCount{iIndexCount}
+    , boundingInfo{std::make_unique<BoundingInfo>(minimum, maximum)}
+{
+  // The merged vertices are already in world space
+  boundingInfo->update(Matrix::Identity());
+}
+
+StaticBatchRange::StaticBatchRange(StaticBatchRange&& other) = default;
+
+StaticBatchRange& StaticBatchRange::
+operator=(StaticBatchRange&& other) = default;
+
+StaticBatchRange::~StaticBatchRange()
+{
+}
+
+} // end of namespace BABYLON
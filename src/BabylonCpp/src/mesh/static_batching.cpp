@@ -0,0 +1,482 @@
+#include <babylon/mesh/static_batching.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/materials/material.h>
+#include <babylon/math/matrix.h>
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/static_batch_range.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+namespace BABYLON {
+
+struct StaticBatching::Bucket {
+  struct Source {
+    Mesh* mesh;
+    Matrix world;
+    bool flipFaces;
+    // Vertex data of the source per batched kind
+    std::vector<const Float32Array*> data;
+    IndicesArray indices;
+    size_t verticesStart;
+    size_t verticesCount;
+    size_t indexStart;
+    size_t indexCount;
+    Vector3 minimum;
+    Vector3 maximum;
+  };
+  std::vector<Source> sources;
+  std::vector<unsigned int> kinds;
+  std::vector<unsigned int> sizes;
+  size_t totalVertices = 0;
+  size_t totalIndices  = 0;
+  // Merged vertex data per batched kind
+  std::vector<Float32Array> data;
+  IndicesArray indices;
+};
+
+namespace {
+
+// Batched vertex kinds, the other kinds (skinning, instancing) are never
+// merged
+constexpr std::array<unsigned int, 10> batchableKinds{{
+  VertexBuffer::PositionKind, VertexBuffer::NormalKind,
+  VertexBuffer::TangentKind, VertexBuffer::UVKind, VertexBuffer::UV2Kind,
+  VertexBuffer::UV3Kind, VertexBuffer::UV4Kind, VertexBuffer::UV5Kind,
+  VertexBuffer::UV6Kind, VertexBuffer::ColorKind //
+}};
+
+// Thread safe equivalent of Vector3::TransformCoordinatesFromFloatsToRef
+inline void transformCoordinates(const Matrix& world, const float* src,
+                                 float* dst)
+{
+  const auto& m = world.m;
+  const float x = src[0], y = src[1], z = src[2];
+  const float rx = x * m[0] + y * m[4] + z * m[8] + m[12];
+  const float ry = x * m[1] + y * m[5] + z * m[9] + m[13];
+  const float rz = x * m[2] + y * m[6] + z * m[10] + m[14];
+  const float rw = x * m[3] + y * m[7] + z * m[11] + m[15];
+  dst[0]         = rx / rw;
+  dst[1]         = ry / rw;
+  dst[2]         = rz / rw;
+}
+
+// Thread safe equivalent of Vector3::TransformNormalFromFloatsToRef followed
+// by a normalization
+inline void transformNormal(const Matrix& world, const float* src, float* dst)
+{
+  const auto& m = world.m;
+  const float x = src[0], y = src[1], z = src[2];
+  float rx = x * m[0] + y * m[4] + z * m[8];
+  float ry = x * m[1] + y * m[5] + z * m[9];
+  float rz = x * m[2] + y * m[6] + z * m[10];
+  const float length = std::sqrt(rx * rx + ry * ry + rz * rz);
+  if (length > 0.f) {
+    const float num = 1.f / length;
+    rx *= num;
+    ry *= num;
+    rz *= num;
+  }
+  dst[0] = rx;
+  dst[1] = ry;
+  dst[2] = rz;
+}
+
+} // end of anonymous namespace
+
+StaticBatching::StaticBatching()
+    : cellSize{0.f}
+    , maxVerticesPerBatch{0}
+    , maxThreads{std::max(1u, std::thread::hardware_concurrency())}
+    , disposeSource{true}
+{
+}
+
+StaticBatching::~StaticBatching()
+{
+}
+
+bool StaticBatching::CanBeBatched(AbstractMesh* abstractMesh)
+{
+  // Check if instance of Mesh (lines meshes use a different draw mode)
+  if (!abstractMesh
+      || !((abstractMesh->type() == IReflect::Type::MESH)
+           || (abstractMesh->type() == IReflect::Type::GROUNDMESH))) {
+    return false;
+  }
+
+  auto mesh = static_cast<Mesh*>(abstractMesh);
+
+  if (!mesh->isVisible || !mesh->isEnabled() || mesh->isDisposed()
+      || mesh->isBlocked()) {
+    return false;
+  }
+
+  // Animated or driven meshes are not static
+  if (!mesh->instances.empty() || mesh->skeleton() || mesh->hasLODLevels()
+      || mesh->morphTargetManager() || mesh->parent()
+      || !mesh->getChildren().empty() || mesh->actionManager) {
+    return false;
+  }
+
+  // Meshes with several sub meshes may use a multi material
+  if (mesh->_unIndexed || mesh->subMeshes.size() != 1
+      || !mesh->isVerticesDataPresent(VertexBuffer::PositionKind)) {
+    return false;
+  }
+
+  if (mesh->onBeforeRenderObservable.hasObservers()
+      || mesh->onAfterRenderObservable.hasObservers()
+      || mesh->onBeforeDrawObservable.hasObservers()) {
+    return false;
+  }
+
+  return true;
+}
+
+std::vector<unsigned int> StaticBatching::_GetBatchedKinds(Mesh* mesh)
+{
+  std::vector<unsigned int> kinds;
+  for (auto kind : batchableKinds) {
+    if (mesh->isVerticesDataPresent(kind)) {
+      kinds.emplace_back(kind);
+    }
+  }
+  return kinds;
+}
+
+std::vector<Mesh*> StaticBatching::apply(Scene* scene)
+{
+  std::vector<Mesh*> meshes;
+  for (auto& mesh : scene->getMeshes()) {
+    if (StaticBatching::CanBeBatched(mesh)) {
+      meshes.emplace_back(static_cast<Mesh*>(mesh));
+    }
+  }
+
+  return apply(meshes);
+}
+
+std::vector<Mesh*> StaticBatching::apply(const std::vector<Mesh*>& meshes)
+{
+  std::vector<Mesh*> mergedMeshes;
+  if (meshes.size() < 2) {
+    return mergedMeshes;
+  }
+
+  auto scene = meshes.front()->getScene();
+
+  // Bucket the meshes by material, rendering state, vertex layout and spatial
+  // cell
+  using BucketKey
+    = std::tuple<Material*, bool, bool, unsigned int, unsigned int,
+                 std::vector<unsigned int>, int, int, int>;
+  std::map<BucketKey, std::vector<Mesh*>> pools;
+  for (auto& mesh : meshes) {
+    if (!StaticBatching::CanBeBatched(mesh)) {
+      continue;
+    }
+
+    mesh->computeWorldMatrix(true);
+
+    std::vector<unsigned int> layout;
+    for (auto kind : _GetBatchedKinds(mesh)) {
+      layout.emplace_back(kind);
+      layout.emplace_back(
+        static_cast<unsigned int>(mesh->getVertexBuffer(kind)->getSize()));
+    }
+
+    int cellX = 0, cellY = 0, cellZ = 0;
+    if (cellSize > 0.f) {
+      const auto& center = mesh->getBoundingInfo()->boundingBox.centerWorld;
+      cellX              = static_cast<int>(std::floor(center.x / cellSize));
+      cellY              = static_cast<int>(std::floor(center.y / cellSize));
+      cellZ              = static_cast<int>(std::floor(center.z / cellSize));
+    }
+
+    pools[BucketKey{mesh->getMaterial(), mesh->checkCollisions(),
+                    mesh->receiveShadows(), mesh->layerMask,
+                    mesh->renderingGroupId, std::move(layout), cellX, cellY,
+                    cellZ}]
+      .emplace_back(mesh);
+  }
+
+  // Split the pools in buckets fitting in the index format
+  size_t maxVertices = maxVerticesPerBatch;
+  if (maxVertices == 0) {
+    maxVertices = scene->getEngine()->getCaps().uintIndices ?
+                    std::numeric_limits<size_t>::max() :
+                    65536;
+  }
+
+  std::vector<Bucket> buckets;
+  for (auto& item : pools) {
+    auto& pool = item.second;
+    std::vector<Mesh*> bucketMeshes;
+    size_t bucketVertices = 0;
+    auto flush            = [&]() {
+      if (bucketMeshes.size() > 1) {
+        Bucket bucket;
+        for (auto& mesh : bucketMeshes) {
+          Bucket::Source source;
+          source.mesh  = mesh;
+          source.world = *mesh->getWorldMatrix();
+          bucket.sources.emplace_back(std::move(source));
+        }
+        bucket.kinds = _GetBatchedKinds(bucketMeshes.front());
+        buckets.emplace_back(std::move(bucket));
+      }
+      bucketMeshes.clear();
+      bucketVertices = 0;
+    };
+    for (auto& mesh : pool) {
+      const auto verticesCount = mesh->getTotalVertices();
+      if (!bucketMeshes.empty()
+          && bucketVertices + verticesCount > maxVertices) {
+        flush();
+      }
+      bucketMeshes.emplace_back(mesh);
+      bucketVertices += verticesCount;
+    }
+    flush();
+  }
+
+  if (buckets.empty()) {
+    return mergedMeshes;
+  }
+
+  // Compute the layout of each merged mesh and fill them
+  for (auto& bucket : buckets) {
+    _PrepareBucket(bucket);
+  }
+  _fillBuckets(buckets);
+
+  // Create the merged meshes
+  mergedMeshes.reserve(buckets.size());
+  for (auto& bucket : buckets) {
+    auto mergedMesh
+      = Mesh::New(bucket.sources.front().mesh->name + "_batched", scene);
+    _ApplyBucket(bucket, mergedMesh);
+    auto firstSource = bucket.sources.front().mesh;
+    mergedMesh->setReceiveShadows(firstSource->receiveShadows());
+    mergedMesh->layerMask        = firstSource->layerMask;
+    mergedMesh->renderingGroupId = firstSource->renderingGroupId;
+    mergedMesh->freezeWorldMatrix();
+    _SetBatchRanges(bucket, mergedMesh);
+    mergedMeshes.emplace_back(mergedMesh);
+
+    // Cleaning
+    if (disposeSource) {
+      for (auto& source : bucket.sources) {
+        source.mesh->dispose();
+      }
+    }
+  }
+
+  return mergedMeshes;
+}
+
+void StaticBatching::_PrepareBucket(Bucket& bucket)
+{
+  // Vertex sizes, a kind is only kept when all the sources agree on its size
+  bucket.sizes.clear();
+  std::vector<unsigned int> kinds;
+  for (auto kind : bucket.kinds) {
+    const auto size
+      = bucket.sources.front().mesh->getVertexBuffer(kind)->getSize();
+    bool sameSize = true;
+    for (auto& source : bucket.sources) {
+      sameSize = sameSize
+                 && (source.mesh->getVertexBuffer(kind)->getSize() == size);
+    }
+    if (sameSize) {
+      kinds.emplace_back(kind);
+      bucket.sizes.emplace_back(static_cast<unsigned int>(size));
+    }
+  }
+  bucket.kinds = std::move(kinds);
+
+  // Ranges of each source in the merged mesh
+  bucket.totalVertices = 0;
+  bucket.totalIndices  = 0;
+  for (auto& source : bucket.sources) {
+    source.flipFaces     = source.world.determinant() < 0.f;
+    source.verticesStart = bucket.totalVertices;
+    source.verticesCount = source.mesh->getTotalVertices();
+    source.indexStart    = bucket.totalIndices;
+    source.indexCount    = source.mesh->getTotalIndices();
+    source.data.clear();
+    for (auto kind : bucket.kinds) {
+      source.data.emplace_back(&source.mesh->getVertexBuffer(kind)->getData());
+    }
+    // Read on the calling thread, the buckets are filled on worker threads
+    source.indices = source.mesh->getIndices();
+    bucket.totalVertices += source.verticesCount;
+    bucket.totalIndices += source.indexCount;
+  }
+
+  // Preallocate the merged data
+  bucket.data.clear();
+  for (auto size : bucket.sizes) {
+    bucket.data.emplace_back(Float32Array(bucket.totalVertices * size));
+  }
+  bucket.indices.resize(bucket.totalIndices);
+}
+
+void StaticBatching::_FillBucket(Bucket& bucket)
+{
+  for (auto& source : bucket.sources) {
+    const auto& world = source.world;
+
+    // Vertex data
+    for (size_t k = 0; k < bucket.kinds.size(); ++k) {
+      const auto kind = bucket.kinds[k];
+      const auto size = bucket.sizes[k];
+      const auto& src = *source.data[k];
+      auto dst        = bucket.data[k].data() + source.verticesStart * size;
+      const auto count
+        = std::min(source.verticesCount, src.size() / std::max(1u, size));
+
+      if (kind == VertexBuffer::PositionKind) {
+        source.minimum = Vector3(std::numeric_limits<float>::max(),
+                                 std::numeric_limits<float>::max(),
+                                 std::numeric_limits<float>::max());
+        source.maximum = Vector3(std::numeric_limits<float>::lowest(),
+                                 std::numeric_limits<float>::lowest(),
+                                 std::numeric_limits<float>::lowest());
+        for (size_t v = 0; v < count; ++v) {
+          auto position = dst + v * size;
+          transformCoordinates(world, src.data() + v * size, position);
+          source.minimum.x = std::min(source.minimum.x, position[0]);
+          source.minimum.y = std::min(source.minimum.y, position[1]);
+          source.minimum.z = std::min(source.minimum.z, position[2]);
+          source.maximum.x = std::max(source.maximum.x, position[0]);
+          source.maximum.y = std::max(source.maximum.y, position[1]);
+          source.maximum.z = std::max(source.maximum.z, position[2]);
+        }
+      }
+      else if ((kind == VertexBuffer::NormalKind
+                || kind == VertexBuffer::TangentKind)
+               && size >= 3) {
+        for (size_t v = 0; v < count; ++v) {
+          transformNormal(world, src.data() + v * size, dst + v * size);
+          // Tangent handedness
+          for (size_t c = 3; c < size; ++c) {
+            dst[v * size + c] = src[v * size + c];
+          }
+        }
+      }
+      else {
+        std::copy(src.begin(), src.begin() + count * size, dst);
+      }
+    }
+
+    // Indices
+    const auto& indices = source.indices;
+    const auto offset   = static_cast<uint32_t>(source.verticesStart);
+    auto dst            = bucket.indices.data() + source.indexStart;
+    const auto count    = std::min(source.indexCount, indices.size());
+    if (source.flipFaces) {
+      // Negative scaling: restore the winding order
+      for (size_t i = 0; i + 2 < count; i += 3) {
+        dst[i]     = indices[i] + offset;
+        dst[i + 1] = indices[i + 2] + offset;
+        dst[i + 2] = indices[i + 1] + offset;
+      }
+    }
+    else {
+      for (size_t i = 0; i < count; ++i) {
+        dst[i] = indices[i] + offset;
+      }
+    }
+    source.indices.clear();
+  }
+}
+
+void StaticBatching::_fillBuckets(std::vector<Bucket>& buckets)
+{
+  const size_t threadCount
+    = std::min(static_cast<size_t>(std::max(1u, maxThreads)), buckets.size());
+  if (threadCount <= 1) {
+    for (auto& bucket : buckets) {
+      _FillBucket(bucket);
+    }
+    return;
+  }
+
+  // Split the buckets in chunks with roughly the same number of vertices
+  size_t totalVertices = 0;
+  for (auto& bucket : buckets) {
+    totalVertices += bucket.totalVertices;
+  }
+  std::vector<std::vector<Bucket*>> chunks(threadCount);
+  const size_t verticesPerChunk
+    = (totalVertices + threadCount - 1) / threadCount;
+  size_t chunk = 0, chunkSize = 0;
+  for (auto& bucket : buckets) {
+    chunks[chunk].emplace_back(&bucket);
+    chunkSize += bucket.totalVertices;
+    if (chunkSize >= verticesPerChunk && chunk + 1 < threadCount) {
+      ++chunk;
+      chunkSize = 0;
+    }
+  }
+
+  auto processChunk = [](const std::vector<Bucket*>& chunkBuckets) {
+    for (auto& bucket : chunkBuckets) {
+      _FillBucket(*bucket);
+    }
+  };
+
+  std::vector<std::future<void>> workers;
+  workers.reserve(threadCount - 1);
+  for (size_t c = 1; c < threadCount; ++c) {
+    workers.emplace_back(
+      std::async(std::launch::async, processChunk, std::cref(chunks[c])));
+  }
+  processChunk(chunks[0]);
+  for (auto& worker : workers) {
+    worker.get();
+  }
+}
+
+void StaticBatching::_ApplyBucket(Bucket& bucket, Mesh* target)
+{
+  auto source = bucket.sources.front().mesh;
+
+  for (size_t k = 0; k < bucket.kinds.size(); ++k) {
+    target->setVerticesData(bucket.kinds[k], bucket.data[k], false,
+                            static_cast<int>(bucket.sizes[k]));
+  }
+  target->setIndices(bucket.indices, bucket.totalVertices);
+
+  // Setting properties
+  target->setMaterial(source->getMaterial());
+  target->setCheckCollisions(source->checkCollisions());
+
+  // Release the merged data
+  bucket.data.clear();
+  bucket.indices.clear();
+}
+
+void StaticBatching::_SetBatchRanges(const Bucket& bucket, Mesh* target)
+{
+  // Index range of each source mesh, culled individually at render time. The
+  // bounds are in world space, so the target must be frozen
+  std::vector<StaticBatchRange> ranges;
+  ranges.reserve(bucket.sources.size());
+  for (auto& batchSource : bucket.sources) {
+    if (batchSource.indexCount == 0) {
+      continue;
+    }
+    ranges.emplace_back(batchSource.mesh->name,
+                        static_cast<unsigned int>(batchSource.indexStart),
+                        batchSource.indexCount, batchSource.minimum,
+                        batchSource.maximum);
+  }
+  target->setStaticBatchRanges(std::move(ranges));
+}
+
+} // end of namespace BABYLON
@@ -32,6 +32,7 @@ SubMesh::SubMesh(unsigned int iMaterialIndex, unsigned int iVerticesStart,
     , _renderId{0}
     , _materialDefines{nullptr}
     , _materialEffect{nullptr}
+    , _autoInstances{nullptr}
     , _mesh{mesh}
     , _renderingMesh{renderingMesh}
     , _boundingInfo{nullptr}
@@ -78,8 +79,11 @@ void SubMesh::setEffect(Effect* effect, const MaterialDefines& defines)
   if (_materialEffect == effect) {
     return;
   }
-  _materialDefines = std::make_unique<MaterialDefines>(defines);
-  _materialEffect  = effect;
+  // The defines of the materials are updated in place
+  if (_materialDefines.get() != &defines) {
+    _materialDefines = std::make_unique<MaterialDefines>(defines);
+  }
+  _materialEffect = effect;
 }
 
 bool SubMesh::isGlobal() const
@@ -252,12 +256,16 @@ SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions,
         continue;
       }
 
-      if (fastCheck || !intersectInfo || length < intersectInfo->distance) {
+      // Reuse the intersection info of the closest segment
+      if (!intersectInfo) {
         intersectInfo = std::make_unique<IntersectionInfo>(length);
+      }
+      else if (length < intersectInfo->distance) {
+        intersectInfo->distance = length;
+      }
 
-        if (fastCheck) {
-          break;
-        }
+      if (fastCheck) {
+        break;
       }
     }
   }
@@ -2,6 +2,7 @@
 
 #include <babylon/engine/engine.h>
 #include <babylon/mesh/buffer.h>
+#include <babylon/mesh/vertex_compression.h>
 
 namespace BABYLON {
 
@@ -25,6 +26,11 @@ constexpr unsigned int VertexBuffer::World2Kind;
 constexpr unsigned int VertexBuffer::World3Kind;
 constexpr unsigned int VertexBuffer::CellInfoKind;
 constexpr unsigned int VertexBuffer::OptionsKind;
+constexpr unsigned int VertexBuffer::InstanceColorKind;
+constexpr unsigned int VertexBuffer::MaxMorphTargetInfluencers;
+constexpr unsigned int VertexBuffer::MorphTargetPositionKind;
+constexpr unsigned int VertexBuffer::MorphTargetNormalKind;
+constexpr unsigned int VertexBuffer::MorphTargetTangentKind;
 
 constexpr const char* VertexBuffer::PositionKindChars;
 constexpr const char* VertexBuffer::NormalKindChars;
@@ -46,6 +52,7 @@ constexpr const char* VertexBuffer::World2KindChars;
 constexpr const char* VertexBuffer::World3KindChars;
 constexpr const char* VertexBuffer::CellInfoKindChars;
 constexpr const char* VertexBuffer::OptionsKindChars;
+constexpr const char* VertexBuffer::InstanceColorKindChars;
 
 VertexBuffer::VertexBuffer(Engine* engine, const Float32Array& data,
                            unsigned int kind, bool updatable,
@@ -78,12 +85,38 @@ VertexBuffer::VertexBuffer(Engine* /*engine*/, Buffer* buffer,
   _size   = (size != -1) ? size : _stride;
 }
 
+VertexBuffer::VertexBuffer(Engine* engine, const Uint16Array& packedData,
+                           unsigned int kind, unsigned int format, int stride,
+                           const std::array<float, 4>& quantizationCube)
+    : _ownedBuffer{nullptr}
+    , _buffer{nullptr}
+    , _kind{kind}
+    , _offset{0}
+    , _size{stride}
+    , _stride{stride}
+    , _ownsBuffer{true}
+{
+  _ownedBuffer = std::make_unique<Buffer>(engine, packedData, format, stride,
+                                          quantizationCube);
+}
+
 VertexBuffer::~VertexBuffer()
 {
 }
 
 std::string VertexBuffer::KindAsString(unsigned int kind)
 {
+  if (kind >= VertexBuffer::MorphTargetPositionKind
+      && kind < VertexBuffer::MorphTargetTangentKind
+                  + VertexBuffer::MaxMorphTargetInfluencers) {
+    static const std::array<const char*, 3> morphTargetKinds{
+      {VertexBuffer::PositionKindChars, VertexBuffer::NormalKindChars,
+       VertexBuffer::TangentKindChars}};
+    const auto offset = kind - VertexBuffer::MorphTargetPositionKind;
+    return std::string(
+             morphTargetKinds[offset / VertexBuffer::MaxMorphTargetInfluencers])
+           + std::to_string(offset % VertexBuffer::MaxMorphTargetInfluencers);
+  }
 
   switch (kind) {
     case VertexBuffer::PositionKind:
@@ -127,9 +160,58 @@ std::string VertexBuffer::KindAsString(unsigned int kind)
       return std::string(VertexBuffer::CellInfoKindChars);
     case VertexBuffer::OptionsKind:
       return std::string(VertexBuffer::OptionsKindChars);
+    case VertexBuffer::InstanceColorKind:
+      return std::string(VertexBuffer::InstanceColorKindChars);
   }
 }
 
+unsigned int VertexBuffer::KindFromString(const std::string& kind)
+{
+  static const std::unordered_map<std::string, unsigned int> kinds = []() {
+    std::unordered_map<std::string, unsigned int> _kinds{
+      {VertexBuffer::PositionKindChars, VertexBuffer::PositionKind},
+      {VertexBuffer::NormalKindChars, VertexBuffer::NormalKind},
+      {VertexBuffer::TangentKindChars, VertexBuffer::TangentKind},
+      {VertexBuffer::UVKindChars, VertexBuffer::UVKind},
+      {VertexBuffer::UV2KindChars, VertexBuffer::UV2Kind},
+      {VertexBuffer::UV3KindChars, VertexBuffer::UV3Kind},
+      {VertexBuffer::UV4KindChars, VertexBuffer::UV4Kind},
+      {VertexBuffer::UV5KindChars, VertexBuffer::UV5Kind},
+      {VertexBuffer::UV6KindChars, VertexBuffer::UV6Kind},
+      {VertexBuffer::ColorKindChars, VertexBuffer::ColorKind},
+      {VertexBuffer::MatricesIndicesKindChars,
+       VertexBuffer::MatricesIndicesKind},
+      {VertexBuffer::MatricesWeightsKindChars,
+       VertexBuffer::MatricesWeightsKind},
+      {VertexBuffer::MatricesIndicesExtraKindChars,
+       VertexBuffer::MatricesIndicesExtraKind},
+      {VertexBuffer::MatricesWeightsExtraKindChars,
+       VertexBuffer::MatricesWeightsExtraKind},
+      {VertexBuffer::World0KindChars, VertexBuffer::World0Kind},
+      {VertexBuffer::World1KindChars, VertexBuffer::World1Kind},
+      {VertexBuffer::World2KindChars, VertexBuffer::World2Kind},
+      {VertexBuffer::World3KindChars, VertexBuffer::World3Kind},
+      {VertexBuffer::CellInfoKindChars, VertexBuffer::CellInfoKind},
+      {VertexBuffer::OptionsKindChars, VertexBuffer::OptionsKind},
+      {VertexBuffer::InstanceColorKindChars, VertexBuffer::InstanceColorKind},
+    };
+    for (unsigned int index = 0;
+         index < VertexBuffer::MaxMorphTargetInfluencers; ++index) {
+      const auto indexStr = std::to_string(index);
+      _kinds[VertexBuffer::PositionKindChars + indexStr]
+        = VertexBuffer::MorphTargetPositionKind + index;
+      _kinds[VertexBuffer::NormalKindChars + indexStr]
+        = VertexBuffer::MorphTargetNormalKind + index;
+      _kinds[VertexBuffer::TangentKindChars + indexStr]
+        = VertexBuffer::MorphTargetTangentKind + index;
+    }
+    return _kinds;
+  }();
+
+  auto it = kinds.find(kind);
+  return (it != kinds.end()) ? it->second : 0;
+}
+
 int VertexBuffer::KindToStride(unsigned int kind)
 {
   int stride = -1;
@@ -151,6 +233,7 @@ int VertexBuffer::KindToStride(unsigned int kind)
       break;
     case VertexBuffer::TangentKind:
     case VertexBuffer::ColorKind:
+    case VertexBuffer::InstanceColorKind:
       stride = 4;
       break;
     case VertexBuffer::MatricesIndicesKind:
@@ -162,6 +245,12 @@ int VertexBuffer::KindToStride(unsigned int kind)
       stride = 4;
       break;
     default:
+      // Morph target positions, normals and tangents
+      if (kind >= VertexBuffer::MorphTargetPositionKind
+          && kind < VertexBuffer::MorphTargetTangentKind
+                      + VertexBuffer::MaxMorphTargetInfluencers) {
+        stride = 3;
+      }
       break;
   }
   return stride;
@@ -217,6 +306,53 @@ bool VertexBuffer::getIsInstanced() const
   return _getBuffer()->getIsInstanced();
 }
 
+unsigned int VertexBuffer::getFormat() const
+{
+  return _getBuffer()->getFormat();
+}
+
+const std::array<float, 4>& VertexBuffer::getQuantizationCube() const
+{
+  return _getBuffer()->getQuantizationCube();
+}
+
+unsigned int VertexBuffer::getAttributeType() const
+{
+  return VertexCompression::AttributeType(
+    static_cast<VertexCompression::Format>(getFormat()));
+}
+
+bool VertexBuffer::getAttributeNormalized() const
+{
+  return VertexCompression::IsNormalized(
+    static_cast<VertexCompression::Format>(getFormat()));
+}
+
+int VertexBuffer::getAttributeSize() const
+{
+  const auto format = static_cast<VertexCompression::Format>(getFormat());
+  return (format == VertexCompression::None) ?
+           _size :
+           VertexCompression::AttributeSize(format,
+                                            static_cast<size_t>(_stride));
+}
+
+int VertexBuffer::getByteStride() const
+{
+  const auto format = static_cast<VertexCompression::Format>(getFormat());
+  return (format == VertexCompression::None) ?
+           _stride * 4 :
+           static_cast<int>(VertexCompression::PackedWords(
+                              format, static_cast<size_t>(_stride))
+                            * 2);
+}
+
+int VertexBuffer::getByteOffset() const
+{
+  // Compressed vertices are not interleaved
+  return static_cast<int>(_offset * 4);
+}
+
 // Methods
 GL::IGLBuffer* VertexBuffer::create()
 {
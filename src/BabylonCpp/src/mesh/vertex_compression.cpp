@@ -0,0 +1,329 @@
+#include <babylon/mesh/vertex_compression.h>
+
+#include <cstring>
+
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+
+namespace {
+
+float signNotZero(float value)
+{
+  return (value >= 0.f) ? 1.f : -1.f;
+}
+
+// Signed normalized conversion of the GPU
+float snorm16ToFloat(int16_t value)
+{
+  const float result = static_cast<float>(value) / 32767.f;
+  return (result < -1.f) ? -1.f : result;
+}
+
+int16_t floatToSnorm16(float value)
+{
+  value = (value < -1.f) ? -1.f : ((value > 1.f) ? 1.f : value);
+  return static_cast<int16_t>(std::round(value * 32767.f));
+}
+
+uint16_t floatToUnorm(float value, float maximum)
+{
+  value = (value < 0.f) ? 0.f : ((value > 1.f) ? 1.f : value);
+  return static_cast<uint16_t>(std::round(value * maximum));
+}
+
+} // end of anonymous namespace
+
+Uint16Array VertexCompression::Encode(Format format, const Float32Array& data,
+                                      size_t components,
+                                      const QuantizationCube& cube)
+{
+  if (format == None || components == 0) {
+    return Uint16Array();
+  }
+
+  const size_t vertexCount = data.size() / components;
+  const size_t words       = PackedWords(format, components);
+  Uint16Array packed(vertexCount * words, 0);
+
+  for (size_t v = 0; v < vertexCount; ++v) {
+    const float* input = &data[v * components];
+    uint16_t* output   = &packed[v * words];
+    switch (format) {
+      case Unorm16: {
+        const float scale = (cube[3] > 0.f) ? 1.f / cube[3] : 0.f;
+        for (size_t c = 0; c < components; ++c) {
+          const float offset = (c < 3) ? cube[c] : 0.f;
+          output[c] = floatToUnorm((input[c] - offset) * scale, 65535.f);
+        }
+      } break;
+      case Octahedral16: {
+        int16_t encoded[2];
+        OctahedralEncode(input, encoded);
+        std::memcpy(output, encoded, sizeof(encoded));
+        if (components > 3) {
+          const int16_t handedness = floatToSnorm16(signNotZero(input[3]));
+          std::memcpy(&output[2], &handedness, sizeof(handedness));
+        }
+      } break;
+      case Half16:
+        for (size_t c = 0; c < components; ++c) {
+          output[c] = FloatToHalf(input[c]);
+        }
+        break;
+      case Unorm8:
+        for (size_t c = 0; c < 4; ++c) {
+          // Missing alpha is opaque
+          const uint16_t byte
+            = (c < components) ? floatToUnorm(input[c], 255.f) :
+                                 ((c == 3) ? 255 : 0);
+          output[c / 2] |= static_cast<uint16_t>(byte << ((c % 2) * 8));
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  return packed;
+}
+
+Float32Array VertexCompression::Decode(Format format, const Uint16Array& packed,
+                                       size_t components,
+                                       const QuantizationCube& cube)
+{
+  const size_t words = PackedWords(format, components);
+  if (format == None || words == 0) {
+    return Float32Array();
+  }
+
+  const size_t vertexCount = packed.size() / words;
+  Float32Array data(vertexCount * components);
+
+  for (size_t v = 0; v < vertexCount; ++v) {
+    const uint16_t* input = &packed[v * words];
+    float* output         = &data[v * components];
+    switch (format) {
+      case Unorm16:
+        for (size_t c = 0; c < components; ++c) {
+          const float offset = (c < 3) ? cube[c] : 0.f;
+          const float value  = static_cast<float>(input[c]) / 65535.f;
+          output[c]          = offset + value * cube[3];
+        }
+        break;
+      case Octahedral16: {
+        int16_t encoded[3];
+        std::memcpy(encoded, input, sizeof(int16_t) * (components > 3 ? 3 : 2));
+        OctahedralDecode(encoded, output);
+        if (components > 3) {
+          output[3] = signNotZero(snorm16ToFloat(encoded[2]));
+        }
+      } break;
+      case Half16:
+        for (size_t c = 0; c < components; ++c) {
+          output[c] = HalfToFloat(input[c]);
+        }
+        break;
+      case Unorm8:
+        for (size_t c = 0; c < components && c < 4; ++c) {
+          const auto byte = (input[c / 2] >> ((c % 2) * 8)) & 0xFF;
+          output[c]       = static_cast<float>(byte) / 255.f;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  return data;
+}
+
+VertexCompression::QuantizationCube
+VertexCompression::ComputeQuantizationCube(const Float32Array& positions,
+                                           size_t components)
+{
+  QuantizationCube cube{{0.f, 0.f, 0.f, 1.f}};
+  if (components < 3 || positions.size() < components) {
+    return cube;
+  }
+
+  std::array<float, 3> minimum{{positions[0], positions[1], positions[2]}};
+  std::array<float, 3> maximum = minimum;
+  for (size_t i = 0; i + components <= positions.size(); i += components) {
+    for (size_t c = 0; c < 3; ++c) {
+      minimum[c] = std::min(minimum[c], positions[i + c]);
+      maximum[c] = std::max(maximum[c], positions[i + c]);
+    }
+  }
+
+  float size = 0.f;
+  for (size_t c = 0; c < 3; ++c) {
+    cube[c] = minimum[c];
+    size    = std::max(size, maximum[c] - minimum[c]);
+  }
+  cube[3] = (size > 0.f) ? size : 1.f;
+
+  return cube;
+}
+
+size_t VertexCompression::PackedWords(Format format, size_t components)
+{
+  switch (format) {
+    case Unorm16:
+    case Half16:
+      // Vertices aligned on 4 bytes
+      return (components + 1) & ~static_cast<size_t>(1);
+    case Octahedral16:
+      return (components > 3) ? 4 : 2;
+    case Unorm8:
+      return 2;
+    default:
+      return 0;
+  }
+}
+
+unsigned int VertexCompression::AttributeType(Format format)
+{
+  switch (format) {
+    case Unorm16:
+      return GL::UNSIGNED_SHORT;
+    case Octahedral16:
+      return GL::SHORT;
+    case Half16:
+      return GL::HALF_FLOAT;
+    case Unorm8:
+      return GL::UNSIGNED_BYTE;
+    default:
+      return GL::FLOAT;
+  }
+}
+
+bool VertexCompression::IsNormalized(Format format)
+{
+  return (format == Unorm16) || (format == Octahedral16) || (format == Unorm8);
+}
+
+int VertexCompression::AttributeSize(Format format, size_t components)
+{
+  if (format == Octahedral16) {
+    return (components > 3) ? 3 : 2;
+  }
+  return static_cast<int>(components);
+}
+
+uint16_t VertexCompression::FloatToHalf(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+
+  const uint16_t sign     = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  const uint32_t exponent = (bits >> 23) & 0xFF;
+  uint32_t mantissa       = bits & 0x7FFFFF;
+
+  // Infinity and NaN
+  if (exponent == 0xFF) {
+    return sign | 0x7C00 | (mantissa ? 0x200 : 0);
+  }
+
+  const int halfExponent = static_cast<int>(exponent) - 127 + 15;
+  if (halfExponent >= 31) {
+    return sign | 0x7C00;
+  }
+
+  // Rounded to the nearest even value
+  uint32_t half, shift;
+  if (halfExponent <= 0) {
+    // Subnormal
+    if (halfExponent < -10) {
+      return sign;
+    }
+    mantissa |= 0x800000;
+    shift = static_cast<uint32_t>(14 - halfExponent);
+    half  = mantissa >> shift;
+  }
+  else {
+    shift = 13;
+    half  = (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+  }
+  const uint32_t remainder = mantissa & ((1u << shift) - 1);
+  const uint32_t middle    = 1u << (shift - 1);
+  if (remainder > middle || (remainder == middle && (half & 1))) {
+    ++half;
+  }
+
+  return sign | static_cast<uint16_t>(half);
+}
+
+float VertexCompression::HalfToFloat(uint16_t value)
+{
+  const uint32_t sign     = static_cast<uint32_t>(value & 0x8000) << 16;
+  const uint32_t exponent = (value >> 10) & 0x1F;
+  const uint32_t mantissa = value & 0x3FF;
+
+  if (exponent == 0) {
+    const float result = std::ldexp(static_cast<float>(mantissa), -24);
+    return sign ? -result : result;
+  }
+
+  const uint32_t bits
+    = sign
+      | ((exponent == 31) ? (0x7F800000 | (mantissa << 13)) :
+                            (((exponent + 112) << 23) | (mantissa << 13)));
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+void VertexCompression::OctahedralEncode(const float* vector, int16_t* encoded)
+{
+  const float length
+    = std::abs(vector[0]) + std::abs(vector[1]) + std::abs(vector[2]);
+  if (length <= 0.f) {
+    encoded[0] = encoded[1] = 0;
+    return;
+  }
+
+  // Projection on the octahedron, then on the z = 0 plane
+  float x = vector[0] / length, y = vector[1] / length;
+  if (vector[2] < 0.f) {
+    const float ox = x;
+    x              = (1.f - std::abs(y)) * signNotZero(ox);
+    y              = (1.f - std::abs(ox)) * signNotZero(y);
+  }
+
+  // Keeps the rounding which decodes to the closest direction
+  const float fx = std::floor(x * 32767.f), fy = std::floor(y * 32767.f);
+  float bestDot = -2.f;
+  for (int i = 0; i < 4; ++i) {
+    const int16_t candidate[2]
+      = {floatToSnorm16((fx + static_cast<float>(i & 1)) / 32767.f),
+         floatToSnorm16((fy + static_cast<float>(i >> 1)) / 32767.f)};
+    float decoded[3];
+    OctahedralDecode(candidate, decoded);
+    const float dot = decoded[0] * vector[0] + decoded[1] * vector[1]
+                      + decoded[2] * vector[2];
+    if (dot > bestDot) {
+      bestDot    = dot;
+      encoded[0] = candidate[0];
+      encoded[1] = candidate[1];
+    }
+  }
+}
+
+void VertexCompression::OctahedralDecode(const int16_t* encoded, float* vector)
+{
+  float x = snorm16ToFloat(encoded[0]), y = snorm16ToFloat(encoded[1]);
+  const float z = 1.f - std::abs(x) - std::abs(y);
+  if (z < 0.f) {
+    const float ox = x;
+    x              = (1.f - std::abs(y)) * signNotZero(ox);
+    y              = (1.f - std::abs(ox)) * signNotZero(y);
+  }
+
+  const float length = std::sqrt(x * x + y * y + z * z);
+  vector[0]          = x / length;
+  vector[1]          = y / length;
+  vector[2]          = z / length;
+}
+
+} // end of namespace BABYLON
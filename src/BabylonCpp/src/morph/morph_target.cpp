@@ -1,14 +1,22 @@
 #include <babylon/morph/morph_target.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/json.h>
+#include <babylon/core/logging.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
 
 namespace BABYLON {
 
 MorphTarget::MorphTarget(const std::string& name, float influence)
-    : _name{name}, _influence{std::numeric_limits<float>::max()}
+    : _name{name}
+    , _isSparse{false}
+    , _vertexCount{0}
+    , _influence{std::numeric_limits<float>::max()}
 {
   setInfluence(influence);
 }
@@ -39,17 +47,26 @@ void MorphTarget::setInfluence(float influence)
 
 bool MorphTarget::hasNormals() const
 {
-  return !_normals.empty();
+  return _isSparse ? !_normalDeltas.empty() : !_normals.empty();
 }
 
 bool MorphTarget::hasTangents() const
 {
-  return !_tangents.empty();
+  return _isSparse ? !_tangentDeltas.empty() : !_tangents.empty();
 }
 
 void MorphTarget::setPositions(const Float32Array& data)
 {
-  _positions = data;
+  if (_isSparse) {
+    // Back to a dense target
+    _isSparse = false;
+    _sparseIndices.clear();
+    _positionDeltas.clear();
+    _normalDeltas.clear();
+    _tangentDeltas.clear();
+  }
+  _positions   = data;
+  _vertexCount = _positions.size() / 3;
 }
 
 Float32Array& MorphTarget::getPositions()
@@ -92,6 +109,192 @@ const Float32Array& MorphTarget::getTangents() const
   return _tangents;
 }
 
+std::size_t MorphTarget::vertexCount() const
+{
+  return _vertexCount;
+}
+
+bool MorphTarget::isSparse() const
+{
+  return _isSparse;
+}
+
+void MorphTarget::setSparseDeltas(std::size_t vertexCount,
+                                  const Uint32Array& indices,
+                                  const Float32Array& positionDeltas,
+                                  const Float32Array& normalDeltas,
+                                  const Float32Array& tangentDeltas)
+{
+  const auto deltaCount = indices.size() * 3;
+  if (positionDeltas.size() != deltaCount
+      || (!normalDeltas.empty() && normalDeltas.size() != deltaCount)
+      || (!tangentDeltas.empty() && tangentDeltas.size() != deltaCount)) {
+    BABYLON_LOG_ERROR("MorphTarget",
+                      "Invalid sparse target. Deltas must have 3 components "
+                      "per index.");
+    return;
+  }
+  for (auto index : indices) {
+    if (index >= vertexCount) {
+      BABYLON_LOGF_ERROR("MorphTarget",
+                         "Invalid sparse target. Vertex index %u is out of "
+                         "range.",
+                         index);
+      return;
+    }
+  }
+
+  _isSparse       = true;
+  _vertexCount    = vertexCount;
+  _sparseIndices  = indices;
+  _positionDeltas = positionDeltas;
+  _normalDeltas   = normalDeltas;
+  _tangentDeltas  = tangentDeltas;
+  // Release the dense data
+  Float32Array().swap(_positions);
+  Float32Array().swap(_normals);
+  Float32Array().swap(_tangents);
+}
+
+bool MorphTarget::makeSparse(const Float32Array& basePositions,
+                             const Float32Array& baseNormals,
+                             const Float32Array& baseTangents, float epsilon)
+{
+  if (_isSparse) {
+    return true;
+  }
+
+  // The normals and the tangents can only be converted with their base data
+  if (basePositions.size() != _positions.size()
+      || (hasNormals() && baseNormals.size() != _normals.size())
+      || (hasTangents() && baseTangents.size() != _tangents.size())) {
+    return false;
+  }
+
+  const auto moved = [epsilon](const Float32Array& data,
+                               const Float32Array& base, size_t offset) {
+    return !data.empty()
+           && (std::abs(data[offset] - base[offset]) > epsilon
+               || std::abs(data[offset + 1] - base[offset + 1]) > epsilon
+               || std::abs(data[offset + 2] - base[offset + 2]) > epsilon);
+  };
+  const auto appendDelta
+    = [](const Float32Array& data, const Float32Array& base, size_t offset,
+         Float32Array& deltas) {
+        if (!data.empty()) {
+          deltas.emplace_back(data[offset] - base[offset]);
+          deltas.emplace_back(data[offset + 1] - base[offset + 1]);
+          deltas.emplace_back(data[offset + 2] - base[offset + 2]);
+        }
+      };
+
+  Uint32Array indices;
+  Float32Array positionDeltas, normalDeltas, tangentDeltas;
+  for (size_t index = 0, offset = 0; index < _vertexCount;
+       ++index, offset += 3) {
+    if (moved(_positions, basePositions, offset)
+        || moved(_normals, baseNormals, offset)
+        || moved(_tangents, baseTangents, offset)) {
+      indices.emplace_back(static_cast<uint32_t>(index));
+      appendDelta(_positions, basePositions, offset, positionDeltas);
+      appendDelta(_normals, baseNormals, offset, normalDeltas);
+      appendDelta(_tangents, baseTangents, offset, tangentDeltas);
+    }
+  }
+
+  setSparseDeltas(_vertexCount, indices, positionDeltas, normalDeltas,
+                  tangentDeltas);
+  return true;
+}
+
+const Uint32Array& MorphTarget::sparseIndices() const
+{
+  return _sparseIndices;
+}
+
+const Float32Array& MorphTarget::positionDeltas() const
+{
+  return _positionDeltas;
+}
+
+const Float32Array& MorphTarget::normalDeltas() const
+{
+  return _normalDeltas;
+}
+
+const Float32Array& MorphTarget::tangentDeltas() const
+{
+  return _tangentDeltas;
+}
+
+Float32Array
+MorphTarget::densePositions(const Float32Array& basePositions) const
+{
+  return _dense(_positions, _positionDeltas, basePositions);
+}
+
+Float32Array MorphTarget::denseNormals(const Float32Array& baseNormals) const
+{
+  return _dense(_normals, _normalDeltas, baseNormals);
+}
+
+Float32Array MorphTarget::denseTangents(const Float32Array& baseTangents) const
+{
+  return _dense(_tangents, _tangentDeltas, baseTangents);
+}
+
+void MorphTarget::accumulatePositions(const Float32Array& basePositions,
+                                      Float32Array& result) const
+{
+  _accumulate(_positions, _positionDeltas, basePositions, result);
+}
+
+void MorphTarget::accumulateNormals(const Float32Array& baseNormals,
+                                    Float32Array& result) const
+{
+  _accumulate(_normals, _normalDeltas, baseNormals, result);
+}
+
+void MorphTarget::accumulateTangents(const Float32Array& baseTangents,
+                                     Float32Array& result) const
+{
+  _accumulate(_tangents, _tangentDeltas, baseTangents, result);
+}
+
+Float32Array MorphTarget::_dense(const Float32Array& data,
+                                 const Float32Array& deltas,
+                                 const Float32Array& base) const
+{
+  if (!_isSparse) {
+    return data;
+  }
+  if (deltas.empty()) {
+    return Float32Array();
+  }
+
+  Float32Array result(base);
+  result.resize(_vertexCount * 3, 0.f);
+  AccumulateSparse(_sparseIndices, deltas, 1.f, result);
+  return result;
+}
+
+void MorphTarget::_accumulate(const Float32Array& data,
+                              const Float32Array& deltas,
+                              const Float32Array& base,
+                              Float32Array& result) const
+{
+  if (_influence == 0.f) {
+    return;
+  }
+
+  if (_isSparse) {
+    AccumulateSparse(_sparseIndices, deltas, _influence, result);
+  }
+  else if (!data.empty()) {
+    AccumulateDense(data, base, _influence, result);
+  }
+}
+
 Json::object MorphTarget::serialize() const
 {
   return Json::object();
@@ -111,7 +314,7 @@ MorphTarget::Parse(const Json::value& serializationObject)
   }
 
   if (serializationObject.contains("tangents")) {
-    result->setNormals(Json::ToArray<float>(serializationObject, "tangents"));
+    result->setTangents(Json::ToArray<float>(serializationObject, "tangents"));
   }
 
   return result;
@@ -141,4 +344,63 @@ std::unique_ptr<MorphTarget> MorphTarget::FromMesh(AbstractMesh* mesh,
   return result;
 }
 
+void MorphTarget::AccumulateDense(const Float32Array& target,
+                                  const Float32Array& base, float weight,
+                                  Float32Array& result)
+{
+  const auto count
+    = std::min(std::min(target.size(), base.size()), result.size());
+  const float* t = target.data();
+  const float* b = base.data();
+  float* r       = result.data();
+
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128 w = _mm_set1_ps(weight);
+  for (; i + 4 <= count; i += 4) {
+    const __m128 delta = _mm_sub_ps(_mm_loadu_ps(t + i), _mm_loadu_ps(b + i));
+    _mm_storeu_ps(r + i, _mm_add_ps(_mm_loadu_ps(r + i), _mm_mul_ps(w, delta)));
+  }
+#endif
+  for (; i < count; ++i) {
+    r[i] += weight * (t[i] - b[i]);
+  }
+}
+
+void MorphTarget::AccumulateSparse(const Uint32Array& indices,
+                                   const Float32Array& deltas, float weight,
+                                   Float32Array& result)
+{
+  const auto count       = std::min(indices.size(), deltas.size() / 3);
+  const auto vertexCount = result.size() / 3;
+  const float* d         = deltas.data();
+  float* r               = result.data();
+
+#if defined(__SSE2__)
+  // The vec3 are updated with 4 floats wide loads and stores, the fourth lane
+  // of the delta is masked to keep the next vertex unchanged
+  const __m128 w    = _mm_set1_ps(weight);
+  const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+#endif
+  for (size_t k = 0; k < count; ++k) {
+    const size_t index = indices[k];
+    if (index >= vertexCount) {
+      continue;
+    }
+    const float* delta = d + k * 3;
+    float* value       = r + index * 3;
+#if defined(__SSE2__)
+    if (k + 1 < count && index + 1 < vertexCount) {
+      const __m128 masked = _mm_and_ps(_mm_loadu_ps(delta), mask);
+      _mm_storeu_ps(value,
+                    _mm_add_ps(_mm_loadu_ps(value), _mm_mul_ps(w, masked)));
+      continue;
+    }
+#endif
+    value[0] += weight * delta[0];
+    value[1] += weight * delta[1];
+    value[2] += weight * delta[2];
+  }
+}
+
 } // end of namespace BABYLON
@@ -5,12 +5,15 @@
 #include <babylon/engine/scene.h>
 #include <babylon/mesh/abstract_mesh.h>
 #include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
 #include <babylon/morph/morph_target.h>
 
 namespace BABYLON {
 
 MorphTargetManager::MorphTargetManager(Scene* scene)
-    : _scene{scene}
+    : _maxGPUInfluencers{0}
+    , _blendRevision{1}
+    , _scene{scene}
     , _supportsNormals{false}
     , _supportsTangents{false}
     , _vertexCount{0}
@@ -85,7 +88,7 @@ MorphTarget* MorphTargetManager::getTarget(std::size_t index)
 void MorphTargetManager::addTarget(std::unique_ptr<MorphTarget>&& target)
 {
   if (_vertexCount) {
-    if (_vertexCount != target->getPositions().size() / 3) {
+    if (_vertexCount != target->vertexCount()) {
       BABYLON_LOG_ERROR(
         "MorphTargetManager",
         "Incompatible target. Targets must all have the same vertices count.");
@@ -107,15 +110,75 @@ void MorphTargetManager::removeTarget(MorphTarget* target)
                      return target == morphTarget.get();
                    });
   if (it != _targets.end()) {
-    _targets.erase(it);
-
     size_t index = static_cast<size_t>(it - _targets.begin());
     target->onInfluenceChanged.remove(_targetObservable[index]);
+    _targetObservable.erase(_targetObservable.begin() + index);
+    _targets.erase(it);
+
     _vertexCount = 0;
     _syncActiveTargets(true);
   }
 }
 
+size_t MorphTargetManager::maxGPUInfluencers() const
+{
+  return _maxGPUInfluencers;
+}
+
+void MorphTargetManager::setMaxGPUInfluencers(size_t count)
+{
+  if (_maxGPUInfluencers == count) {
+    return;
+  }
+
+  _maxGPUInfluencers = count;
+  _syncActiveTargets(false);
+}
+
+size_t MorphTargetManager::blendRevision() const
+{
+  return _blendRevision;
+}
+
+void MorphTargetManager::markBlendDirty()
+{
+  ++_blendRevision;
+}
+
+const Float32Array&
+MorphTargetManager::blendPositions(const Float32Array& basePositions)
+{
+  return _blend(basePositions, _positionsBlend,
+                &MorphTarget::accumulatePositions);
+}
+
+const Float32Array&
+MorphTargetManager::blendNormals(const Float32Array& baseNormals)
+{
+  return _blend(baseNormals, _normalsBlend, &MorphTarget::accumulateNormals);
+}
+
+const Float32Array& MorphTargetManager::_blend(
+  const Float32Array& base, BlendCache& cache,
+  void (MorphTarget::*accumulate)(const Float32Array&, Float32Array&) const)
+{
+  if (cache.revision == _blendRevision && cache.base == base.data()
+      && cache.size == base.size()) {
+    return cache.data;
+  }
+
+  // Same targets as the ones rendered by the GPU
+  cache.data.assign(base.begin(), base.end());
+  for (auto target : _activeTargets) {
+    (target->*accumulate)(base, cache.data);
+  }
+
+  cache.revision = _blendRevision;
+  cache.base     = base.data();
+  cache.size     = base.size();
+  return cache.data;
+}
+
 Json::object MorphTargetManager::serialize()
 {
   return Json::object();
@@ -128,21 +191,59 @@ void MorphTargetManager::_onInfluenceChanged(bool needUpdate)
 
 void MorphTargetManager::_syncActiveTargets(bool needUpdate)
 {
-  _activeTargets.clear();
+  ++_blendRevision;
+
+  std::vector<MorphTarget*> activeTargets;
+  for (auto& target : _targets) {
+    if (target->influence() > 0.f) {
+      activeTargets.emplace_back(target.get());
+    }
+  }
+
+  // One vertex buffer kind per active target
+  size_t maxInfluencers = VertexBuffer::MaxMorphTargetInfluencers;
+  if (_maxGPUInfluencers > 0) {
+    maxInfluencers = std::min(maxInfluencers, _maxGPUInfluencers);
+  }
+
+  if (activeTargets.size() > maxInfluencers) {
+    // Keep the strongest influences, in the targets order so that the vertex
+    // buffers of the targets which stay active are not swapped
+    std::vector<size_t> order(activeTargets.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    const auto strongest = order.begin() + maxInfluencers;
+    std::partial_sort(order.begin(), strongest, order.end(),
+                      [&activeTargets](size_t a, size_t b) {
+                        const auto influenceA = activeTargets[a]->influence();
+                        const auto influenceB = activeTargets[b]->influence();
+                        return (influenceA > influenceB)
+                               || (influenceA == influenceB && a < b);
+                      });
+    std::sort(order.begin(), strongest);
+    std::vector<MorphTarget*> strongestTargets;
+    for (auto it = order.begin(); it != strongest; ++it) {
+      strongestTargets.emplace_back(activeTargets[*it]);
+    }
+    activeTargets = std::move(strongestTargets);
+  }
+
+  // The vertex buffers have to be updated when the active set changes
+  needUpdate     = needUpdate || (activeTargets != _activeTargets);
+  _activeTargets = std::move(activeTargets);
+
   _influences.clear();
   _supportsNormals  = true;
   _supportsTangents = true;
-  for (auto& target : _targets) {
-    if (target->influence() > 0.f) {
-      _activeTargets.emplace_back(target.get());
-      _influences.emplace_back(target->influence());
+  for (auto target : _activeTargets) {
+    _influences.emplace_back(target->influence());
 
-      _supportsNormals  = _supportsNormals && target->hasNormals();
-      _supportsTangents = _supportsTangents && target->hasTangents();
+    _supportsNormals  = _supportsNormals && target->hasNormals();
+    _supportsTangents = _supportsTangents && target->hasTangents();
 
-      if (_vertexCount == 0) {
-        _vertexCount = target->getPositions().size() / 3;
-      }
+    if (_vertexCount == 0) {
+      _vertexCount = target->vertexCount();
     }
   }
 
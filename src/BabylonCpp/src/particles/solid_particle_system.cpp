@@ -68,12 +68,12 @@ SolidParticleSystem::SolidParticleSystem(
     , _cosYaw{0.f}
     , _w{0.f}
     , _mustUnrotateFixedNormals{false}
-    , _minimum{Tmp::Vector3Array[0]}
-    , _maximum{Tmp::Vector3Array[1]}
-    , _scale{Tmp::Vector3Array[2]}
-    , _translation{Tmp::Vector3Array[3]}
-    , _minBbox{Tmp::Vector3Array[4]}
-    , _maxBbox{Tmp::Vector3Array[5]}
+    , _minimum{Tmp::Vector3Array()[0]}
+    , _maximum{Tmp::Vector3Array()[1]}
+    , _scale{Tmp::Vector3Array()[2]}
+    , _translation{Tmp::Vector3Array()[3]}
+    , _minBbox{Tmp::Vector3Array()[4]}
+    , _maxBbox{Tmp::Vector3Array()[5]}
     , _particlesIntersect{options.particleIntersection}
 {
 }
@@ -165,7 +165,7 @@ SolidParticleSystem::digest(Mesh* _mesh,
   Uint32Array facetInd;  // submesh indices
   Float32Array facetUV;  // submesh UV
   Float32Array facetCol; // submesh colors
-  Vector3& barycenter = Tmp::Vector3Array[0];
+  Vector3& barycenter = Tmp::Vector3Array()[0];
   size_t sizeO        = size;
 
   while (f < totalFacets) {
@@ -25,8 +25,11 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* _object,
     , type{_type}
     , _options{options}
     , _scene{scene}
+    , _physicsEngine{nullptr}
+    , _physicsBody{nullptr}
     , _bodyUpdateRequired{false}
     , _deltaPosition{Vector3::Zero()}
+    , _parent{nullptr}
 {
   // Sanity check!
   if (!object) {
@@ -81,7 +84,8 @@ void PhysicsImpostor::_init()
 
 PhysicsImpostor* PhysicsImpostor::_getPhysicsParent()
 {
-  return object->getParent()->physicsImpostor.get();
+  auto parentMesh = object->getParent();
+  return parentMesh ? parentMesh->physicsImpostor.get() : nullptr;
 }
 
 bool PhysicsImpostor::isBodyInitRequired() const
@@ -13,6 +13,7 @@ AnaglyphPostProcess::AnaglyphPostProcess(const std::string& iName, float ratio,
                   rigCameras[1], samplingMode, engine, reusable}
 {
   _passedProcess = rigCameras[0]->_rigPostProcess;
+  addTextureInput(_passedProcess);
 
   onApplyObservable.add([&](Effect* effect) {
     effect->setTextureFromPostProcess("leftSampler", _passedProcess);
@@ -59,6 +59,19 @@ HDRRenderingPipeline::HDRRenderingPipeline(const std::string& iName,
     _originalPostProcess = originalPostProcess;
   }
 
+  // Textures sampled from other post processes
+  _textureAdderPostProcess->addTextureInput(_originalPostProcess);
+  _hdrPostProcess->addTextureInput(_textureAdderPostProcess)
+    .addTextureInput(_originalPostProcess);
+  _hdrPostProcess->sampleInputTexture = false;
+  for (size_t i = 0; i + 1 < _downSamplePostProcesses.size(); ++i) {
+    _downSamplePostProcesses[i]->addTextureInput(
+      _downSamplePostProcesses[i + 1]);
+  }
+  // Luminance generator
+  _downSamplePostProcesses.back()->addTextureInput(_textureAdderPostProcess);
+  _downSamplePostProcesses.back()->sampleInputTexture = false;
+
   // Configure pipeline
   addEffect(
     new PostProcessRenderEffect(scene->getEngine(), "HDRPassPostProcess",
@@ -233,6 +233,8 @@ void LensRenderingPipeline::_createHighlightsPostProcess(float ratio)
       "screen_height",
       static_cast<float>(_scene->getEngine()->getRenderingCanvas()->height));
   });
+  _highlightsPostProcess->addTextureInput(_chromaticAberrationPostProcess);
+  _highlightsPostProcess->sampleInputTexture = false;
 }
 
 void LensRenderingPipeline::_createDepthOfFieldPostProcess(float ratio)
@@ -8,6 +8,7 @@
 #include <babylon/materials/effect_creation_options.h>
 #include <babylon/materials/effect_fallbacks.h>
 #include <babylon/materials/textures/irender_target_options.h>
+#include <babylon/postprocess/rendergraph/render_graph.h>
 #include <babylon/tools/tools.h>
 
 namespace BABYLON {
@@ -46,6 +47,7 @@ PostProcess::PostProcess(const std::string& iName,
     , alphaMode{EngineConstants::ALPHA_DISABLE}
     , enablePixelPerfectMode{false}
     , samples{1}
+    , sampleInputTexture{true}
     , _currentRenderTextureInd{0}
     , _renderRatio{1.f}
     , _options{options}
@@ -55,6 +57,9 @@ PostProcess::PostProcess(const std::string& iName,
     , _parameters{parameters}
     , _scaleRatio{Vector2(1.f, 1.f)}
     , _shareOutputWithPostProcess{nullptr}
+    , _renderGraphManaged{false}
+    , _requiredWidth{0}
+    , _requiredHeight{0}
 {
   if (camera) {
     _camera = camera;
@@ -134,7 +139,10 @@ void PostProcess::setOnAfterRender(
 
 GL::IGLTexture* PostProcess::outputTexture()
 {
-  return _textures[_currentRenderTextureInd];
+  // No texture is assigned to a post process culled by the render graph
+  return (_currentRenderTextureInd < _textures.size()) ?
+           _textures[_currentRenderTextureInd] :
+           nullptr;
 }
 
 Camera* PostProcess::getCamera()
@@ -155,6 +163,21 @@ PostProcess& PostProcess::shareOutputWith(PostProcess* postProcess)
   return *this;
 }
 
+PostProcess& PostProcess::addTextureInput(PostProcess* postProcess)
+{
+  if (postProcess && !stl_util::contains(_textureInputs, postProcess)) {
+    _textureInputs.emplace_back(postProcess);
+    postProcess->_textureReaders.emplace_back(this);
+  }
+
+  return *this;
+}
+
+const std::vector<PostProcess*>& PostProcess::textureInputs() const
+{
+  return _textureInputs;
+}
+
 void PostProcess::updateEffect(
   const std::string& defines, const std::vector<std::string>& uniforms,
   const std::vector<std::string>& samplers,
@@ -184,57 +207,125 @@ void PostProcess::markTextureDirty()
   width = -1;
 }
 
-void PostProcess::activate(Camera* camera, GL::IGLTexture* sourceTexture)
+RenderGraphTextureDescription
+PostProcess::_getTextureDescription(Camera* camera,
+                                    GL::IGLTexture* sourceTexture)
 {
-  if (!_shareOutputWithPostProcess) {
-    auto pCamera = camera ? camera : _camera;
-
-    auto scene        = pCamera->getScene();
-    const int maxSize = pCamera->getEngine()->getCaps().maxTextureSize;
-
-    const int requiredWidth = static_cast<int>(
-      static_cast<float>(sourceTexture ? sourceTexture->_width :
-                                         _engine->getRenderingCanvas()->width)
-      * _renderRatio);
-    const int requiredHeight = static_cast<int>(
-      static_cast<float>(sourceTexture ? sourceTexture->_height :
-                                         _engine->getRenderingCanvas()->height)
-      * _renderRatio);
-
-    int desiredWidth = _options.width == -1 ? requiredWidth : _options.width;
-    int desiredHeight
-      = _options.height == -1 ? requiredHeight : _options.height;
-
-    if (renderTargetSamplingMode != TextureConstants::NEAREST_SAMPLINGMODE) {
-      if (_options.width <= 0) {
-        desiredWidth = Tools::GetExponentOfTwo(desiredWidth, maxSize);
-      }
+  auto pCamera      = camera ? camera : _camera;
+  const int maxSize = _engine->getCaps().maxTextureSize;
+
+  _requiredWidth = static_cast<int>(
+    static_cast<float>(sourceTexture ? sourceTexture->_width :
+                                       _engine->getRenderingCanvas()->width)
+    * _renderRatio);
+  _requiredHeight = static_cast<int>(
+    static_cast<float>(sourceTexture ? sourceTexture->_height :
+                                       _engine->getRenderingCanvas()->height)
+    * _renderRatio);
+
+  int desiredWidth = _options.width == -1 ? _requiredWidth : _options.width;
+  int desiredHeight
+    = _options.height == -1 ? _requiredHeight : _options.height;
+
+  if (renderTargetSamplingMode != TextureConstants::NEAREST_SAMPLINGMODE) {
+    if (_options.width <= 0) {
+      desiredWidth = Tools::GetExponentOfTwo(desiredWidth, maxSize);
+    }
 
-      if (_options.height <= 0) {
-        desiredHeight = Tools::GetExponentOfTwo(desiredHeight, maxSize);
-      }
+    if (_options.height <= 0) {
+      desiredHeight = Tools::GetExponentOfTwo(desiredHeight, maxSize);
     }
+  }
+
+  const bool isFirstPostProcess
+    = pCamera && (stl_util::index_of(pCamera->_postProcesses, this) == 0);
+
+  RenderGraphTextureDescription description;
+  description.width                 = desiredWidth;
+  description.height                = desiredHeight;
+  description.type                  = _textureType;
+  description.samplingMode          = renderTargetSamplingMode;
+  description.generateDepthBuffer   = isFirstPostProcess;
+  description.generateStencilBuffer
+    = isFirstPostProcess && _engine->isStencilEnable();
+  description.samples = samples;
+
+  return description;
+}
+
+PostProcess* PostProcess::_getSharedOutputPostProcess() const
+{
+  return _shareOutputWithPostProcess;
+}
+
+const std::vector<PostProcess*>& PostProcess::_getTextureReaders() const
+{
+  return _textureReaders;
+}
+
+bool PostProcess::_isRenderGraphManaged() const
+{
+  return _renderGraphManaged;
+}
+
+void PostProcess::_setRenderGraphTexture(GL::IGLTexture* texture,
+                                         int textureWidth, int textureHeight)
+{
+  if (!_renderGraphManaged) {
+    _disposeTextures();
+    _renderGraphManaged = true;
+  }
+
+  _textures.clear();
+  if (texture) {
+    _textures.emplace_back(texture);
+  }
+  _currentRenderTextureInd = 0;
+
+  if (width != textureWidth || height != textureHeight) {
+    width  = textureWidth;
+    height = textureHeight;
+    onSizeChangedObservable.notifyObservers(this);
+  }
+}
+
+void PostProcess::_releaseRenderGraphTexture()
+{
+  if (_renderGraphManaged) {
+    // The textures belong to the render graph
+    _textures.clear();
+    _renderGraphManaged = false;
+  }
+}
+
+void PostProcess::activate(Camera* camera, GL::IGLTexture* sourceTexture)
+{
+  auto pCamera = camera ? camera : _camera;
+  auto scene   = pCamera->getScene();
 
-    if (width != desiredWidth || height != desiredHeight) {
+  const auto description = _getTextureDescription(pCamera, sourceTexture);
+
+  // The textures of the post processes of the render graph are assigned by
+  // the post process manager
+  if (!_shareOutputWithPostProcess && !_renderGraphManaged) {
+    if (width != description.width || height != description.height
+        || _textures.empty()) {
       if (!_textures.empty()) {
         for (auto& texture : _textures) {
           _engine->_releaseTexture(texture);
         }
         _textures.clear();
       }
-      width  = desiredWidth;
-      height = desiredHeight;
+      width  = description.width;
+      height = description.height;
 
       auto textureSize = ISize(width, height);
       IRenderTargetOptions textureOptions;
-      textureOptions.generateMipMaps = false;
-      textureOptions.generateDepthBuffer
-        = stl_util::index_of(pCamera->_postProcesses, this) == 0;
-      textureOptions.generateStencilBuffer
-        = (stl_util::index_of(pCamera->_postProcesses, this) == 0)
-          && _engine->isStencilEnable();
-      textureOptions.samplingMode = renderTargetSamplingMode;
-      textureOptions.type         = _textureType;
+      textureOptions.generateMipMaps       = false;
+      textureOptions.generateDepthBuffer   = description.generateDepthBuffer;
+      textureOptions.generateStencilBuffer = description.generateStencilBuffer;
+      textureOptions.samplingMode          = renderTargetSamplingMode;
+      textureOptions.type                  = _textureType;
 
       _textures.emplace_back(
         _engine->createRenderTargetTexture(textureSize, textureOptions));
@@ -252,15 +343,22 @@ void PostProcess::activate(Camera* camera, GL::IGLTexture* sourceTexture)
         _engine->updateRenderTargetTextureSampleCount(texture, samples);
       }
     }
+  }
 
-    auto target = _shareOutputWithPostProcess ? _shareOutputWithPostProcess->outputTexture() : outputTexture();
+  auto target = _shareOutputWithPostProcess ?
+                  _shareOutputWithPostProcess->outputTexture() :
+                  outputTexture();
+  if (!target) {
+    return;
+  }
 
   if (enablePixelPerfectMode) {
     _scaleRatio.copyFromFloats(
-      static_cast<float>(requiredWidth) / static_cast<float>(desiredWidth),
-      static_cast<float>(requiredHeight) / static_cast<float>(desiredHeight));
-    _engine->bindFramebuffer(target, 0,
-                             requiredWidth, requiredHeight);
+      static_cast<float>(_requiredWidth)
+        / static_cast<float>(description.width),
+      static_cast<float>(_requiredHeight)
+        / static_cast<float>(description.height));
+    _engine->bindFramebuffer(target, 0, _requiredWidth, _requiredHeight);
   }
   else {
     _scaleRatio.copyFromFloats(1.f, 1.f);
@@ -289,8 +387,6 @@ void PostProcess::activate(Camera* camera, GL::IGLTexture* sourceTexture)
     getEngine()->setAlphaConstants(_alphaConstants.r, _alphaConstants.g,
                                    _alphaConstants.b, _alphaConstants.a);
   }
-
-  }
 }
 
 bool PostProcess::isSupported() const
@@ -330,6 +426,11 @@ void PostProcess::_disposeTextures()
     return;
   }
 
+  if (_renderGraphManaged) {
+    _releaseRenderGraphTexture();
+    return;
+  }
+
   if (!_textures.empty()) {
     for (auto& texture : _textures) {
       _engine->_releaseTexture(texture);
@@ -345,6 +446,16 @@ void PostProcess::dispose(Camera* camera)
 
   _disposeTextures();
 
+  // Render graph dependencies
+  for (auto& input : _textureInputs) {
+    stl_util::erase(input->_textureReaders, this);
+  }
+  for (auto& reader : _textureReaders) {
+    stl_util::erase(reader->_textureInputs, this);
+  }
+  _textureInputs.clear();
+  _textureReaders.clear();
+
   if (!pCamera) {
     return;
   }
@@ -4,12 +4,15 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/scene.h>
+#include <babylon/materials/textures/irender_target_options.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/postprocess/post_process.h>
+#include <babylon/postprocess/rendergraph/render_graph.h>
 
 namespace BABYLON {
 
-PostProcessManager::PostProcessManager(Scene* scene) : _scene{scene}
+PostProcessManager::PostProcessManager(Scene* scene)
+    : useRenderGraph{true}, _scene{scene}
 {
 }
 
@@ -38,6 +41,112 @@ void PostProcessManager::_prepareBuffers()
   _indexBuffer = _scene->getEngine()->createIndexBuffer(indices);
 }
 
+std::unique_ptr<RenderGraph> PostProcessManager::_createRenderGraph()
+{
+  auto engine = _scene->getEngine();
+  return std::make_unique<RenderGraph>(
+    [engine](const RenderGraphTextureDescription& description) {
+      IRenderTargetOptions options;
+      options.generateMipMaps       = false;
+      options.generateDepthBuffer   = description.generateDepthBuffer;
+      options.generateStencilBuffer = description.generateStencilBuffer;
+      options.samplingMode          = description.samplingMode;
+      options.type                  = description.type;
+      auto texture = engine->createRenderTargetTexture(
+        ISize(description.width, description.height), options);
+      if (texture && texture->samples != description.samples) {
+        engine->updateRenderTargetTextureSampleCount(texture,
+                                                     description.samples);
+      }
+      return texture;
+    },
+    [engine](GL::IGLTexture* texture) { engine->_releaseTexture(texture); });
+}
+
+void PostProcessManager::_buildRenderGraph(
+  RenderGraph& graph, const std::vector<PostProcess*>& postProcesses,
+  GL::IGLTexture* sourceTexture, size_t firstManaged)
+{
+  auto camera = _scene->activeCamera;
+  graph.reset();
+
+  // Texture of each post process, written by the previous pass and read when
+  // the post process is applied
+  const size_t count = postProcesses.size();
+  std::vector<size_t> textures(count);
+  std::vector<RenderGraphTextureDescription> descriptions(count);
+  std::vector<bool> managed(count, false);
+  for (size_t index = 0; index < count; ++index) {
+    auto pp             = postProcesses[index];
+    descriptions[index] = pp->_getTextureDescription(camera, sourceTexture);
+    bool canBeTransient = (index >= firstManaged) && !pp->isReusable()
+                          && !pp->_getSharedOutputPostProcess();
+    // The texture must not be read before being written in the frame
+    for (auto reader : pp->_getTextureReaders()) {
+      const int readerIndex = stl_util::index_of(postProcesses, reader);
+      canBeTransient
+        = canBeTransient && (readerIndex >= static_cast<int>(index));
+    }
+    managed[index]  = canBeTransient;
+    textures[index] = canBeTransient ?
+                        graph.createTexture(pp->name, descriptions[index]) :
+                        graph.importTexture(pp->name, nullptr);
+  }
+  for (size_t index = 0; index < count; ++index) {
+    const int sharedIndex = stl_util::index_of(
+      postProcesses, postProcesses[index]->_getSharedOutputPostProcess());
+    if (sharedIndex >= 0) {
+      textures[index] = textures[static_cast<size_t>(sharedIndex)];
+    }
+  }
+  const auto target = graph.importTexture("target", nullptr);
+
+  // The source (scene) pass and one pass per post process
+  const auto sourcePass = graph.addPass("source");
+  graph.write(sourcePass, textures[0]);
+  graph.setSideEffect(sourcePass);
+  for (size_t index = 0; index < count; ++index) {
+    auto pp         = postProcesses[index];
+    const auto pass = graph.addPass(pp->name);
+    if (pp->sampleInputTexture) {
+      graph.read(pass, textures[index]);
+    }
+    for (auto input : pp->textureInputs()) {
+      const int inputIndex = stl_util::index_of(postProcesses, input);
+      if (inputIndex >= 0) {
+        graph.read(pass, textures[static_cast<size_t>(inputIndex)]);
+      }
+    }
+    graph.write(pass, (index + 1 < count) ? textures[index + 1] : target);
+    // Observers may read back the rendered pixels
+    if (pp->onAfterRenderObservable.hasObservers()) {
+      graph.setSideEffect(pass);
+    }
+  }
+
+  graph.compile();
+
+  for (size_t index = 0; index < count; ++index) {
+    if (managed[index]) {
+      postProcesses[index]->_setRenderGraphTexture(
+        graph.getTexture(textures[index]), descriptions[index].width,
+        descriptions[index].height);
+    }
+    else {
+      postProcesses[index]->_releaseRenderGraphTexture();
+    }
+  }
+}
+
+void PostProcessManager::_releaseRenderGraphTextures(
+  const std::vector<PostProcess*>& postProcesses)
+{
+  // The pool textures are only assigned for the duration of the frame
+  for (auto& pp : postProcesses) {
+    pp->_releaseRenderGraphTexture();
+  }
+}
+
 bool PostProcessManager::_prepareFrame(GL::IGLTexture* sourceTexture)
 {
   const auto& postProcesses = _scene->activeCamera->_postProcesses;
@@ -46,6 +155,15 @@ bool PostProcessManager::_prepareFrame(GL::IGLTexture* sourceTexture)
     return false;
   }
 
+  if (useRenderGraph) {
+    if (!_renderGraph) {
+      _renderGraph = _createRenderGraph();
+    }
+    _renderGraphPostProcesses = postProcesses;
+    _buildRenderGraph(*_renderGraph, _renderGraphPostProcesses, sourceTexture,
+                      0);
+  }
+
   postProcesses[0]->activate(_scene->activeCamera, sourceTexture);
   return true;
 }
@@ -55,7 +173,19 @@ void PostProcessManager::directRender(
 {
   auto engine = _scene->getEngine();
 
+  // The input of the first post process is not written here
+  if (useRenderGraph) {
+    if (!_directRenderGraph) {
+      _directRenderGraph = _createRenderGraph();
+    }
+    _buildRenderGraph(*_directRenderGraph, postProcesses, targetTexture, 1);
+  }
+
   for (unsigned int index = 0; index < postProcesses.size(); ++index) {
+    if (useRenderGraph && _directRenderGraph->isCulled(index + 1)) {
+      continue;
+    }
+
     if (index < postProcesses.size() - 1) {
       postProcesses[index + 1]->activate(_scene->activeCamera, targetTexture);
     }
@@ -85,6 +215,10 @@ void PostProcessManager::directRender(
     }
   }
 
+  if (useRenderGraph) {
+    _releaseRenderGraphTextures(postProcesses);
+  }
+
   // Restore depth buffer
   engine->setDepthBuffer(true);
   engine->setDepthWrite(true);
@@ -102,7 +236,16 @@ void PostProcessManager::_finalizeFrame(
   }
   auto engine = _scene->getEngine();
 
+  // Passes culled by the render graph of the frame
+  const bool useFrameRenderGraph
+    = useRenderGraph && _renderGraph
+      && (postProcesses == _renderGraphPostProcesses);
+
   for (unsigned int index = 0; index < postProcesses.size(); ++index) {
+    if (useFrameRenderGraph && _renderGraph->isCulled(index + 1)) {
+      continue;
+    }
+
     if (index < postProcesses.size() - 1) {
       postProcesses[index + 1]->activate(_scene->activeCamera, targetTexture);
     }
@@ -136,6 +279,11 @@ void PostProcessManager::_finalizeFrame(
     }
   }
 
+  if (useFrameRenderGraph) {
+    _releaseRenderGraphTextures(_renderGraphPostProcesses);
+    _renderGraphPostProcesses.clear();
+  }
+
   // Restore states
   engine->setDepthBuffer(true);
   engine->setDepthWrite(true);
@@ -158,6 +306,15 @@ void PostProcessManager::dispose(bool /*doNotRecurse*/)
     _scene->getEngine()->_releaseBuffer(_indexBuffer.get());
     _indexBuffer.reset(nullptr);
   }
+
+  _renderGraphPostProcesses.clear();
+  _renderGraph.reset(nullptr);
+  _directRenderGraph.reset(nullptr);
+}
+
+RenderGraph* PostProcessManager::renderGraph()
+{
+  return _renderGraph.get();
 }
 
 } // end of namespace BABYLON
@@ -0,0 +1,356 @@
+#include <babylon/postprocess/rendergraph/render_graph.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr size_t NoPass = std::numeric_limits<size_t>::max();
+
+} // end of anonymous namespace
+
+bool RenderGraphTextureDescription::
+operator==(const RenderGraphTextureDescription& other) const
+{
+  return width == other.width && height == other.height && type == other.type
+         && samplingMode == other.samplingMode
+         && generateDepthBuffer == other.generateDepthBuffer
+         && generateStencilBuffer == other.generateStencilBuffer
+         && samples == other.samples;
+}
+
+bool RenderGraphTextureDescription::
+operator!=(const RenderGraphTextureDescription& other) const
+{
+  return !(operator==(other));
+}
+
+size_t RenderGraphTextureDescription::byteSize() const
+{
+  size_t bytesPerPixel = 4;
+  if (type == EngineConstants::TEXTURETYPE_FLOAT) {
+    bytesPerPixel = 16;
+  }
+  else if (type == EngineConstants::TEXTURETYPE_HALF_FLOAT) {
+    bytesPerPixel = 8;
+  }
+  // Packed 24-bit depth and 8-bit stencil
+  if (generateDepthBuffer || generateStencilBuffer) {
+    bytesPerPixel += 4;
+  }
+
+  return static_cast<size_t>(std::max(width, 0))
+         * static_cast<size_t>(std::max(height, 0)) * bytesPerPixel
+         * std::max(samples, 1u);
+}
+
+RenderGraph::RenderGraph(const CreateTextureFunc& createTexture,
+                         const ReleaseTextureFunc& releaseTexture)
+    : poolLifetime{3}
+    , _createTexture{createTexture}
+    , _releaseTexture{releaseTexture}
+    , _compiled{false}
+    , _allocationCount{0}
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+  releaseTextures();
+}
+
+void RenderGraph::reset()
+{
+  _textures.clear();
+  _passes.clear();
+  _compiled = false;
+}
+
+size_t RenderGraph::createTexture(
+  const std::string& name, const RenderGraphTextureDescription& description)
+{
+  _textures.emplace_back(
+    Texture{name, description, nullptr, false, {}, {}, NoPass, NoPass});
+  _compiled = false;
+  return _textures.size() - 1;
+}
+
+size_t RenderGraph::importTexture(const std::string& name,
+                                  GL::IGLTexture* texture)
+{
+  _textures.emplace_back(Texture{name, RenderGraphTextureDescription(),
+                                 texture, true, {}, {}, NoPass, NoPass});
+  _compiled = false;
+  return _textures.size() - 1;
+}
+
+size_t RenderGraph::addPass(const std::string& name,
+                            const std::function<void()>& execute)
+{
+  _passes.emplace_back(Pass{name, execute, {}, {}, false, false});
+  _compiled = false;
+  return _passes.size() - 1;
+}
+
+void RenderGraph::read(size_t pass, size_t texture)
+{
+  if (pass >= _passes.size() || texture >= _textures.size()) {
+    return;
+  }
+
+  _passes[pass].reads.emplace_back(texture);
+  _textures[texture].readers.emplace_back(pass);
+  _compiled = false;
+}
+
+void RenderGraph::write(size_t pass, size_t texture)
+{
+  if (pass >= _passes.size() || texture >= _textures.size()) {
+    return;
+  }
+
+  _passes[pass].writes.emplace_back(texture);
+  _textures[texture].writers.emplace_back(pass);
+  _compiled = false;
+}
+
+void RenderGraph::setSideEffect(size_t pass, bool sideEffect)
+{
+  if (pass < _passes.size()) {
+    _passes[pass].sideEffect = sideEffect;
+    _compiled                = false;
+  }
+}
+
+void RenderGraph::compile()
+{
+  _cullPasses();
+  _computeLifetimes();
+  _assignTextures();
+  _compiled = true;
+}
+
+void RenderGraph::execute()
+{
+  if (!_compiled) {
+    compile();
+  }
+
+  for (auto& pass : _passes) {
+    if (!pass.culled && pass.execute) {
+      pass.execute();
+    }
+  }
+}
+
+bool RenderGraph::isCompiled() const
+{
+  return _compiled;
+}
+
+bool RenderGraph::isCulled(size_t pass) const
+{
+  return (pass < _passes.size()) ? _passes[pass].culled : true;
+}
+
+GL::IGLTexture* RenderGraph::getTexture(size_t texture) const
+{
+  return (texture < _textures.size()) ? _textures[texture].texture : nullptr;
+}
+
+std::pair<size_t, size_t> RenderGraph::getLifetime(size_t texture) const
+{
+  if (texture >= _textures.size()) {
+    return {NoPass, NoPass};
+  }
+  return {_textures[texture].firstPass, _textures[texture].lastPass};
+}
+
+void RenderGraph::releaseTextures()
+{
+  for (auto& pooledTexture : _pool) {
+    if (_releaseTexture) {
+      _releaseTexture(pooledTexture.texture);
+    }
+  }
+  _pool.clear();
+
+  for (auto& texture : _textures) {
+    if (!texture.imported) {
+      texture.texture = nullptr;
+    }
+  }
+  _compiled = false;
+}
+
+size_t RenderGraph::passCount() const
+{
+  return _passes.size();
+}
+
+size_t RenderGraph::culledPassCount() const
+{
+  return static_cast<size_t>(
+    std::count_if(_passes.begin(), _passes.end(),
+                  [](const Pass& pass) { return pass.culled; }));
+}
+
+size_t RenderGraph::transientTextureCount() const
+{
+  return static_cast<size_t>(std::count_if(
+    _textures.begin(), _textures.end(), [](const Texture& texture) {
+      return !texture.imported && texture.firstPass != NoPass;
+    }));
+}
+
+size_t RenderGraph::physicalTextureCount() const
+{
+  return _pool.size();
+}
+
+size_t RenderGraph::allocationCount() const
+{
+  return _allocationCount;
+}
+
+size_t RenderGraph::requestedBytes() const
+{
+  size_t bytes = 0;
+  for (const auto& texture : _textures) {
+    if (!texture.imported && texture.firstPass != NoPass) {
+      bytes += texture.description.byteSize();
+    }
+  }
+  return bytes;
+}
+
+size_t RenderGraph::allocatedBytes() const
+{
+  size_t bytes = 0;
+  for (const auto& pooledTexture : _pool) {
+    bytes += pooledTexture.description.byteSize();
+  }
+  return bytes;
+}
+
+void RenderGraph::_cullPasses()
+{
+  // The passes with effects outside of the graph are the roots
+  std::vector<size_t> stack;
+  for (size_t p = 0; p < _passes.size(); ++p) {
+    auto& pass  = _passes[p];
+    pass.culled = true;
+    bool root   = pass.sideEffect;
+    for (auto texture : pass.writes) {
+      root = root || _textures[texture].imported;
+    }
+    if (root) {
+      pass.culled = false;
+      stack.emplace_back(p);
+    }
+  }
+
+  // Keeps the passes writing the textures read by the kept passes
+  while (!stack.empty()) {
+    const auto p = stack.back();
+    stack.pop_back();
+    for (auto texture : _passes[p].reads) {
+      for (auto writer : _textures[texture].writers) {
+        if (writer <= p && _passes[writer].culled) {
+          _passes[writer].culled = false;
+          stack.emplace_back(writer);
+        }
+      }
+    }
+  }
+}
+
+void RenderGraph::_computeLifetimes()
+{
+  for (auto& texture : _textures) {
+    texture.firstPass = NoPass;
+    texture.lastPass  = NoPass;
+    for (const auto& passes : {texture.writers, texture.readers}) {
+      for (auto p : passes) {
+        if (_passes[p].culled) {
+          continue;
+        }
+        texture.firstPass
+          = (texture.firstPass == NoPass) ? p : std::min(texture.firstPass, p);
+        texture.lastPass
+          = (texture.lastPass == NoPass) ? p : std::max(texture.lastPass, p);
+      }
+    }
+  }
+}
+
+void RenderGraph::_assignTextures()
+{
+  for (auto& pooledTexture : _pool) {
+    pooledTexture.used     = false;
+    pooledTexture.lastPass = NoPass;
+  }
+
+  // Transient textures in order of first use
+  std::vector<size_t> order;
+  for (size_t t = 0; t < _textures.size(); ++t) {
+    auto& texture = _textures[t];
+    if (texture.imported) {
+      continue;
+    }
+    texture.texture = nullptr;
+    if (texture.firstPass != NoPass) {
+      order.emplace_back(t);
+    }
+  }
+  std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+    return _textures[a].firstPass < _textures[b].firstPass;
+  });
+
+  for (auto t : order) {
+    auto& texture = _textures[t];
+
+    // A pool texture of the same description, free when the texture is
+    // first written
+    PooledTexture* candidate = nullptr;
+    for (auto& pooledTexture : _pool) {
+      if (pooledTexture.description == texture.description
+          && (!pooledTexture.used
+              || pooledTexture.lastPass < texture.firstPass)) {
+        candidate = &pooledTexture;
+        break;
+      }
+    }
+
+    if (!candidate) {
+      GL::IGLTexture* glTexture
+        = _createTexture ? _createTexture(texture.description) : nullptr;
+      ++_allocationCount;
+      _pool.emplace_back(
+        PooledTexture{texture.description, glTexture, NoPass, false, 0});
+      candidate = &_pool.back();
+    }
+
+    candidate->used     = true;
+    candidate->lastPass = texture.lastPass;
+    texture.texture     = candidate->texture;
+  }
+
+  // Releases the textures unused for too long
+  for (auto it = _pool.begin(); it != _pool.end();) {
+    if (it->used) {
+      it->unusedCompilations = 0;
+      ++it;
+    }
+    else if (++it->unusedCompilations > poolLifetime) {
+      if (_releaseTexture) {
+        _releaseTexture(it->texture);
+      }
+      it = _pool.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+} // end of namespace BABYLON
@@ -203,6 +203,18 @@ void PostProcessRenderEffect::_linkParameters()
 
     item.second->onBeforeRenderObservable.add(
       [this](Effect* effect) { _linkTextures(effect); });
+
+    // Render graph dependencies of the linked textures
+    for (auto& renderEffect : _renderEffectAsPasses) {
+      auto& postProcesses = renderEffect.second->_postProcesses;
+      auto it             = postProcesses.find(item.first);
+      if (it == postProcesses.end()) {
+        it = postProcesses.find("0");
+      }
+      if (it != postProcesses.end()) {
+        item.second->addTextureInput(it->second);
+      }
+    }
   }
 }
 
@@ -294,6 +294,7 @@ void SSAO2RenderingPipeline::_createSSAOCombinePostProcess(float ratio)
     effect->setTextureFromPostProcess("originalColor",
                                       _originalColorPostProcess);
   });
+  _ssaoCombinePostProcess->addTextureInput(_originalColorPostProcess);
 }
 
 void SSAO2RenderingPipeline::_createRandomTexture()
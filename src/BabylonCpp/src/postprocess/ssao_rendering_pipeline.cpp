@@ -190,6 +190,7 @@ void SSAORenderingPipeline::_createSSAOCombinePostProcess(float ratio)
     effect->setTextureFromPostProcess("originalColor",
                                       _originalColorPostProcess);
   });
+  _ssaoCombinePostProcess->addTextureInput(_originalColorPostProcess);
 }
 
 void SSAORenderingPipeline::_createRandomTexture()
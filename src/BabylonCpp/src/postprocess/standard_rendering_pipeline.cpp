@@ -450,6 +450,7 @@ void StandardRenderingPipeline::_createTextureAdderPostProcess(Scene* scene,
     _currentDepthOfFieldSource = textureAdderFinalPostProcess;
     _currentHDRSource          = textureAdderFinalPostProcess;
   });
+  textureAdderPostProcess->addTextureInput(originalPostProcess);
 
   // Add to pipeline
   addEffect(new PostProcessRenderEffect(
@@ -568,6 +569,9 @@ void StandardRenderingPipeline::_createHdrPostProcess(Scene* scene, float ratio)
   float time            = 0.f;
   float lastTime        = 0.f;
 
+  // The HDR source depends on the lens flare activation
+  hdrPostProcess->addTextureInput(textureAdderFinalPostProcess)
+    .addTextureInput(lensFlareFinalPostProcess);
   hdrPostProcess->setOnApply([&](Effect* effect) {
     effect->setTextureFromPostProcess("textureAdderSampler", _currentHDRSource);
 
@@ -630,6 +634,8 @@ void StandardRenderingPipeline::_createLensFlarePostProcess(Scene* scene,
     [&]() { return lensFlareComposePostProcess; }, false));
 
   // Lens flare
+  lensFlarePostProcess->addTextureInput(gaussianBlurHPostProcesses[0]);
+  lensFlarePostProcess->sampleInputTexture = false;
   lensFlarePostProcess->setOnApply([&](Effect* effect) {
     effect->setTextureFromPostProcess("textureSampler",
                                       gaussianBlurHPostProcesses[0]);
@@ -648,6 +654,7 @@ void StandardRenderingPipeline::_createLensFlarePostProcess(Scene* scene,
   });
 
   // Compose
+  lensFlareComposePostProcess->addTextureInput(textureAdderFinalPostProcess);
   lensFlareComposePostProcess->setOnApply([&](Effect* effect) {
     effect->setTextureFromPostProcess("otherSampler",
                                       textureAdderFinalPostProcess);
@@ -698,6 +705,7 @@ void StandardRenderingPipeline::_createDepthOfFieldPostProcess(Scene* scene,
     {"otherSampler", "depthSampler"}, ratio, nullptr,
     TextureConstants::BILINEAR_SAMPLINGMODE, scene->getEngine(), false,
     "#define DEPTH_OF_FIELD", EngineConstants::TEXTURETYPE_UNSIGNED_INT);
+  depthOfFieldPostProcess->addTextureInput(textureAdderFinalPostProcess);
   depthOfFieldPostProcess->setOnApply([&](Effect* effect) {
     effect->setTextureFromPostProcess("otherSampler",
                                       textureAdderFinalPostProcess);
@@ -14,6 +14,7 @@ StereoscopicInterlacePostProcess::StereoscopicInterlacePostProcess(
                   isStereoscopicHoriz ? "#define IS_STEREOSCOPIC_HORIZ 1" : "")
 {
   _passedProcess = rigCameras[0]->_rigPostProcess;
+  addTextureInput(_passedProcess);
   _stepSize      = Vector2(1.f / static_cast<float>(width),
                       1.f / static_cast<float>(height));
 
@@ -94,6 +94,16 @@ void ReflectionProbe::setRefreshRate(int value)
   _renderTargetTexture->setRefreshRate(value);
 }
 
+unsigned int ReflectionProbe::facesPerRender() const
+{
+  return _renderTargetTexture->facesPerRender;
+}
+
+void ReflectionProbe::setFacesPerRender(unsigned int value)
+{
+  _renderTargetTexture->facesPerRender = value;
+}
+
 Scene* ReflectionProbe::getScene() const
 {
   return _scene;
@@ -112,6 +122,8 @@ std::vector<AbstractMesh*>& ReflectionProbe::renderList()
 void ReflectionProbe::attachToMesh(AbstractMesh* mesh)
 {
   _attachedMesh = mesh;
+  // The reflections are mostly displayed by the mesh the probe is attached to
+  _renderTargetTexture->screenContributionMesh = mesh;
 }
 
 void ReflectionProbe::dispose(bool /*doNotRecurse*/)
@@ -39,6 +39,8 @@ DepthRenderer::DepthRenderer(Scene* scene, unsigned int type)
   _depthMap->setRefreshRate(1);
   _depthMap->renderParticles = false;
   _depthMap->renderList.clear();
+  // Read by the post processes of the frame, never deferred
+  _depthMap->renderPriority = 0.f;
 
   // set default depth value to 1.0 (far away)
   _depthMap->onClearObservable.add([](Engine* _engine) {
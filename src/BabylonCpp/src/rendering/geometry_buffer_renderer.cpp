@@ -45,6 +45,8 @@ GeometryBufferRenderer::GeometryBufferRenderer(Scene* scene, float ratio)
   _multiRenderTarget->setRefreshRate(1);
   _multiRenderTarget->renderParticles = false;
   _multiRenderTarget->renderList      = {};
+  // Read by the post processes of the frame, never deferred
+  _multiRenderTarget->renderPriority = 0.f;
 
   // set default depth value to 1.0 (far away)
   _multiRenderTarget->onClearObservable.add([](Engine* engine) {
@@ -12,6 +12,7 @@
 #include <babylon/mesh/_instances_batch.h>
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_compression.h>
 
 namespace BABYLON {
 
@@ -41,8 +42,16 @@ void OutlineRenderer::render(SubMesh* subMesh, _InstancesBatch* batch,
   auto mesh     = subMesh->getRenderingMesh();
   auto material = subMesh->getMaterial();
 
+  // The offset is applied to the quantized positions
+  float offset        = useOverlay ? 0.f : mesh->outlineWidth;
+  auto positionBuffer = mesh->getVertexBuffer(VertexBuffer::PositionKind);
+  if (positionBuffer
+      && positionBuffer->getFormat() == VertexCompression::Unorm16) {
+    offset /= positionBuffer->getQuantizationCube()[3];
+  }
+
   engine->enableEffect(_effect);
-  _effect->setFloat("offset", useOverlay ? 0 : mesh->outlineWidth);
+  _effect->setFloat("offset", offset);
   _effect->setColor4("color",
                      useOverlay ? mesh->overlayColor : mesh->outlineColor,
                      useOverlay ? mesh->overlayAlpha : 1.f);
@@ -79,6 +88,14 @@ bool OutlineRenderer::isReady(SubMesh* subMesh, bool useInstances)
   auto mesh     = subMesh->getMesh();
   auto material = subMesh->getMaterial();
 
+  // Compressed normals
+  auto normalBuffer
+    = subMesh->getRenderingMesh()->getVertexBuffer(VertexBuffer::NormalKind);
+  if (normalBuffer
+      && normalBuffer->getFormat() == VertexCompression::Octahedral16) {
+    defines.emplace_back("#define NORMAL_OCTAHEDRAL");
+  }
+
   // Alpha test
   if (material && material->needAlphaTesting()) {
     defines.emplace_back("#define ALPHATEST");
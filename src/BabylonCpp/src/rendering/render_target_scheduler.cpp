@@ -0,0 +1,170 @@
+#include <babylon/rendering/render_target_scheduler.h>
+
+#include <babylon/cameras/camera.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/bounding_sphere.h>
+#include <babylon/materials/textures/render_target_texture.h>
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/abstract_mesh.h>
+
+namespace BABYLON {
+
+RenderTargetScheduler::RenderTargetScheduler(unsigned int iFaceBudget)
+    : faceBudget{iFaceBudget}
+    , _frameId{0}
+    , _remainingBudget{iFaceBudget}
+    , _renderedFaceCount{0}
+    , _deferredCount{0}
+{
+}
+
+RenderTargetScheduler::~RenderTargetScheduler()
+{
+}
+
+void RenderTargetScheduler::beginFrame()
+{
+  ++_frameId;
+  _remainingBudget   = faceBudget;
+  _renderedFaceCount = 0;
+  _deferredCount     = 0;
+}
+
+std::vector<RenderTargetTexture*> RenderTargetScheduler::schedule(
+  const std::vector<RenderTargetTexture*>& renderTargets, Camera* camera)
+{
+  std::vector<RenderTargetTexture*> dueRenderTargets;
+  std::vector<Request> requests;
+  for (auto& renderTarget : renderTargets) {
+    if (!renderTarget->_shouldRender()) {
+      continue;
+    }
+
+    // Never rendered render targets are the stalest ones
+    const auto it = _lastRenderFrames.find(renderTarget);
+    const unsigned int staleness
+      = (it != _lastRenderFrames.end()) ? _frameId - it->second : _frameId + 1;
+    float weight = renderTarget->renderPriority;
+    if (renderTarget->screenContributionMesh && camera) {
+      weight
+        *= ScreenContribution(renderTarget->screenContributionMesh, camera);
+    }
+
+    dueRenderTargets.emplace_back(renderTarget);
+    requests.emplace_back(Request{weight, renderTarget->facesToRender(),
+                                  staleness,
+                                  renderTarget->renderPriority <= 0.f});
+  }
+
+  std::vector<size_t> selection;
+  if (faceBudget == 0) {
+    selection.resize(requests.size());
+    std::iota(selection.begin(), selection.end(), 0);
+  }
+  else {
+    selection = Select(requests, _remainingBudget);
+  }
+
+  std::vector<RenderTargetTexture*> scheduledRenderTargets;
+  size_t s = 0;
+  for (size_t i = 0; i < dueRenderTargets.size(); ++i) {
+    auto renderTarget = dueRenderTargets[i];
+    if (s < selection.size() && selection[s] == i) {
+      scheduledRenderTargets.emplace_back(renderTarget);
+      _lastRenderFrames[renderTarget] = _frameId;
+      _renderedFaceCount += requests[i].cost;
+      ++s;
+    }
+    else {
+      // Still due on the next frame
+      renderTarget->resetRefreshCounter();
+      ++_deferredCount;
+    }
+  }
+
+  return scheduledRenderTargets;
+}
+
+void RenderTargetScheduler::removeRenderTarget(
+  RenderTargetTexture* renderTarget)
+{
+  _lastRenderFrames.erase(renderTarget);
+}
+
+std::vector<size_t>
+RenderTargetScheduler::Select(const std::vector<Request>& requests,
+                              unsigned int& budget)
+{
+  // Required requests first, then by decreasing score
+  const auto score = [](const Request& request) {
+    return request.weight * (1.f + static_cast<float>(request.staleness));
+  };
+  std::vector<size_t> order(requests.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(
+    order.begin(), order.end(), [&requests, &score](size_t a, size_t b) {
+      if (requests[a].required != requests[b].required) {
+        return requests[a].required;
+      }
+      return score(requests[a]) > score(requests[b]);
+    });
+
+  std::vector<size_t> selection;
+  bool budgeted = false;
+  for (auto index : order) {
+    const auto& request = requests[index];
+    if (request.required || request.cost <= budget) {
+      budget -= std::min(budget, request.cost);
+      budgeted = budgeted || !request.required;
+      selection.emplace_back(index);
+    }
+    else if (!budgeted && budget > 0) {
+      // Does not fit but ranks first: rendered alone
+      budget   = 0;
+      budgeted = true;
+      selection.emplace_back(index);
+    }
+  }
+
+  std::sort(selection.begin(), selection.end());
+  return selection;
+}
+
+float RenderTargetScheduler::ScreenContribution(AbstractMesh* mesh,
+                                                Camera* camera)
+{
+  if (!mesh->isEnabled() || !camera->isInFrustum(mesh)) {
+    return 0.f;
+  }
+
+  if (camera->mode == Camera::ORTHOGRAPHIC_CAMERA) {
+    return 1.f;
+  }
+
+  const auto& boundingSphere = mesh->getBoundingInfo()->boundingSphere;
+  const float distance
+    = Vector3::Distance(camera->globalPosition(), boundingSphere.centerWorld);
+  if (distance <= boundingSphere.radiusWorld) {
+    return 1.f;
+  }
+
+  // Projected radius relative to the half height of the screen, the screen
+  // being approximated by a square
+  const float projectedRadius
+    = boundingSphere.radiusWorld / (distance * std::tan(camera->fov * 0.5f));
+  const float coverage = Math::PI * projectedRadius * projectedRadius * 0.25f;
+
+  return (coverage < 1.f) ? coverage : 1.f;
+}
+
+unsigned int RenderTargetScheduler::renderedFaceCount() const
+{
+  return _renderedFaceCount;
+}
+
+size_t RenderTargetScheduler::deferredCount() const
+{
+  return _deferredCount;
+}
+
+} // end of namespace BABYLON
@@ -2,6 +2,7 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/frame_arena.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/bounding_sphere.h>
 #include <babylon/engine/engine.h>
@@ -90,7 +91,7 @@ void RenderingGroup::render(
                      const std::vector<SubMesh*>& alphaTestSubMeshes)>&
     customRenderFunction,
   bool renderSprites, bool renderParticles,
-  const std::vector<AbstractMesh*> activeMeshes)
+  const std::vector<AbstractMesh*>& activeMeshes)
 {
   if (customRenderFunction) {
     customRenderFunction(_opaqueSubMeshes, _alphaTestSubMeshes,
@@ -174,7 +175,7 @@ void RenderingGroup::renderSorted(
           .length();
   }
 
-  auto sortedArray = subMeshes;
+  FrameVector<SubMesh*> sortedArray(subMeshes.begin(), subMeshes.end());
 
   // sort using a custom function object
   std::sort(
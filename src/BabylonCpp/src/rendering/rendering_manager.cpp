@@ -3,6 +3,8 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/engine/engine.h>
 #include <babylon/engine/rendering_group_info.h>
+#include <babylon/materials/material.h>
+#include <babylon/mesh/mesh.h>
 #include <babylon/mesh/sub_mesh.h>
 #include <babylon/particles/particle_system.h>
 #include <babylon/rendering/rendering_group.h>
@@ -13,7 +15,10 @@ namespace BABYLON {
 bool RenderingManager::AUTOCLEAR = true;
 
 RenderingManager::RenderingManager(Scene* scene)
-    : _scene{scene}, _renderinGroupInfo{nullptr}
+    : autoInstancing{false}
+    , _scene{scene}
+    , _renderinGroupInfo{nullptr}
+    , _autoInstancingGroups{nullptr}
 {
   _autoClearDepthStencil.resize(MAX_RENDERINGGROUPS);
   _customOpaqueSortCompareFn.resize(MAX_RENDERINGGROUPS);
@@ -69,6 +74,9 @@ void RenderingManager::render(
     }
   }
 
+  // Expose the automatic instances to their submesh while rendering
+  _exposeAutoInstances(true);
+
   // Render
   auto info = _renderinGroupInfo.get();
   for (unsigned int index = RenderingManager::MIN_RENDERINGGROUPS;
@@ -128,10 +136,26 @@ void RenderingManager::render(
                                                          renderingGroupMask);
     }
   }
+
+  _exposeAutoInstances(false);
+}
+
+void RenderingManager::_exposeAutoInstances(bool expose)
+{
+  if (!_autoInstancingGroups) {
+    return;
+  }
+
+  for (auto& item : *_autoInstancingGroups) {
+    auto& group                 = item.second;
+    group.first->_autoInstances = expose ? &group.second : nullptr;
+  }
 }
 
 void RenderingManager::reset()
 {
+  _autoInstancingGroups = nullptr;
+
   for (unsigned index = RenderingManager::MIN_RENDERINGGROUPS;
        index < RenderingManager::MAX_RENDERINGGROUPS; ++index) {
     if (index < _renderingGroups.size()) {
@@ -155,6 +179,7 @@ void RenderingManager::dispose()
     }
   }
   _renderingGroups.clear();
+  _autoInstancingGroups = nullptr;
 }
 
 void RenderingManager::_prepareRenderingGroup(unsigned int renderingGroupId)
@@ -192,8 +217,72 @@ void RenderingManager::dispatchParticles(ParticleSystem* particleSystem)
   _renderingGroups[renderingGroupId]->dispatchParticles(particleSystem);
 }
 
+bool RenderingManager::_dispatchAutoInstance(SubMesh* subMesh)
+{
+  auto mesh     = subMesh->getMesh();
+  auto material = subMesh->getMaterial();
+  if (!material || mesh->type() != IReflect::Type::MESH
+      || subMesh->getRenderingMesh() != mesh) {
+    return false;
+  }
+
+  auto _mesh = static_cast<Mesh*>(mesh);
+  if (!_mesh->geometry() || !_mesh->instances.empty() || _mesh->skeleton()
+      || _mesh->morphTargetManager() || _mesh->renderOutline
+      || _mesh->renderOverlay || _mesh->visibility < 1.f
+      || _mesh->hasVertexAlpha() || material->needAlphaBlending()
+      || _mesh->onBeforeRenderObservable.hasObservers()
+      || _mesh->onAfterRenderObservable.hasObservers()
+      || _mesh->onBeforeDrawObservable.hasObservers()) {
+    return false;
+  }
+
+  // Mesh properties affecting the material defines
+  const unsigned int flags = (_mesh->receiveShadows() ? 1u : 0u)
+                             | (_mesh->applyFog() ? 2u : 0u)
+                             | (_mesh->useVertexColors() ? 4u : 0u);
+  // The instances are rendered with the lights of the first mesh
+  size_t lightsHash = _mesh->_lightSources.size();
+  for (auto& light : _mesh->_lightSources) {
+    lightsHash ^= std::hash<Light*>()(light) + 0x9e3779b9 + (lightsHash << 6)
+                  + (lightsHash >> 2);
+  }
+  const auto key = std::make_tuple(
+    _mesh->geometry(), material, subMesh->verticesStart,
+    subMesh->verticesCount, subMesh->indexStart, subMesh->indexCount,
+    _mesh->renderingGroupId, flags, _mesh->layerMask, lightsHash);
+
+  if (!_autoInstancingGroups) {
+    auto& arena           = FrameArena::Current();
+    _autoInstancingGroups = new (arena.allocate(
+      sizeof(AutoInstancingGroups), alignof(AutoInstancingGroups)))
+      AutoInstancingGroups();
+  }
+
+  auto it = _autoInstancingGroups->find(key);
+  if (it == _autoInstancingGroups->end()) {
+    // First submesh of the group, rendered as usual
+    _autoInstancingGroups->emplace(
+      key, AutoInstancingGroup(subMesh, FrameVector<AbstractMesh*>()));
+    return false;
+  }
+
+  // Same hash but different lights, rendered as usual
+  if (it->second.first->getMesh()->_lightSources != _mesh->_lightSources) {
+    return false;
+  }
+
+  it->second.second.emplace_back(mesh);
+
+  return true;
+}
+
 void RenderingManager::dispatch(SubMesh* subMesh)
 {
+  if (autoInstancing && _dispatchAutoInstance(subMesh)) {
+    return;
+  }
+
   auto mesh                    = subMesh->getMesh();
   const auto& renderingGroupId = mesh->renderingGroupId;
 
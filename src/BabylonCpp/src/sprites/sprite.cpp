@@ -16,7 +16,9 @@ Sprite::Sprite(const std::string& iName, SpriteManager* manager)
     , cellIndex{0}
     , invertU{0}
     , invertV{0}
+    , disposeWhenFinishedAnimating{false}
     , isPickable{false}
+    , _isStatic{false}
     , _animationStarted{false}
     , _loopAnimation{false}
     , _fromIndex{0}
@@ -37,6 +39,7 @@ Sprite::~Sprite()
 void Sprite::addToSpriteManager(std::unique_ptr<Sprite>&& newSprite)
 {
   _manager->sprites.emplace_back(std::move(newSprite));
+  _manager->markAsDirty();
 }
 
 int Sprite::size() const
@@ -50,6 +53,21 @@ void Sprite::setSize(int value)
   height = value;
 }
 
+bool Sprite::isStatic() const
+{
+  return _isStatic;
+}
+
+void Sprite::setStatic(bool value)
+{
+  if (_isStatic == value) {
+    return;
+  }
+
+  _isStatic = value;
+  _manager->markAsDirty();
+}
+
 void Sprite::playAnimation(int from, int to, bool loop, millisecond_t delay,
                            const std::function<void()>& onAnimationEnd)
 {
@@ -65,6 +83,9 @@ void Sprite::playAnimation(int from, int to, bool loop, millisecond_t delay,
   _time     = std::chrono::milliseconds(0);
 
   _onAnimationEnd = onAnimationEnd;
+
+  // Static sprites are not animated
+  setStatic(false);
 }
 
 void Sprite::stopAnimation()
@@ -100,13 +121,8 @@ void Sprite::_animate(const millisecond_t& deltaTime)
 
 void Sprite::dispose(bool /*doNotRecurse*/)
 {
-  // Remove from scene
-  _manager->sprites.erase(
-    std::remove_if(_manager->sprites.begin(), _manager->sprites.end(),
-                   [this](const std::unique_ptr<Sprite>& sprite) {
-                     return sprite.get() == this;
-                   }),
-    _manager->sprites.end());
+  // Remove from the sprite manager
+  _manager->_removeSprite(this);
 }
 
 } // end of namespace BABYLON
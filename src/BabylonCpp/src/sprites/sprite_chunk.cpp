@@ -0,0 +1,163 @@
+#include <babylon/sprites/sprite_chunk.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Spreads the 10 lowest bits of value, 2 zero bits between each bit
+uint32_t expandBits(uint32_t value)
+{
+  value &= 0x000003ff;
+  value = (value | (value << 16)) & 0xff0000ff;
+  value = (value | (value << 8)) & 0x0300f00f;
+  value = (value | (value << 4)) & 0x030c30c3;
+  value = (value | (value << 2)) & 0x09249249;
+  return value;
+}
+
+uint32_t quantize(float value, float minimum, float scale)
+{
+  const float quantized = (value - minimum) * scale;
+  return quantized <= 0.f ?
+           0u :
+           quantized >= 1023.f ? 1023u : static_cast<uint32_t>(quantized);
+}
+
+} // end of anonymous namespace
+
+bool SpriteChunk::isInFrustum(const std::array<Plane, 6>& frustumPlanes) const
+{
+  for (const auto& plane : frustumPlanes) {
+    // Corner of the box the furthest along the plane normal
+    const Vector3 corner(plane.normal.x >= 0.f ? maximum.x : minimum.x,
+                         plane.normal.y >= 0.f ? maximum.y : minimum.y,
+                         plane.normal.z >= 0.f ? maximum.z : minimum.z);
+    if (plane.dotCoordinate(corner) < 0.f) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::vector<SpriteChunk>
+SpriteChunk::Build(const std::vector<Vector3>& positions,
+                   const Float32Array& radii, size_t chunkSize,
+                   std::vector<size_t>& order)
+{
+  const size_t count = positions.size();
+  order.resize(count);
+  for (size_t index = 0; index < count; ++index) {
+    order[index] = index;
+  }
+  if (count == 0) {
+    return std::vector<SpriteChunk>();
+  }
+  chunkSize = std::max(chunkSize, static_cast<size_t>(1));
+
+  // Morton codes of the positions, quantized on 10 bits per axis
+  auto minimum = positions[0];
+  auto maximum = positions[0];
+  for (const auto& position : positions) {
+    minimum.minimizeInPlace(position);
+    maximum.maximizeInPlace(position);
+  }
+  const auto scale = [](float extent) {
+    return extent > 0.f ? 1023.f / extent : 0.f;
+  };
+  const float scaleX = scale(maximum.x - minimum.x);
+  const float scaleY = scale(maximum.y - minimum.y);
+  const float scaleZ = scale(maximum.z - minimum.z);
+
+  std::vector<uint32_t> codes(count);
+  for (size_t index = 0; index < count; ++index) {
+    const auto& position = positions[index];
+    codes[index] = (expandBits(quantize(position.x, minimum.x, scaleX)) << 2)
+                   | (expandBits(quantize(position.y, minimum.y, scaleY)) << 1)
+                   | expandBits(quantize(position.z, minimum.z, scaleZ));
+  }
+  std::sort(order.begin(), order.end(), [&codes](size_t a, size_t b) {
+    return codes[a] < codes[b] || (codes[a] == codes[b] && a < b);
+  });
+
+  std::vector<SpriteChunk> chunks;
+  chunks.reserve((count + chunkSize - 1) / chunkSize);
+  for (size_t start = 0; start < count; start += chunkSize) {
+    SpriteChunk chunk;
+    chunk.start   = start;
+    chunk.count   = std::min(chunkSize, count - start);
+    chunk.minimum = Vector3(std::numeric_limits<float>::max(),
+                            std::numeric_limits<float>::max(),
+                            std::numeric_limits<float>::max());
+    chunk.maximum = Vector3(std::numeric_limits<float>::lowest(),
+                            std::numeric_limits<float>::lowest(),
+                            std::numeric_limits<float>::lowest());
+    for (size_t i = start; i < start + chunk.count; ++i) {
+      const auto& position = positions[order[i]];
+      const float radius   = order[i] < radii.size() ? radii[order[i]] : 0.f;
+      chunk.minimum.minimizeInPlace(
+        Vector3(position.x - radius, position.y - radius, position.z - radius));
+      chunk.maximum.maximizeInPlace(
+        Vector3(position.x + radius, position.y + radius, position.z + radius));
+    }
+    chunks.emplace_back(chunk);
+  }
+
+  return chunks;
+}
+
+void SpriteChunk::CullSpheres(const Float32Array& x, const Float32Array& y,
+                              const Float32Array& z, const Float32Array& radii,
+                              const std::array<Plane, 6>& frustumPlanes,
+                              std::vector<size_t>& visible)
+{
+  const size_t count
+    = std::min(std::min(x.size(), y.size()), std::min(z.size(), radii.size()));
+  visible.clear();
+
+  size_t i = 0;
+#if defined(__SSE2__)
+  const __m128 allSet = _mm_castsi128_ps(_mm_set1_epi32(-1));
+  for (; i + 4 <= count; i += 4) {
+    const __m128 px          = _mm_loadu_ps(x.data() + i);
+    const __m128 py          = _mm_loadu_ps(y.data() + i);
+    const __m128 pz          = _mm_loadu_ps(z.data() + i);
+    const __m128 minDistance = _mm_sub_ps(_mm_setzero_ps(),
+                                          _mm_loadu_ps(radii.data() + i));
+    __m128 inside            = allSet;
+    for (const auto& plane : frustumPlanes) {
+      const __m128 distance = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal.x), px),
+                   _mm_mul_ps(_mm_set1_ps(plane.normal.y), py)),
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.normal.z), pz),
+                   _mm_set1_ps(plane.d)));
+      inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, minDistance));
+    }
+    const int mask = _mm_movemask_ps(inside);
+    for (size_t lane = 0; lane < 4; ++lane) {
+      if (mask & (1 << lane)) {
+        visible.emplace_back(i + lane);
+      }
+    }
+  }
+#endif
+  for (; i < count; ++i) {
+    const Vector3 center(x[i], y[i], z[i]);
+    bool inside = true;
+    for (const auto& plane : frustumPlanes) {
+      if (!(plane.dotCoordinate(center) >= -radii[i])) {
+        inside = false;
+        break;
+      }
+    }
+    if (inside) {
+      visible.emplace_back(i);
+    }
+  }
+}
+
+} // end of namespace BABYLON
@@ -10,13 +10,30 @@
 #include <babylon/materials/effect_fallbacks.h>
 #include <babylon/materials/textures/texture.h>
 #include <babylon/math/color3.h>
+#include <babylon/math/frustum.h>
 #include <babylon/math/matrix.h>
 #include <babylon/mesh/buffer.h>
 #include <babylon/mesh/vertex_buffer.h>
 #include <babylon/tools/tools.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace BABYLON {
 
+namespace {
+
+// Radius of the bounding sphere of a sprite, whatever its angle
+float spriteRadius(const Sprite& sprite)
+{
+  const auto width  = static_cast<float>(sprite.width);
+  const auto height = static_cast<float>(sprite.height);
+  return 0.5f * std::sqrt(width * width + height * height);
+}
+
+} // end of anonymous namespace
+
 SpriteManager::SpriteManager(const std::string& iName,
                              const std::string& imgUrl, unsigned int capacity,
                              const ISize& cellSize, Scene* scene, float epsilon,
@@ -27,8 +44,14 @@ SpriteManager::SpriteManager(const std::string& iName,
     , fogEnabled{true}
     , isPickable{false}
     , _epsilon{epsilon}
+    , chunkSize{256}
+    , sortByDepth{false}
     , _capacity{capacity}
     , _scene{scene}
+    , _isDirty{true}
+    , _isAnimating{false}
+    , _rowSize{0}
+    , _visibleSpriteCount{0}
 {
   _spriteTexture = Texture::New(imgUrl, scene, true, false, samplingMode);
   _spriteTexture->wrapU = TextureConstants::CLAMP_ADDRESSMODE;
@@ -90,27 +113,31 @@ SpriteManager::SpriteManager(const std::string& iName,
   // Effects
 
   {
-    EffectCreationOptions options;
-    options.attributes = {VertexBuffer::PositionKindChars, "options",
-                          "cellInfo", VertexBuffer::ColorKindChars};
-    options.uniformsNames = {"view", "projection", "textureInfos", "alphaTest"};
-    options.samplers      = {"diffuseSampler"};
-
-    _effectBase = _scene->getEngine()->createEffect("sprites", options,
-                                                    _scene->getEngine());
+    EffectCreationOptions effectCreationOptions;
+    effectCreationOptions.attributes
+      = {VertexBuffer::PositionKindChars, "options", "cellInfo",
+         VertexBuffer::ColorKindChars};
+    effectCreationOptions.uniformsNames
+      = {"view", "projection", "textureInfos", "alphaTest"};
+    effectCreationOptions.samplers = {"diffuseSampler"};
+
+    _effectBase = _scene->getEngine()->createEffect(
+      "sprites", effectCreationOptions, _scene->getEngine());
   }
 
   {
-    EffectCreationOptions options;
-    options.attributes = {VertexBuffer::PositionKindChars, "options",
-                          "cellInfo", VertexBuffer::ColorKindChars};
-    options.uniformsNames = {"view",      "projection", "textureInfos",
-                             "alphaTest", "vFogInfos",  "vFogColor"};
-    options.samplers = {"diffuseSampler"};
-    options.defines  = "#define FOG";
-
-    _effectFog = _scene->getEngine()->createEffect("sprites", options,
-                                                   _scene->getEngine());
+    EffectCreationOptions effectCreationOptions;
+    effectCreationOptions.attributes
+      = {VertexBuffer::PositionKindChars, "options", "cellInfo",
+         VertexBuffer::ColorKindChars};
+    effectCreationOptions.uniformsNames
+      = {"view",      "projection", "textureInfos",
+         "alphaTest", "vFogInfos",  "vFogColor"};
+    effectCreationOptions.samplers = {"diffuseSampler"};
+    effectCreationOptions.defines  = "#define FOG";
+
+    _effectFog = _scene->getEngine()->createEffect(
+      "sprites", effectCreationOptions, _scene->getEngine());
   }
 }
 
@@ -132,6 +159,7 @@ Texture* SpriteManager::texture() const
 void SpriteManager::texture(Texture* value)
 {
   _spriteTexture = value;
+  _isDirty       = true;
 }
 
 void SpriteManager::setOnDispose(const std::function<void()>& callback)
@@ -142,48 +170,180 @@ void SpriteManager::setOnDispose(const std::function<void()>& callback)
   _onDisposeObserver = onDisposeObservable.add(callback);
 }
 
-void SpriteManager::_appendSpriteVertex(size_t index, Sprite* sprite,
-                                        int offsetX, int offsetY, int rowSize)
+void SpriteManager::markAsDirty()
+{
+  _isDirty = true;
+}
+
+const std::vector<SpriteChunk>& SpriteManager::chunks() const
+{
+  return _chunks;
+}
+
+size_t SpriteManager::visibleSpriteCount() const
+{
+  return _visibleSpriteCount;
+}
+
+void SpriteManager::_removeSprite(Sprite* sprite)
+{
+  if (_isAnimating) {
+    _disposedSprites.emplace_back(sprite);
+    return;
+  }
+
+  sprites.erase(std::remove_if(sprites.begin(), sprites.end(),
+                               [sprite](const std::unique_ptr<Sprite>& item) {
+                                 return item.get() == sprite;
+                               }),
+                sprites.end());
+  _isDirty = true;
+}
+
+void SpriteManager::_appendSpriteVertices(size_t index, const Sprite& sprite,
+                                          int rowSize)
 {
-  size_t arrayOffset = index * 16;
-
-  float offsetXVal = static_cast<float>(offsetX);
-  float offsetYVal = static_cast<float>(offsetY);
-
-  if (offsetX == 0) {
-    offsetXVal = _epsilon;
-  }
-  else if (offsetX == 1) {
-    offsetXVal = 1.f - _epsilon;
-  }
-
-  if (offsetY == 0) {
-    offsetYVal = _epsilon;
-  }
-  else if (offsetY == 1) {
-    offsetYVal = 1.f - _epsilon;
-  }
-
-  _vertexData[arrayOffset + 0] = sprite->position.x;
-  _vertexData[arrayOffset + 1] = sprite->position.y;
-  _vertexData[arrayOffset + 2] = sprite->position.z;
-  _vertexData[arrayOffset + 3] = sprite->angle;
-  _vertexData[arrayOffset + 4] = static_cast<float>(sprite->width);
-  _vertexData[arrayOffset + 5] = static_cast<float>(sprite->height);
-  _vertexData[arrayOffset + 6] = offsetXVal;
-  _vertexData[arrayOffset + 7] = offsetYVal;
-  _vertexData[arrayOffset + 8] = sprite->invertU ? 1.f : 0.f;
-  _vertexData[arrayOffset + 9] = sprite->invertV ? 1.f : 0.f;
-  float offset = static_cast<float>((sprite->cellIndex / rowSize) >> 0);
-  _vertexData[arrayOffset + 10]
-    = static_cast<float>(static_cast<float>(sprite->cellIndex)
-                         - offset * static_cast<float>(rowSize));
-  _vertexData[arrayOffset + 11] = offset;
-  // Color
-  _vertexData[arrayOffset + 12] = sprite->color->r;
-  _vertexData[arrayOffset + 13] = sprite->color->g;
-  _vertexData[arrayOffset + 14] = sprite->color->b;
-  _vertexData[arrayOffset + 15] = sprite->color->a;
+  // 4 vertices of 16 floats: the corners only differ by their offsets
+  float* data = _vertexData.data() + index * 16 * 4;
+
+  const float cellY   = static_cast<float>(sprite.cellIndex / rowSize);
+  const float cellX   = static_cast<float>(sprite.cellIndex)
+                      - cellY * static_cast<float>(rowSize);
+  const float width   = static_cast<float>(sprite.width);
+  const float height  = static_cast<float>(sprite.height);
+  const float invertU = sprite.invertU ? 1.f : 0.f;
+  const float invertV = sprite.invertV ? 1.f : 0.f;
+  const float low     = _epsilon;
+  const float high    = 1.f - _epsilon;
+  const float offsets[4][2]
+    = {{low, low}, {high, low}, {high, high}, {low, high}};
+
+#if defined(__SSE2__)
+  const __m128 position = _mm_set_ps(sprite.angle, sprite.position.z,
+                                     sprite.position.y, sprite.position.x);
+  const __m128 cellInfo = _mm_set_ps(cellY, cellX, invertV, invertU);
+  const __m128 color    = _mm_set_ps(sprite.color->a, sprite.color->b,
+                                     sprite.color->g, sprite.color->r);
+  for (const auto& offset : offsets) {
+    _mm_storeu_ps(data, position);
+    _mm_storeu_ps(data + 4, _mm_set_ps(offset[1], offset[0], height, width));
+    _mm_storeu_ps(data + 8, cellInfo);
+    _mm_storeu_ps(data + 12, color);
+    data += 16;
+  }
+#else
+  for (const auto& offset : offsets) {
+    data[0]  = sprite.position.x;
+    data[1]  = sprite.position.y;
+    data[2]  = sprite.position.z;
+    data[3]  = sprite.angle;
+    data[4]  = width;
+    data[5]  = height;
+    data[6]  = offset[0];
+    data[7]  = offset[1];
+    data[8]  = invertU;
+    data[9]  = invertV;
+    data[10] = cellX;
+    data[11] = cellY;
+    data[12] = sprite.color->r;
+    data[13] = sprite.color->g;
+    data[14] = sprite.color->b;
+    data[15] = sprite.color->a;
+    data += 16;
+  }
+#endif
+}
+
+void SpriteManager::_rebuildChunks(int rowSize)
+{
+  _staticSprites.clear();
+  _dynamicSprites.clear();
+  size_t count = 0;
+  for (auto& sprite : sprites) {
+    if (!sprite) {
+      continue;
+    }
+    if (count++ == _capacity) {
+      break;
+    }
+    if (sprite->isStatic()) {
+      _staticSprites.emplace_back(sprite.get());
+    }
+    else {
+      _dynamicSprites.emplace_back(sprite.get());
+    }
+  }
+
+  // Spatially sorted static sprites
+  std::vector<Vector3> positions;
+  Float32Array radii;
+  positions.reserve(_staticSprites.size());
+  radii.reserve(_staticSprites.size());
+  for (auto sprite : _staticSprites) {
+    positions.emplace_back(sprite->position);
+    radii.emplace_back(spriteRadius(*sprite));
+  }
+  std::vector<size_t> order;
+  _chunks = SpriteChunk::Build(positions, radii, chunkSize, order);
+  std::vector<Sprite*> staticSprites(order.size());
+  for (size_t index = 0; index < order.size(); ++index) {
+    staticSprites[index] = _staticSprites[order[index]];
+  }
+  _staticSprites.swap(staticSprites);
+
+  // The static sprites are uploaded once
+  for (size_t index = 0; index < _staticSprites.size(); ++index) {
+    _appendSpriteVertices(index, *_staticSprites[index], rowSize);
+  }
+  if (!_staticSprites.empty()) {
+    _buffer->updateDirectly(_vertexData, 0, _staticSprites.size() * 4);
+  }
+
+  _rowSize = rowSize;
+  _isDirty = false;
+}
+
+void SpriteManager::_updateDynamicSprites(
+  int rowSize, const Matrix& viewMatrix,
+  const std::array<Plane, 6>& frustumPlanes)
+{
+  // Bounding spheres, as separate arrays for the SIMD culling
+  const size_t count = _dynamicSprites.size();
+  _dynamicX.resize(count);
+  _dynamicY.resize(count);
+  _dynamicZ.resize(count);
+  _dynamicRadii.resize(count);
+  for (size_t index = 0; index < count; ++index) {
+    const auto& sprite   = *_dynamicSprites[index];
+    _dynamicX[index]     = sprite.position.x;
+    _dynamicY[index]     = sprite.position.y;
+    _dynamicZ[index]     = sprite.position.z;
+    _dynamicRadii[index] = spriteRadius(sprite);
+  }
+  SpriteChunk::CullSpheres(_dynamicX, _dynamicY, _dynamicZ, _dynamicRadii,
+                           frustumPlanes, _visibleDynamicSprites);
+
+  if (sortByDepth) {
+    const auto& m    = viewMatrix.m;
+    const auto depth = [&](size_t index) {
+      return m[2] * _dynamicX[index] + m[6] * _dynamicY[index]
+             + m[10] * _dynamicZ[index];
+    };
+    std::sort(_visibleDynamicSprites.begin(), _visibleDynamicSprites.end(),
+              [&depth](size_t a, size_t b) { return depth(a) > depth(b); });
+  }
+
+  // Only the visible dynamic sprites are uploaded, after the static ones
+  const size_t start = _staticSprites.size();
+  for (size_t index = 0; index < _visibleDynamicSprites.size(); ++index) {
+    _appendSpriteVertices(start + index,
+                          *_dynamicSprites[_visibleDynamicSprites[index]],
+                          rowSize);
+  }
+  if (!_visibleDynamicSprites.empty()) {
+    _buffer->updateDirectly(_vertexData, static_cast<int>(start * 16 * 4),
+                            _visibleDynamicSprites.size() * 4);
+  }
 }
 
 PickingInfo*
@@ -265,23 +425,86 @@ void SpriteManager::render()
 
   // Sprites
   microseconds_t deltaTime = engine->getDeltaTime();
-  size_t max               = std::min(_capacity, sprites.size());
   int rowSize              = baseSize.width / cellWidth;
 
-  unsigned int offset = 0;
-  for (auto& sprite : sprites) {
-    if (!sprite) {
-      continue;
-    }
+  if (_isDirty || rowSize != _rowSize) {
+    _rebuildChunks(rowSize);
+  }
 
+  // The sprites disposed at the end of their animation are removed afterwards
+  _isAnimating = true;
+  for (auto sprite : _dynamicSprites) {
     sprite->_animate(std::chrono::duration_cast<milliseconds_t>(deltaTime));
+  }
+  _isAnimating = false;
+  if (!_disposedSprites.empty()) {
+    std::vector<Sprite*> disposedSprites;
+    disposedSprites.swap(_disposedSprites);
+    for (auto sprite : disposedSprites) {
+      _removeSprite(sprite);
+    }
+  }
+  if (_isDirty) {
+    _rebuildChunks(rowSize);
+  }
 
-    _appendSpriteVertex(offset++, sprite.get(), 0, 0, rowSize);
-    _appendSpriteVertex(offset++, sprite.get(), 1, 0, rowSize);
-    _appendSpriteVertex(offset++, sprite.get(), 1, 1, rowSize);
-    _appendSpriteVertex(offset++, sprite.get(), 0, 1, rowSize);
+  // Culling
+  auto viewMatrix = _scene->getViewMatrix();
+  std::array<Plane, 6> frustumPlanes;
+  Frustum::GetPlanesToRef(_scene->getTransformMatrix(), frustumPlanes);
+  _updateDynamicSprites(rowSize, viewMatrix, frustumPlanes);
+
+  _drawRanges.clear();
+  if (sortByDepth) {
+    // Back to front chunks, then the sorted dynamic sprites
+    std::vector<std::pair<float, size_t>> visibleChunks;
+    const auto& m = viewMatrix.m;
+    for (size_t index = 0; index < _chunks.size(); ++index) {
+      const auto& chunk = _chunks[index];
+      if (chunk.isInFrustum(frustumPlanes)) {
+        const auto center = (chunk.minimum + chunk.maximum).scale(0.5f);
+        visibleChunks.emplace_back(
+          m[2] * center.x + m[6] * center.y + m[10] * center.z, index);
+      }
+    }
+    std::sort(visibleChunks.begin(), visibleChunks.end(),
+              [](const std::pair<float, size_t>& a,
+                 const std::pair<float, size_t>& b) {
+                return a.first > b.first;
+              });
+    for (const auto& visibleChunk : visibleChunks) {
+      const auto& chunk = _chunks[visibleChunk.second];
+      _drawRanges.emplace_back(chunk.start, chunk.count);
+    }
+  }
+  else {
+    // Consecutive visible chunks are merged in a single draw call
+    for (const auto& chunk : _chunks) {
+      if (!chunk.isInFrustum(frustumPlanes)) {
+        continue;
+      }
+      if (!_drawRanges.empty()
+          && _drawRanges.back().first + _drawRanges.back().second
+               == chunk.start) {
+        _drawRanges.back().second += chunk.count;
+      }
+      else {
+        _drawRanges.emplace_back(chunk.start, chunk.count);
+      }
+    }
+  }
+  if (!_visibleDynamicSprites.empty()) {
+    _drawRanges.emplace_back(_staticSprites.size(),
+                             _visibleDynamicSprites.size());
+  }
+
+  _visibleSpriteCount = 0;
+  for (const auto& drawRange : _drawRanges) {
+    _visibleSpriteCount += drawRange.second;
+  }
+  if (_visibleSpriteCount == 0) {
+    return;
   }
-  _buffer->update(_vertexData);
 
   // Render
   auto effect = _effectBase;
@@ -293,7 +516,6 @@ void SpriteManager::render()
 
   engine->enableEffect(effect);
 
-  auto viewMatrix = _scene->getViewMatrix();
   effect->setTexture("diffuseSampler", _spriteTexture);
   effect->setMatrix("view", viewMatrix);
   effect->setMatrix("projection", _scene->getProjectionMatrix());
@@ -317,12 +539,18 @@ void SpriteManager::render()
   engine->setDepthFunctionToLessOrEqual();
   effect->setBool("alphaTest", true);
   engine->setColorWrite(false);
-  engine->draw(true, 0, static_cast<int>(max * 6));
+  for (const auto& drawRange : _drawRanges) {
+    engine->draw(true, static_cast<unsigned int>(drawRange.first * 6),
+                 static_cast<int>(drawRange.second * 6));
+  }
   engine->setColorWrite(true);
   effect->setBool("alphaTest", false);
 
   engine->setAlphaMode(EngineConstants::ALPHA_COMBINE);
-  engine->draw(true, 0, static_cast<int>(max * 6));
+  for (const auto& drawRange : _drawRanges) {
+    engine->draw(true, static_cast<unsigned int>(drawRange.first * 6),
+                 static_cast<int>(drawRange.second * 6));
+  }
   engine->setAlphaMode(EngineConstants::ALPHA_DISABLE);
 }
 
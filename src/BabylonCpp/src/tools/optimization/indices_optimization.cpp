@@ -0,0 +1,35 @@
+#include <babylon/tools/optimization/indices_optimization.h>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/mesh.h>
+
+namespace BABYLON {
+
+IndicesOptimization::IndicesOptimization(int iPriority)
+    : SceneOptimization{iPriority}
+{
+}
+
+IndicesOptimization::~IndicesOptimization()
+{
+}
+
+bool IndicesOptimization::apply(Scene* scene)
+{
+  // Geometries shared by several meshes are only optimized once
+  std::vector<Geometry*> geometries;
+  for (auto& abstractMesh : scene->meshes) {
+    auto mesh = dynamic_cast<Mesh*>(abstractMesh.get());
+    if (!mesh || !mesh->geometry()
+        || stl_util::contains(geometries, mesh->geometry())) {
+      continue;
+    }
+    geometries.emplace_back(mesh->geometry());
+    mesh->optimizeIndices(nullptr, optimizer);
+  }
+
+  return true;
+}
+
+} // end of namespace BABYLON
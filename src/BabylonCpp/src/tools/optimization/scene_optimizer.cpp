@@ -24,9 +24,9 @@ void SceneOptimizer::_CheckCurrentState(Scene* scene,
   bool allDone               = true;
   bool noOptimizationApplied = true;
   for (auto& optimization : options.optimizations) {
-    if (optimization.priority == currentPriorityLevel) {
+    if (optimization->priority == currentPriorityLevel) {
       noOptimizationApplied = false;
-      allDone               = allDone && optimization.apply(scene);
+      allDone               = allDone && optimization->apply(scene);
     }
   }
 
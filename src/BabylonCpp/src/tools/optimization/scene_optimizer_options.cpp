@@ -1,6 +1,7 @@
 #include <babylon/tools/optimization/scene_optimizer_options.h>
 
 #include <babylon/tools/optimization/hardware_scaling_optimization.h>
+#include <babylon/tools/optimization/indices_optimization.h>
 #include <babylon/tools/optimization/lens_flares_optimization.h>
 #include <babylon/tools/optimization/merge_meshes_optimization.h>
 #include <babylon/tools/optimization/particles_optimization.h>
@@ -65,18 +66,26 @@ SceneOptimizerOptions::LowDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<IndicesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<MergeMeshesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<ShadowsOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<PostProcessesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 1024));
+  result.optimizations.emplace_back(
+    std::make_shared<TextureOptimization>(priority, 1024));
 
   return result;
 }
@@ -87,26 +96,36 @@ SceneOptimizerOptions::ModerateDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<IndicesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<MergeMeshesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<ShadowsOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<PostProcessesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 512));
+  result.optimizations.emplace_back(
+    std::make_shared<TextureOptimization>(priority, 512));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(RenderTargetsOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<RenderTargetsOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(HardwareScalingOptimization(priority, 2));
+  result.optimizations.emplace_back(
+    std::make_shared<HardwareScalingOptimization>(priority, 2));
 
   return result;
 }
@@ -117,26 +136,36 @@ SceneOptimizerOptions::HighDegradationAllowed(float targetFrameRate)
   SceneOptimizerOptions result(targetFrameRate);
 
   int priority = 0;
-  result.optimizations.emplace_back(MergeMeshesOptimization(priority));
-  result.optimizations.emplace_back(ShadowsOptimization(priority));
-  result.optimizations.emplace_back(LensFlaresOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<IndicesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<MergeMeshesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<ShadowsOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<LensFlaresOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(PostProcessesOptimization(priority));
-  result.optimizations.emplace_back(ParticlesOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<PostProcessesOptimization>(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<ParticlesOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(TextureOptimization(priority, 256));
+  result.optimizations.emplace_back(
+    std::make_shared<TextureOptimization>(priority, 256));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(RenderTargetsOptimization(priority));
+  result.optimizations.emplace_back(
+    std::make_shared<RenderTargetsOptimization>(priority));
 
   // Next priority
   ++priority;
-  result.optimizations.emplace_back(HardwareScalingOptimization(priority, 4));
+  result.optimizations.emplace_back(
+    std::make_shared<HardwareScalingOptimization>(priority, 4));
 
   return result;
 }
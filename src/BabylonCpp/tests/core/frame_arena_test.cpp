@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/frame_arena.h>
+
+namespace {
+
+// Temporaries of a frame: a growing list, a sorted copy and a map
+size_t renderFrame(BABYLON::FrameArena& arena, size_t meshCount)
+{
+  using namespace BABYLON;
+
+  FrameVector<size_t> meshes{FrameAllocator<size_t>(arena)};
+  for (size_t i = 0; i < meshCount; ++i) {
+    meshes.emplace_back(meshCount - i);
+  }
+
+  FrameVector<size_t> sorted(meshes.begin(), meshes.end(),
+                             FrameAllocator<size_t>(arena));
+  std::sort(sorted.begin(), sorted.end());
+
+  using Groups
+    = std::map<size_t, FrameVector<size_t>, std::less<size_t>,
+               FrameAllocator<std::pair<const size_t, FrameVector<size_t>>>>;
+  Groups groups{std::less<size_t>(), Groups::allocator_type(arena)};
+  for (auto mesh : sorted) {
+    groups[mesh % 7].emplace_back(mesh);
+  }
+
+  return groups.size() + sorted.front();
+}
+
+} // end of anonymous namespace
+
+TEST(TestFrameArena, Blocks_are_aligned)
+{
+  using namespace BABYLON;
+
+  FrameArena arena;
+  arena.allocate(1, 1);
+  for (size_t alignment : {2, 4, 8, 16, 64}) {
+    auto data = arena.allocate(3, alignment);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % alignment, 0u);
+  }
+  EXPECT_EQ(arena.allocationCount(), 6u);
+  EXPECT_EQ(arena.bytesAllocated(), 16u);
+
+  // Blocks larger than a chunk
+  auto data = arena.allocate(FrameArena::ChunkSize * 3, 16);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % 16, 0u);
+  EXPECT_GE(arena.capacity(), FrameArena::ChunkSize * 4);
+
+  arena.reset();
+  EXPECT_EQ(arena.allocationCount(), 0u);
+  EXPECT_EQ(arena.bytesAllocated(), 0u);
+}
+
+TEST(TestFrameArena, No_heap_allocation_in_steady_state)
+{
+  using namespace BABYLON;
+
+  FrameArena arena;
+
+  // Warm up, the first frames grow the arena
+  EXPECT_EQ(renderFrame(arena, 20000), 8u);
+  const auto bytesAllocated = arena.bytesAllocated();
+  arena.reset();
+  EXPECT_GE(arena.capacity(), bytesAllocated);
+
+  const auto heapAllocationCount = arena.heapAllocationCount();
+  for (size_t frame = 0; frame < 10; ++frame) {
+    EXPECT_EQ(renderFrame(arena, 20000 - frame * 1000), 8u);
+    EXPECT_GT(arena.allocationCount(), 0u);
+    arena.reset();
+  }
+  EXPECT_EQ(arena.heapAllocationCount(), heapAllocationCount);
+}
+
+TEST(TestFrameArena, Capacity_is_trimmed_after_a_spike)
+{
+  using namespace BABYLON;
+
+  FrameArena arena;
+  renderFrame(arena, 20000);
+  arena.reset();
+
+  // A single frame allocating much more than the others
+  arena.allocate(FrameArena::ChunkSize * 256, 16);
+  arena.reset();
+  const auto spikeCapacity = arena.capacity();
+  EXPECT_GE(spikeCapacity, FrameArena::ChunkSize * 256);
+
+  // Kept until enough frames stayed well below it
+  for (size_t frame = 1; frame < FrameArena::TrimFrameCount; ++frame) {
+    renderFrame(arena, 20000);
+    arena.reset();
+  }
+  EXPECT_EQ(arena.capacity(), spikeCapacity);
+
+  renderFrame(arena, 20000);
+  const auto bytesAllocated = arena.bytesAllocated();
+  arena.reset();
+  EXPECT_LT(arena.capacity(), spikeCapacity);
+  EXPECT_GE(arena.capacity(), bytesAllocated);
+
+  // The trimmed arena still fits the frames
+  const auto heapAllocationCount = arena.heapAllocationCount();
+  for (size_t frame = 0; frame < 10; ++frame) {
+    renderFrame(arena, 20000);
+    arena.reset();
+  }
+  EXPECT_EQ(arena.heapAllocationCount(), heapAllocationCount);
+}
+
+TEST(TestFrameArena, One_arena_per_thread)
+{
+  using namespace BABYLON;
+
+  auto mainArena              = &FrameArena::Current();
+  FrameArena* threadArena     = nullptr;
+  FrameArena* threadAllocator = nullptr;
+  std::thread thread([&]() {
+    threadArena     = &FrameArena::Current();
+    threadAllocator = FrameAllocator<int>().arena();
+  });
+  thread.join();
+
+  EXPECT_EQ(FrameAllocator<int>().arena(), mainArena);
+  EXPECT_NE(threadArena, mainArena);
+  EXPECT_EQ(threadAllocator, threadArena);
+}
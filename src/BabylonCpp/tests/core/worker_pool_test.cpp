@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/worker_pool.h>
+
+TEST(TestWorkerPool, RunsEachTaskOnce)
+{
+  using namespace BABYLON;
+  WorkerPool pool(3);
+  EXPECT_EQ(pool.workerCount(), 3ul);
+
+  for (unsigned int run = 0; run < 100; ++run) {
+    std::vector<std::atomic<int>> calls(1000);
+    pool.run(calls.size(), 4, [&calls](size_t index) { ++calls[index]; });
+    for (const auto& count : calls) {
+      EXPECT_EQ(count, 1);
+    }
+  }
+}
+
+TEST(TestWorkerPool, SingleThreadRunsOnTheCallingThread)
+{
+  using namespace BABYLON;
+  WorkerPool pool(3);
+
+  const auto caller = std::this_thread::get_id();
+  std::vector<std::thread::id> threads(64);
+  pool.run(threads.size(), 1, [&threads](size_t index) {
+    threads[index] = std::this_thread::get_id();
+  });
+  for (const auto& thread : threads) {
+    EXPECT_EQ(thread, caller);
+  }
+}
+
+TEST(TestWorkerPool, NestedRunsComplete)
+{
+  using namespace BABYLON;
+  WorkerPool pool(2);
+
+  // Each outer task keeps a worker busy while running an inner loop
+  std::atomic<int> total{0};
+  pool.run(8, 3, [&pool, &total](size_t) {
+    pool.run(100, 3, [&total](size_t) { ++total; });
+  });
+  EXPECT_EQ(total, 800);
+}
+
+TEST(TestWorkerPool, RethrowsTheTaskExceptions)
+{
+  using namespace BABYLON;
+  WorkerPool pool(2);
+
+  std::atomic<int> calls{0};
+  EXPECT_THROW(pool.run(16, 3,
+                        [&calls](size_t index) {
+                          ++calls;
+                          if (index == 5) {
+                            throw std::runtime_error("task failed");
+                          }
+                        }),
+               std::runtime_error);
+  // The other tasks still ran
+  EXPECT_EQ(calls, 16);
+}
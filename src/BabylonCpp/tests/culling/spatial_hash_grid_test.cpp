@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include <babylon/culling/spatial_hash_grid.h>
+
+TEST(TestSpatialHashGrid, Query)
+{
+  using namespace BABYLON;
+
+  SpatialHashGrid grid(1.f);
+  EXPECT_TRUE(grid.update(0, Vector3(0.f, 0.f, 0.f), 0.5f));
+  EXPECT_TRUE(grid.update(1, Vector3(3.f, 0.f, 0.f), 0.5f));
+  EXPECT_TRUE(grid.update(2, Vector3(-1.5f, 1.f, 0.f), 2.f));
+  EXPECT_EQ(grid.size(), 3u);
+
+  std::vector<size_t> result;
+  grid.query(Vector3(0.f, 0.f, 0.f), 0.1f, result);
+  EXPECT_EQ(result, std::vector<size_t>({0, 2}));
+  grid.query(Vector3(2.f, 0.f, 0.f), 0.6f, result);
+  EXPECT_EQ(result, std::vector<size_t>({1}));
+  grid.query(Vector3(10.f, 10.f, 10.f), 1.f, result);
+  EXPECT_TRUE(result.empty());
+
+  // Queries larger than the grid resolution
+  grid.query(Vector3(0.f, 0.f, 0.f), 100.f, result);
+  EXPECT_EQ(result, std::vector<size_t>({0, 1, 2}));
+}
+
+TEST(TestSpatialHashGrid, Update)
+{
+  using namespace BABYLON;
+
+  SpatialHashGrid grid(1.f, 8);
+  grid.update(0, Vector3(0.25f, 0.25f, 0.25f), 0.1f);
+
+  // Move inside the same cell
+  EXPECT_FALSE(grid.update(0, Vector3(0.75f, 0.75f, 0.75f), 0.1f));
+  std::vector<size_t> result;
+  grid.query(Vector3(0.75f, 0.75f, 0.75f), 0.f, result);
+  EXPECT_EQ(result, std::vector<size_t>({0}));
+
+  // Move to another cell
+  EXPECT_TRUE(grid.update(0, Vector3(5.5f, 0.5f, 0.5f), 0.1f));
+  grid.query(Vector3(0.75f, 0.75f, 0.75f), 0.2f, result);
+  EXPECT_TRUE(result.empty());
+  grid.query(Vector3(5.5f, 0.5f, 0.5f), 0.2f, result);
+  EXPECT_EQ(result, std::vector<size_t>({0}));
+  EXPECT_EQ(grid.cellCount(), 1u);
+
+  // Spheres larger than the cell limit are tested by every query
+  const float infinity = std::numeric_limits<float>::max();
+  EXPECT_TRUE(grid.update(1, Vector3(0.f, 0.f, 0.f), infinity));
+  EXPECT_EQ(grid.cellCount(), 1u);
+  grid.query(Vector3(-50.f, 20.f, 3.f), 0.5f, result);
+  EXPECT_EQ(result, std::vector<size_t>({1}));
+
+  grid.remove(0);
+  grid.remove(1);
+  EXPECT_EQ(grid.size(), 0u);
+  EXPECT_EQ(grid.cellCount(), 0u);
+  grid.query(Vector3(5.5f, 0.5f, 0.5f), 0.2f, result);
+  EXPECT_TRUE(result.empty());
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/math/matrix.h>
+#include <babylon/mesh/mesh.h>
+
+#include "../helpers/null_canvas.h"
+
+namespace {
+
+// A hierarchy of three meshes and a chain of bones, updated as a whole by one
+// thread
+struct Rig {
+  std::vector<BABYLON::Mesh*> meshes;
+  BABYLON::Skeleton* skeleton;
+}; // end of struct Rig
+
+Rig createRig(const std::string& name, BABYLON::Scene* scene)
+{
+  using namespace BABYLON;
+
+  Rig rig;
+  for (unsigned int i = 0; i < 3; ++i) {
+    auto mesh = Mesh::CreateBox(name + std::to_string(i), 1.f, scene);
+    if (!rig.meshes.empty()) {
+      mesh->setParent(rig.meshes.back());
+    }
+    rig.meshes.emplace_back(mesh);
+  }
+
+  rig.skeleton = new Skeleton(name, name, scene);
+  Bone* parent = nullptr;
+  for (unsigned int i = 0; i < 8; ++i) {
+    parent = Bone::New(name + "_bone" + std::to_string(i), rig.skeleton,
+                       parent, Matrix::Translation(0.f, 1.f, 0.f));
+  }
+  rig.meshes.front()->setSkeleton(rig.skeleton);
+
+  return rig;
+}
+
+// Moves the meshes and the bones of the rig, then returns the world matrices
+// of the meshes followed by the bone matrices of the skeleton
+BABYLON::Float32Array updateRig(Rig& rig, size_t rigIndex, size_t frame)
+{
+  using namespace BABYLON;
+
+  const auto t = static_cast<float>(rigIndex * 100 + frame) * 0.05f;
+  for (auto mesh : rig.meshes) {
+    mesh->setPosition(Vector3(t, 0.5f * t, -t));
+    mesh->setRotation(Vector3(0.1f * t, 0.2f * t, 0.3f * t));
+    mesh->setScaling(Vector3(1.f + 0.01f * t, 1.f, 1.f - 0.01f * t));
+  }
+  for (auto& bone : rig.skeleton->bones) {
+    bone->setYawPitchRoll(0.1f * t, 0.2f * t, -0.1f * t);
+  }
+
+  Float32Array result;
+  for (auto mesh : rig.meshes) {
+    const auto worldMatrix = mesh->computeWorldMatrix(true).asArray();
+    result.insert(result.end(), worldMatrix.begin(), worldMatrix.end());
+  }
+  rig.skeleton->prepare();
+  const auto& boneMatrices
+    = rig.skeleton->getTransformMatrices(rig.meshes.front());
+  result.insert(result.end(), boneMatrices.begin(), boneMatrices.end());
+
+  return result;
+}
+
+} // end of anonymous namespace
+
+// Run with -fsanitize=thread to detect the data races
+TEST(TestConcurrentSceneUpdate, Disjoint_meshes_and_skeletons)
+{
+  using namespace BABYLON;
+
+  const size_t threadCount  = 8;
+  const size_t rigsByThread = 4;
+  const size_t rigCount     = threadCount * rigsByThread;
+  const size_t frameCount   = 20;
+
+  NullCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+
+  // Reference computed on a single thread, on rigs of their own
+  std::vector<std::vector<Float32Array>> expected(rigCount);
+  for (size_t r = 0; r < rigCount; ++r) {
+    auto rig = createRig("reference" + std::to_string(r), scene.get());
+    for (size_t frame = 0; frame < frameCount; ++frame) {
+      expected[r].emplace_back(updateRig(rig, r, frame));
+    }
+  }
+
+  std::vector<Rig> rigs;
+  for (size_t r = 0; r < rigCount; ++r) {
+    rigs.emplace_back(createRig("rig" + std::to_string(r), scene.get()));
+  }
+
+  // Each thread updates its own rigs
+  std::vector<size_t> mismatches(threadCount, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t frame = 0; frame < frameCount; ++frame) {
+        for (size_t r = t * rigsByThread; r < (t + 1) * rigsByThread; ++r) {
+          if (updateRig(rigs[r], r, frame) != expected[r][frame]) {
+            ++mismatches[t];
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t t = 0; t < threadCount; ++t) {
+    EXPECT_EQ(mismatches[t], 0u) << "thread " << t;
+  }
+
+  engine->dispose();
+  scene.reset(nullptr);
+  engine.reset(nullptr);
+}
@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+
+#include "../helpers/recording_gl_rendering_context.h"
+
+TEST(TestDynamicVertexBuffer, UpdateOffsets)
+{
+  using namespace BABYLON;
+
+  auto renderingContext = std::make_unique<GL::RecordingGLRenderingContext>();
+  auto gl               = renderingContext.get();
+  NullCanvas canvas(std::move(renderingContext));
+  auto engine = Engine::New(&canvas);
+
+  auto buffer = engine->createDynamicVertexBuffer(Float32Array(8, 0.f));
+  const auto& contents = gl->bufferContents.at(buffer.get());
+
+  // Whole array written at an offset in bytes
+  engine->updateDynamicVertexBuffer(buffer, {1.f, 2.f}, 8);
+  ASSERT_EQ(gl->uploads.size(), 1ul);
+  EXPECT_EQ(gl->uploads[0].byteOffset, 8);
+  EXPECT_EQ(gl->uploads[0].floatCount, 2ul);
+  EXPECT_EQ(contents, Float32Array({0.f, 0.f, 1.f, 2.f, 0.f, 0.f, 0.f, 0.f}));
+
+  // Sub-range written at the same position, offset and count in floats
+  engine->updateDynamicVertexBuffer(
+    buffer, {3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f, 10.f}, 5, 2);
+  ASSERT_EQ(gl->uploads.size(), 2ul);
+  EXPECT_EQ(gl->uploads[1].byteOffset, 20);
+  EXPECT_EQ(gl->uploads[1].floatCount, 2ul);
+  EXPECT_EQ(contents, Float32Array({0.f, 0.f, 1.f, 2.f, 0.f, 8.f, 9.f, 0.f}));
+
+  engine->dispose();
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/effect_creation_options.h>
+#include <babylon/materials/material_defines.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+#include "../helpers/null_canvas.h"
+
+namespace {
+
+BABYLON::Effect* CreateEffect(BABYLON::Engine* engine,
+                              const BABYLON::MaterialDefines& defines)
+{
+  using namespace BABYLON;
+
+  EffectCreationOptions options;
+  options.attributes    = {VertexBuffer::PositionKindChars};
+  options.uniformsNames = {"world", "viewProjection", "color"};
+  options.defines       = defines.toString();
+  return engine->createEffect("color", options, engine);
+}
+
+} // end of namespace
+
+TEST(TestEffectCache, DefinesHashLookupComparesTheFullKey)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = Engine::New(&canvas);
+
+  MaterialDefines first;
+  first._keys = {"FIRST", "SECOND"};
+  first.defines.resize(2);
+  first.defines[0] = true;
+  MaterialDefines second(first);
+  second.defines[0] = false;
+  second.defines[1] = true;
+  ASSERT_NE(first.toString(), second.toString());
+
+  auto firstEffect  = CreateEffect(engine.get(), first);
+  auto secondEffect = CreateEffect(engine.get(), second);
+  ASSERT_NE(firstEffect, secondEffect);
+
+  // Colliding hashes
+  const uint64_t definesHash = 42;
+  engine->registerEffectDefinesHash(definesHash, "color", first, 4,
+                                    firstEffect);
+  engine->registerEffectDefinesHash(definesHash, "color", second, 4,
+                                    secondEffect);
+  EXPECT_EQ(engine->getEffectByDefinesHash(definesHash, "color", first, 4),
+            firstEffect);
+  EXPECT_EQ(engine->getEffectByDefinesHash(definesHash, "color", second, 4),
+            secondEffect);
+
+  // Every part of the key is compared
+  EXPECT_EQ(engine->getEffectByDefinesHash(definesHash, "default", first, 4),
+            nullptr);
+  EXPECT_EQ(engine->getEffectByDefinesHash(definesHash, "color", first, 2),
+            nullptr);
+  EXPECT_EQ(engine->getEffectByDefinesHash(definesHash + 1, "color", first, 4),
+            nullptr);
+
+  // A released effect is no longer found, the other ones are kept
+  engine->_releaseEffect(firstEffect);
+  EXPECT_EQ(engine->getEffectByDefinesHash(definesHash, "color", first, 4),
+            nullptr);
+  EXPECT_EQ(engine->getEffectByDefinesHash(definesHash, "color", second, 4),
+            secondEffect);
+
+  engine->dispose();
+}
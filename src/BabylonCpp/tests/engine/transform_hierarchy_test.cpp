@@ -0,0 +1,281 @@
+#include <gtest/gtest.h>
+
+#include <babylon/animations/animation.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/engine/transform_hierarchy.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/physics/iphysics_engine_plugin.h>
+#include <babylon/physics/physics_engine.h>
+#include <babylon/physics/physics_impostor.h>
+
+#include "../helpers/null_canvas.h"
+
+namespace {
+
+/**
+ * @brief Physics plugin moving every impostor down by a fixed amount per step.
+ */
+struct FallingPhysicsPlugin : public BABYLON::IPhysicsEnginePlugin {
+
+  FallingPhysicsPlugin()
+  {
+    world = nullptr;
+    name  = "FallingPhysicsPlugin";
+  }
+
+  void setGravity(const BABYLON::Vector3& /*gravity*/) override
+  {
+  }
+
+  void setTimeStep(float /*timeStep*/) override
+  {
+  }
+
+  void executeStep(
+    float /*delta*/,
+    const std::vector<std::unique_ptr<BABYLON::PhysicsImpostor>>& impostors)
+    override
+  {
+    for (auto& impostor : impostors) {
+      impostor->beforeStep();
+    }
+    for (auto& impostor : impostors) {
+      impostor->afterStep();
+    }
+  }
+
+  void applyImpulse(BABYLON::PhysicsImpostor* /*impostor*/,
+                    const BABYLON::Vector3& /*force*/,
+                    const BABYLON::Vector3& /*contactPoint*/) override
+  {
+  }
+
+  void applyForce(BABYLON::PhysicsImpostor* /*impostor*/,
+                  const BABYLON::Vector3& /*force*/,
+                  const BABYLON::Vector3& /*contactPoint*/) override
+  {
+  }
+
+  void generatePhysicsBody(BABYLON::PhysicsImpostor* /*impostor*/) override
+  {
+  }
+
+  void removePhysicsBody(BABYLON::PhysicsImpostor* /*impostor*/) override
+  {
+  }
+
+  void generateJoint(BABYLON::PhysicsImpostorJoint* /*joint*/) override
+  {
+  }
+
+  void removeJoint(BABYLON::PhysicsImpostorJoint* /*joint*/) override
+  {
+  }
+
+  bool isSupported() override
+  {
+    return true;
+  }
+
+  void setTransformationFromPhysicsBody(
+    BABYLON::PhysicsImpostor* impostor) override
+  {
+    // Written through the reference accessor, as the physics plugins do
+    impostor->object->position().y -= 1.f;
+  }
+
+  void setPhysicsBodyTransformation(
+    BABYLON::PhysicsImpostor* /*impostor*/,
+    const BABYLON::Vector3& /*newPosition*/,
+    const BABYLON::Quaternion& /*newRotation*/) override
+  {
+  }
+
+  void setLinearVelocity(BABYLON::PhysicsImpostor* /*impostor*/,
+                         const BABYLON::Vector3& /*velocity*/) override
+  {
+  }
+
+  void setAngularVelocity(BABYLON::PhysicsImpostor* /*impostor*/,
+                          const BABYLON::Vector3& /*velocity*/) override
+  {
+  }
+
+  BABYLON::Vector3
+  getLinearVelocity(BABYLON::PhysicsImpostor* /*impostor*/) override
+  {
+    return BABYLON::Vector3::Zero();
+  }
+
+  BABYLON::Vector3
+  getAngularVelocity(BABYLON::PhysicsImpostor* /*impostor*/) override
+  {
+    return BABYLON::Vector3::Zero();
+  }
+
+  void setBodyMass(BABYLON::PhysicsImpostor* /*impostor*/,
+                   float /*mass*/) override
+  {
+  }
+
+  void sleepBody(BABYLON::PhysicsImpostor* /*impostor*/) override
+  {
+  }
+
+  void wakeUpBody(BABYLON::PhysicsImpostor* /*impostor*/) override
+  {
+  }
+
+  void updateDistanceJoint(BABYLON::DistanceJoint* /*joint*/,
+                           float /*maxDistance*/,
+                           float /*minDistance*/) override
+  {
+  }
+
+  void setMotor(BABYLON::IMotorEnabledJoint* /*joint*/, float /*speed*/,
+                float /*maxForce*/, unsigned int /*motorIndex*/) override
+  {
+  }
+
+  void setLimit(BABYLON::IMotorEnabledJoint* /*joint*/, float /*upperLimit*/,
+                float /*lowerLimit*/, unsigned int /*motorIndex*/) override
+  {
+  }
+
+  void dispose() override
+  {
+  }
+
+}; // end of struct FallingPhysicsPlugin
+
+class TestTransformHierarchy : public ::testing::Test {
+
+protected:
+  void SetUp() override
+  {
+    using namespace BABYLON;
+    _canvas = std::make_unique<NullCanvas>();
+    _engine = Engine::New(_canvas.get());
+    _scene  = Scene::New(_engine.get());
+    _scene->enableTransformHierarchy();
+  }
+
+  void TearDown() override
+  {
+    _engine->dispose();
+    _scene.reset(nullptr);
+    _engine.reset(nullptr);
+    _canvas.reset(nullptr);
+  }
+
+  std::unique_ptr<BABYLON::NullCanvas> _canvas;
+  std::unique_ptr<BABYLON::Engine> _engine;
+  std::unique_ptr<BABYLON::Scene> _scene;
+
+}; // end of class TestTransformHierarchy
+
+} // end of namespace
+
+TEST_F(TestTransformHierarchy, ReferenceAccessorWrite)
+{
+  using namespace BABYLON;
+
+  auto parent = Mesh::CreateBox("parent", 1.f, _scene.get());
+  auto child  = Mesh::CreateBox("child", 1.f, _scene.get());
+  child->setParent(parent);
+  _scene->transformHierarchy()->update();
+
+  // Not flagged by any setter
+  parent->position().x = 3.f;
+  child->position().y  = 2.f;
+  EXPECT_EQ(_scene->transformHierarchy()->update(), 2ul);
+
+  const auto& world = child->getWorldMatrix()->m;
+  EXPECT_FLOAT_EQ(world[12], 3.f);
+  EXPECT_FLOAT_EQ(world[13], 2.f);
+
+  // Nothing changed since the last update
+  EXPECT_EQ(_scene->transformHierarchy()->update(), 0ul);
+}
+
+TEST_F(TestTransformHierarchy, ComputeWorldMatrixUpdatesTheDirtySubtree)
+{
+  using namespace BABYLON;
+
+  auto first      = Mesh::CreateBox("first", 1.f, _scene.get());
+  auto firstChild = Mesh::CreateBox("firstChild", 1.f, _scene.get());
+  auto second     = Mesh::CreateBox("second", 1.f, _scene.get());
+  auto third      = Mesh::CreateBox("third", 1.f, _scene.get());
+  firstChild->setParent(first);
+  _scene->transformHierarchy()->update();
+
+  first->position().x  = 1.f;
+  second->position().x = 2.f;
+  third->setPosition(Vector3(3.f, 0.f, 0.f));
+
+  // Only the subtree of the computed mesh is updated
+  EXPECT_FLOAT_EQ(second->computeWorldMatrix().m[12], 2.f);
+  EXPECT_TRUE(_scene->transformHierarchy()->hasPendingChanges());
+  EXPECT_EQ(_scene->transformHierarchy()->updateNode(
+              firstChild->_transformHierarchyIndex),
+            2ul);
+  EXPECT_FLOAT_EQ(firstChild->getWorldMatrix()->m[12], 1.f);
+
+  // The remaining dirty node is left for the next update
+  EXPECT_EQ(_scene->transformHierarchy()->update(), 1ul);
+  EXPECT_FLOAT_EQ(third->getWorldMatrix()->m[12], 3.f);
+  EXPECT_EQ(_scene->transformHierarchy()->update(), 0ul);
+}
+
+TEST_F(TestTransformHierarchy, AnimatedMesh)
+{
+  using namespace BABYLON;
+
+  auto box = Mesh::CreateBox("box", 1.f, _scene.get());
+  _scene->transformHierarchy()->update();
+
+  Animation animation("animation", "position.x", 30,
+                      Animation::ANIMATIONTYPE_FLOAT,
+                      Animation::ANIMATIONLOOPMODE_CONSTANT);
+  animation.setKeys({AnimationKey(0, AnimationValue(0.f)),
+                     AnimationKey(10, AnimationValue(5.f))});
+  animation._target = box;
+
+  animation.goToFrame(10);
+  EXPECT_TRUE(_scene->transformHierarchy()->hasPendingChanges());
+  _scene->transformHierarchy()->update();
+  EXPECT_FLOAT_EQ(box->getWorldMatrix()->m[12], 5.f);
+  EXPECT_FLOAT_EQ(box->getAbsolutePosition()->x, 5.f);
+
+  animation.goToFrame(0);
+  EXPECT_FLOAT_EQ(box->computeWorldMatrix().m[12], 0.f);
+}
+
+TEST_F(TestTransformHierarchy, PhysicsDrivenMesh)
+{
+  using namespace BABYLON;
+
+  FallingPhysicsPlugin plugin;
+  ASSERT_TRUE(_scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin));
+
+  auto sphere = Mesh::CreateSphere("sphere", 8, 1.f, _scene.get());
+  sphere->setPosition(Vector3(0.f, 10.f, 0.f));
+  PhysicsImpostorParameters parameters;
+  parameters.mass = 1.f;
+  // Owned by the physics engine
+  new PhysicsImpostor(sphere, PhysicsImpostor::SphereImpostor, parameters,
+                      _scene.get());
+  _scene->transformHierarchy()->update();
+  EXPECT_FLOAT_EQ(sphere->getWorldMatrix()->m[13], 10.f);
+
+  _scene->getPhysicsEngine()->_step(1.f / 60.f);
+  _scene->transformHierarchy()->update();
+  EXPECT_FLOAT_EQ(sphere->getWorldMatrix()->m[13], 9.f);
+
+  _scene->getPhysicsEngine()->_step(1.f / 60.f);
+  _scene->transformHierarchy()->update();
+  EXPECT_FLOAT_EQ(sphere->getWorldMatrix()->m[13], 8.f);
+
+  _scene->disablePhysicsEngine();
+}
@@ -0,0 +1,785 @@
+#ifndef BABYLON_TESTS_HELPERS_NULL_CANVAS_H
+#define BABYLON_TESTS_HELPERS_NULL_CANVAS_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/interfaces/icanvas.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+
+namespace BABYLON {
+namespace GL {
+
+/**
+ * @brief GL rendering context without any backend, used by the unit tests to
+ * create an Engine and a Scene without a window.
+ */
+class NullGLRenderingContext : public IGLRenderingContext {
+
+public:
+  NullGLRenderingContext() : _handle{0}
+  {
+    _precisionFormat.rangeMin  = 127;
+    _precisionFormat.rangeMax  = 127;
+    _precisionFormat.precision = 23;
+  }
+
+  ~NullGLRenderingContext()
+  {
+  }
+
+  bool initialize() override
+  {
+    return true;
+  }
+
+  void backupGLState() override
+  {
+  }
+
+  void restoreGLState() override
+  {
+  }
+
+  GLenum operator[](const std::string&) override
+  {
+    return {};
+  }
+
+  void activeTexture(GLenum) override
+  {
+  }
+
+  void attachShader(const std::unique_ptr<IGLProgram>&,
+                    const std::unique_ptr<IGLShader>&) override
+  {
+  }
+
+  void bindAttribLocation(IGLProgram*, GLuint, const std::string&) override
+  {
+  }
+
+  void bindBuffer(GLenum, IGLBuffer*) override
+  {
+  }
+
+  void bindFramebuffer(GLenum, IGLFramebuffer*) override
+  {
+  }
+
+  void bindBufferBase(GLenum, GLuint, IGLBuffer*) override
+  {
+  }
+
+  void bindRenderbuffer(GLenum,
+                        const std::unique_ptr<IGLRenderbuffer>&) override
+  {
+  }
+
+  void bindTexture(GLenum, IGLTexture*) override
+  {
+  }
+
+  void blendColor(GLclampf, GLclampf, GLclampf, GLclampf) override
+  {
+  }
+
+  void blendEquation(GLenum) override
+  {
+  }
+
+  void blendEquationSeparate(GLenum, GLenum) override
+  {
+  }
+
+  void blendFunc(GLenum, GLenum) override
+  {
+  }
+
+  void blendFuncSeparate(GLenum, GLenum, GLenum, GLenum) override
+  {
+  }
+
+  void blitFramebuffer(GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint,
+                       GLbitfield, GLenum) override
+  {
+  }
+
+  void bufferData(GLenum, GLsizeiptr, GLenum) override
+  {
+  }
+
+  void bufferData(GLenum, const Float32Array&, GLenum) override
+  {
+  }
+
+  void bufferData(GLenum, const Int32Array&, GLenum) override
+  {
+  }
+
+  void bufferData(GLenum, const Uint16Array&, GLenum) override
+  {
+  }
+
+  void bufferData(GLenum, const Uint32Array&, GLenum) override
+  {
+  }
+
+  void bufferSubData(GLenum, GLintptr, const Float32Array&) override
+  {
+  }
+
+  void bufferSubData(GLenum, GLintptr, const Float32Array&, GLuint,
+                     GLuint) override
+  {
+  }
+
+  void bufferSubData(GLenum, GLintptr, Int32Array&) override
+  {
+  }
+
+  void bindVertexArray(GL::IGLVertexArrayObject*) override
+  {
+  }
+
+  GLenum checkFramebufferStatus(GLenum) override
+  {
+    return {};
+  }
+
+  void clear(GLbitfield) override
+  {
+  }
+
+  void clearColor(GLclampf, GLclampf, GLclampf, GLclampf) override
+  {
+  }
+
+  void clearDepth(GLclampf) override
+  {
+  }
+
+  void clearStencil(GLint) override
+  {
+  }
+
+  void colorMask(GLboolean, GLboolean, GLboolean, GLboolean) override
+  {
+  }
+
+  void compileShader(const std::unique_ptr<IGLShader>&) override
+  {
+  }
+
+  void compressedTexImage2D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLint,
+                            const Uint8Array&) override
+  {
+  }
+
+  void compressedTexSubImage2D(GLenum, GLint, GLint, GLint, GLsizei, GLsizei,
+                               GLenum, GLsizeiptr) override
+  {
+  }
+
+  void copyTexImage2D(GLenum, GLint, GLenum, GLint, GLint, GLsizei, GLsizei,
+                      GLint) override
+  {
+  }
+
+  void copyTexSubImage2D(GLenum, GLint, GLint, GLint, GLint, GLint, GLint,
+                         GLint) override
+  {
+  }
+
+  std::unique_ptr<IGLBuffer> createBuffer() override
+  {
+    return std::make_unique<IGLBuffer>(++_handle);
+  }
+
+  std::unique_ptr<IGLFramebuffer> createFramebuffer() override
+  {
+    return std::make_unique<IGLFramebuffer>(++_handle);
+  }
+
+  std::unique_ptr<IGLProgram> createProgram() override
+  {
+    return std::make_unique<IGLProgram>(++_handle);
+  }
+
+  std::unique_ptr<IGLRenderbuffer> createRenderbuffer() override
+  {
+    return std::make_unique<IGLRenderbuffer>(++_handle);
+  }
+
+  std::unique_ptr<IGLShader> createShader(GLenum) override
+  {
+    return std::make_unique<IGLShader>(++_handle);
+  }
+
+  std::unique_ptr<IGLTexture> createTexture() override
+  {
+    return std::make_unique<IGLTexture>(++_handle);
+  }
+
+  std::unique_ptr<IGLVertexArrayObject> createVertexArray() override
+  {
+    return std::make_unique<IGLVertexArrayObject>(++_handle);
+  }
+
+  void cullFace(GLenum) override
+  {
+  }
+
+  void deleteBuffer(IGLBuffer*) override
+  {
+  }
+
+  void deleteFramebuffer(const std::unique_ptr<IGLFramebuffer>&) override
+  {
+  }
+
+  void deleteProgram(IGLProgram*) override
+  {
+  }
+
+  void deleteRenderbuffer(const std::unique_ptr<IGLRenderbuffer>&) override
+  {
+  }
+
+  void deleteShader(const std::unique_ptr<IGLShader>&) override
+  {
+  }
+
+  void deleteTexture(IGLTexture*) override
+  {
+  }
+
+  void deleteVertexArray(IGLVertexArrayObject*) override
+  {
+  }
+
+  void depthFunc(GLenum) override
+  {
+  }
+
+  void depthMask(GLboolean) override
+  {
+  }
+
+  void depthRange(GLclampf, GLclampf) override
+  {
+  }
+
+  void detachShader(IGLProgram*, IGLShader*) override
+  {
+  }
+
+  void disable(GLenum) override
+  {
+  }
+
+  void disableVertexAttribArray(GLuint) override
+  {
+  }
+
+  void drawArrays(GLenum, GLint, GLint) override
+  {
+  }
+
+  void drawArraysInstanced(GLenum, GLint, GLsizei, GLsizei) override
+  {
+  }
+
+  void drawBuffers(const std::vector<GLenum>&) override
+  {
+  }
+
+  void drawElements(GLenum, GLsizei, GLenum, GLintptr) override
+  {
+  }
+
+  void drawElementsInstanced(GLenum, GLsizei, GLenum, GLintptr,
+                             GLsizei) override
+  {
+  }
+
+  void enable(GLenum) override
+  {
+  }
+
+  void enableVertexAttribArray(GLuint) override
+  {
+  }
+
+  void finish() override
+  {
+  }
+
+  void flush() override
+  {
+  }
+
+  void framebufferRenderbuffer(GLenum, GLenum, GLenum,
+                               const std::unique_ptr<IGLRenderbuffer>&) override
+  {
+  }
+
+  void framebufferTexture2D(GLenum, GLenum, GLenum, IGLTexture*, GLint) override
+  {
+  }
+
+  void frontFace(GLenum) override
+  {
+  }
+
+  void generateMipmap(GLenum) override
+  {
+  }
+
+  std::vector<IGLShader*> getAttachedShaders(IGLProgram*) override
+  {
+    return {};
+  }
+
+  GLint getAttribLocation(IGLProgram*, const std::string&) override
+  {
+    return {};
+  }
+
+  GLboolean hasExtension(const std::string&) override
+  {
+    return {};
+  }
+
+  std::array<int, 3> getScissorBoxParameter() override
+  {
+    return {};
+  }
+
+  GLint getParameteri(GLenum) override
+  {
+    // Texture units, sizes and vertex attributes
+    return 16;
+  }
+
+  GLfloat getParameterf(GLenum) override
+  {
+    return {};
+  }
+
+  std::string getString(GLenum) override
+  {
+    return {};
+  }
+
+  GLint getTexParameteri(GLenum) override
+  {
+    return {};
+  }
+
+  GLfloat getTexParameterf(GLenum) override
+  {
+    return {};
+  }
+
+  GLenum getError() override
+  {
+    return {};
+  }
+
+  const char* getErrorString(GLenum) override
+  {
+    return nullptr;
+  }
+
+  GLint getProgramParameter(IGLProgram*, GLenum) override
+  {
+    return 1;
+  }
+
+  std::string getProgramInfoLog(const std::unique_ptr<IGLProgram>&) override
+  {
+    return {};
+  }
+
+  any getRenderbufferParameter(GLenum, GLenum) override
+  {
+    return {};
+  }
+
+  std::string getShaderInfoLog(const std::unique_ptr<IGLShader>&) override
+  {
+    return {};
+  }
+
+  GLint getShaderParameter(const std::unique_ptr<IGLShader>&, GLenum) override
+  {
+    return 1;
+  }
+
+  IGLShaderPrecisionFormat* getShaderPrecisionFormat(GLenum, GLenum) override
+  {
+    return &_precisionFormat;
+  }
+
+  std::string getShaderSource(IGLShader*) override
+  {
+    return {};
+  }
+
+  GLuint getUniformBlockIndex(IGLProgram*, const std::string&) override
+  {
+    return {};
+  }
+
+  std::unique_ptr<IGLUniformLocation>
+  getUniformLocation(IGLProgram*, const std::string&) override
+  {
+    return std::make_unique<IGLUniformLocation>(++_handle);
+  }
+
+  void hint(GLenum, GLenum) override
+  {
+  }
+
+  GLboolean isBuffer(IGLBuffer*) override
+  {
+    return {};
+  }
+
+  GLboolean isEnabled(GLenum) override
+  {
+    return {};
+  }
+
+  GLboolean isFramebuffer(IGLFramebuffer*) override
+  {
+    return {};
+  }
+
+  GLboolean isProgram(const std::unique_ptr<IGLProgram>&) override
+  {
+    return {};
+  }
+
+  GLboolean isRenderbuffer(IGLRenderbuffer*) override
+  {
+    return {};
+  }
+
+  GLboolean isShader(IGLShader*) override
+  {
+    return {};
+  }
+
+  GLboolean isTexture(IGLTexture*) override
+  {
+    return {};
+  }
+
+  void lineWidth(GLfloat) override
+  {
+  }
+
+  bool linkProgram(const std::unique_ptr<IGLProgram>&) override
+  {
+    return true;
+  }
+
+  void pixelStorei(GLenum, GLint) override
+  {
+  }
+
+  void polygonOffset(GLfloat, GLfloat) override
+  {
+  }
+
+  void readPixels(GLint, GLint, GLsizei, GLsizei, GLenum, GLenum,
+                  Uint8Array&) override
+  {
+  }
+
+  void renderbufferStorage(GLenum, GLenum, GLsizei, GLsizei) override
+  {
+  }
+
+  void renderbufferStorageMultisample(GLenum, GLsizei, GLenum, GLsizei,
+                                      GLsizei) override
+  {
+  }
+
+  void sampleCoverage(GLclampf, GLboolean) override
+  {
+  }
+
+  void scissor(GLint, GLint, GLsizei, GLsizei) override
+  {
+  }
+
+  void shaderSource(const std::unique_ptr<IGLShader>&,
+                    const std::string&) override
+  {
+  }
+
+  void stencilFunc(GLenum, GLint, GLuint) override
+  {
+  }
+
+  void stencilFuncSeparate(GLenum, GLenum, GLint, GLuint) override
+  {
+  }
+
+  void stencilMask(GLuint) override
+  {
+  }
+
+  void stencilMaskSeparate(GLenum, GLuint) override
+  {
+  }
+
+  void stencilOp(GLenum, GLenum, GLenum) override
+  {
+  }
+
+  void stencilOpSeparate(GLenum, GLenum, GLenum, GLenum) override
+  {
+  }
+
+  void texImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum,
+                  const Uint8Array&) override
+  {
+  }
+
+  void texImage2D(GLenum, GLint, GLenum, GLenum, GLenum, ICanvas*) override
+  {
+  }
+
+  void texImage2D(GLenum, GLint, GLenum, GLsizei, GLsizei, GLsizei, GLenum,
+                  GLenum, ICanvas*) override
+  {
+  }
+
+  void texParameterf(GLenum, GLenum, GLfloat) override
+  {
+  }
+
+  void texParameteri(GLenum, GLenum, GLint) override
+  {
+  }
+
+  void texSubImage2D(GLenum, GLint, GLint, GLint, GLsizei, GLsizei, GLenum,
+                     GLenum, any) override
+  {
+  }
+
+  void uniform1f(IGLUniformLocation*, GLfloat) override
+  {
+  }
+
+  void uniform1fv(GL::IGLUniformLocation*, const Float32Array&) override
+  {
+  }
+
+  void uniform1i(IGLUniformLocation*, GLint) override
+  {
+  }
+
+  void uniform1iv(IGLUniformLocation*, const Int32Array&) override
+  {
+  }
+
+  void uniform2f(IGLUniformLocation*, GLfloat, GLfloat) override
+  {
+  }
+
+  void uniform2fv(IGLUniformLocation*, const Float32Array&) override
+  {
+  }
+
+  void uniform2i(IGLUniformLocation*, GLint, GLint) override
+  {
+  }
+
+  void uniform2iv(IGLUniformLocation*, const Int32Array&) override
+  {
+  }
+
+  void uniform3f(IGLUniformLocation*, GLfloat, GLfloat, GLfloat) override
+  {
+  }
+
+  void uniform3fv(IGLUniformLocation*, const Float32Array&) override
+  {
+  }
+
+  void uniform3i(IGLUniformLocation*, GLint, GLint, GLint) override
+  {
+  }
+
+  void uniform3iv(IGLUniformLocation*, const Int32Array&) override
+  {
+  }
+
+  void uniform4f(IGLUniformLocation*, GLfloat, GLfloat, GLfloat,
+                 GLfloat) override
+  {
+  }
+
+  void uniform4fv(IGLUniformLocation*, const Float32Array&) override
+  {
+  }
+
+  void uniform4i(IGLUniformLocation*, GLint, GLint, GLint, GLint) override
+  {
+  }
+
+  void uniform4iv(IGLUniformLocation*, const Int32Array&) override
+  {
+  }
+
+  void uniformBlockBinding(IGLProgram*, GLuint, GLuint) override
+  {
+  }
+
+  void uniformMatrix2fv(IGLUniformLocation*, GLboolean,
+                        const Float32Array&) override
+  {
+  }
+
+  void uniformMatrix3fv(IGLUniformLocation*, GLboolean,
+                        const Float32Array&) override
+  {
+  }
+
+  void uniformMatrix4fv(IGLUniformLocation*, GLboolean,
+                        const Float32Array&) override
+  {
+  }
+
+  void uniformMatrix4fv(IGLUniformLocation*, GLboolean,
+                        const std::array<float, 16>&) override
+  {
+  }
+
+  void useProgram(IGLProgram*) override
+  {
+  }
+
+  void validateProgram(IGLProgram*) override
+  {
+  }
+
+  void vertexAttrib1f(GLuint, GLfloat) override
+  {
+  }
+
+  void vertexAttrib1fv(GLuint, Float32Array&) override
+  {
+  }
+
+  void vertexAttrib2f(GLuint, GLfloat, GLfloat) override
+  {
+  }
+
+  void vertexAttrib2fv(GLuint, Float32Array&) override
+  {
+  }
+
+  void vertexAttrib3f(GLuint, GLfloat, GLfloat, GLfloat) override
+  {
+  }
+
+  void vertexAttrib3fv(GLuint, Float32Array&) override
+  {
+  }
+
+  void vertexAttrib4f(GLuint, GLfloat, GLfloat, GLfloat, GLfloat) override
+  {
+  }
+
+  void vertexAttrib4fv(GLuint, Float32Array&) override
+  {
+  }
+
+  void vertexAttribDivisor(GLuint, GLuint) override
+  {
+  }
+
+  void vertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLint,
+                           GLintptr) override
+  {
+  }
+
+  void viewport(GLint, GLint, GLsizei, GLsizei) override
+  {
+  }
+
+private:
+  GLuint _handle;
+  IGLShaderPrecisionFormat _precisionFormat;
+
+}; // end of class NullGLRenderingContext
+
+} // end of namespace GL
+
+/**
+ * @brief Canvas without any window, returning a NullGLRenderingContext.
+ */
+class NullCanvas : public ICanvas {
+
+public:
+  NullCanvas()
+  {
+    width                      = 640;
+    height                     = 480;
+    clientWidth                = width;
+    clientHeight               = height;
+    _boundingClientRect.bottom = height;
+    _boundingClientRect.height = height;
+    _boundingClientRect.left   = 0;
+    _boundingClientRect.right  = width;
+    _boundingClientRect.top    = 0;
+    _boundingClientRect.width  = width;
+    _renderingContext          = std::make_unique<GL::NullGLRenderingContext>();
+  }
+
+  explicit NullCanvas(
+    std::unique_ptr<GL::NullGLRenderingContext>&& renderingContext)
+      : NullCanvas()
+  {
+    _renderingContext = std::move(renderingContext);
+  }
+
+  ~NullCanvas()
+  {
+  }
+
+  ClientRect& getBoundingClientRect() override
+  {
+    return _boundingClientRect;
+  }
+
+  bool onlyRenderBoundingClientRect() const override
+  {
+    return false;
+  }
+
+  bool initializeContext3d() override
+  {
+    return true;
+  }
+
+  ICanvasRenderingContext2D* getContext2d() override
+  {
+    return nullptr;
+  }
+
+  GL::IGLRenderingContext*
+  getContext3d(const EngineOptions& /*options*/) override
+  {
+    return _renderingContext.get();
+  }
+
+}; // end of class NullCanvas
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TESTS_HELPERS_NULL_CANVAS_H
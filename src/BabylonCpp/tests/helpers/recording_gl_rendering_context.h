@@ -0,0 +1,215 @@
+#ifndef BABYLON_TESTS_HELPERS_RECORDING_GL_RENDERING_CONTEXT_H
+#define BABYLON_TESTS_HELPERS_RECORDING_GL_RENDERING_CONTEXT_H
+
+#include "null_canvas.h"
+
+namespace BABYLON {
+namespace GL {
+
+/**
+ * @brief GL rendering context without any backend recording the content of
+ * the float vertex and uniform buffers, the deleted buffers, the float
+ * uniforms, the vertex attributes bound by name and the draw calls, used by the
+ * unit tests to check what would reach the GPU.
+ */
+class RecordingGLRenderingContext : public NullGLRenderingContext {
+
+public:
+  struct AttributeBinding {
+    IGLBuffer* buffer;
+    GLint stride;
+    GLintptr offset;
+  }; // end of struct AttributeBinding
+
+  struct DrawCall {
+    GLsizei count;
+    GLsizei instanceCount;
+    // Vertex attributes bound at draw time, by name
+    std::unordered_map<std::string, AttributeBinding> attributes;
+  }; // end of struct DrawCall
+
+  struct BufferUpload {
+    IGLBuffer* buffer;
+    GLintptr byteOffset;
+    size_t floatCount;
+  }; // end of struct BufferUpload
+
+  struct UniformUpload {
+    IGLUniformLocation* location;
+    Float32Array values;
+  }; // end of struct UniformUpload
+
+public:
+  RecordingGLRenderingContext()
+      : _arrayBuffer{nullptr}, _uniformBuffer{nullptr}
+  {
+  }
+
+  ~RecordingGLRenderingContext()
+  {
+  }
+
+  GLint getAttribLocation(IGLProgram*, const std::string& name) override
+  {
+    auto it = _attributeLocations.find(name);
+    if (it == _attributeLocations.end()) {
+      it = _attributeLocations
+             .emplace(name, static_cast<GLint>(_attributeLocations.size()))
+             .first;
+    }
+    return it->second;
+  }
+
+  void bindBuffer(GLenum target, IGLBuffer* buffer) override
+  {
+    if (target == ARRAY_BUFFER) {
+      _arrayBuffer = buffer;
+    }
+    else if (target == UNIFORM_BUFFER) {
+      _uniformBuffer = buffer;
+    }
+  }
+
+  void bufferData(GLenum target, GLsizeiptr size, GLenum) override
+  {
+    if (auto buffer = _boundBuffer(target)) {
+      bufferContents[buffer]
+        = Float32Array(static_cast<size_t>(size) / sizeof(float));
+    }
+  }
+
+  void bufferData(GLenum target, const Float32Array& data, GLenum) override
+  {
+    if (auto buffer = _boundBuffer(target)) {
+      bufferContents[buffer] = data;
+    }
+  }
+
+  void bufferSubData(GLenum target, GLintptr offset,
+                     const Float32Array& data) override
+  {
+    bufferSubData(target, offset, data, 0,
+                  static_cast<GLuint>(data.size()));
+  }
+
+  void bufferSubData(GLenum target, GLintptr offset, const Float32Array& data,
+                     GLuint srcOffset, GLuint length) override
+  {
+    auto buffer = _boundBuffer(target);
+    if (!buffer) {
+      return;
+    }
+
+    auto& contents   = bufferContents[buffer];
+    const auto start = static_cast<size_t>(offset) / sizeof(float);
+    const auto end   = start + length;
+    if (contents.size() < end) {
+      contents.resize(end);
+    }
+    std::copy(data.begin() + srcOffset, data.begin() + srcOffset + length,
+              contents.begin() + static_cast<std::ptrdiff_t>(start));
+    uploads.emplace_back(BufferUpload{buffer, offset, length});
+  }
+
+  void deleteBuffer(IGLBuffer* buffer) override
+  {
+    bufferContents.erase(buffer);
+    deletedBuffers.emplace_back(buffer);
+  }
+
+  void uniform1f(IGLUniformLocation* location, GLfloat x) override
+  {
+    uniformUploads.emplace_back(UniformUpload{location, {x}});
+  }
+
+  void uniform3f(IGLUniformLocation* location, GLfloat x, GLfloat y,
+                 GLfloat z) override
+  {
+    uniformUploads.emplace_back(UniformUpload{location, {x, y, z}});
+  }
+
+  void uniform4f(IGLUniformLocation* location, GLfloat x, GLfloat y, GLfloat z,
+                 GLfloat w) override
+  {
+    uniformUploads.emplace_back(UniformUpload{location, {x, y, z, w}});
+  }
+
+  using NullGLRenderingContext::uniformMatrix4fv;
+  void uniformMatrix4fv(IGLUniformLocation* location, GLboolean,
+                        const Float32Array& value) override
+  {
+    uniformUploads.emplace_back(UniformUpload{location, value});
+  }
+
+  void vertexAttribPointer(GLuint index, GLint, GLenum, GLboolean,
+                           GLint stride, GLintptr offset) override
+  {
+    _attributeBindings[index] = AttributeBinding{_arrayBuffer, stride, offset};
+  }
+
+  void drawElements(GLenum, GLsizei count, GLenum, GLintptr) override
+  {
+    _recordDraw(count, 0);
+  }
+
+  void drawElementsInstanced(GLenum, GLsizei count, GLenum, GLintptr,
+                             GLsizei instanceCount) override
+  {
+    _recordDraw(count, instanceCount);
+  }
+
+  /**
+   * @brief Returns the component of the attribute read by the given instance
+   * (or vertex) of a recorded draw call.
+   */
+  float attributeValue(const DrawCall& drawCall, const std::string& name,
+                       size_t instance, size_t component) const
+  {
+    const auto& binding  = drawCall.attributes.at(name);
+    const auto& contents = bufferContents.at(binding.buffer);
+    const auto offset
+      = static_cast<size_t>(binding.offset)
+        + instance * static_cast<size_t>(binding.stride);
+    return contents.at(offset / sizeof(float) + component);
+  }
+
+private:
+  IGLBuffer* _boundBuffer(GLenum target) const
+  {
+    return (target == ARRAY_BUFFER) ?
+             _arrayBuffer :
+             (target == UNIFORM_BUFFER) ? _uniformBuffer : nullptr;
+  }
+
+  void _recordDraw(GLsizei count, GLsizei instanceCount)
+  {
+    DrawCall drawCall{count, instanceCount, {}};
+    for (const auto& location : _attributeLocations) {
+      auto binding = _attributeBindings.find(
+        static_cast<GLuint>(location.second));
+      if (binding != _attributeBindings.end()) {
+        drawCall.attributes[location.first] = binding->second;
+      }
+    }
+    drawCalls.emplace_back(std::move(drawCall));
+  }
+
+public:
+  std::vector<DrawCall> drawCalls;
+  std::vector<BufferUpload> uploads;
+  std::vector<UniformUpload> uniformUploads;
+  std::unordered_map<IGLBuffer*, Float32Array> bufferContents;
+  std::vector<IGLBuffer*> deletedBuffers;
+
+private:
+  IGLBuffer* _arrayBuffer;
+  IGLBuffer* _uniformBuffer;
+  std::unordered_map<std::string, GLint> _attributeLocations;
+  std::unordered_map<GLuint, AttributeBinding> _attributeBindings;
+
+}; // end of class RecordingGLRenderingContext
+
+} // end of namespace GL
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_TESTS_HELPERS_RECORDING_GL_RENDERING_CONTEXT_H
@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+
+#include <babylon/lights/light_grid.h>
+
+TEST(TestLightGrid, Score)
+{
+  using namespace BABYLON;
+
+  const Vector3 light(0.f, 0.f, 0.f);
+
+  // Mesh bounding sphere containing the light
+  EXPECT_FLOAT_EQ(LightGrid::Score(2.f, light, 10.f, false,
+                                   Vector3(1.f, 0.f, 0.f), 2.f),
+                  2.f);
+  // Attenuated with the distance to the bounding sphere
+  EXPECT_FLOAT_EQ(LightGrid::Score(2.f, light, 10.f, false,
+                                   Vector3(6.f, 0.f, 0.f), 1.f),
+                  0.5f);
+  EXPECT_FLOAT_EQ(LightGrid::Score(2.f, light, 10.f, false,
+                                   Vector3(12.f, 0.f, 0.f), 1.f),
+                  0.f);
+  // Unlimited range
+  EXPECT_FLOAT_EQ(LightGrid::Score(2.f, light,
+                                   std::numeric_limits<float>::max(), false,
+                                   Vector3(2.f, 0.f, 0.f), 1.f),
+                  1.f);
+  // Directional lights are not attenuated
+  EXPECT_FLOAT_EQ(LightGrid::Score(2.f, light, 10.f, true,
+                                   Vector3(100.f, 0.f, 0.f), 1.f),
+                  2.f);
+
+  // Closer lights are more relevant
+  EXPECT_GT(
+    LightGrid::Score(1.f, light, 10.f, false, Vector3(3.f, 0.f, 0.f), 1.f),
+    LightGrid::Score(1.f, light, 10.f, false, Vector3(5.f, 0.f, 0.f), 1.f));
+}
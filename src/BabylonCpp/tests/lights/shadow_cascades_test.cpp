@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <babylon/lights/shadows/shadow_cascades.h>
+
+namespace {
+
+// Inverse view matrix of a camera looking at the target
+BABYLON::Matrix inverseView(const BABYLON::Vector3& eye,
+                            const BABYLON::Vector3& target)
+{
+  using namespace BABYLON;
+
+  Matrix viewMatrix, inverseViewMatrix;
+  Matrix::LookAtLHToRef(eye, target, Vector3::Up(), viewMatrix);
+  viewMatrix.invertToRef(inverseViewMatrix);
+  return inverseViewMatrix;
+}
+
+} // end of anonymous namespace
+
+TEST(TestShadowCascades, ComputeSplits)
+{
+  using namespace BABYLON;
+
+  // Uniform splits
+  auto splits = ShadowCascades::ComputeSplits(4, 1.f, 101.f, 0.f);
+  ASSERT_EQ(splits.size(), 5ull);
+  EXPECT_FLOAT_EQ(splits[1], 26.f);
+  EXPECT_FLOAT_EQ(splits[2], 51.f);
+
+  // Logarithmic splits
+  splits = ShadowCascades::ComputeSplits(4, 1.f, 10000.f, 1.f);
+  EXPECT_FLOAT_EQ(splits[0], 1.f);
+  EXPECT_FLOAT_EQ(splits[1], 10.f);
+  EXPECT_FLOAT_EQ(splits[2], 100.f);
+  EXPECT_FLOAT_EQ(splits[4], 10000.f);
+
+  // Practical splits are in between, increasing
+  splits = ShadowCascades::ComputeSplits(3, 0.1f, 1000.f, 0.5f);
+  ASSERT_EQ(splits.size(), 4ull);
+  EXPECT_FLOAT_EQ(splits.front(), 0.1f);
+  EXPECT_FLOAT_EQ(splits.back(), 1000.f);
+  for (size_t i = 1; i < splits.size(); ++i) {
+    EXPECT_LT(splits[i - 1], splits[i]);
+  }
+}
+
+TEST(TestShadowCascades, ComputeSliceSphere)
+{
+  using namespace BABYLON;
+
+  const float fov = 0.8f, aspectRatio = 1.5f;
+  Vector3 center;
+  float radius = 0.f;
+  const auto inverseViewMatrix
+    = inverseView(Vector3(1.f, 2.f, 3.f), Vector3(1.f, 2.f, 10.f));
+  ShadowCascades::ComputeSliceSphere(inverseViewMatrix, fov, aspectRatio, 5.f,
+                                     20.f, center, radius);
+
+  // Encloses the corners of the slice
+  const float tanY = std::tan(fov * 0.5f);
+  const float tanX = tanY * aspectRatio;
+  for (float z : {5.f, 20.f}) {
+    for (float x : {-1.f, 1.f}) {
+      for (float y : {-1.f, 1.f}) {
+        const auto corner = Vector3::TransformCoordinates(
+          Vector3(x * tanX * z, y * tanY * z, z), inverseViewMatrix);
+        EXPECT_LE(Vector3::Distance(corner, center), radius);
+      }
+    }
+  }
+
+  // Does not depend on the camera orientation
+  Vector3 rotatedCenter;
+  float rotatedRadius = 0.f;
+  ShadowCascades::ComputeSliceSphere(
+    inverseView(Vector3(1.f, 2.f, 3.f), Vector3(-4.f, 0.f, 1.f)), fov,
+    aspectRatio, 5.f, 20.f, rotatedCenter, rotatedRadius);
+  EXPECT_FLOAT_EQ(rotatedRadius, radius);
+}
+
+TEST(TestShadowCascades, Texel_snapping)
+{
+  using namespace BABYLON;
+
+  const int tileSize   = 1024;
+  auto lightViewMatrix = ShadowCascades::LightViewMatrix(
+    Vector3(0.3f, -1.f, 0.5f));
+
+  // The projection of a moving cascade moves by whole texels
+  ShadowCascade cascade;
+  cascade.radius = 16.f;
+  for (float offset : {0.f, 0.01f, 0.37f, 1.5f, 7.25f}) {
+    cascade.center = Vector3(offset, 0.f, 2.f * offset);
+    ShadowCascades::ComputeTransform(lightViewMatrix, tileSize, -100.f,
+                                     cascade);
+    const auto& m = cascade.projectionMatrix.m;
+    for (float translation : {m[12], m[13]}) {
+      const float texels = translation * tileSize * 0.5f;
+      EXPECT_NEAR(texels, std::round(texels), 1e-2f);
+    }
+
+    // The slice is in the light frustum
+    for (const auto& plane : cascade.frustumPlanes) {
+      EXPECT_GE(plane.dotCoordinate(cascade.center), 0.f);
+    }
+  }
+
+  // Atlas layout
+  unsigned int columns = 0, rows = 0;
+  ShadowCascades::AtlasGrid(3, columns, rows);
+  EXPECT_EQ(columns, 2u);
+  EXPECT_EQ(rows, 2u);
+  ShadowCascades::AtlasGrid(1, columns, rows);
+  EXPECT_EQ(columns, 1u);
+  EXPECT_EQ(rows, 1u);
+}
@@ -0,0 +1,280 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+#include <babylon/animations/animation.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/arc_rotate_camera.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/lights/point_light.h>
+#include <babylon/lights/spot_light.h>
+#include <babylon/materials/multi_material.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/instanced_mesh.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+#include "../helpers/null_canvas.h"
+
+namespace {
+
+class TestSceneSnapshot : public ::testing::Test {
+
+protected:
+  void SetUp() override
+  {
+    using namespace BABYLON;
+    _canvas = std::make_unique<NullCanvas>();
+    _engine = Engine::New(_canvas.get());
+    _scene  = Scene::New(_engine.get());
+  }
+
+  void TearDown() override
+  {
+    std::remove("scene_snapshot_test.snap");
+    _engine->dispose();
+    _scene.reset(nullptr);
+    _loadedScene.reset(nullptr);
+    _engine.reset(nullptr);
+    _canvas.reset(nullptr);
+  }
+
+  // Saves the scene and loads the snapshot into a new scene
+  BABYLON::Scene* RoundTrip()
+  {
+    using namespace BABYLON;
+    EXPECT_TRUE(_scene->saveSnapshot("scene_snapshot_test.snap"));
+    _loadedScene = Scene::New(_engine.get());
+    EXPECT_TRUE(_loadedScene->loadSnapshot("scene_snapshot_test.snap"));
+    return _loadedScene.get();
+  }
+
+  std::unique_ptr<BABYLON::NullCanvas> _canvas;
+  std::unique_ptr<BABYLON::Engine> _engine;
+  std::unique_ptr<BABYLON::Scene> _scene;
+  std::unique_ptr<BABYLON::Scene> _loadedScene;
+
+}; // end of class TestSceneSnapshot
+
+} // end of anonymous namespace
+
+TEST_F(TestSceneSnapshot, MeshesAndMaterials)
+{
+  using namespace BABYLON;
+
+  auto red           = StandardMaterial::New("red", _scene.get());
+  red->diffuseColor  = Color3(1.f, 0.f, 0.f);
+  red->specularPower = 32.f;
+  red->alpha         = 0.5f;
+  auto blue          = StandardMaterial::New("blue", _scene.get());
+  blue->diffuseColor = Color3(0.f, 0.f, 1.f);
+  blue->setBackFaceCulling(false);
+  auto multi = MultiMaterial::New("multi", _scene.get());
+  multi->subMaterials.emplace_back(red);
+  multi->subMaterials.emplace_back(blue);
+
+  auto box = Mesh::CreateBox("box", 2.f, _scene.get());
+  box->setPosition(Vector3(1.f, 2.f, 3.f));
+  box->setScaling(Vector3(2.f, 2.f, 2.f));
+  box->setMaterial(red);
+  box->visibility = 0.75f;
+  auto sphere     = Mesh::CreateSphere("sphere", 4, 1.f, _scene.get());
+  sphere->setParent(box);
+  sphere->setRotation(Vector3(0.f, 1.f, 0.f));
+  sphere->setMaterial(multi);
+  box->createInstance("boxInstance")->setPosition(Vector3(-5.f, 0.f, 0.f));
+
+  auto loaded = RoundTrip();
+
+  // Meshes, their transform, hierarchy and geometry
+  auto loadedBox    = dynamic_cast<Mesh*>(loaded->getMeshByName("box"));
+  auto loadedSphere = dynamic_cast<Mesh*>(loaded->getMeshByName("sphere"));
+  ASSERT_NE(loadedBox, nullptr);
+  ASSERT_NE(loadedSphere, nullptr);
+  EXPECT_EQ(loadedBox->position(), Vector3(1.f, 2.f, 3.f));
+  EXPECT_EQ(loadedBox->scaling(), Vector3(2.f, 2.f, 2.f));
+  EXPECT_FLOAT_EQ(loadedBox->visibility, 0.75f);
+  EXPECT_EQ(loadedSphere->parent(), loadedBox);
+  EXPECT_EQ(loadedSphere->rotation(), Vector3(0.f, 1.f, 0.f));
+  EXPECT_EQ(loadedBox->getTotalVertices(), box->getTotalVertices());
+  EXPECT_EQ(loadedBox->getIndices(), box->getIndices());
+  EXPECT_EQ(loadedSphere->getVerticesData(VertexBuffer::PositionKind),
+            sphere->getVerticesData(VertexBuffer::PositionKind));
+  EXPECT_EQ(loadedSphere->getVerticesData(VertexBuffer::NormalKind),
+            sphere->getVerticesData(VertexBuffer::NormalKind));
+  EXPECT_EQ(loadedBox->subMeshes.size(), box->subMeshes.size());
+  ASSERT_EQ(loadedBox->instances.size(), 1ul);
+  EXPECT_EQ(loadedBox->instances[0]->position(), Vector3(-5.f, 0.f, 0.f));
+
+  // World matrix of the child mesh
+  EXPECT_EQ(loadedSphere->computeWorldMatrix(true),
+            sphere->computeWorldMatrix(true));
+
+  // Materials
+  auto loadedRed
+    = dynamic_cast<StandardMaterial*>(loaded->getMaterialByName("red"));
+  auto loadedBlue
+    = dynamic_cast<StandardMaterial*>(loaded->getMaterialByName("blue"));
+  ASSERT_NE(loadedRed, nullptr);
+  ASSERT_NE(loadedBlue, nullptr);
+  EXPECT_EQ(loadedRed->diffuseColor, Color3(1.f, 0.f, 0.f));
+  EXPECT_FLOAT_EQ(loadedRed->specularPower, 32.f);
+  EXPECT_FLOAT_EQ(loadedRed->alpha, 0.5f);
+  EXPECT_FALSE(loadedBlue->backFaceCulling());
+  EXPECT_EQ(loadedBox->material(), loadedRed);
+
+  auto loadedMulti = dynamic_cast<MultiMaterial*>(loadedSphere->material());
+  ASSERT_NE(loadedMulti, nullptr);
+  EXPECT_EQ(loadedMulti->subMaterials,
+            (std::vector<Material*>{loadedRed, loadedBlue}));
+}
+
+TEST_F(TestSceneSnapshot, SkeletonsAndAnimations)
+{
+  using namespace BABYLON;
+
+  auto skeleton = new Skeleton("skeleton", "skeletonId", _scene.get());
+  auto root     = Bone::New("root", skeleton, nullptr, Matrix::Identity());
+  auto child    = Bone::New("child", skeleton, root,
+                         Matrix::Translation(0.f, 1.f, 0.f));
+  auto boneAnimation = new Animation("boneAnimation", "_matrix", 30,
+                                     Animation::ANIMATIONTYPE_MATRIX,
+                                     Animation::ANIMATIONLOOPMODE_CYCLE);
+  boneAnimation->setKeys(
+    {AnimationKey(0, AnimationValue(Matrix::Translation(0.f, 1.f, 0.f))),
+     AnimationKey(20, AnimationValue(Matrix::Translation(0.f, 2.f, 0.f)))});
+  child->animations.emplace_back(boneAnimation);
+  skeleton->createAnimationRange("stretch", 0, 20);
+
+  auto box = Mesh::CreateBox("box", 1.f, _scene.get());
+  box->setSkeleton(skeleton);
+  auto animation = new Animation("slide", "position.x", 30,
+                                 Animation::ANIMATIONTYPE_FLOAT,
+                                 Animation::ANIMATIONLOOPMODE_CONSTANT);
+  animation->setKeys({AnimationKey(0, AnimationValue(0.f)),
+                      AnimationKey(10, AnimationValue(5.f)),
+                      AnimationKey(30, AnimationValue(-2.f))});
+  box->animations.emplace_back(animation);
+  box->createAnimationRange("forward", 0, 10);
+
+  auto loaded = RoundTrip();
+
+  // Skeletons and bones
+  auto loadedSkeleton = loaded->getSkeletonByName("skeleton");
+  ASSERT_NE(loadedSkeleton, nullptr);
+  EXPECT_EQ(loadedSkeleton->id, "skeletonId");
+  ASSERT_EQ(loadedSkeleton->bones.size(), 2ul);
+  auto loadedRoot  = loadedSkeleton->bones[0].get();
+  auto loadedChild = loadedSkeleton->bones[1].get();
+  EXPECT_EQ(loadedChild->name, "child");
+  EXPECT_EQ(loadedChild->getParent(), loadedRoot);
+  EXPECT_EQ(loadedChild->getLocalMatrix().asArray(),
+            child->getLocalMatrix().asArray());
+  ASSERT_EQ(loadedChild->animations.size(), 1ul);
+  EXPECT_EQ(loadedChild->animations[0]->getKeys().size(), 2ul);
+  EXPECT_EQ(loadedChild->animations[0]->getKeys()[1].value.matrixData,
+            Matrix::Translation(0.f, 2.f, 0.f));
+  const auto ranges = loadedSkeleton->getAnimationRanges();
+  ASSERT_EQ(ranges.size(), 1ul);
+  EXPECT_EQ(ranges[0].name, "stretch");
+  EXPECT_FLOAT_EQ(ranges[0].to, 20.f);
+
+  // Mesh animations
+  auto loadedBox = dynamic_cast<Mesh*>(loaded->getMeshByName("box"));
+  ASSERT_NE(loadedBox, nullptr);
+  EXPECT_EQ(loadedBox->skeleton(), loadedSkeleton);
+  ASSERT_EQ(loadedBox->animations.size(), 1ul);
+  const auto loadedAnimation = loadedBox->animations[0];
+  EXPECT_EQ(loadedAnimation->name, "slide");
+  EXPECT_EQ(loadedAnimation->targetProperty, "position.x");
+  EXPECT_EQ(loadedAnimation->dataType,
+            static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+  EXPECT_EQ(loadedAnimation->loopMode,
+            static_cast<unsigned int>(Animation::ANIMATIONLOOPMODE_CONSTANT));
+  ASSERT_EQ(loadedAnimation->getKeys().size(), 3ul);
+  EXPECT_EQ(loadedAnimation->getKeys()[2].frame, 30);
+  EXPECT_FLOAT_EQ(loadedAnimation->getKeys()[2].value.floatData, -2.f);
+  ASSERT_NE(loadedBox->getAnimationRange("forward"), nullptr);
+  EXPECT_FLOAT_EQ(loadedBox->getAnimationRange("forward")->to, 10.f);
+}
+
+TEST_F(TestSceneSnapshot, CamerasAndLights)
+{
+  using namespace BABYLON;
+
+  _scene->clearColor = Color4(0.1f, 0.2f, 0.3f, 1.f);
+  _scene->setFogEnabled(true);
+  _scene->fogDensity = 0.25f;
+
+  auto freeCamera = FreeCamera::New("free", Vector3(0.f, 5.f, -10.f),
+                                    _scene.get());
+  freeCamera->fov   = 0.5f;
+  freeCamera->speed = 4.f;
+  auto arcRotateCamera
+    = ArcRotateCamera::New("arcRotate", 1.f, 0.5f, 12.f,
+                           Vector3(1.f, 0.f, 0.f), _scene.get());
+  _scene->activeCamera = arcRotateCamera;
+
+  auto hemisphericLight = HemisphericLight::New(
+    "hemispheric", Vector3(0.f, 1.f, 0.f), _scene.get());
+  hemisphericLight->groundColor = Color3(0.2f, 0.1f, 0.f);
+  hemisphericLight->intensity   = 0.5f;
+  auto spotLight
+    = SpotLight::New("spot", Vector3(0.f, 10.f, 0.f), Vector3(0.f, -1.f, 0.f),
+                     0.8f, 2.f, _scene.get());
+  spotLight->diffuse = Color3(1.f, 1.f, 0.f);
+  auto pointLight
+    = PointLight::New("point", Vector3(3.f, 4.f, 5.f), _scene.get());
+  pointLight->range = 20.f;
+  auto excluded     = Mesh::CreateBox("excluded", 1.f, _scene.get());
+  pointLight->excludedMeshes().emplace_back(excluded);
+
+  auto loaded = RoundTrip();
+
+  // Scene settings
+  EXPECT_EQ(loaded->clearColor, Color4(0.1f, 0.2f, 0.3f, 1.f));
+  EXPECT_TRUE(loaded->fogEnabled());
+  EXPECT_FLOAT_EQ(loaded->fogDensity, 0.25f);
+
+  // Cameras
+  auto loadedFree
+    = dynamic_cast<FreeCamera*>(loaded->getCameraByName("free"));
+  auto loadedArcRotate
+    = dynamic_cast<ArcRotateCamera*>(loaded->getCameraByName("arcRotate"));
+  ASSERT_NE(loadedFree, nullptr);
+  ASSERT_NE(loadedArcRotate, nullptr);
+  EXPECT_EQ(loadedFree->position, Vector3(0.f, 5.f, -10.f));
+  EXPECT_FLOAT_EQ(loadedFree->fov, 0.5f);
+  EXPECT_FLOAT_EQ(loadedFree->speed, 4.f);
+  EXPECT_FLOAT_EQ(loadedArcRotate->alpha, arcRotateCamera->alpha);
+  EXPECT_FLOAT_EQ(loadedArcRotate->beta, arcRotateCamera->beta);
+  EXPECT_FLOAT_EQ(loadedArcRotate->radius, arcRotateCamera->radius);
+  EXPECT_EQ(loadedArcRotate->target(), Vector3(1.f, 0.f, 0.f));
+  EXPECT_EQ(loaded->activeCamera, loadedArcRotate);
+
+  // Lights
+  auto loadedHemispheric
+    = dynamic_cast<HemisphericLight*>(loaded->getLightByName("hemispheric"));
+  auto loadedSpot = dynamic_cast<SpotLight*>(loaded->getLightByName("spot"));
+  auto loadedPoint
+    = dynamic_cast<PointLight*>(loaded->getLightByName("point"));
+  ASSERT_NE(loadedHemispheric, nullptr);
+  ASSERT_NE(loadedSpot, nullptr);
+  ASSERT_NE(loadedPoint, nullptr);
+  EXPECT_EQ(loadedHemispheric->groundColor, Color3(0.2f, 0.1f, 0.f));
+  EXPECT_FLOAT_EQ(loadedHemispheric->intensity, 0.5f);
+  EXPECT_EQ(loadedSpot->position, Vector3(0.f, 10.f, 0.f));
+  EXPECT_EQ(loadedSpot->direction(), Vector3(0.f, -1.f, 0.f));
+  EXPECT_FLOAT_EQ(loadedSpot->angle(), 0.8f);
+  EXPECT_FLOAT_EQ(loadedSpot->exponent, 2.f);
+  EXPECT_EQ(loadedSpot->diffuse, Color3(1.f, 1.f, 0.f));
+  EXPECT_EQ(loadedPoint->position, Vector3(3.f, 4.f, 5.f));
+  EXPECT_FLOAT_EQ(loadedPoint->range, 20.f);
+  ASSERT_EQ(loadedPoint->excludedMeshes().size(), 1ul);
+  EXPECT_EQ(loadedPoint->excludedMeshes()[0],
+            loaded->getMeshByName("excluded"));
+}
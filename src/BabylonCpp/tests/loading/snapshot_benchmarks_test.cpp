@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/loading/scene_loader.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+#include "../helpers/null_canvas.h"
+
+// The benchmarks are disabled by default, run them with:
+//   --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+
+namespace {
+
+template <class Function>
+double measure(Function&& function)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  function();
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// Vertex buffers of a grid of gridSize x gridSize vertices
+struct GridBuffers {
+  BABYLON::Float32Array positions;
+  BABYLON::Float32Array normals;
+  BABYLON::Float32Array uvs;
+  BABYLON::Uint32Array indices;
+}; // end of struct GridBuffers
+
+GridBuffers makeGrid(unsigned int gridSize)
+{
+  GridBuffers grid;
+  for (unsigned int y = 0; y < gridSize; ++y) {
+    for (unsigned int x = 0; x < gridSize; ++x) {
+      const float u = static_cast<float>(x) / static_cast<float>(gridSize);
+      const float v = static_cast<float>(y) / static_cast<float>(gridSize);
+      grid.positions.insert(grid.positions.end(), {u, 0.25f * u * v, v});
+      grid.normals.insert(grid.normals.end(), {0.f, 1.f, 0.f});
+      grid.uvs.insert(grid.uvs.end(), {u, v});
+      if (x + 1 < gridSize && y + 1 < gridSize) {
+        const unsigned int i = y * gridSize + x;
+        grid.indices.insert(grid.indices.end(),
+                            {i, i + gridSize, i + 1, i + 1, i + gridSize,
+                             i + gridSize + 1});
+      }
+    }
+  }
+  return grid;
+}
+
+template <typename T>
+void writeJsonArray(std::ostream& stream, const char* key,
+                    const std::vector<T>& array)
+{
+  stream << "\"" << key << "\":[";
+  for (size_t i = 0; i < array.size(); ++i) {
+    stream << (i > 0 ? "," : "") << array[i];
+  }
+  stream << "]";
+}
+
+} // end of anonymous namespace
+
+TEST(TestSnapshotBenchmark, DISABLED_Babylon_and_snapshot_scene_loading)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = Engine::New(&canvas);
+
+  // .babylon file, a mesh with its geometry as vertex data
+  {
+    const auto grid = makeGrid(512);
+    std::ofstream stream("snapshot_benchmark.babylon");
+    stream << "{\"clearColor\":[0,0,0,1],\"ambientColor\":[0,0,0],"
+           << "\"meshes\":[{\"name\":\"grid\",\"id\":\"grid\",";
+    writeJsonArray(stream, "positions", grid.positions);
+    stream << ",";
+    writeJsonArray(stream, "normals", grid.normals);
+    stream << ",";
+    writeJsonArray(stream, "uvs", grid.uvs);
+    stream << ",";
+    writeJsonArray(stream, "indices", grid.indices);
+    stream << "}]}";
+  }
+
+  // .babylon loading, from the file to the scene
+  auto babylonScene      = Scene::New(engine.get());
+  const auto babylonTime = measure([&]() {
+    std::ifstream stream("snapshot_benchmark.babylon");
+    const std::string data((std::istreambuf_iterator<char>(stream)),
+                           std::istreambuf_iterator<char>());
+    SceneLoader::Append("", "data:" + data, babylonScene.get());
+  });
+  auto babylonGrid = dynamic_cast<Mesh*>(babylonScene->getMeshByName("grid"));
+  ASSERT_NE(babylonGrid, nullptr);
+
+  // Snapshot of the loaded scene
+  ASSERT_TRUE(babylonScene->saveSnapshot("snapshot_benchmark.snap"));
+  auto snapshotScene      = Scene::New(engine.get());
+  const auto snapshotTime = measure([&]() {
+    ASSERT_TRUE(snapshotScene->loadSnapshot("snapshot_benchmark.snap"));
+  });
+  auto snapshotGrid
+    = dynamic_cast<Mesh*>(snapshotScene->getMeshByName("grid"));
+  ASSERT_NE(snapshotGrid, nullptr);
+
+  EXPECT_EQ(snapshotGrid->getTotalVertices(), babylonGrid->getTotalVertices());
+  EXPECT_EQ(snapshotGrid->getVerticesData(VertexBuffer::PositionKind),
+            babylonGrid->getVerticesData(VertexBuffer::PositionKind));
+  EXPECT_EQ(snapshotGrid->getIndices(), babylonGrid->getIndices());
+
+  std::cout << babylonGrid->getTotalVertices() << " vertices, "
+            << babylonGrid->getTotalIndices() / 3 << " triangles: .babylon "
+            << babylonTime << " ms, snapshot " << snapshotTime
+            << " ms, speedup " << babylonTime / snapshotTime << "x"
+            << std::endl;
+
+  engine->dispose();
+  std::remove("snapshot_benchmark.babylon");
+  std::remove("snapshot_benchmark.snap");
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <babylon/loading/snapshot/snapshot_file.h>
+#include <babylon/loading/snapshot/snapshot_record.h>
+
+namespace {
+
+constexpr uint32_t VertTag = BABYLON::SnapshotFile::Tag('V', 'E', 'R', 'T');
+constexpr uint32_t IndxTag = BABYLON::SnapshotFile::Tag('I', 'N', 'D', 'X');
+
+void writeFile(const std::string& filename, const std::vector<uint8_t>& data)
+{
+  std::ofstream stream(filename, std::ios::binary);
+  stream.write(reinterpret_cast<const char*>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+}
+
+} // end of anonymous namespace
+
+TEST(TestSnapshotFile, Blobs_round_trip)
+{
+  using namespace BABYLON;
+
+  const Float32Array positions{0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f};
+  const Uint32Array indices{0, 1, 2};
+  const std::vector<uint8_t> bytes{1, 2, 3};
+
+  SnapshotFileWriter writer;
+  EXPECT_EQ(writer.addBlob(IndxTag, bytes.data(), bytes.size()), 0u);
+  EXPECT_EQ(writer.addArray(VertTag, positions), 1u);
+  EXPECT_EQ(writer.addArray(IndxTag, indices), 2u);
+  EXPECT_EQ(writer.addArray(VertTag, Float32Array()), 3u);
+  ASSERT_TRUE(writer.save("snapshot_file_test.snap"));
+
+  auto reader = SnapshotFileReader::Open("snapshot_file_test.snap");
+  ASSERT_TRUE(reader != nullptr);
+  ASSERT_EQ(reader->blobCount(), 4u);
+  EXPECT_EQ(reader->findBlob(VertTag), 1u);
+  EXPECT_EQ(reader->findBlob(SnapshotFile::Tag('N', 'O', 'N', 'E')), 4u);
+
+  // The blobs are aligned in the file
+  for (size_t i = 0; i < reader->blobCount(); ++i) {
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(reader->blobData(i))
+                % SnapshotFile::Alignment,
+              0u);
+  }
+
+  Float32Array readPositions;
+  Uint32Array readIndices;
+  ASSERT_TRUE(reader->readArray(1, readPositions));
+  ASSERT_TRUE(reader->readArray(2, readIndices));
+  EXPECT_EQ(readPositions, positions);
+  EXPECT_EQ(readIndices, indices);
+  EXPECT_EQ(reader->blobSize(0), 3u);
+  EXPECT_EQ(reader->blobSize(3), 0u);
+
+  // Sizes not matching the element type and out of range blobs
+  EXPECT_FALSE(reader->readArray(0, readPositions));
+  EXPECT_FALSE(reader->readArray(4, readPositions));
+  EXPECT_EQ(reader->blobData(4), nullptr);
+
+  reader.reset();
+  std::remove("snapshot_file_test.snap");
+}
+
+TEST(TestSnapshotFile, Invalid_files_are_rejected)
+{
+  using namespace BABYLON;
+
+  SnapshotFileWriter writer;
+  writer.addArray(VertTag, Float32Array(100, 1.f));
+  const auto data = writer.serialize();
+
+  const auto open = [](const std::vector<uint8_t>& content) {
+    writeFile("snapshot_file_test.snap", content);
+    return SnapshotFileReader::Open("snapshot_file_test.snap") != nullptr;
+  };
+  EXPECT_TRUE(open(data));
+  EXPECT_FALSE(SnapshotFileReader::Open("snapshot_file_test.missing"));
+
+  // Truncated file
+  EXPECT_FALSE(open(std::vector<uint8_t>(data.begin(), data.end() - 1)));
+  EXPECT_FALSE(open(std::vector<uint8_t>(data.begin(), data.begin() + 16)));
+
+  // Wrong magic, version and byte order
+  for (size_t offset : {0, 8, 12}) {
+    auto corrupted = data;
+    corrupted[offset] ^= 0xff;
+    EXPECT_FALSE(open(corrupted)) << offset;
+  }
+
+  // Blob out of the file and misaligned blob
+  const size_t tocOffset    = data.size() - SnapshotFile::TocEntrySize;
+  auto corrupted            = data;
+  corrupted[tocOffset + 16] = 0xff;
+  corrupted[tocOffset + 17] = 0xff;
+  EXPECT_FALSE(open(corrupted));
+  corrupted = data;
+  corrupted[tocOffset + 8] += 4;
+  EXPECT_FALSE(open(corrupted));
+
+  std::remove("snapshot_file_test.snap");
+}
+
+TEST(TestSnapshotFile, Records_are_bounds_checked)
+{
+  using namespace BABYLON;
+
+  SnapshotRecordWriter writer;
+  writer.write<uint32_t>(42);
+  writer.writeString("mesh");
+  writer.writeArray(Float32Array{1.f, 2.f, 3.f});
+  writer.write(0.5f);
+  const auto& data = writer.data();
+
+  SnapshotRecordReader reader(data.data(), data.size());
+  EXPECT_EQ(reader.read<uint32_t>(), 42u);
+  EXPECT_EQ(reader.readString(), "mesh");
+  EXPECT_EQ(reader.readArray<float>(), (Float32Array{1.f, 2.f, 3.f}));
+  EXPECT_FLOAT_EQ(reader.read<float>(), 0.5f);
+  EXPECT_TRUE(reader.atEnd());
+  EXPECT_FALSE(reader.failed());
+
+  // Reading past the end fails the reader
+  EXPECT_EQ(reader.read<uint32_t>(), 0u);
+  EXPECT_TRUE(reader.failed());
+
+  // Value past the end of a truncated blob
+  SnapshotRecordReader truncated(data.data(), data.size() - 4);
+  truncated.read<uint32_t>();
+  truncated.readString();
+  EXPECT_EQ(truncated.readArray<float>().size(), 3u);
+  EXPECT_EQ(truncated.read<float>(), 0.f);
+  EXPECT_TRUE(truncated.failed());
+
+  // Array with a count larger than the remaining data
+  SnapshotRecordReader shortArray(data.data(), 10);
+  shortArray.read<uint32_t>();
+  EXPECT_TRUE(shortArray.readString().empty());
+  EXPECT_TRUE(shortArray.failed());
+}
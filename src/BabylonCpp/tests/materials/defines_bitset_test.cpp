@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <babylon/materials/defines_bitset.h>
+
+TEST(TestDefinesBitset, Bits)
+{
+  using namespace BABYLON;
+
+  DefinesBitset bitset;
+  EXPECT_TRUE(bitset.empty());
+  bitset.resize(100);
+  EXPECT_EQ(bitset.size(), 100u);
+  EXPECT_FALSE(bitset[70]);
+
+  bitset[70] = true;
+  bitset[3]  = bitset[70];
+  EXPECT_TRUE(bitset[70]);
+  EXPECT_TRUE(bitset[3]);
+  EXPECT_FALSE(bitset[4]);
+
+  // Out of range bits are ignored
+  bitset[100] = true;
+  EXPECT_FALSE(bitset.test(100));
+
+  // The new bits are false
+  bitset.resize(50);
+  bitset.resize(100);
+  EXPECT_FALSE(bitset[70]);
+  EXPECT_TRUE(bitset[3]);
+
+  bitset.reset();
+  EXPECT_EQ(bitset.size(), 100u);
+  EXPECT_FALSE(bitset[3]);
+
+  bitset.emplace_back(true);
+  EXPECT_EQ(bitset.size(), 101u);
+  EXPECT_TRUE(bitset[100]);
+}
+
+TEST(TestDefinesBitset, Hash)
+{
+  using namespace BABYLON;
+
+  DefinesBitset a, b;
+  a.resize(64);
+  b.resize(64);
+  EXPECT_EQ(a.hash(), b.hash());
+
+  // The hash only depends on the set bits, not on the order of the changes
+  a[1]  = true;
+  a[40] = true;
+  a[7]  = true;
+  a[7]  = false;
+  b[40] = true;
+  b[1]  = true;
+  EXPECT_EQ(a.hash(), b.hash());
+  EXPECT_TRUE(a == b);
+
+  b[2] = true;
+  EXPECT_NE(a.hash(), b.hash());
+  EXPECT_TRUE(a != b);
+
+  // Same bits with a different size
+  b[2] = false;
+  b.resize(65);
+  EXPECT_NE(a.hash(), b.hash());
+  EXPECT_TRUE(a != b);
+}
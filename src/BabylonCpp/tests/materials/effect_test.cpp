@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/engine/engine.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/effect_creation_options.h>
+#include <babylon/math/color3.h>
+#include <babylon/math/matrix.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+#include "../helpers/recording_gl_rendering_context.h"
+
+namespace {
+
+BABYLON::Effect* CreateEffect(BABYLON::Engine* engine)
+{
+  using namespace BABYLON;
+
+  EffectCreationOptions options;
+  options.attributes    = {VertexBuffer::PositionKindChars};
+  options.uniformsNames
+    = {"world", "viewProjection", "color", "visibility", "world"};
+  options.samplers      = {"diffuseSampler"};
+  return engine->createEffect("color", options, engine);
+}
+
+// The next float after value, count times
+float nextFloat(float value, unsigned int count)
+{
+  for (unsigned int i = 0; i < count; ++i) {
+    value = std::nextafter(value, 2.f * value);
+  }
+  return value;
+}
+
+} // end of anonymous namespace
+
+TEST(TestEffect, UniformHandlesResolveToTheUniformSlots)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto effect = CreateEffect(engine.get());
+
+  // Handles are shared by all the effects
+  const auto colorHandle = Effect::GetUniformHandle("color");
+  EXPECT_EQ(Effect::GetUniformHandle("color"), colorHandle);
+  EXPECT_NE(Effect::GetUniformHandle("world"), colorHandle);
+
+  // The slot is the index in the uniform names, followed by the samplers
+  EXPECT_EQ(effect->getUniformSlot(Effect::GetUniformHandle("viewProjection")),
+            1);
+  EXPECT_EQ(effect->getUniformSlot(colorHandle), 2);
+  EXPECT_EQ(effect->getUniformSlot(Effect::GetUniformHandle("diffuseSampler")),
+            5);
+
+  // A uniform declared twice uses its first slot
+  EXPECT_EQ(effect->getUniformSlot(Effect::GetUniformHandle("world")), 0);
+
+  // Uniforms of other effects have no slot
+  EXPECT_EQ(effect->getUniformSlot(Effect::GetUniformHandle("unusedUniform")),
+            -1);
+
+  engine->dispose();
+}
+
+TEST(TestEffect, NameAndHandleSettersShareTheValueCache)
+{
+  using namespace BABYLON;
+
+  auto gl     = std::make_unique<GL::RecordingGLRenderingContext>();
+  auto& glRef = *gl;
+  NullCanvas canvas(std::move(gl));
+  auto engine = Engine::New(&canvas);
+  auto effect = CreateEffect(engine.get());
+  ASSERT_TRUE(effect->isReady());
+
+  const auto colorHandle = Effect::GetUniformHandle("color");
+  effect->setColor3(colorHandle, Color3(1.f, 0.5f, 0.f));
+  ASSERT_EQ(glRef.uniformUploads.size(), 1ul);
+  EXPECT_EQ(glRef.uniformUploads[0].values, Float32Array({1.f, 0.5f, 0.f}));
+
+  // Unchanged values are not uploaded, whatever the setter
+  effect->setColor3("color", Color3(1.f, 0.5f, 0.f));
+  effect->setFloat3(colorHandle, 1.f, 0.5f, 0.f);
+  EXPECT_EQ(glRef.uniformUploads.size(), 1ul);
+
+  effect->setColor3("color", Color3(0.f, 0.5f, 0.f));
+  EXPECT_EQ(glRef.uniformUploads.size(), 2ul);
+
+  // Names of uniforms of no effect are ignored
+  effect->setFloat("unknownUniform", 1.f);
+  EXPECT_EQ(glRef.uniformUploads.size(), 2ul);
+
+  engine->dispose();
+}
+
+TEST(TestEffect, SetFloatSkipsValuesWithinFourUlps)
+{
+  using namespace BABYLON;
+
+  auto gl     = std::make_unique<GL::RecordingGLRenderingContext>();
+  auto& glRef = *gl;
+  NullCanvas canvas(std::move(gl));
+  auto engine = Engine::New(&canvas);
+  auto effect = CreateEffect(engine.get());
+  ASSERT_TRUE(effect->isReady());
+
+  const auto handle = Effect::GetUniformHandle("visibility");
+  effect->setFloat(handle, 1.5f);
+  ASSERT_EQ(glRef.uniformUploads.size(), 1ul);
+
+  // Rounding noise does not reach the GPU
+  effect->setFloat(handle, 1.5f);
+  effect->setFloat(handle, nextFloat(1.5f, 1));
+  effect->setFloat(handle, nextFloat(1.5f, 4));
+  EXPECT_EQ(glRef.uniformUploads.size(), 1ul);
+
+  // The cached value is not updated by the skipped values
+  effect->setFloat(handle, nextFloat(1.5f, 64));
+  ASSERT_EQ(glRef.uniformUploads.size(), 2ul);
+  EXPECT_EQ(glRef.uniformUploads[1].values[0], nextFloat(1.5f, 64));
+
+  effect->setFloat(handle, -1.5f);
+  EXPECT_EQ(glRef.uniformUploads.size(), 3ul);
+
+  engine->dispose();
+}
+
+TEST(TestEffect, SetMatrixUploadsUpdatedMatrices)
+{
+  using namespace BABYLON;
+
+  auto gl     = std::make_unique<GL::RecordingGLRenderingContext>();
+  auto& glRef = *gl;
+  NullCanvas canvas(std::move(gl));
+  auto engine = Engine::New(&canvas);
+  auto effect = CreateEffect(engine.get());
+  ASSERT_TRUE(effect->isReady());
+
+  const auto worldHandle = Effect::GetUniformHandle("world");
+  auto world             = Matrix::Translation(1.f, 2.f, 3.f);
+  effect->setMatrix(worldHandle, world);
+  effect->setMatrix("world", world);
+  ASSERT_EQ(glRef.uniformUploads.size(), 1ul);
+  EXPECT_EQ(glRef.uniformUploads[0].values[12], 1.f);
+
+  // The cache compares the update flag of the matrix
+  world.setTranslationFromFloats(4.f, 5.f, 6.f);
+  effect->setMatrix(worldHandle, world);
+  ASSERT_EQ(glRef.uniformUploads.size(), 2ul);
+  EXPECT_EQ(glRef.uniformUploads[1].values[12], 4.f);
+
+  engine->dispose();
+}
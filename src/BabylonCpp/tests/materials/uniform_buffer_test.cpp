@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/engine_options.h>
+#include <babylon/engine/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/uniform_buffer.h>
+#include <babylon/math/color3.h>
+#include <babylon/math/matrix.h>
+#include <babylon/mesh/mesh.h>
+
+#include "../helpers/recording_gl_rendering_context.h"
+
+namespace {
+
+// Uniform buffer objects are only created with WebGL 2
+std::unique_ptr<BABYLON::Engine> CreateEngine(BABYLON::NullCanvas& canvas)
+{
+  BABYLON::EngineOptions options;
+  options.disableWebGL2Support = false;
+  return BABYLON::Engine::New(&canvas, options);
+}
+
+} // end of namespace
+
+TEST(TestUniformBuffer, DynamicRingAdvancesOncePerFrame)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = CreateEngine(canvas);
+
+  UniformBuffer uniformBuffer(engine.get(), Float32Array(), true);
+  ASSERT_TRUE(uniformBuffer.useUbo());
+  uniformBuffer.addUniform("viewProjection", 16);
+  uniformBuffer.create();
+
+  // Several updates in the same frame use the same buffer
+  engine->beginFrame();
+  uniformBuffer.update();
+  auto first = uniformBuffer.getBuffer();
+  uniformBuffer.update();
+  uniformBuffer.update();
+  EXPECT_EQ(uniformBuffer.getBuffer(), first);
+
+  // One buffer per frame in flight
+  std::vector<GL::IGLBuffer*> buffers{first};
+  for (size_t i = 1; i < UniformBuffer::DynamicBufferCount; ++i) {
+    engine->endFrame();
+    engine->beginFrame();
+    uniformBuffer.update();
+    uniformBuffer.update();
+    EXPECT_EQ(std::count(buffers.begin(), buffers.end(),
+                         uniformBuffer.getBuffer()),
+              0);
+    buffers.emplace_back(uniformBuffer.getBuffer());
+  }
+
+  engine->endFrame();
+  engine->beginFrame();
+  uniformBuffer.update();
+  EXPECT_EQ(uniformBuffer.getBuffer(), first);
+  engine->endFrame();
+
+  uniformBuffer.dispose();
+  engine->dispose();
+}
+
+TEST(TestUniformBuffer, DisposeReleasesThroughTheEngine)
+{
+  using namespace BABYLON;
+
+  auto gl     = std::make_unique<GL::RecordingGLRenderingContext>();
+  auto& glRef = *gl;
+  NullCanvas canvas(std::move(gl));
+  auto engine = CreateEngine(canvas);
+
+  UniformBuffer uniformBuffer(engine.get(), Float32Array(), false);
+  ASSERT_TRUE(uniformBuffer.useUbo());
+  uniformBuffer.addUniform("vDiffuseColor", 4);
+  uniformBuffer.create();
+
+  // Shared with another owner
+  auto buffer = uniformBuffer.getBuffer();
+  ++buffer->references;
+
+  uniformBuffer.dispose();
+  EXPECT_EQ(uniformBuffer.getBuffer(), nullptr);
+  EXPECT_EQ(buffer->references, 1ul);
+  EXPECT_TRUE(glRef.deletedBuffers.empty());
+
+  // Deleted with the last reference
+  engine->_releaseBuffer(buffer);
+  EXPECT_EQ(glRef.deletedBuffers, std::vector<GL::IGLBuffer*>{buffer});
+
+  engine->dispose();
+}
+
+TEST(TestUniformBuffer, BoundBufferIsDeletedOnceUnbound)
+{
+  using namespace BABYLON;
+
+  auto gl     = std::make_unique<GL::RecordingGLRenderingContext>();
+  auto& glRef = *gl;
+  NullCanvas canvas(std::move(gl));
+  auto engine = CreateEngine(canvas);
+  auto scene  = Scene::New(engine.get());
+
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 5.f, -10.f),
+                                scene.get());
+  camera->setTarget(Vector3::Zero());
+  scene->activeCamera = camera;
+  auto light = HemisphericLight::New("light", Vector3(0.f, 1.f, 0.f),
+                                     scene.get());
+  Mesh::CreateBox("box", 1.f, scene.get());
+  // The effect is only bound once compiled
+  for (unsigned int frame = 0; frame < 3; ++frame) {
+    scene->render();
+  }
+
+  // Still bound to the uniform block binding point of the light
+  auto buffer = light->_uniformBuffer->getBuffer();
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(buffer->references, 2ul);
+  light->dispose();
+  EXPECT_EQ(std::count(glRef.deletedBuffers.begin(),
+                       glRef.deletedBuffers.end(), buffer),
+            0);
+
+  engine->dispose();
+  EXPECT_EQ(std::count(glRef.deletedBuffers.begin(),
+                       glRef.deletedBuffers.end(), buffer),
+            1);
+  scene.reset(nullptr);
+}
+
+TEST(TestUniformBuffer, PartialUpdatesUploadTheDirtyRange)
+{
+  using namespace BABYLON;
+
+  auto gl     = std::make_unique<GL::RecordingGLRenderingContext>();
+  auto& glRef = *gl;
+  NullCanvas canvas(std::move(gl));
+  auto engine = CreateEngine(canvas);
+
+  UniformBuffer uniformBuffer(engine.get(), Float32Array(), false);
+  ASSERT_TRUE(uniformBuffer.useUbo());
+  uniformBuffer.addUniform("vDiffuseInfos", 2);
+  uniformBuffer.addUniform("vDiffuseColor", 4);
+  uniformBuffer.addUniform("pointSize", 1);
+  uniformBuffer.create();
+  auto buffer = uniformBuffer.getBuffer();
+
+  uniformBuffer.updateFloat4(Effect::GetUniformHandle("vDiffuseColor"), 1.f,
+                             2.f, 3.f, 4.f);
+  uniformBuffer.update();
+  ASSERT_EQ(glRef.uploads.size(), 1ul);
+  EXPECT_EQ(glRef.uploads[0].buffer, buffer);
+  EXPECT_EQ(glRef.uploads[0].byteOffset, 4 * sizeof(float));
+  EXPECT_EQ(glRef.uploads[0].floatCount, 4ul);
+  EXPECT_FLOAT_EQ(glRef.bufferContents[buffer][7], 4.f);
+
+  // Without count, the offset is also expressed in number of floats
+  glRef.uploads.clear();
+  engine->updateUniformBuffer(buffer, uniformBuffer.getData(), 8);
+  ASSERT_EQ(glRef.uploads.size(), 1ul);
+  EXPECT_EQ(glRef.uploads[0].byteOffset, 8 * sizeof(float));
+  EXPECT_EQ(glRef.uploads[0].floatCount, uniformBuffer.getData().size() - 8);
+
+  uniformBuffer.dispose();
+  engine->dispose();
+}
+
+TEST(TestUniformBuffer, HandleUpdatesUseTheLayoutOffsets)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = CreateEngine(canvas);
+
+  UniformBuffer uniformBuffer(engine.get(), Float32Array(), false);
+  ASSERT_TRUE(uniformBuffer.useUbo());
+  uniformBuffer.addUniform("vDiffuseInfos", 2);
+  uniformBuffer.addUniform("vBumpInfos", 3);
+  uniformBuffer.addUniform("diffuseMatrix", 16);
+  uniformBuffer.create();
+
+  // Resolved when the uniforms are added
+  const auto diffuseInfos = Effect::GetUniformHandle("vDiffuseInfos");
+  const auto bumpInfos    = Effect::GetUniformHandle("vBumpInfos");
+  const auto matrix       = Effect::GetUniformHandle("diffuseMatrix");
+  EXPECT_EQ(uniformBuffer.getUniformOffset(diffuseInfos), 0);
+  EXPECT_EQ(uniformBuffer.getUniformOffset(bumpInfos),
+            uniformBuffer.getUniformOffset("vBumpInfos"));
+  EXPECT_EQ(uniformBuffer.getUniformOffset(bumpInfos), 4);
+  EXPECT_EQ(uniformBuffer.getUniformOffset(matrix), 8);
+
+  uniformBuffer.updateFloat2(diffuseInfos, 1.f, 2.f);
+  uniformBuffer.updateFloat3(bumpInfos, 3.f, 4.f, 5.f);
+  uniformBuffer.updateMatrix(matrix, Matrix::Translation(6.f, 7.f, 8.f));
+
+  const auto& data = uniformBuffer.getData();
+  EXPECT_FLOAT_EQ(data[1], 2.f);
+  EXPECT_FLOAT_EQ(data[4], 3.f);
+  EXPECT_FLOAT_EQ(data[6], 5.f);
+  EXPECT_FLOAT_EQ(data[8 + 12], 6.f);
+  EXPECT_FLOAT_EQ(data[8 + 14], 8.f);
+  EXPECT_FALSE(uniformBuffer.isSync());
+
+  // Uniforms updated by handle are not added to the layout
+  const auto size = data.size();
+  uniformBuffer.updateFloat(Effect::GetUniformHandle("pointSize"), 1.f);
+  EXPECT_EQ(uniformBuffer.getData().size(), size);
+  EXPECT_EQ(uniformBuffer.getUniformOffset("pointSize"), -1);
+
+  uniformBuffer.dispose();
+  engine->dispose();
+}
+
+TEST(TestUniformBuffer, SuffixOnlyAppliesToTheEffectUniforms)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = CreateEngine(canvas);
+
+  UniformBuffer uniformBuffer(engine.get(), Float32Array(), false);
+  ASSERT_TRUE(uniformBuffer.useUbo());
+  uniformBuffer.addUniform("vLightData", 4);
+  uniformBuffer.addUniform("vLightDiffuse", 4);
+  uniformBuffer.create();
+
+  // The light uniform block members are not suffixed with the light index
+  uniformBuffer.updateColor4("vLightDiffuse", Color3(0.5f, 0.25f, 1.f), 10.f,
+                             "0");
+  EXPECT_EQ(uniformBuffer.getUniformOffset("vLightDiffuse0"), -1);
+  EXPECT_FLOAT_EQ(uniformBuffer.getData()[4], 0.5f);
+  EXPECT_FLOAT_EQ(uniformBuffer.getData()[7], 10.f);
+
+  uniformBuffer.updateFloat4(Effect::GetUniformHandle("vLightData"), 1.f, 2.f,
+                             3.f, 4.f,
+                             Effect::GetUniformHandle("vLightData0"));
+  EXPECT_FLOAT_EQ(uniformBuffer.getData()[3], 4.f);
+
+  uniformBuffer.dispose();
+  engine->dispose();
+}
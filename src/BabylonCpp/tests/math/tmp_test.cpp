@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <babylon/math/matrix.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/tmp.h>
+#include <babylon/math/vector3.h>
+
+namespace {
+
+// World matrices of a chain of nodes, each local matrix is composed from its
+// scaling, rotation and position as for the meshes and the bones, and the
+// world matrices are decomposed on the way
+std::vector<BABYLON::Matrix> computeChain(size_t chainIndex, size_t length)
+{
+  using namespace BABYLON;
+
+  std::vector<Matrix> worldMatrices(length);
+  auto parentMatrix = Matrix::Identity();
+  for (size_t i = 0; i < length; ++i) {
+    const auto t = static_cast<float>(chainIndex * length + i) * 0.1f;
+    Vector3 axis1(std::cos(t), std::sin(t), 0.f);
+    Vector3 axis2(-std::sin(t), std::cos(t), 0.f);
+    Vector3 axis3(0.f, 0.f, 1.f);
+    Vector3 euler;
+    Vector3::RotationFromAxisToRef(axis1, axis2, axis3, euler);
+
+    auto rotation = Quaternion::RotationYawPitchRoll(euler.y, euler.x, euler.z);
+    const Vector3 scaling(1.f + 0.01f * t, 1.f + 0.01f * t, 1.f + 0.01f * t);
+    const Vector3 position(t, 0.5f * t, -t);
+    Matrix localMatrix;
+    Matrix::ComposeToRef(scaling, rotation, position, localMatrix);
+
+    auto& worldMatrix = worldMatrices[i];
+    localMatrix.multiplyToRef(parentMatrix, worldMatrix);
+    Vector3 worldScaling;
+    Quaternion worldRotation;
+    Vector3 worldPosition;
+    worldMatrix.decompose(worldScaling, worldRotation, worldPosition);
+    Matrix::ComposeToRef(worldScaling, worldRotation, worldPosition,
+                         worldMatrix);
+    parentMatrix = worldMatrix;
+  }
+
+  return worldMatrices;
+}
+
+} // end of anonymous namespace
+
+TEST(TestTmp, One_set_of_objects_per_thread)
+{
+  using namespace BABYLON;
+
+  auto mainMatrices                     = &Tmp::MatrixArray();
+  auto mainVectors                      = &Tmp::Vector3Array();
+  std::array<Matrix, 7>* threadMatrices = nullptr;
+  std::array<Vector3, 9>* threadVectors = nullptr;
+  std::thread thread([&]() {
+    threadMatrices = &Tmp::MatrixArray();
+    threadVectors  = &Tmp::Vector3Array();
+  });
+  thread.join();
+
+  EXPECT_EQ(&Tmp::MatrixArray(), mainMatrices);
+  EXPECT_NE(threadMatrices, mainMatrices);
+  EXPECT_NE(threadVectors, mainVectors);
+}
+
+// Run with -fsanitize=thread to detect the data races
+TEST(TestTmp, Concurrent_world_matrix_computations)
+{
+  using namespace BABYLON;
+
+  const size_t threadCount = 8;
+  const size_t chainCount  = 4;
+  const size_t chainLength = 32;
+
+  // Reference computed on a single thread
+  std::vector<std::vector<Matrix>> expected;
+  for (size_t chain = 0; chain < threadCount * chainCount; ++chain) {
+    expected.emplace_back(computeChain(chain, chainLength));
+  }
+
+  // Each thread updates its own chains
+  std::vector<size_t> mismatches(threadCount, 0);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t iteration = 0; iteration < 50; ++iteration) {
+        for (size_t c = 0; c < chainCount; ++c) {
+          const auto chain         = t * chainCount + c;
+          const auto worldMatrices = computeChain(chain, chainLength);
+          for (size_t i = 0; i < chainLength; ++i) {
+            if (!worldMatrices[i].equals(expected[chain][i])) {
+              ++mismatches[t];
+            }
+          }
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t t = 0; t < threadCount; ++t) {
+    EXPECT_EQ(mismatches[t], 0u) << "thread " << t;
+  }
+}
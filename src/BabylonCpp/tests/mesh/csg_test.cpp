@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/csg/csg.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+#include "../helpers/null_canvas.h"
+
+namespace {
+
+struct SolidStats {
+  size_t vertexCount;
+  size_t faceCount;
+  BABYLON::Vector3 min;
+  BABYLON::Vector3 max;
+  float volume;
+  float area;
+}; // end of struct SolidStats
+
+// Counts, bounds, signed volume and surface area of the mesh triangles
+SolidStats GetSolidStats(BABYLON::Mesh* mesh)
+{
+  using namespace BABYLON;
+
+  const auto positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto indices   = mesh->getIndices();
+
+  SolidStats stats;
+  stats.vertexCount = positions.size() / 3;
+  stats.faceCount   = indices.size() / 3;
+  stats.min         = Vector3(std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::max(),
+                      std::numeric_limits<float>::max());
+  stats.max         = Vector3(std::numeric_limits<float>::lowest(),
+                      std::numeric_limits<float>::lowest(),
+                      std::numeric_limits<float>::lowest());
+  stats.volume      = 0.f;
+  stats.area        = 0.f;
+
+  for (size_t i = 0; i < stats.vertexCount; ++i) {
+    const Vector3 position(positions[i * 3], positions[i * 3 + 1],
+                           positions[i * 3 + 2]);
+    stats.min.minimizeInPlace(position);
+    stats.max.maximizeInPlace(position);
+  }
+
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    std::array<Vector3, 3> p;
+    for (size_t j = 0; j < 3; ++j) {
+      const size_t index = indices[i + j];
+      p[j] = Vector3(positions[index * 3], positions[index * 3 + 1],
+                     positions[index * 3 + 2]);
+    }
+    const auto cross = Vector3::Cross(p[1].subtract(p[0]), p[2].subtract(p[0]));
+    stats.area += cross.length() * 0.5f;
+    stats.volume += Vector3::Dot(p[0], Vector3::Cross(p[1], p[2])) / 6.f;
+  }
+
+  // Counter clockwise or clockwise depending on the side orientation
+  stats.volume = std::abs(stats.volume);
+
+  return stats;
+}
+
+class TestCSG : public ::testing::Test {
+
+protected:
+  void SetUp() override
+  {
+    using namespace BABYLON;
+    _canvas = std::make_unique<NullCanvas>();
+    _engine = Engine::New(_canvas.get());
+    _scene  = Scene::New(_engine.get());
+  }
+
+  void TearDown() override
+  {
+    _engine->dispose();
+    _scene.reset(nullptr);
+    _engine.reset(nullptr);
+    _canvas.reset(nullptr);
+  }
+
+  // Box of size 2 centered on (x, 0, 0)
+  std::unique_ptr<BABYLON::CSG::CSG> CreateBox(float x)
+  {
+    using namespace BABYLON;
+    auto box = Mesh::CreateBox("box", 2.f, _scene.get());
+    box->position().x = x;
+    return CSG::CSG::FromMesh(box);
+  }
+
+  std::unique_ptr<BABYLON::NullCanvas> _canvas;
+  std::unique_ptr<BABYLON::Engine> _engine;
+  std::unique_ptr<BABYLON::Scene> _scene;
+
+}; // end of class TestCSG
+
+} // end of namespace
+
+TEST_F(TestCSG, FromMesh)
+{
+  auto box   = CreateBox(0.f);
+  auto stats = GetSolidStats(box->buildMeshGeometry("box", _scene.get(), false));
+
+  EXPECT_EQ(stats.vertexCount, 24ul);
+  EXPECT_EQ(stats.faceCount, 12ul);
+  EXPECT_FLOAT_EQ(stats.volume, 8.f);
+  EXPECT_FLOAT_EQ(stats.area, 24.f);
+}
+
+TEST_F(TestCSG, Union)
+{
+  auto a = CreateBox(0.f);
+  auto b = CreateBox(1.f);
+
+  auto stats = GetSolidStats(
+    a->_union(*b)->buildMeshGeometry("union", _scene.get(), false));
+
+  EXPECT_EQ(stats.vertexCount, 50ul);
+  EXPECT_EQ(stats.faceCount, 32ul);
+  EXPECT_TRUE(stats.min.equalsWithEpsilon(BABYLON::Vector3(-1.f, -1.f, -1.f)));
+  EXPECT_TRUE(stats.max.equalsWithEpsilon(BABYLON::Vector3(2.f, 1.f, 1.f)));
+  EXPECT_NEAR(stats.volume, 12.f, 1e-4f);
+  EXPECT_NEAR(stats.area, 32.f, 1e-4f);
+}
+
+TEST_F(TestCSG, Subtract)
+{
+  auto a = CreateBox(0.f);
+  auto b = CreateBox(1.f);
+
+  auto stats = GetSolidStats(
+    a->subtract(*b)->buildMeshGeometry("subtract", _scene.get(), false));
+
+  EXPECT_EQ(stats.vertexCount, 28ul);
+  EXPECT_EQ(stats.faceCount, 16ul);
+  EXPECT_TRUE(stats.min.equalsWithEpsilon(BABYLON::Vector3(-1.f, -1.f, -1.f)));
+  EXPECT_TRUE(stats.max.equalsWithEpsilon(BABYLON::Vector3(0.f, 1.f, 1.f)));
+  EXPECT_NEAR(stats.volume, 4.f, 1e-4f);
+  EXPECT_NEAR(stats.area, 16.f, 1e-4f);
+}
+
+TEST_F(TestCSG, Intersect)
+{
+  auto a = CreateBox(0.f);
+  auto b = CreateBox(1.f);
+
+  auto stats = GetSolidStats(
+    a->intersect(*b)->buildMeshGeometry("intersect", _scene.get(), false));
+
+  EXPECT_EQ(stats.vertexCount, 28ul);
+  EXPECT_EQ(stats.faceCount, 16ul);
+  EXPECT_TRUE(stats.min.equalsWithEpsilon(BABYLON::Vector3(0.f, -1.f, -1.f)));
+  EXPECT_TRUE(stats.max.equalsWithEpsilon(BABYLON::Vector3(1.f, 1.f, 1.f)));
+  EXPECT_NEAR(stats.volume, 4.f, 1e-4f);
+  EXPECT_NEAR(stats.area, 16.f, 1e-4f);
+}
+
+TEST_F(TestCSG, DisjointSolids)
+{
+  auto a = CreateBox(0.f);
+  auto b = CreateBox(5.f);
+
+  // Union of disjoint solids keeps both solids untouched
+  auto stats = GetSolidStats(
+    a->_union(*b)->buildMeshGeometry("union", _scene.get(), false));
+  EXPECT_EQ(stats.vertexCount, 48ul);
+  EXPECT_EQ(stats.faceCount, 24ul);
+  EXPECT_TRUE(stats.min.equalsWithEpsilon(BABYLON::Vector3(-1.f, -1.f, -1.f)));
+  EXPECT_TRUE(stats.max.equalsWithEpsilon(BABYLON::Vector3(6.f, 1.f, 1.f)));
+  EXPECT_NEAR(stats.volume, 16.f, 1e-4f);
+
+  // Subtracting a disjoint solid leaves the first one untouched
+  stats = GetSolidStats(
+    a->subtract(*b)->buildMeshGeometry("subtract", _scene.get(), false));
+  EXPECT_EQ(stats.vertexCount, 24ul);
+  EXPECT_EQ(stats.faceCount, 12ul);
+  EXPECT_NEAR(stats.volume, 8.f, 1e-4f);
+
+  // The intersection of disjoint solids is empty
+  stats = GetSolidStats(
+    a->intersect(*b)->buildMeshGeometry("intersect", _scene.get(), false));
+  EXPECT_EQ(stats.vertexCount, 0ul);
+  EXPECT_EQ(stats.faceCount, 0ul);
+}
+
+TEST_F(TestCSG, InPlaceOperationsKeepTheOperand)
+{
+  auto a = CreateBox(0.f);
+  auto b = CreateBox(1.f);
+
+  a->subtractInPlace(*b);
+  auto stats = GetSolidStats(a->buildMeshGeometry("a", _scene.get(), false));
+  EXPECT_NEAR(stats.volume, 4.f, 1e-4f);
+
+  // The operand is not modified
+  stats = GetSolidStats(b->buildMeshGeometry("b", _scene.get(), false));
+  EXPECT_EQ(stats.faceCount, 12ul);
+  EXPECT_NEAR(stats.volume, 8.f, 1e-4f);
+  const auto bounds = b->getBounds();
+  EXPECT_TRUE(bounds.min.equalsWithEpsilon(BABYLON::Vector3(0.f, -1.f, -1.f)));
+  EXPECT_TRUE(bounds.max.equalsWithEpsilon(BABYLON::Vector3(2.f, 1.f, 1.f)));
+}
+
+TEST_F(TestCSG, LargeSolidsAreSplitInTaskArenas)
+{
+  using namespace BABYLON;
+
+  // Spheres with enough polygons for their BSP trees to be clipped by several
+  // tasks
+  auto sphereA          = Mesh::CreateSphere("a", 12, 2.f, _scene.get());
+  auto sphereB          = Mesh::CreateSphere("b", 12, 2.f, _scene.get());
+  sphereB->position().x = 1.f;
+  auto a                = CSG::CSG::FromMesh(sphereA);
+  auto b                = CSG::CSG::FromMesh(sphereB);
+
+  const auto volumeA
+    = GetSolidStats(a->buildMeshGeometry("a", _scene.get(), false)).volume;
+  const auto volumeB
+    = GetSolidStats(b->buildMeshGeometry("b", _scene.get(), false)).volume;
+  const auto unionVolume
+    = GetSolidStats(
+        a->_union(*b)->buildMeshGeometry("union", _scene.get(), false))
+        .volume;
+  const auto intersectVolume
+    = GetSolidStats(
+        a->intersect(*b)->buildMeshGeometry("intersect", _scene.get(), false))
+        .volume;
+  EXPECT_NEAR(unionVolume, volumeA + volumeB - intersectVolume, 1e-3f);
+
+  // The operands are copied, not flipped by the BSP trees
+  EXPECT_NEAR(
+    GetSolidStats(b->buildMeshGeometry("b", _scene.get(), false)).volume,
+    volumeB, 1e-4f);
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/geometry.h>
+#include <babylon/mesh/index_optimizer.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/mesh/vertex_data.h>
+
+#include "../helpers/null_canvas.h"
+
+namespace {
+
+constexpr size_t GridSize = 32;
+
+// Grid of GridSize x GridSize quads, with 3 vertices per triangle, and the
+// triangles in a shuffled order
+std::unique_ptr<BABYLON::VertexData> createTriangleSoup()
+{
+  auto vertexData = std::make_unique<BABYLON::VertexData>();
+  std::vector<std::array<float, 3>> corners;
+  for (size_t y = 0; y < GridSize; ++y) {
+    for (size_t x = 0; x < GridSize; ++x) {
+      const float x0 = static_cast<float>(x), y0 = static_cast<float>(y);
+      for (const auto& corner : {std::array<float, 3>{{x0, y0, 0.f}},
+                                 std::array<float, 3>{{x0 + 1, y0, 0.f}},
+                                 std::array<float, 3>{{x0 + 1, y0 + 1, 0.f}},
+                                 std::array<float, 3>{{x0, y0, 0.f}},
+                                 std::array<float, 3>{{x0 + 1, y0 + 1, 0.f}},
+                                 std::array<float, 3>{{x0, y0 + 1, 0.f}}}) {
+        corners.emplace_back(corner);
+      }
+    }
+  }
+
+  const size_t triangleCount = corners.size() / 3;
+  std::vector<size_t> order(triangleCount);
+  for (size_t t = 0; t < triangleCount; ++t) {
+    order[t] = (t * 7919) % triangleCount;
+  }
+  for (auto t : order) {
+    for (size_t c = 0; c < 3; ++c) {
+      const auto& corner = corners[t * 3 + c];
+      vertexData->indices.emplace_back(
+        static_cast<uint32_t>(vertexData->positions.size() / 3));
+      vertexData->positions.insert(vertexData->positions.end(), corner.begin(),
+                                   corner.end());
+      vertexData->uvs.emplace_back(corner[0] / GridSize);
+      vertexData->uvs.emplace_back(corner[1] / GridSize);
+    }
+  }
+
+  return vertexData;
+}
+
+// Sorted triangles, as sorted vertex positions
+std::vector<std::array<float, 9>>
+triangles(const BABYLON::VertexData& vertexData, size_t start, size_t count)
+{
+  std::vector<std::array<float, 9>> result;
+  for (size_t i = start; i < start + count; i += 3) {
+    std::array<std::array<float, 3>, 3> corners;
+    for (size_t c = 0; c < 3; ++c) {
+      const auto v = vertexData.indices[i + c];
+      corners[c]   = {{vertexData.positions[v * 3],
+                     vertexData.positions[v * 3 + 1],
+                     vertexData.positions[v * 3 + 2]}};
+    }
+    std::sort(corners.begin(), corners.end());
+    std::array<float, 9> triangle;
+    for (size_t c = 0; c < 9; ++c) {
+      triangle[c] = corners[c / 3][c % 3];
+    }
+    result.emplace_back(triangle);
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+} // end of anonymous namespace
+
+TEST(TestIndexOptimizer, Weld_and_reorder)
+{
+  using namespace BABYLON;
+
+  auto vertexData            = createTriangleSoup();
+  const auto original        = triangles(*vertexData, 0,
+                                         vertexData->indices.size());
+  const size_t triangleCount = GridSize * GridSize * 2;
+
+  IndexOptimizer optimizer;
+  const auto stats = optimizer.optimize(*vertexData);
+  EXPECT_EQ(stats.triangleCount, triangleCount);
+  EXPECT_EQ(stats.vertexCountBefore, triangleCount * 3);
+  EXPECT_EQ(stats.vertexCountAfter, (GridSize + 1) * (GridSize + 1));
+  EXPECT_EQ(IndexOptimizer::VertexCount(*vertexData), stats.vertexCountAfter);
+  EXPECT_EQ(vertexData->uvs.size(), stats.vertexCountAfter * 2);
+  EXPECT_TRUE(stats.uses16BitIndices);
+
+  // Each triangle transforms its 3 vertices before, the grid is close to the
+  // optimum (0.5 per triangle) after
+  EXPECT_FLOAT_EQ(stats.acmrBefore, 3.f);
+  EXPECT_FLOAT_EQ(stats.atvrBefore, 1.f);
+  EXPECT_LT(stats.acmrAfter, 1.f);
+  EXPECT_LT(stats.atvrAfter, 2.f);
+
+  // Same triangles
+  EXPECT_EQ(triangles(*vertexData, 0, vertexData->indices.size()), original);
+
+  // Vertices in order of first use
+  uint32_t next = 0;
+  for (auto index : vertexData->indices) {
+    EXPECT_LE(index, next);
+    if (index == next) {
+      ++next;
+    }
+  }
+}
+
+TEST(TestIndexOptimizer, Ranges_are_preserved)
+{
+  using namespace BABYLON;
+
+  auto vertexData    = createTriangleSoup();
+  const size_t split = (vertexData->indices.size() / 3 / 3) * 3;
+  const size_t size  = vertexData->indices.size();
+  const auto first   = triangles(*vertexData, 0, split);
+  const auto second  = triangles(*vertexData, split, size - split);
+
+  IndexOptimizer optimizer;
+  const auto stats
+    = optimizer.optimize(*vertexData, {{0, split}, {split, size - split}});
+  EXPECT_LT(stats.acmrAfter, stats.acmrBefore);
+  EXPECT_EQ(triangles(*vertexData, 0, split), first);
+  EXPECT_EQ(triangles(*vertexData, split, size - split), second);
+}
+
+TEST(TestIndexOptimizer, Vertex_cache)
+{
+  using namespace BABYLON;
+
+  auto vertexData = createTriangleSoup();
+  IndexOptimizer::WeldVertices(*vertexData);
+  const size_t vertexCount = IndexOptimizer::VertexCount(*vertexData);
+  EXPECT_EQ(vertexCount, (GridSize + 1) * (GridSize + 1));
+
+  float acmrBefore, atvrBefore, acmrAfter, atvrAfter;
+  IndexOptimizer::AnalyzeVertexCache(vertexData->indices, vertexCount, 16,
+                                     acmrBefore, atvrBefore);
+  IndexOptimizer::OptimizeVertexCache(
+    vertexData->indices, {0, vertexData->indices.size()}, vertexCount, 16);
+  IndexOptimizer::AnalyzeVertexCache(vertexData->indices, vertexCount, 16,
+                                     acmrAfter, atvrAfter);
+  EXPECT_GT(acmrBefore, 2.f);
+  EXPECT_LT(acmrAfter, 1.f);
+  EXPECT_LT(atvrAfter, atvrBefore);
+}
+
+TEST(TestIndexOptimizer, Stale_async_result_is_dropped)
+{
+  using namespace BABYLON;
+
+  NullCanvas canvas;
+  auto engine = Engine::New(&canvas);
+  auto scene  = Scene::New(engine.get());
+  auto sphere = Mesh::CreateSphere("sphere", 16, 2.f, scene.get(), true);
+  const auto waitForIndexOptimization = [sphere]() {
+    while (!sphere->_applyIndexOptimization()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  };
+
+  // Applied when the geometry did not change
+  auto revision = sphere->geometry()->revision();
+  sphere->optimizeIndices(nullptr);
+  waitForIndexOptimization();
+  EXPECT_GT(sphere->geometry()->revision(), revision);
+
+  // Same vertex and index counts, but new positions
+  const auto indices = sphere->getIndices();
+  auto positions     = sphere->getVerticesData(VertexBuffer::PositionKind);
+  bool completed     = false;
+  sphere->optimizeIndices([&completed](Mesh*) { completed = true; });
+  for (auto& coordinate : positions) {
+    coordinate *= 2.f;
+  }
+  revision = sphere->geometry()->revision();
+  sphere->updateVerticesData(VertexBuffer::PositionKind, positions);
+  EXPECT_GT(sphere->geometry()->revision(), revision);
+
+  waitForIndexOptimization();
+  EXPECT_TRUE(completed);
+  EXPECT_EQ(sphere->getVerticesData(VertexBuffer::PositionKind), positions);
+  EXPECT_EQ(sphere->getIndices(), indices);
+
+  engine->dispose();
+  scene.reset(nullptr);
+  engine.reset(nullptr);
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/tools/observable.h>
+
+#include "../helpers/recording_gl_rendering_context.h"
+
+namespace {
+
+class TestInstancing : public ::testing::Test {
+
+protected:
+  using DrawCall = BABYLON::GL::RecordingGLRenderingContext::DrawCall;
+
+  void SetUp() override
+  {
+    using namespace BABYLON;
+    auto gl = std::make_unique<GL::RecordingGLRenderingContext>();
+    _gl     = gl.get();
+    _canvas = std::make_unique<NullCanvas>(std::move(gl));
+    _engine = Engine::New(_canvas.get());
+    _engine->getCaps().instancedArrays = true;
+    _scene                              = Scene::New(_engine.get());
+    _scene->setAutoInstancing(true);
+    auto camera = FreeCamera::New("camera", Vector3(1.5f, 5.f, -20.f),
+                                  _scene.get());
+    camera->setTarget(Vector3(1.5f, 0.f, 0.f));
+    _scene->activeCamera = camera;
+  }
+
+  void TearDown() override
+  {
+    _engine->dispose();
+    _scene.reset(nullptr);
+    _engine.reset(nullptr);
+    _canvas.reset(nullptr);
+  }
+
+  // Clone of the given mesh, sharing its geometry, at the given x position
+  BABYLON::Mesh* Clone(BABYLON::Mesh* mesh, float x,
+                       BABYLON::Material* material)
+  {
+    auto clone          = mesh->clone(mesh->name + "_clone");
+    clone->position().x = x;
+    clone->setMaterial(material);
+    return clone;
+  }
+
+  // Renders a frame and returns its instanced draw calls
+  std::vector<DrawCall> RenderFrame()
+  {
+    _gl->drawCalls.clear();
+    _gl->uploads.clear();
+    _scene->render();
+
+    std::vector<DrawCall> instancedDrawCalls;
+    for (const auto& drawCall : _gl->drawCalls) {
+      if (drawCall.instanceCount > 0) {
+        instancedDrawCalls.emplace_back(drawCall);
+      }
+    }
+    return instancedDrawCalls;
+  }
+
+  // Translations on x of the instances of a draw call, read from the instance
+  // world matrices bound at draw time
+  std::multiset<float> InstancePositions(const DrawCall& drawCall)
+  {
+    std::multiset<float> positions;
+    for (size_t i = 0; i < static_cast<size_t>(drawCall.instanceCount); ++i) {
+      positions.insert(_gl->attributeValue(drawCall, "world3", i, 0));
+    }
+    return positions;
+  }
+
+  BABYLON::GL::RecordingGLRenderingContext* _gl;
+  std::unique_ptr<BABYLON::NullCanvas> _canvas;
+  std::unique_ptr<BABYLON::Engine> _engine;
+  std::unique_ptr<BABYLON::Scene> _scene;
+
+}; // end of class TestInstancing
+
+} // end of namespace
+
+TEST_F(TestInstancing, LeadersSharingAGeometryDrawTheirOwnInstances)
+{
+  using namespace BABYLON;
+
+  auto red   = StandardMaterial::New("red", _scene.get());
+  auto green = StandardMaterial::New("green", _scene.get());
+  auto box   = Mesh::CreateBox("box", 0.5f, _scene.get());
+  box->setMaterial(red);
+  Clone(box, 1.f, red);
+  Clone(box, 2.f, green);
+  auto moved = Clone(box, 3.f, green);
+
+  // One instanced draw per material, both with the same geometry and effect
+  for (unsigned int frame = 0; frame < 3; ++frame) {
+    const auto drawCalls = RenderFrame();
+    ASSERT_EQ(drawCalls.size(), 2ul);
+    std::set<std::multiset<float>> positions{InstancePositions(drawCalls[0]),
+                                             InstancePositions(drawCalls[1])};
+    EXPECT_EQ(positions, (std::set<std::multiset<float>>{{0.f, 1.f},
+                                                         {2.f, 3.f}}));
+    EXPECT_NE(drawCalls[0].attributes.at("world0").buffer,
+              drawCalls[1].attributes.at("world0").buffer);
+  }
+
+  // Only the slot of the moved mesh is uploaded
+  moved->position().x = 5.f;
+  const auto drawCalls = RenderFrame();
+  ASSERT_EQ(drawCalls.size(), 2ul);
+  std::set<std::multiset<float>> positions{InstancePositions(drawCalls[0]),
+                                           InstancePositions(drawCalls[1])};
+  EXPECT_EQ(positions, (std::set<std::multiset<float>>{{0.f, 1.f},
+                                                       {2.f, 5.f}}));
+  ASSERT_EQ(_gl->uploads.size(), 1ul);
+  EXPECT_EQ(_gl->uploads[0].floatCount, 16ul);
+
+  // Nothing is uploaded when the instances did not change
+  RenderFrame();
+  EXPECT_TRUE(_gl->uploads.empty());
+}
+
+TEST_F(TestInstancing, RegisteredInstancedBuffer)
+{
+  using namespace BABYLON;
+
+  auto material = StandardMaterial::New("material", _scene.get());
+  auto box      = Mesh::CreateBox("box", 0.5f, _scene.get());
+  box->setMaterial(material);
+  box->registerInstancedBuffer(VertexBuffer::InstanceColorKind, 4);
+  box->instancedBuffers[VertexBuffer::InstanceColorKind] = {1.f, 0.f, 0.f, 1.f};
+  auto clone = Clone(box, 1.f, material);
+  clone->instancedBuffers[VertexBuffer::InstanceColorKind]
+    = {0.f, 0.f, 1.f, 1.f};
+
+  // The colors follow the world matrix of each instance
+  auto drawCalls = RenderFrame();
+  ASSERT_EQ(drawCalls.size(), 1ul);
+  ASSERT_EQ(drawCalls[0].instanceCount, 2);
+  EXPECT_EQ(drawCalls[0].attributes.at("world0").stride, 20 * 4);
+  for (size_t i = 0; i < 2; ++i) {
+    const auto x = _gl->attributeValue(drawCalls[0], "world3", i, 0);
+    EXPECT_FLOAT_EQ(_gl->attributeValue(drawCalls[0], "world0", i, 16),
+                    x == 0.f ? 1.f : 0.f);
+    EXPECT_FLOAT_EQ(_gl->attributeValue(drawCalls[0], "world0", i, 18),
+                    x == 0.f ? 0.f : 1.f);
+  }
+
+  // Changing a color only uploads its slot
+  clone->instancedBuffers[VertexBuffer::InstanceColorKind]
+    = {0.f, 1.f, 0.f, 1.f};
+  drawCalls = RenderFrame();
+  ASSERT_EQ(drawCalls.size(), 1ul);
+  ASSERT_EQ(_gl->uploads.size(), 1ul);
+  EXPECT_EQ(_gl->uploads[0].floatCount, 20ul);
+  for (size_t i = 0; i < 2; ++i) {
+    const auto x = _gl->attributeValue(drawCalls[0], "world3", i, 0);
+    EXPECT_FLOAT_EQ(_gl->attributeValue(drawCalls[0], "world0", i, 17),
+                    x == 0.f ? 0.f : 1.f);
+  }
+}
+
+TEST_F(TestInstancing, AutomaticInstancingGroups)
+{
+  using namespace BABYLON;
+
+  auto material = StandardMaterial::New("material", _scene.get());
+  auto box      = Mesh::CreateBox("box", 0.5f, _scene.get());
+  box->setMaterial(material);
+  Clone(box, 1.f, material);
+  Clone(box, 2.f, material);
+
+  // Meshes sharing geometry and material are grouped
+  auto drawCalls = RenderFrame();
+  ASSERT_EQ(drawCalls.size(), 1ul);
+  EXPECT_EQ(drawCalls[0].instanceCount, 3);
+  EXPECT_EQ(_gl->drawCalls.size(), 1ul);
+
+  // Different layer mask, rendered on its own
+  auto masked       = Clone(box, 3.f, material);
+  masked->layerMask = 0x0FFFFFFE;
+  drawCalls         = RenderFrame();
+  ASSERT_EQ(drawCalls.size(), 1ul);
+  EXPECT_EQ(drawCalls[0].instanceCount, 3);
+  EXPECT_EQ(_gl->drawCalls.size(), 2ul);
+
+  // Meshes with render observers are never grouped
+  auto observed = Clone(box, 4.f, material);
+  observed->onBeforeRenderObservable.add([](Mesh*, BABYLON::EventState&) {});
+  drawCalls = RenderFrame();
+  ASSERT_EQ(drawCalls.size(), 1ul);
+  EXPECT_EQ(drawCalls[0].instanceCount, 3);
+  EXPECT_EQ(_gl->drawCalls.size(), 3ul);
+
+  // Disabled automatic instancing
+  _scene->setAutoInstancing(false);
+  drawCalls = RenderFrame();
+  EXPECT_TRUE(drawCalls.empty());
+  EXPECT_EQ(_gl->drawCalls.size(), 5ul);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/static_batch_range.h>
+#include <babylon/mesh/static_batching.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+#include "../helpers/recording_gl_rendering_context.h"
+
+namespace {
+
+class TestStaticBatching : public ::testing::Test {
+
+protected:
+  using GLsizei = BABYLON::GL::GLsizei;
+
+  void SetUp() override
+  {
+    using namespace BABYLON;
+    auto gl = std::make_unique<GL::RecordingGLRenderingContext>();
+    _gl     = gl.get();
+    _canvas = std::make_unique<NullCanvas>(std::move(gl));
+    _engine = Engine::New(_canvas.get());
+    _scene  = Scene::New(_engine.get());
+    auto camera
+      = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), _scene.get());
+    camera->setTarget(Vector3::Zero());
+    _scene->activeCamera = camera;
+    _material            = StandardMaterial::New("material", _scene.get());
+  }
+
+  void TearDown() override
+  {
+    _engine->dispose();
+    _scene.reset(nullptr);
+    _engine.reset(nullptr);
+    _canvas.reset(nullptr);
+  }
+
+  // Hides the source meshes once merged, the draw calls being the ones of the
+  // merged meshes only
+  void HideSources(const std::vector<BABYLON::Mesh*>& meshes)
+  {
+    for (auto& mesh : meshes) {
+      mesh->setEnabled(false);
+    }
+  }
+
+  // Box of the test material at the given x position
+  BABYLON::Mesh* CreateBox(const std::string& name, float x)
+  {
+    auto box          = BABYLON::Mesh::CreateBox(name, 1.f, _scene.get());
+    box->position().x = x;
+    box->setMaterial(_material);
+    return box;
+  }
+
+  // Renders a few frames (until the effects are ready) and returns the index
+  // count of each draw call of the last one
+  std::vector<GLsizei> RenderFrames()
+  {
+    std::vector<GLsizei> counts;
+    for (unsigned int frame = 0; frame < 3; ++frame) {
+      _gl->drawCalls.clear();
+      _scene->render();
+    }
+    for (const auto& drawCall : _gl->drawCalls) {
+      counts.emplace_back(drawCall.count);
+    }
+    return counts;
+  }
+
+  BABYLON::GL::RecordingGLRenderingContext* _gl;
+  std::unique_ptr<BABYLON::NullCanvas> _canvas;
+  std::unique_ptr<BABYLON::Engine> _engine;
+  std::unique_ptr<BABYLON::Scene> _scene;
+  BABYLON::StandardMaterial* _material;
+
+}; // end of class TestStaticBatching
+
+} // end of namespace
+
+TEST_F(TestStaticBatching, FrozenBatchCullsItsSourcesIndividually)
+{
+  using namespace BABYLON;
+
+  std::vector<Mesh*> boxes{CreateBox("box0", -1.f), CreateBox("box1", 1.f),
+                           CreateBox("far", 1000.f)};
+
+  StaticBatching staticBatching;
+  staticBatching.disposeSource = false;
+  const auto batches           = staticBatching.apply(boxes);
+  HideSources(boxes);
+  ASSERT_EQ(batches.size(), 1ul);
+  auto batch = batches.front();
+  EXPECT_TRUE(batch->isWorldMatrixFrozen());
+  ASSERT_EQ(batch->staticBatchRanges().size(), 3ul);
+  EXPECT_EQ(batch->getTotalIndices(), 3 * 36ul);
+
+  // The contiguous visible boxes are drawn together, the far one is culled
+  EXPECT_EQ(RenderFrames(), std::vector<GLsizei>{2 * 36});
+
+  // Once moved, the world space ranges are stale and the batch is drawn whole
+  batch->unfreezeWorldMatrix();
+  batch->setPosition(Vector3(-1000.f, 0.f, 0.f));
+  EXPECT_EQ(RenderFrames(), std::vector<GLsizei>{3 * 36});
+}
+
+TEST_F(TestStaticBatching, BucketsFilledInParallelMatchASingleThreadFill)
+{
+  using namespace BABYLON;
+
+  // Two boxes per spatial cell, batched on one and on several threads
+  std::vector<Mesh*> serialBoxes, parallelBoxes;
+  for (unsigned int i = 0; i < 16; ++i) {
+    const auto x = static_cast<float>(i) * 5.f;
+    serialBoxes.emplace_back(CreateBox("serial" + std::to_string(i), x));
+    parallelBoxes.emplace_back(CreateBox("parallel" + std::to_string(i), x));
+  }
+
+  StaticBatching serialBatching;
+  serialBatching.cellSize      = 10.f;
+  serialBatching.maxThreads    = 1;
+  serialBatching.disposeSource = false;
+  const auto serialBatches     = serialBatching.apply(serialBoxes);
+
+  StaticBatching parallelBatching;
+  parallelBatching.cellSize      = 10.f;
+  parallelBatching.maxThreads    = 4;
+  parallelBatching.disposeSource = false;
+  const auto parallelBatches     = parallelBatching.apply(parallelBoxes);
+
+  ASSERT_EQ(serialBatches.size(), 8ul);
+  ASSERT_EQ(parallelBatches.size(), serialBatches.size());
+  for (size_t b = 0; b < serialBatches.size(); ++b) {
+    EXPECT_EQ(parallelBatches[b]->getIndices(), serialBatches[b]->getIndices());
+    EXPECT_EQ(parallelBatches[b]->getVerticesData(VertexBuffer::PositionKind),
+              serialBatches[b]->getVerticesData(VertexBuffer::PositionKind));
+    EXPECT_EQ(parallelBatches[b]->staticBatchRanges().size(), 2ul);
+  }
+}
+
+TEST_F(TestStaticBatching, MergedMeshesAreNotCulledPerSource)
+{
+  using namespace BABYLON;
+
+  std::vector<Mesh*> boxes{CreateBox("box0", -1.f), CreateBox("box1", 1.f),
+                           CreateBox("far", 1000.f)};
+  for (auto& box : boxes) {
+    box->setVerticesData(VertexBuffer::MatricesIndicesKind,
+                         Float32Array(box->getTotalVertices() * 4, 0.f));
+    box->setVerticesData(VertexBuffer::MatricesWeightsKind,
+                         Float32Array(box->getTotalVertices() * 4, 0.25f));
+  }
+
+  auto merged = Mesh::MergeMeshes(boxes, false, true, nullptr, true);
+  HideSources(boxes);
+  ASSERT_NE(merged, nullptr);
+  EXPECT_TRUE(merged->staticBatchRanges().empty());
+  EXPECT_FALSE(merged->isWorldMatrixFrozen());
+  EXPECT_EQ(merged->subMeshes.size(), 3ul);
+
+  // The skinning data is merged with the other vertex kinds
+  EXPECT_TRUE(merged->isVerticesDataPresent(VertexBuffer::MatricesIndicesKind));
+  EXPECT_TRUE(merged->isVerticesDataPresent(VertexBuffer::MatricesWeightsKind));
+
+  // The sub meshes are culled against the bounds of the merged mesh
+  merged->setPosition(Vector3(-1000.f, 0.f, 0.f));
+  EXPECT_EQ(RenderFrames(), (std::vector<GLsizei>{36}));
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <babylon/mesh/vertex_compression.h>
+
+TEST(TestVertexCompression, HalfFloat)
+{
+  using namespace BABYLON;
+
+  for (float value : {0.f, 1.f, -2.f, 0.5f, 65504.f, 0.25f, -0.375f}) {
+    EXPECT_EQ(VertexCompression::HalfToFloat(
+                VertexCompression::FloatToHalf(value)),
+              value);
+  }
+  EXPECT_EQ(VertexCompression::FloatToHalf(1.f), 0x3C00);
+  EXPECT_EQ(VertexCompression::FloatToHalf(-2.f), 0xC000);
+  // Smallest subnormal, overflow to infinity
+  EXPECT_EQ(VertexCompression::FloatToHalf(std::ldexp(1.f, -24)), 0x0001);
+  EXPECT_EQ(VertexCompression::FloatToHalf(1e6f), 0x7C00);
+  // Rounded to the nearest even value
+  EXPECT_EQ(VertexCompression::FloatToHalf(1.f + std::ldexp(1.f, -11)),
+            0x3C00);
+  EXPECT_EQ(VertexCompression::FloatToHalf(1.f + 3.f * std::ldexp(1.f, -11)),
+            0x3C02);
+
+  // Every half float is decoded and encoded back to itself
+  for (uint32_t half = 0; half < 0x7C00; ++half) {
+    const auto value = static_cast<uint16_t>(half);
+    EXPECT_EQ(VertexCompression::FloatToHalf(
+                VertexCompression::HalfToFloat(value)),
+              value);
+  }
+}
+
+TEST(TestVertexCompression, Octahedral)
+{
+  using namespace BABYLON;
+
+  const Float32Array normals{1.f,  0.f,   0.f, 0.f,    0.f,  -1.f,
+                             0.6f, -0.8f, 0.f, -0.48f, 0.6f, -0.64f,
+                             0.f,  0.f,   1.f, 0.36f,  0.48f, -0.8f};
+  const auto packed
+    = VertexCompression::Encode(VertexCompression::Octahedral16, normals, 3);
+  EXPECT_EQ(packed.size(), 12u);
+
+  const auto decoded
+    = VertexCompression::Decode(VertexCompression::Octahedral16, packed, 3);
+  ASSERT_EQ(decoded.size(), normals.size());
+  for (size_t i = 0; i < normals.size(); ++i) {
+    EXPECT_NEAR(decoded[i], normals[i], 1e-4f);
+  }
+
+  // Handedness of the tangents
+  const Float32Array tangents{0.f, 1.f, 0.f, -1.f, 0.f, 0.f, 1.f, 1.f};
+  const auto decodedTangents = VertexCompression::Decode(
+    VertexCompression::Octahedral16,
+    VertexCompression::Encode(VertexCompression::Octahedral16, tangents, 4),
+    4);
+  ASSERT_EQ(decodedTangents.size(), tangents.size());
+  EXPECT_FLOAT_EQ(decodedTangents[3], -1.f);
+  EXPECT_FLOAT_EQ(decodedTangents[7], 1.f);
+  EXPECT_NEAR(decodedTangents[1], 1.f, 1e-4f);
+  EXPECT_NEAR(decodedTangents[6], 1.f, 1e-4f);
+}
+
+TEST(TestVertexCompression, Positions_and_colors)
+{
+  using namespace BABYLON;
+
+  const Float32Array positions{-1.f, 2.f, 3.f, 3.f, 2.5f, 4.f, 0.f, 2.f, 5.f};
+  const auto cube = VertexCompression::ComputeQuantizationCube(positions);
+  EXPECT_FLOAT_EQ(cube[0], -1.f);
+  EXPECT_FLOAT_EQ(cube[1], 2.f);
+  EXPECT_FLOAT_EQ(cube[2], 3.f);
+  EXPECT_FLOAT_EQ(cube[3], 4.f);
+
+  const auto packed = VertexCompression::Encode(VertexCompression::Unorm16,
+                                                positions, 3, cube);
+  // Vertices aligned on 4 bytes
+  EXPECT_EQ(packed.size(), 12u);
+  EXPECT_EQ(packed[0], 0u);
+  EXPECT_EQ(packed[4], 65535u);
+  const auto decoded
+    = VertexCompression::Decode(VertexCompression::Unorm16, packed, 3, cube);
+  ASSERT_EQ(decoded.size(), positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    EXPECT_NEAR(decoded[i], positions[i], cube[3] / 65535.f);
+  }
+
+  const Float32Array colors{1.f, 0.f, 0.5f, 1.f};
+  const auto packedColors
+    = VertexCompression::Encode(VertexCompression::Unorm8, colors, 4);
+  ASSERT_EQ(packedColors.size(), 2u);
+  EXPECT_EQ(packedColors[0], 0x00FF);
+  EXPECT_EQ(packedColors[1], 0xFF80);
+  const auto decodedColors
+    = VertexCompression::Decode(VertexCompression::Unorm8, packedColors, 4);
+  EXPECT_FLOAT_EQ(decodedColors[2], 128.f / 255.f);
+  EXPECT_FLOAT_EQ(decodedColors[3], 1.f);
+}
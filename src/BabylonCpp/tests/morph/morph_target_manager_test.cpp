@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+#include <babylon/morph/morph_target.h>
+#include <babylon/morph/morph_target_manager.h>
+
+#include "../helpers/null_canvas.h"
+
+namespace {
+
+class TestMorphTargetManager : public ::testing::Test {
+
+protected:
+  void SetUp() override
+  {
+    using namespace BABYLON;
+    _canvas = std::make_unique<NullCanvas>();
+    _engine = Engine::New(_canvas.get());
+    _scene  = Scene::New(_engine.get());
+  }
+
+  void TearDown() override
+  {
+    _engine->dispose();
+    _scene.reset(nullptr);
+    _engine.reset(nullptr);
+    _canvas.reset(nullptr);
+  }
+
+  // Target moving every vertex of the base positions up by the given height
+  std::unique_ptr<BABYLON::MorphTarget>
+  CreateTarget(const BABYLON::Float32Array& basePositions, float height,
+               float influence)
+  {
+    BABYLON::Float32Array positions(basePositions);
+    for (size_t i = 1; i < positions.size(); i += 3) {
+      positions[i] += height;
+    }
+    auto target = std::make_unique<BABYLON::MorphTarget>("target", influence);
+    target->setPositions(positions);
+    return target;
+  }
+
+  // Checks the CPU blended positions against the base moved up by the height
+  void ExpectMorphedPositions(BABYLON::Mesh* mesh,
+                              const BABYLON::Float32Array& basePositions,
+                              float height)
+  {
+    ASSERT_TRUE(mesh->_generatePointsArray());
+    const auto& positions = mesh->_positions();
+    ASSERT_EQ(positions.size() * 3, basePositions.size());
+    for (size_t i = 0; i < positions.size(); ++i) {
+      EXPECT_FLOAT_EQ(positions[i].x, basePositions[i * 3]);
+      EXPECT_FLOAT_EQ(positions[i].y, basePositions[i * 3 + 1] + height);
+      EXPECT_FLOAT_EQ(positions[i].z, basePositions[i * 3 + 2]);
+    }
+  }
+
+  std::unique_ptr<BABYLON::NullCanvas> _canvas;
+  std::unique_ptr<BABYLON::Engine> _engine;
+  std::unique_ptr<BABYLON::Scene> _scene;
+
+}; // end of class TestMorphTargetManager
+
+} // end of namespace
+
+TEST_F(TestMorphTargetManager, MorphTargetKinds)
+{
+  using namespace BABYLON;
+
+  for (unsigned int index = 0; index < VertexBuffer::MaxMorphTargetInfluencers;
+       ++index) {
+    const auto indexStr = std::to_string(index);
+    const auto kinds
+      = {VertexBuffer::MorphTargetPositionKind + index,
+         VertexBuffer::MorphTargetNormalKind + index,
+         VertexBuffer::MorphTargetTangentKind + index};
+    const auto names
+      = {"position" + indexStr, "normal" + indexStr, "tangent" + indexStr};
+    auto name = names.begin();
+    for (auto kind : kinds) {
+      EXPECT_NE(kind, VertexBuffer::PositionKind);
+      EXPECT_NE(kind, VertexBuffer::NormalKind);
+      EXPECT_NE(kind, VertexBuffer::TangentKind);
+      EXPECT_EQ(VertexBuffer::KindAsString(kind), *name);
+      EXPECT_EQ(VertexBuffer::KindFromString(*name), kind);
+      EXPECT_EQ(VertexBuffer::KindToStride(kind), 3);
+      ++name;
+    }
+  }
+}
+
+TEST_F(TestMorphTargetManager, TargetsKeepTheBaseData)
+{
+  using namespace BABYLON;
+
+  auto box                 = Mesh::CreateBox("box", 2.f, _scene.get());
+  const auto basePositions = box->getVerticesData(VertexBuffer::PositionKind);
+  const auto baseNormals   = box->getVerticesData(VertexBuffer::NormalKind);
+
+  auto manager = MorphTargetManager::New(_scene.get());
+  manager->addTarget(CreateTarget(basePositions, 1.f, 0.25f));
+  manager->addTarget(CreateTarget(basePositions, 2.f, 0.5f));
+  box->setMorphTargetManager(manager);
+
+  // The targets have their own vertex buffers
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), basePositions);
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::NormalKind), baseNormals);
+  EXPECT_TRUE(
+    box->isVerticesDataPresent(VertexBuffer::MorphTargetPositionKind));
+  EXPECT_TRUE(
+    box->isVerticesDataPresent(VertexBuffer::MorphTargetPositionKind + 1));
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::MorphTargetPositionKind + 1),
+            manager->getTarget(1)->getPositions());
+
+  // Blended on the CPU from the unmorphed positions
+  ExpectMorphedPositions(box, basePositions, 0.25f * 1.f + 0.5f * 2.f);
+  manager->getTarget(0)->setInfluence(1.f);
+  ExpectMorphedPositions(box, basePositions, 1.f * 1.f + 0.5f * 2.f);
+
+  // Removing the manager only removes the buffers of the targets
+  box->setMorphTargetManager(nullptr);
+  EXPECT_FALSE(
+    box->isVerticesDataPresent(VertexBuffer::MorphTargetPositionKind));
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), basePositions);
+  ExpectMorphedPositions(box, basePositions, 0.f);
+}
+
+TEST_F(TestMorphTargetManager, CPUBlendMatchesTheGPUInfluencers)
+{
+  using namespace BABYLON;
+
+  auto box                 = Mesh::CreateBox("box", 2.f, _scene.get());
+  const auto basePositions = box->getVerticesData(VertexBuffer::PositionKind);
+
+  auto manager = MorphTargetManager::New(_scene.get());
+  manager->addTarget(CreateTarget(basePositions, 1.f, 0.1f));
+  manager->addTarget(CreateTarget(basePositions, 2.f, 0.5f));
+  manager->addTarget(CreateTarget(basePositions, 4.f, 0.3f));
+  box->setMorphTargetManager(manager);
+  EXPECT_EQ(manager->numInfluencers(), 3ul);
+  ExpectMorphedPositions(box, basePositions, 0.1f + 0.5f * 2.f + 0.3f * 4.f);
+
+  // Only the strongest targets are rendered, and picked
+  manager->setMaxGPUInfluencers(2);
+  ASSERT_EQ(manager->numInfluencers(), 2ul);
+  EXPECT_EQ(manager->getActiveTarget(0), manager->getTarget(1));
+  EXPECT_EQ(manager->getActiveTarget(1), manager->getTarget(2));
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::MorphTargetPositionKind),
+            manager->getTarget(1)->getPositions());
+  EXPECT_FALSE(
+    box->isVerticesDataPresent(VertexBuffer::MorphTargetPositionKind + 2));
+  ExpectMorphedPositions(box, basePositions, 0.5f * 2.f + 0.3f * 4.f);
+
+  // The active set follows the influences
+  manager->getTarget(0)->setInfluence(0.9f);
+  EXPECT_EQ(manager->getActiveTarget(0), manager->getTarget(0));
+  EXPECT_EQ(manager->getActiveTarget(1), manager->getTarget(1));
+  ExpectMorphedPositions(box, basePositions, 0.9f + 0.5f * 2.f);
+  EXPECT_EQ(box->getVerticesData(VertexBuffer::PositionKind), basePositions);
+}
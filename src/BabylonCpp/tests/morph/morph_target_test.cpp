@@ -0,0 +1,95 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/morph/morph_target.h>
+
+namespace {
+
+// 2 x 8 vertices grid, the target raises the vertices of the second row
+void makeTarget(BABYLON::Float32Array& basePositions,
+                BABYLON::Float32Array& targetPositions,
+                BABYLON::Float32Array& baseNormals,
+                BABYLON::Float32Array& targetNormals)
+{
+  for (unsigned int j = 0; j < 2; ++j) {
+    for (unsigned int i = 0; i < 8; ++i) {
+      const float x = static_cast<float>(i), z = static_cast<float>(j);
+      basePositions.insert(basePositions.end(), {x, 0.f, z});
+      targetPositions.insert(targetPositions.end(), {x, j * (i + 1.f), z});
+      baseNormals.insert(baseNormals.end(), {0.f, 1.f, 0.f});
+      targetNormals.insert(targetNormals.end(), {0.f, 1.f, j * 0.5f});
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestMorphTarget, MakeSparse)
+{
+  using namespace BABYLON;
+
+  Float32Array basePositions, targetPositions, baseNormals, targetNormals;
+  makeTarget(basePositions, targetPositions, baseNormals, targetNormals);
+
+  MorphTarget target("target", 0.5f);
+  target.setPositions(targetPositions);
+  target.setNormals(targetNormals);
+  // The normals can not be converted without their base data
+  EXPECT_FALSE(target.makeSparse(basePositions));
+  EXPECT_FALSE(target.isSparse());
+
+  EXPECT_TRUE(target.makeSparse(basePositions, baseNormals));
+  EXPECT_TRUE(target.isSparse());
+  EXPECT_TRUE(target.getPositions().empty());
+  EXPECT_TRUE(target.hasNormals());
+  EXPECT_FALSE(target.hasTangents());
+  EXPECT_EQ(target.vertexCount(), 16u);
+  EXPECT_EQ(target.sparseIndices(),
+            Uint32Array({8, 9, 10, 11, 12, 13, 14, 15}));
+  EXPECT_EQ(target.positionDeltas().size(), 8u * 3u);
+  EXPECT_EQ(target.normalDeltas().size(), 8u * 3u);
+
+  // Expanded back to dense data
+  EXPECT_EQ(target.densePositions(basePositions), targetPositions);
+  EXPECT_EQ(target.denseNormals(baseNormals), targetNormals);
+  EXPECT_TRUE(target.denseTangents(Float32Array()).empty());
+
+  // Back to a dense target
+  target.setPositions(targetPositions);
+  EXPECT_FALSE(target.isSparse());
+  EXPECT_FALSE(target.hasNormals());
+}
+
+TEST(TestMorphTarget, Accumulate)
+{
+  using namespace BABYLON;
+
+  Float32Array basePositions, targetPositions, baseNormals, targetNormals;
+  makeTarget(basePositions, targetPositions, baseNormals, targetNormals);
+
+  MorphTarget dense("dense", 0.25f);
+  dense.setPositions(targetPositions);
+  MorphTarget sparse("sparse", 0.5f);
+  sparse.setPositions(targetPositions);
+  ASSERT_TRUE(sparse.makeSparse(basePositions));
+  MorphTarget inactive("inactive", 0.f);
+  inactive.setPositions(targetPositions);
+
+  Float32Array blended(basePositions);
+  dense.accumulatePositions(basePositions, blended);
+  sparse.accumulatePositions(basePositions, blended);
+  inactive.accumulatePositions(basePositions, blended);
+  ASSERT_EQ(blended.size(), basePositions.size());
+  for (size_t i = 0; i < blended.size(); ++i) {
+    const float expected
+      = basePositions[i] + 0.75f * (targetPositions[i] - basePositions[i]);
+    EXPECT_FLOAT_EQ(blended[i], expected) << i;
+  }
+
+  // Sparse accumulation of the last vertex, and of unsorted indices
+  Float32Array result(9, 1.f);
+  MorphTarget::AccumulateSparse({2, 0}, {1.f, 2.f, 3.f, 4.f, 5.f, 6.f}, 2.f,
+                                result);
+  EXPECT_EQ(result, Float32Array({9.f, 11.f, 13.f, 1.f, 1.f, 1.f, 3.f, 5.f,
+                                  7.f}));
+}
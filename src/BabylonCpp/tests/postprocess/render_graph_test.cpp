@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/interfaces/igl_rendering_context.h>
+#include <babylon/postprocess/rendergraph/render_graph.h>
+
+namespace {
+
+// Headless texture allocator counting the live textures
+struct TextureAllocator {
+  std::vector<std::unique_ptr<BABYLON::GL::IGLTexture>> textures;
+  unsigned int nextValue = 1;
+
+  BABYLON::RenderGraph::CreateTextureFunc create()
+  {
+    return [this](const BABYLON::RenderGraphTextureDescription& description) {
+      auto texture     = std::make_unique<BABYLON::GL::IGLTexture>(nextValue);
+      texture->_width  = description.width;
+      texture->_height = description.height;
+      auto glTexture   = texture.get();
+      ++nextValue;
+      textures.emplace_back(std::move(texture));
+      return glTexture;
+    };
+  }
+
+  BABYLON::RenderGraph::ReleaseTextureFunc release()
+  {
+    return [this](BABYLON::GL::IGLTexture* texture) {
+      textures.erase(
+        std::remove_if(
+          textures.begin(), textures.end(),
+          [texture](const std::unique_ptr<BABYLON::GL::IGLTexture>& item) {
+            return item.get() == texture;
+          }),
+        textures.end());
+    };
+  }
+}; // end of struct TextureAllocator
+
+BABYLON::RenderGraphTextureDescription description(int width, int height)
+{
+  BABYLON::RenderGraphTextureDescription result;
+  result.width  = width;
+  result.height = height;
+  return result;
+}
+
+// Post process chain: the scene is rendered in the first texture, each post
+// process reads a texture and writes the next one, the last one writes the
+// back buffer
+std::vector<size_t> buildChain(BABYLON::RenderGraph& graph,
+                               size_t postProcessCount,
+                               std::vector<size_t>& passes)
+{
+  std::vector<size_t> textures;
+  for (size_t i = 0; i < postProcessCount; ++i) {
+    textures.emplace_back(
+      graph.createTexture("pp" + std::to_string(i), description(640, 480)));
+  }
+  const auto backBuffer = graph.importTexture("backBuffer", nullptr);
+
+  passes.emplace_back(graph.addPass("scene"));
+  graph.setSideEffect(passes.back());
+  graph.write(passes.back(), textures[0]);
+  for (size_t i = 0; i < postProcessCount; ++i) {
+    passes.emplace_back(graph.addPass("pp" + std::to_string(i)));
+    graph.read(passes.back(), textures[i]);
+    graph.write(passes.back(), (i + 1 < postProcessCount) ? textures[i + 1] :
+                                                            backBuffer);
+  }
+
+  return textures;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRenderGraph, Chain_aliasing)
+{
+  using namespace BABYLON;
+
+  TextureAllocator allocator;
+  RenderGraph graph(allocator.create(), allocator.release());
+  std::vector<size_t> passes;
+  const auto textures = buildChain(graph, 6, passes);
+  graph.compile();
+
+  // Two textures are alive at a time
+  EXPECT_EQ(graph.culledPassCount(), 0ull);
+  EXPECT_EQ(graph.transientTextureCount(), 6ull);
+  EXPECT_EQ(graph.physicalTextureCount(), 2ull);
+  EXPECT_EQ(graph.allocationCount(), 2ull);
+  EXPECT_EQ(allocator.textures.size(), 2ull);
+  EXPECT_LE(graph.allocatedBytes() * 2, graph.requestedBytes());
+  for (size_t i = 0; i + 1 < textures.size(); ++i) {
+    EXPECT_NE(graph.getTexture(textures[i]), nullptr);
+    EXPECT_NE(graph.getTexture(textures[i]), graph.getTexture(textures[i + 1]));
+  }
+  EXPECT_EQ(graph.getTexture(textures[0]), graph.getTexture(textures[2]));
+
+  // Rebuilding the same graph every frame does not allocate
+  for (unsigned int frame = 0; frame < 10; ++frame) {
+    graph.reset();
+    passes.clear();
+    buildChain(graph, 6, passes);
+    graph.compile();
+  }
+  EXPECT_EQ(graph.allocationCount(), 2ull);
+  EXPECT_EQ(allocator.textures.size(), 2ull);
+
+  graph.releaseTextures();
+  EXPECT_TRUE(allocator.textures.empty());
+}
+
+TEST(TestRenderGraph, Lifetimes_and_culling)
+{
+  using namespace BABYLON;
+
+  TextureAllocator allocator;
+  RenderGraph graph(allocator.create(), allocator.release());
+  std::vector<size_t> passes;
+  const auto textures = buildChain(graph, 4, passes);
+
+  // The last post process also reads the scene texture
+  graph.read(passes.back(), textures[0]);
+
+  // Unused branch, and a pass without outputs kept for its side effects
+  const auto unusedTexture = graph.createTexture("unused", description(64, 64));
+  const auto unusedPass    = graph.addPass("unused");
+  graph.read(unusedPass, textures[1]);
+  graph.write(unusedPass, unusedTexture);
+  const auto readback = graph.addPass("readback");
+  graph.read(readback, textures[2]);
+  graph.setSideEffect(readback);
+
+  unsigned int executed = 0;
+  const auto counted
+    = graph.addPass("counted", [&executed]() { ++executed; });
+  graph.setSideEffect(counted);
+
+  graph.compile();
+  EXPECT_TRUE(graph.isCulled(unusedPass));
+  EXPECT_FALSE(graph.isCulled(readback));
+  EXPECT_EQ(graph.getTexture(unusedTexture), nullptr);
+  EXPECT_EQ(graph.getLifetime(textures[0]),
+            std::make_pair(passes.front(), passes.back()));
+  EXPECT_EQ(graph.getLifetime(textures[2]),
+            std::make_pair(passes[2], readback));
+
+  // The scene texture is alive during the whole chain, the texture read back
+  // at the end cannot be aliased
+  EXPECT_EQ(graph.physicalTextureCount(), 3ull);
+  for (auto texture : textures) {
+    if (texture != textures[0]) {
+      EXPECT_NE(graph.getTexture(texture), graph.getTexture(textures[0]));
+    }
+  }
+  EXPECT_NE(graph.getTexture(textures[1]), graph.getTexture(textures[2]));
+  EXPECT_NE(graph.getTexture(textures[2]), graph.getTexture(textures[3]));
+
+  graph.execute();
+  EXPECT_EQ(executed, 1u);
+}
+
+TEST(TestRenderGraph, Pool_release)
+{
+  using namespace BABYLON;
+
+  TextureAllocator allocator;
+  RenderGraph graph(allocator.create(), allocator.release());
+  graph.poolLifetime = 1;
+
+  const auto buildFrame = [&graph](int width) {
+    graph.reset();
+    const auto texture = graph.createTexture("color", description(width, 32));
+    const auto pass    = graph.addPass("draw");
+    graph.write(pass, texture);
+    graph.setSideEffect(pass);
+    graph.compile();
+  };
+
+  buildFrame(32);
+  buildFrame(64);
+  EXPECT_EQ(allocator.textures.size(), 2ull);
+  buildFrame(64);
+  EXPECT_EQ(allocator.textures.size(), 1ull);
+  EXPECT_EQ(graph.allocationCount(), 2ull);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <babylon/rendering/render_target_scheduler.h>
+
+namespace {
+
+BABYLON::RenderTargetScheduler::Request request(float weight,
+                                                unsigned int cost,
+                                                unsigned int staleness,
+                                                bool required = false)
+{
+  return BABYLON::RenderTargetScheduler::Request{weight, cost, staleness,
+                                                 required};
+}
+
+} // end of anonymous namespace
+
+TEST(TestRenderTargetScheduler, Select_within_budget)
+{
+  using namespace BABYLON;
+
+  // Required depth map, two shadow maps and a mirror, ranked by weight
+  const std::vector<RenderTargetScheduler::Request> requests{
+    request(0.f, 1, 1, true), request(1.f, 1, 1), request(0.2f, 1, 1),
+    request(0.5f, 1, 1)};
+
+  unsigned int budget  = 3;
+  const auto selection = RenderTargetScheduler::Select(requests, budget);
+  EXPECT_EQ(selection, (std::vector<size_t>{0, 1, 3}));
+  EXPECT_EQ(budget, 0u);
+
+  // Required requests are selected without budget
+  budget = 0;
+  EXPECT_EQ(RenderTargetScheduler::Select(requests, budget),
+            (std::vector<size_t>{0}));
+}
+
+TEST(TestRenderTargetScheduler, Staleness_and_oversized_requests)
+{
+  using namespace BABYLON;
+
+  // A low priority render target not updated for long ranks first
+  std::vector<RenderTargetScheduler::Request> requests{
+    request(1.f, 1, 1), request(0.1f, 1, 30)};
+  unsigned int budget = 1;
+  EXPECT_EQ(RenderTargetScheduler::Select(requests, budget),
+            (std::vector<size_t>{1}));
+
+  // A whole cube (6 faces) ranking first is rendered alone, even over budget
+  requests = {request(1.f, 6, 4), request(1.f, 1, 1), request(1.f, 1, 1)};
+  budget   = 2;
+  EXPECT_EQ(RenderTargetScheduler::Select(requests, budget),
+            (std::vector<size_t>{0}));
+  EXPECT_EQ(budget, 0u);
+
+  // When ranking lower, the cheaper render targets fill the budget
+  requests[0].staleness = 1;
+  requests[0].weight    = 0.5f;
+  budget                = 2;
+  EXPECT_EQ(RenderTargetScheduler::Select(requests, budget),
+            (std::vector<size_t>{1, 2}));
+}
+
+TEST(TestRenderTargetScheduler, Round_robin)
+{
+  using namespace BABYLON;
+
+  // Four equal shadow maps and a budget of one face per frame: each one is
+  // updated every four frames
+  std::vector<unsigned int> lastFrames(4, 0);
+  std::vector<unsigned int> renderCounts(4, 0);
+  for (unsigned int frame = 1; frame <= 40; ++frame) {
+    std::vector<RenderTargetScheduler::Request> requests;
+    for (auto lastFrame : lastFrames) {
+      requests.emplace_back(request(1.f, 1, frame - lastFrame));
+    }
+    unsigned int budget  = 1;
+    const auto selection = RenderTargetScheduler::Select(requests, budget);
+    ASSERT_EQ(selection.size(), 1ull);
+    lastFrames[selection[0]] = frame;
+    ++renderCounts[selection[0]];
+  }
+
+  for (auto renderCount : renderCounts) {
+    EXPECT_EQ(renderCount, 10u);
+  }
+}
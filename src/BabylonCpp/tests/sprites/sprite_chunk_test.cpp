@@ -0,0 +1,82 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/sprites/sprite_chunk.h>
+
+namespace {
+
+// Frustum of the [-1, 1] cube, the plane normals point inside
+std::array<BABYLON::Plane, 6> unitCubeFrustum()
+{
+  using namespace BABYLON;
+  return {{Plane(1.f, 0.f, 0.f, 1.f), Plane(-1.f, 0.f, 0.f, 1.f),
+           Plane(0.f, 1.f, 0.f, 1.f), Plane(0.f, -1.f, 0.f, 1.f),
+           Plane(0.f, 0.f, 1.f, 1.f), Plane(0.f, 0.f, -1.f, 1.f)}};
+}
+
+} // end of anonymous namespace
+
+TEST(TestSpriteChunk, Build)
+{
+  using namespace BABYLON;
+
+  // 32 x 32 sprites grid, in row order
+  const size_t gridSize = 32, chunkSize = 64;
+  std::vector<Vector3> positions;
+  Float32Array radii;
+  for (size_t j = 0; j < gridSize; ++j) {
+    for (size_t i = 0; i < gridSize; ++i) {
+      positions.emplace_back(static_cast<float>(i), 0.f, static_cast<float>(j));
+      radii.emplace_back(0.5f);
+    }
+  }
+
+  std::vector<size_t> order;
+  const auto chunks = SpriteChunk::Build(positions, radii, chunkSize, order);
+  ASSERT_EQ(chunks.size(), gridSize * gridSize / chunkSize);
+  auto sortedOrder = order;
+  std::sort(sortedOrder.begin(), sortedOrder.end());
+  for (size_t index = 0; index < sortedOrder.size(); ++index) {
+    EXPECT_EQ(sortedOrder[index], index);
+  }
+
+  for (const auto& chunk : chunks) {
+    EXPECT_EQ(chunk.count, chunkSize);
+    // The chunks are 8 x 8 blocks of the grid, and contain their sprites
+    EXPECT_FLOAT_EQ(chunk.maximum.x - chunk.minimum.x, 8.f);
+    EXPECT_FLOAT_EQ(chunk.maximum.z - chunk.minimum.z, 8.f);
+    for (size_t index = chunk.start; index < chunk.start + chunk.count;
+         ++index) {
+      const auto& position = positions[order[index]];
+      EXPECT_GE(position.x - 0.5f, chunk.minimum.x);
+      EXPECT_LE(position.z + 0.5f, chunk.maximum.z);
+    }
+  }
+
+  EXPECT_TRUE(SpriteChunk::Build({}, {}, chunkSize, order).empty());
+  EXPECT_TRUE(order.empty());
+}
+
+TEST(TestSpriteChunk, Culling)
+{
+  using namespace BABYLON;
+
+  const auto frustumPlanes = unitCubeFrustum();
+  SpriteChunk chunk;
+  chunk.start   = 0;
+  chunk.count   = 1;
+  chunk.minimum = Vector3(0.5f, 0.5f, 0.5f);
+  chunk.maximum = Vector3(2.f, 2.f, 2.f);
+  EXPECT_TRUE(chunk.isInFrustum(frustumPlanes));
+  chunk.minimum = Vector3(1.5f, -0.5f, -0.5f);
+  EXPECT_FALSE(chunk.isInFrustum(frustumPlanes));
+
+  // 4 lanes and a scalar tail
+  const Float32Array x{0.f, 1.5f, 1.5f, -3.f, 0.f, 0.f, 0.f, -1.2f, 9.f};
+  const Float32Array y{0.f, 0.f, 0.f, 0.f, 0.9f, 1.05f, 0.f, 0.f, 0.f};
+  const Float32Array z{0.f, 0.f, 0.f, 0.f, 0.f, 0.f, -2.f, 0.f, 0.f};
+  const Float32Array r{0.1f, 0.4f, 0.6f, 1.f, 0.f, 0.f, 0.5f, 0.25f, 1.f};
+  std::vector<size_t> visible;
+  SpriteChunk::CullSpheres(x, y, z, r, frustumPlanes, visible);
+  EXPECT_EQ(visible, std::vector<size_t>({0, 2, 4, 7}));
+}
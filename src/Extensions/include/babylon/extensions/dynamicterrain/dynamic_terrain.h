@@ -248,7 +248,9 @@ public:
   void setMapNormals(const Float32Array& val);
 
   /**
-   * Must the normals be recomputed on each terrain update (default : true)
+   * Must the normals be computed from the data map when no map of normals is
+   * passed (default : true). They are computed once per data map, not on each
+   * terrain update.
    */
   bool computeNormals() const;
   void setComputeNormals(bool val);
@@ -260,6 +262,15 @@ public:
   bool useCustomVertexFunction() const;
   void useCustomVertexFunction(bool val);
 
+  /**
+   * Number of frames over which the terrain heights are morphed from the
+   * previous LOD to the new one when the LOD value changes, instead of
+   * popping. 0 disables the geomorphing.
+   * Default 0.
+   */
+  unsigned int geomorphFrames() const;
+  void setGeomorphFrames(unsigned int val);
+
   // User custom functions.
   // These following can be overwritten bu the user to fit his needs.
 
@@ -300,9 +311,72 @@ public:
 private:
   /**
    * @brief Updates the underlying ribbon.
+   *
+   * When the terrain only scrolled over the map since the previous update, the
+   * vertices still in the terrain are shifted in place and only the rows and
+   * columns that scrolled in are read from the map. Otherwise every vertex is
+   * recomputed, the rows being spread over the available hardware threads.
+   * A LOD change starts a geomorphing from the heights displayed before the
+   * change.
    */
   void _updateTerrain();
 
+  /**
+   * @brief Computes the per vertex step and LOD values from the LOD limits,
+   * they are the same on both axes.
+   */
+  void _updateVertexSteps();
+
+  /**
+   * @brief Reads the terrain vertex (i, j) from the maps, then passes it to
+   * the user custom function.
+   */
+  void _updateVertex(unsigned int i, unsigned int j);
+
+  /**
+   * @brief Computes the amount of vertices the terrain scrolled by on one axis
+   * since the previous update.
+   * @return false if the vertices can not be reused.
+   */
+  bool _vertexShift(unsigned int oldDeltaSub, unsigned int deltaSub,
+                    unsigned int mapSub, int& shift) const;
+
+  /**
+   * @brief Moves the count components starting at first of each vertex data by
+   * (shiftX, shiftZ) vertices, in place.
+   */
+  void _shiftVertexData(Float32Array& data, unsigned int stride,
+                        unsigned int first, unsigned int count, int shiftX,
+                        int shiftZ);
+
+  /**
+   * @brief Computes the normals of the data map once, so that they don't have
+   * to be computed on the terrain on each update.
+   */
+  void _computeMapNormals();
+
+  /**
+   * @brief Samples the heights displayed before the ribbon update at the new
+   * vertex positions, they are the start of the geomorphing.
+   * @param oldSteps the vertex steps of the displayed heights
+   * @param oldHeights the displayed heights
+   * @param restart true if the LOD value changed, false if a running
+   * geomorphing continues from the displayed heights
+   */
+  void _startGeomorph(const Uint32Array& oldSteps,
+                      const Float32Array& oldHeights, bool restart);
+
+  /**
+   * @brief Blends the terrain heights for the current geomorphing frame.
+   */
+  void _applyGeomorph();
+
+  /**
+   * @brief Updates the terrain bounding box from the current positions and
+   * sets it on the terrain mesh.
+   */
+  void _updateBoundingBox();
+
   template <typename T>
   T _mod(T a, T b)
   {
@@ -329,6 +403,10 @@ private:
   Float32Array _mapColors;
   // Normal data of the map
   Float32Array _mapNormals;
+  // true if the map normals were computed from the data map
+  bool _mapNormalsComputed;
+  // true if the terrain mesh is upside down
+  bool _invertSide;
   // current scene
   Scene* _scene;
   // how many cells flought over thy the camera on the terrain x axis before
@@ -366,6 +444,28 @@ private:
   unsigned int _deltaSubX;
   // map z subdivision delta
   unsigned int _deltaSubZ;
+  // map x subdivision delta of the previous ribbon update
+  unsigned int _lastDeltaSubX;
+  // map z subdivision delta of the previous ribbon update
+  unsigned int _lastDeltaSubZ;
+  // LOD value of the previous ribbon update
+  unsigned int _lastLODValue;
+  // map subdivisions from the terrain border to each vertex row or column
+  Uint32Array _vertexSteps;
+  // LOD value of each vertex row or column
+  Uint32Array _vertexLODs;
+  // number of frames of a geomorphing, 0 to disable it
+  unsigned int _geomorphFrames;
+  // remaining frames of the current geomorphing
+  unsigned int _geomorphRemaining;
+  // remaining frames when the geomorphing start heights were sampled
+  unsigned int _geomorphStart;
+  // a geomorphing was running at the start of the current update
+  bool _geomorphing;
+  // heights at the start of the geomorphing
+  Float32Array _geomorphFromHeights;
+  // heights at the end of the geomorphing
+  Float32Array _geomorphToHeights;
   // x shift in world space
   float _mapShiftX;
   // z shift in world space
@@ -378,6 +478,8 @@ private:
   bool _updateLOD;
   // forced ribbon recomputation
   bool _updateForced;
+  // the maps changed : every ribbon vertex needs to be recomputed
+  bool _needsFullUpdate;
   // to force the terrain computation every frame
   bool _refreshEveryFrame;
   // to allow the call to updateVertex()
@@ -52,7 +52,7 @@ using TestException = std::runtime_error;
 // assertion failed: <file>:line: <function> <failMessage>
 #define ANAX_ASSERT(condition, failMessage)                                    \
   if (!(condition))                                                            \
-    throw anax::TestException{                                                 \
+    throw BABYLON::Extensions::ECS::TestException{                             \
       std::string{"assertion failed: "} + std::string{__FILE__}                \
       + std::string{": "} + std::to_string(__LINE__) + " "                     \
       + std::string{__func__} + " " + std::string{failMessage}};
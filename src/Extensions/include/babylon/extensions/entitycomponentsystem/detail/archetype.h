@@ -0,0 +1,141 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ARCHETYPE_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ARCHETYPE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_type_info.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
+
+#include <babylon/extensions/entitycomponentsystem/component.h>
+#include <babylon/extensions/entitycomponentsystem/config.h>
+#include <babylon/extensions/entitycomponentsystem/entity.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+/// \brief Storage of all the entities sharing the same set of component types
+///
+/// The rows of an archetype are split in chunks of fixed capacity. Within a
+/// chunk, the components of each type are stored contiguously in a column, so
+/// that iterating over the components of a type is a linear walk in memory.
+/// Rows are kept dense: removing a row moves the last row in its place.
+class Archetype {
+
+public:
+  /// The approximate size of a chunk, in bytes
+  static constexpr std::size_t ChunkSize = 16 * 1024;
+
+  /// \param typeList The component types of the archetype
+  /// \param typeInfos The description of each component type, indexed by
+  /// component type id (only the types of typeList are used)
+  Archetype(const ComponentTypeList& typeList,
+            const std::array<const ComponentTypeInfo*,
+                             MAX_AMOUNT_OF_COMPONENTS>& typeInfos);
+
+  Archetype(const Archetype&) = delete;
+  Archetype(Archetype&&)      = delete;
+  Archetype& operator=(const Archetype&) = delete;
+  Archetype& operator=(Archetype&&) = delete;
+
+  /// Destroys the components of all the rows
+  ~Archetype();
+
+  /// \return The component types of the archetype
+  const ComponentTypeList& getComponentTypeList() const;
+
+  /// \return The description of a component type of the archetype
+  const ComponentTypeInfo& getComponentTypeInfo(TypeId componentTypeId) const;
+
+  /// \return The amount of rows (entities) of the archetype
+  std::size_t getSize() const;
+
+  /// \return The maximum amount of rows of a chunk
+  std::size_t getChunkCapacity() const;
+
+  /// \return The amount of allocated chunks
+  std::size_t getChunkCount() const;
+
+  /// \return The amount of rows of a chunk
+  std::size_t getChunkSize(std::size_t chunk) const;
+
+  /// \return The entity stored at a row
+  const Entity& getEntity(std::size_t row) const;
+
+  /// \return The activation flags of the rows, indexed by row
+  const std::uint8_t* getActivatedFlags() const;
+
+  /// Sets the activation flag of a row
+  void setActivated(std::size_t row, bool activated);
+
+  /// \return A pointer to the component of a row
+  void* getComponent(std::size_t row, TypeId componentTypeId);
+
+  /// \tparam T The type of the column
+  /// \return The first component of a column of a chunk
+  template <class T>
+  T* getColumn(std::size_t chunk);
+
+  /// Appends a row for an entity. The components of the row are not
+  /// constructed, the caller is responsible for constructing all of them.
+  /// \return The index of the new row
+  std::size_t addRow(const Entity& entity, bool activated);
+
+  /// Destroys the components of a row and moves the last row in its place
+  /// \return The entity moved in the removed row, or nullptr if the removed
+  /// row was the last one
+  const Entity* removeRow(std::size_t row);
+
+private:
+  unsigned char* getColumnData(std::size_t row, TypeId componentTypeId);
+
+  ComponentTypeList m_typeList;
+
+  /// The component types of the archetype, in column order
+  std::vector<TypeId> m_typeIds;
+
+  /// The description of each component type, indexed by component type id
+  std::array<const ComponentTypeInfo*, MAX_AMOUNT_OF_COMPONENTS> m_typeInfos;
+
+  /// The offset of each column within a chunk, indexed by component type id
+  std::array<std::size_t, MAX_AMOUNT_OF_COMPONENTS> m_columnOffsets;
+
+  std::size_t m_chunkCapacity;
+  std::size_t m_chunkBytes;
+  std::vector<std::unique_ptr<unsigned char[]>> m_chunks;
+
+  /// The entities and activation flags of the rows
+  std::vector<Entity> m_entities;
+  std::vector<std::uint8_t> m_activated;
+
+  /// The archetypes reached by adding/removing a component type, cached by
+  /// the storage, indexed by component type id
+  std::array<Archetype*, MAX_AMOUNT_OF_COMPONENTS> m_addTransitions;
+  std::array<Archetype*, MAX_AMOUNT_OF_COMPONENTS> m_removeTransitions;
+
+  friend class EntityComponentStorage;
+
+}; // end of class Archetype
+
+template <class T>
+T* Archetype::getColumn(std::size_t chunk)
+{
+  const auto componentTypeId = ComponentTypeId<T>();
+  ANAX_ASSERT(m_typeList[componentTypeId],
+              "Archetype does not contain the component type");
+  return reinterpret_cast<T*>(m_chunks[chunk].get()
+                              + m_columnOffsets[componentTypeId]);
+}
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ARCHETYPE_H
@@ -29,8 +29,10 @@
 #ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_BASE_SYSTEM_H
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_BASE_SYSTEM_H
 
+#include <tuple>
 #include <vector>
 
+#include <babylon/extensions/entitycomponentsystem/detail/archetype.h>
 #include <babylon/extensions/entitycomponentsystem/detail/filter.h>
 #include <babylon/extensions/entitycomponentsystem/entity.h>
 
@@ -65,6 +67,42 @@ public:
   /// \return All the entities that are within the System
   const std::vector<Entity>& getEntities() const;
 
+  /// \return The component types read by the System
+  const ComponentTypeList& getReadComponents() const;
+
+  /// \return The component types written by the System
+  const ComponentTypeList& getWriteComponents() const;
+
+  /// Determines if the System can not run concurrently with another System
+  /// \param system The other System
+  /// \return true if one of the systems writes a component type accessed by
+  /// the other one
+  bool conflictsWith(const BaseSystem& system) const;
+
+  /// \return The archetypes of the World passing the filter of the System
+  /// \note The query is cached: only the archetypes created since the
+  /// previous call are tested against the filter
+  const std::vector<Archetype*>& getArchetypes();
+
+  /// Iterates over the components of the activated entities passing the
+  /// filter of the System, chunk by chunk
+  /// \tparam T The component types passed to the function, which must be
+  /// required by the filter of the System
+  /// \param function The function called with a reference to each component
+  /// \note Components must not be added or removed during the iteration
+  template <class... T, class Function>
+  void forEach(Function&& function);
+
+protected:
+  /// Declares the component types accessed by the System, so that the
+  /// SystemScheduler can run it concurrently with the systems accessing other
+  /// component types. By default a System is considered to write every
+  /// component type.
+  /// \tparam ReadList The component types read (see Reads)
+  /// \tparam WriteList The component types written (see Writes)
+  template <class ReadList, class WriteList>
+  void setComponentAccess();
+
 private:
   /// Initializes the system, when a world is successfully attached to it.
   virtual void initialize()
@@ -107,10 +145,49 @@ private:
   /// The Entities that are attached to this system
   std::vector<Entity> m_entities;
 
+  /// The component types read and written by the system
+  ComponentTypeList m_reads;
+  ComponentTypeList m_writes;
+
+  /// The cached archetypes passing the component filter
+  std::vector<Archetype*> m_archetypes;
+
+  /// The amount of archetypes of the world already tested against the filter
+  std::size_t m_archetypesTested;
+
+  /// The generation of the archetypes of the world when last queried
+  std::size_t m_archetypesGeneration;
+
   friend World;
 
 }; // end of class BaseSystem
 
+template <class... T, class Function>
+void BaseSystem::forEach(Function&& function)
+{
+  for (auto archetype : getArchetypes()) {
+    const auto activated = archetype->getActivatedFlags();
+    for (std::size_t chunk = 0; chunk < archetype->getChunkCount(); ++chunk) {
+      const auto begin   = chunk * archetype->getChunkCapacity();
+      const auto size    = archetype->getChunkSize(chunk);
+      const auto columns = std::make_tuple(archetype->getColumn<T>(chunk)...);
+      for (std::size_t i = 0; i < size; ++i) {
+        if (activated[begin + i]) {
+          function(std::get<T*>(columns)[i]...);
+        }
+      }
+    }
+  }
+}
+
+template <class ReadList, class WriteList>
+void BaseSystem::setComponentAccess()
+{
+  auto access = MakeComponentAccess<ReadList, WriteList>();
+  m_reads     = access.first;
+  m_writes    = access.second;
+}
+
 } // end of namespace detail
 } // end of namespace ECS
 } // end of namespace Extensions
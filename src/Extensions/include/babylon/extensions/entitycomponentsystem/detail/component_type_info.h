@@ -0,0 +1,60 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_TYPE_INFO_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_TYPE_INFO_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <babylon/extensions/entitycomponentsystem/component.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+/// \brief Type erased description of a component type
+///
+/// Used by the archetypes to store the components of a given type
+/// contiguously, without knowing the type at compile time.
+struct ComponentTypeInfo {
+  /// The size of the component type, in bytes
+  std::size_t size;
+
+  /// The alignment of the component type, in bytes
+  std::size_t alignment;
+
+  /// Move constructs a component at destination from the component at source
+  void (*moveConstruct)(void* destination, void* source);
+
+  /// Destroys the component
+  void (*destroy)(void* component);
+
+  /// Converts a pointer to the component to a pointer to its Component base
+  Component* (*toComponent)(void* component);
+
+  /// \tparam T The component type
+  /// \return The description of the component type T
+  template <class T>
+  static const ComponentTypeInfo& Get()
+  {
+    static_assert(std::is_base_of<Component, T>::value, "Invalid component");
+    static_assert(std::is_move_constructible<T>::value,
+                  "Components must be move constructible");
+    static const ComponentTypeInfo info{
+      sizeof(T), alignof(T),
+      [](void* destination, void* source) {
+        new (destination) T(std::move(*static_cast<T*>(source)));
+      },
+      [](void* component) { static_cast<T*>(component)->~T(); },
+      [](void* component) -> Component* { return static_cast<T*>(component); }};
+    return info;
+  }
+};
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_TYPE_INFO_H
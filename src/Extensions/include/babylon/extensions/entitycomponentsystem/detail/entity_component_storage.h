@@ -31,8 +31,12 @@
 
 #include <array>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
+#include <babylon/extensions/entitycomponentsystem/detail/archetype.h>
 #include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_type_info.h>
 #include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
@@ -46,23 +50,34 @@ namespace detail {
 
 /// \brief A class to store components for entities within a world
 ///
+/// The components are stored by archetype: all the entities with the same set
+/// of component types share an Archetype, which stores their components in
+/// contiguous columns. Adding or removing a component moves the components of
+/// the entity to another archetype.
 ///
-/// Used to store the components
-///
+/// \note References to the components of an entity are invalidated when a
+/// component is added to or removed from any entity of the same archetype.
 ///
 /// \author Miguel Martin
 class EntityComponentStorage {
 
 public:
   explicit EntityComponentStorage(std::size_t entityAmount);
+  ~EntityComponentStorage();
 
   EntityComponentStorage(const EntityComponentStorage&) = delete;
   EntityComponentStorage(EntityComponentStorage&&)      = delete;
   EntityComponentStorage& operator=(const EntityComponentStorage&) = delete;
   EntityComponentStorage& operator=(EntityComponentStorage&&) = delete;
 
-  void addComponent(Entity& entity, Component* component,
-                    TypeId componentTypeId);
+  /// Adds a component to an entity, replacing the existing component of the
+  /// same type
+  /// \param component The component to move in the storage, of the type
+  /// described by componentTypeInfo
+  /// \return The stored component
+  Component& addComponent(Entity& entity, void* component,
+                          TypeId componentTypeId,
+                          const ComponentTypeInfo& componentTypeInfo);
 
   void removeComponent(Entity& entity, TypeId componentTypeId);
 
@@ -76,47 +91,60 @@ public:
 
   bool hasComponent(const Entity& entity, TypeId componentTypeId) const;
 
+  /// Sets the activation flag of an entity, used to skip the deactivated
+  /// entities when iterating the archetypes
+  void setActivated(const Entity& entity, bool activated);
+
+  /// \return All the archetypes, in creation order
+  const std::vector<Archetype*>& getArchetypes() const;
+
+  /// \return A counter incremented each time the archetypes are released
+  std::size_t getGeneration() const;
+
   void resize(std::size_t entityAmount);
 
   void clear();
 
 private:
-  typedef std::array<std::unique_ptr<Component>, MAX_AMOUNT_OF_COMPONENTS>
-    ImplComponentArray;
-
-  /// \brief A data structure to describe the components
-  /// within an entity
-  ///
-  /// \author Miguel Martin
-  struct EntityComponents {
-    EntityComponents() = default;
-
-    // bug in clang? won't work w/o this
-    // http://stackoverflow.com/questions/8560994/stdmake-shared-stdunique-ptr-and-move-constructors
-    // I think it's due to ComponentTypeList (may have to update boost)
-    EntityComponents(EntityComponents&& e)
-        : components(std::move(e.components))
-        , componentTypeList(std::move(e.componentTypeList))
-    {
-    }
-
-    /// The components of an entity. The
-    /// index of this array is the same as the TypeId
-    /// of the component.
-    ImplComponentArray components;
-
-    /// A list of component types, which resembles
-    /// what components an entity has
-    ComponentTypeList componentTypeList;
+  /// \brief The location of the components of an entity
+  struct EntityLocation {
+    /// The archetype of the entity, nullptr if it has no component
+    Archetype* archetype = nullptr;
+
+    /// The row of the entity within its archetype
+    std::size_t row = 0;
+
+    /// Whether or not the entity is activated
+    bool activated = false;
   };
 
-  /// All the components for every entity, which has
-  /// an entity. The indices of this array is the same
-  /// as the index component of an entity's ID.
-  std::vector<EntityComponents> m_componentEntries;
+  /// \return The archetype with the given component types, created if needed
+  Archetype* getArchetype(
+    const ComponentTypeList& typeList,
+    const std::array<const ComponentTypeInfo*, MAX_AMOUNT_OF_COMPONENTS>&
+      typeInfos);
+
+  /// Moves the components of an entity to another archetype. The components
+  /// that do not belong to the new archetype are destroyed, the components
+  /// of the new archetype that the entity did not have are not constructed.
+  void moveEntity(const Entity& entity, EntityLocation& location,
+                  Archetype* archetype);
+
+  /// Removes the row of an entity from its archetype
+  void removeRow(EntityLocation& location);
+
+  /// All the archetypes, indexed by their component types
+  std::unordered_map<ComponentTypeList, std::unique_ptr<Archetype>>
+    m_archetypesByTypeList;
+
+  /// All the archetypes, in creation order
+  std::vector<Archetype*> m_archetypes;
+
+  /// The location of each entity. The indices of this array is the same as
+  /// the index component of an entity's ID.
+  std::vector<EntityLocation> m_locations;
 
-  ImplComponentArray& getComponentsImpl(const Entity& e);
-  const ImplComponentArray& getComponentsImpl(const Entity& e) const;
+  std::size_t m_generation;
 
 }; // end of class EntityComponentStorage
 
@@ -27,6 +27,7 @@
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_FILTER_H
 
 #include <type_traits>
+#include <utility>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
 #include <babylon/extensions/entitycomponentsystem/config.h>
@@ -47,6 +48,10 @@ struct BaseRequires {
 };
 struct BaseExcludes {
 };
+struct BaseReads {
+};
+struct BaseWrites {
+};
 
 struct Filter {
 public:
@@ -86,6 +91,16 @@ Filter MakeFilter()
   return Filter{types(RequireList{}), types(ExcludeList{})};
 }
 
+template <class ReadList, class WriteList>
+std::pair<ComponentTypeList, ComponentTypeList> MakeComponentAccess()
+{
+  static_assert(std::is_base_of<BaseReads, ReadList>::value,
+                "ReadList is not a reads list");
+  static_assert(std::is_base_of<BaseWrites, WriteList>::value,
+                "WriteList is not a writes list");
+  return std::make_pair(types(ReadList{}), types(WriteList{}));
+}
+
 } // end of namespace detail
 } // end of namespace ECS
 } // end of namespace Extensions
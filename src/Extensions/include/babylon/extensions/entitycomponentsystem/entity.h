@@ -31,6 +31,7 @@
 #include <utility>
 
 #include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_type_info.h>
 #include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
@@ -157,6 +158,9 @@ public:
   /// Adds a component to the Entity
   /// \tparam The type of component you wish to add
   /// \param args The arguments for the constructor of the component
+  /// \note The component is moved in the storage of the archetype of the
+  /// entity, the returned reference is invalidated when a component is added
+  /// to or removed from an entity of the same archetype.
   template <typename T, typename... Args>
   T& addComponent(Args&&... args);
 
@@ -197,7 +201,8 @@ public:
 private:
   // wrappers to add components
   // so I may call them from templated public interfaces
-  void addComponent(Component* component, detail::TypeId componentTypeId);
+  Component& addComponent(void* component, detail::TypeId componentTypeId,
+                          const detail::ComponentTypeInfo& componentTypeInfo);
   void removeComponent(detail::TypeId componentTypeId);
   Component& getComponent(detail::TypeId componentTypeId) const;
   bool hasComponent(detail::TypeId componentTypeId) const;
@@ -217,10 +222,9 @@ T& Entity::addComponent(Args&&... args)
 {
   static_assert(std::is_base_of<Component, T>(),
                 "T is not a component, cannot add T to entity");
-  // TODO: align components by type
-  auto component = new T{std::forward<Args>(args)...};
-  addComponent(component, ComponentTypeId<T>());
-  return *component;
+  T component{std::forward<Args>(args)...};
+  return static_cast<T&>(addComponent(&component, ComponentTypeId<T>(),
+                                      detail::ComponentTypeInfo::Get<T>()));
 }
 
 template <typename T>
@@ -42,6 +42,16 @@ template <class... Args>
 struct Excludes : detail::TypeList<Args...>, detail::BaseExcludes {
 };
 
+/// The component types read by a system
+template <class... Args>
+struct Reads : detail::TypeList<Args...>, detail::BaseReads {
+};
+
+/// The component types written by a system
+template <class... Args>
+struct Writes : detail::TypeList<Args...>, detail::BaseWrites {
+};
+
 } // end of namespace ECS
 } // end of namespace Extensions
 } // end of namespace BABYLON
@@ -0,0 +1,79 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_SYSTEM_SCHEDULER_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_SYSTEM_SCHEDULER_H
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <babylon/extensions/entitycomponentsystem/detail/base_system.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+
+/// \brief Runs the updates of systems, in parallel when possible
+///
+/// The systems are grouped in stages: a system is placed in the first stage
+/// following the last stage containing a system it conflicts with (see
+/// BaseSystem::setComponentAccess), so that the systems accessing the same
+/// component types keep their registration order. The systems of a stage run
+/// concurrently, the stages run one after the other.
+///
+/// \note The systems must not add or remove components, nor create or kill
+/// entities while the scheduler runs.
+class SystemScheduler {
+
+public:
+  /// Default constructor
+  SystemScheduler();
+
+  /// Adds a system, updated by calling its update() method
+  /// \tparam TSystem The type of system you wish to add
+  /// \param system The system you wish to add
+  template <class TSystem>
+  void addSystem(TSystem& system)
+  {
+    addSystem(system, [&system]() { system.update(); });
+  }
+
+  /// Adds a system with a custom update function
+  /// \param system The system you wish to add
+  /// \param update The function updating the system
+  void addSystem(detail::BaseSystem& system, std::function<void()> update);
+
+  /// Removes all the systems from the scheduler
+  void clear();
+
+  /// Runs the updates of all the systems, stage by stage
+  void update();
+
+  /// \return The amount of stages of the systems added to the scheduler
+  std::size_t getStageCount();
+
+private:
+  struct ScheduledSystem {
+    detail::BaseSystem* system;
+    std::function<void()> update;
+  };
+
+  void buildStages();
+
+  /// The systems, in registration order
+  std::vector<ScheduledSystem> m_systems;
+
+  /// The indices of the systems of each stage
+  std::vector<std::vector<std::size_t>> m_stages;
+
+  /// Whether or not the stages must be rebuilt
+  bool m_dirty;
+
+  /// The maximum amount of systems updated concurrently
+  unsigned int m_maxThreads;
+
+}; // end of class SystemScheduler
+
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_SYSTEM_SCHEDULER_H
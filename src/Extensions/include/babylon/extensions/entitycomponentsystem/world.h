@@ -182,6 +182,13 @@ private:
   /// Systems attached with the world.
   SystemArray m_systems;
 
+  /// The result of the filter of each system (in the iteration order of
+  /// m_systems) for each set of component types, so that the filters are
+  /// tested once per archetype rather than once per entity.
+  /// This cache is cleared whenever the systems change.
+  std::unordered_map<detail::ComponentTypeList, std::vector<bool>>
+    m_systemFilterCache;
+
   /// A pool storage of the IDs for the entities within the world
   detail::EntityIdPool m_entityIdPool;
 
@@ -277,8 +284,13 @@ private:
   void removeSystem(detail::TypeId systemTypeId);
   bool doesSystemExist(detail::TypeId systemTypeId) const;
 
+  /// \return Whether or not each system passes the component types
+  const std::vector<bool>&
+  getSystemFilterResults(const detail::ComponentTypeList& typeList);
+
   // to access components
   friend class Entity;
+  friend class detail::BaseSystem;
 
 }; // end of class World
 
@@ -7,17 +7,25 @@ namespace BABYLON {
 namespace Extensions {
 
 struct RenderObject {
-  void colour(const Color4& /*color*/){}
-  void normal(const Vector3& /*normal*/){}
-  void position(const Vector3& /*position*/){}
-  void triangle(size_t /*p1*/, size_t /*p2*/, size_t /*p3*/){}
-  size_t getCurrentVertexCount(){return 0;}
+  void colour(const Color4& color);
+  void normal(const Vector3& normal);
+  void position(const Vector3& position);
+  void triangle(size_t p1, size_t p2, size_t p3);
+  size_t getCurrentVertexCount() const;
+
+  Float32Array positions;
+  Float32Array normals;
+  Float32Array colors;
+  Uint32Array indices;
 }; // end of struct RenderObject
 
 struct RenderData {
-  RenderObject surface;
+  // Surface and plate movements render objects, one per leaf of the spatial
+  // partition of the planet, so that they are built and streamed
+  // independently
+  std::vector<RenderObject> surfaces;
+  std::vector<RenderObject> plateMovements;
   RenderObject plateBoundaries;
-  RenderObject plateMovements;
   RenderObject airCurrents;
 }; // end of struct RenderData
 
@@ -0,0 +1,49 @@
+#ifndef BABYLON_EXTENSIONS_HEX_PLANET_GENERATION_TERRAIN_AIR_FLOW_H
+#define BABYLON_EXTENSIONS_HEX_PLANET_GENERATION_TERRAIN_AIR_FLOW_H
+
+#include <babylon/babylon_global.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+struct Corner;
+
+/**
+ * @brief Structure of arrays describing the transport of a quantity carried
+ * by the air currents (heat, moisture) between the corners of a planet.
+ *
+ * At each step every corner absorbs part of its air quantity and pushes the
+ * remainder to its neighbors along the air current outflows. The neighbors
+ * gather what flows into them, so that a step is computed in parallel and
+ * independently of the amount of threads.
+ */
+struct AirFlow {
+  AirFlow(const std::vector<Corner>& corners);
+
+  /**
+   * @brief Processes a transport step.
+   * @return The quantity absorbed by the corners during the step.
+   */
+  float process();
+
+  // Neighborhood of the corners: the slots of corner c are the indices
+  // [slotOffsets[c], slotOffsets[c + 1]), following corner.corners
+  std::vector<size_t> slotOffsets;
+  std::vector<size_t> slotCorners;
+  // Slot of the neighbor corner pointing back to the corner of a slot
+  std::vector<size_t> inflowSlots;
+  Float32Array outflows;
+
+  // Per corner state
+  Float32Array area;
+  Float32Array air;
+  Float32Array absorptionRate;
+  Float32Array absorbed;
+  Float32Array maxAbsorbed;
+  Float32Array outgoingAir;
+}; // end of struct AirFlow
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_HEX_PLANET_GENERATION_TERRAIN_AIR_FLOW_H
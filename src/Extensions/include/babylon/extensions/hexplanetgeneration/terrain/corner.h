@@ -33,19 +33,13 @@ struct Corner : public UidObj {
   Vector3 airCurrent;
   float airCurrentSpeed; // kilometers per hour
   Float32Array airCurrentOutflows;
-  // AirHeat
+  // AirHeat, the air transport itself is computed by AirFlow
   float temperature;
-  // 2do: temporaries for temperature calc. ?!
-  float airHeat;
-  float newAirHeat;
   float heat;
   float heatAbsorption;
   float maxHeat;
-  // AirMoisture
+  // AirMoisture, the air transport itself is computed by AirFlow
   float moisture;
-  // 2do: temporaries for temperature calc. ?!
-  float airMoisture;
-  float newAirMoisture;
   float precipitation;
   float precipitationRate;
   float maxPrecipitation;
@@ -113,6 +113,13 @@ public:
    */
   float raw3D(float x, float y, float z) const;
 
+  /**
+   * Get the noise values [-1, 1] of count 3D coordinates, computed
+   * NoiseLanes::Width at a time.
+   */
+  void raw3D(const float* x, const float* y, const float* z, float* result,
+             size_t count) const;
+
   /**
    * Get a noise value [-1, 1] at the 4D coordinate (x,y,z,w).
    */
@@ -134,6 +141,12 @@ public:
    */
   float scaled3D(float x, float y, float z) const;
 
+  /**
+   * Batched scaled3D() call for count 3D coordinates.
+   */
+  void scaled3D(const float* x, const float* y, const float* z, float* result,
+                size_t count) const;
+
   /**
    * Specific scaled() call for a 4D point at (x, y, z, w).
    */
@@ -6,6 +6,7 @@
 namespace BABYLON {
 namespace Extensions {
 
+struct AirFlow;
 struct Border;
 struct Corner;
 struct ElevationBorder;
@@ -116,27 +117,28 @@ private:
                             const std::vector<Whorl>& whorls,
                             float planetRadius);
   void initializeAirHeat(std::vector<Corner>& corners, float heatLevel,
-                         std::vector<Corner*>& activeCorners, float& airHeat);
-  float processAirHeat(std::vector<Corner*>& activeCorners);
+                         AirFlow& airFlow, float& airHeat);
   void calculateTemperature(std::vector<Corner>& corners,
-                            std::vector<Tile>& tiles, float planetRadius);
+                            std::vector<Tile>& tiles, const AirFlow& airFlow,
+                            float planetRadius);
   void initializeAirMoisture(std::vector<Corner>& corners, float moistureLevel,
-                             std::vector<Corner*>& activeCorners,
-                             float& airMoisture);
-  float processAirMoisture(std::vector<Corner*>& activeCorners);
+                             AirFlow& airFlow, float& airMoisture);
   void calculateMoisture(std::vector<Corner>& corners,
-                         std::vector<Tile>& tiles);
+                         std::vector<Tile>& tiles, const AirFlow& airFlow);
   void generatePlanetBiomes(std::vector<Tile>& tiles, float planetRadius);
-  void generatePlanetRenderData(Topology& topology, IRandomFunction& random,
+  void generatePlanetRenderData(Topology& topology,
+                                SpatialPartition& partition,
+                                IRandomFunction& random,
                                 RenderData& renderData);
   void doBuildTileWedge(RenderObject& ro, size_t b, size_t s, size_t t);
-  void buildSurfaceRenderObject(std::vector<Tile>& tiles,
-                                IRandomFunction& random, RenderObject& ro);
-  void buildPlateBoundariesRenderObject(std::vector<Border>& borders,
+  void buildSurfaceRenderObject(const std::vector<Tile*>& tiles,
+                                const std::vector<Color4>& colorDeviances,
+                                RenderObject& ro);
+  void buildPlateBoundariesRenderObject(const std::vector<Border>& borders,
                                         RenderObject& ro);
-  void buildPlateMovementsRenderObject(std::vector<Tile>& tiles,
+  void buildPlateMovementsRenderObject(const std::vector<Tile*>& tiles,
                                        RenderObject& ro);
-  void buildAirCurrentsRenderObject(std::vector<Corner>& corners,
+  void buildAirCurrentsRenderObject(const std::vector<Corner>& corners,
                                     RenderObject& ro);
   void buildArrow(RenderObject& ro, const Vector3& position,
                   const Vector3& direction, const Vector3& normal,
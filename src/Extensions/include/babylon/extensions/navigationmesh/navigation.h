@@ -2,7 +2,9 @@
 #define BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_H
 
 #include <babylon/babylon_global.h>
+#include <babylon/extensions/navigationmesh/navigation_node_index.h>
 #include <babylon/extensions/navigationmesh/navigation_structs.h>
+#include <babylon/extensions/pathfinding/a_star_search.h>
 
 namespace BABYLON {
 namespace Extensions {
@@ -29,7 +31,32 @@ public:
                                 const Vector3& targetPosition,
                                 const std::string& zone, std::size_t group);
 
+  /**
+   * @brief Finds the paths of many agents in a zone, the queries being
+   * distributed over the available hardware threads.
+   * @param queries The start position, target position and group of each
+   * agent.
+   * @param zone The zone the agents are in.
+   * @return The path of each query, in the order of the queries.
+   */
+  std::vector<std::vector<Vector3>>
+  findPaths(const std::vector<NavigationQuery>& queries,
+            const std::string& zone);
+
 private:
+  using SearchState = AStarSearchState<NavigationGroupGraph::NodeId>;
+
+  std::vector<Vector3> _findPath(const Vector3& startPosition,
+                                 const Vector3& targetPosition,
+                                 const std::string& zone, std::size_t group,
+                                 SearchState& searchState);
+  std::vector<std::size_t> _findCorridor(const std::string& zone,
+                                         std::size_t group, std::size_t start,
+                                         std::size_t goal,
+                                         SearchState& searchState);
+  std::unique_ptr<SearchState> _acquireSearchState();
+  void _releaseSearchState(std::unique_ptr<SearchState>&& searchState);
+
   bool _isPointInPoly(const std::vector<Vector3>& poly,
                       const Vector3& pt) const;
   bool _isVectorInPolygon(const Vector3& vector, const NavigationGroup& polyon,
@@ -54,6 +81,20 @@ private:
 
 private:
   std::unordered_map<std::string, GroupedNavigationMesh> _zoneNodes;
+  // Closest node lookup index of each group of each zone
+  std::unordered_map<std::string, std::vector<NavigationNodeIndex>>
+    _zoneNodeIndexes;
+  // A* corridors already found in each zone, keyed by group, start and goal
+  // nodes
+  std::unordered_map<std::string,
+                     std::unordered_map<NavigationPathKey,
+                                        std::vector<std::size_t>,
+                                        NavigationPathKeyHash>>
+    _zonePaths;
+  std::mutex _zonePathsMutex;
+  // A* search states reused by the successive queries
+  std::vector<std::unique_ptr<SearchState>> _searchStates;
+  std::mutex _searchStatesMutex;
 
 }; // end of class Navigation
 
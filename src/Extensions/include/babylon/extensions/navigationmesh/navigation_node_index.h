@@ -0,0 +1,57 @@
+#ifndef BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_NODE_INDEX_H
+#define BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_NODE_INDEX_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/extensions/navigationmesh/navigation_structs.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * @brief Uniform grid over the centroids of the nodes of a navigation group,
+ * used to find the node closest to a position without scanning all the nodes.
+ *
+ * The grid covers the x and z axes, the cells are searched in rings of
+ * increasing size around the position until no closer node can be found.
+ */
+class BABYLON_SHARED_EXPORT NavigationNodeIndex {
+
+public:
+  NavigationNodeIndex();
+  NavigationNodeIndex(const NavigationGroupGraph& nodes);
+  ~NavigationNodeIndex();
+
+  /**
+   * @brief Returns the index of the node whose centroid is the closest to the
+   * position, or -1 if the group has no node.
+   *
+   * The ties are resolved like a linear scan over the nodes would : the node
+   * with the lowest index is returned.
+   * @param position The searched position.
+   * @param distance The squared distance from the position to the centroid of
+   * the returned node.
+   */
+  int closestNode(const Vector3& position, float& distance) const;
+
+private:
+  std::size_t _cellIndex(float x, float z) const;
+
+private:
+  std::vector<Vector3> _centroids;
+  float _minX;
+  float _minZ;
+  float _cellSize;
+  std::size_t _columns;
+  std::size_t _rows;
+  // Offsets of the first node of each cell in _cellNodes, plus the end offset
+  Uint32Array _cellStarts;
+  // Node indexes sorted by cell, in increasing order in each cell
+  Uint32Array _cellNodes;
+
+}; // end of class NavigationNodeIndex
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_NAVIGATION_MESH_NAVIGATION_NODE_INDEX_H
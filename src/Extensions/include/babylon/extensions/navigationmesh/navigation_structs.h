@@ -47,6 +47,46 @@ struct BABYLON_SHARED_EXPORT NavigationGroup {
   }
 }; // end of struct NavigationGroup
 
+/**
+ * @brief Range over the neighbours of a navigation group, the groups are
+ * referenced instead of being copied.
+ */
+struct NavigationGroupNeighbours {
+  struct const_iterator {
+    const std::vector<NavigationGroup>* groups;
+    Uint32Array::const_iterator index;
+
+    const NavigationGroup& operator*() const
+    {
+      return (*groups)[*index];
+    }
+
+    const_iterator& operator++()
+    {
+      ++index;
+      return *this;
+    }
+
+    bool operator!=(const const_iterator& other) const
+    {
+      return index != other.index;
+    }
+  }; // end of struct const_iterator
+
+  const std::vector<NavigationGroup>& groups;
+  const Uint32Array& indices;
+
+  const_iterator begin() const
+  {
+    return const_iterator{&groups, indices.begin()};
+  }
+
+  const_iterator end() const
+  {
+    return const_iterator{&groups, indices.end()};
+  }
+}; // end of struct NavigationGroupNeighbours
+
 struct NavigationGroupGraph {
   using Node           = NavigationGroup;
   using NodeId         = std::size_t;
@@ -113,14 +153,9 @@ struct NavigationGroupGraph {
     return Vector3::DistanceSquared(pos1, pos2);
   }
 
-  std::vector<NavigationGroup> neighbors(const std::size_t groupId) const
+  NavigationGroupNeighbours neighbors(const std::size_t groupId) const
   {
-    std::vector<NavigationGroup> ret;
-    auto& group = groups[groupId];
-    for (auto index : group.neighbours) {
-      ret.emplace_back(groups[index]);
-    }
-    return ret;
+    return NavigationGroupNeighbours{groups, groups[groupId].neighbours};
   }
 
 }; // end of struct NavigationGroupGraph
@@ -135,6 +170,35 @@ struct BABYLON_SHARED_EXPORT Portal {
   Vector3 right;
 }; // end of struct Portal
 
+struct BABYLON_SHARED_EXPORT NavigationQuery {
+  Vector3 startPosition;
+  Vector3 targetPosition;
+  std::size_t group;
+}; // end of struct NavigationQuery
+
+struct NavigationPathKey {
+  std::size_t group;
+  std::size_t start;
+  std::size_t goal;
+
+  bool operator==(const NavigationPathKey& rhs) const
+  {
+    return (group == rhs.group) && (start == rhs.start) && (goal == rhs.goal);
+  }
+}; // end of struct NavigationPathKey
+
+struct NavigationPathKeyHash {
+  std::size_t operator()(const NavigationPathKey& key) const
+  {
+    std::size_t seed = std::hash<std::size_t>()(key.group);
+    for (auto value : {key.start, key.goal}) {
+      seed ^= std::hash<std::size_t>()(value) + 0x9e3779b9 + (seed << 6)
+              + (seed >> 2);
+    }
+    return seed;
+  }
+}; // end of struct NavigationPathKeyHash
+
 } // end of namespace Extensions
 } // end of namespace BABYLON
 
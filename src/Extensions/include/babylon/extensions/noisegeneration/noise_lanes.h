@@ -0,0 +1,450 @@
+#ifndef BABYLON_EXTENSIONS_NOISE_GENERATION_NOISE_LANES_H
+#define BABYLON_EXTENSIONS_NOISE_GENERATION_NOISE_LANES_H
+
+#include <babylon/babylon_global.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * @brief Vector operations used by the batched noise functions to evaluate
+ * several points at once: 8 points with AVX2, 4 points with SSE2 and a single
+ * point otherwise.
+ */
+struct NoiseLanes {
+
+#if defined(__AVX2__)
+  static constexpr size_t Width = 8;
+  using Float                   = __m256;
+  using Int                     = __m256i;
+  using Mask                    = __m256;
+
+  static Float load(const float* p)
+  {
+    return _mm256_loadu_ps(p);
+  }
+  static void store(float* p, Float v)
+  {
+    _mm256_storeu_ps(p, v);
+  }
+  static void store(int32_t* p, Int v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static Float splat(float v)
+  {
+    return _mm256_set1_ps(v);
+  }
+  static Float add(Float a, Float b)
+  {
+    return _mm256_add_ps(a, b);
+  }
+  static Float sub(Float a, Float b)
+  {
+    return _mm256_sub_ps(a, b);
+  }
+  static Float mul(Float a, Float b)
+  {
+    return _mm256_mul_ps(a, b);
+  }
+  static Float max(Float a, Float b)
+  {
+    return _mm256_max_ps(a, b);
+  }
+  static Mask greater(Float a, Float b)
+  {
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+  }
+  static Mask greaterEqual(Float a, Float b)
+  {
+    return _mm256_cmp_ps(a, b, _CMP_GE_OQ);
+  }
+  static Mask maskAnd(Mask a, Mask b)
+  {
+    return _mm256_and_ps(a, b);
+  }
+  static Mask maskOr(Mask a, Mask b)
+  {
+    return _mm256_or_ps(a, b);
+  }
+  // !a && b
+  static Mask maskAndNot(Mask a, Mask b)
+  {
+    return _mm256_andnot_ps(a, b);
+  }
+  static Float oneIf(Mask m)
+  {
+    return _mm256_and_ps(m, splat(1.f));
+  }
+  static Float toFloat(Int v)
+  {
+    return _mm256_cvtepi32_ps(v);
+  }
+  static Int truncate(Float v)
+  {
+    return _mm256_cvttps_epi32(v);
+  }
+  static Int add(Int a, Int b)
+  {
+    return _mm256_add_epi32(a, b);
+  }
+  // -1 where the mask is set, 0 elsewhere
+  static Int minusOneIf(Mask m)
+  {
+    return _mm256_castps_si256(m);
+  }
+#elif defined(__SSE2__)
+  static constexpr size_t Width = 4;
+  using Float                   = __m128;
+  using Int                     = __m128i;
+  using Mask                    = __m128;
+
+  static Float load(const float* p)
+  {
+    return _mm_loadu_ps(p);
+  }
+  static void store(float* p, Float v)
+  {
+    _mm_storeu_ps(p, v);
+  }
+  static void store(int32_t* p, Int v)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+  }
+  static Float splat(float v)
+  {
+    return _mm_set1_ps(v);
+  }
+  static Float add(Float a, Float b)
+  {
+    return _mm_add_ps(a, b);
+  }
+  static Float sub(Float a, Float b)
+  {
+    return _mm_sub_ps(a, b);
+  }
+  static Float mul(Float a, Float b)
+  {
+    return _mm_mul_ps(a, b);
+  }
+  static Float max(Float a, Float b)
+  {
+    return _mm_max_ps(a, b);
+  }
+  static Mask greater(Float a, Float b)
+  {
+    return _mm_cmpgt_ps(a, b);
+  }
+  static Mask greaterEqual(Float a, Float b)
+  {
+    return _mm_cmpge_ps(a, b);
+  }
+  static Mask maskAnd(Mask a, Mask b)
+  {
+    return _mm_and_ps(a, b);
+  }
+  static Mask maskOr(Mask a, Mask b)
+  {
+    return _mm_or_ps(a, b);
+  }
+  // !a && b
+  static Mask maskAndNot(Mask a, Mask b)
+  {
+    return _mm_andnot_ps(a, b);
+  }
+  static Float oneIf(Mask m)
+  {
+    return _mm_and_ps(m, splat(1.f));
+  }
+  static Float toFloat(Int v)
+  {
+    return _mm_cvtepi32_ps(v);
+  }
+  static Int truncate(Float v)
+  {
+    return _mm_cvttps_epi32(v);
+  }
+  static Int add(Int a, Int b)
+  {
+    return _mm_add_epi32(a, b);
+  }
+  // -1 where the mask is set, 0 elsewhere
+  static Int minusOneIf(Mask m)
+  {
+    return _mm_castps_si128(m);
+  }
+#else
+  static constexpr size_t Width = 1;
+  using Float                   = float;
+  using Int                     = int32_t;
+  using Mask                    = bool;
+
+  static Float load(const float* p)
+  {
+    return *p;
+  }
+  static void store(float* p, Float v)
+  {
+    *p = v;
+  }
+  static void store(int32_t* p, Int v)
+  {
+    *p = v;
+  }
+  static Float splat(float v)
+  {
+    return v;
+  }
+  static Float add(Float a, Float b)
+  {
+    return a + b;
+  }
+  static Float sub(Float a, Float b)
+  {
+    return a - b;
+  }
+  static Float mul(Float a, Float b)
+  {
+    return a * b;
+  }
+  static Float max(Float a, Float b)
+  {
+    return std::max(a, b);
+  }
+  static Mask greater(Float a, Float b)
+  {
+    return a > b;
+  }
+  static Mask greaterEqual(Float a, Float b)
+  {
+    return a >= b;
+  }
+  static Mask maskAnd(Mask a, Mask b)
+  {
+    return a && b;
+  }
+  static Mask maskOr(Mask a, Mask b)
+  {
+    return a || b;
+  }
+  // !a && b
+  static Mask maskAndNot(Mask a, Mask b)
+  {
+    return !a && b;
+  }
+  static Float oneIf(Mask m)
+  {
+    return m ? 1.f : 0.f;
+  }
+  static Float toFloat(Int v)
+  {
+    return static_cast<float>(v);
+  }
+  static Int truncate(Float v)
+  {
+    return static_cast<int32_t>(v);
+  }
+  static Int add(Int a, Int b)
+  {
+    return a + b;
+  }
+  // -1 where the mask is set, 0 elsewhere
+  static Int minusOneIf(Mask m)
+  {
+    return m ? -1 : 0;
+  }
+#endif
+
+  /**
+   * @brief Returns the amount of lanes filled by the next count points.
+   */
+  static size_t laneCount(size_t count)
+  {
+    return count < Width ? count : Width;
+  }
+
+  /**
+   * @brief Loads count (<= Width) floats, the remaining lanes are set to 0.
+   */
+  static Float load(const float* p, size_t count)
+  {
+    if (count == Width) {
+      return load(p);
+    }
+    std::array<float, Width> lanes{};
+    std::copy(p, p + count, lanes.begin());
+    return load(lanes.data());
+  }
+
+  /**
+   * @brief Stores the first count (<= Width) lanes of v.
+   */
+  static void store(float* p, Float v, size_t count)
+  {
+    if (count == Width) {
+      store(p, v);
+      return;
+    }
+    std::array<float, Width> lanes;
+    store(lanes.data(), v);
+    std::copy(lanes.begin(), lanes.begin() + count, p);
+  }
+
+  /**
+   * @brief Floor as computed by SimplexNoise::fastfloor, which also rounds
+   * the non positive integers down.
+   */
+  static Int fastFloor(Float v)
+  {
+    return add(truncate(v), minusOneIf(greaterEqual(splat(0.f), v)));
+  }
+
+  /**
+   * @brief Floor of the lanes.
+   */
+  static Int floor(Float v)
+  {
+    const auto t = truncate(v);
+    return add(t, minusOneIf(greater(toFloat(t), v)));
+  }
+
+  static Float dot(Float ax, Float ay, Float az, Float bx, Float by, Float bz)
+  {
+    return add(add(mul(ax, bx), mul(ay, by)), mul(az, bz));
+  }
+
+  /**
+   * @brief Returns the gradient of the 12 cube edge directions (with 4
+   * repeats) selected by the low 4 bits of hash, as used by the classic
+   * Perlin noise and the 3D simplex noise.
+   */
+  static const float* gradient3D(int hash)
+  {
+    static const float gradients[16][3]
+      = {{1.f, 1.f, 0.f},  {-1.f, 1.f, 0.f},  {1.f, -1.f, 0.f},
+         {-1.f, -1.f, 0.f}, {1.f, 0.f, 1.f},   {-1.f, 0.f, 1.f},
+         {1.f, 0.f, -1.f},  {-1.f, 0.f, -1.f}, {0.f, 1.f, 1.f},
+         {0.f, -1.f, 1.f},  {0.f, 1.f, -1.f},  {0.f, -1.f, -1.f},
+         {1.f, 1.f, 0.f},   {0.f, -1.f, 1.f},  {-1.f, 1.f, 0.f},
+         {0.f, -1.f, -1.f}};
+    return gradients[hash & 15];
+  }
+
+  /**
+   * @brief Returns the 3D simplex noise of Width points.
+   * @param x X coordinates.
+   * @param y Y coordinates.
+   * @param z Z coordinates.
+   * @param radius Squared radius of the contribution of a simplex corner.
+   * @param scale Factor applied to the sum of the contributions.
+   * @param useFastFloor Whether the cells are found with fastFloor() instead
+   * of floor().
+   * @param gradient Function returning the gradient (3 floats) of the lattice
+   * point (i, j, k), i, j and k being wrapped at 256 before the corner offsets
+   * are added.
+   */
+  template <typename Gradient>
+  static Float simplexNoise3D(Float x, Float y, Float z, float radius,
+                              float scale, bool useFastFloor,
+                              const Gradient& gradient)
+  {
+    const float F3 = 1.f / 3.f;
+    const float G3 = 1.f / 6.f;
+
+    // Skew the input space to determine which simplex cell we're in
+    const auto s  = mul(add(add(x, y), z), splat(F3));
+    const auto xs = add(x, s);
+    const auto ys = add(y, s);
+    const auto zs = add(z, s);
+    const auto i  = useFastFloor ? fastFloor(xs) : floor(xs);
+    const auto j  = useFastFloor ? fastFloor(ys) : floor(ys);
+    const auto k  = useFastFloor ? fastFloor(zs) : floor(zs);
+
+    // Unskew the cell origin back to (x,y,z) space
+    const auto t  = mul(toFloat(add(add(i, j), k)), splat(G3));
+    const auto x0 = sub(x, sub(toFloat(i), t));
+    const auto y0 = sub(y, sub(toFloat(j), t));
+    const auto z0 = sub(z, sub(toFloat(k), t));
+
+    // Rank ordering of x0, y0 and z0, giving the offsets of the second and
+    // third corners of the simplex
+    const auto one = splat(1.f);
+    const auto xy  = greaterEqual(x0, y0);
+    const auto yz  = greaterEqual(y0, z0);
+    const auto xz  = greaterEqual(x0, z0);
+    const auto i1  = oneIf(maskAnd(xy, xz));
+    const auto j1  = oneIf(maskAndNot(xy, yz));
+    const auto k1  = sub(one, oneIf(maskOr(xz, yz)));
+    const auto i2  = oneIf(maskOr(xy, xz));
+    const auto j2  = sub(one, oneIf(maskAndNot(yz, xy)));
+    const auto k2  = sub(one, oneIf(maskAnd(xz, yz)));
+
+    // The permutation table lookups are done lane by lane
+    std::array<int32_t, Width> ci, cj, ck;
+    std::array<std::array<float, Width>, 6> offsets;
+    store(ci.data(), i);
+    store(cj.data(), j);
+    store(ck.data(), k);
+    store(offsets[0].data(), i1);
+    store(offsets[1].data(), j1);
+    store(offsets[2].data(), k1);
+    store(offsets[3].data(), i2);
+    store(offsets[4].data(), j2);
+    store(offsets[5].data(), k2);
+
+    std::array<std::array<std::array<float, Width>, 3>, 4> g;
+    const auto gather = [&g](size_t corner, size_t lane, const float* v) {
+      g[corner][0][lane] = v[0];
+      g[corner][1][lane] = v[1];
+      g[corner][2][lane] = v[2];
+    };
+    for (size_t l = 0; l < Width; ++l) {
+      const int ii = ci[l] & 255;
+      const int jj = cj[l] & 255;
+      const int kk = ck[l] & 255;
+      gather(0, l, gradient(ii, jj, kk));
+      gather(1, l, gradient(ii + static_cast<int>(offsets[0][l]),
+                            jj + static_cast<int>(offsets[1][l]),
+                            kk + static_cast<int>(offsets[2][l])));
+      gather(2, l, gradient(ii + static_cast<int>(offsets[3][l]),
+                            jj + static_cast<int>(offsets[4][l]),
+                            kk + static_cast<int>(offsets[5][l])));
+      gather(3, l, gradient(ii + 1, jj + 1, kk + 1));
+    }
+
+    const auto contribution = [&g, radius](size_t corner, Float dx, Float dy,
+                                           Float dz) {
+      auto t0 = max(sub(splat(radius), dot(dx, dy, dz, dx, dy, dz)),
+                    splat(0.f));
+      t0 = mul(t0, t0);
+      t0 = mul(t0, t0);
+      return mul(t0, dot(load(g[corner][0].data()), load(g[corner][1].data()),
+                         load(g[corner][2].data()), dx, dy, dz));
+    };
+
+    const auto g1 = splat(G3);
+    const auto g2 = splat(2.f * G3);
+    const auto g3 = splat(3.f * G3 - 1.f);
+    const auto n0 = contribution(0, x0, y0, z0);
+    const auto n1 = contribution(1, add(sub(x0, i1), g1), add(sub(y0, j1), g1),
+                                 add(sub(z0, k1), g1));
+    const auto n2 = contribution(2, add(sub(x0, i2), g2), add(sub(y0, j2), g2),
+                                 add(sub(z0, k2), g2));
+    const auto n3
+      = contribution(3, add(x0, g3), add(y0, g3), add(z0, g3));
+
+    return mul(splat(scale), add(add(n0, n1), add(n2, n3)));
+  }
+
+}; // end of struct NoiseLanes
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_NOISE_GENERATION_NOISE_LANES_H
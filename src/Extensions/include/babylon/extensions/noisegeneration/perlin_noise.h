@@ -70,6 +70,19 @@ public:
    */
   double noise(double x, double y, double z) const;
 
+  /**
+   * @brief Computes the 3D Perlin noise values of count points, the points
+   * being processed NoiseLanes::Width at a time. The results match the single
+   * point function within float tolerance.
+   * @param x X values.
+   * @param y Y values.
+   * @param z Z values.
+   * @param result The count noise values.
+   * @param count The amount of points.
+   */
+  void noise(const double* x, const double* y, const double* z, double* result,
+             size_t count) const;
+
 private:
   // The permutation vector
   std::array<int, 512> p;
@@ -93,6 +106,9 @@ public:
 
   double noise(double x, double y, double z) const;
 
+  void noise(const double* x, const double* y, const double* z, double* result,
+             size_t count) const;
+
 private:
   PerlinNoise _perlinNoise;
   int _octaves;
@@ -372,6 +372,61 @@ public:
   float iqfBm(const Vector3& v, uint8_t octaves = 4, float lacunarity = 2.0f,
               float gain = 0.5f);
 
+  // ---------------------------------------------------------------------------
+  // Batched evaluation: the points are processed NoiseLanes::Width at a time
+  // and the results match the single point functions within float tolerance.
+
+  /**
+   * @brief Computes the 2D simplex noise of count points (x[i], y[i]).
+   */
+  void noise(const float* x, const float* y, float* result,
+             size_t count) const;
+
+  /**
+   * @brief Computes the 3D simplex noise of count points (x[i], y[i], z[i]).
+   */
+  void noise(const float* x, const float* y, const float* z, float* result,
+             size_t count) const;
+
+  /**
+   * @brief Computes the 2D simplex noise fractal brownian motion sum of count
+   * points (x[i], y[i]).
+   */
+  void fBm(const float* x, const float* y, float* result, size_t count,
+           uint8_t octaves = 4, float lacunarity = 2.0f,
+           float gain = 0.5f) const;
+
+  /**
+   * @brief Computes the 3D simplex noise fractal brownian motion sum of count
+   * points (x[i], y[i], z[i]).
+   */
+  void fBm(const float* x, const float* y, const float* z, float* result,
+           size_t count, uint8_t octaves = 4, float lacunarity = 2.0f,
+           float gain = 0.5f) const;
+
+  /**
+   * @brief Computes the 2D simplex noise fractal brownian motion sum of the
+   * width x height lattice points origin + (i * step.x, j * step.y), the rows
+   * being distributed over the available hardware threads.
+   * @param result The row major values, resized to width * height.
+   */
+  void fBmGrid(const Vector2& origin, const Vector2& step, size_t width,
+               size_t height, Float32Array& result, uint8_t octaves = 4,
+               float lacunarity = 2.0f, float gain = 0.5f) const;
+
+  /**
+   * @brief Computes the 3D simplex noise fractal brownian motion sum of the
+   * width x height x depth lattice points
+   * origin + (i * step.x, j * step.y, k * step.z), the rows being distributed
+   * over the available hardware threads.
+   * @param result The values at index (k * height + j) * width + i, resized to
+   * width * height * depth.
+   */
+  void fBmGrid(const Vector3& origin, const Vector3& step, size_t width,
+               size_t height, size_t depth, Float32Array& result,
+               uint8_t octaves = 4, float lacunarity = 2.0f,
+               float gain = 0.5f) const;
+
   // ---------------------------------------------------------------------------
 
   /**
@@ -9,24 +9,30 @@ namespace Extensions {
 template <typename T, typename priority_t>
 struct PriorityQueue {
   typedef std::pair<priority_t, T> PQElement;
-  std::priority_queue<PQElement, std::vector<PQElement>,
-                      std::greater<PQElement>>
-    elements;
+  // Binary min heap, kept in a vector so that its storage can be reused
+  std::vector<PQElement> elements;
 
   inline bool empty() const
   {
     return elements.empty();
   }
 
+  inline void clear()
+  {
+    elements.clear();
+  }
+
   inline void put(T item, priority_t priority)
   {
-    elements.emplace(priority, item);
+    elements.emplace_back(priority, item);
+    std::push_heap(elements.begin(), elements.end(), std::greater<PQElement>());
   }
 
   inline T get()
   {
-    T best_item = elements.top().second;
-    elements.pop();
+    std::pop_heap(elements.begin(), elements.end(), std::greater<PQElement>());
+    T best_item = elements.back().second;
+    elements.pop_back();
     return best_item;
   }
 }; // end of struct PriorityQueue
@@ -44,17 +50,58 @@ struct AStarNode {
   bool visited;
 }; // end of struct
 
+/**
+ * @brief The state of an A* search, which can be reused by successive searches
+ * to avoid allocating it for each of them.
+ *
+ * The node ids of the searched graphs must be indexes in the range
+ * [0, graph.size()). A state must not be shared by concurrent searches.
+ */
+template <typename NodeId>
+struct AStarSearchState {
+  PriorityQueue<NodeId, double> frontier;
+  std::vector<AStarNode<NodeId>> nodes;
+  // The search which last initialized each node
+  std::vector<std::size_t> generations;
+  std::size_t generation = 0;
+
+  /**
+   * @brief Prepares a new search over a graph of nodeCount nodes, the nodes of
+   * the previous search are discarded in constant time.
+   */
+  void reset(std::size_t nodeCount)
+  {
+    frontier.clear();
+    if (nodes.size() < nodeCount) {
+      nodes.resize(nodeCount);
+      generations.resize(nodeCount, 0);
+    }
+    ++generation;
+  }
+
+  AStarNode<NodeId>& operator[](NodeId id)
+  {
+    if (generations[id] != generation) {
+      generations[id] = generation;
+      nodes[id]       = AStarNode<NodeId>{0, 0.0, 0.0, false};
+    }
+    return nodes[id];
+  }
+}; // end of struct AStarSearchState
+
 template <typename Graph>
-std::vector<typename Graph::NodeId> AStarSearch(Graph& graph,
-                                                typename Graph::Node& start,
-                                                typename Graph::Node& goal)
+std::vector<typename Graph::NodeId>
+AStarSearch(const Graph& graph, const typename Graph::Node& start,
+            const typename Graph::Node& goal,
+            AStarSearchState<typename Graph::NodeId>& aStarNodes)
 {
+  typedef typename Graph::Node Node;
   typedef typename Graph::NodeId NodeId;
   std::vector<NodeId> path;
-  PriorityQueue<NodeId, double> frontier;
+  aStarNodes.reset(graph.size());
+  auto& frontier = aStarNodes.frontier;
   frontier.put(start.id, 0);
 
-  std::unordered_map<NodeId, AStarNode<NodeId>> aStarNodes(graph.size());
   aStarNodes[start.id] = AStarNode<NodeId>{
     start.id,                                 // cameFrom
     0.0,                                      // gScore
@@ -77,13 +124,10 @@ std::vector<typename Graph::NodeId> AStarSearch(Graph& graph,
       break;
     }
 
-    for (auto&& next : graph.neighbors(current)) {
+    for (const Node& next : graph.neighbors(current)) {
       // The distance from start to a neighbor
       const auto tentative_gScore
         = aStarNodes[current].gScore + graph.cost(current, next);
-      if (!aStarNodes.count(next.id)) {
-        aStarNodes[next.id] = AStarNode<NodeId>{0, 0.0, 0.0, false};
-      }
       auto& neighbor = aStarNodes[next.id];
       if (!neighbor.visited || tentative_gScore < neighbor.gScore) {
         neighbor.visited  = true;
@@ -98,6 +142,15 @@ std::vector<typename Graph::NodeId> AStarSearch(Graph& graph,
   return path;
 }
 
+template <typename Graph>
+std::vector<typename Graph::NodeId>
+AStarSearch(const Graph& graph, const typename Graph::Node& start,
+            const typename Graph::Node& goal)
+{
+  AStarSearchState<typename Graph::NodeId> aStarNodes;
+  return AStarSearch(graph, start, goal, aStarNodes);
+}
+
 } // end of namespace Extensions
 } // end of namespace BABYLON
 
@@ -0,0 +1,98 @@
+#ifndef BABYLON_EXTENSIONS_UTILS_PARALLEL_FOR_H
+#define BABYLON_EXTENSIONS_UTILS_PARALLEL_FOR_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/core/worker_pool.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * Default amount of elements processed by a single block of a parallel loop.
+ */
+static constexpr size_t ParallelBlockSize = 1024;
+
+/**
+ * @brief Sets the maximum amount of threads used by the parallel loops, 0
+ * meaning one thread per hardware thread (default).
+ */
+BABYLON_SHARED_EXPORT void setParallelThreadCount(size_t threadCount);
+
+/**
+ * @brief Returns the amount of threads used by the parallel loops.
+ */
+BABYLON_SHARED_EXPORT size_t getParallelThreadCount();
+
+/**
+ * @brief Calls function(begin, end, block) for each block of the range
+ * [0, count), the blocks being distributed over getParallelThreadCount()
+ * threads of the shared WorkerPool.
+ *
+ * The block boundaries only depend on count and blockSize, never on the
+ * amount of threads, so per-block results can be combined in block order to
+ * obtain results that are identical on every machine.
+ */
+template <typename Function>
+void parallelFor(size_t count, size_t blockSize, const Function& function)
+{
+  if (count == 0) {
+    return;
+  }
+
+  const size_t blockCount = (count + blockSize - 1) / blockSize;
+  WorkerPool::Shared().run(blockCount, getParallelThreadCount(),
+                           [&](size_t block) {
+                             const size_t begin = block * blockSize;
+                             function(begin, std::min(begin + blockSize, count),
+                                      block);
+                           });
+}
+
+/**
+ * @brief Calls function(i) for each index of the range [0, count), in
+ * parallel.
+ */
+template <typename Function>
+void parallelFor(size_t count, const Function& function)
+{
+  parallelFor(count, ParallelBlockSize,
+              [&function](size_t begin, size_t end, size_t /*block*/) {
+                for (size_t i = begin; i < end; ++i) {
+                  function(i);
+                }
+              });
+}
+
+/**
+ * @brief Returns the sum of function(i) over the range [0, count), computed
+ * in parallel.
+ *
+ * The partial sums of the blocks are added in block order, so the result
+ * does not depend on the amount of threads.
+ */
+template <typename Function>
+float parallelSum(size_t count, const Function& function)
+{
+  const size_t blockCount
+    = (count + ParallelBlockSize - 1) / ParallelBlockSize;
+  Float32Array blockSums(blockCount, 0.f);
+  parallelFor(count, ParallelBlockSize,
+              [&function, &blockSums](size_t begin, size_t end, size_t block) {
+                float sum = 0.f;
+                for (size_t i = begin; i < end; ++i) {
+                  sum += function(i);
+                }
+                blockSums[block] = sum;
+              });
+
+  float sum = 0.f;
+  for (auto blockSum : blockSums) {
+    sum += blockSum;
+  }
+  return sum;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_UTILS_PARALLEL_FOR_H
@@ -4,6 +4,7 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/engine/scene.h>
 #include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
+#include <babylon/extensions/utils/parallel_for.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/mesh_builder.h>
 #include <babylon/mesh/vertex_buffer.h>
@@ -16,6 +17,8 @@ namespace Extensions {
 DynamicTerrain::DynamicTerrain(const std::string& iName,
                                DynamicTerrainOptions& options, Scene* scene)
     : name{iName}
+    , _mapNormalsComputed{false}
+    , _invertSide{options.invertSide}
     , _subToleranceX{1}
     , _subToleranceZ{1}
     , _initialLOD{1}
@@ -28,12 +31,20 @@ DynamicTerrain::DynamicTerrain(const std::string& iName,
     , _signZ{0}
     , _deltaSubX{0}
     , _deltaSubZ{0}
+    , _lastDeltaSubX{0}
+    , _lastDeltaSubZ{0}
+    , _lastLODValue{0}
+    , _geomorphFrames{0}
+    , _geomorphRemaining{0}
+    , _geomorphStart{0}
+    , _geomorphing{false}
     , _mapShiftX{0.f}
     , _mapShiftZ{0.f}
     , _mapFlgtNb{0}
     , _needsUpdate{false}
     , _updateLOD{false}
     , _updateForced{false}
+    , _needsFullUpdate{true}
     , _refreshEveryFrame{false}
     , _useCustomVertexFunction{false}
     , _computeNormals{true}
@@ -171,6 +182,10 @@ DynamicTerrain::DynamicTerrain(const std::string& iName,
   _uvs       = _terrain->getVerticesData(VertexBuffer::UVKind);
   _colors    = _terrain->getVerticesData(VertexBuffer::ColorKind);
 
+  if (_computeNormals && _mapNormals.empty()) {
+    _computeMapNormals();
+  }
+
   // update it immediatly and register the update callback function in the
   // render loop
   update(true);
@@ -212,6 +227,12 @@ void DynamicTerrain::update(bool force)
   _cameraLODCorrection = updateCameraLOD(_terrainCamera);
   _updateLOD           = (_oldCorrection != _cameraLODCorrection);
 
+  // a running geomorphing advances by one frame on each update
+  _geomorphing = (_geomorphRemaining > 0);
+  if (_geomorphing) {
+    --_geomorphRemaining;
+  }
+
   _LODValue  = _initialLOD + _cameraLODCorrection;
   _LODValue  = (_LODValue > 0) ? _LODValue : 1;
   _mapShiftX = _averageSubSizeX * _subToleranceX * _LODValue;
@@ -224,7 +245,7 @@ void DynamicTerrain::update(bool force)
     if (_signX == 1) {
       _deltaSubX += (_subToleranceX * _LODValue * _mapFlgtNb);
     }
-    else if (_signZ == -1) {
+    else if (_signX == -1) {
       _deltaSubX -= (_subToleranceX * _LODValue * _mapFlgtNb);
     }
     _needsUpdate = true;
@@ -246,6 +267,12 @@ void DynamicTerrain::update(bool force)
     _deltaSubZ = _mod(_deltaSubZ, _mapSubZ);
     _updateTerrain();
   }
+  else if (_geomorphing) {
+    _applyGeomorph();
+    _updateBoundingBox();
+    _terrain->updateVerticesData(VertexBuffer::PositionKind, _positions, false,
+                                 false);
+  }
   _updateForced  = false;
   _updateLOD     = false;
   _centerLocal.x = _terrainHalfSizeX;
@@ -258,187 +285,438 @@ void DynamicTerrain::update(bool force)
 
 void DynamicTerrain::_updateTerrain()
 {
-  unsigned int stepJ        = 0;
-  unsigned int stepI        = 0;
-  unsigned int LODLimitDown = 0;
-  unsigned int LODLimitUp   = 0;
-  unsigned int LODValue     = _LODValue;
-  unsigned int lodI         = LODValue;
-  unsigned int lodJ         = LODValue;
-  unsigned int l            = 0;
-  unsigned int index        = 0; // current vertex index in the map data array
-  unsigned int posIndex     = 0; // current position index in the map data array
-  unsigned int colIndex     = 0; // current index in the map color array
-  unsigned int uvIndex      = 0; // current index in the map uv array
-  unsigned int terIndex = 0;  // current vertex index in the terrain map array
-                              // when used as a data map
-  unsigned int ribbonInd = 0; // current ribbon vertex index
-  unsigned int ribbonPosInd
-    = 0; // current ribbon position index (same than normal index)
-  unsigned int ribbonUVInd   = 0; // current ribbon UV index
-  unsigned int ribbonColInd  = 0; // current ribbon color index
-  unsigned int ribbonPosInd1 = 0;
-  unsigned int ribbonPosInd2 = 0;
-  unsigned int ribbonPosInd3 = 0;
-  // note : all the indexes are explicitly set as integers for the js optimizer
-  // (store them all in the stack)
-
   if (_updateLOD || _updateForced) {
     updateTerrainSize();
   }
-  Vector3::FromFloatsToRef(std::numeric_limits<float>::max(),
-                           std::numeric_limits<float>::max(),
-                           std::numeric_limits<float>::max(), _bbMin);
-  Vector3::FromFloatsToRef(-std::numeric_limits<float>::max(),
-                           -std::numeric_limits<float>::max(),
-                           -std::numeric_limits<float>::max(), _bbMax);
 
-  for (unsigned int j = 0; j <= _terrainSub; ++j) {
-    // LOD Z
-    LODValue = _LODValue;
-    for (l = 0; l < _LODLimits.size(); ++l) {
-      LODLimitDown = _LODLimits[l];
-      LODLimitUp   = _terrainSub - LODLimitDown - 1;
-      if (j < LODLimitDown || j > LODLimitUp) {
-        LODValue = l + 1 + _LODValue;
+  // the vertices can be shifted in place only if they all have the same LOD,
+  // the user function doesn't change them and they are not being morphed
+  int shiftX = 0;
+  int shiftZ = 0;
+  const bool incremental
+    = !_needsFullUpdate && !_useCustomVertexFunction && _LODLimits.empty()
+      && _LODValue == _lastLODValue && !_geomorphing
+      && _vertexShift(_lastDeltaSubX, _deltaSubX, _mapSubX, shiftX)
+      && _vertexShift(_lastDeltaSubZ, _deltaSubZ, _mapSubZ, shiftZ);
+  if (incremental && shiftX == 0 && shiftZ == 0) {
+    return; // nothing to upload
+  }
+
+  const bool updateNormals = !_mapNormals.empty();
+  const bool updateColors  = _colormap || _useCustomVertexFunction;
+  const size_t rowBlockSize
+    = _useCustomVertexFunction ? // the user function is called sequentially
+        _terrainIdx :
+        std::max<size_t>(1, ParallelBlockSize / _terrainIdx);
+
+  if (incremental) {
+    _shiftVertexData(_positions, 3, 1, 1, shiftX, shiftZ);
+    if (updateNormals) {
+      _shiftVertexData(_normals, 3, 0, 3, shiftX, shiftZ);
+    }
+    if (updateColors) {
+      _shiftVertexData(_colors, 4, 0, 4, shiftX, shiftZ);
+    }
+    _shiftVertexData(_uvs, 2, 0, 2, shiftX, shiftZ);
+
+    // only read the rows and columns which scrolled in from the maps
+    const int size = static_cast<int>(_terrainIdx);
+    const int iMin = std::max(0, -shiftX);
+    const int iMax = std::min(size, size - shiftX);
+    const int jMin = std::max(0, -shiftZ);
+    const int jMax = std::min(size, size - shiftZ);
+    parallelFor(_terrainIdx, rowBlockSize,
+                [&](size_t begin, size_t end, size_t /*block*/) {
+                  for (int j = static_cast<int>(begin);
+                       j < static_cast<int>(end); ++j) {
+                    const bool newRow = (j < jMin || j >= jMax);
+                    for (int i = 0; i < size; ++i) {
+                      if (newRow || i < iMin || i >= iMax) {
+                        _updateVertex(static_cast<unsigned>(i),
+                                      static_cast<unsigned>(j));
+                      }
+                    }
+                  }
+                });
+  }
+  else {
+    // the heights displayed before a LOD change are kept to be morphed from
+    const bool lodChanged = (_LODValue != _lastLODValue);
+    const bool geomorph   = _geomorphFrames > 0 && _lastLODValue > 0
+                          && !_needsFullUpdate && (lodChanged || _geomorphing);
+    Uint32Array oldSteps;
+    Float32Array oldHeights;
+    if (geomorph) {
+      oldSteps = _vertexSteps;
+      oldHeights.resize(_terrainIdx * _terrainIdx);
+      for (size_t p = 0; p < oldHeights.size(); ++p) {
+        oldHeights[p] = _positions[3 * p + 1];
       }
-      lodJ = LODValue;
     }
 
-    for (unsigned int i = 0; i <= _terrainSub; ++i) {
-      // LOD X
-      LODValue = _LODValue;
-      for (l = 0; l < _LODLimits.size(); ++l) {
-        LODLimitDown = _LODLimits[l];
-        LODLimitUp   = _terrainSub - LODLimitDown - 1;
-        if (i < LODLimitDown || i > LODLimitUp) {
-          LODValue = l + 1 + _LODValue;
-        }
-        lodI = LODValue;
-      }
+    _updateVertexSteps();
+    parallelFor(_terrainIdx, rowBlockSize,
+                [this](size_t begin, size_t end, size_t /*block*/) {
+                  for (size_t j = begin; j < end; ++j) {
+                    for (unsigned int i = 0; i <= _terrainSub; ++i) {
+                      _updateVertex(i, static_cast<unsigned>(j));
+                    }
+                  }
+                });
+
+    if (geomorph) {
+      _startGeomorph(oldSteps, oldHeights, lodChanged);
+      _applyGeomorph();
+    }
+    else {
+      _geomorphRemaining = 0;
+    }
+  }
 
-      // map current index
-      index = _mod(_deltaSubZ + stepJ, _mapSubZ) * _mapSubX
-              + _mod(_deltaSubX + stepI, _mapSubX);
-      terIndex = _mod(_deltaSubZ + stepJ, _terrainIdx) * _terrainIdx
-                 + _mod(_deltaSubX + stepI, _terrainIdx);
+  _needsFullUpdate = false;
+  _lastDeltaSubX   = _deltaSubX;
+  _lastDeltaSubZ   = _deltaSubZ;
+  _lastLODValue    = _LODValue;
+  _updateBoundingBox();
 
-      // related index in the array of positions (data map)
-      if (_datamap) {
-        posIndex = 3 * index;
-      }
-      else {
-        posIndex = 3 * terIndex;
+  // ribbon update : only the buffers that changed are uploaded
+  _terrain->updateVerticesData(VertexBuffer::PositionKind, _positions, false,
+                               false);
+  if (updateNormals) {
+    _terrain->updateVerticesData(VertexBuffer::NormalKind, _normals, false,
+                                 false);
+  }
+  _terrain->updateVerticesData(VertexBuffer::UVKind, _uvs, false, false);
+  if (updateColors) {
+    _terrain->updateVerticesData(VertexBuffer::ColorKind, _colors, false,
+                                 false);
+  }
+}
+
+void DynamicTerrain::_updateVertexSteps()
+{
+  _vertexSteps.resize(_terrainIdx);
+  _vertexLODs.resize(_terrainIdx);
+  unsigned int step = 0;
+  for (unsigned int k = 0; k <= _terrainSub; ++k) {
+    unsigned int LODValue = _LODValue;
+    for (unsigned int l = 0; l < _LODLimits.size(); ++l) {
+      const unsigned int LODLimitDown = _LODLimits[l];
+      const unsigned int LODLimitUp   = _terrainSub - LODLimitDown - 1;
+      if (k < LODLimitDown || k > LODLimitUp) {
+        LODValue = l + 1 + _LODValue;
       }
-      // related index in the UV map
-      if (_uvmap) {
-        uvIndex = 2 * index;
+    }
+    _vertexSteps[k] = step;
+    _vertexLODs[k]  = LODValue;
+    step += LODValue;
+  }
+}
+
+void DynamicTerrain::_updateVertex(unsigned int i, unsigned int j)
+{
+  const unsigned int stepI = _vertexSteps[i];
+  const unsigned int stepJ = _vertexSteps[j];
+
+  // map current index
+  const unsigned int index = _mod(_deltaSubZ + stepJ, _mapSubZ) * _mapSubX
+                             + _mod(_deltaSubX + stepI, _mapSubX);
+  // current vertex index in the terrain map array when used as a data map
+  const unsigned int terIndex
+    = _mod(_deltaSubZ + stepJ, _terrainIdx) * _terrainIdx
+      + _mod(_deltaSubX + stepI, _terrainIdx);
+  // related indexes in the data, UV and color maps
+  const unsigned int posIndex = 3 * (_datamap ? index : terIndex);
+  const unsigned int uvIndex  = 2 * (_uvmap ? index : terIndex);
+  const unsigned int colIndex = 3 * (_colormap ? index : terIndex);
+  // ribbon indexes
+  const unsigned int ribbonInd     = j * _terrainIdx + i;
+  const unsigned int ribbonPosInd1 = 3 * ribbonInd;
+  const unsigned int ribbonPosInd2 = ribbonPosInd1 + 1;
+  const unsigned int ribbonPosInd3 = ribbonPosInd1 + 2;
+  const unsigned int ribbonColInd  = 4 * ribbonInd;
+  const unsigned int ribbonUVInd   = 2 * ribbonInd;
+
+  // geometry
+  _positions[ribbonPosInd1] = _averageSubSizeX * stepI;
+  _positions[ribbonPosInd2] = _mapData[posIndex + 1];
+  _positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
+
+  if (!_mapNormals.empty()) {
+    _normals[ribbonPosInd1] = _mapNormals[posIndex];
+    _normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
+    _normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
+  }
+
+  // color
+  if (_colormap) {
+    _colors[ribbonColInd]     = _mapColors[colIndex];
+    _colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
+    _colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
+  }
+  // uv : the array _mapUVs is always populated
+  _uvs[ribbonUVInd]     = _mapUVs[uvIndex];
+  _uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
+
+  // call to user custom function with the current updated vertex object
+  if (_useCustomVertexFunction) {
+    _vertex.position.copyFromFloats(_positions[ribbonPosInd1],
+                                    _positions[ribbonPosInd2],
+                                    _positions[ribbonPosInd3]);
+    _vertex.worldPosition.x = _mapData[posIndex];
+    _vertex.worldPosition.y = _vertex.position.y;
+    _vertex.worldPosition.z = _mapData[posIndex + 2];
+    _vertex.lodX            = _vertexLODs[i];
+    _vertex.lodZ            = _vertexLODs[j];
+    _vertex.color.r         = _colors[ribbonColInd];
+    _vertex.color.g         = _colors[ribbonColInd + 1];
+    _vertex.color.b         = _colors[ribbonColInd + 2];
+    _vertex.color.a         = _colors[ribbonColInd + 3];
+    _vertex.uvs.x           = _uvs[ribbonUVInd];
+    _vertex.uvs.y           = _uvs[ribbonUVInd + 1];
+    _vertex.mapIndex        = index;
+    updateVertex(_vertex, i, j); // the user can modify the array values here
+    _colors[ribbonColInd]     = _vertex.color.r;
+    _colors[ribbonColInd + 1] = _vertex.color.g;
+    _colors[ribbonColInd + 2] = _vertex.color.b;
+    _colors[ribbonColInd + 3] = _vertex.color.a;
+    _uvs[ribbonUVInd]         = _vertex.uvs.x;
+    _uvs[ribbonUVInd + 1]     = _vertex.uvs.y;
+    _positions[ribbonPosInd1] = _vertex.position.x;
+    _positions[ribbonPosInd2] = _vertex.position.y;
+    _positions[ribbonPosInd3] = _vertex.position.z;
+  }
+}
+
+bool DynamicTerrain::_vertexShift(unsigned int oldDeltaSub,
+                                  unsigned int deltaSub, unsigned int mapSub,
+                                  int& shift) const
+{
+  const int LODValue = static_cast<int>(_LODValue);
+  const int size     = static_cast<int>(_terrainIdx);
+  const int map      = static_cast<int>(mapSub);
+  const int delta
+    = static_cast<int>(deltaSub) - static_cast<int>(oldDeltaSub);
+  // the terrain may have scrolled over the map border
+  for (const int subs : {delta, delta - map, delta + map}) {
+    if (subs % LODValue != 0 || std::abs(subs / LODValue) >= size) {
+      continue;
+    }
+    // the maps indexed as terrain maps wrap on the terrain size
+    const bool terrainMaps = !_datamap || !_uvmap;
+    if (terrainMaps && (delta - subs) % size != 0) {
+      continue;
+    }
+    shift = subs / LODValue;
+    return true;
+  }
+  return false;
+}
+
+void DynamicTerrain::_shiftVertexData(Float32Array& data, unsigned int stride,
+                                      unsigned int first, unsigned int count,
+                                      int shiftX, int shiftZ)
+{
+  const int size   = static_cast<int>(_terrainIdx);
+  const int iMin   = std::max(0, -shiftX);
+  const int iMax   = std::min(size, size - shiftX);
+  const int jMin   = std::max(0, -shiftZ);
+  const int jMax   = std::min(size, size - shiftZ);
+  const int offset = (shiftZ * size + shiftX) * static_cast<int>(stride);
+  const auto shiftRow = [&](int j) {
+    float* to   = data.data() + (j * size + iMin) * static_cast<int>(stride);
+    float* from = to + offset;
+    if (count == stride) { // the whole vertex data is contiguous
+      const int rowLength = (iMax - iMin) * static_cast<int>(stride);
+      if (offset > 0) {
+        std::copy(from, from + rowLength, to);
       }
       else {
-        uvIndex = 2 * terIndex;
+        std::copy_backward(from, from + rowLength, to + rowLength);
       }
-      // related index in the color map
-      if (_colormap) {
-        colIndex = 3 * index;
+      return;
+    }
+    if (offset > 0) {
+      for (int i = iMin; i < iMax; ++i, to += stride, from += stride) {
+        std::copy(from + first, from + first + count, to + first);
       }
-      else {
-        colIndex = 3 * terIndex;
+    }
+    else {
+      to += (iMax - iMin - 1) * static_cast<int>(stride);
+      from += (iMax - iMin - 1) * static_cast<int>(stride);
+      for (int i = iMax - 1; i >= iMin; --i, to -= stride, from -= stride) {
+        std::copy(from + first, from + first + count, to + first);
       }
-      // ribbon indexes
-      ribbonPosInd  = 3 * ribbonInd;
-      ribbonColInd  = 4 * ribbonInd;
-      ribbonUVInd   = 2 * ribbonInd;
-      ribbonPosInd1 = ribbonPosInd;
-      ribbonPosInd2 = ribbonPosInd + 1;
-      ribbonPosInd3 = ribbonPosInd + 2;
-      ribbonInd += 1;
+    }
+  };
+  // the rows are moved in the order that reads each one before it is
+  // overwritten
+  if (offset > 0) {
+    for (int j = jMin; j < jMax; ++j) {
+      shiftRow(j);
+    }
+  }
+  else if (offset < 0) {
+    for (int j = jMax - 1; j >= jMin; --j) {
+      shiftRow(j);
+    }
+  }
+}
 
-      // geometry
-      _positions[ribbonPosInd1] = _averageSubSizeX * stepI;
-      _positions[ribbonPosInd2] = _mapData[posIndex + 1];
-      _positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
-
-      if (!_mapNormals.empty()) {
-        _normals[ribbonPosInd1] = _mapNormals[posIndex];
-        _normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
-        _normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
+void DynamicTerrain::_computeMapNormals()
+{
+  // a terrain without data map is morphed on a flat map of the terrain size
+  const unsigned int subX = _datamap ? _mapSubX : _terrainIdx;
+  const unsigned int subZ = _datamap ? _mapSubZ : _terrainIdx;
+  const float side        = _invertSide ? -1.f : 1.f;
+  _mapNormals.resize(3 * subX * subZ);
+
+  const auto point = [this, subX](unsigned int col, unsigned int row) {
+    const unsigned int idx = 3 * (row * subX + col);
+    return Vector3(_mapData[idx], _mapData[idx + 1], _mapData[idx + 2]);
+  };
+  parallelFor(
+    subZ, std::max<size_t>(1, ParallelBlockSize / subX),
+    [&](size_t begin, size_t end, size_t /*block*/) {
+      for (unsigned int row = static_cast<unsigned>(begin); row < end; ++row) {
+        const unsigned int down = (row > 0) ? row - 1 : row;
+        const unsigned int up   = (row + 1 < subZ) ? row + 1 : row;
+        for (unsigned int col = 0; col < subX; ++col) {
+          const unsigned int left  = (col > 0) ? col - 1 : col;
+          const unsigned int right = (col + 1 < subX) ? col + 1 : col;
+          // central differences, one-sided on the map borders
+          const auto alongX = point(right, row).subtract(point(left, row));
+          const auto alongZ = point(col, up).subtract(point(col, down));
+          auto normal       = Vector3::Cross(alongZ, alongX);
+          normal.normalize();
+          // the map may be ordered along decreasing x or z
+          if (normal.y < 0.f) {
+            normal.scaleInPlace(-1.f);
+          }
+          else if (stl_util::almost_equal(normal.lengthSquared(), 0.f)) {
+            normal.y = 1.f;
+          }
+          const unsigned int idx = 3 * (row * subX + col);
+          _mapNormals[idx]       = side * normal.x;
+          _mapNormals[idx + 1]   = side * normal.y;
+          _mapNormals[idx + 2]   = side * normal.z;
+        }
       }
+    });
+  _mapNormalsComputed = true;
+}
 
-      // bbox internal update
-      if (_positions[ribbonPosInd1] < _bbMin.x) {
-        _bbMin.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd1] > _bbMax.x) {
-        _bbMax.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd2] < _bbMin.y) {
-        _bbMin.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd2] > _bbMax.y) {
-        _bbMax.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd3] < _bbMin.z) {
-        _bbMin.z = _positions[ribbonPosInd3];
-      }
-      if (_positions[ribbonPosInd3] > _bbMax.z) {
-        _bbMax.z = _positions[ribbonPosInd3];
-      }
-      // color
-      if (_colormap) {
-        _colors[ribbonColInd]     = _mapColors[colIndex];
-        _colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
-        _colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
-      }
-      // uv : the array _mapUVs is always populated
-      _uvs[ribbonUVInd]     = _mapUVs[uvIndex];
-      _uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
-
-      // call to user custom function with the current updated vertex object
-      if (_useCustomVertexFunction) {
-        _vertex.position.copyFromFloats(_positions[ribbonPosInd1],
-                                        _positions[ribbonPosInd2],
-                                        _positions[ribbonPosInd3]);
-        _vertex.worldPosition.x = _mapData[posIndex];
-        _vertex.worldPosition.y = _vertex.position.y;
-        _vertex.worldPosition.z = _mapData[posIndex + 2];
-        _vertex.lodX            = lodI;
-        _vertex.lodZ            = lodJ;
-        _vertex.color.r         = _colors[ribbonColInd];
-        _vertex.color.g         = _colors[ribbonColInd + 1];
-        _vertex.color.b         = _colors[ribbonColInd + 2];
-        _vertex.color.a         = _colors[ribbonColInd + 3];
-        _vertex.uvs.x           = _uvs[ribbonUVInd];
-        _vertex.uvs.y           = _uvs[ribbonUVInd + 1];
-        _vertex.mapIndex        = index;
-        updateVertex(_vertex, i,
-                     j); // the user can modify the array values here
-        _colors[ribbonColInd]     = _vertex.color.r;
-        _colors[ribbonColInd + 1] = _vertex.color.g;
-        _colors[ribbonColInd + 2] = _vertex.color.b;
-        _colors[ribbonColInd + 3] = _vertex.color.a;
-        _uvs[ribbonUVInd]         = _vertex.uvs.x;
-        _uvs[ribbonUVInd + 1]     = _vertex.uvs.y;
-        _positions[ribbonPosInd1] = _vertex.position.x;
-        _positions[ribbonPosInd2] = _vertex.position.y;
-        _positions[ribbonPosInd3] = _vertex.position.z;
-      }
+void DynamicTerrain::_startGeomorph(const Uint32Array& oldSteps,
+                                    const Float32Array& oldHeights,
+                                    bool restart)
+{
+  if (restart) {
+    _geomorphRemaining = _geomorphFrames;
+    _geomorphStart     = _geomorphFrames;
+  }
+  else {
+    // the running geomorphing continues from the displayed heights over its
+    // remaining frames
+    _geomorphStart = _geomorphRemaining + 1;
+  }
 
-      stepI += lodI;
+  // locates a map subdivision offset, relative to the previous terrain
+  // origin, in the previous vertex steps
+  const auto locate = [this, &oldSteps](int offset, unsigned int mapSub,
+                                        unsigned int& k, float& t) {
+    offset = _mod(offset, static_cast<int>(mapSub));
+    if (offset > static_cast<int>(oldSteps[_terrainSub])) {
+      return false;
     }
-    stepI = 0;
-    stepJ += lodJ;
+    const auto it = std::upper_bound(oldSteps.begin(), oldSteps.end(),
+                                     static_cast<unsigned>(offset));
+    k = std::min(static_cast<unsigned>(it - oldSteps.begin()) - 1,
+                 _terrainSub - 1);
+    t = static_cast<float>(static_cast<unsigned>(offset) - oldSteps[k])
+        / (oldSteps[k + 1] - oldSteps[k]);
+    return true;
+  };
+
+  _geomorphFromHeights.resize(_terrainIdx * _terrainIdx);
+  _geomorphToHeights.resize(_terrainIdx * _terrainIdx);
+  parallelFor(
+    _terrainIdx, std::max<size_t>(1, ParallelBlockSize / _terrainIdx),
+    [&](size_t begin, size_t end, size_t /*block*/) {
+      for (unsigned int j = static_cast<unsigned>(begin); j < end; ++j) {
+        for (unsigned int i = 0; i <= _terrainSub; ++i) {
+          const unsigned int p = j * _terrainIdx + i;
+          const float to       = _positions[3 * p + 1];
+          float from           = to;
+          unsigned int k = 0, l = 0;
+          float tx = 0.f, tz = 0.f;
+          // the vertices out of the previous terrain are not morphed
+          if (locate(static_cast<int>(_deltaSubX + _vertexSteps[i])
+                       - static_cast<int>(_lastDeltaSubX),
+                     _mapSubX, k, tx)
+              && locate(static_cast<int>(_deltaSubZ + _vertexSteps[j])
+                          - static_cast<int>(_lastDeltaSubZ),
+                        _mapSubZ, l, tz)) {
+            const unsigned int q = l * _terrainIdx + k;
+            const float h0       = oldHeights[q]
+                             + (oldHeights[q + 1] - oldHeights[q]) * tx;
+            const float h1 = oldHeights[q + _terrainIdx]
+                             + (oldHeights[q + _terrainIdx + 1]
+                                - oldHeights[q + _terrainIdx])
+                                 * tx;
+            from = h0 + (h1 - h0) * tz;
+          }
+          _geomorphFromHeights[p] = from;
+          _geomorphToHeights[p]   = to;
+        }
+      }
+    });
+}
+
+void DynamicTerrain::_applyGeomorph()
+{
+  const float weight
+    = static_cast<float>(_geomorphRemaining) / _geomorphStart;
+  for (size_t p = 0; p < _geomorphToHeights.size(); ++p) {
+    _positions[3 * p + 1]
+      = _geomorphToHeights[p]
+        + (_geomorphFromHeights[p] - _geomorphToHeights[p]) * weight;
   }
+}
 
-  // ribbon update
-  _terrain->updateVerticesData(VertexBuffer::PositionKind, _positions, false,
-                               false);
-  if (_computeNormals && !_mapNormals.empty()) {
-    VertexData::ComputeNormals(_positions, _indices, _normals);
+void DynamicTerrain::_updateBoundingBox()
+{
+  // the user function may move the vertices, so x and z are searched too
+  const size_t rowBlockSize
+    = std::max<size_t>(1, ParallelBlockSize / _terrainIdx);
+  const size_t blockCount = (_terrainIdx + rowBlockSize - 1) / rowBlockSize;
+  std::vector<Vector3> blockMin(blockCount);
+  std::vector<Vector3> blockMax(blockCount);
+  parallelFor(_terrainIdx, rowBlockSize,
+              [&](size_t begin, size_t end, size_t block) {
+                Vector3 min(std::numeric_limits<float>::max(),
+                            std::numeric_limits<float>::max(),
+                            std::numeric_limits<float>::max());
+                Vector3 max(-std::numeric_limits<float>::max(),
+                            -std::numeric_limits<float>::max(),
+                            -std::numeric_limits<float>::max());
+                for (size_t p = begin * _terrainIdx; p < end * _terrainIdx;
+                     ++p) {
+                  const Vector3 position(_positions[3 * p],
+                                         _positions[3 * p + 1],
+                                         _positions[3 * p + 2]);
+                  min.minimizeInPlace(position);
+                  max.maximizeInPlace(position);
+                }
+                blockMin[block] = min;
+                blockMax[block] = max;
+              });
+
+  _bbMin = blockMin[0];
+  _bbMax = blockMax[0];
+  for (size_t block = 1; block < blockCount; ++block) {
+    _bbMin.minimizeInPlace(blockMin[block]);
+    _bbMax.maximizeInPlace(blockMax[block]);
   }
-  _terrain->updateVerticesData(VertexBuffer::NormalKind, _normals, false,
-                               false);
-  _terrain->updateVerticesData(VertexBuffer::UVKind, _uvs, false, false);
-  _terrain->updateVerticesData(VertexBuffer::ColorKind, _colors, false, false);
   _terrain->_boundingInfo = std::make_unique<BoundingInfo>(_bbMin, _bbMax);
   _terrain->_boundingInfo->update(*_terrain->_worldMatrix);
 }
@@ -664,7 +942,8 @@ const Uint32Array& DynamicTerrain::LODLimits() const
 void DynamicTerrain::LODLimits(Uint32Array ar)
 {
   std::sort(ar.begin(), ar.end(), std::greater<std::uint32_t>());
-  _LODLimits = std::move(ar);
+  _LODLimits       = std::move(ar);
+  _needsFullUpdate = true;
 }
 
 const Float32Array& DynamicTerrain::mapData() const
@@ -680,6 +959,10 @@ void DynamicTerrain::setMapData(const Float32Array& val)
     = std::abs(_mapData[(_mapSubZ - 1) * _mapSubX * 3 + 2] - _mapData[2]);
   _averageSubSizeX = _mapSizeX / _mapSubX;
   _averageSubSizeZ = _mapSizeZ / _mapSubZ;
+  if (_mapNormalsComputed) {
+    _computeMapNormals();
+  }
+  _needsFullUpdate = true;
   update(true);
 }
 
@@ -690,7 +973,8 @@ unsigned int DynamicTerrain::mapSubX() const
 
 void DynamicTerrain::setMapSubX(unsigned int val)
 {
-  _mapSubX = val;
+  _mapSubX         = val;
+  _needsFullUpdate = true;
 }
 
 unsigned int DynamicTerrain::mapSubZ() const
@@ -700,7 +984,8 @@ unsigned int DynamicTerrain::mapSubZ() const
 
 void DynamicTerrain::setMapSubZ(unsigned int val)
 {
-  _mapSubZ = val;
+  _mapSubZ         = val;
+  _needsFullUpdate = true;
 }
 
 const Float32Array& DynamicTerrain::mapColors() const
@@ -710,7 +995,8 @@ const Float32Array& DynamicTerrain::mapColors() const
 
 void DynamicTerrain::setMapColors(const Float32Array& val)
 {
-  _mapColors = val;
+  _mapColors       = val;
+  _needsFullUpdate = true;
 }
 
 const Float32Array& DynamicTerrain::mapUVs() const
@@ -720,7 +1006,8 @@ const Float32Array& DynamicTerrain::mapUVs() const
 
 void DynamicTerrain::setMapUVs(const Float32Array& val)
 {
-  _mapUVs = val;
+  _mapUVs          = val;
+  _needsFullUpdate = true;
 }
 
 const Float32Array& DynamicTerrain::mapNormals() const
@@ -730,7 +1017,12 @@ const Float32Array& DynamicTerrain::mapNormals() const
 
 void DynamicTerrain::setMapNormals(const Float32Array& val)
 {
-  _mapNormals = val;
+  _mapNormals         = val;
+  _mapNormalsComputed = false;
+  if (_computeNormals && _mapNormals.empty()) {
+    _computeMapNormals();
+  }
+  _needsFullUpdate = true;
 }
 
 bool DynamicTerrain::computeNormals() const
@@ -741,6 +1033,10 @@ bool DynamicTerrain::computeNormals() const
 void DynamicTerrain::setComputeNormals(bool val)
 {
   _computeNormals = val;
+  if (_computeNormals && _mapNormals.empty()) {
+    _computeMapNormals();
+    _needsFullUpdate = true;
+  }
 }
 
 bool DynamicTerrain::useCustomVertexFunction() const
@@ -751,6 +1047,17 @@ bool DynamicTerrain::useCustomVertexFunction() const
 void DynamicTerrain::useCustomVertexFunction(bool val)
 {
   _useCustomVertexFunction = val;
+  _needsFullUpdate         = true;
+}
+
+unsigned int DynamicTerrain::geomorphFrames() const
+{
+  return _geomorphFrames;
+}
+
+void DynamicTerrain::setGeomorphFrames(unsigned int val)
+{
+  _geomorphFrames = val;
 }
 
 void DynamicTerrain::updateVertex(DynamicTerrainVertex& /*vertex*/,
@@ -0,0 +1,161 @@
+#include <babylon/extensions/entitycomponentsystem/detail/archetype.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+constexpr std::size_t Archetype::ChunkSize;
+
+Archetype::Archetype(
+  const ComponentTypeList& typeList,
+  const std::array<const ComponentTypeInfo*, MAX_AMOUNT_OF_COMPONENTS>&
+    typeInfos)
+    : m_typeList{typeList}, m_chunkCapacity{1}, m_chunkBytes{0}
+{
+  m_typeInfos.fill(nullptr);
+  m_columnOffsets.fill(0);
+  m_addTransitions.fill(nullptr);
+  m_removeTransitions.fill(nullptr);
+
+  std::size_t rowBytes = 0;
+  for (TypeId i = 0; i < MAX_AMOUNT_OF_COMPONENTS; ++i) {
+    if (m_typeList[i]) {
+      ANAX_ASSERT(typeInfos[i] != nullptr, "Missing component type info");
+      ANAX_ASSERT(typeInfos[i]->alignment <= alignof(std::max_align_t),
+                  "Over-aligned components are not supported");
+      m_typeIds.emplace_back(i);
+      m_typeInfos[i] = typeInfos[i];
+      rowBytes += typeInfos[i]->size;
+    }
+  }
+
+  // Columns are laid out one after the other within a chunk
+  if (rowBytes > 0) {
+    m_chunkCapacity = std::max<std::size_t>(1, ChunkSize / rowBytes);
+  }
+  for (auto typeId : m_typeIds) {
+    const auto& info        = *m_typeInfos[typeId];
+    m_chunkBytes            = (m_chunkBytes + info.alignment - 1)
+                   / info.alignment * info.alignment;
+    m_columnOffsets[typeId] = m_chunkBytes;
+    m_chunkBytes += info.size * m_chunkCapacity;
+  }
+}
+
+Archetype::~Archetype()
+{
+  for (std::size_t row = 0; row < m_entities.size(); ++row) {
+    for (auto typeId : m_typeIds) {
+      m_typeInfos[typeId]->destroy(getColumnData(row, typeId));
+    }
+  }
+}
+
+const ComponentTypeList& Archetype::getComponentTypeList() const
+{
+  return m_typeList;
+}
+
+const ComponentTypeInfo&
+Archetype::getComponentTypeInfo(TypeId componentTypeId) const
+{
+  ANAX_ASSERT(m_typeList[componentTypeId],
+              "Archetype does not contain the component type");
+  return *m_typeInfos[componentTypeId];
+}
+
+std::size_t Archetype::getSize() const
+{
+  return m_entities.size();
+}
+
+std::size_t Archetype::getChunkCapacity() const
+{
+  return m_chunkCapacity;
+}
+
+std::size_t Archetype::getChunkCount() const
+{
+  return m_chunks.size();
+}
+
+std::size_t Archetype::getChunkSize(std::size_t chunk) const
+{
+  return std::min(m_chunkCapacity,
+                  m_entities.size() - chunk * m_chunkCapacity);
+}
+
+const Entity& Archetype::getEntity(std::size_t row) const
+{
+  return m_entities[row];
+}
+
+const std::uint8_t* Archetype::getActivatedFlags() const
+{
+  return m_activated.data();
+}
+
+void Archetype::setActivated(std::size_t row, bool activated)
+{
+  m_activated[row] = activated ? 1 : 0;
+}
+
+void* Archetype::getComponent(std::size_t row, TypeId componentTypeId)
+{
+  ANAX_ASSERT(m_typeList[componentTypeId],
+              "Archetype does not contain the component type");
+  return getColumnData(row, componentTypeId);
+}
+
+unsigned char* Archetype::getColumnData(std::size_t row,
+                                        TypeId componentTypeId)
+{
+  return m_chunks[row / m_chunkCapacity].get()
+         + m_columnOffsets[componentTypeId]
+         + (row % m_chunkCapacity) * m_typeInfos[componentTypeId]->size;
+}
+
+std::size_t Archetype::addRow(const Entity& entity, bool activated)
+{
+  const auto row = m_entities.size();
+  if (row == m_chunks.size() * m_chunkCapacity) {
+    m_chunks.emplace_back(new unsigned char[std::max<std::size_t>(
+      1, m_chunkBytes)]);
+  }
+  m_entities.emplace_back(entity);
+  m_activated.emplace_back(activated ? 1 : 0);
+  return row;
+}
+
+const Entity* Archetype::removeRow(std::size_t row)
+{
+  const auto last = m_entities.size() - 1;
+  for (auto typeId : m_typeIds) {
+    const auto& info = *m_typeInfos[typeId];
+    info.destroy(getColumnData(row, typeId));
+    if (row != last) {
+      info.moveConstruct(getColumnData(row, typeId),
+                         getColumnData(last, typeId));
+      info.destroy(getColumnData(last, typeId));
+    }
+  }
+  m_entities[row]  = m_entities[last];
+  m_activated[row] = m_activated[last];
+  m_entities.pop_back();
+  m_activated.pop_back();
+
+  // Release the trailing chunk once empty
+  if (m_entities.size() <= (m_chunks.size() - 1) * m_chunkCapacity) {
+    m_chunks.pop_back();
+  }
+
+  return (row != last) ? &m_entities[row] : nullptr;
+}
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -1,6 +1,7 @@
 #include <babylon/extensions/entitycomponentsystem/detail/base_system.h>
 
 #include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
 
 #include <algorithm>
 
@@ -10,7 +11,11 @@ namespace ECS {
 namespace detail {
 
 BaseSystem::BaseSystem(const Filter& filter)
-    : m_world(nullptr), m_filter(filter)
+    : m_world(nullptr)
+    , m_filter(filter)
+    , m_writes(ComponentTypeList().set())
+    , m_archetypesTested(0)
+    , m_archetypesGeneration(0)
 {
 }
 
@@ -34,6 +39,43 @@ const std::vector<Entity>& BaseSystem::getEntities() const
   return m_entities;
 }
 
+const ComponentTypeList& BaseSystem::getReadComponents() const
+{
+  return m_reads;
+}
+
+const ComponentTypeList& BaseSystem::getWriteComponents() const
+{
+  return m_writes;
+}
+
+bool BaseSystem::conflictsWith(const BaseSystem& system) const
+{
+  return (m_writes & (system.m_reads | system.m_writes)).any()
+         || (system.m_writes & m_reads).any();
+}
+
+const std::vector<Archetype*>& BaseSystem::getArchetypes()
+{
+  const auto& storage = getWorld().m_entityAttributes.componentStorage;
+
+  // the archetypes were released
+  if (m_archetypesGeneration != storage.getGeneration()) {
+    m_archetypes.clear();
+    m_archetypesTested     = 0;
+    m_archetypesGeneration = storage.getGeneration();
+  }
+
+  const auto& archetypes = storage.getArchetypes();
+  for (; m_archetypesTested < archetypes.size(); ++m_archetypesTested) {
+    auto archetype = archetypes[m_archetypesTested];
+    if (m_filter.doesPassFilter(archetype->getComponentTypeList()))
+      m_archetypes.emplace_back(archetype);
+  }
+
+  return m_archetypes;
+}
+
 void BaseSystem::add(Entity& entity)
 {
   m_entities.push_back(entity);
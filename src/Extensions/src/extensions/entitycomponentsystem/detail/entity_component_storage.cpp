@@ -9,21 +9,60 @@ namespace ECS {
 namespace detail {
 
 EntityComponentStorage::EntityComponentStorage(std::size_t entityAmount)
-    : m_componentEntries(entityAmount)
+    : m_locations(entityAmount), m_generation{0}
 {
 }
 
-void EntityComponentStorage::addComponent(Entity& entity, Component* component,
-                                          TypeId componentTypeId)
+EntityComponentStorage::~EntityComponentStorage()
+{
+}
+
+Component& EntityComponentStorage::addComponent(
+  Entity& entity, void* component, TypeId componentTypeId,
+  const ComponentTypeInfo& componentTypeInfo)
 {
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot have components added to it");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  componentDataForEntity.components[componentTypeId].reset(component);
-  componentDataForEntity.componentTypeList[componentTypeId] = true;
+  auto& location = m_locations[entity.getId().index];
+  auto archetype = location.archetype;
+
+  // replace the existing component
+  if (archetype && archetype->getComponentTypeList()[componentTypeId]) {
+    auto data = archetype->getComponent(location.row, componentTypeId);
+    componentTypeInfo.destroy(data);
+    componentTypeInfo.moveConstruct(data, component);
+    return *componentTypeInfo.toComponent(data);
+  }
+
+  // find the archetype with the component type added
+  Archetype* target = archetype ? archetype->m_addTransitions[componentTypeId] :
+                                  nullptr;
+  if (!target) {
+    std::array<const ComponentTypeInfo*, MAX_AMOUNT_OF_COMPONENTS> typeInfos;
+    ComponentTypeList typeList;
+    if (archetype) {
+      typeInfos = archetype->m_typeInfos;
+      typeList  = archetype->getComponentTypeList();
+    }
+    else {
+      typeInfos.fill(nullptr);
+    }
+    typeInfos[componentTypeId] = &componentTypeInfo;
+    typeList.set(componentTypeId);
+
+    target = getArchetype(typeList, typeInfos);
+    if (archetype) {
+      archetype->m_addTransitions[componentTypeId] = target;
+      target->m_removeTransitions[componentTypeId] = archetype;
+    }
+  }
+
+  moveEntity(entity, location, target);
+
+  auto data = target->getComponent(location.row, componentTypeId);
+  componentTypeInfo.moveConstruct(data, component);
+  return *componentTypeInfo.toComponent(data);
 }
 
 void EntityComponentStorage::removeComponent(Entity& entity,
@@ -31,21 +70,40 @@ void EntityComponentStorage::removeComponent(Entity& entity,
 {
   ANAX_ASSERT(entity.isValid(), "invalid entity cannot remove components");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  componentDataForEntity.components[componentTypeId].reset();
-  componentDataForEntity.componentTypeList[componentTypeId] = false;
+  auto& location = m_locations[entity.getId().index];
+  auto archetype = location.archetype;
+  if (!archetype || !archetype->getComponentTypeList()[componentTypeId]) {
+    return;
+  }
+
+  // last component of the entity
+  if (archetype->getComponentTypeList().count() == 1) {
+    removeRow(location);
+    return;
+  }
+
+  // find the archetype with the component type removed
+  Archetype* target = archetype->m_removeTransitions[componentTypeId];
+  if (!target) {
+    auto typeInfos = archetype->m_typeInfos;
+    auto typeList  = archetype->getComponentTypeList();
+    typeInfos[componentTypeId] = nullptr;
+    typeList.reset(componentTypeId);
+
+    target = getArchetype(typeList, typeInfos);
+    archetype->m_removeTransitions[componentTypeId] = target;
+    target->m_addTransitions[componentTypeId]       = archetype;
+  }
+
+  moveEntity(entity, location, target);
 }
 
 void EntityComponentStorage::removeAllComponents(Entity& entity)
 {
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  for (auto& c : componentDataForEntity.components)
-    c.reset();
-  componentDataForEntity.componentTypeList.reset();
+  auto& location = m_locations[entity.getId().index];
+  if (location.archetype) {
+    removeRow(location);
+  }
 }
 
 Component& EntityComponentStorage::getComponent(const Entity& entity,
@@ -54,7 +112,10 @@ Component& EntityComponentStorage::getComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid() && hasComponent(entity, componentTypeId),
               "Entity is not valid or does not contain component");
 
-  return *getComponentsImpl(entity)[componentTypeId];
+  const auto& location = m_locations[entity.getId().index];
+  return *location.archetype->getComponentTypeInfo(componentTypeId)
+            .toComponent(
+              location.archetype->getComponent(location.row, componentTypeId));
 }
 
 ComponentTypeList
@@ -63,7 +124,9 @@ EntityComponentStorage::getComponentTypeList(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve the component list");
 
-  return m_componentEntries[entity.getId().index].componentTypeList;
+  const auto& location = m_locations[entity.getId().index];
+  return location.archetype ? location.archetype->getComponentTypeList() :
+                              ComponentTypeList();
 }
 
 ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
@@ -71,13 +134,17 @@ ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve components, as it has none");
 
-  auto& componentsToConvert = getComponentsImpl(entity);
-
-  ComponentArray temp;
-  temp.reserve(componentsToConvert.size());
+  ComponentArray temp(MAX_AMOUNT_OF_COMPONENTS, nullptr);
 
-  for (auto& i : componentsToConvert)
-    temp.emplace_back(i.get());
+  const auto& location = m_locations[entity.getId().index];
+  if (location.archetype) {
+    const auto& typeList = location.archetype->getComponentTypeList();
+    for (TypeId i = 0; i < MAX_AMOUNT_OF_COMPONENTS; ++i) {
+      if (typeList[i])
+        temp[i] = location.archetype->getComponentTypeInfo(i).toComponent(
+          location.archetype->getComponent(location.row, i));
+    }
+  }
 
   return temp;
 }
@@ -88,32 +155,85 @@ bool EntityComponentStorage::hasComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot check if it has components");
 
-  auto& components = getComponentsImpl(entity);
+  const auto& location = m_locations[entity.getId().index];
+  return componentTypeId < MAX_AMOUNT_OF_COMPONENTS && location.archetype
+         && location.archetype->getComponentTypeList()[componentTypeId];
+}
+
+void EntityComponentStorage::setActivated(const Entity& entity, bool activated)
+{
+  auto& location     = m_locations[entity.getId().index];
+  location.activated = activated;
+  if (location.archetype) {
+    location.archetype->setActivated(location.row, activated);
+  }
+}
 
-  return components.size() > componentTypeId
-         && components[componentTypeId] != nullptr;
+const std::vector<Archetype*>& EntityComponentStorage::getArchetypes() const
+{
+  return m_archetypes;
+}
+
+std::size_t EntityComponentStorage::getGeneration() const
+{
+  return m_generation;
 }
 
 void EntityComponentStorage::resize(std::size_t entityAmount)
 {
-  m_componentEntries.resize(entityAmount);
+  m_locations.resize(entityAmount);
 }
 
 void EntityComponentStorage::clear()
 {
-  m_componentEntries.clear();
+  m_locations.clear();
+  m_archetypes.clear();
+  m_archetypesByTypeList.clear();
+  ++m_generation;
+}
+
+Archetype* EntityComponentStorage::getArchetype(
+  const ComponentTypeList& typeList,
+  const std::array<const ComponentTypeInfo*, MAX_AMOUNT_OF_COMPONENTS>&
+    typeInfos)
+{
+  auto& archetype = m_archetypesByTypeList[typeList];
+  if (!archetype) {
+    archetype.reset(new Archetype(typeList, typeInfos));
+    m_archetypes.emplace_back(archetype.get());
+  }
+  return archetype.get();
 }
 
-EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e)
+void EntityComponentStorage::moveEntity(const Entity& entity,
+                                        EntityLocation& location,
+                                        Archetype* archetype)
 {
-  return m_componentEntries[e.getId().index].components;
+  const auto row = archetype->addRow(entity, location.activated);
+  if (location.archetype) {
+    auto source = location.archetype;
+    for (auto typeId : archetype->m_typeIds) {
+      if (source->getComponentTypeList()[typeId]) {
+        archetype->m_typeInfos[typeId]->moveConstruct(
+          archetype->getColumnData(row, typeId),
+          source->getColumnData(location.row, typeId));
+      }
+    }
+    // destroys the moved-from components
+    removeRow(location);
+  }
+  location.archetype = archetype;
+  location.row       = row;
 }
 
-const EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e) const
+void EntityComponentStorage::removeRow(EntityLocation& location)
 {
-  return m_componentEntries[e.getId().index].components;
+  auto moved = location.archetype->removeRow(location.row);
+  if (moved) {
+    m_locations[moved->getId().index].row = location.row;
+  }
+  location.archetype = nullptr;
+  location.row       = 0;
 }
 
 } // end of namespace detail
@@ -0,0 +1,76 @@
+#include <babylon/extensions/entitycomponentsystem/system_scheduler.h>
+
+#include <algorithm>
+#include <thread>
+
+#include <babylon/core/worker_pool.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+
+SystemScheduler::SystemScheduler()
+    : m_dirty(false)
+    , m_maxThreads(std::max(1u, std::thread::hardware_concurrency()))
+{
+}
+
+void SystemScheduler::addSystem(detail::BaseSystem& system,
+                                std::function<void()> update)
+{
+  m_systems.emplace_back(ScheduledSystem{&system, std::move(update)});
+  m_dirty = true;
+}
+
+void SystemScheduler::clear()
+{
+  m_systems.clear();
+  m_stages.clear();
+  m_dirty = false;
+}
+
+std::size_t SystemScheduler::getStageCount()
+{
+  buildStages();
+  return m_stages.size();
+}
+
+void SystemScheduler::buildStages()
+{
+  if (!m_dirty)
+    return;
+
+  m_stages.clear();
+  std::vector<std::size_t> systemStages(m_systems.size(), 0);
+  for (std::size_t i = 0; i < m_systems.size(); ++i) {
+    // first stage after the last conflicting system
+    std::size_t stage = 0;
+    for (std::size_t j = 0; j < i; ++j) {
+      if (m_systems[i].system->conflictsWith(*m_systems[j].system))
+        stage = std::max(stage, systemStages[j] + 1);
+    }
+    systemStages[i] = stage;
+    if (m_stages.size() <= stage)
+      m_stages.resize(stage + 1);
+    m_stages[stage].emplace_back(i);
+  }
+
+  m_dirty = false;
+}
+
+void SystemScheduler::update()
+{
+  buildStages();
+
+  for (const auto& stage : m_stages) {
+    // the systems of the stage are shared between the persistent workers
+    WorkerPool::Shared().run(stage.size(), m_maxThreads,
+                             [this, &stage](std::size_t i) {
+                               m_systems[stage[i]].update();
+                             });
+  }
+}
+
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
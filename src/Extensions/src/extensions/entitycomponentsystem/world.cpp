@@ -14,6 +14,8 @@ void World::SystemDeleter::operator()(detail::BaseSystem* system) const
 {
   system->m_world = nullptr;
   system->m_entities.clear();
+  system->m_archetypes.clear();
+  system->m_archetypesTested = 0;
 }
 
 World::World() : World(DEFAULT_ENTITY_POOL_SIZE)
@@ -28,6 +30,7 @@ World::World(std::size_t entityPoolSize)
 void World::removeAllSystems()
 {
   m_systems.clear();
+  m_systemFilterCache.clear();
 }
 
 Entity World::createEntity()
@@ -103,15 +106,20 @@ void World::refresh()
   for (auto& entity : m_entityCache.activated) {
     auto& attribute     = m_entityAttributes.attributes[entity.getId().index];
     attribute.activated = true;
+    m_entityAttributes.componentStorage.setActivated(entity, true);
+
+    // the filters of the systems are cached per set of component types
+    const auto& filterResults = getSystemFilterResults(
+      m_entityAttributes.componentStorage.getComponentTypeList(entity));
 
     // loop through all the systems within the world
+    std::size_t k = 0;
     for (auto& i : m_systems) {
       auto systemIndex = i.first;
 
       // if the entity passes the filter the system has and is not already part
       // of the system
-      if (i.second->getFilter().doesPassFilter(
-            m_entityAttributes.componentStorage.getComponentTypeList(entity))) {
+      if (filterResults[k++]) {
         if (attribute.systems.size() <= systemIndex
             || !attribute.systems[systemIndex]) {
           i.second->add(entity); // add it to the system
@@ -136,6 +144,7 @@ void World::refresh()
   for (auto& entity : m_entityCache.deactivated) {
     auto& attribute     = m_entityAttributes.attributes[entity.getId().index];
     attribute.activated = false;
+    m_entityAttributes.componentStorage.setActivated(entity, false);
 
     // loop through all the systems within the world
     for (auto& i : m_systems) {
@@ -153,10 +162,9 @@ void World::refresh()
 
   // go through all the killed entities from last call to refresh
   for (auto& entity : m_entityCache.killed) {
-    // remove the entity from the alive array
-    m_entityCache.alive.erase(std::remove(m_entityCache.alive.begin(),
-                                          m_entityCache.alive.end(), entity),
-                              m_entityCache.alive.end());
+    // the same entity may have been killed several times
+    if (!isValid(entity))
+      continue;
 
     // destroy all the components it has
     m_entityAttributes.componentStorage.removeAllComponents(entity);
@@ -165,6 +173,14 @@ void World::refresh()
     m_entityIdPool.remove(entity.getId());
   }
 
+  // remove the killed entities from the alive array, in a single pass
+  if (!m_entityCache.killed.empty()) {
+    m_entityCache.alive.erase(
+      std::remove_if(m_entityCache.alive.begin(), m_entityCache.alive.end(),
+                     [this](const Entity& entity) { return !isValid(entity); }),
+      m_entityCache.alive.end());
+  }
+
   // clear the temp cache
   m_entityCache.clearTemp();
 }
@@ -214,6 +230,7 @@ void World::addSystem(detail::BaseSystem& system, detail::TypeId systemTypeId)
               "System of this type is already contained within the world");
 
   m_systems[systemTypeId].reset(&system);
+  m_systemFilterCache.clear();
 
   system.m_world = this;
   system.initialize();
@@ -223,6 +240,7 @@ void World::removeSystem(detail::TypeId systemTypeId)
 {
   ANAX_ASSERT(doesSystemExist(systemTypeId), "System does not exist in world");
   m_systems.erase(systemTypeId);
+  m_systemFilterCache.clear();
 }
 
 bool World::doesSystemExist(detail::TypeId systemTypeId) const
@@ -230,6 +248,21 @@ bool World::doesSystemExist(detail::TypeId systemTypeId) const
   return m_systems.find(systemTypeId) != m_systems.end();
 }
 
+const std::vector<bool>&
+World::getSystemFilterResults(const detail::ComponentTypeList& typeList)
+{
+  auto it = m_systemFilterCache.find(typeList);
+  if (it == m_systemFilterCache.end()) {
+    std::vector<bool> filterResults;
+    filterResults.reserve(m_systems.size());
+    for (auto& i : m_systems) {
+      filterResults.emplace_back(i.second->getFilter().doesPassFilter(typeList));
+    }
+    it = m_systemFilterCache.emplace(typeList, std::move(filterResults)).first;
+  }
+  return it->second;
+}
+
 Entity World::getEntity(std::size_t index)
 {
   return Entity{*this, m_entityIdPool.get(index)};
@@ -2,6 +2,7 @@
 
 #include <babylon/extensions/hexplanetgeneration/utils/irandom_function.h>
 #include <babylon/extensions/hexplanetgeneration/utils/tools.h>
+#include <babylon/extensions/utils/parallel_for.h>
 
 namespace BABYLON {
 namespace Extensions {
@@ -74,13 +75,14 @@ Icosphere::generateIcosahedronMesh(size_t icosahedronSubdivision,
   }
 
   // Calculating Triangle Centroids
-  for (auto face : mesh.faces) {
+  parallelFor(mesh.faces.size(), [&mesh](size_t f) {
+    auto& face    = mesh.faces[f];
     auto& p0      = mesh.nodes[face.n[0]].p;
     auto& p1      = mesh.nodes[face.n[1]].p;
     auto& p2      = mesh.nodes[face.n[2]].p;
     face.centroid = calculateFaceCentroid(p0, p1, p2);
     face.centroid.normalize();
-  }
+  });
 
   // Reordering Triangle Nodes
   unsigned int i = 0;
@@ -139,20 +141,20 @@ void Icosphere::generateIcosahedron(IcosahedronMesh& mesh)
   mesh.nodes.reserve(mesh.edges.size() * 3);
   for (size_t i = 0; i < mesh.edges.size(); ++i) {
     for (size_t j = 0; j < mesh.edges[i].n.size(); ++j) {
-      mesh.nodes[j].e.emplace_back(i);
+      mesh.nodes[mesh.edges[i].n[j]].e.emplace_back(i);
     }
   }
 
   for (size_t i = 0; i < mesh.faces.size(); ++i) {
     for (size_t j = 0; j < mesh.faces[i].n.size(); ++j) {
-      mesh.nodes[j].f.emplace_back(i);
+      mesh.nodes[mesh.faces[i].n[j]].f.emplace_back(i);
     }
   }
 
   mesh.edges.reserve(mesh.faces.size() * 3);
   for (size_t i = 0; i < mesh.faces.size(); ++i) {
     for (size_t j = 0; j < mesh.faces[i].e.size(); ++j) {
-      mesh.edges[j].f.emplace_back(i);
+      mesh.edges[mesh.faces[i].e[j]].f.emplace_back(i);
     }
   }
 }
@@ -168,20 +170,20 @@ void Icosphere::generateSubdividedIcosahedron(size_t degree,
   generateIcosahedron(icosahedron);
 
   // Ico nodes
-  nodes.reserve(mesh.nodes.size() + mesh.edges.size() * (degree - 1)
-                + mesh.faces.size() * (degree - 1) * (degree - 1) / 2);
-  for (auto& node : mesh.nodes) {
+  nodes.clear();
+  nodes.reserve(10 * degree * degree + 2);
+  for (auto& node : icosahedron.nodes) {
     nodes.emplace_back(IcoNode(node.p));
   }
 
   // Ico edges
-  edges.reserve(mesh.edges.size() + mesh.edges.size() * (degree - 1)
-                + 3 * mesh.faces.size() * (degree - 1) * (degree - 1) / 2);
-  for (auto& edge : mesh.edges) {
+  edges.clear();
+  edges.reserve(30 * degree * degree);
+  for (auto& edge : icosahedron.edges) {
     edge.subdivided_n.clear();
     edge.subdivided_e.clear();
-    auto& n0 = mesh.nodes[edge.n[0]];
-    auto& n1 = mesh.nodes[edge.n[1]];
+    auto& n0 = icosahedron.nodes[edge.n[0]];
+    auto& n1 = icosahedron.nodes[edge.n[1]];
     auto p0  = n0.p;
     auto p1  = n1.p;
     nodes[edge.n[0]].e.emplace_back(edges.size());
@@ -204,11 +206,12 @@ void Icosphere::generateSubdividedIcosahedron(size_t degree,
   }
 
   // Ico faces
-  faces.reserve(2 * mesh.faces.size() * (degree - 1) * (degree - 1) / 2);
-  for (auto& face : mesh.faces) {
-    auto& edge0 = mesh.edges[face.e[0]];
-    auto& edge1 = mesh.edges[face.e[1]];
-    auto& edge2 = mesh.edges[face.e[2]];
+  faces.clear();
+  faces.reserve(20 * degree * degree);
+  for (auto& face : icosahedron.faces) {
+    auto& edge0 = icosahedron.edges[face.e[0]];
+    auto& edge1 = icosahedron.edges[face.e[1]];
+    auto& edge2 = icosahedron.edges[face.e[2]];
 
     auto getEdgeNode0 = [&face, &edge0, &degree](size_t k) {
       if (face.n[0] == edge0.n[0]) {
@@ -248,8 +251,8 @@ void Icosphere::generateSubdividedIcosahedron(size_t degree,
     faceNodes.emplace_back(face.n[1]);
     for (unsigned int s = 1; s < degree; ++s) {
       faceNodes.emplace_back(getEdgeNode2(s - 1));
-      auto& p0 = nodes[getEdgeNode2(s - 1)].p;
-      auto& p1 = nodes[getEdgeNode1(s - 1)].p;
+      auto p0 = nodes[getEdgeNode2(s - 1)].p;
+      auto p1 = nodes[getEdgeNode1(s - 1)].p;
       for (unsigned int t = 1; t < degree - s; ++t) {
         faceNodes.emplace_back(nodes.size());
         nodes.emplace_back(IcoNode(Vector3::Lerp(
@@ -486,7 +489,7 @@ Vector3 Icosphere::calculateFaceCentroid(const Vector3& pa, const Vector3& pb,
                                          const Vector3& pc)
 {
   auto centroid = pa + pb + pc;
-  centroid /= 3.f;
+  centroid *= (1.f / 3.f);
   return centroid;
 }
 
@@ -509,7 +512,7 @@ bool Icosphere::distortMesh(IcosahedronMesh& mesh, size_t degree,
       if (ratio >= 2.f || ratio <= 0.5f) {
         return false;
       }
-      auto v0 = (oldNode1.p - oldNode0.p) / oldEdgeLength;
+      auto v0 = (oldNode1.p - oldNode0.p) * (1.f / oldEdgeLength);
       auto v1 = (newNode0.p - oldNode0.p);
       v1.normalize();
       auto v2 = (newNode1.p - oldNode0.p);
@@ -550,73 +553,62 @@ float Icosphere::relaxMesh(IcosahedronMesh& mesh, float multiplier)
   float idealEdgeLength = std::sqrt(idealFaceArea * 4.f / std::sqrt(3.f));
   float idealDistanceToCentroid = idealEdgeLength * std::sqrt(3.f) / 3.f * 0.9f;
 
-  std::vector<Vector3> pointShifts(mesh.nodes.size());
-  std::fill(pointShifts.begin(), pointShifts.end(), Vector3(0.f, 0.f, 0.f));
-
-  size_t i = 0;
-  for (auto& face : mesh.faces) {
-    auto& n0      = mesh.nodes[face.n[0]];
-    auto& n1      = mesh.nodes[face.n[1]];
-    auto& n2      = mesh.nodes[face.n[2]];
-    auto& p0      = n0.p;
-    auto& p1      = n1.p;
-    auto& p2      = n2.p;
-    auto centroid = calculateFaceCentroid(p0, p1, p2);
+  // Shifts of the face nodes towards the ideal distance to the face centroid,
+  // indexed by face index * 3 + node index within the face
+  std::vector<Vector3> faceShifts(mesh.faces.size() * 3);
+  parallelFor(mesh.faces.size(), [&](size_t f) {
+    const auto& face = mesh.faces[f];
+    auto centroid
+      = calculateFaceCentroid(mesh.nodes[face.n[0]].p, mesh.nodes[face.n[1]].p,
+                              mesh.nodes[face.n[2]].p);
     centroid.normalize();
-    auto v0      = centroid - p0;
-    auto v1      = centroid - p1;
-    auto v2      = centroid - p2;
-    auto length0 = v0.length();
-    auto length1 = v1.length();
-    auto length2 = v2.length();
-    v0 *= (multiplier * (length0 - idealDistanceToCentroid) / length0);
-    v1 *= (multiplier * (length1 - idealDistanceToCentroid) / length1);
-    v2 *= (multiplier * (length2 - idealDistanceToCentroid) / length2);
-    pointShifts[face.n[0]] += v0;
-    pointShifts[face.n[1]] += v1;
-    pointShifts[face.n[2]] += v2;
-    ++i;
-  }
+    for (size_t k = 0; k < 3; ++k) {
+      auto v      = centroid - mesh.nodes[face.n[k]].p;
+      auto length = v.length();
+      v *= (multiplier * (length - idealDistanceToCentroid) / length);
+      faceShifts[f * 3 + k] = v;
+    }
+  });
 
-  for (size_t i = 0; i < mesh.nodes.size(); ++i) {
-    pointShifts[i] = mesh.nodes[i].p
-                     + Tools::projectOnPlane(pointShifts[i], mesh.nodes[i].p);
+  // Each node gathers the shifts of its faces
+  std::vector<Vector3> pointShifts(mesh.nodes.size());
+  parallelFor(mesh.nodes.size(), [&](size_t i) {
+    const auto& node = mesh.nodes[i];
+    Vector3 pointShift(0.f, 0.f, 0.f);
+    for (auto f : node.f) {
+      const auto& face = mesh.faces[f];
+      const size_t k   = (face.n[0] == i) ? 0 : (face.n[1] == i) ? 1 : 2;
+      pointShift += faceShifts[f * 3 + k];
+    }
+    pointShifts[i] = node.p + Tools::projectOnPlane(pointShift, node.p);
     pointShifts[i].normalize();
-  }
+  });
 
+  // Each node keeps the strongest rotation suppression of its edges
   Float32Array rotationSupressions(mesh.nodes.size());
-  std::fill(rotationSupressions.begin(), rotationSupressions.end(), 0.f);
-
-  for (auto& edge : mesh.edges) {
-    auto& oldPoint0 = mesh.nodes[edge.n[0]].p;
-    auto& oldPoint1 = mesh.nodes[edge.n[1]].p;
-    auto& newPoint0 = pointShifts[edge.n[0]];
-    auto& newPoint1 = pointShifts[edge.n[1]];
-    auto oldVector  = oldPoint1 - oldPoint0;
-    oldVector.normalize();
-    auto newVector = newPoint1 - newPoint0;
-    newVector.normalize();
-    auto suppression = (1.f - Vector3::Dot(oldVector, newVector)) * 0.5f;
-    rotationSupressions[edge.n[0]]
-      = std::max(rotationSupressions[edge.n[0]], suppression);
-    rotationSupressions[edge.n[1]]
-      = std::max(rotationSupressions[edge.n[1]], suppression);
-  }
+  parallelFor(mesh.nodes.size(), [&](size_t i) {
+    float rotationSupression = 0.f;
+    for (auto e : mesh.nodes[i].e) {
+      const auto& edge = mesh.edges[e];
+      auto oldVector   = mesh.nodes[edge.n[1]].p - mesh.nodes[edge.n[0]].p;
+      oldVector.normalize();
+      auto newVector = pointShifts[edge.n[1]] - pointShifts[edge.n[0]];
+      newVector.normalize();
+      auto suppression = (1.f - Vector3::Dot(oldVector, newVector)) * 0.5f;
+      rotationSupression = std::max(rotationSupression, suppression);
+    }
+    rotationSupressions[i] = rotationSupression;
+  });
 
-  float totalShift = 0.f;
-  i                = 0;
-  for (auto& node : mesh.nodes) {
-    auto& point = node.p;
+  return parallelSum(mesh.nodes.size(), [&](size_t i) {
+    auto& point = mesh.nodes[i].p;
     auto delta  = point;
     point       = Vector3::Lerp(point, pointShifts[i],
                           1.f - std::sqrt(rotationSupressions[i]));
     point.normalize();
     delta -= point;
-    totalShift += delta.length();
-    ++i;
-  }
-
-  return totalShift;
+    return delta.length();
+  });
 }
 
 } // end of namespace Extensions
@@ -0,0 +1,37 @@
+#include <babylon/extensions/hexplanetgeneration/render_data.h>
+
+#include <babylon/math/color4.h>
+#include <babylon/math/vector3.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+void RenderObject::colour(const Color4& color)
+{
+  colors.insert(colors.end(), {color.r, color.g, color.b, color.a});
+}
+
+void RenderObject::normal(const Vector3& normal)
+{
+  normals.insert(normals.end(), {normal.x, normal.y, normal.z});
+}
+
+void RenderObject::position(const Vector3& position)
+{
+  positions.insert(positions.end(), {position.x, position.y, position.z});
+}
+
+void RenderObject::triangle(size_t p1, size_t p2, size_t p3)
+{
+  indices.insert(indices.end(), {static_cast<uint32_t>(p1),
+                                 static_cast<uint32_t>(p2),
+                                 static_cast<uint32_t>(p3)});
+}
+
+size_t RenderObject::getCurrentVertexCount() const
+{
+  return positions.size() / 3;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -0,0 +1,84 @@
+#include <babylon/extensions/hexplanetgeneration/terrain/air_flow.h>
+
+#include <babylon/extensions/hexplanetgeneration/terrain/corner.h>
+#include <babylon/extensions/utils/parallel_for.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+AirFlow::AirFlow(const std::vector<Corner>& corners)
+    : slotOffsets(corners.size() + 1, 0)
+    , area(corners.size(), 0.f)
+    , air(corners.size(), 0.f)
+    , absorptionRate(corners.size(), 0.f)
+    , absorbed(corners.size(), 0.f)
+    , maxAbsorbed(corners.size(), 0.f)
+    , outgoingAir(corners.size(), 0.f)
+{
+  for (size_t c = 0; c < corners.size(); ++c) {
+    slotOffsets[c + 1] = slotOffsets[c] + corners[c].corners.size();
+  }
+
+  const size_t slotCount = slotOffsets.back();
+  slotCorners.resize(slotCount);
+  inflowSlots.resize(slotCount);
+  outflows.resize(slotCount);
+
+  const auto firstCorner = corners.data();
+  parallelFor(corners.size(), [&](size_t c) {
+    const auto& corner = corners[c];
+    area[c]            = corner.area;
+    for (size_t j = 0; j < corner.corners.size(); ++j) {
+      const size_t slot      = slotOffsets[c] + j;
+      const auto& neighbor   = *corner.corners[j];
+      const size_t n         = static_cast<size_t>(&neighbor - firstCorner);
+      slotCorners[slot]      = n;
+      outflows[slot]         = corner.airCurrentOutflows[j];
+      inflowSlots[slot]      = slotOffsets[n];
+      for (size_t k = 0; k < neighbor.corners.size(); ++k) {
+        if (neighbor.corners[k] == &corner) {
+          inflowSlots[slot] = slotOffsets[n] + k;
+          break;
+        }
+      }
+    }
+  });
+}
+
+float AirFlow::process()
+{
+  const size_t cornerCount = air.size();
+
+  // Absorption, computing the air leaving each corner
+  const float consumed = parallelSum(cornerCount, [this](size_t c) {
+    if (air[c] == 0.f) {
+      outgoingAir[c] = 0.f;
+      return 0.f;
+    }
+
+    float change = std::max(
+      0.f, std::min(air[c], absorptionRate[c]
+                              * (1.f - absorbed[c] / maxAbsorbed[c])));
+    absorbed[c] += change;
+    float loss     = area[c] * (absorbed[c] / maxAbsorbed[c]) * 0.02f;
+    outgoingAir[c] = air[c] - std::min(air[c], change + loss);
+    return change;
+  });
+
+  // Transport, gathering the air entering each corner
+  parallelFor(cornerCount, [this](size_t c) {
+    float incomingAir = 0.f;
+    for (size_t slot = slotOffsets[c]; slot < slotOffsets[c + 1]; ++slot) {
+      const float outflow = outflows[inflowSlots[slot]];
+      if (outflow > 0.f) {
+        incomingAir += outgoingAir[slotCorners[slot]] * outflow;
+      }
+    }
+    air[c] = incomingAir;
+  });
+
+  return consumed;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -24,14 +24,10 @@ Corner::Corner(size_t p_id, const Vector3& p_position, size_t cornerCount,
     , airCurrentSpeed{0}
     , airCurrentOutflows()
     , temperature{0}
-    , airHeat{0}
-    , newAirHeat{0}
     , heat{0}
     , heatAbsorption{0}
     , maxHeat{0}
     , moisture{0}
-    , airMoisture{0}
-    , newAirMoisture{0}
     , precipitation{0}
     , precipitationRate{0}
     , maxPrecipitation{0}
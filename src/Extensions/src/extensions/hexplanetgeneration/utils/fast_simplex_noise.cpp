@@ -1,6 +1,7 @@
 #include <babylon/extensions/hexplanetgeneration/utils/fast_simplex_noise.h>
 
 #include <babylon/core/random.h>
+#include <babylon/extensions/noisegeneration/noise_lanes.h>
 
 namespace BABYLON {
 namespace Extensions {
@@ -38,7 +39,7 @@ const std::array<std::array<float, 3>, 12> FastSimplexNoise::GRAD3
       {{1.f, 0.f, -1.f}},
       {{-1.f, 0.f, -1.f}},
       {{0.f, 1.f, 1.f}},
-      {{0.f, -1.f, -1.f}},
+      {{0.f, -1.f, 1.f}},
       {{0.f, 1.f, -1.f}},
       {{0.f, -1.f, -1.f}}}};
 
@@ -89,7 +90,8 @@ FastSimplexNoise::FastSimplexNoise(const FastSimplexNoiseOptions& options)
   uint8_t q;
   for (int i = 255; i > 0; i--) {
     uint8_t _i = static_cast<uint8_t>(i);
-    n          = static_cast<unsigned int>(std::floor((i + 1) * random()));
+    n          = static_cast<unsigned int>(
+      std::floor(static_cast<float>(i + 1) * _random()));
     q          = p[_i];
     p[_i]      = p[n];
     p[n]       = q;
@@ -161,9 +163,9 @@ float FastSimplexNoise::raw2D(float x, float y) const
 
   // Skew the input space to determine which simplex cell we're in
   float s = (x + y) * 0.5f * (std::sqrt(3.f) - 1.f); // Hairy factor for 2D
-  unsigned int i = static_cast<unsigned int>(std::floor(x + s));
-  unsigned int j = static_cast<unsigned int>(std::floor(y + s));
-  float t        = static_cast<float>(i + j) * G2;
+  int i   = static_cast<int>(std::floor(x + s));
+  int j   = static_cast<int>(std::floor(y + s));
+  float t = static_cast<float>(i + j) * G2;
   // Unskew the cell origin back to (x,y) space
   float X0 = static_cast<float>(i) - t;
   float Y0 = static_cast<float>(j) - t;
@@ -235,11 +237,11 @@ float FastSimplexNoise::raw3D(float x, float y, float z) const
   float n0, n1, n2, n3; // Noise contributions from the four corners
 
   // Skew the input space to determine which simplex cell we're in
-  float s        = (x + y + z) / 3.f; // Very nice and simple skew factor for 3D
-  unsigned int i = static_cast<unsigned int>(std::floor(x + s));
-  unsigned int j = static_cast<unsigned int>(std::floor(y + s));
-  unsigned int k = static_cast<unsigned int>(std::floor(z + s));
-  float t        = static_cast<float>(i + j + k) * G3;
+  float s = (x + y + z) / 3.f; // Very nice and simple skew factor for 3D
+  int i   = static_cast<int>(std::floor(x + s));
+  int j   = static_cast<int>(std::floor(y + s));
+  int k   = static_cast<int>(std::floor(z + s));
+  float t = static_cast<float>(i + j + k) * G3;
   // Unskew the cell origin back to (x,y,z) space
   float X0 = static_cast<float>(i) - t;
   float Y0 = static_cast<float>(j) - t;
@@ -346,6 +348,26 @@ float FastSimplexNoise::raw3D(float x, float y, float z) const
   return 94.68493150681972f * (n0 + n1 + n2 + n3);
 }
 
+void FastSimplexNoise::raw3D(const float* x, const float* y, const float* z,
+                             float* result, size_t count) const
+{
+  using L = NoiseLanes;
+  const auto gradient = [this](int i, int j, int k) {
+    return GRAD3[_permMod12[static_cast<size_t>(
+                   i + _perm[static_cast<size_t>(
+                         j + _perm[static_cast<size_t>(k)])])]]
+      .data();
+  };
+  for (size_t i = 0; i < count; i += L::Width) {
+    const auto n = L::laneCount(count - i);
+    L::store(result + i,
+             L::simplexNoise3D(L::load(x + i, n), L::load(y + i, n),
+                               L::load(z + i, n), 0.5f, 94.68493150681972f,
+                               false, gradient),
+             n);
+  }
+}
+
 float FastSimplexNoise::raw4D(float x, float y, float z, float w) const
 {
   float n0, n1, n2, n3, n4; // Noise contributions from the five corners
@@ -353,10 +375,10 @@ float FastSimplexNoise::raw4D(float x, float y, float z, float w) const
   // Skew the (x,y,z,w) space to determine which cell of 24 simplices we're in
   float s
     = (x + y + z + w) * (std::sqrt(5.f) - 1.f) / 4.f; // Factor for 4D skewing
-  unsigned int i = static_cast<unsigned int>(std::floor(x + s));
-  unsigned int j = static_cast<unsigned int>(std::floor(y + s));
-  unsigned int k = static_cast<unsigned int>(std::floor(z + s));
-  unsigned int l = static_cast<unsigned int>(std::floor(w + s));
+  int i = static_cast<int>(std::floor(x + s));
+  int j = static_cast<int>(std::floor(y + s));
+  int k = static_cast<int>(std::floor(z + s));
+  int l = static_cast<int>(std::floor(w + s));
   // Factor for 4D unskewing
   float t = static_cast<float>(i + j + k + l) * G4;
   // Unskew the cell origin back to (x,y,z,w) space
@@ -567,6 +589,41 @@ float FastSimplexNoise::scaled3D(float x, float y, float z) const
   return _scale(noise / maxAmplitude);
 }
 
+void FastSimplexNoise::scaled3D(const float* x, const float* y, const float* z,
+                                float* result, size_t count) const
+{
+  // The points are processed in blocks small enough to stay in the cache
+  static constexpr size_t BlockSize = 256;
+  std::array<float, BlockSize> bx, by, bz, values;
+
+  for (size_t i = 0; i < count; i += BlockSize) {
+    const auto n = std::min(BlockSize, count - i);
+    std::fill(result + i, result + i + n, 0.f);
+
+    float amplitude    = _amplitude;
+    float frequency    = _frequency;
+    float maxAmplitude = 0.f;
+    for (unsigned int o = 0; o < _octaves; ++o) {
+      for (size_t j = 0; j < n; ++j) {
+        bx[j] = x[i + j] * frequency;
+        by[j] = y[i + j] * frequency;
+        bz[j] = z[i + j] * frequency;
+      }
+      raw3D(bx.data(), by.data(), bz.data(), values.data(), n);
+      for (size_t j = 0; j < n; ++j) {
+        result[i + j] += values[j] * amplitude;
+      }
+      maxAmplitude += amplitude;
+      amplitude *= _persistence;
+      frequency *= 2.f;
+    }
+
+    for (size_t j = 0; j < n; ++j) {
+      result[i + j] = _scale(result[i + j] / maxAmplitude);
+    }
+  }
+}
+
 float FastSimplexNoise::scaled4D(float x, float y, float z, float w) const
 {
   float amplitude    = _amplitude;
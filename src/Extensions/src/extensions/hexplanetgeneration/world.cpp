@@ -5,6 +5,7 @@
 #include <babylon/extensions/hexplanetgeneration/planet.h>
 #include <babylon/extensions/hexplanetgeneration/planet_statistics.h>
 #include <babylon/extensions/hexplanetgeneration/render_data.h>
+#include <babylon/extensions/hexplanetgeneration/terrain/air_flow.h>
 #include <babylon/extensions/hexplanetgeneration/terrain/distance_corner.h>
 #include <babylon/extensions/hexplanetgeneration/terrain/elevation_border.h>
 #include <babylon/extensions/hexplanetgeneration/terrain/plate.h>
@@ -15,6 +16,7 @@
 #include <babylon/extensions/hexplanetgeneration/utils/matrix3.h>
 #include <babylon/extensions/hexplanetgeneration/utils/tools.h>
 #include <babylon/extensions/hexplanetgeneration/utils/xor_shift_128.h>
+#include <babylon/extensions/utils/parallel_for.h>
 #include <babylon/math/color4.h>
 #include <babylon/tools/tools.h>
 
@@ -59,7 +61,8 @@ void World::generatePlanet(size_t icosahedronSubdivision,
   generatePlanetPartition(planet.topology.tiles, planet.partition);
   generatePlanetTerrain(planet, plateCount, oceanicRate, heatLevel,
                         moistureLevel, random);
-  generatePlanetRenderData(planet.topology, random, planet.renderData);
+  generatePlanetRenderData(planet.topology, planet.partition, random,
+                           planet.renderData);
   generatePlanetStatistics(planet.topology, planet.plates, planet.statistics);
 }
 
@@ -92,21 +95,20 @@ bool World::generatePlanetTopology(const IcosahedronMesh& mesh, Topology& ret)
     ++i;
   }
 
-  i = 0;
-  for (auto& corner : corners) {
-    auto& face = mesh.faces[i];
+  parallelFor(corners.size(), [&](size_t c) {
+    auto& corner = corners[c];
+    auto& face   = mesh.faces[c];
     for (size_t j = 0; j < face.e.size(); ++j) {
       corner.borders[j] = &borders[face.e[j]];
     }
     for (size_t j = 0; j < face.n.size(); ++j) {
       corner.tiles[j] = &tiles[face.n[j]];
     }
-    ++i;
-  }
+  });
 
-  i = 0;
-  for (auto& border : borders) {
-    auto& edge = mesh.edges[i];
+  parallelFor(borders.size(), [&](size_t b) {
+    auto& border = borders[b];
+    auto& edge   = mesh.edges[b];
     Vector3 averageCorner(0.f, 0.f, 0.f);
     size_t n = 0;
     for (size_t j = 0; j < edge.f.size(); ++j) {
@@ -124,15 +126,17 @@ bool World::generatePlanetTopology(const IcosahedronMesh& mesh, Topology& ret)
     for (size_t j = 0; j < edge.n.size(); ++j) {
       border.tiles[j] = &tiles[edge.n[j]];
     }
-    ++i;
-  }
+  });
 
-  for (auto& corner : corners) {
+  parallelFor(corners.size(), [&corners](size_t c) {
+    auto& corner = corners[c];
     for (size_t j = 0; j < corner.borders.size(); ++j) {
       corner.corners[j] = &corner.borders[j]->oppositeCorner(corner);
     }
-  }
+  });
 
+  // Linking the tiles reorders the corners of the shared borders, this pass
+  // remains sequential so that the result does not depend on the scheduling
   i = 0;
   for (auto& tile : tiles) {
     auto& node = mesh.nodes[i];
@@ -176,7 +180,11 @@ bool World::generatePlanetTopology(const IcosahedronMesh& mesh, Topology& ret)
         }
       }
     }
+    ++i;
+  }
 
+  parallelFor(tiles.size(), [&tiles](size_t t) {
+    auto& tile           = tiles[t];
     tile.averagePosition = Vector3(0.f, 0.f, 0.f);
     for (size_t j = 0; j < tile.corners.size(); ++j) {
       tile.averagePosition += tile.corners[j]->position;
@@ -201,16 +209,16 @@ bool World::generatePlanetTopology(const IcosahedronMesh& mesh, Topology& ret)
     tile.normal.normalize();
     tile.boundingSphere
       = BoundingSphere(tile.averagePosition, maxDistanceToCorner);
-    ++i;
-  }
+  });
 
-  for (auto& corner : corners) {
-    corner.area = 0.f;
+  parallelFor(corners.size(), [&corners](size_t c) {
+    auto& corner = corners[c];
+    corner.area  = 0.f;
     for (size_t j = 0; j < corner.tiles.size(); ++j) {
       corner.area += corner.tiles[j]->area
                      / static_cast<float>(corner.tiles[j]->corners.size());
     }
-  }
+  });
 
   return true;
 }
@@ -225,33 +233,44 @@ void World::generatePlanetPartition(std::vector<Tile>& tiles,
     auto p0     = icosahedron.nodes[face.n[0]].p * 1000;
     auto p1     = icosahedron.nodes[face.n[1]].p * 1000;
     auto p2     = icosahedron.nodes[face.n[2]].p * 1000;
-    auto center = (p0 + p1 + p2) / 3.;
+    auto center = (p0 + p1 + p2) * (1.f / 3.f);
     auto radius = std::max(
       Vector3::Distance(center, p0),
-      std::max(Vector3::Distance(center, p2), Vector3::Distance(center, p2)));
+      std::max(Vector3::Distance(center, p1), Vector3::Distance(center, p2)));
     face.boundingSphere = BoundingSphere(center, radius);
   }
 
-  std::vector<Tile*> unparentedTiles;
-  float maxDistanceFromOrigin = 0.f;
-  for (auto& tile : tiles) {
-    maxDistanceFromOrigin
-      = std::max(maxDistanceFromOrigin, tile.boundingSphere.center.length()
-                                          + tile.boundingSphere.radius);
-
-    bool parentFound = false;
-    for (auto& face : icosahedron.faces) {
-      float distance = Vector3::Distance(tile.boundingSphere.center,
-                                         face.boundingSphere.center)
-                       + tile.boundingSphere.radius;
+  // Searching the parent face of each tile in parallel, the tiles are then
+  // appended to their parent in tile order
+  std::vector<size_t> parentFaces(tiles.size(), UdefIdx);
+  Float32Array distancesFromOrigin(tiles.size());
+  parallelFor(tiles.size(), [&](size_t t) {
+    const auto& tile = tiles[t];
+    distancesFromOrigin[t]
+      = tile.boundingSphere.center.length() + tile.boundingSphere.radius;
+    for (size_t f = 0; f < icosahedron.faces.size(); ++f) {
+      const auto& face = icosahedron.faces[f];
+      float distance
+        = Vector3::Distance(tile.boundingSphere.center,
+                            face.boundingSphere.center)
+          + tile.boundingSphere.radius;
       if (distance < face.boundingSphere.radius) {
-        face.children.emplace_back(&tile);
-        parentFound = true;
+        parentFaces[t] = f;
         break;
       }
     }
-    if (!parentFound) {
-      unparentedTiles.emplace_back(&tile);
+  });
+
+  std::vector<Tile*> unparentedTiles;
+  float maxDistanceFromOrigin = 0.f;
+  for (size_t t = 0; t < tiles.size(); ++t) {
+    maxDistanceFromOrigin
+      = std::max(maxDistanceFromOrigin, distancesFromOrigin[t]);
+    if (parentFaces[t] != UdefIdx) {
+      icosahedron.faces[parentFaces[t]].children.emplace_back(&tiles[t]);
+    }
+    else {
+      unparentedTiles.emplace_back(&tiles[t]);
     }
   }
 
@@ -457,9 +476,8 @@ void World::calculatePlateBoundaryStress(
   std::vector<size_t>& boundaryCornerInnerBorderIndexes)
 {
   boundaryCornerInnerBorderIndexes.resize(boundaryCorners.size());
-  size_t i = 0;
-  for (auto pcorner : boundaryCorners) {
-    auto& corner                   = *pcorner;
+  parallelFor(boundaryCorners.size(), [&](size_t i) {
+    auto& corner                   = *boundaryCorners[i];
     corner.distanceToPlateBoundary = 0;
 
     Border* innerBorder     = nullptr;
@@ -520,9 +538,7 @@ void World::calculatePlateBoundaryStress(
         = (stress0.pressure + stress1.pressure + stress2.pressure) / 3;
       corner.shear = (stress0.shear + stress1.shear + stress2.shear) / 3;
     }
-
-    ++i;
-  }
+  });
 }
 
 void World::calculateStress(const Vector3& movement0, const Vector3& movement1,
@@ -550,7 +566,7 @@ void World::blurPlateBoundaryStress(const std::vector<Corner*>& boundaryCorners,
   Float32Array newCornerPressure(boundaryCorners.size());
   Float32Array newCornerShear(boundaryCorners.size());
   for (size_t i = 0; i < stressBlurIterations; ++i) {
-    for (size_t j = 0; j < boundaryCorners.size(); ++j) {
+    parallelFor(boundaryCorners.size(), [&](size_t j) {
       auto& corner          = *boundaryCorners[j];
       float averagePressure = 0.f;
       float averageShear    = 0.f;
@@ -569,15 +585,15 @@ void World::blurPlateBoundaryStress(const std::vector<Corner*>& boundaryCorners,
       newCornerShear[j]
         = corner.shear * stressBlurCenterWeighting
           + (averageShear / neighborCount) * (1 - stressBlurCenterWeighting);
-    }
+    });
 
-    for (size_t j = 0; j < boundaryCorners.size(); ++j) {
+    parallelFor(boundaryCorners.size(), [&](size_t j) {
       auto& corner = *boundaryCorners[j];
       if (corner.betweenPlates) {
         corner.pressure = newCornerPressure[j];
         corner.shear    = newCornerShear[j];
       }
-    }
+    });
   }
 }
 
@@ -780,11 +796,10 @@ void World::processElevationBorderQueue(
 {
   while (elevationBorderQueue.size() > 0) {
     size_t iEnd = elevationBorderQueue.size();
-    auto it     = elevationBorderQueue.begin();
     for (size_t i = 0; i < iEnd; ++i) {
-      auto& front = *it;
-      ++it;
-      auto& corner = *front.nextCorner;
+      // Copied, the queue grows while the border is processed
+      const auto front = elevationBorderQueue[i];
+      auto& corner     = *front.nextCorner;
       if (corner.elevation == 0.f) {
         corner.distanceToPlateBoundary = front.distanceToPlateBoundary;
         corner.elevation               = front.origin.calculateElevation(
@@ -824,13 +839,14 @@ void World::processElevationBorderQueue(
 
 void World::calculateTileAverageElevations(std::vector<Tile>& tiles)
 {
-  for (auto& tile : tiles) {
+  parallelFor(tiles.size(), [&tiles](size_t t) {
+    auto& tile      = tiles[t];
     float elevation = 0;
     for (size_t j = 0; j < tile.corners.size(); ++j) {
       elevation += tile.corners[j]->elevation;
     }
     tile.elevation = elevation / tile.corners.size();
-  }
+  });
 }
 
 void World::generatePlanetWeather(Topology& topology,
@@ -840,7 +856,6 @@ void World::generatePlanetWeather(Topology& topology,
 {
   float planetRadius = 1000.f;
   std::vector<Whorl> whorls;
-  std::vector<Corner*> activeCorners;
   float totalHeat;
   float remainingHeat;
   float totalMoisture;
@@ -849,26 +864,29 @@ void World::generatePlanetWeather(Topology& topology,
   generateAirCurrentWhorls(planetRadius, random, whorls);
   calculateAirCurrents(topology.corners, whorls, planetRadius);
 
-  initializeAirHeat(topology.corners, heatLevel, activeCorners, totalHeat);
+  AirFlow airFlow(topology.corners);
+
+  initializeAirHeat(topology.corners, heatLevel, airFlow, totalHeat);
   remainingHeat = totalHeat;
   float consumedHeat;
   do {
-    consumedHeat = processAirHeat(activeCorners);
+    consumedHeat = airFlow.process();
     remainingHeat -= consumedHeat;
   } while (remainingHeat > 0 && consumedHeat >= 0.0001f);
 
-  calculateTemperature(topology.corners, topology.tiles, planetRadius);
+  calculateTemperature(topology.corners, topology.tiles, airFlow,
+                       planetRadius);
 
-  initializeAirMoisture(topology.corners, moistureLevel, activeCorners,
+  initializeAirMoisture(topology.corners, moistureLevel, airFlow,
                         totalMoisture);
   remainingMoisture = totalMoisture;
   float consumedMoisture;
   do {
-    consumedMoisture = processAirMoisture(activeCorners);
+    consumedMoisture = airFlow.process();
     remainingMoisture -= consumedMoisture;
   } while (remainingMoisture > 0 && consumedMoisture >= 0.0001f);
 
-  calculateMoisture(topology.corners, topology.tiles);
+  calculateMoisture(topology.corners, topology.tiles, airFlow);
 }
 
 void World::generateAirCurrentWhorls(float planetRadius,
@@ -932,7 +950,8 @@ void World::calculateAirCurrents(std::vector<Corner>& corners,
                                  const std::vector<Whorl>& whorls,
                                  float planetRadius)
 {
-  for (auto& corner : corners) {
+  parallelFor(corners.size(), [&](size_t c) {
+    auto& corner = corners[c];
     Vector3 airCurrent(0.f, 0.f, 0.f);
     float weight = 0;
     for (auto& whorl : whorls) {
@@ -949,10 +968,11 @@ void World::calculateAirCurrents(std::vector<Corner>& corners,
         weight += whorlWeight;
       }
     }
-    airCurrent /= weight;
+    airCurrent *= (1.f / weight);
     corner.airCurrent      = airCurrent;
     corner.airCurrentSpeed = airCurrent.length(); // kilometers per hour
 
+    corner.airCurrentOutflows.clear();
     corner.airCurrentOutflows.reserve(corner.borders.size());
     auto airCurrentDirection = airCurrent.normalize();
     float outflowSum         = 0.f;
@@ -973,19 +993,15 @@ void World::calculateAirCurrents(std::vector<Corner>& corners,
         corner.airCurrentOutflows[j] /= outflowSum;
       }
     }
-  }
+  });
 }
 
 void World::initializeAirHeat(std::vector<Corner>& corners, float heatLevel,
-                              std::vector<Corner*>& activeCorners,
-                              float& airHeat)
+                              AirFlow& airFlow, float& airHeat)
 {
-  activeCorners.clear();
-  airHeat = 0.f;
-  for (auto& corner : corners) {
-    corner.airHeat    = corner.area * heatLevel;
-    corner.newAirHeat = 0.f;
-    corner.heat       = 0.f;
+  airHeat = parallelSum(corners.size(), [&](size_t c) {
+    auto& corner = corners[c];
+    corner.heat  = 0.f;
 
     corner.heatAbsorption
       = 0.1f * corner.area
@@ -998,57 +1014,21 @@ void World::initializeAirHeat(std::vector<Corner>& corners, float heatLevel,
       corner.heatAbsorption *= 2.f;
     }
 
-    activeCorners.emplace_back(&corner);
-    airHeat += corner.airHeat;
-  }
-}
-
-float World::processAirHeat(std::vector<Corner*>& activeCorners)
-{
-  float consumedHeat     = 0.f;
-  auto activeCornerCount = activeCorners.size();
-
-  auto it = activeCorners.begin();
-  for (size_t i = 0; i < activeCornerCount; ++i, ++it) {
-    auto& corner = *(*it);
-    if (corner.airHeat == 0.f) {
-      continue;
-    }
-
-    float heatChange = std::max(
-      0.f, std::min(corner.airHeat, corner.heatAbsorption
-                                      * (1.f - corner.heat / corner.maxHeat)));
-    corner.heat += heatChange;
-    consumedHeat += heatChange;
-    float heatLoss = corner.area * (corner.heat / corner.maxHeat) * 0.02f;
-    heatChange     = std::min(corner.airHeat, heatChange + heatLoss);
-
-    float remainingCornerAirHeat = corner.airHeat - heatChange;
-    corner.airHeat               = 0;
-
-    for (size_t j = 0; j < corner.corners.size(); ++j) {
-      const auto& outflow = corner.airCurrentOutflows[j];
-      if (outflow > 0) {
-        corner.corners[j]->newAirHeat += remainingCornerAirHeat * outflow;
-        activeCorners.emplace_back(corner.corners[j]);
-      }
-    }
-  }
-
-  activeCorners.erase(activeCorners.begin(), it);
-
-  for (auto& pcorner : activeCorners) {
-    pcorner->airHeat    = pcorner->newAirHeat;
-    pcorner->newAirHeat = 0;
-  }
-
-  return consumedHeat;
+    airFlow.air[c]            = corner.area * heatLevel;
+    airFlow.absorptionRate[c] = corner.heatAbsorption;
+    airFlow.absorbed[c]       = 0.f;
+    airFlow.maxAbsorbed[c]    = corner.maxHeat;
+    return airFlow.air[c];
+  });
 }
 
 void World::calculateTemperature(std::vector<Corner>& corners,
-                                 std::vector<Tile>& tiles, float planetRadius)
+                                 std::vector<Tile>& tiles,
+                                 const AirFlow& airFlow, float planetRadius)
 {
-  for (auto& corner : corners) {
+  parallelFor(corners.size(), [&](size_t c) {
+    auto& corner = corners[c];
+    corner.heat  = airFlow.absorbed[c];
     float latitudeEffect
       = std::sqrt(1.f - std::abs(corner.position.y) / planetRadius);
     float elevationEffect
@@ -1059,31 +1039,25 @@ void World::calculateTemperature(std::vector<Corner>& corners,
       = (latitudeEffect * elevationEffect * 0.7f + normalizedHeat * 0.3f) * 5.f
           / 3.f
         - 2.f / 3.f;
-  }
+  });
 
-  for (auto& tile : tiles) {
+  parallelFor(tiles.size(), [&tiles](size_t t) {
+    auto& tile       = tiles[t];
     tile.temperature = 0.f;
     for (const auto& pcorner : tile.corners) {
       tile.temperature += pcorner->temperature;
     }
     tile.temperature /= tile.corners.size();
-  }
+  });
 }
 
 void World::initializeAirMoisture(std::vector<Corner>& corners,
-                                  float moistureLevel,
-                                  std::vector<Corner*>& activeCorners,
+                                  float moistureLevel, AirFlow& airFlow,
                                   float& airMoisture)
 {
-  airMoisture = 0.f;
-  for (auto& corner : corners) {
-    corner.airMoisture
-      = (corner.elevation > 0.f) ?
-          0.f :
-          corner.area * moistureLevel
-            * std::max(0.f, std::min(0.5f + corner.temperature * 0.5f, 1.f));
-    corner.newAirMoisture = 0.f;
-    corner.precipitation  = 0.f;
+  airMoisture = parallelSum(corners.size(), [&](size_t c) {
+    auto& corner         = corners[c];
+    corner.precipitation = 0.f;
     corner.precipitationRate
       = 0.0075f * corner.area
         / std::max(0.1f, std::min(corner.airCurrentSpeed, 1.f));
@@ -1099,77 +1073,42 @@ void World::initializeAirMoisture(std::vector<Corner>& corners,
       corner.maxPrecipitation = corner.area * 0.25f;
     }
 
-    activeCorners.emplace_back(&corner);
-    airMoisture += corner.airMoisture;
-  }
-}
-
-float World::processAirMoisture(std::vector<Corner*>& activeCorners)
-{
-  float consumedMoisture = 0.f;
-  auto activeCornerCount = activeCorners.size();
-  auto it                = activeCorners.begin();
-  for (size_t i = 0; i < activeCornerCount; ++i, ++it) {
-    auto& corner = *(*it);
-    if (corner.airMoisture == 0.f) {
-      continue;
-    }
-
-    float moistureChange = std::max(
-      0.f,
-      std::min(corner.airMoisture,
-               corner.precipitationRate
-                 * (1.f - corner.precipitation / corner.maxPrecipitation)));
-    corner.precipitation += moistureChange;
-    consumedMoisture += moistureChange;
-    float moistureLoss
-      = corner.area * (corner.precipitation / corner.maxPrecipitation) * 0.02f;
-    moistureChange
-      = std::min(corner.airMoisture, moistureChange + moistureLoss);
-
-    float remainingCornerAirMoisture = corner.airMoisture - moistureChange;
-    corner.airMoisture               = 0.f;
-
-    for (size_t j = 0; j < corner.corners.size(); ++j) {
-      float outflow = corner.airCurrentOutflows[j];
-      if (outflow > 0.f) {
-        corner.corners[j]->newAirMoisture
-          += remainingCornerAirMoisture * outflow;
-        activeCorners.emplace_back(corner.corners[j]);
-      }
-    }
-  }
-
-  activeCorners.erase(activeCorners.begin(), it);
-
-  for (auto& pcorner : activeCorners) {
-    pcorner->airMoisture    = pcorner->newAirMoisture;
-    pcorner->newAirMoisture = 0.f;
-  }
-
-  return consumedMoisture;
+    airFlow.air[c]
+      = (corner.elevation > 0.f) ?
+          0.f :
+          corner.area * moistureLevel
+            * std::max(0.f, std::min(0.5f + corner.temperature * 0.5f, 1.f));
+    airFlow.absorptionRate[c] = corner.precipitationRate;
+    airFlow.absorbed[c]       = 0.f;
+    airFlow.maxAbsorbed[c]    = corner.maxPrecipitation;
+    return airFlow.air[c];
+  });
 }
 
 void World::calculateMoisture(std::vector<Corner>& corners,
-                              std::vector<Tile>& tiles)
+                              std::vector<Tile>& tiles, const AirFlow& airFlow)
 {
-  for (auto& corner : corners) {
-    corner.moisture = corner.precipitation / corner.area / 0.5f;
-  }
-
-  for (auto& tile : tiles) {
+  parallelFor(corners.size(), [&](size_t c) {
+    auto& corner         = corners[c];
+    corner.precipitation = airFlow.absorbed[c];
+    corner.moisture      = corner.precipitation / corner.area / 0.5f;
+  });
+
+  parallelFor(tiles.size(), [&tiles](size_t t) {
+    auto& tile    = tiles[t];
     tile.moisture = 0.f;
     for (auto pcorner : tile.corners) {
-      tile.moisture += pcorner->temperature;
+      tile.moisture += pcorner->moisture;
     }
     tile.moisture /= tile.corners.size();
-  }
+  });
 }
 
 void World::generatePlanetBiomes(std::vector<Tile>& tiles,
                                  float /*planetRadius*/)
 {
-  for (auto& tile : tiles) {
+  parallelFor(tiles.size(), [&tiles](size_t t) {
+    auto& tile     = tiles[t];
     auto elevation = std::max(0.f, tile.elevation);
     // auto latitude = std::abs(tile.position.y / planetRadius);
     auto temperature = tile.temperature;
@@ -1244,18 +1183,55 @@ void World::generatePlanetBiomes(std::vector<Tile>& tiles,
         tile.biome = "snowyMountain";
       }
     }
-  }
+  });
 }
 
 void World::generatePlanetRenderData(Topology& topology,
+                                     SpatialPartition& partition,
                                      IRandomFunction& random,
                                      RenderData& renderData)
 {
-  buildSurfaceRenderObject(topology.tiles, random, renderData.surface);
-  buildPlateBoundariesRenderObject(topology.borders,
-                                   renderData.plateBoundaries);
-  buildPlateMovementsRenderObject(topology.tiles, renderData.plateMovements);
-  buildAirCurrentsRenderObject(topology.corners, renderData.airCurrents);
+  // The color deviances are drawn in tile order before building the render
+  // objects concurrently, so that the render data only depends on the seed
+  std::vector<Color4> colorDeviances;
+  colorDeviances.reserve(topology.tiles.size());
+  for (size_t t = 0; t < topology.tiles.size(); ++t) {
+    float r = random.unit();
+    float g = random.unit();
+    float b = random.unit();
+    colorDeviances.emplace_back(Color4(r, g, b));
+  }
+
+  // The leaves of the spatial partition: the tiles of the root partition
+  // followed by the tiles of each child partition
+  std::vector<const std::vector<Tile*>*> partitionTiles{&partition.tiles};
+  for (const auto& childPartition : partition.partitions) {
+    partitionTiles.emplace_back(&childPartition.tiles);
+  }
+
+  renderData.surfaces.assign(partitionTiles.size(), RenderObject());
+  renderData.plateMovements.assign(partitionTiles.size(), RenderObject());
+  renderData.plateBoundaries = RenderObject();
+  renderData.airCurrents     = RenderObject();
+
+  auto plateBoundaries = std::async(std::launch::async, [&]() {
+    buildPlateBoundariesRenderObject(topology.borders,
+                                     renderData.plateBoundaries);
+  });
+  auto airCurrents = std::async(std::launch::async, [&]() {
+    buildAirCurrentsRenderObject(topology.corners, renderData.airCurrents);
+  });
+  parallelFor(partitionTiles.size(), 1,
+              [&](size_t begin, size_t end, size_t /*block*/) {
+                for (size_t p = begin; p < end; ++p) {
+                  buildSurfaceRenderObject(*partitionTiles[p], colorDeviances,
+                                           renderData.surfaces[p]);
+                  buildPlateMovementsRenderObject(
+                    *partitionTiles[p], renderData.plateMovements[p]);
+                }
+              });
+  plateBoundaries.get();
+  airCurrents.get();
 }
 
 void World::doBuildTileWedge(RenderObject& ro, size_t b, size_t s, size_t t)
@@ -1265,12 +1241,14 @@ void World::doBuildTileWedge(RenderObject& ro, size_t b, size_t s, size_t t)
   ro.triangle(b + s + 1, b + s + 2, b + t + 2);
 }
 
-void World::buildSurfaceRenderObject(std::vector<Tile>& tiles,
-                                     IRandomFunction& random, RenderObject& ro)
+void World::buildSurfaceRenderObject(const std::vector<Tile*>& tiles,
+                                     const std::vector<Color4>& colorDeviances,
+                                     RenderObject& ro)
 {
-  size_t baseIndex = 0;
-  for (auto& tile : tiles) {
-    auto colorDeviance = Color4(random.unit(), random.unit(), random.unit());
+  size_t baseIndex = ro.getCurrentVertexCount();
+  for (auto ptile : tiles) {
+    auto& tile         = *ptile;
+    auto colorDeviance = colorDeviances[tile.id];
     Color4 terrainColor;
     if (tile.elevation <= 0) {
       if (tile.biome == "ocean") {
@@ -1432,20 +1410,20 @@ void World::buildSurfaceRenderObject(std::vector<Tile>& tiles,
   }
 }
 
-void World::buildPlateBoundariesRenderObject(std::vector<Border>& borders,
+void World::buildPlateBoundariesRenderObject(const std::vector<Border>& borders,
                                              RenderObject& ro)
 {
   auto baseIndex = ro.getCurrentVertexCount();
   for (auto& border : borders) {
     if (border.betweenPlates) {
-      auto normal = border.midpoint.normalize();
+      auto normal = Vector3::Normalize(border.midpoint);
       auto offset = normal * 1;
 
       auto& borderPoint0 = border.corners[0]->position;
       auto& borderPoint1 = border.corners[1]->position;
       auto& tilePoint0   = border.tiles[0]->averagePosition;
       auto& tilePoint1   = border.tiles[1]->averagePosition;
-      auto nl = (border.tiles[0]->normal + border.tiles[1]->normal) / 2.f;
+      auto nl = (border.tiles[0]->normal + border.tiles[1]->normal) * 0.5f;
 
       auto pressure = std::max(-1.f, std::min((border.corners[0]->pressure
                                                + border.corners[1]->pressure)
@@ -1493,29 +1471,30 @@ void World::buildPlateBoundariesRenderObject(std::vector<Border>& borders,
   }
 }
 
-void World::buildPlateMovementsRenderObject(std::vector<Tile>& tiles,
+void World::buildPlateMovementsRenderObject(const std::vector<Tile*>& tiles,
                                             RenderObject& ro)
 {
-  for (auto& tile : tiles) {
+  for (auto ptile : tiles) {
+    auto& tile    = *ptile;
     auto& plate   = *tile.plate;
     auto movement = plate.calculateMovement(tile.position);
     auto plateMovementColor
       = Color4(1.f - plate.color.r, 1.f - plate.color.g, 1.f - plate.color.b);
 
     buildArrow(ro, tile.position * 1.002f, movement * 0.5f,
-               tile.position.normalize(), std::min(movement.length(), 4.f),
-               plateMovementColor);
+               Vector3::Normalize(tile.position),
+               std::min(movement.length(), 4.f), plateMovementColor);
 
     tile.plateMovement = movement;
   }
 }
 
-void World::buildAirCurrentsRenderObject(std::vector<Corner>& corners,
+void World::buildAirCurrentsRenderObject(const std::vector<Corner>& corners,
                                          RenderObject& ro)
 {
   for (auto& corner : corners) {
     buildArrow(ro, corner.position * 1.002f, corner.airCurrent * 0.5f,
-               corner.position.normalize(),
+               Vector3::Normalize(corner.position),
                std::min(corner.airCurrent.length(), 4.f),
                Color4(1.f, 1.f, 1.f, 1.f));
   }
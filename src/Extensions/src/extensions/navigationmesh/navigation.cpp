@@ -2,17 +2,26 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/extensions/navigationmesh/channel.h>
+#include <babylon/extensions/utils/parallel_for.h>
 #include <babylon/math/plane.h>
 #include <babylon/math/vector3.h>
 #include <babylon/mesh/geometry.h>
 #include <babylon/mesh/mesh.h>
 #include <babylon/mesh/vertex_buffer.h>
 
-#include <babylon/extensions/pathfinding/a_star_search.h>
-
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+// Amount of A* corridors kept per zone before the cache is flushed
+constexpr std::size_t MaxCachedPaths = 4096;
+
+// Amount of queries processed by a single block of findPaths
+constexpr std::size_t QueryBlockSize = 16;
+
+} // end of anonymous namespace
+
 Navigation::Navigation()
 {
 }
@@ -31,6 +40,15 @@ void Navigation::setZoneData(const std::string& zone,
                              const GroupedNavigationMesh& data)
 {
   _zoneNodes[zone] = data;
+
+  auto& nodeIndexes = _zoneNodeIndexes[zone];
+  nodeIndexes.clear();
+  for (auto& group : data.groups) {
+    nodeIndexes.emplace_back(group);
+  }
+
+  std::lock_guard<std::mutex> lock(_zonePathsMutex);
+  _zonePaths.erase(zone);
 }
 
 int Navigation::getGroup(const std::string& zone, const Vector3& position)
@@ -40,15 +58,14 @@ int Navigation::getGroup(const std::string& zone, const Vector3& position)
     return closestNodeGroup;
   }
 
-  float measuredDistance = 0.f;
-  float distance         = std::numeric_limits<float>::infinity();
-  for (size_t index = 0; index < _zoneNodes[zone].groups.size(); ++index) {
-    for (auto& node : _zoneNodes[zone].groups[index]) {
-      measuredDistance = Vector3::DistanceSquared(node.centroid, position);
-      if (measuredDistance < distance) {
-        closestNodeGroup = static_cast<int>(index);
-        distance         = measuredDistance;
-      }
+  float measuredDistance  = 0.f;
+  float distance          = std::numeric_limits<float>::infinity();
+  const auto& nodeIndexes = _zoneNodeIndexes[zone];
+  for (size_t index = 0; index < nodeIndexes.size(); ++index) {
+    if (nodeIndexes[index].closestNode(position, measuredDistance) >= 0
+        && measuredDistance < distance) {
+      closestNodeGroup = static_cast<int>(index);
+      distance         = measuredDistance;
     }
   }
   return closestNodeGroup;
@@ -59,44 +76,80 @@ std::vector<Vector3> Navigation::findPath(const Vector3& startPosition,
                                           const std::string& zone,
                                           std::size_t group)
 {
-  auto& allNodes = _zoneNodes[zone].groups[group];
-  auto& vertices = _zoneNodes[zone].vertices;
-
-  const auto getNodeIndex = [&allNodes](const Vector3& position) {
-    int nodeIndex          = -1;
-    float distance         = std::numeric_limits<float>::infinity();
-    int index              = 0;
-    float measuredDistance = 0.f;
-    for (auto& node : allNodes) {
-      measuredDistance = Vector3::DistanceSquared(node.centroid, position);
-      if (measuredDistance < distance) {
-        nodeIndex = index;
-        distance  = measuredDistance;
-      }
-      ++index;
-    }
-    return nodeIndex;
-  };
+  if (!stl_util::contains(_zoneNodes, zone)) {
+    return std::vector<Vector3>();
+  }
+
+  auto searchState = _acquireSearchState();
+  auto path
+    = _findPath(startPosition, targetPosition, zone, group, *searchState);
+  _releaseSearchState(std::move(searchState));
+  return path;
+}
+
+std::vector<std::vector<Vector3>>
+Navigation::findPaths(const std::vector<NavigationQuery>& queries,
+                      const std::string& zone)
+{
+  std::vector<std::vector<Vector3>> paths(queries.size());
+  if (!stl_util::contains(_zoneNodes, zone)) {
+    return paths;
+  }
+
+  // The zone maps are only read by the workers, except for the path cache
+  parallelFor(queries.size(), QueryBlockSize,
+              [&](size_t begin, size_t end, size_t /*block*/) {
+                auto searchState = _acquireSearchState();
+                for (size_t i = begin; i < end; ++i) {
+                  const auto& query = queries[i];
+                  paths[i] = _findPath(query.startPosition,
+                                       query.targetPosition, zone,
+                                       query.group, *searchState);
+                }
+                _releaseSearchState(std::move(searchState));
+              });
+
+  return paths;
+}
+
+std::vector<Vector3> Navigation::_findPath(const Vector3& startPosition,
+                                           const Vector3& targetPosition,
+                                           const std::string& zone,
+                                           std::size_t group,
+                                           SearchState& searchState)
+{
+  const auto& zoneNodes = _zoneNodes.at(zone);
+  if (group >= zoneNodes.groups.size()) {
+    return std::vector<Vector3>();
+  }
+  const auto& allNodes  = zoneNodes.groups[group];
+  const auto& vertices  = zoneNodes.vertices;
+  const auto& nodeIndex = _zoneNodeIndexes.at(zone)[group];
 
   // If we can't find any node, just go straight to the target
-  auto closestNodeIndex  = getNodeIndex(startPosition);
-  auto farthestNodeIndex = getNodeIndex(targetPosition);
+  float distance         = 0.f;
+  auto closestNodeIndex  = nodeIndex.closestNode(startPosition, distance);
+  auto farthestNodeIndex = nodeIndex.closestNode(targetPosition, distance);
   if ((closestNodeIndex == -1) || (farthestNodeIndex == -1)) {
     return std::vector<Vector3>();
   }
 
-  auto& closestNode  = allNodes[static_cast<std::size_t>(closestNodeIndex)];
-  auto& farthestNode = allNodes[static_cast<std::size_t>(farthestNodeIndex)];
-  auto pathIds       = AStarSearch(allNodes, closestNode, farthestNode);
+  const auto pathIds = _findCorridor(
+    zone, group, static_cast<std::size_t>(closestNodeIndex),
+    static_cast<std::size_t>(farthestNodeIndex), searchState);
+  if (pathIds.empty()) {
+    return std::vector<Vector3>();
+  }
 
-  const auto getPortalFromTo
-    = [](const NavigationGroup& a, const NavigationGroup& b) -> Uint32Array {
+  const auto getPortalFromTo = [](const NavigationGroup& a,
+                                  const NavigationGroup& b)
+    -> const Uint32Array* {
     for (size_t i = 0; i < a.neighbours.size(); ++i) {
       if (a.neighbours[i] == b.id) {
-        return a.portals[i];
+        return &a.portals[i];
       }
     }
-    return Uint32Array();
+    return nullptr;
   };
 
   // We got the corridor
@@ -106,10 +159,10 @@ std::vector<Vector3> Navigation::findPath(const Vector3& startPosition,
   for (size_t i = 0; i < pathIds.size() - 1; ++i) {
     const auto& polygon     = allNodes[pathIds[i]];
     const auto& nextPolygon = allNodes[pathIds[i + 1]];
-    auto portals            = getPortalFromTo(polygon, nextPolygon);
-    if (!portals.empty()) {
-      channel.push(getVectorFrom(vertices, portals[0]),
-                   getVectorFrom(vertices, portals[1]));
+    const auto* portals     = getPortalFromTo(polygon, nextPolygon);
+    if (portals && !portals->empty()) {
+      channel.push(getVectorFrom(vertices, (*portals)[0]),
+                   getVectorFrom(vertices, (*portals)[1]));
     }
   }
   channel.push(targetPosition);
@@ -123,6 +176,52 @@ std::vector<Vector3> Navigation::findPath(const Vector3& startPosition,
   return vectors;
 }
 
+std::vector<std::size_t> Navigation::_findCorridor(const std::string& zone,
+                                                   std::size_t group,
+                                                   std::size_t start,
+                                                   std::size_t goal,
+                                                   SearchState& searchState)
+{
+  const NavigationPathKey key{group, start, goal};
+  {
+    std::lock_guard<std::mutex> lock(_zonePathsMutex);
+    auto& paths = _zonePaths[zone];
+    auto it     = paths.find(key);
+    if (it != paths.end()) {
+      return it->second;
+    }
+  }
+
+  const auto& allNodes = _zoneNodes.at(zone).groups[group];
+  auto pathIds
+    = AStarSearch(allNodes, allNodes[start], allNodes[goal], searchState);
+
+  std::lock_guard<std::mutex> lock(_zonePathsMutex);
+  auto& paths = _zonePaths[zone];
+  if (paths.size() >= MaxCachedPaths) {
+    paths.clear();
+  }
+  paths[key] = pathIds;
+  return pathIds;
+}
+
+std::unique_ptr<Navigation::SearchState> Navigation::_acquireSearchState()
+{
+  std::lock_guard<std::mutex> lock(_searchStatesMutex);
+  if (_searchStates.empty()) {
+    return std::make_unique<SearchState>();
+  }
+  auto searchState = std::move(_searchStates.back());
+  _searchStates.pop_back();
+  return searchState;
+}
+
+void Navigation::_releaseSearchState(std::unique_ptr<SearchState>&& searchState)
+{
+  std::lock_guard<std::mutex> lock(_searchStatesMutex);
+  _searchStates.emplace_back(std::move(searchState));
+}
+
 bool Navigation::_isPointInPoly(const std::vector<Vector3>& poly,
                                 const Vector3& pt) const
 {
@@ -0,0 +1,140 @@
+#include <babylon/extensions/navigationmesh/navigation_node_index.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+NavigationNodeIndex::NavigationNodeIndex()
+    : _minX{0.f}
+    , _minZ{0.f}
+    , _cellSize{1.f}
+    , _columns{0}
+    , _rows{0}
+{
+}
+
+NavigationNodeIndex::NavigationNodeIndex(const NavigationGroupGraph& nodes)
+    : NavigationNodeIndex()
+{
+  if (nodes.size() == 0) {
+    return;
+  }
+
+  float maxX = -std::numeric_limits<float>::max();
+  float maxZ = -std::numeric_limits<float>::max();
+  _minX      = std::numeric_limits<float>::max();
+  _minZ      = std::numeric_limits<float>::max();
+  _centroids.reserve(nodes.size());
+  for (auto& node : nodes) {
+    _centroids.emplace_back(node.centroid);
+    _minX = std::min(_minX, node.centroid.x);
+    _minZ = std::min(_minZ, node.centroid.z);
+    maxX  = std::max(maxX, node.centroid.x);
+    maxZ  = std::max(maxZ, node.centroid.z);
+  }
+
+  // About two nodes per cell, and never more cells than nodes on one axis
+  const float count  = static_cast<float>(nodes.size());
+  const float width  = maxX - _minX;
+  const float height = maxZ - _minZ;
+  _cellSize = std::max(std::sqrt(2.f * width * height / count),
+                       2.f * std::max(width, height) / count);
+  if (!(_cellSize > 0.f)) {
+    _cellSize = 1.f;
+  }
+  _columns = static_cast<std::size_t>(width / _cellSize) + 1;
+  _rows    = static_cast<std::size_t>(height / _cellSize) + 1;
+
+  // Counting sort of the nodes by cell
+  _cellStarts.assign(_columns * _rows + 1, 0);
+  for (auto& centroid : _centroids) {
+    ++_cellStarts[_cellIndex(centroid.x, centroid.z) + 1];
+  }
+  for (std::size_t cell = 1; cell < _cellStarts.size(); ++cell) {
+    _cellStarts[cell] += _cellStarts[cell - 1];
+  }
+  _cellNodes.resize(_centroids.size());
+  Uint32Array cellEnds(_cellStarts.begin(), _cellStarts.end() - 1);
+  for (std::size_t node = 0; node < _centroids.size(); ++node) {
+    const auto& centroid = _centroids[node];
+    _cellNodes[cellEnds[_cellIndex(centroid.x, centroid.z)]++]
+      = static_cast<std::uint32_t>(node);
+  }
+}
+
+NavigationNodeIndex::~NavigationNodeIndex()
+{
+}
+
+std::size_t NavigationNodeIndex::_cellIndex(float x, float z) const
+{
+  // Positions outside of the grid are clamped to its border cells
+  const float column
+    = std::min(std::max(std::floor((x - _minX) / _cellSize), 0.f),
+               static_cast<float>(_columns - 1));
+  const float row = std::min(std::max(std::floor((z - _minZ) / _cellSize), 0.f),
+                             static_cast<float>(_rows - 1));
+  return static_cast<std::size_t>(row) * _columns
+         + static_cast<std::size_t>(column);
+}
+
+int NavigationNodeIndex::closestNode(const Vector3& position,
+                                     float& distance) const
+{
+  int nodeIndex = -1;
+  distance      = std::numeric_limits<float>::infinity();
+  if (_centroids.empty()) {
+    return nodeIndex;
+  }
+
+  const std::size_t cell  = _cellIndex(position.x, position.z);
+  const auto centerRow    = static_cast<std::ptrdiff_t>(cell / _columns);
+  const auto centerColumn = static_cast<std::ptrdiff_t>(cell % _columns);
+  const auto rows         = static_cast<std::ptrdiff_t>(_rows);
+  const auto columns      = static_cast<std::ptrdiff_t>(_columns);
+  const auto maxRing      = std::max(rows, columns);
+
+  const auto searchCell = [&](std::ptrdiff_t row, std::ptrdiff_t column) {
+    if (row < 0 || row >= rows || column < 0 || column >= columns) {
+      return;
+    }
+    const auto c = static_cast<std::size_t>(row * columns + column);
+    for (auto i = _cellStarts[c]; i < _cellStarts[c + 1]; ++i) {
+      const auto node = static_cast<int>(_cellNodes[i]);
+      const float measuredDistance
+        = Vector3::DistanceSquared(_centroids[_cellNodes[i]], position);
+      if (measuredDistance < distance
+          || (measuredDistance == distance && node < nodeIndex)) {
+        nodeIndex = node;
+        distance  = measuredDistance;
+      }
+    }
+  };
+
+  for (std::ptrdiff_t ring = 0; ring <= maxRing; ++ring) {
+    // The nodes of this ring and beyond are at least that far, with a margin
+    // for the rounding of the cell coordinates
+    const float bound = (static_cast<float>(ring) - 1.01f) * _cellSize;
+    if (bound > 0.f && distance < bound * bound) {
+      break;
+    }
+    if (ring == 0) {
+      searchCell(centerRow, centerColumn);
+      continue;
+    }
+    for (std::ptrdiff_t column = centerColumn - ring;
+         column <= centerColumn + ring; ++column) {
+      searchCell(centerRow - ring, column);
+      searchCell(centerRow + ring, column);
+    }
+    for (std::ptrdiff_t row = centerRow - ring + 1; row < centerRow + ring;
+         ++row) {
+      searchCell(row, centerColumn - ring);
+      searchCell(row, centerColumn + ring);
+    }
+  }
+
+  return nodeIndex;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -1,5 +1,7 @@
 #include <babylon/extensions/noisegeneration/perlin_noise.h>
 
+#include <babylon/extensions/noisegeneration/noise_lanes.h>
+
 namespace BABYLON {
 namespace Extensions {
 
@@ -105,6 +107,98 @@ double PerlinNoise::noise(double x, double y, double z) const
   return lerp(w, a, b);
 }
 
+void PerlinNoise::noise(const double* x, const double* y, const double* z,
+                        double* result, size_t count) const
+{
+  using L = NoiseLanes;
+
+  // Fractional positions and gradients of the 8 cube corners of each lane
+  std::array<std::array<float, L::Width>, 3> f{};
+  std::array<std::array<std::array<float, L::Width>, 3>, 8> g;
+  const auto gather = [&g](size_t corner, size_t lane, int hash) {
+    const float* gradient = L::gradient3D(hash);
+    g[corner][0][lane]    = gradient[0];
+    g[corner][1][lane]    = gradient[1];
+    g[corner][2][lane]    = gradient[2];
+  };
+
+  for (size_t i = 0; i < count; i += L::Width) {
+    const auto n = L::laneCount(count - i);
+
+    // The unit cubes are found in double precision, lane by lane
+    for (size_t l = 0; l < L::Width; ++l) {
+      const double px = l < n ? x[i + l] : 0.0;
+      const double py = l < n ? y[i + l] : 0.0;
+      const double pz = l < n ? z[i + l] : 0.0;
+      const double fx = std::floor(px);
+      const double fy = std::floor(py);
+      const double fz = std::floor(pz);
+      f[0][l]         = static_cast<float>(px - fx);
+      f[1][l]         = static_cast<float>(py - fy);
+      f[2][l]         = static_cast<float>(pz - fz);
+
+      const auto X  = static_cast<unsigned>(static_cast<int32_t>(fx) & 255);
+      const auto Y  = static_cast<int32_t>(fy) & 255;
+      const auto Z  = static_cast<int32_t>(fz) & 255;
+      const auto A  = p[X] + Y;
+      const auto AA = static_cast<unsigned>(p[static_cast<unsigned>(A)] + Z);
+      const auto AB
+        = static_cast<unsigned>(p[static_cast<unsigned>(A + 1)] + Z);
+      const auto B  = p[X + 1] + Y;
+      const auto BA = static_cast<unsigned>(p[static_cast<unsigned>(B)] + Z);
+      const auto BB
+        = static_cast<unsigned>(p[static_cast<unsigned>(B + 1)] + Z);
+
+      gather(0, l, p[AA]);
+      gather(1, l, p[BA]);
+      gather(2, l, p[AB]);
+      gather(3, l, p[BB]);
+      gather(4, l, p[AA + 1]);
+      gather(5, l, p[BA + 1]);
+      gather(6, l, p[AB + 1]);
+      gather(7, l, p[BB + 1]);
+    }
+
+    const auto one = L::splat(1.f);
+    const auto x0  = L::load(f[0].data());
+    const auto y0  = L::load(f[1].data());
+    const auto z0  = L::load(f[2].data());
+    const auto x1  = L::sub(x0, one);
+    const auto y1  = L::sub(y0, one);
+    const auto z1  = L::sub(z0, one);
+
+    const auto corner = [&g](size_t c, L::Float dx, L::Float dy, L::Float dz) {
+      return L::dot(L::load(g[c][0].data()), L::load(g[c][1].data()),
+                    L::load(g[c][2].data()), dx, dy, dz);
+    };
+    const auto fadeLanes = [&one](L::Float t) {
+      // t * t * t * (t * (t * 6 - 15) + 10)
+      const auto s = L::add(
+        L::mul(t, L::sub(L::mul(t, L::splat(6.f)), L::splat(15.f))),
+        L::splat(10.f));
+      return L::mul(L::mul(L::mul(t, t), t), s);
+    };
+    const auto lerpLanes = [](L::Float t, L::Float a, L::Float b) {
+      return L::add(a, L::mul(t, L::sub(b, a)));
+    };
+
+    // Add blended results from 8 corners of cube
+    const auto u = fadeLanes(x0);
+    const auto v = fadeLanes(y0);
+    const auto w = fadeLanes(z0);
+    const auto a = lerpLanes(
+      v, lerpLanes(u, corner(0, x0, y0, z0), corner(1, x1, y0, z0)),
+      lerpLanes(u, corner(2, x0, y1, z0), corner(3, x1, y1, z0)));
+    const auto b = lerpLanes(
+      v, lerpLanes(u, corner(4, x0, y0, z1), corner(5, x1, y0, z1)),
+      lerpLanes(u, corner(6, x0, y1, z1), corner(7, x1, y1, z1)));
+
+    std::array<float, L::Width> values;
+    L::store(values.data(), lerpLanes(w, a, b));
+    std::copy(values.begin(), values.begin() + n, result + i);
+  }
+}
+
 PerlinNoiseOctave::PerlinNoiseOctave(int octaves, uint32_t seed)
     : _perlinNoise{seed}, _octaves{octaves}
 {
@@ -127,5 +221,35 @@ double PerlinNoiseOctave::noise(double x, double y, double z) const
   return result;
 }
 
+void PerlinNoiseOctave::noise(const double* x, const double* y,
+                              const double* z, double* result,
+                              size_t count) const
+{
+  // The points are processed in blocks small enough to stay in the cache
+  static constexpr size_t BlockSize = 256;
+  std::array<double, BlockSize> bx, by, bz, values;
+
+  for (size_t i = 0; i < count; i += BlockSize) {
+    const auto n = std::min(BlockSize, count - i);
+    std::fill(result + i, result + i + n, 0.0);
+
+    double freq = 1.0;
+    double amp  = 1.0;
+    for (int o = 0; o < _octaves; ++o) {
+      for (size_t j = 0; j < n; ++j) {
+        bx[j] = x[i + j] * freq;
+        by[j] = y[i + j] * freq;
+        bz[j] = z[i + j] * freq;
+      }
+      _perlinNoise.noise(bx.data(), by.data(), bz.data(), values.data(), n);
+      for (size_t j = 0; j < n; ++j) {
+        result[i + j] += values[j] * amp;
+      }
+      freq *= 2.0;
+      amp *= 0.5;
+    }
+  }
+}
+
 } // end of namespace Extensions
 } // end of namespace BABYLON
@@ -1,5 +1,7 @@
 #include <babylon/extensions/noisegeneration/simplex_noise.h>
 
+#include <babylon/extensions/noisegeneration/noise_lanes.h>
+#include <babylon/extensions/utils/parallel_for.h>
 #include <babylon/math/vector2.h>
 #include <babylon/math/vector3.h>
 #include <babylon/math/vector4.h>
@@ -2081,6 +2083,220 @@ float SimplexNoise::iqfBm(const Vector3& v, uint8_t octaves, float lacunarity,
 
 // -----------------------------------------------------------------------------
 
+namespace {
+
+using Permutations = std::array<unsigned char, 512>;
+
+// Batched version of SimplexNoise::noise(const Vector2&)
+NoiseLanes::Float simplexNoise2D(NoiseLanes::Float x, NoiseLanes::Float y,
+                                 const Permutations& perm)
+{
+  using L = NoiseLanes;
+
+  // Gradients of SimplexNoise::grad(hash, x, y)
+  static const float gradients[8][2]
+    = {{1.f, 2.f},  {-1.f, 2.f},  {1.f, -2.f}, {-1.f, -2.f},
+       {2.f, 1.f},  {2.f, -1.f},  {-2.f, 1.f}, {-2.f, -1.f}};
+
+  // Skew the input space to determine which simplex cell we're in
+  const auto s  = L::mul(L::add(x, y), L::splat(SimplexNoise::F2));
+  const auto i  = L::fastFloor(L::add(x, s));
+  const auto j  = L::fastFloor(L::add(y, s));
+  const auto t  = L::mul(L::toFloat(L::add(i, j)), L::splat(SimplexNoise::G2));
+  const auto x0 = L::sub(x, L::sub(L::toFloat(i), t));
+  const auto y0 = L::sub(y, L::sub(L::toFloat(j), t));
+
+  // Lower (XY order) or upper (YX order) triangle
+  const auto i1 = L::oneIf(L::greater(x0, y0));
+  const auto j1 = L::sub(L::splat(1.f), i1);
+
+  std::array<int32_t, L::Width> ci, cj;
+  std::array<float, L::Width> oi;
+  L::store(ci.data(), i);
+  L::store(cj.data(), j);
+  L::store(oi.data(), i1);
+
+  std::array<std::array<std::array<float, L::Width>, 2>, 3> g;
+  for (size_t l = 0; l < L::Width; ++l) {
+    const int ii = ci[l] & 0xff;
+    const int jj = cj[l] & 0xff;
+    const int i1l = static_cast<int>(oi[l]);
+    const float* g0 = gradients[perm[ii + perm[jj]] & 7];
+    const float* g1 = gradients[perm[ii + i1l + perm[jj + 1 - i1l]] & 7];
+    const float* g2 = gradients[perm[ii + 1 + perm[jj + 1]] & 7];
+    g[0][0][l] = g0[0];
+    g[0][1][l] = g0[1];
+    g[1][0][l] = g1[0];
+    g[1][1][l] = g1[1];
+    g[2][0][l] = g2[0];
+    g[2][1][l] = g2[1];
+  }
+
+  const auto contribution = [&g](size_t corner, L::Float dx, L::Float dy) {
+    auto t0 = L::max(
+      L::sub(L::sub(L::splat(0.5f), L::mul(dx, dx)), L::mul(dy, dy)),
+      L::splat(0.f));
+    t0 = L::mul(t0, t0);
+    t0 = L::mul(t0, t0);
+    return L::mul(t0, L::add(L::mul(L::load(g[corner][0].data()), dx),
+                             L::mul(L::load(g[corner][1].data()), dy)));
+  };
+
+  const auto g1 = L::splat(SimplexNoise::G2);
+  const auto g2 = L::splat(2.f * SimplexNoise::G2 - 1.f);
+  const auto n0 = contribution(0, x0, y0);
+  const auto n1
+    = contribution(1, L::add(L::sub(x0, i1), g1), L::add(L::sub(y0, j1), g1));
+  const auto n2 = contribution(2, L::add(x0, g2), L::add(y0, g2));
+
+  return L::mul(L::splat(40.f), L::add(L::add(n0, n1), n2));
+}
+
+// Batched version of SimplexNoise::noise(const Vector3&)
+NoiseLanes::Float simplexNoise3D(NoiseLanes::Float x, NoiseLanes::Float y,
+                                 NoiseLanes::Float z, const Permutations& perm)
+{
+  return NoiseLanes::simplexNoise3D(
+    x, y, z, 0.6f, 32.f, true, [&perm](int i, int j, int k) {
+      return NoiseLanes::gradient3D(perm[i + perm[j + perm[k]]]);
+    });
+}
+
+// Calls function(row, xs, ys, zs) for the rows of a grid, in parallel. xs is
+// filled with the x coordinates of the row, ys and zs are scratch arrays.
+template <typename Function>
+void forEachGridRow(size_t width, size_t rowCount, float originX, float stepX,
+                    const Function& function)
+{
+  if (width == 0) {
+    return;
+  }
+
+  const size_t rowsPerBlock = std::max<size_t>(1, ParallelBlockSize / width);
+  parallelFor(rowCount, rowsPerBlock, [&](size_t begin, size_t end, size_t) {
+    Float32Array xs(width), ys(width), zs(width);
+    for (size_t i = 0; i < width; ++i) {
+      xs[i] = originX + static_cast<float>(i) * stepX;
+    }
+    for (size_t row = begin; row < end; ++row) {
+      function(row, xs, ys, zs);
+    }
+  });
+}
+
+} // end of anonymous namespace
+
+void SimplexNoise::noise(const float* x, const float* y, float* result,
+                         size_t count) const
+{
+  using L = NoiseLanes;
+  for (size_t i = 0; i < count; i += L::Width) {
+    const auto n = L::laneCount(count - i);
+    L::store(result + i,
+             simplexNoise2D(L::load(x + i, n), L::load(y + i, n), perm), n);
+  }
+}
+
+void SimplexNoise::noise(const float* x, const float* y, const float* z,
+                         float* result, size_t count) const
+{
+  using L = NoiseLanes;
+  for (size_t i = 0; i < count; i += L::Width) {
+    const auto n = L::laneCount(count - i);
+    L::store(result + i,
+             simplexNoise3D(L::load(x + i, n), L::load(y + i, n),
+                            L::load(z + i, n), perm),
+             n);
+  }
+}
+
+void SimplexNoise::fBm(const float* x, const float* y, float* result,
+                       size_t count, uint8_t octaves, float lacunarity,
+                       float gain) const
+{
+  using L = NoiseLanes;
+  for (size_t i = 0; i < count; i += L::Width) {
+    const auto n  = L::laneCount(count - i);
+    const auto px = L::load(x + i, n);
+    const auto py = L::load(y + i, n);
+
+    auto sum   = L::splat(0.f);
+    float freq = 1.0f;
+    float amp  = 0.5f;
+    for (uint8_t o = 0; o < octaves; o++) {
+      const auto f = L::splat(freq);
+      sum = L::add(sum, L::mul(simplexNoise2D(L::mul(px, f), L::mul(py, f),
+                                              perm),
+                               L::splat(amp)));
+      freq *= lacunarity;
+      amp *= gain;
+    }
+    L::store(result + i, sum, n);
+  }
+}
+
+void SimplexNoise::fBm(const float* x, const float* y, const float* z,
+                       float* result, size_t count, uint8_t octaves,
+                       float lacunarity, float gain) const
+{
+  using L = NoiseLanes;
+  for (size_t i = 0; i < count; i += L::Width) {
+    const auto n  = L::laneCount(count - i);
+    const auto px = L::load(x + i, n);
+    const auto py = L::load(y + i, n);
+    const auto pz = L::load(z + i, n);
+
+    auto sum   = L::splat(0.f);
+    float freq = 1.0f;
+    float amp  = 0.5f;
+    for (uint8_t o = 0; o < octaves; o++) {
+      const auto f = L::splat(freq);
+      sum = L::add(sum, L::mul(simplexNoise3D(L::mul(px, f), L::mul(py, f),
+                                              L::mul(pz, f), perm),
+                               L::splat(amp)));
+      freq *= lacunarity;
+      amp *= gain;
+    }
+    L::store(result + i, sum, n);
+  }
+}
+
+void SimplexNoise::fBmGrid(const Vector2& origin, const Vector2& step,
+                           size_t width, size_t height, Float32Array& result,
+                           uint8_t octaves, float lacunarity, float gain) const
+{
+  result.resize(width * height);
+  forEachGridRow(width, height, origin.x, step.x,
+                 [&](size_t row, const Float32Array& xs, Float32Array& ys,
+                     Float32Array& /*zs*/) {
+                   std::fill(ys.begin(), ys.end(),
+                             origin.y + static_cast<float>(row) * step.y);
+                   fBm(xs.data(), ys.data(), result.data() + row * width,
+                       width, octaves, lacunarity, gain);
+                 });
+}
+
+void SimplexNoise::fBmGrid(const Vector3& origin, const Vector3& step,
+                           size_t width, size_t height, size_t depth,
+                           Float32Array& result, uint8_t octaves,
+                           float lacunarity, float gain) const
+{
+  result.resize(width * height * depth);
+  forEachGridRow(
+    width, height * depth, origin.x, step.x,
+    [&](size_t row, const Float32Array& xs, Float32Array& ys,
+        Float32Array& zs) {
+      std::fill(ys.begin(), ys.end(),
+                origin.y + static_cast<float>(row % height) * step.y);
+      std::fill(zs.begin(), zs.end(),
+                origin.z + static_cast<float>(row / height) * step.z);
+      fBm(xs.data(), ys.data(), zs.data(), result.data() + row * width, width,
+          octaves, lacunarity, gain);
+    });
+}
+
+// -----------------------------------------------------------------------------
+
 void SimplexNoise::seed(uint32_t s)
 {
   std::random_device rd;
@@ -0,0 +1,23 @@
+#include <babylon/extensions/utils/parallel_for.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+static std::atomic<size_t> parallelThreadCount{0};
+
+void setParallelThreadCount(size_t threadCount)
+{
+  parallelThreadCount = threadCount;
+}
+
+size_t getParallelThreadCount()
+{
+  const size_t threadCount = parallelThreadCount;
+  if (threadCount == 0) {
+    return std::max(1u, std::thread::hardware_concurrency());
+  }
+  return threadCount;
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
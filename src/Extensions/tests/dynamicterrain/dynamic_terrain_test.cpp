@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engine/engine.h>
+#include <babylon/engine/scene.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_buffer.h>
+
+#include "../../../BabylonCpp/tests/helpers/null_canvas.h"
+
+namespace {
+
+/**
+ * @brief Terrain with a settable camera LOD correction and an optional
+ * height offset applied by the custom vertex function.
+ */
+struct TestTerrain : public BABYLON::Extensions::DynamicTerrain {
+
+  TestTerrain(BABYLON::Extensions::DynamicTerrainOptions& options,
+              BABYLON::Scene* scene)
+      : DynamicTerrain("terrain", options, scene)
+      , cameraLOD{0}
+      , heightOffset{0.f}
+  {
+  }
+
+  void updateVertex(BABYLON::Extensions::DynamicTerrainVertex& vertex,
+                    unsigned int /*i*/, unsigned /*j*/) override
+  {
+    vertex.position.y += heightOffset;
+  }
+
+  unsigned int updateCameraLOD(BABYLON::Camera* /*terrainCamera*/) override
+  {
+    return cameraLOD;
+  }
+
+  BABYLON::Float32Array positions() const
+  {
+    return mesh()->getVerticesData(BABYLON::VertexBuffer::PositionKind);
+  }
+
+  // Recomputes every vertex from the maps
+  void fullUpdate()
+  {
+    useCustomVertexFunction(useCustomVertexFunction());
+    update(true);
+  }
+
+  unsigned int cameraLOD;
+  float heightOffset;
+
+}; // end of struct TestTerrain
+
+class TestDynamicTerrain : public ::testing::Test {
+
+protected:
+  static constexpr int MapSub     = 64;
+  static constexpr int TerrainSub = 16;
+
+  void SetUp() override
+  {
+    using namespace BABYLON;
+    _canvas = std::make_unique<NullCanvas>();
+    _engine = Engine::New(_canvas.get());
+    _scene  = Scene::New(_engine.get());
+    _camera = FreeCamera::New("camera",
+                              Vector3(MapSub / 2.f, 10.f, MapSub / 2.f),
+                              _scene.get());
+    _scene->activeCamera = _camera;
+
+    Extensions::DynamicTerrainOptions options;
+    options.terrainSub = TerrainSub;
+    options.mapSubX    = MapSub;
+    options.mapSubZ    = MapSub;
+    for (int row = 0; row < MapSub; ++row) {
+      for (int col = 0; col < MapSub; ++col) {
+        options.mapData.emplace_back(static_cast<float>(col));
+        options.mapData.emplace_back(5.f * std::sin(col * 0.7f)
+                                     * std::cos(row * 1.3f));
+        options.mapData.emplace_back(static_cast<float>(row));
+      }
+    }
+    _terrain = std::make_unique<TestTerrain>(options, _scene.get());
+  }
+
+  void TearDown() override
+  {
+    _terrain.reset(nullptr);
+    _engine->dispose();
+    _scene.reset(nullptr);
+    _engine.reset(nullptr);
+    _canvas.reset(nullptr);
+  }
+
+  std::unique_ptr<BABYLON::NullCanvas> _canvas;
+  std::unique_ptr<BABYLON::Engine> _engine;
+  std::unique_ptr<BABYLON::Scene> _scene;
+  BABYLON::FreeCamera* _camera;
+  std::unique_ptr<TestTerrain> _terrain;
+
+}; // end of class TestDynamicTerrain
+
+} // end of namespace
+
+TEST_F(TestDynamicTerrain, CustomVertexFunctionChangesThePositions)
+{
+  const auto positions = _terrain->positions();
+
+  _terrain->heightOffset = 100.f;
+  _terrain->useCustomVertexFunction(true);
+  _terrain->update(true);
+
+  const auto offsetPositions = _terrain->positions();
+  ASSERT_EQ(offsetPositions.size(), positions.size());
+  for (size_t p = 0; p < positions.size(); p += 3) {
+    EXPECT_FLOAT_EQ(offsetPositions[p], positions[p]);
+    EXPECT_FLOAT_EQ(offsetPositions[p + 1], positions[p + 1] + 100.f);
+    EXPECT_FLOAT_EQ(offsetPositions[p + 2], positions[p + 2]);
+  }
+  EXPECT_GE(_terrain->mesh()->getBoundingInfo()->minimum.y, 95.f);
+}
+
+TEST_F(TestDynamicTerrain, IncrementalUpdateMatchesFullUpdate)
+{
+  // Scroll over the map on both axes, across the map border
+  for (int step = 0; step < 40; ++step) {
+    _camera->position.x += 1.5f;
+    _camera->position.z -= 2.f;
+    _terrain->update(false);
+  }
+  const auto positions = _terrain->positions();
+  const auto uvs
+    = _terrain->mesh()->getVerticesData(BABYLON::VertexBuffer::UVKind);
+
+  _terrain->fullUpdate();
+  EXPECT_EQ(_terrain->positions(), positions);
+  EXPECT_EQ(_terrain->mesh()->getVerticesData(BABYLON::VertexBuffer::UVKind),
+            uvs);
+}
+
+TEST_F(TestDynamicTerrain, GeomorphingFromThePreviousLOD)
+{
+  const unsigned int size = TerrainSub + 1;
+  const auto lod1         = _terrain->positions();
+
+  _terrain->setGeomorphFrames(4);
+  _terrain->cameraLOD = 1;
+  _terrain->update(false);
+  ASSERT_EQ(_terrain->LODValue(), 2u);
+
+  // The first frame shows the heights of LOD 1, the vertices of LOD 2 being
+  // one vertex of LOD 1 out of two
+  const auto firstFrame = _terrain->positions();
+  for (unsigned int j = 0; j <= TerrainSub / 2; ++j) {
+    for (unsigned int i = 0; i <= TerrainSub / 2; ++i) {
+      EXPECT_FLOAT_EQ(firstFrame[3 * (j * size + i) + 1],
+                      lod1[3 * (2 * j * size + 2 * i) + 1]);
+    }
+  }
+
+  // Then the heights reach the ones of LOD 2
+  for (unsigned int frame = 0; frame < 8; ++frame) {
+    _terrain->update(false);
+  }
+  const auto lastFrame = _terrain->positions();
+  EXPECT_NE(lastFrame, firstFrame);
+
+  _terrain->setGeomorphFrames(0);
+  _terrain->fullUpdate();
+  const auto lod2 = _terrain->positions();
+  ASSERT_EQ(lastFrame.size(), lod2.size());
+  for (size_t p = 0; p < lod2.size(); ++p) {
+    EXPECT_FLOAT_EQ(lastFrame[p], lod2[p]);
+  }
+}
@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+
+#define ANAX_TEST_CASE_BUILD
+
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/system_scheduler.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+#include "components.h"
+#include "systems.h"
+
+using namespace BABYLON::Extensions::ECS;
+
+// Here are the possible test cases we need to test for:
+//
+// 1. Archetype storage
+//      ✓ Components keep their values when the entity changes archetype
+//      ✓ Components of other entities keep their values when an entity
+//        leaves an archetype
+//      ✓ Entities with the same component types share an archetype
+// 2. Chunk iteration
+//      ✓ Only the activated entities are iterated
+//      ✓ Archetypes created after the first iteration are queried
+// 3. Scheduling
+//      ✓ Systems with disjoint read/write sets share a stage
+//      ✓ Systems writing the same component types are in separate stages
+//      ✓ All the systems are updated
+
+TEST(TestArchetypes, Components_keep_values_when_changing_archetype)
+{
+  World world;
+
+  auto e = world.createEntity();
+  e.addComponent<PositionComponent>().x = 1.f;
+  e.addComponent<VelocityComponent>().y = 2.f;
+  e.addComponent<PlayerComponent>().name = "player";
+
+  EXPECT_EQ(e.getComponent<PositionComponent>().x, 1.f);
+  EXPECT_EQ(e.getComponent<VelocityComponent>().y, 2.f);
+  EXPECT_EQ(e.getComponent<PlayerComponent>().name, "player");
+
+  e.removeComponent<VelocityComponent>();
+
+  EXPECT_FALSE(e.hasComponent<VelocityComponent>());
+  EXPECT_EQ(e.getComponent<PositionComponent>().x, 1.f);
+  EXPECT_EQ(e.getComponent<PlayerComponent>().name, "player");
+}
+
+TEST(TestArchetypes, Components_keep_values_when_an_entity_leaves_archetype)
+{
+  World world;
+
+  auto entities = world.createEntities(100);
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    entities[i].addComponent<PositionComponent>().x = static_cast<float>(i);
+  }
+
+  entities[10].kill();
+  entities[20].removeComponent<PositionComponent>();
+  world.refresh();
+
+  for (std::size_t i = 0; i < entities.size(); ++i) {
+    if (i != 10 && i != 20) {
+      EXPECT_EQ(entities[i].getComponent<PositionComponent>().x,
+                static_cast<float>(i));
+    }
+  }
+}
+
+TEST(TestArchetypes, Entities_with_same_components_share_an_archetype)
+{
+  World world;
+  MovementSystem system;
+  world.addSystem(system);
+
+  auto e1 = world.createEntity();
+  e1.addComponent<PositionComponent>();
+  e1.addComponent<VelocityComponent>();
+
+  auto e2 = world.createEntity();
+  e2.addComponent<VelocityComponent>();
+  e2.addComponent<PositionComponent>();
+
+  ASSERT_EQ(system.getArchetypes().size(), 1);
+  EXPECT_EQ(system.getArchetypes()[0]->getSize(), 2);
+}
+
+TEST(TestArchetypes, Only_activated_entities_are_iterated)
+{
+  World world;
+  ChunkMovementSystem system;
+  world.addSystem(system);
+
+  auto entities = world.createEntities(10000);
+  for (auto& e : entities) {
+    e.addComponent<PositionComponent>();
+    e.addComponent<VelocityComponent>().x = 1.f;
+    e.activate();
+  }
+  entities[0].deactivate();
+  world.refresh();
+
+  system.update();
+
+  EXPECT_EQ(entities[0].getComponent<PositionComponent>().x, 0.f);
+  for (std::size_t i = 1; i < entities.size(); ++i) {
+    EXPECT_EQ(entities[i].getComponent<PositionComponent>().x, 1.f);
+  }
+}
+
+TEST(TestArchetypes, New_archetypes_are_queried)
+{
+  World world;
+  GravitySystem system;
+  world.addSystem(system);
+
+  auto e1 = world.createEntity();
+  e1.addComponent<VelocityComponent>();
+  e1.activate();
+  world.refresh();
+  system.update();
+
+  auto e2 = world.createEntity();
+  e2.addComponent<VelocityComponent>();
+  e2.addComponent<PositionComponent>();
+  e2.activate();
+  world.refresh();
+  system.update();
+
+  EXPECT_EQ(system.getArchetypes().size(), 2);
+  EXPECT_EQ(e1.getComponent<VelocityComponent>().y, -2.f);
+  EXPECT_EQ(e2.getComponent<VelocityComponent>().y, -1.f);
+}
+
+TEST(TestArchetypes, Systems_with_disjoint_access_share_a_stage)
+{
+  World world;
+  ChunkMovementSystem movementSystem;
+  PlayerNameSystem playerNameSystem;
+  world.addSystem(movementSystem);
+  world.addSystem(playerNameSystem);
+
+  SystemScheduler scheduler;
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(playerNameSystem);
+
+  EXPECT_EQ(scheduler.getStageCount(), 1);
+}
+
+TEST(TestArchetypes, Systems_with_conflicting_access_are_in_separate_stages)
+{
+  World world;
+  GravitySystem gravitySystem;
+  ChunkMovementSystem movementSystem;
+  PlayerNameSystem playerNameSystem;
+  world.addSystem(gravitySystem);
+  world.addSystem(movementSystem);
+  world.addSystem(playerNameSystem);
+
+  SystemScheduler scheduler;
+  scheduler.addSystem(gravitySystem);
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(playerNameSystem);
+
+  EXPECT_EQ(scheduler.getStageCount(), 2);
+}
+
+TEST(TestArchetypes, Scheduler_updates_all_systems)
+{
+  World world;
+  GravitySystem gravitySystem;
+  ChunkMovementSystem movementSystem;
+  PlayerNameSystem playerNameSystem;
+  world.addSystem(gravitySystem);
+  world.addSystem(movementSystem);
+  world.addSystem(playerNameSystem);
+
+  auto e1 = world.createEntity();
+  e1.addComponent<PositionComponent>();
+  e1.addComponent<VelocityComponent>();
+  e1.activate();
+
+  auto e2 = world.createEntity();
+  e2.addComponent<PlayerComponent>().name = "player";
+  e2.activate();
+
+  world.refresh();
+
+  SystemScheduler scheduler;
+  scheduler.addSystem(gravitySystem);
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(playerNameSystem);
+  scheduler.update();
+
+  EXPECT_EQ(e1.getComponent<VelocityComponent>().y, -1.f);
+  EXPECT_EQ(e1.getComponent<PositionComponent>().y, -1.f);
+  EXPECT_EQ(playerNameSystem.nameLength, 6);
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#define ANAX_TEST_CASE_BUILD
+
+#include <chrono>
+#include <iostream>
+
+#include <babylon/extensions/entitycomponentsystem/detail/anax_assert.h>
+#include <babylon/extensions/entitycomponentsystem/system_scheduler.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+#include "components.h"
+#include "systems.h"
+
+using namespace BABYLON::Extensions::ECS;
+
+// The benchmarks are disabled by default, run them with:
+//   --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+
+namespace {
+
+constexpr std::size_t BenchmarkEntityCount = 1000000;
+
+template <class Function>
+double measure(Function&& function)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  function();
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void createMovingEntities(World& world)
+{
+  auto entities = world.createEntities(BenchmarkEntityCount);
+  for (auto& e : entities) {
+    e.addComponent<PositionComponent>();
+    e.addComponent<VelocityComponent>().x = 1.f;
+    e.activate();
+  }
+  world.refresh();
+}
+
+} // end of anonymous namespace
+
+TEST(TestBenchmark, DISABLED_Chunk_iteration_vs_entity_iteration)
+{
+  World world;
+  MovementSystem entitySystem;
+  ChunkMovementSystem chunkSystem;
+  world.addSystem(entitySystem);
+  world.addSystem(chunkSystem);
+  createMovingEntities(world);
+
+  const auto entityTime = measure([&]() {
+    for (auto& e : entitySystem.getEntities()) {
+      auto& position       = e.getComponent<PositionComponent>();
+      const auto& velocity = e.getComponent<VelocityComponent>();
+      position.x += velocity.x;
+      position.y += velocity.y;
+      position.z += velocity.z;
+    }
+  });
+  const auto chunkTime = measure([&]() { chunkSystem.update(); });
+
+  std::cout << BenchmarkEntityCount << " entities: entity iteration "
+            << entityTime << " ms, chunk iteration " << chunkTime << " ms"
+            << std::endl;
+
+  for (auto& e : entitySystem.getEntities()) {
+    ASSERT_EQ(e.getComponent<PositionComponent>().x, 2.f);
+  }
+}
+
+TEST(TestBenchmark, DISABLED_Scheduled_systems)
+{
+  World world;
+  GravitySystem gravitySystem;
+  ChunkMovementSystem movementSystem;
+  PlayerNameSystem playerNameSystem;
+  world.addSystem(gravitySystem);
+  world.addSystem(movementSystem);
+  world.addSystem(playerNameSystem);
+  createMovingEntities(world);
+
+  const auto sequentialTime = measure([&]() {
+    gravitySystem.update();
+    movementSystem.update();
+    playerNameSystem.update();
+  });
+
+  SystemScheduler scheduler;
+  scheduler.addSystem(gravitySystem);
+  scheduler.addSystem(movementSystem);
+  scheduler.addSystem(playerNameSystem);
+  const auto scheduledTime = measure([&]() { scheduler.update(); });
+
+  std::cout << BenchmarkEntityCount << " entities: sequential "
+            << sequentialTime << " ms, scheduled (" << scheduler.getStageCount()
+            << " stages) " << scheduledTime << " ms" << std::endl;
+
+  for (auto& e : movementSystem.getEntities()) {
+    ASSERT_EQ(e.getComponent<PositionComponent>().x, 2.f);
+    ASSERT_EQ(e.getComponent<PositionComponent>().y, -3.f);
+  }
+}
@@ -35,6 +35,57 @@ private:
   }
 };
 
+class ChunkMovementSystem
+  : public System<Requires<PositionComponent, VelocityComponent>> {
+public:
+  ChunkMovementSystem()
+  {
+    setComponentAccess<Reads<VelocityComponent>, Writes<PositionComponent>>();
+  }
+
+  void update()
+  {
+    forEach<PositionComponent, VelocityComponent>(
+      [](PositionComponent& position, const VelocityComponent& velocity) {
+        position.x += velocity.x;
+        position.y += velocity.y;
+        position.z += velocity.z;
+      });
+  }
+};
+
+class GravitySystem : public System<Requires<VelocityComponent>> {
+public:
+  GravitySystem()
+  {
+    setComponentAccess<Reads<>, Writes<VelocityComponent>>();
+  }
+
+  void update()
+  {
+    forEach<VelocityComponent>(
+      [](VelocityComponent& velocity) { velocity.y -= 1.f; });
+  }
+};
+
+class PlayerNameSystem : public System<Requires<PlayerComponent>> {
+public:
+  PlayerNameSystem() : nameLength(0)
+  {
+    setComponentAccess<Reads<PlayerComponent>, Writes<>>();
+  }
+
+  void update()
+  {
+    nameLength = 0;
+    forEach<PlayerComponent>([this](const PlayerComponent& player) {
+      nameLength += player.name.size();
+    });
+  }
+
+  std::size_t nameLength;
+};
+
 class PlayerSystem
   : public System<Requires<PlayerComponent>, Excludes<NPCComponent>> {
 private:
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <babylon/extensions/hexplanetgeneration/utils/fast_simplex_noise.h>
+
+TEST(TestFastSimplexNoise, Batched_3D_noise_matches_single_point_noise)
+{
+  using namespace BABYLON::Extensions;
+
+  // Not a multiple of the lane width, so that the partial lanes are tested
+  const std::size_t pointCount = 1001;
+
+  std::mt19937 generator(0);
+  std::uniform_real_distribution<float> distribution(-64.f, 64.f);
+  std::vector<float> x(pointCount), y(pointCount), z(pointCount);
+  for (std::size_t i = 0; i < pointCount; ++i) {
+    x[i] = distribution(generator);
+    y[i] = distribution(generator);
+    z[i] = distribution(generator);
+  }
+
+  FastSimplexNoiseOptions options;
+  options.octaves = 4;
+  options.min     = 0.f;
+  options.max     = 10.f;
+  options.random  = [&generator]() {
+    return std::uniform_real_distribution<float>(0.f, 1.f)(generator);
+  };
+  FastSimplexNoise noise(options);
+
+  std::vector<float> rawValues(pointCount), scaledValues(pointCount);
+  noise.raw3D(x.data(), y.data(), z.data(), rawValues.data(), pointCount);
+  noise.scaled3D(x.data(), y.data(), z.data(), scaledValues.data(),
+                 pointCount);
+
+  for (std::size_t i = 0; i < pointCount; ++i) {
+    EXPECT_NEAR(rawValues[i], noise.raw3D(x[i], y[i], z[i]), 1e-4f);
+    EXPECT_NEAR(scaledValues[i], noise.scaled3D(x[i], y[i], z[i]), 1e-3f);
+  }
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <babylon/extensions/hexplanetgeneration/planet.h>
+#include <babylon/extensions/hexplanetgeneration/terrain/corner.h>
+#include <babylon/extensions/hexplanetgeneration/terrain/plate.h>
+#include <babylon/extensions/hexplanetgeneration/terrain/tile.h>
+#include <babylon/extensions/hexplanetgeneration/world.h>
+#include <babylon/extensions/utils/parallel_for.h>
+
+namespace {
+
+bool BitwiseEqual(float a, float b)
+{
+  return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+bool BitwiseEqual(const BABYLON::Vector3& a, const BABYLON::Vector3& b)
+{
+  return BitwiseEqual(a.x, b.x) && BitwiseEqual(a.y, b.y)
+         && BitwiseEqual(a.z, b.z);
+}
+
+template <typename T>
+bool BitwiseEqual(const std::vector<T>& a, const std::vector<T>& b)
+{
+  return (a.size() == b.size())
+         && (a.empty()
+             || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+bool BitwiseEqual(const BABYLON::Extensions::RenderObject& a,
+                  const BABYLON::Extensions::RenderObject& b)
+{
+  return BitwiseEqual(a.positions, b.positions)
+         && BitwiseEqual(a.normals, b.normals)
+         && BitwiseEqual(a.colors, b.colors)
+         && BitwiseEqual(a.indices, b.indices);
+}
+
+std::unique_ptr<BABYLON::Extensions::Planet> GeneratePlanet(size_t threadCount)
+{
+  using namespace BABYLON::Extensions;
+
+  setParallelThreadCount(threadCount);
+  auto planet     = std::make_unique<Planet>();
+  auto planetPtr  = planet.get();
+  const auto seed = 19691231ul;
+  World world;
+  world.generatePlanet(planetPtr, seed, seed, 20, 1.f, 36, 0.7f, 1.f, 1.f);
+  setParallelThreadCount(0);
+
+  return planet;
+}
+
+} // end of namespace
+
+TEST(TestWorld, Planet_generation_does_not_depend_on_the_thread_count)
+{
+  using namespace BABYLON::Extensions;
+
+  // More tiles, corners and borders than a single parallel block
+  const auto planet1 = GeneratePlanet(1);
+  const auto planet2 = GeneratePlanet(4);
+  ASSERT_GT(planet1->topology.tiles.size(), ParallelBlockSize);
+
+  // Tiles
+  const auto& tiles1 = planet1->topology.tiles;
+  const auto& tiles2 = planet2->topology.tiles;
+  ASSERT_EQ(tiles1.size(), tiles2.size());
+  for (size_t i = 0; i < tiles1.size(); ++i) {
+    EXPECT_TRUE(BitwiseEqual(tiles1[i].position, tiles2[i].position));
+    EXPECT_TRUE(BitwiseEqual(tiles1[i].normal, tiles2[i].normal));
+    EXPECT_TRUE(BitwiseEqual(tiles1[i].area, tiles2[i].area));
+    EXPECT_TRUE(BitwiseEqual(tiles1[i].elevation, tiles2[i].elevation));
+    EXPECT_TRUE(BitwiseEqual(tiles1[i].temperature, tiles2[i].temperature));
+    EXPECT_TRUE(BitwiseEqual(tiles1[i].moisture, tiles2[i].moisture));
+    EXPECT_TRUE(
+      BitwiseEqual(tiles1[i].plateMovement, tiles2[i].plateMovement));
+    EXPECT_EQ(tiles1[i].biome, tiles2[i].biome);
+  }
+
+  // Corners
+  const auto& corners1 = planet1->topology.corners;
+  const auto& corners2 = planet2->topology.corners;
+  ASSERT_EQ(corners1.size(), corners2.size());
+  for (size_t i = 0; i < corners1.size(); ++i) {
+    EXPECT_TRUE(BitwiseEqual(corners1[i].elevation, corners2[i].elevation));
+    EXPECT_TRUE(BitwiseEqual(corners1[i].pressure, corners2[i].pressure));
+    EXPECT_TRUE(BitwiseEqual(corners1[i].shear, corners2[i].shear));
+    EXPECT_TRUE(
+      BitwiseEqual(corners1[i].temperature, corners2[i].temperature));
+    EXPECT_TRUE(BitwiseEqual(corners1[i].moisture, corners2[i].moisture));
+    EXPECT_TRUE(
+      BitwiseEqual(corners1[i].precipitation, corners2[i].precipitation));
+    EXPECT_TRUE(
+      BitwiseEqual(corners1[i].airCurrentSpeed, corners2[i].airCurrentSpeed));
+  }
+
+  // Render data
+  const auto& renderData1 = planet1->renderData;
+  const auto& renderData2 = planet2->renderData;
+  ASSERT_EQ(renderData1.surfaces.size(), renderData2.surfaces.size());
+  for (size_t i = 0; i < renderData1.surfaces.size(); ++i) {
+    EXPECT_TRUE(
+      BitwiseEqual(renderData1.surfaces[i], renderData2.surfaces[i]));
+  }
+  ASSERT_EQ(renderData1.plateMovements.size(),
+            renderData2.plateMovements.size());
+  for (size_t i = 0; i < renderData1.plateMovements.size(); ++i) {
+    EXPECT_TRUE(BitwiseEqual(renderData1.plateMovements[i],
+                             renderData2.plateMovements[i]));
+  }
+  EXPECT_TRUE(BitwiseEqual(renderData1.plateBoundaries,
+                           renderData2.plateBoundaries));
+  EXPECT_TRUE(
+    BitwiseEqual(renderData1.airCurrents, renderData2.airCurrents));
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/extensions/navigationmesh/navigation.h>
+#include <babylon/extensions/navigationmesh/navigation_node_index.h>
+
+namespace {
+
+using namespace BABYLON;
+using namespace BABYLON::Extensions;
+
+/**
+ * @brief Builds a navigation mesh made of a grid of columns x rows squares,
+ * each one split in two triangles, without the squares of the holes.
+ */
+GroupedNavigationMesh
+createGridNavigationMesh(std::size_t columns, std::size_t rows,
+                         const std::function<bool(size_t, size_t)>& isHole)
+{
+  GroupedNavigationMesh navigationMesh;
+  const auto vertexId = [columns](size_t column, size_t row) {
+    return static_cast<std::uint32_t>(row * (columns + 1) + column);
+  };
+  for (size_t row = 0; row <= rows; ++row) {
+    for (size_t column = 0; column <= columns; ++column) {
+      stl_util::concat(navigationMesh.vertices,
+                       {static_cast<float>(column), 0.f,
+                        static_cast<float>(row)});
+    }
+  }
+
+  // Triangles 2 * (row * columns + column) and 2 * (row * columns + column) + 1
+  NavigationGroupGraph graph;
+  std::vector<int> triangleIds(2 * columns * rows, -1);
+  for (size_t row = 0; row < rows; ++row) {
+    for (size_t column = 0; column < columns; ++column) {
+      if (isHole(column, row)) {
+        continue;
+      }
+      const IndicesArray triangles[2]
+        = {{vertexId(column, row), vertexId(column + 1, row),
+            vertexId(column + 1, row + 1)},
+           {vertexId(column, row), vertexId(column + 1, row + 1),
+            vertexId(column, row + 1)}};
+      for (size_t t = 0; t < 2; ++t) {
+        Vector3 centroid(0.f, 0.f, 0.f);
+        for (auto id : triangles[t]) {
+          centroid.x += navigationMesh.vertices[3 * id] / 3.f;
+          centroid.z += navigationMesh.vertices[3 * id + 2] / 3.f;
+        }
+        triangleIds[2 * (row * columns + column) + t]
+          = static_cast<int>(graph.size());
+        graph.push(
+          NavigationGroup{graph.size(), {}, triangles[t], centroid, {}, 1.f});
+      }
+    }
+  }
+
+  // Neighbours share two vertices, which are the portal between them
+  for (auto& a : graph) {
+    for (auto& b : graph) {
+      Uint32Array shared;
+      for (auto id : a.vertexIds) {
+        if (stl_util::contains(b.vertexIds, id)) {
+          shared.emplace_back(id);
+        }
+      }
+      if (a.id != b.id && shared.size() == 2) {
+        a.neighbours.emplace_back(static_cast<std::uint32_t>(b.id));
+        a.portals.emplace_back(shared);
+      }
+    }
+  }
+
+  navigationMesh.groups.emplace_back(graph);
+  return navigationMesh;
+}
+
+std::vector<Vector3> randomPositions(std::size_t count, float size,
+                                     std::mt19937& generator)
+{
+  std::uniform_real_distribution<float> distribution(-2.f, size + 2.f);
+  std::vector<Vector3> positions;
+  for (std::size_t i = 0; i < count; ++i) {
+    positions.emplace_back(
+      Vector3(distribution(generator), 0.f, distribution(generator)));
+  }
+  return positions;
+}
+
+} // end of anonymous namespace
+
+TEST(TestNavigationMesh, Closest_node_matches_linear_scan)
+{
+  const auto navigationMesh = createGridNavigationMesh(
+    40, 30, [](size_t column, size_t row) { return (column + row) % 7 == 0; });
+  const auto& nodes = navigationMesh.groups[0];
+  NavigationNodeIndex nodeIndex(nodes);
+
+  std::mt19937 generator(0);
+  auto positions = randomPositions(2000, 40.f, generator);
+  // Positions equidistant from several centroids
+  for (auto& node : nodes) {
+    positions.emplace_back(node.centroid);
+    positions.emplace_back(
+      Vector3(std::floor(node.centroid.x), 1.f, std::floor(node.centroid.z)));
+  }
+
+  for (auto& position : positions) {
+    int expectedNode      = -1;
+    float expectedDistance = std::numeric_limits<float>::infinity();
+    for (auto& node : nodes) {
+      const float distance = Vector3::DistanceSquared(node.centroid, position);
+      if (distance < expectedDistance) {
+        expectedNode     = static_cast<int>(node.id);
+        expectedDistance = distance;
+      }
+    }
+    float distance = 0.f;
+    EXPECT_EQ(nodeIndex.closestNode(position, distance), expectedNode);
+    EXPECT_EQ(distance, expectedDistance);
+  }
+}
+
+TEST(TestNavigationMesh, Batched_paths_match_single_paths)
+{
+  // Walls with a gap, so that the paths have to go around them
+  const auto navigationMesh
+    = createGridNavigationMesh(24, 24, [](size_t column, size_t row) {
+        return (row % 6 == 3 && column != (row / 6) * 5 + 2);
+      });
+  Navigation navigation, reference;
+  navigation.setZoneData("level", navigationMesh);
+  reference.setZoneData("level", navigationMesh);
+
+  std::mt19937 generator(1);
+  const auto starts  = randomPositions(300, 24.f, generator);
+  const auto targets = randomPositions(300, 24.f, generator);
+  std::vector<NavigationQuery> queries;
+  for (std::size_t i = 0; i < starts.size(); ++i) {
+    queries.emplace_back(NavigationQuery{starts[i], targets[i], 0});
+    // The same start and goal nodes, to use the cached corridors
+    queries.emplace_back(NavigationQuery{starts[i], targets[i], 0});
+  }
+
+  const auto paths = navigation.findPaths(queries, "level");
+  ASSERT_EQ(paths.size(), queries.size());
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    const auto expectedPath = reference.findPath(
+      queries[i].startPosition, queries[i].targetPosition, "level", 0);
+    ASSERT_FALSE(expectedPath.empty());
+    ASSERT_EQ(paths[i].size(), expectedPath.size());
+    for (std::size_t p = 0; p < expectedPath.size(); ++p) {
+      EXPECT_TRUE(paths[i][p] == expectedPath[p]);
+    }
+  }
+
+  EXPECT_TRUE(navigation.findPaths(queries, "unknown")[0].empty());
+  EXPECT_EQ(navigation.getGroup("level", Vector3(5.f, 0.f, 5.f)), 0);
+}
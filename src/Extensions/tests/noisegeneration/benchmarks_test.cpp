@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+
+#include <babylon/extensions/noisegeneration/noise_lanes.h>
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/math/vector3.h>
+
+// The benchmarks are disabled by default, run them with:
+//   --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+
+namespace {
+
+constexpr std::size_t GridSize = 256;
+
+template <class Function>
+double measure(Function&& function)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  function();
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // end of anonymous namespace
+
+TEST(TestNoiseBenchmark, DISABLED_Simplex_fBm_grid)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  SimplexNoise simplexNoise;
+  const Vector3 origin(0.f, 0.f, 0.f), step(0.05f, 0.05f, 0.05f);
+  const std::size_t count = GridSize * GridSize * GridSize / 16;
+  const std::size_t depth = GridSize / 16;
+  const uint8_t octaves   = 4;
+
+  Float32Array scalar(count);
+  const auto scalarTime = measure([&]() {
+    for (std::size_t k = 0; k < depth; ++k) {
+      for (std::size_t j = 0; j < GridSize; ++j) {
+        for (std::size_t i = 0; i < GridSize; ++i) {
+          scalar[(k * GridSize + j) * GridSize + i] = simplexNoise.fBm(
+            Vector3(origin.x + static_cast<float>(i) * step.x,
+                    origin.y + static_cast<float>(j) * step.y,
+                    origin.z + static_cast<float>(k) * step.z),
+            octaves);
+        }
+      }
+    }
+  });
+
+  Float32Array batched;
+  const auto batchedTime = measure([&]() {
+    simplexNoise.fBmGrid(origin, step, GridSize, GridSize, depth, batched,
+                         octaves);
+  });
+
+  std::cout << count << " points, " << NoiseLanes::Width
+            << " lanes: scalar fBm " << scalarTime << " ms ("
+            << count / scalarTime / 1000.0 << " Mpoints/s), batched grid "
+            << batchedTime << " ms (" << count / batchedTime / 1000.0
+            << " Mpoints/s)" << std::endl;
+
+  ASSERT_EQ(batched.size(), scalar.size());
+  for (std::size_t i = 0; i < count; ++i) {
+    ASSERT_NEAR(batched[i], scalar[i], 1e-4f);
+  }
+}
+
+TEST(TestNoiseBenchmark, DISABLED_Perlin_noise_span)
+{
+  using namespace BABYLON::Extensions;
+
+  PerlinNoise perlinNoise;
+  const std::size_t count = GridSize * GridSize * 16;
+  std::vector<double> x(count), y(count), z(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    x[i] = static_cast<double>(i % GridSize) * 0.05;
+    y[i] = static_cast<double>(i / GridSize % GridSize) * 0.05;
+    z[i] = static_cast<double>(i / (GridSize * GridSize)) * 0.05;
+  }
+
+  std::vector<double> scalar(count), batched(count);
+  const auto scalarTime = measure([&]() {
+    for (std::size_t i = 0; i < count; ++i) {
+      scalar[i] = perlinNoise.noise(x[i], y[i], z[i]);
+    }
+  });
+  const auto batchedTime = measure([&]() {
+    perlinNoise.noise(x.data(), y.data(), z.data(), batched.data(), count);
+  });
+
+  std::cout << count << " points, " << NoiseLanes::Width
+            << " lanes: scalar " << scalarTime << " ms, batched "
+            << batchedTime << " ms" << std::endl;
+
+  for (std::size_t i = 0; i < count; ++i) {
+    ASSERT_NEAR(batched[i], scalar[i], 1e-4);
+  }
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/math/vector2.h>
+#include <babylon/math/vector3.h>
+
+namespace {
+
+// Not a multiple of the lane width, so that the partial lanes are tested
+constexpr std::size_t PointCount = 1001;
+
+constexpr float Tolerance = 1e-4f;
+
+// Points in [-64, 64[, including integer coordinates
+std::vector<float> randomCoordinates(std::mt19937& generator)
+{
+  std::uniform_real_distribution<float> distribution(-64.f, 64.f);
+  std::vector<float> coordinates(PointCount);
+  for (auto& coordinate : coordinates) {
+    coordinate = distribution(generator);
+  }
+  for (std::size_t i = 0; i < PointCount; i += 10) {
+    coordinates[i] = std::floor(coordinates[i]);
+  }
+  return coordinates;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSimplexNoise, Batched_2D_noise_matches_single_point_noise)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  std::mt19937 generator(0);
+  const auto x = randomCoordinates(generator);
+  const auto y = randomCoordinates(generator);
+
+  SimplexNoise simplexNoise;
+  std::vector<float> values(PointCount), fBmValues(PointCount);
+  simplexNoise.noise(x.data(), y.data(), values.data(), PointCount);
+  simplexNoise.fBm(x.data(), y.data(), fBmValues.data(), PointCount, 5);
+
+  for (std::size_t i = 0; i < PointCount; ++i) {
+    EXPECT_NEAR(values[i], simplexNoise.noise(Vector2(x[i], y[i])), Tolerance);
+    EXPECT_NEAR(fBmValues[i], simplexNoise.fBm(Vector2(x[i], y[i]), 5),
+                Tolerance);
+  }
+}
+
+TEST(TestSimplexNoise, Batched_3D_noise_matches_single_point_noise)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  std::mt19937 generator(1);
+  const auto x = randomCoordinates(generator);
+  const auto y = randomCoordinates(generator);
+  const auto z = randomCoordinates(generator);
+
+  SimplexNoise simplexNoise;
+  std::vector<float> values(PointCount), fBmValues(PointCount);
+  simplexNoise.noise(x.data(), y.data(), z.data(), values.data(), PointCount);
+  simplexNoise.fBm(x.data(), y.data(), z.data(), fBmValues.data(), PointCount,
+                   5);
+
+  for (std::size_t i = 0; i < PointCount; ++i) {
+    const Vector3 point(x[i], y[i], z[i]);
+    EXPECT_NEAR(values[i], simplexNoise.noise(point), Tolerance);
+    EXPECT_NEAR(fBmValues[i], simplexNoise.fBm(point, 5), Tolerance);
+  }
+}
+
+TEST(TestSimplexNoise, Grid_matches_single_point_fBm)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  // The steps are powers of two, so that the lattice coordinates are rounded
+  // the same way whether or not multiply-adds are fused, and the coordinate
+  // differences are never integers, as the noise is discontinuous where two
+  // offsets from the cell origin are equal
+  SimplexNoise simplexNoise;
+  const std::size_t width = 37, height = 23, depth = 5;
+
+  Float32Array grid2D;
+  const Vector2 origin2D(-3.37f, 1.29f), step2D(0.125f, 0.25f);
+  simplexNoise.fBmGrid(origin2D, step2D, width, height, grid2D);
+  ASSERT_EQ(grid2D.size(), width * height);
+  for (std::size_t j = 0; j < height; ++j) {
+    for (std::size_t i = 0; i < width; ++i) {
+      const Vector2 point(origin2D.x + static_cast<float>(i) * step2D.x,
+                          origin2D.y + static_cast<float>(j) * step2D.y);
+      EXPECT_NEAR(grid2D[j * width + i], simplexNoise.fBm(point), Tolerance);
+    }
+  }
+
+  Float32Array grid3D;
+  const Vector3 origin3D(-3.37f, 1.29f, 7.113f), step3D(0.125f, 0.25f, 0.5f);
+  simplexNoise.fBmGrid(origin3D, step3D, width, height, depth, grid3D);
+  ASSERT_EQ(grid3D.size(), width * height * depth);
+  for (std::size_t k = 0; k < depth; ++k) {
+    for (std::size_t j = 0; j < height; ++j) {
+      for (std::size_t i = 0; i < width; ++i) {
+        const Vector3 point(origin3D.x + static_cast<float>(i) * step3D.x,
+                            origin3D.y + static_cast<float>(j) * step3D.y,
+                            origin3D.z + static_cast<float>(k) * step3D.z);
+        EXPECT_NEAR(grid3D[(k * height + j) * width + i],
+                    simplexNoise.fBm(point), Tolerance);
+      }
+    }
+  }
+}
+
+TEST(TestPerlinNoise, Batched_noise_matches_single_point_noise)
+{
+  using namespace BABYLON::Extensions;
+
+  std::mt19937 generator(2);
+  const auto xf = randomCoordinates(generator);
+  const auto yf = randomCoordinates(generator);
+  const auto zf = randomCoordinates(generator);
+  const std::vector<double> x(xf.begin(), xf.end());
+  const std::vector<double> y(yf.begin(), yf.end());
+  const std::vector<double> z(zf.begin(), zf.end());
+
+  PerlinNoise perlinNoise;
+  PerlinNoiseOctave perlinNoiseOctave(6, 1234);
+  std::vector<double> values(PointCount), octaveValues(PointCount);
+  perlinNoise.noise(x.data(), y.data(), z.data(), values.data(), PointCount);
+  perlinNoiseOctave.noise(x.data(), y.data(), z.data(), octaveValues.data(),
+                          PointCount);
+
+  for (std::size_t i = 0; i < PointCount; ++i) {
+    EXPECT_NEAR(values[i], perlinNoise.noise(x[i], y[i], z[i]), Tolerance);
+    EXPECT_NEAR(octaveValues[i], perlinNoiseOctave.noise(x[i], y[i], z[i]),
+                Tolerance);
+  }
+}
@@ -0,0 +1,125 @@
+#ifndef BABYLON_LOADING_PLUGINS_GLTF_GLTF2_ACCESSOR_VIEW_H
+#define BABYLON_LOADING_PLUGINS_GLTF_GLTF2_ACCESSOR_VIEW_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader_enums.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Maps a C++ type to the glTF component type it reads.
+ */
+template <typename T>
+struct GLTF2ComponentType;
+
+template <>
+struct GLTF2ComponentType<int8_t> {
+  static constexpr EComponentType value = EComponentType::BYTE;
+};
+
+template <>
+struct GLTF2ComponentType<uint8_t> {
+  static constexpr EComponentType value = EComponentType::UNSIGNED_BYTE;
+};
+
+template <>
+struct GLTF2ComponentType<int16_t> {
+  static constexpr EComponentType value = EComponentType::SHORT;
+};
+
+template <>
+struct GLTF2ComponentType<uint16_t> {
+  static constexpr EComponentType value = EComponentType::UNSIGNED_SHORT;
+};
+
+template <>
+struct GLTF2ComponentType<uint32_t> {
+  static constexpr EComponentType value = EComponentType::UNSIGNED_INT;
+};
+
+template <>
+struct GLTF2ComponentType<float> {
+  static constexpr EComponentType value = EComponentType::FLOAT;
+};
+
+/**
+ * @brief Typed, strided and read-only view of the elements of an accessor,
+ * pointing directly into the (memory-mapped) buffer data.
+ */
+template <typename T>
+class GLTF2AccessorView {
+
+public:
+  GLTF2AccessorView()
+      : _data{nullptr}, _count{0}, _components{0}, _byteStride{0}
+  {
+  }
+
+  GLTF2AccessorView(const uint8_t* data, size_t count, size_t components,
+                    size_t byteStride)
+      : _data{data}
+      , _count{count}
+      , _components{components}
+      , _byteStride{byteStride}
+  {
+  }
+
+  bool empty() const
+  {
+    return _data == nullptr;
+  }
+
+  /**
+   * @brief Returns the number of elements.
+   */
+  size_t size() const
+  {
+    return _count;
+  }
+
+  /**
+   * @brief Returns the number of components per element.
+   */
+  size_t components() const
+  {
+    return _components;
+  }
+
+  size_t byteStride() const
+  {
+    return _byteStride;
+  }
+
+  /**
+   * @brief Returns whether the elements are tightly packed, in which case the
+   * view can be used as a plain array of size() * components() values.
+   */
+  bool isContiguous() const
+  {
+    return _byteStride == _components * sizeof(T);
+  }
+
+  /**
+   * @brief Returns the components of the element at the given index.
+   */
+  const T* operator[](size_t index) const
+  {
+    return reinterpret_cast<const T*>(_data + index * _byteStride);
+  }
+
+  T at(size_t index, size_t component) const
+  {
+    return (*this)[index][component];
+  }
+
+private:
+  const uint8_t* _data;
+  size_t _count;
+  size_t _components;
+  size_t _byteStride;
+
+}; // end of class GLTF2AccessorView
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_GLTF_GLTF2_ACCESSOR_VIEW_H
@@ -0,0 +1,154 @@
+#ifndef BABYLON_LOADING_PLUGINS_GLTF_GLTF2_ASSET_H
+#define BABYLON_LOADING_PLUGINS_GLTF_GLTF2_ASSET_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/loading/plugins/gltf/gltf2_accessor_view.h>
+#include <babylon/loading/plugins/gltf/gltf2_interfaces.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Parsed glTF 2.0 asset (.gltf or binary .glb).
+ *
+ * The buffers are not copied: the GLB binary chunk and the external .bin files
+ * are memory-mapped, only the base64 data uris are decoded into memory.
+ * Accessors can then be read through typed strided views into the buffers, or
+ * converted to float / index arrays, which applies the normalization and the
+ * sparse substitutions.
+ */
+class BABYLON_SHARED_EXPORT GLTF2Asset {
+
+public:
+  static constexpr uint32_t GLBMagic       = 0x46546C67; // "glTF"
+  static constexpr uint32_t GLBChunkJSON   = 0x4E4F534A; // "JSON"
+  static constexpr uint32_t GLBChunkBinary = 0x004E4942; // "BIN\0"
+
+public:
+  /**
+   * @brief Loads a .gltf or .glb file, the external buffers are resolved
+   * relatively to the directory of the file.
+   * @return The asset or nullptr on error
+   */
+  static std::unique_ptr<GLTF2Asset> LoadFromFile(const std::string& filename);
+
+  /**
+   * @brief Parses a .gltf or .glb file content. The data is not copied and
+   * must outlive the asset.
+   * @return The asset or nullptr on error
+   */
+  static std::unique_ptr<GLTF2Asset> LoadFromMemory(const uint8_t* data,
+                                                    size_t size,
+                                                    const std::string& rootUrl);
+
+  ~GLTF2Asset();
+
+  /**
+   * @brief Returns whether the data starts with the GLB header magic.
+   */
+  static bool IsBinary(const uint8_t* data, size_t size);
+
+  /**
+   * @brief Returns the number of components of the accessor type.
+   */
+  static size_t ComponentCount(EAccessorType type);
+
+  /**
+   * @brief Returns the size in bytes of the component type.
+   */
+  static size_t ComponentSize(EComponentType componentType);
+
+  /**
+   * @brief Returns the data of the buffer view.
+   */
+  const uint8_t* bufferViewData(int bufferView) const;
+
+  /**
+   * @brief Returns the stride in bytes between two elements of the accessor.
+   */
+  size_t byteStride(const IGLTF2Accessor& accessor) const;
+
+  /**
+   * @brief Returns a view into the buffer data of the accessor, or an empty
+   * view when the component type is not T or when the values have to be
+   * computed (sparse or normalized accessor).
+   */
+  template <typename T>
+  GLTF2AccessorView<T> view(const IGLTF2Accessor& accessor) const
+  {
+    if (accessor.componentType != GLTF2ComponentType<T>::value
+        || accessor.isSparse || accessor.bufferView < 0
+        || (accessor.normalized && std::is_floating_point<T>::value)) {
+      return GLTF2AccessorView<T>();
+    }
+    const uint8_t* data = bufferViewData(accessor.bufferView);
+    if (data == nullptr) {
+      return GLTF2AccessorView<T>();
+    }
+    data += accessor.byteOffset;
+    const size_t stride = byteStride(accessor);
+    if (reinterpret_cast<uintptr_t>(data) % alignof(T) != 0
+        || stride % alignof(T) != 0) {
+      return GLTF2AccessorView<T>();
+    }
+    return GLTF2AccessorView<T>(data, accessor.count,
+                                ComponentCount(accessor.type), stride);
+  }
+
+  /**
+   * @brief Reads the values of the accessor as floats, applying the
+   * normalization and the sparse substitutions.
+   * @return Whether the accessor could be read
+   */
+  bool readFloats(const IGLTF2Accessor& accessor, Float32Array& values) const;
+
+  /**
+   * @brief Reads the values of a scalar integer accessor.
+   * @return Whether the accessor could be read
+   */
+  bool readIndices(const IGLTF2Accessor& accessor, Uint32Array& values) const;
+
+  /**
+   * @brief Returns the number of bytes mapped from files.
+   */
+  size_t mappedByteLength() const;
+
+  /**
+   * @brief Returns the number of bytes decoded into memory (data uris, and
+   * files which could not be mapped).
+   */
+  size_t allocatedByteLength() const;
+
+private:
+  GLTF2Asset();
+
+  bool _parseGLB(const uint8_t* data, size_t size);
+  bool _parseJSON(const char* begin, const char* end);
+  bool _loadBuffers(const uint8_t* binaryChunk, size_t binaryChunkLength);
+  bool _validate() const;
+  bool _readComponents(EComponentType componentType, bool normalized,
+                       const uint8_t* data, size_t stride, size_t count,
+                       size_t components, float* values) const;
+
+public:
+  int scene = -1;
+  std::vector<IGLTF2Buffer> buffers;
+  std::vector<IGLTF2BufferView> bufferViews;
+  std::vector<IGLTF2Accessor> accessors;
+  std::vector<IGLTF2Mesh> meshes;
+  std::vector<IGLTF2Node> nodes;
+  std::vector<IGLTF2Skin> skins;
+  std::vector<IGLTF2Scene> scenes;
+
+private:
+  std::string _rootUrl;
+  std::vector<std::unique_ptr<MemoryMappedFile>> _mappedFiles;
+  std::vector<std::string> _decodedBuffers;
+  // Data of each buffer, pointing into a mapped file, a decoded buffer or the
+  // GLB binary chunk
+  std::vector<const uint8_t*> _bufferData;
+
+}; // end of class GLTF2Asset
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_GLTF_GLTF2_ASSET_H
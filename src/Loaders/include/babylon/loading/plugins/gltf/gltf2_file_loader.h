@@ -0,0 +1,106 @@
+#ifndef BABYLON_LOADING_PLUGINS_GLTF_GLTF2_FILE_LOADER_H
+#define BABYLON_LOADING_PLUGINS_GLTF_GLTF2_FILE_LOADER_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/loading/iscene_loader_plugin_async.h>
+#include <babylon/math/matrix.h>
+
+namespace BABYLON {
+
+class GLTF2Asset;
+struct IGLTF2MeshPrimitive;
+
+/**
+ * @brief Bones of a glTF 2.0 skin, computed from the inverse bind matrices.
+ */
+struct BABYLON_SHARED_EXPORT GLTF2SkinData {
+  // Joints (indices in the skin joints) in bone creation order, parents first
+  std::vector<size_t> boneOrder;
+  // Parent joint of each joint, -1 for the roots
+  std::vector<int> parentJoints;
+  // Bone matrix (bind pose relative to the parent bone) of each joint
+  std::vector<Matrix> boneMatrices;
+}; // end of struct GLTF2SkinData
+
+/**
+ * @brief glTF 2.0 File Loader Plugin, for .gltf and binary .glb files.
+ *
+ * The vertex data of all the mesh primitives and the bones of all the skins
+ * are built concurrently, straight from the asset buffers; the scene objects
+ * are then created on the calling thread.
+ */
+class BABYLON_SHARED_EXPORT GLTF2FileLoader : public ISceneLoaderPluginAsync {
+
+public:
+  GLTF2FileLoader();
+  virtual ~GLTF2FileLoader();
+
+  /**
+   * Import meshes, data is the content of a .gltf or .glb file
+   */
+  bool importMeshAsync(
+    const std::vector<std::string>& meshesNames, Scene* scene,
+    const std::string& data, const std::string& rootUrl,
+    const std::function<void(std::vector<AbstractMesh*>& meshes,
+                             std::vector<ParticleSystem*>& particleSystems,
+                             std::vector<Skeleton*>& skeletons)>& onSuccess,
+    const std::function<void()>& onError) override;
+  bool loadAsync(Scene* scene, const std::string& data,
+                 const std::string& rootUrl,
+                 const std::function<void()>& onsuccess,
+                 const std::function<void()>& onerror) override;
+
+  /**
+   * @brief Imports the meshes of a .gltf or .glb file, the binary data is
+   * memory-mapped instead of being read.
+   * @param meshesNames Names of the nodes or meshes to import, all when empty
+   * @return Whether the file could be loaded
+   */
+  bool importMeshesFromFile(const std::string& filename, Scene* scene,
+                            const std::vector<std::string>& meshesNames,
+                            std::vector<AbstractMesh*>& meshes,
+                            std::vector<Skeleton*>& skeletons) const;
+
+  /**
+   * @brief Creates the nodes, meshes and skeletons of the default scene of
+   * the asset.
+   */
+  void importAsset(const GLTF2Asset& asset, Scene* scene,
+                   const std::vector<std::string>& meshesNames,
+                   std::vector<AbstractMesh*>& meshes,
+                   std::vector<Skeleton*>& skeletons) const;
+
+  /**
+   * @brief Builds, in parallel, the vertex data of each primitive of each mesh
+   * of the asset, nullptr for the primitives which can not be rendered as
+   * triangles.
+   */
+  static std::vector<std::vector<std::unique_ptr<VertexData>>>
+  BuildVertexData(const GLTF2Asset& asset);
+
+  /**
+   * @brief Builds the vertex data of a primitive.
+   */
+  static std::unique_ptr<VertexData>
+  BuildVertexData(const GLTF2Asset& asset,
+                  const IGLTF2MeshPrimitive& primitive);
+
+  /**
+   * @brief Builds, in parallel, the bones of each skin of the asset.
+   */
+  static std::vector<GLTF2SkinData> BuildSkins(const GLTF2Asset& asset);
+
+private:
+  Mesh* _importNode(const GLTF2Asset& asset, size_t index, Mesh* parent,
+                    Scene* scene, const std::vector<std::string>& meshesNames,
+                    std::vector<std::vector<std::unique_ptr<VertexData>>>&
+                      vertexData,
+                    const std::vector<Skeleton*>& babylonSkeletons,
+                    const std::vector<GLTF2SkinData>& skinData,
+                    std::vector<AbstractMesh*>& meshes) const;
+
+}; // end of class GLTF2FileLoader
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_GLTF_GLTF2_FILE_LOADER_H
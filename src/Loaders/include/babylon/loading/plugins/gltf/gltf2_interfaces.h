@@ -0,0 +1,96 @@
+#ifndef BABYLON_LOADING_PLUGINS_GLTF_GLTF2_INTERFACES_H
+#define BABYLON_LOADING_PLUGINS_GLTF_GLTF2_INTERFACES_H
+
+#include <babylon/babylon_global.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader_enums.h>
+
+namespace BABYLON {
+
+/**
+ * glTF 2.0 interfaces, the references between the objects are indices in the
+ * arrays of the asset (-1 when not set).
+ */
+struct IGLTF2Buffer {
+  std::string name;
+  std::string uri;
+  size_t byteLength = 0;
+};
+
+struct IGLTF2BufferView {
+  std::string name;
+  int buffer        = -1;
+  size_t byteOffset = 0;
+  size_t byteLength = 0;
+  // 0 when the elements are tightly packed
+  size_t byteStride   = 0;
+  unsigned int target = 0;
+};
+
+struct IGLTF2AccessorSparse {
+  size_t count = 0;
+  int indicesBufferView;
+  size_t indicesByteOffset = 0;
+  EComponentType indicesComponentType;
+  int valuesBufferView;
+  size_t valuesByteOffset = 0;
+};
+
+struct IGLTF2Accessor {
+  std::string name;
+  // -1 when the accessor is sparse only, the base values are then zeros
+  int bufferView    = -1;
+  size_t byteOffset = 0;
+  EComponentType componentType;
+  bool normalized = false;
+  size_t count    = 0;
+  EAccessorType type;
+  Float32Array max;
+  Float32Array min;
+  bool isSparse = false;
+  IGLTF2AccessorSparse sparse;
+};
+
+using IGLTF2Attributes = std::map<std::string, int>;
+
+struct IGLTF2MeshPrimitive {
+  IGLTF2Attributes attributes;
+  int indices             = -1;
+  int material            = -1;
+  EMeshPrimitiveMode mode = EMeshPrimitiveMode::TRIANGLES;
+  std::vector<IGLTF2Attributes> targets;
+};
+
+struct IGLTF2Mesh {
+  std::string name;
+  std::vector<IGLTF2MeshPrimitive> primitives;
+  Float32Array weights;
+};
+
+struct IGLTF2Node {
+  std::string name;
+  int parent = -1;
+  std::vector<int> children;
+  int mesh = -1;
+  int skin = -1;
+  // Either a column-major matrix or the translation, rotation and scale
+  Float32Array matrix;
+  Float32Array translation;
+  Float32Array rotation;
+  Float32Array scale;
+};
+
+struct IGLTF2Skin {
+  std::string name;
+  int inverseBindMatrices = -1;
+  int skeleton            = -1;
+  std::vector<int> joints;
+};
+
+struct IGLTF2Scene {
+  std::string name;
+  std::vector<int> nodes;
+};
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_PLUGINS_GLTF_GLTF2_INTERFACES_H
@@ -11,9 +11,22 @@ enum class EComponentType {
   UNSIGNED_BYTE  = 5121,
   SHORT          = 5122,
   UNSIGNED_SHORT = 5123,
+  UNSIGNED_INT   = 5125,
   FLOAT          = 5126
 };
 
+enum class EAccessorType { SCALAR, VEC2, VEC3, VEC4, MAT2, MAT3, MAT4 };
+
+enum class EMeshPrimitiveMode {
+  POINTS         = 0,
+  LINES          = 1,
+  LINE_LOOP      = 2,
+  LINE_STRIP     = 3,
+  TRIANGLES      = 4,
+  TRIANGLE_STRIP = 5,
+  TRIANGLE_FAN   = 6
+};
+
 enum class EShaderType { FRAGMENT = 35632, VERTEX = 35633 };
 
 enum class EParameterType {
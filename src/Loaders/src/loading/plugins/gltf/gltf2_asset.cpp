@@ -0,0 +1,788 @@
+#include <babylon/loading/plugins/gltf/gltf2_asset.h>
+
+#include <cstring>
+#include <limits>
+
+#include <babylon/core/json.h>
+#include <babylon/core/logging.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/core/string.h>
+#include <babylon/utils/base64.h>
+
+namespace BABYLON {
+
+namespace {
+
+uint32_t readUint32(const uint8_t* data)
+{
+  return static_cast<uint32_t>(data[0])
+         | (static_cast<uint32_t>(data[1]) << 8)
+         | (static_cast<uint32_t>(data[2]) << 16)
+         | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+template <typename T>
+void readComponents(const uint8_t* data, size_t stride, size_t count,
+                    size_t components, bool normalized, float* values)
+{
+  const float scale
+    = normalized ? 1.f / static_cast<float>(std::numeric_limits<T>::max()) :
+                   1.f;
+  for (size_t i = 0; i < count; ++i) {
+    const uint8_t* element = data + i * stride;
+    for (size_t c = 0; c < components; ++c) {
+      T component;
+      std::memcpy(&component, element + c * sizeof(T), sizeof(T));
+      float value = static_cast<float>(component);
+      if (normalized) {
+        // Signed values are clamped as -max - 1 maps below -1
+        value = std::max(value * scale, -1.f);
+      }
+      *values++ = value;
+    }
+  }
+}
+
+template <typename T>
+void readIndexComponents(const uint8_t* data, size_t stride, size_t count,
+                         uint32_t* values)
+{
+  for (size_t i = 0; i < count; ++i) {
+    T index;
+    std::memcpy(&index, data + i * stride, sizeof(T));
+    values[i] = static_cast<uint32_t>(index);
+  }
+}
+
+bool readIndexComponents(EComponentType componentType, const uint8_t* data,
+                         size_t stride, size_t count, uint32_t* values)
+{
+  switch (componentType) {
+    case EComponentType::UNSIGNED_BYTE:
+      readIndexComponents<uint8_t>(data, stride, count, values);
+      return true;
+    case EComponentType::UNSIGNED_SHORT:
+      readIndexComponents<uint16_t>(data, stride, count, values);
+      return true;
+    case EComponentType::UNSIGNED_INT:
+      readIndexComponents<uint32_t>(data, stride, count, values);
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool parseAccessorType(const std::string& type, EAccessorType& accessorType)
+{
+  static const std::unordered_map<std::string, EAccessorType> accessorTypes{
+    {"SCALAR", EAccessorType::SCALAR}, {"VEC2", EAccessorType::VEC2},
+    {"VEC3", EAccessorType::VEC3},     {"VEC4", EAccessorType::VEC4},
+    {"MAT2", EAccessorType::MAT2},     {"MAT3", EAccessorType::MAT3},
+    {"MAT4", EAccessorType::MAT4}};
+  auto it = accessorTypes.find(type);
+  if (it == accessorTypes.end()) {
+    return false;
+  }
+  accessorType = it->second;
+  return true;
+}
+
+IGLTF2Attributes parseAttributes(const Json::value& parsedAttributes)
+{
+  IGLTF2Attributes attributes;
+  if (parsedAttributes.is<Json::object>()) {
+    for (auto& item : parsedAttributes.get<Json::object>()) {
+      attributes[item.first] = static_cast<int>(item.second.get<double>());
+    }
+  }
+  return attributes;
+}
+
+std::vector<int> toIndexArray(const Json::value& v, const std::string& key)
+{
+  return Json::ToArray<int>(v, key);
+}
+
+bool inRange(int index, size_t size)
+{
+  return index >= 0 && static_cast<size_t>(index) < size;
+}
+
+} // end of anonymous namespace
+
+constexpr uint32_t GLTF2Asset::GLBMagic;
+constexpr uint32_t GLTF2Asset::GLBChunkJSON;
+constexpr uint32_t GLTF2Asset::GLBChunkBinary;
+
+GLTF2Asset::GLTF2Asset()
+{
+}
+
+GLTF2Asset::~GLTF2Asset()
+{
+}
+
+std::unique_ptr<GLTF2Asset>
+GLTF2Asset::LoadFromFile(const std::string& filename)
+{
+  auto file = MemoryMappedFile::Open(filename);
+  if (!file) {
+    BABYLON_LOGF_ERROR("GLTF2Asset", "Could not open file %s",
+                       filename.c_str());
+    return nullptr;
+  }
+
+  const size_t separator = filename.find_last_of("/\\");
+  const std::string rootUrl
+    = (separator == std::string::npos) ? "" :
+                                         filename.substr(0, separator + 1);
+
+  const uint8_t* data = file->data();
+  const size_t size   = file->size();
+  std::unique_ptr<GLTF2Asset> asset(new GLTF2Asset());
+  asset->_mappedFiles.emplace_back(std::move(file));
+  asset->_rootUrl = rootUrl;
+  const bool loaded
+    = IsBinary(data, size) ?
+        asset->_parseGLB(data, size) :
+        asset->_parseJSON(reinterpret_cast<const char*>(data),
+                          reinterpret_cast<const char*>(data) + size)
+          && asset->_loadBuffers(nullptr, 0);
+  if (!loaded || !asset->_validate()) {
+    return nullptr;
+  }
+  return asset;
+}
+
+std::unique_ptr<GLTF2Asset>
+GLTF2Asset::LoadFromMemory(const uint8_t* data, size_t size,
+                           const std::string& rootUrl)
+{
+  std::unique_ptr<GLTF2Asset> asset(new GLTF2Asset());
+  asset->_rootUrl = rootUrl;
+  const bool loaded
+    = IsBinary(data, size) ?
+        asset->_parseGLB(data, size) :
+        asset->_parseJSON(reinterpret_cast<const char*>(data),
+                          reinterpret_cast<const char*>(data) + size)
+          && asset->_loadBuffers(nullptr, 0);
+  if (!loaded || !asset->_validate()) {
+    return nullptr;
+  }
+  return asset;
+}
+
+bool GLTF2Asset::IsBinary(const uint8_t* data, size_t size)
+{
+  return size >= 4 && readUint32(data) == GLBMagic;
+}
+
+size_t GLTF2Asset::ComponentCount(EAccessorType type)
+{
+  switch (type) {
+    case EAccessorType::SCALAR:
+      return 1;
+    case EAccessorType::VEC2:
+      return 2;
+    case EAccessorType::VEC3:
+      return 3;
+    case EAccessorType::VEC4:
+    case EAccessorType::MAT2:
+      return 4;
+    case EAccessorType::MAT3:
+      return 9;
+    case EAccessorType::MAT4:
+      return 16;
+  }
+  return 0;
+}
+
+size_t GLTF2Asset::ComponentSize(EComponentType componentType)
+{
+  switch (componentType) {
+    case EComponentType::BYTE:
+    case EComponentType::UNSIGNED_BYTE:
+      return 1;
+    case EComponentType::SHORT:
+    case EComponentType::UNSIGNED_SHORT:
+      return 2;
+    case EComponentType::UNSIGNED_INT:
+    case EComponentType::FLOAT:
+      return 4;
+  }
+  return 0;
+}
+
+const uint8_t* GLTF2Asset::bufferViewData(int bufferView) const
+{
+  if (!inRange(bufferView, bufferViews.size())) {
+    return nullptr;
+  }
+  const auto& view = bufferViews[static_cast<size_t>(bufferView)];
+  if (!inRange(view.buffer, _bufferData.size())) {
+    return nullptr;
+  }
+  return _bufferData[static_cast<size_t>(view.buffer)] + view.byteOffset;
+}
+
+size_t GLTF2Asset::byteStride(const IGLTF2Accessor& accessor) const
+{
+  if (inRange(accessor.bufferView, bufferViews.size())) {
+    const auto& view = bufferViews[static_cast<size_t>(accessor.bufferView)];
+    if (view.byteStride > 0) {
+      return view.byteStride;
+    }
+  }
+  return ComponentCount(accessor.type) * ComponentSize(accessor.componentType);
+}
+
+bool GLTF2Asset::readFloats(const IGLTF2Accessor& accessor,
+                            Float32Array& values) const
+{
+  const size_t components = ComponentCount(accessor.type);
+  const size_t valueCount = accessor.count * components;
+
+  const auto floatView = view<float>(accessor);
+  if (!floatView.empty() && floatView.isContiguous()) {
+    // Single copy straight from the mapped buffer
+    values.assign(floatView[0], floatView[0] + valueCount);
+    return true;
+  }
+
+  values.assign(valueCount, 0.f);
+  if (accessor.bufferView >= 0
+      && !_readComponents(accessor.componentType, accessor.normalized,
+                          bufferViewData(accessor.bufferView)
+                            + accessor.byteOffset,
+                          byteStride(accessor), accessor.count, components,
+                          values.data())) {
+    return false;
+  }
+
+  if (accessor.isSparse) {
+    const auto& sparse = accessor.sparse;
+    Uint32Array indices(sparse.count);
+    if (!readIndexComponents(
+          sparse.indicesComponentType,
+          bufferViewData(sparse.indicesBufferView) + sparse.indicesByteOffset,
+          ComponentSize(sparse.indicesComponentType), sparse.count,
+          indices.data())) {
+      return false;
+    }
+    Float32Array sparseValues(sparse.count * components);
+    if (!_readComponents(
+          accessor.componentType, accessor.normalized,
+          bufferViewData(sparse.valuesBufferView) + sparse.valuesByteOffset,
+          components * ComponentSize(accessor.componentType), sparse.count,
+          components, sparseValues.data())) {
+      return false;
+    }
+    for (size_t i = 0; i < sparse.count; ++i) {
+      std::copy(sparseValues.begin() + static_cast<long>(i * components),
+                sparseValues.begin() + static_cast<long>((i + 1) * components),
+                values.begin() + static_cast<long>(indices[i] * components));
+    }
+  }
+
+  return true;
+}
+
+bool GLTF2Asset::readIndices(const IGLTF2Accessor& accessor,
+                             Uint32Array& values) const
+{
+  if (accessor.type != EAccessorType::SCALAR) {
+    return false;
+  }
+
+  const auto indexView = view<uint32_t>(accessor);
+  if (!indexView.empty() && indexView.isContiguous()) {
+    values.assign(indexView[0], indexView[0] + accessor.count);
+    return true;
+  }
+
+  values.assign(accessor.count, 0);
+  if (accessor.bufferView >= 0
+      && !readIndexComponents(
+           accessor.componentType,
+           bufferViewData(accessor.bufferView) + accessor.byteOffset,
+           byteStride(accessor), accessor.count, values.data())) {
+    return false;
+  }
+
+  if (accessor.isSparse) {
+    const auto& sparse = accessor.sparse;
+    Uint32Array indices(sparse.count), sparseValues(sparse.count);
+    if (!readIndexComponents(
+          sparse.indicesComponentType,
+          bufferViewData(sparse.indicesBufferView) + sparse.indicesByteOffset,
+          ComponentSize(sparse.indicesComponentType), sparse.count,
+          indices.data())
+        || !readIndexComponents(
+             accessor.componentType,
+             bufferViewData(sparse.valuesBufferView) + sparse.valuesByteOffset,
+             ComponentSize(accessor.componentType), sparse.count,
+             sparseValues.data())) {
+      return false;
+    }
+    for (size_t i = 0; i < sparse.count; ++i) {
+      values[indices[i]] = sparseValues[i];
+    }
+  }
+
+  return true;
+}
+
+size_t GLTF2Asset::mappedByteLength() const
+{
+  size_t byteLength = 0;
+  for (const auto& file : _mappedFiles) {
+    if (file->isMapped()) {
+      byteLength += file->size();
+    }
+  }
+  return byteLength;
+}
+
+size_t GLTF2Asset::allocatedByteLength() const
+{
+  size_t byteLength = 0;
+  for (const auto& file : _mappedFiles) {
+    if (!file->isMapped()) {
+      byteLength += file->size();
+    }
+  }
+  for (const auto& decodedBuffer : _decodedBuffers) {
+    byteLength += decodedBuffer.size();
+  }
+  return byteLength;
+}
+
+bool GLTF2Asset::_parseGLB(const uint8_t* data, size_t size)
+{
+  // Header: magic, version, length, followed by the JSON chunk and the
+  // optional binary chunk, each made of a length, a type and the chunk data
+  if (size < 20 || readUint32(data) != GLBMagic) {
+    BABYLON_LOG_ERROR("GLTF2Asset", "Invalid GLB header");
+    return false;
+  }
+  const uint32_t version = readUint32(data + 4);
+  const size_t length    = readUint32(data + 8);
+  if (version != 2 || length > size) {
+    BABYLON_LOGF_ERROR("GLTF2Asset", "Unsupported GLB version %u", version);
+    return false;
+  }
+
+  const uint8_t* jsonChunk   = nullptr;
+  const uint8_t* binaryChunk = nullptr;
+  size_t jsonChunkLength     = 0;
+  size_t binaryChunkLength   = 0;
+  for (size_t offset = 12; offset + 8 <= length;) {
+    const size_t chunkLength = readUint32(data + offset);
+    const uint32_t chunkType = readUint32(data + offset + 4);
+    offset += 8;
+    if (chunkLength > length - offset) {
+      BABYLON_LOG_ERROR("GLTF2Asset", "Truncated GLB chunk");
+      return false;
+    }
+    if (chunkType == GLBChunkJSON && jsonChunk == nullptr) {
+      jsonChunk       = data + offset;
+      jsonChunkLength = chunkLength;
+    }
+    else if (chunkType == GLBChunkBinary && binaryChunk == nullptr) {
+      binaryChunk       = data + offset;
+      binaryChunkLength = chunkLength;
+    }
+    // Unknown chunks are skipped
+    offset += chunkLength;
+  }
+
+  if (jsonChunk == nullptr) {
+    BABYLON_LOG_ERROR("GLTF2Asset", "Missing GLB JSON chunk");
+    return false;
+  }
+
+  return _parseJSON(reinterpret_cast<const char*>(jsonChunk),
+                    reinterpret_cast<const char*>(jsonChunk) + jsonChunkLength)
+         && _loadBuffers(binaryChunk, binaryChunkLength);
+}
+
+bool GLTF2Asset::_parseJSON(const char* begin, const char* end)
+{
+  Json::value root;
+  std::string err;
+  picojson::parse(root, begin, end, &err);
+  if (!err.empty() || !root.is<Json::object>()) {
+    BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid glTF JSON: %s", err.c_str());
+    return false;
+  }
+
+  const std::string version = root.contains("asset") ?
+                          Json::GetString(root.get("asset"), "version") :
+                          "";
+  if (String::startsWith(version, "1.")) {
+    BABYLON_LOG_ERROR("GLTF2Asset", "glTF 1.0 assets are not supported");
+    return false;
+  }
+
+  scene = Json::GetNumber<int>(root, "scene", -1);
+
+  for (const auto& parsedBuffer : Json::GetArray(root, "buffers")) {
+    IGLTF2Buffer buffer;
+    buffer.name       = Json::GetString(parsedBuffer, "name");
+    buffer.uri        = Json::GetString(parsedBuffer, "uri");
+    buffer.byteLength = Json::GetNumber<size_t>(parsedBuffer, "byteLength", 0);
+    buffers.emplace_back(buffer);
+  }
+
+  for (const auto& parsedBufferView : Json::GetArray(root, "bufferViews")) {
+    IGLTF2BufferView bufferView;
+    bufferView.name   = Json::GetString(parsedBufferView, "name");
+    bufferView.buffer = Json::GetNumber<int>(parsedBufferView, "buffer", -1);
+    bufferView.byteOffset
+      = Json::GetNumber<size_t>(parsedBufferView, "byteOffset", 0);
+    bufferView.byteLength
+      = Json::GetNumber<size_t>(parsedBufferView, "byteLength", 0);
+    bufferView.byteStride
+      = Json::GetNumber<size_t>(parsedBufferView, "byteStride", 0);
+    bufferView.target
+      = Json::GetNumber<unsigned int>(parsedBufferView, "target", 0);
+    bufferViews.emplace_back(bufferView);
+  }
+
+  for (const auto& parsedAccessor : Json::GetArray(root, "accessors")) {
+    IGLTF2Accessor accessor;
+    accessor.name       = Json::GetString(parsedAccessor, "name");
+    accessor.bufferView
+      = Json::GetNumber<int>(parsedAccessor, "bufferView", -1);
+    accessor.byteOffset
+      = Json::GetNumber<size_t>(parsedAccessor, "byteOffset", 0);
+    accessor.componentType = static_cast<EComponentType>(
+      Json::GetNumber<unsigned int>(parsedAccessor, "componentType", 0));
+    accessor.normalized = Json::GetBool(parsedAccessor, "normalized");
+    accessor.count      = Json::GetNumber<size_t>(parsedAccessor, "count", 0);
+    accessor.max        = Json::ToArray<float>(parsedAccessor, "max");
+    accessor.min        = Json::ToArray<float>(parsedAccessor, "min");
+    if (!parseAccessorType(Json::GetString(parsedAccessor, "type"),
+                           accessor.type)) {
+      BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid type of accessor %zu",
+                         accessors.size());
+      return false;
+    }
+    if (parsedAccessor.contains("sparse")) {
+      const auto& parsedSparse = parsedAccessor.get("sparse");
+      const auto& indices      = parsedSparse.get("indices");
+      const auto& values       = parsedSparse.get("values");
+      accessor.isSparse        = true;
+      accessor.sparse.count = Json::GetNumber<size_t>(parsedSparse, "count", 0);
+      accessor.sparse.indicesBufferView
+        = Json::GetNumber<int>(indices, "bufferView", -1);
+      accessor.sparse.indicesByteOffset
+        = Json::GetNumber<size_t>(indices, "byteOffset", 0);
+      accessor.sparse.indicesComponentType = static_cast<EComponentType>(
+        Json::GetNumber<unsigned int>(indices, "componentType", 0));
+      accessor.sparse.valuesBufferView
+        = Json::GetNumber<int>(values, "bufferView", -1);
+      accessor.sparse.valuesByteOffset
+        = Json::GetNumber<size_t>(values, "byteOffset", 0);
+    }
+    accessors.emplace_back(accessor);
+  }
+
+  for (const auto& parsedMesh : Json::GetArray(root, "meshes")) {
+    IGLTF2Mesh mesh;
+    mesh.name    = Json::GetString(parsedMesh, "name");
+    mesh.weights = Json::ToArray<float>(parsedMesh, "weights");
+    for (const auto& parsedPrimitive :
+         Json::GetArray(parsedMesh, "primitives")) {
+      IGLTF2MeshPrimitive primitive;
+      if (parsedPrimitive.contains("attributes")) {
+        primitive.attributes
+          = parseAttributes(parsedPrimitive.get("attributes"));
+      }
+      primitive.indices = Json::GetNumber<int>(parsedPrimitive, "indices", -1);
+      primitive.material
+        = Json::GetNumber<int>(parsedPrimitive, "material", -1);
+      primitive.mode = static_cast<EMeshPrimitiveMode>(
+        Json::GetNumber<unsigned int>(parsedPrimitive, "mode", 4));
+      for (const auto& parsedTarget :
+           Json::GetArray(parsedPrimitive, "targets")) {
+        primitive.targets.emplace_back(parseAttributes(parsedTarget));
+      }
+      mesh.primitives.emplace_back(primitive);
+    }
+    meshes.emplace_back(mesh);
+  }
+
+  for (const auto& parsedNode : Json::GetArray(root, "nodes")) {
+    IGLTF2Node node;
+    node.name        = Json::GetString(parsedNode, "name");
+    node.children    = toIndexArray(parsedNode, "children");
+    node.mesh        = Json::GetNumber<int>(parsedNode, "mesh", -1);
+    node.skin        = Json::GetNumber<int>(parsedNode, "skin", -1);
+    node.matrix      = Json::ToArray<float>(parsedNode, "matrix");
+    node.translation = Json::ToArray<float>(parsedNode, "translation");
+    node.rotation    = Json::ToArray<float>(parsedNode, "rotation");
+    node.scale       = Json::ToArray<float>(parsedNode, "scale");
+    nodes.emplace_back(node);
+  }
+
+  for (const auto& parsedSkin : Json::GetArray(root, "skins")) {
+    IGLTF2Skin skin;
+    skin.name = Json::GetString(parsedSkin, "name");
+    skin.inverseBindMatrices
+      = Json::GetNumber<int>(parsedSkin, "inverseBindMatrices", -1);
+    skin.skeleton = Json::GetNumber<int>(parsedSkin, "skeleton", -1);
+    skin.joints   = toIndexArray(parsedSkin, "joints");
+    skins.emplace_back(skin);
+  }
+
+  for (const auto& parsedScene : Json::GetArray(root, "scenes")) {
+    IGLTF2Scene gltfScene;
+    gltfScene.name  = Json::GetString(parsedScene, "name");
+    gltfScene.nodes = toIndexArray(parsedScene, "nodes");
+    scenes.emplace_back(gltfScene);
+  }
+
+  // Resolve the parents, which the skins and the transforms need
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    for (int child : nodes[i].children) {
+      if (!inRange(child, nodes.size())
+          || nodes[static_cast<size_t>(child)].parent >= 0) {
+        BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid child of node %zu", i);
+        return false;
+      }
+      nodes[static_cast<size_t>(child)].parent = static_cast<int>(i);
+    }
+  }
+
+  return true;
+}
+
+bool GLTF2Asset::_loadBuffers(const uint8_t* binaryChunk,
+                              size_t binaryChunkLength)
+{
+  static const std::string base64Marker = ";base64,";
+
+  // The decoded buffers are referenced by pointer and must not be moved
+  _decodedBuffers.reserve(buffers.size());
+  _bufferData.resize(buffers.size(), nullptr);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    const auto& buffer = buffers[i];
+    const uint8_t* data = nullptr;
+    size_t size         = 0;
+    if (buffer.uri.empty()) {
+      // GLB-stored buffer
+      if (i == 0 && binaryChunk != nullptr) {
+        data = binaryChunk;
+        size = binaryChunkLength;
+      }
+    }
+    else if (String::startsWith(buffer.uri, "data:")) {
+      const size_t marker = buffer.uri.find(base64Marker);
+      if (marker != std::string::npos) {
+        _decodedBuffers.emplace_back(
+          base64_decode(buffer.uri.substr(marker + base64Marker.size())));
+        data = reinterpret_cast<const uint8_t*>(_decodedBuffers.back().data());
+        size = _decodedBuffers.back().size();
+      }
+    }
+    else {
+      auto file = MemoryMappedFile::Open(_rootUrl + buffer.uri);
+      if (file) {
+        data = file->data();
+        size = file->size();
+        _mappedFiles.emplace_back(std::move(file));
+      }
+    }
+
+    if (data == nullptr || size < buffer.byteLength) {
+      BABYLON_LOGF_ERROR("GLTF2Asset", "Could not load buffer %zu", i);
+      return false;
+    }
+    _bufferData[i] = data;
+  }
+
+  return true;
+}
+
+bool GLTF2Asset::_validate() const
+{
+  // The sizes come from the file, they are compared without additions or
+  // multiplications that could overflow
+  for (size_t i = 0; i < bufferViews.size(); ++i) {
+    const auto& bufferView = bufferViews[i];
+    if (!inRange(bufferView.buffer, buffers.size())) {
+      BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid buffer view %zu", i);
+      return false;
+    }
+    const size_t bufferLength
+      = buffers[static_cast<size_t>(bufferView.buffer)].byteLength;
+    if (bufferView.byteOffset > bufferLength
+        || bufferView.byteLength > bufferLength - bufferView.byteOffset) {
+      BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid buffer view %zu", i);
+      return false;
+    }
+  }
+
+  const auto fitsInBufferView
+    = [this](int bufferView, size_t byteOffset, size_t stride, size_t count,
+             size_t elementSize) {
+        if (!inRange(bufferView, bufferViews.size())) {
+          return false;
+        }
+        if (count == 0) {
+          return true;
+        }
+        const size_t viewLength
+          = bufferViews[static_cast<size_t>(bufferView)].byteLength;
+        if (elementSize > viewLength
+            || byteOffset > viewLength - elementSize) {
+          return false;
+        }
+        // Room left for the elements after the first one
+        const size_t available = viewLength - elementSize - byteOffset;
+        return stride > 0 && count - 1 <= available / stride;
+      };
+
+  for (size_t i = 0; i < accessors.size(); ++i) {
+    const auto& accessor     = accessors[i];
+    const size_t elementSize = ComponentCount(accessor.type)
+                               * ComponentSize(accessor.componentType);
+    bool valid = elementSize > 0;
+    if (valid && accessor.bufferView >= 0) {
+      valid = fitsInBufferView(accessor.bufferView, accessor.byteOffset,
+                               byteStride(accessor), accessor.count,
+                               elementSize);
+    }
+    if (valid && accessor.isSparse) {
+      const auto& sparse     = accessor.sparse;
+      const size_t indexSize = ComponentSize(sparse.indicesComponentType);
+      valid = sparse.indicesComponentType != EComponentType::BYTE
+              && sparse.indicesComponentType != EComponentType::SHORT
+              && sparse.indicesComponentType != EComponentType::FLOAT
+              && indexSize > 0
+              && fitsInBufferView(sparse.indicesBufferView,
+                                  sparse.indicesByteOffset, indexSize,
+                                  sparse.count, indexSize)
+              && fitsInBufferView(sparse.valuesBufferView,
+                                  sparse.valuesByteOffset, elementSize,
+                                  sparse.count, elementSize);
+      if (valid) {
+        // The substituted indices must be within the accessor
+        Uint32Array indices(sparse.count);
+        readIndexComponents(sparse.indicesComponentType,
+                            bufferViewData(sparse.indicesBufferView)
+                              + sparse.indicesByteOffset,
+                            indexSize, sparse.count, indices.data());
+        valid = std::all_of(
+          indices.begin(), indices.end(),
+          [&accessor](uint32_t index) { return index < accessor.count; });
+      }
+    }
+    if (!valid) {
+      BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid accessor %zu", i);
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    for (const auto& primitive : meshes[i].primitives) {
+      bool valid = primitive.indices < 0
+                   || inRange(primitive.indices, accessors.size());
+      for (const auto& attribute : primitive.attributes) {
+        valid = valid && inRange(attribute.second, accessors.size());
+      }
+      for (const auto& target : primitive.targets) {
+        for (const auto& attribute : target) {
+          valid = valid && inRange(attribute.second, accessors.size());
+        }
+      }
+      if (!valid) {
+        BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid primitive of mesh %zu", i);
+        return false;
+      }
+    }
+  }
+
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    const auto& node = nodes[i];
+    // A node has a single parent, walking up more than nodes.size() parents
+    // means that the hierarchy has a cycle
+    int ancestor = node.parent;
+    for (size_t depth = 0; ancestor >= 0 && depth < nodes.size(); ++depth) {
+      ancestor = nodes[static_cast<size_t>(ancestor)].parent;
+    }
+    if (ancestor >= 0 || (node.mesh >= 0 && !inRange(node.mesh, meshes.size()))
+        || (node.skin >= 0 && !inRange(node.skin, skins.size()))) {
+      BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid node %zu", i);
+      return false;
+    }
+  }
+
+  for (size_t i = 0; i < skins.size(); ++i) {
+    const auto& skin = skins[i];
+    bool valid       = std::all_of(
+      skin.joints.begin(), skin.joints.end(),
+      [this](int joint) { return inRange(joint, nodes.size()); });
+    if (valid && skin.inverseBindMatrices >= 0) {
+      valid = inRange(skin.inverseBindMatrices, accessors.size());
+      if (valid) {
+        const auto& accessor
+          = accessors[static_cast<size_t>(skin.inverseBindMatrices)];
+        valid = accessor.type == EAccessorType::MAT4
+                && accessor.componentType == EComponentType::FLOAT
+                && accessor.count >= skin.joints.size();
+      }
+    }
+    if (!valid) {
+      BABYLON_LOGF_ERROR("GLTF2Asset", "Invalid skin %zu", i);
+      return false;
+    }
+  }
+
+  for (const auto& gltfScene : scenes) {
+    for (int node : gltfScene.nodes) {
+      if (!inRange(node, nodes.size())) {
+        BABYLON_LOG_ERROR("GLTF2Asset", "Invalid scene node");
+        return false;
+      }
+    }
+  }
+
+  return scene < 0 || inRange(scene, scenes.size());
+}
+
+bool GLTF2Asset::_readComponents(EComponentType componentType,
+                                 bool normalized, const uint8_t* data,
+                                 size_t stride, size_t count,
+                                 size_t components, float* values) const
+{
+  switch (componentType) {
+    case EComponentType::BYTE:
+      readComponents<int8_t>(data, stride, count, components, normalized,
+                             values);
+      return true;
+    case EComponentType::UNSIGNED_BYTE:
+      readComponents<uint8_t>(data, stride, count, components, normalized,
+                              values);
+      return true;
+    case EComponentType::SHORT:
+      readComponents<int16_t>(data, stride, count, components, normalized,
+                              values);
+      return true;
+    case EComponentType::UNSIGNED_SHORT:
+      readComponents<uint16_t>(data, stride, count, components, normalized,
+                               values);
+      return true;
+    case EComponentType::UNSIGNED_INT:
+      readComponents<uint32_t>(data, stride, count, components, normalized,
+                               values);
+      return true;
+    case EComponentType::FLOAT:
+      readComponents<float>(data, stride, count, components, false, values);
+      return true;
+  }
+  return false;
+}
+
+} // end of namespace BABYLON
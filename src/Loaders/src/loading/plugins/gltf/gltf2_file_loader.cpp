@@ -0,0 +1,498 @@
+#include <babylon/loading/plugins/gltf/gltf2_file_loader.h>
+
+#include <numeric>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/core/logging.h>
+#include <babylon/engine/scene.h>
+#include <babylon/loading/plugins/gltf/gltf2_asset.h>
+#include <babylon/math/quaternion.h>
+#include <babylon/math/vector3.h>
+#include <babylon/mesh/mesh.h>
+#include <babylon/mesh/vertex_data.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * Calls function(index) for each index in [0, count[, the indices are handed
+ * out one by one to the worker threads as the work items are uneven (one
+ * primitive or one skin each).
+ */
+template <typename Function>
+void parallelForEach(size_t count, const Function& function)
+{
+  const size_t threadCount
+    = std::min(count, static_cast<size_t>(std::max(
+                        1u, std::thread::hardware_concurrency())));
+  if (threadCount <= 1) {
+    for (size_t i = 0; i < count; ++i) {
+      function(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  const auto worker = [&]() {
+    for (size_t i = next++; i < count; i = next++) {
+      function(i);
+    }
+  };
+  std::vector<std::future<void>> workers;
+  workers.reserve(threadCount - 1);
+  for (size_t t = 1; t < threadCount; ++t) {
+    workers.emplace_back(std::async(std::launch::async, worker));
+  }
+  worker();
+  for (auto& future : workers) {
+    future.get();
+  }
+}
+
+/**
+ * Reads an attribute of the primitive, returns false when it is missing.
+ */
+bool readAttribute(const GLTF2Asset& asset,
+                   const IGLTF2MeshPrimitive& primitive,
+                   const std::string& name, Float32Array& values)
+{
+  auto it = primitive.attributes.find(name);
+  if (it == primitive.attributes.end()) {
+    return false;
+  }
+  return asset.readFloats(asset.accessors[static_cast<size_t>(it->second)],
+                          values);
+}
+
+/**
+ * glTF texture coordinates have their origin at the top left corner.
+ */
+void normalizeUVs(Float32Array& uvs)
+{
+  for (size_t i = 1; i < uvs.size(); i += 2) {
+    uvs[i] = 1.f - uvs[i];
+  }
+}
+
+/**
+ * Converts triangle strips and fans to triangle lists.
+ */
+Uint32Array toTriangleList(EMeshPrimitiveMode mode, const Uint32Array& indices)
+{
+  Uint32Array triangles;
+  if (indices.size() < 3) {
+    return triangles;
+  }
+  triangles.reserve((indices.size() - 2) * 3);
+  for (size_t i = 0; i + 2 < indices.size(); ++i) {
+    if (mode == EMeshPrimitiveMode::TRIANGLE_FAN) {
+      triangles.insert(triangles.end(),
+                       {indices[0], indices[i + 1], indices[i + 2]});
+    }
+    else if (i % 2 == 0) {
+      triangles.insert(triangles.end(),
+                       {indices[i], indices[i + 1], indices[i + 2]});
+    }
+    else {
+      triangles.insert(triangles.end(),
+                       {indices[i + 1], indices[i], indices[i + 2]});
+    }
+  }
+  return triangles;
+}
+
+} // end of anonymous namespace
+
+GLTF2FileLoader::GLTF2FileLoader()
+{
+  extensions.mapping.emplace(std::make_pair(".gltf", false));
+  extensions.mapping.emplace(std::make_pair(".glb", true));
+}
+
+GLTF2FileLoader::~GLTF2FileLoader()
+{
+}
+
+bool GLTF2FileLoader::importMeshAsync(
+  const std::vector<std::string>& meshesNames, Scene* scene,
+  const std::string& data, const std::string& rootUrl,
+  const std::function<void(std::vector<AbstractMesh*>& meshes,
+                           std::vector<ParticleSystem*>& particleSystems,
+                           std::vector<Skeleton*>& skeletons)>& onSuccess,
+  const std::function<void()>& onError)
+{
+  auto asset = GLTF2Asset::LoadFromMemory(
+    reinterpret_cast<const uint8_t*>(data.data()), data.size(), rootUrl);
+  if (!asset) {
+    if (onError) {
+      onError();
+    }
+    return false;
+  }
+
+  std::vector<AbstractMesh*> meshes;
+  std::vector<ParticleSystem*> particleSystems;
+  std::vector<Skeleton*> skeletons;
+  importAsset(*asset, scene, meshesNames, meshes, skeletons);
+  if (onSuccess) {
+    onSuccess(meshes, particleSystems, skeletons);
+  }
+  return true;
+}
+
+bool GLTF2FileLoader::loadAsync(Scene* scene, const std::string& data,
+                                const std::string& rootUrl,
+                                const std::function<void()>& onsuccess,
+                                const std::function<void()>& onerror)
+{
+  return importMeshAsync(
+    {}, scene, data, rootUrl,
+    [&onsuccess](std::vector<AbstractMesh*>& /*meshes*/,
+                 std::vector<ParticleSystem*>& /*particleSystems*/,
+                 std::vector<Skeleton*>& /*skeletons*/) {
+      if (onsuccess) {
+        onsuccess();
+      }
+    },
+    onerror);
+}
+
+bool GLTF2FileLoader::importMeshesFromFile(
+  const std::string& filename, Scene* scene,
+  const std::vector<std::string>& meshesNames,
+  std::vector<AbstractMesh*>& meshes, std::vector<Skeleton*>& skeletons) const
+{
+  auto asset = GLTF2Asset::LoadFromFile(filename);
+  if (!asset) {
+    return false;
+  }
+  importAsset(*asset, scene, meshesNames, meshes, skeletons);
+  return true;
+}
+
+void GLTF2FileLoader::importAsset(const GLTF2Asset& asset, Scene* scene,
+                                  const std::vector<std::string>& meshesNames,
+                                  std::vector<AbstractMesh*>& meshes,
+                                  std::vector<Skeleton*>& skeletons) const
+{
+  // The skins are built while the vertex data is
+  auto skinDataFuture = std::async(std::launch::async,
+                                   [&asset]() { return BuildSkins(asset); });
+  auto vertexData = BuildVertexData(asset);
+  const auto skinData = skinDataFuture.get();
+
+  std::vector<Skeleton*> babylonSkeletons;
+  for (size_t s = 0; s < asset.skins.size(); ++s) {
+    const auto& skin = asset.skins[s];
+    auto skeleton    = new Skeleton(
+      skin.name.empty() ? "skeleton" + std::to_string(s) : skin.name,
+      std::to_string(s), scene);
+    std::vector<Bone*> bones(skin.joints.size(), nullptr);
+    for (size_t joint : skinData[s].boneOrder) {
+      const auto& node = asset.nodes[static_cast<size_t>(skin.joints[joint])];
+      const int parentJoint = skinData[s].parentJoints[joint];
+      bones[joint]          = Bone::New(
+        node.name.empty() ? "joint" + std::to_string(joint) : node.name,
+        skeleton,
+        parentJoint < 0 ? nullptr : bones[static_cast<size_t>(parentJoint)],
+        skinData[s].boneMatrices[joint]);
+    }
+    babylonSkeletons.emplace_back(skeleton);
+    skeletons.emplace_back(skeleton);
+  }
+
+  // glTF is right-handed
+  auto root = Mesh::New("__root__", scene);
+  root->setScaling(Vector3(1.f, 1.f, -1.f));
+
+  std::vector<int> rootNodes;
+  if (asset.scene >= 0 || !asset.scenes.empty()) {
+    rootNodes
+      = asset.scenes[static_cast<size_t>(std::max(asset.scene, 0))].nodes;
+  }
+  else {
+    for (size_t i = 0; i < asset.nodes.size(); ++i) {
+      if (asset.nodes[i].parent < 0) {
+        rootNodes.emplace_back(static_cast<int>(i));
+      }
+    }
+  }
+
+  for (int node : rootNodes) {
+    _importNode(asset, static_cast<size_t>(node), root, scene, meshesNames,
+                vertexData, babylonSkeletons, skinData, meshes);
+  }
+}
+
+Mesh* GLTF2FileLoader::_importNode(
+  const GLTF2Asset& asset, size_t index, Mesh* parent, Scene* scene,
+  const std::vector<std::string>& meshesNames,
+  std::vector<std::vector<std::unique_ptr<VertexData>>>& vertexData,
+  const std::vector<Skeleton*>& babylonSkeletons,
+  const std::vector<GLTF2SkinData>& skinData,
+  std::vector<AbstractMesh*>& meshes) const
+{
+  const auto& node = asset.nodes[index];
+  const std::string name
+    = node.name.empty() ? "node" + std::to_string(index) : node.name;
+
+  auto babylonMesh = Mesh::New(name, scene);
+  babylonMesh->setParent(parent);
+
+  if (node.matrix.size() == 16) {
+    Vector3 scaling, position;
+    Quaternion rotation;
+    // Same memory layout: column-major with column vectors in glTF, row-major
+    // with row vectors in Babylon
+    Matrix::FromArray(node.matrix).decompose(scaling, rotation, position);
+    babylonMesh->setPosition(position);
+    babylonMesh->setRotationQuaternion(rotation);
+    babylonMesh->setScaling(scaling);
+  }
+  else {
+    if (node.translation.size() == 3) {
+      babylonMesh->setPosition(Vector3::FromArray(node.translation));
+    }
+    if (node.rotation.size() == 4) {
+      babylonMesh->setRotationQuaternion(Quaternion::FromArray(node.rotation));
+    }
+    if (node.scale.size() == 3) {
+      babylonMesh->setScaling(Vector3::FromArray(node.scale));
+    }
+  }
+
+  if (node.mesh >= 0) {
+    const auto meshIndex = static_cast<size_t>(node.mesh);
+    const auto& mesh     = asset.meshes[meshIndex];
+    if (meshesNames.empty() || stl_util::contains(meshesNames, node.name)
+        || stl_util::contains(meshesNames, mesh.name)) {
+      auto& primitivesData = vertexData[meshIndex];
+      const auto skin      = static_cast<size_t>(node.skin);
+      for (size_t p = 0; p < primitivesData.size(); ++p) {
+        if (!primitivesData[p]) {
+          BABYLON_LOGF_WARN("GLTF2FileLoader",
+                            "Skipping primitive %zu of mesh %s", p,
+                            mesh.name.c_str());
+          continue;
+        }
+
+        Mesh* primitiveMesh = babylonMesh;
+        if (primitivesData.size() > 1) {
+          primitiveMesh
+            = Mesh::New(name + "_primitive" + std::to_string(p), scene);
+          primitiveMesh->setParent(babylonMesh);
+        }
+
+        if (node.skin >= 0) {
+          // The bones are created parents first, remap the joint indices when
+          // this is not the order of the skin joints
+          const auto& boneOrder = skinData[skin].boneOrder;
+          Float32Array jointBones(boneOrder.size());
+          bool isIdentity = true;
+          for (size_t b = 0; b < boneOrder.size(); ++b) {
+            jointBones[boneOrder[b]] = static_cast<float>(b);
+            isIdentity               = isIdentity && (boneOrder[b] == b);
+          }
+          if (isIdentity) {
+            primitivesData[p]->applyToMesh(primitiveMesh);
+          }
+          else {
+            VertexData remapped = *primitivesData[p];
+            for (auto& joint : remapped.matricesIndices) {
+              joint = jointBones[static_cast<size_t>(joint)];
+            }
+            remapped.applyToMesh(primitiveMesh);
+          }
+          primitiveMesh->setSkeleton(babylonSkeletons[skin]);
+          primitiveMesh->setNumBoneInfluencers(4);
+        }
+        else {
+          primitivesData[p]->applyToMesh(primitiveMesh);
+        }
+        meshes.emplace_back(primitiveMesh);
+      }
+    }
+  }
+
+  for (int child : node.children) {
+    _importNode(asset, static_cast<size_t>(child), babylonMesh, scene,
+                meshesNames, vertexData, babylonSkeletons, skinData, meshes);
+  }
+
+  return babylonMesh;
+}
+
+std::vector<std::vector<std::unique_ptr<VertexData>>>
+GLTF2FileLoader::BuildVertexData(const GLTF2Asset& asset)
+{
+  std::vector<std::vector<std::unique_ptr<VertexData>>> vertexData(
+    asset.meshes.size());
+  std::vector<std::pair<size_t, size_t>> primitives;
+  for (size_t m = 0; m < asset.meshes.size(); ++m) {
+    vertexData[m].resize(asset.meshes[m].primitives.size());
+    for (size_t p = 0; p < asset.meshes[m].primitives.size(); ++p) {
+      primitives.emplace_back(m, p);
+    }
+  }
+
+  parallelForEach(primitives.size(), [&](size_t i) {
+    const size_t m = primitives[i].first, p = primitives[i].second;
+    vertexData[m][p] = BuildVertexData(asset, asset.meshes[m].primitives[p]);
+  });
+
+  return vertexData;
+}
+
+std::unique_ptr<VertexData>
+GLTF2FileLoader::BuildVertexData(const GLTF2Asset& asset,
+                                 const IGLTF2MeshPrimitive& primitive)
+{
+  if (primitive.mode != EMeshPrimitiveMode::TRIANGLES
+      && primitive.mode != EMeshPrimitiveMode::TRIANGLE_STRIP
+      && primitive.mode != EMeshPrimitiveMode::TRIANGLE_FAN) {
+    return nullptr;
+  }
+
+  auto vertexData = std::make_unique<VertexData>();
+  if (!readAttribute(asset, primitive, "POSITION", vertexData->positions)) {
+    return nullptr;
+  }
+  const size_t vertexCount = vertexData->positions.size() / 3;
+
+  if (primitive.indices >= 0) {
+    if (!asset.readIndices(
+          asset.accessors[static_cast<size_t>(primitive.indices)],
+          vertexData->indices)) {
+      return nullptr;
+    }
+  }
+  else {
+    vertexData->indices.resize(vertexCount);
+    std::iota(vertexData->indices.begin(), vertexData->indices.end(), 0u);
+  }
+  if (primitive.mode != EMeshPrimitiveMode::TRIANGLES) {
+    vertexData->indices = toTriangleList(primitive.mode, vertexData->indices);
+  }
+  if (std::any_of(vertexData->indices.begin(), vertexData->indices.end(),
+                  [vertexCount](uint32_t i) { return i >= vertexCount; })) {
+    return nullptr;
+  }
+
+  if (!readAttribute(asset, primitive, "NORMAL", vertexData->normals)) {
+    VertexData::ComputeNormals(vertexData->positions, vertexData->indices,
+                               vertexData->normals);
+  }
+  readAttribute(asset, primitive, "TANGENT", vertexData->tangents);
+  if (readAttribute(asset, primitive, "TEXCOORD_0", vertexData->uvs)) {
+    normalizeUVs(vertexData->uvs);
+  }
+  if (readAttribute(asset, primitive, "TEXCOORD_1", vertexData->uvs2)) {
+    normalizeUVs(vertexData->uvs2);
+  }
+
+  Float32Array colors;
+  if (readAttribute(asset, primitive, "COLOR_0", colors)) {
+    if (colors.size() == vertexCount * 3) {
+      // Babylon vertex colors are RGBA
+      vertexData->colors.resize(vertexCount * 4);
+      for (size_t i = 0; i < vertexCount; ++i) {
+        std::copy(colors.begin() + static_cast<long>(i * 3),
+                  colors.begin() + static_cast<long>(i * 3 + 3),
+                  vertexData->colors.begin() + static_cast<long>(i * 4));
+        vertexData->colors[i * 4 + 3] = 1.f;
+      }
+    }
+    else {
+      vertexData->colors = std::move(colors);
+    }
+  }
+
+  if (readAttribute(asset, primitive, "JOINTS_0", vertexData->matricesIndices)
+      && readAttribute(asset, primitive, "WEIGHTS_0",
+                       vertexData->matricesWeights)) {
+    if (vertexData->matricesIndices.size() != vertexCount * 4
+        || vertexData->matricesWeights.size() != vertexCount * 4) {
+      return nullptr;
+    }
+  }
+  else {
+    vertexData->matricesIndices.clear();
+    vertexData->matricesWeights.clear();
+  }
+
+  return vertexData;
+}
+
+std::vector<GLTF2SkinData> GLTF2FileLoader::BuildSkins(const GLTF2Asset& asset)
+{
+  std::vector<GLTF2SkinData> skinData(asset.skins.size());
+
+  parallelForEach(asset.skins.size(), [&](size_t s) {
+    const auto& skin   = asset.skins[s];
+    auto& data         = skinData[s];
+    const size_t count = skin.joints.size();
+
+    // Parent joint: the closest ancestor of the joint node which is a joint
+    std::unordered_map<int, int> nodeJoints;
+    for (size_t j = 0; j < count; ++j) {
+      nodeJoints[skin.joints[j]] = static_cast<int>(j);
+    }
+    data.parentJoints.assign(count, -1);
+    for (size_t j = 0; j < count; ++j) {
+      int node = asset.nodes[static_cast<size_t>(skin.joints[j])].parent;
+      while (node >= 0 && !stl_util::contains(nodeJoints, node)) {
+        node = asset.nodes[static_cast<size_t>(node)].parent;
+      }
+      data.parentJoints[j] = node < 0 ? -1 : nodeJoints[node];
+    }
+
+    // Parents first
+    std::vector<bool> ordered(count, false);
+    std::vector<size_t> ancestors;
+    data.boneOrder.reserve(count);
+    for (size_t j = 0; j < count; ++j) {
+      for (int joint = static_cast<int>(j);
+           joint >= 0 && !ordered[static_cast<size_t>(joint)];
+           joint = data.parentJoints[static_cast<size_t>(joint)]) {
+        ancestors.emplace_back(static_cast<size_t>(joint));
+      }
+      for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it) {
+        ordered[*it] = true;
+        data.boneOrder.emplace_back(*it);
+      }
+      ancestors.clear();
+    }
+
+    // Bone matrix: world bind pose relative to the parent world bind pose,
+    // the world bind pose being the inverse of the inverse bind matrix
+    std::vector<Matrix> inverseBindMatrices(count, Matrix::Identity());
+    Float32Array matrices;
+    if (skin.inverseBindMatrices >= 0
+        && asset.readFloats(
+             asset.accessors[static_cast<size_t>(skin.inverseBindMatrices)],
+             matrices)) {
+      for (size_t j = 0; j < count; ++j) {
+        inverseBindMatrices[j]
+          = Matrix::FromArray(matrices, static_cast<unsigned int>(j * 16));
+      }
+    }
+    data.boneMatrices.resize(count);
+    for (size_t j = 0; j < count; ++j) {
+      Matrix bindMatrix = inverseBindMatrices[j];
+      bindMatrix.invert();
+      const int parentJoint = data.parentJoints[j];
+      data.boneMatrices[j]
+        = parentJoint < 0 ?
+            bindMatrix :
+            bindMatrix.multiply(
+              inverseBindMatrices[static_cast<size_t>(parentJoint)]);
+    }
+  });
+
+  return skinData;
+}
+
+} // end of namespace BABYLON
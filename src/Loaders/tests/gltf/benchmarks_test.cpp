@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+#include <babylon/loading/plugins/gltf/gltf2_asset.h>
+#include <babylon/loading/plugins/gltf/gltf2_file_loader.h>
+#include <babylon/mesh/vertex_data.h>
+
+#include "gltf2_test_assets.h"
+
+// The benchmarks are disabled by default, run them with:
+//   --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*
+// Sample assets (.gltf or .glb) can be added to the generated one with a list
+// of files separated by ';' in the BABYLON_GLTF_BENCHMARK_ASSETS environment
+// variable.
+
+namespace {
+
+template <class Function>
+double measure(Function&& function)
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  function();
+  const auto end = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+double megabytes(size_t byteLength)
+{
+  return static_cast<double>(byteLength) / (1024.0 * 1024.0);
+}
+
+size_t vertexDataByteLength(const BABYLON::VertexData& vertexData)
+{
+  return sizeof(float)
+           * (vertexData.positions.size() + vertexData.normals.size()
+              + vertexData.tangents.size() + vertexData.uvs.size()
+              + vertexData.uvs2.size() + vertexData.colors.size()
+              + vertexData.matricesIndices.size()
+              + vertexData.matricesWeights.size())
+         + sizeof(uint32_t) * vertexData.indices.size();
+}
+
+void benchmarkAsset(const std::string& filename)
+{
+  using namespace BABYLON;
+
+  std::unique_ptr<GLTF2Asset> asset;
+  const auto loadTime
+    = measure([&]() { asset = GLTF2Asset::LoadFromFile(filename); });
+  ASSERT_TRUE(asset != nullptr) << filename;
+
+  std::vector<std::vector<std::unique_ptr<VertexData>>> vertexData;
+  std::vector<GLTF2SkinData> skins;
+  const auto buildTime = measure([&]() {
+    vertexData = GLTF2FileLoader::BuildVertexData(*asset);
+    skins      = GLTF2FileLoader::BuildSkins(*asset);
+  });
+
+  size_t primitiveCount = 0, vertexCount = 0, byteLength = 0;
+  for (const auto& meshVertexData : vertexData) {
+    for (const auto& primitiveVertexData : meshVertexData) {
+      if (primitiveVertexData) {
+        ++primitiveCount;
+        vertexCount += primitiveVertexData->positions.size() / 3;
+        byteLength += vertexDataByteLength(*primitiveVertexData);
+      }
+    }
+  }
+
+  std::cout << filename << ": " << primitiveCount << " primitives, "
+            << vertexCount << " vertices, " << skins.size()
+            << " skins, load " << loadTime << " ms, build " << buildTime
+            << " ms (" << std::thread::hardware_concurrency()
+            << " threads), mapped " << megabytes(asset->mappedByteLength())
+            << " MB, allocated " << megabytes(asset->allocatedByteLength())
+            << " MB, vertex data " << megabytes(byteLength) << " MB"
+            << std::endl;
+}
+
+} // end of anonymous namespace
+
+TEST(TestGLTF2Benchmark, DISABLED_Load_and_build)
+{
+  const std::string filename = "gltf2_benchmark.glb";
+  writeFile(filename, makeGridAsset(64, 128).glb());
+  benchmarkAsset(filename);
+  std::remove(filename.c_str());
+
+  const char* assets = std::getenv("BABYLON_GLTF_BENCHMARK_ASSETS");
+  std::istringstream stream(assets ? assets : "");
+  for (std::string asset; std::getline(stream, asset, ';');) {
+    if (!asset.empty()) {
+      benchmarkAsset(asset);
+    }
+  }
+}
@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+
+#include <babylon/loading/plugins/gltf/gltf2_asset.h>
+#include <babylon/loading/plugins/gltf/gltf2_file_loader.h>
+#include <babylon/mesh/vertex_data.h>
+
+#include "gltf2_test_assets.h"
+
+namespace {
+
+constexpr size_t MeshCount = 3;
+constexpr size_t GridSize  = 9;
+
+std::unique_ptr<BABYLON::GLTF2Asset> loadGLB(const std::string& glb)
+{
+  return BABYLON::GLTF2Asset::LoadFromMemory(
+    reinterpret_cast<const uint8_t*>(glb.data()), glb.size(), "");
+}
+
+} // end of anonymous namespace
+
+TEST(TestGLTF2Asset, Views_point_into_the_GLB_binary_chunk)
+{
+  using namespace BABYLON;
+
+  const auto testAsset = makeGridAsset(MeshCount, GridSize);
+  const auto glb       = testAsset.glb();
+  const auto asset     = loadGLB(glb);
+  ASSERT_TRUE(asset != nullptr);
+  EXPECT_EQ(asset->meshes.size(), MeshCount);
+  EXPECT_EQ(asset->nodes[1].parent, 0);
+
+  // Interleaved positions and normals
+  const auto& positionAccessor = asset->accessors[6];
+  const auto positions         = asset->view<float>(positionAccessor);
+  ASSERT_FALSE(positions.empty());
+  EXPECT_EQ(positions.size(), testAsset.vertexCount());
+  EXPECT_EQ(positions.byteStride(), 24u);
+  EXPECT_FALSE(positions.isContiguous());
+  const auto* data = reinterpret_cast<const char*>(positions[0]);
+  EXPECT_TRUE(data >= glb.data() && data < glb.data() + glb.size());
+  EXPECT_FLOAT_EQ(positions.at(GridSize + 2, 0), 2.f / (GridSize - 1));
+  EXPECT_FLOAT_EQ(positions.at(GridSize + 2, 1), 1.f);
+  EXPECT_FLOAT_EQ(positions.at(GridSize + 2, 2), 1.f / (GridSize - 1));
+  const auto normals = asset->view<float>(asset->accessors[7]);
+  EXPECT_FLOAT_EQ(normals.at(3, 1), 1.f);
+
+  // Normalized values are only viewed with their storage type
+  const auto& uvAccessor = asset->accessors[8];
+  EXPECT_TRUE(asset->view<float>(uvAccessor).empty());
+  const auto uvs = asset->view<uint16_t>(uvAccessor);
+  ASSERT_FALSE(uvs.empty());
+  EXPECT_TRUE(uvs.isContiguous());
+  EXPECT_EQ(uvs.at(GridSize - 1, 0), 65535);
+
+  Float32Array values;
+  ASSERT_TRUE(asset->readFloats(uvAccessor, values));
+  ASSERT_EQ(values.size(), testAsset.vertexCount() * 2);
+  EXPECT_FLOAT_EQ(values[(GridSize - 1) * 2], 1.f);
+  EXPECT_NEAR(values[2], 1.f / (GridSize - 1), 1e-4f);
+
+  Uint32Array indices;
+  ASSERT_TRUE(asset->readIndices(asset->accessors[5], indices));
+  ASSERT_EQ(indices.size(), testAsset.indexCount());
+  EXPECT_EQ(indices[1], GridSize);
+}
+
+TEST(TestGLTF2Asset, Sparse_accessors_are_substituted)
+{
+  using namespace BABYLON;
+
+  const auto testAsset = makeGridAsset(MeshCount, GridSize);
+  const auto glb       = testAsset.glb();
+  const auto asset     = loadGLB(glb);
+  ASSERT_TRUE(asset != nullptr);
+
+  const auto& sparseAccessor = asset->accessors[testAsset.sparseAccessor()];
+  EXPECT_TRUE(asset->view<float>(sparseAccessor).empty());
+
+  Float32Array basePositions, positions;
+  ASSERT_TRUE(asset->readFloats(asset->accessors[0], basePositions));
+  ASSERT_TRUE(asset->readFloats(sparseAccessor, positions));
+  ASSERT_EQ(positions.size(), basePositions.size());
+  const size_t last = testAsset.vertexCount() - 1;
+  for (size_t v = 0; v <= last; ++v) {
+    for (size_t c = 0; c < 3; ++c) {
+      const float expected
+        = (v == 1) ? 9.f : (v == last) ? 7.f : basePositions[v * 3 + c];
+      EXPECT_FLOAT_EQ(positions[v * 3 + c], expected);
+    }
+  }
+}
+
+TEST(TestGLTF2Asset, Files_are_memory_mapped)
+{
+  using namespace BABYLON;
+
+  const auto glbAsset = makeGridAsset(MeshCount, GridSize);
+  const auto glb      = glbAsset.glb();
+  writeFile("gltf2_asset_test.glb", glb);
+  auto asset = GLTF2Asset::LoadFromFile("gltf2_asset_test.glb");
+  ASSERT_TRUE(asset != nullptr);
+  EXPECT_EQ(asset->mappedByteLength(), glb.size());
+  EXPECT_EQ(asset->allocatedByteLength(), 0u);
+  EXPECT_EQ(asset->accessors.size(), glbAsset.sparseAccessor() + 1);
+
+  // .gltf file with an external buffer
+  const auto gltfAsset = makeGridAsset(MeshCount, GridSize, "gltf2_test.bin");
+  writeFile("gltf2_asset_test.gltf", gltfAsset.json);
+  writeFile("gltf2_test.bin", gltfAsset.binary);
+  asset = GLTF2Asset::LoadFromFile("gltf2_asset_test.gltf");
+  ASSERT_TRUE(asset != nullptr);
+  EXPECT_EQ(asset->mappedByteLength(),
+            gltfAsset.json.size() + gltfAsset.binary.size());
+  Float32Array glbPositions, gltfPositions;
+  ASSERT_TRUE(asset->readFloats(asset->accessors[6], gltfPositions));
+  ASSERT_TRUE(loadGLB(glb)->readFloats(asset->accessors[6], glbPositions));
+  EXPECT_EQ(gltfPositions, glbPositions);
+
+  std::remove("gltf2_asset_test.glb");
+  std::remove("gltf2_asset_test.gltf");
+  std::remove("gltf2_test.bin");
+}
+
+TEST(TestGLTF2Asset, Invalid_assets_are_rejected)
+{
+  using namespace BABYLON;
+
+  const auto load = [](const std::string& json) {
+    return GLTF2Asset::LoadFromMemory(
+      reinterpret_cast<const uint8_t*>(json.data()), json.size(), "");
+  };
+  // 12 bytes buffer, as a data uri
+  const std::string buffers
+    = "\"buffers\":[{\"uri\":\"data:application/octet-stream;base64,"
+      "AAAAAAAAAAAAAAAA\",\"byteLength\":12}],"
+      "\"bufferViews\":[{\"buffer\":0,\"byteLength\":12}]";
+
+  const auto asset = load(
+    "{" + buffers
+    + ",\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":1,"
+      "\"type\":\"VEC3\"}]}");
+  ASSERT_TRUE(asset != nullptr);
+  EXPECT_EQ(asset->allocatedByteLength(), 12u);
+
+  // Accessor out of the buffer view
+  EXPECT_TRUE(load("{" + buffers
+                   + ",\"accessors\":[{\"bufferView\":0,\"componentType\":"
+                     "5126,\"count\":2,\"type\":\"VEC3\"}]}")
+              == nullptr);
+  // Buffer view out of the buffer
+  EXPECT_TRUE(load("{\"buffers\":[{\"uri\":\"data:;base64,AAAA\","
+                   "\"byteLength\":3}],\"bufferViews\":[{\"buffer\":0,"
+                   "\"byteOffset\":2,\"byteLength\":2}]}")
+              == nullptr);
+  // Buffer view whose byteOffset + byteLength wraps around to 0
+  EXPECT_TRUE(load("{\"buffers\":[{\"uri\":\"data:;base64,AAAA\","
+                   "\"byteLength\":3}],\"bufferViews\":[{\"buffer\":0,"
+                   "\"byteOffset\":9223372036854775808,"
+                   "\"byteLength\":9223372036854775808}]}")
+              == nullptr);
+  // Accessor whose last element offset wraps around to 0 (2^62 elements)
+  EXPECT_TRUE(load("{" + buffers
+                   + ",\"accessors\":[{\"bufferView\":0,\"componentType\":"
+                     "5126,\"count\":4611686018427387904,"
+                     "\"type\":\"VEC3\"}]}")
+              == nullptr);
+  // Node hierarchy with a cycle
+  EXPECT_TRUE(load("{\"nodes\":[{\"children\":[1]},{\"children\":[0]}]}")
+              == nullptr);
+  // Truncated GLB
+  const auto glb = makeGridAsset(1, 2).glb();
+  EXPECT_TRUE(loadGLB(glb.substr(0, glb.size() - 4)) == nullptr);
+}
+
+TEST(TestGLTF2FileLoader, Vertex_data_and_skins)
+{
+  using namespace BABYLON;
+
+  const auto testAsset = makeGridAsset(MeshCount, GridSize);
+  const auto glb       = testAsset.glb();
+  const auto asset     = loadGLB(glb);
+  ASSERT_TRUE(asset != nullptr);
+
+  const auto vertexData = GLTF2FileLoader::BuildVertexData(*asset);
+  ASSERT_EQ(vertexData.size(), MeshCount);
+  for (size_t m = 0; m < MeshCount; ++m) {
+    ASSERT_EQ(vertexData[m].size(), 1u);
+    const auto& data = *vertexData[m][0];
+    EXPECT_EQ(data.positions.size(), testAsset.vertexCount() * 3);
+    EXPECT_FLOAT_EQ(data.positions[1], static_cast<float>(m));
+    EXPECT_EQ(data.normals.size(), testAsset.vertexCount() * 3);
+    EXPECT_EQ(data.indices.size(), testAsset.indexCount());
+    // Flipped v
+    EXPECT_FLOAT_EQ(data.uvs[1], 1.f);
+    EXPECT_NEAR(data.uvs[GridSize * 2 + 1], 1.f - 1.f / (GridSize - 1), 1e-4f);
+    EXPECT_EQ(data.matricesIndices.size(), testAsset.vertexCount() * 4);
+    EXPECT_FLOAT_EQ(data.matricesIndices[1], 1.f);
+    EXPECT_EQ(data.matricesWeights.size(), testAsset.vertexCount() * 4);
+  }
+
+  const auto skins = GLTF2FileLoader::BuildSkins(*asset);
+  ASSERT_EQ(skins.size(), 1u);
+  // The root joint (joint 1) is created first
+  EXPECT_EQ(skins[0].boneOrder, std::vector<size_t>({1, 0}));
+  EXPECT_EQ(skins[0].parentJoints, std::vector<int>({1, -1}));
+  // The child bone is translated by (0, 1, 0) relatively to the root bone
+  ASSERT_EQ(skins[0].boneMatrices.size(), 2u);
+  EXPECT_TRUE(skins[0].boneMatrices[1].isIdentity());
+  EXPECT_FLOAT_EQ(skins[0].boneMatrices[0].m[12], 0.f);
+  EXPECT_FLOAT_EQ(skins[0].boneMatrices[0].m[13], 1.f);
+  EXPECT_FLOAT_EQ(skins[0].boneMatrices[0].m[14], 0.f);
+}
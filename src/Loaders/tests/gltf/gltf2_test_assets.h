@@ -0,0 +1,247 @@
+#ifndef BABYLON_LOADERS_TESTS_GLTF_GLTF2_TEST_ASSETS_H
+#define BABYLON_LOADERS_TESTS_GLTF_GLTF2_TEST_ASSETS_H
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Generated glTF 2.0 test asset: meshCount grids of gridSize x gridSize
+ * vertices, skinned with two joints, using the layouts the loader has to
+ * handle (interleaved attributes, normalized texture coordinates, sparse
+ * accessor).
+ *
+ * Nodes: 0 "root_joint" > 1 "child_joint", then one node "mesh<m>" per mesh.
+ * The skin joints are [1, 0], so that the child joint comes first.
+ * Accessors, per mesh: position (0), normal (1), uv (2), joints (3),
+ * weights (4), indices (5); then the inverse bind matrices and the sparse
+ * copy of the positions of the first mesh, which replaces the vertices 1 and
+ * vertexCount - 1 by (9, 9, 9) and (7, 7, 7).
+ */
+struct GLTF2TestAsset {
+  std::string json;
+  std::string binary;
+  size_t meshCount;
+  size_t gridSize;
+
+  size_t vertexCount() const
+  {
+    return gridSize * gridSize;
+  }
+
+  size_t indexCount() const
+  {
+    return 6 * (gridSize - 1) * (gridSize - 1);
+  }
+
+  size_t inverseBindMatricesAccessor() const
+  {
+    return meshCount * 6;
+  }
+
+  size_t sparseAccessor() const
+  {
+    return meshCount * 6 + 1;
+  }
+
+  /**
+   * Returns the GLB file content.
+   */
+  std::string glb() const
+  {
+    std::string paddedJSON = json, paddedBinary = binary;
+    paddedJSON.append((4 - paddedJSON.size() % 4) % 4, ' ');
+    paddedBinary.append((4 - paddedBinary.size() % 4) % 4, '\0');
+    std::string glb;
+    append(glb, uint32_t(0x46546C67));
+    append(glb, uint32_t(2));
+    append(glb, static_cast<uint32_t>(12 + 8 + paddedJSON.size() + 8
+                                      + paddedBinary.size()));
+    append(glb, static_cast<uint32_t>(paddedJSON.size()));
+    append(glb, uint32_t(0x4E4F534A));
+    glb += paddedJSON;
+    append(glb, static_cast<uint32_t>(paddedBinary.size()));
+    append(glb, uint32_t(0x004E4942));
+    glb += paddedBinary;
+    return glb;
+  }
+
+  template <typename T>
+  static void append(std::string& data, const T& value)
+  {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    data.append(bytes, sizeof(T));
+  }
+};
+
+inline GLTF2TestAsset makeGridAsset(size_t meshCount, size_t gridSize,
+                                    const std::string& bufferUri = "")
+{
+  GLTF2TestAsset asset;
+  asset.meshCount = meshCount;
+  asset.gridSize  = gridSize;
+
+  const size_t vertexCount = asset.vertexCount();
+  const float step         = 1.f / static_cast<float>(gridSize - 1);
+  std::ostringstream bufferViews, accessors, meshes, nodes;
+  auto& binary = asset.binary;
+
+  size_t bufferViewCount   = 0;
+  const auto addBufferView = [&](size_t byteOffset, size_t byteStride) {
+    const size_t index = bufferViewCount++;
+    bufferViews << (index ? "," : "") << "{\"buffer\":0,\"byteOffset\":"
+                << byteOffset
+                << ",\"byteLength\":" << binary.size() - byteOffset;
+    if (byteStride) {
+      bufferViews << ",\"byteStride\":" << byteStride;
+    }
+    bufferViews << "}";
+    return index;
+  };
+
+  size_t firstPositionView = 0;
+  for (size_t m = 0; m < meshCount; ++m) {
+    // Interleaved positions and normals
+    size_t offset = binary.size();
+    for (size_t j = 0; j < gridSize; ++j) {
+      for (size_t i = 0; i < gridSize; ++i) {
+        for (float value : {static_cast<float>(i) * step,
+                            static_cast<float>(m),
+                            static_cast<float>(j) * step, 0.f, 1.f, 0.f}) {
+          GLTF2TestAsset::append(binary, value);
+        }
+      }
+    }
+    const size_t positionView = addBufferView(offset, 24);
+    if (m == 0) {
+      firstPositionView = positionView;
+    }
+
+    // Normalized texture coordinates
+    offset = binary.size();
+    for (size_t j = 0; j < gridSize; ++j) {
+      for (size_t i = 0; i < gridSize; ++i) {
+        GLTF2TestAsset::append(binary, static_cast<uint16_t>(i * 65535
+                                                             / (gridSize - 1)));
+        GLTF2TestAsset::append(binary, static_cast<uint16_t>(j * 65535
+                                                             / (gridSize - 1)));
+      }
+    }
+    const size_t uvView = addBufferView(offset, 0);
+
+    // Joints and weights, blending from the child to the root joint along x
+    offset = binary.size();
+    for (size_t v = 0; v < vertexCount; ++v) {
+      for (uint8_t joint : {0, 1, 0, 0}) {
+        GLTF2TestAsset::append(binary, joint);
+      }
+    }
+    const size_t jointView = addBufferView(offset, 0);
+    offset                 = binary.size();
+    for (size_t v = 0; v < vertexCount; ++v) {
+      const float weight = static_cast<float>(v % gridSize) * step;
+      for (float value : {weight, 1.f - weight, 0.f, 0.f}) {
+        GLTF2TestAsset::append(binary, value);
+      }
+    }
+    const size_t weightView = addBufferView(offset, 0);
+
+    offset = binary.size();
+    for (size_t j = 0; j + 1 < gridSize; ++j) {
+      for (size_t i = 0; i + 1 < gridSize; ++i) {
+        const auto index = static_cast<uint32_t>(j * gridSize + i);
+        const auto width = static_cast<uint32_t>(gridSize);
+        for (uint32_t value : {index, index + width, index + 1, index + 1,
+                               index + width, index + width + 1}) {
+          GLTF2TestAsset::append(binary, value);
+        }
+      }
+    }
+    const size_t indexView = addBufferView(offset, 0);
+
+    accessors << (m ? "," : "") << "{\"bufferView\":" << positionView
+              << ",\"componentType\":5126,\"count\":" << vertexCount
+              << ",\"type\":\"VEC3\"},{\"bufferView\":" << positionView
+              << ",\"byteOffset\":12,\"componentType\":5126,\"count\":"
+              << vertexCount << ",\"type\":\"VEC3\"},{\"bufferView\":" << uvView
+              << ",\"componentType\":5123,\"normalized\":true,\"count\":"
+              << vertexCount << ",\"type\":\"VEC2\"},{\"bufferView\":"
+              << jointView << ",\"componentType\":5121,\"count\":"
+              << vertexCount << ",\"type\":\"VEC4\"},{\"bufferView\":"
+              << weightView << ",\"componentType\":5126,\"count\":"
+              << vertexCount << ",\"type\":\"VEC4\"},{\"bufferView\":"
+              << indexView << ",\"componentType\":5125,\"count\":"
+              << asset.indexCount() << ",\"type\":\"SCALAR\"}";
+    const size_t a = m * 6;
+    meshes << (m ? "," : "") << "{\"name\":\"grid" << m
+           << "\",\"primitives\":[{\"attributes\":{\"POSITION\":" << a
+           << ",\"NORMAL\":" << a + 1 << ",\"TEXCOORD_0\":" << a + 2
+           << ",\"JOINTS_0\":" << a + 3 << ",\"WEIGHTS_0\":" << a + 4
+           << "},\"indices\":" << a + 5 << "}]}";
+    nodes << ",{\"name\":\"mesh" << m << "\",\"mesh\":" << m
+          << ",\"skin\":0}";
+  }
+
+  // Inverse bind matrices (column-major) of the child joint, translated by
+  // (0, 1, 0), and of the root joint
+  size_t offset = binary.size();
+  for (float value : {1.f, 0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f,
+                      0.f, 0.f, -1.f, 0.f, 1.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f,
+                      0.f, 0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 1.f}) {
+    GLTF2TestAsset::append(binary, value);
+  }
+  const size_t inverseBindMatricesView = addBufferView(offset, 0);
+
+  offset = binary.size();
+  GLTF2TestAsset::append(binary, uint16_t(1));
+  GLTF2TestAsset::append(binary, static_cast<uint16_t>(vertexCount - 1));
+  const size_t sparseIndicesView = addBufferView(offset, 0);
+  offset                         = binary.size();
+  for (float value : {9.f, 9.f, 9.f, 7.f, 7.f, 7.f}) {
+    GLTF2TestAsset::append(binary, value);
+  }
+  const size_t sparseValuesView = addBufferView(offset, 0);
+
+  accessors << ",{\"bufferView\":" << inverseBindMatricesView
+            << ",\"componentType\":5126,\"count\":2,\"type\":\"MAT4\"}"
+            << ",{\"bufferView\":" << firstPositionView
+            << ",\"componentType\":5126,\"count\":" << vertexCount
+            << ",\"type\":\"VEC3\",\"sparse\":{\"count\":2,\"indices\":{"
+            << "\"bufferView\":" << sparseIndicesView
+            << ",\"componentType\":5123},\"values\":{\"bufferView\":"
+            << sparseValuesView << "}}}";
+
+  std::ostringstream sceneNodes;
+  sceneNodes << "0";
+  for (size_t m = 0; m < meshCount; ++m) {
+    sceneNodes << "," << m + 2;
+  }
+
+  std::ostringstream json;
+  json << "{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{"
+       << "\"nodes\":[" << sceneNodes.str() << "]}],\"nodes\":[{\"name\":"
+       << "\"root_joint\",\"children\":[1]},{\"name\":\"child_joint\","
+       << "\"translation\":[0,1,0]}" << nodes.str() << "],\"meshes\":["
+       << meshes.str() << "],\"skins\":[{\"inverseBindMatrices\":"
+       << meshCount * 6 << ",\"joints\":[1,0]}],\"accessors\":["
+       << accessors.str() << "],\"bufferViews\":[" << bufferViews.str()
+       << "],\"buffers\":[{";
+  if (!bufferUri.empty()) {
+    json << "\"uri\":\"" << bufferUri << "\",";
+  }
+  json << "\"byteLength\":" << binary.size() << "}]}";
+  asset.json = json.str();
+
+  return asset;
+}
+
+inline void writeFile(const std::string& filename, const std::string& content)
+{
+  std::ofstream stream(filename, std::ios::binary);
+  stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+#endif // end of BABYLON_LOADERS_TESTS_GLTF_GLTF2_TEST_ASSETS_H
@@ -62,7 +62,7 @@ bool CellMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<CellMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<CellMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -64,7 +64,7 @@ bool FireMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<FireMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<FireMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -103,7 +103,7 @@ bool FurMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<FurMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<FurMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
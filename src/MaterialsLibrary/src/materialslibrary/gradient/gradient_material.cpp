@@ -63,7 +63,7 @@ bool GradientMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<GradientMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<GradientMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -50,7 +50,7 @@ bool GridMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<GridMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<GridMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
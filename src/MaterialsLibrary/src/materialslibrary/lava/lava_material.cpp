@@ -69,7 +69,7 @@ bool LavaMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<LavaMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<LavaMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
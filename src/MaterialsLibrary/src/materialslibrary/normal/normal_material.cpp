@@ -71,7 +71,7 @@ bool NormalMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<NormalMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<NormalMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -52,7 +52,7 @@ bool ShadowOnlyMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<ShadowOnlyMaterialDefines>();
   }
 
-  auto defines = *(
+  auto& defines = *(
     static_cast<ShadowOnlyMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
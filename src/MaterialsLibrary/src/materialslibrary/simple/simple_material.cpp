@@ -61,7 +61,7 @@ bool SimpleMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<SimpleMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<SimpleMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -65,7 +65,7 @@ bool SkyMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<SkyMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<SkyMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
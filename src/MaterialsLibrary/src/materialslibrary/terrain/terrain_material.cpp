@@ -69,7 +69,7 @@ bool TerrainMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<TerrainMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<TerrainMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -217,7 +217,7 @@ void TerrainMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
   if (!_defines) {
     return;
   }
-  auto defines = *_defines;
+  auto& defines = *_defines;
 
   auto effect   = subMesh->effect();
   _activeEffect = effect;
@@ -70,7 +70,7 @@ bool TriPlanarMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<TriPlanarMaterialDefines>();
   }
 
-  auto defines = *(
+  auto& defines = *(
     static_cast<TriPlanarMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -228,7 +228,7 @@ void TriPlanarMaterial::bindForSubMesh(Matrix* world, Mesh* mesh,
   if (!_defines) {
     return;
   }
-  auto defines = *_defines;
+  auto& defines = *_defines;
 
   auto effect   = subMesh->effect();
   _activeEffect = effect;
@@ -136,7 +136,7 @@ bool WaterMaterial::isReadyForSubMesh(AbstractMesh* mesh, SubMesh* subMesh,
     subMesh->_materialDefines = std::make_unique<WaterMaterialDefines>();
   }
 
-  auto defines
+  auto& defines
     = *(static_cast<WaterMaterialDefines*>(subMesh->_materialDefines.get()));
   auto scene = getScene();
 
@@ -306,7 +306,7 @@ void WaterMaterial::bindForSubMesh(Matrix* world, Mesh* mesh, SubMesh* subMesh)
   if (!_defines) {
     return;
   }
-  auto defines = *_defines;
+  auto& defines = *_defines;
 
   auto effect   = subMesh->effect();
   _activeEffect = effect;